@@ -0,0 +1,170 @@
+/***************************************************************************
+ *        comptel.cpp - Benchmarks COMPTEL instrument response function    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file comptel.cpp
+ * @brief Benchmarks COMPTEL instrument response function
+ * @author Juergen Knoedlseder
+ *
+ * Computes the COMPTEL instrument response function for the full data
+ * space of a COMPTEL observation (76 x 74 x 25 bins), once by calling
+ * GCOMResponse::irf() for each event bin, and once using
+ * GCOMResponse::irf_cube(). The computation is done for a point source
+ * and for a diffuse source. As GCOMResponse does not implement the
+ * response for diffuse models, the diffuse source is represented by a
+ * Gaussian intensity profile of 2 deg width that is sampled on a grid of
+ * 0.5 deg spacing out to 5 deg, which corresponds to the convolution of
+ * a diffuse map. For both methods the CPU time and the convolved data
+ * space are reported.
+ *
+ * The directory containing the COMPTEL test data is given as the first
+ * argument, the calibration database as the second argument (both
+ * default to the test data of the source tree).
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "GammaLib.hpp"
+#include "GCOMLib.hpp"
+
+
+/***********************************************************************//**
+ * @brief Compare response computations
+ *
+ * @param[in] obs COMPTEL observation.
+ * @param[in] dirs Source directions.
+ * @param[in] weights Source direction weights.
+ *
+ * Convolves the sources at @p dirs with the COMPTEL response, once for
+ * each event bin and once for all event bins of the cube.
+ ***************************************************************************/
+void benchmark(const GCOMObservation&      obs,
+               const std::vector<GSkyDir>& dirs,
+               const std::vector<double>&  weights)
+{
+    // Get response and events
+    const GCOMResponse* rsp    = obs.response();
+    const GEvents*      events = obs.events();
+    int                 nbins  = events->size();
+
+    // Convolve sources with response of each event bin
+    std::vector<double> model_old(nbins, 0.0);
+    clock_t t_start = clock();
+    for (int k = 0; k < dirs.size(); ++k) {
+        GPhoton photon(dirs[k], GEnergy(1.0, "MeV"), GTime());
+        for (int i = 0; i < nbins; ++i) {
+            model_old[i] += weights[k] * rsp->irf(*((*events)[i]), photon, obs);
+        }
+    }
+    double t_old = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Convolve sources with response of all event bins
+    std::vector<double> model_new(nbins, 0.0);
+    t_start = clock();
+    for (int k = 0; k < dirs.size(); ++k) {
+        GPhoton photon(dirs[k], GEnergy(1.0, "MeV"), GTime());
+        GVector irfs = rsp->irf_cube(photon, obs);
+        for (int i = 0; i < nbins; ++i) {
+            model_new[i] += weights[k] * irfs[i];
+        }
+    }
+    double t_new = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Determine sums and maximum relative difference
+    double sum_old  = 0.0;
+    double sum_new  = 0.0;
+    double max_diff = 0.0;
+    for (int i = 0; i < nbins; ++i) {
+        sum_old += model_old[i];
+        sum_new += model_new[i];
+        if (model_old[i] != 0.0) {
+            double diff = std::abs(model_new[i]/model_old[i] - 1.0);
+            if (diff > max_diff) {
+                max_diff = diff;
+            }
+        }
+    }
+
+    // Print results
+    std::printf("  %-28s %12s %12s\n", "", "irf()", "irf_cube()");
+    std::printf("  %-28s %12.4f %12.4f\n", "CPU time (s)", t_old, t_new);
+    std::printf("  %-28s %12.4e %12.4e\n", "Sum of model", sum_old, sum_new);
+    std::printf("  Maximum relative model difference: %.2e\n", max_diff);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Main entry point
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Set data directory and calibration database
+    std::string datadir = (argc > 1) ? argv[1] : "../../../inst/com/test/data";
+    std::string caldb   = (argc > 2) ? argv[2] : "../../../inst/com/caldb";
+    setenv("CALDB", caldb.c_str(), 1);
+
+    // Setup observation
+    GCOMObservation obs(datadir+"/m50439_dre.fits",
+                        datadir+"/m34997_drg.fits",
+                        datadir+"/m34997_drg.fits",
+                        datadir+"/m32171_drx.fits");
+    obs.response("ENERG(1.0-3.0)MeV", GCaldb("cgro", "comptel"));
+
+    // Set source position
+    GSkyDir centre;
+    centre.radec_deg(83.6331, 22.0145);
+
+    // Setup point source
+    std::vector<GSkyDir> ptsrc_dirs(1, centre);
+    std::vector<double>  ptsrc_weights(1, 1.0);
+
+    // Setup diffuse source
+    std::vector<GSkyDir> diffuse_dirs;
+    std::vector<double>  diffuse_weights;
+    for (double x = -5.0; x <= 5.0; x += 0.5) {
+        for (double y = -5.0; y <= 5.0; y += 0.5) {
+            double r2 = x*x + y*y;
+            if (r2 <= 25.0) {
+                GSkyDir dir;
+                dir.radec_deg(centre.ra_deg() + x / std::cos(centre.dec()),
+                              centre.dec_deg() + y);
+                diffuse_dirs.push_back(dir);
+                diffuse_weights.push_back(std::exp(-0.5 * r2 / 4.0));
+            }
+        }
+    }
+
+    // Benchmark point source and diffuse source
+    std::printf("%d event bins\n", obs.events()->size());
+    std::printf("Point source:\n");
+    benchmark(obs, ptsrc_dirs, ptsrc_weights);
+    std::printf("Diffuse source (%d directions):\n", (int)diffuse_dirs.size());
+    benchmark(obs, diffuse_dirs, diffuse_weights);
+
+    // Exit
+    return 0;
+}
@@ -0,0 +1,217 @@
+/***************************************************************************
+ *          cubefill.cpp - Benchmark of CTA response cube filling          *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file cubefill.cpp
+ * @brief Benchmark of CTA response cube filling
+ * @author Juergen Knoedlseder
+ *
+ * Times GCTACubeExposure::fill(), GCTACubePsf::fill() and
+ * GCTACubeBackground::fill() for a single CTA observation on map sizes
+ * that are typical for a stacked analysis:
+ * - exposure and background cubes of 200 x 200 pixels of 0.02 deg and
+ *   20 energy bins,
+ * - a PSF cube of 50 x 50 pixels of 0.08 deg, 20 energy bins and
+ *   200 offset bins up to 0.3 deg.
+ *
+ * The background cube is filled once for an IRF background model, which
+ * uses the offset angle table, and once with an additional point source of
+ * zero intensity, which enforces the evaluation of the models for all
+ * bins. For each fill the CPU time and the wall clock time are reported,
+ * the latter showing the gain of a library that was compiled with OpenMP.
+ *
+ * The performance table given as the first argument is used as response
+ * (defaults to the test performance table of the source tree). The number
+ * of exposure and background cube pixels per axis can be given as second
+ * argument (defaults to 200); the PSF cube has a quarter of the pixels per
+ * axis.
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <cstdlib>
+#include <cstdio>
+#include <ctime>
+#include <sys/time.h>
+#include "GammaLib.hpp"
+#include "GCTALib.hpp"
+
+
+/***********************************************************************//**
+ * @brief Return wall clock time in seconds
+ ***************************************************************************/
+double wall_time(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double(tv.tv_sec) + 1.0e-6 * double(tv.tv_usec));
+}
+
+
+/***********************************************************************//**
+ * @brief Return sum of all sky map values
+ *
+ * @param[in] map Sky map.
+ * @return Sum of all pixels of all maps.
+ ***************************************************************************/
+double sum(const GSkymap& map)
+{
+    double result = 0.0;
+    for (int imap = 0; imap < map.nmaps(); ++imap) {
+        for (int pixel = 0; pixel < map.npix(); ++pixel) {
+            result += map(pixel, imap);
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Print timing of a cube fill
+ *
+ * @param[in] name Cube name.
+ * @param[in] c_start CPU clock at start of fill.
+ * @param[in] w_start Wall clock time at start of fill.
+ * @param[in] map Filled cube.
+ ***************************************************************************/
+void report(const char* name, const std::clock_t& c_start,
+            const double& w_start, const GSkymap& map)
+{
+    // Get elapsed times
+    double t_cpu  = double(std::clock() - c_start) / CLOCKS_PER_SEC;
+    double t_wall = wall_time() - w_start;
+
+    // Print result
+    std::printf("  %-32s: %8.3f sec CPU, %8.3f sec wall (%d x %d x %d, sum=%g)\n",
+                name, t_cpu, t_wall, map.nx(), map.ny(), map.nmaps(),
+                sum(map));
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark CTA response cube filling
+ *
+ * Usage: cubefill [table] [npix]
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Set performance table and cube size
+    std::string table = (argc > 1) ? argv[1]
+                                   : "../../../inst/cta/test/caldb/cta_dummy_irf.dat";
+    int         npix  = (argc > 2) ? std::atoi(argv[2]) : 200;
+
+    // Setup response from performance table
+    GCTAAeffPerfTable       aeff(table);
+    GCTAPsfPerfTable        psf(table);
+    GCTABackgroundPerfTable bgd(table);
+    GCTAResponseIrf         rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+    rsp.background(&bgd);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup ROI
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.dir(pntDir);
+    roi.centre(instDir);
+    roi.radius(3.0);
+
+    // Setup event list without events
+    GGti     gti;
+    GEbounds ebounds(20, GEnergy(0.1, "TeV"), GEnergy(100.0, "TeV"));
+    gti.append(GTime(0.0), GTime(1800.0));
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup observation
+    GCTAObservation cta;
+    cta.ontime(1800.0);
+    cta.livetime(1600.0);
+    cta.deadc(1600.0/1800.0);
+    cta.response(rsp);
+    cta.pointing(pnt);
+    cta.events(events);
+    GObservations obs;
+    obs.append(cta);
+
+    // Set cube geometries
+    double binsz     = 0.02;
+    int    npix_psf  = (npix / 4 > 1) ? npix / 4 : 1;
+    double binsz_psf = binsz * double(npix) / double(npix_psf);
+
+    // Benchmark exposure cube
+    GCTACubeExposure expcube("CAR", "CEL", 83.63, 22.01, binsz, binsz,
+                             npix, npix, ebounds);
+    std::clock_t c_start = std::clock();
+    double       w_start = wall_time();
+    expcube.fill(obs);
+    report("GCTACubeExposure::fill", c_start, w_start, expcube.cube());
+
+    // Benchmark PSF cube
+    GCTACubePsf psfcube("CAR", "CEL", 83.63, 22.01, binsz_psf, binsz_psf,
+                        npix_psf, npix_psf, ebounds, 0.3, 200);
+    c_start = std::clock();
+    w_start = wall_time();
+    psfcube.fill(obs);
+    report("GCTACubePsf::fill", c_start, w_start, psfcube.map());
+
+    // Setup background cube geometry
+    GSkymap       bkgmap("CAR", "CEL", 83.63, 22.01, binsz, binsz,
+                         npix, npix, ebounds.size());
+    GCTAEventCube bkgevents(bkgmap, ebounds, gti);
+
+    // Benchmark background cube for an IRF background model, which is
+    // filled from the offset angle table
+    GCTAModelIrfBackground irfbgd(GModelSpectralPlaw(1.0, 0.0,
+                                                     GEnergy(1.0, "TeV")));
+    GModels models;
+    models.append(irfbgd);
+    obs.models(models);
+    GCTACubeBackground bkgcube(bkgevents);
+    c_start = std::clock();
+    w_start = wall_time();
+    bkgcube.fill(obs);
+    report("GCTACubeBackground::fill (table)", c_start, w_start, bkgcube.cube());
+
+    // Benchmark background cube with model evaluation for all bins, which
+    // is enforced by adding a point source of zero intensity
+    GModelSky ptsrc(GModelSpatialPointSource(pntDir), GModelSpectralConst(0.0));
+    ptsrc.name("Zero");
+    models.append(ptsrc);
+    obs.models(models);
+    GCTACubeBackground bkgbins(bkgevents);
+    c_start = std::clock();
+    w_start = wall_time();
+    bkgbins.fill(obs);
+    report("GCTACubeBackground::fill (bins)", c_start, w_start, bkgbins.cube());
+
+    // Exit
+    return 0;
+}
@@ -0,0 +1,242 @@
+/***************************************************************************
+ *        cubelayout.cpp - Benchmarks pixel layouts of sky map cubes       *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file cubelayout.cpp
+ * @brief Benchmarks pixel layouts of sky map cubes
+ * @author Juergen Knoedlseder
+ *
+ * Compares the map-major and the pixel-major layout of sky map cubes for
+ * two typical use cases:
+ *
+ * - the evaluation of a diffuse map cube model using
+ *   GModelSpatialDiffuseCube::eval(), which interpolates two adjacent
+ *   energy maps for each photon direction, and
+ * - the interpolation of a PSF cube as done by GCTACubePsf::operator(),
+ *   which interpolates four maps that are indexed by delta and energy
+ *   (map index = idelta + iebin * ndeltas) for each photon direction.
+ *
+ * Both cubes are synthetic all-sky cubes that are large compared to the
+ * processor caches. For each layout the CPU time for the evaluations at
+ * random sky directions and energies is reported.
+ *
+ * The number of evaluations can be given as the first argument (defaults
+ * to 1000000).
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include "GammaLib.hpp"
+
+
+/***********************************************************************//**
+ * @brief Create synthetic all-sky map cube
+ *
+ * @param[in] binsz Pixel size (deg).
+ * @param[in] nmaps Number of maps.
+ * @return Sky map cube.
+ ***************************************************************************/
+GSkymap create_cube(const double& binsz, const int& nmaps)
+{
+    // Create all-sky cube
+    int     nx = int(360.0 / binsz + 0.5);
+    int     ny = int(180.0 / binsz + 0.5);
+    GSkymap cube("CAR", "GAL", 0.0, 0.0, -binsz, binsz, nx, ny, nmaps);
+
+    // Fill cube with smooth values
+    for (int k = 0; k < nmaps; ++k) {
+        for (int i = 0; i < cube.npix(); ++i) {
+            cube(i,k) = 1.0 + 0.5 * std::sin(0.001 * i) / (1.0 + k);
+        }
+    }
+
+    // Return cube
+    return cube;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark diffuse map cube evaluation
+ *
+ * @param[in] neval Number of evaluations.
+ ***************************************************************************/
+void benchmark_diffuse(const long& neval)
+{
+    // Set cube dimensions
+    const int nenergies = 30;
+
+    // Setup energies
+    GEnergies energies;
+    for (int k = 0; k < nenergies; ++k) {
+        energies.append(GEnergy(std::pow(10.0, 1.0 + 0.1 * k), "MeV"));
+    }
+
+    // Setup map-major model
+    GModelSpatialDiffuseCube model_map;
+    GSkymap                  cube = create_cube(0.5, nenergies);
+    model_map.cube(cube);
+    model_map.energies(energies);
+
+    // Setup pixel-major model
+    GModelSpatialDiffuseCube model_pixel;
+    cube.pixel_major();
+    model_pixel.cube(cube);
+    model_pixel.energies(energies);
+
+    // Setup random photons
+    GRan                 ran;
+    std::vector<GPhoton> photons;
+    photons.reserve(neval);
+    for (long i = 0; i < neval; ++i) {
+        GSkyDir dir;
+        dir.lb_deg(360.0 * ran.uniform() - 180.0, 178.0 * ran.uniform() - 89.0);
+        GEnergy energy(std::pow(10.0, 1.0 + 2.9 * ran.uniform()), "MeV");
+        photons.push_back(GPhoton(dir, energy, GTime()));
+    }
+
+    // Evaluate map-major model
+    double  sum_map = 0.0;
+    clock_t t_start = clock();
+    for (long i = 0; i < neval; ++i) {
+        sum_map += model_map.eval(photons[i]);
+    }
+    double t_map = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Evaluate pixel-major model
+    double sum_pixel = 0.0;
+    t_start = clock();
+    for (long i = 0; i < neval; ++i) {
+        sum_pixel += model_pixel.eval(photons[i]);
+    }
+    double t_pixel = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Print results
+    std::printf("Diffuse map cube (%d maps):\n", nenergies);
+    std::printf("  %-28s %12s %12s\n", "", "map-major", "pixel-major");
+    std::printf("  %-28s %12.4f %12.4f\n", "CPU time (s)", t_map, t_pixel);
+    std::printf("  %-28s %12.4e %12.4e\n", "Evaluations per second",
+                (t_map   > 0.0) ? neval / t_map   : 0.0,
+                (t_pixel > 0.0) ? neval / t_pixel : 0.0);
+    std::printf("  %-28s %12.6f %12.6f\n", "Mean model value",
+                sum_map / double(neval), sum_pixel / double(neval));
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark PSF cube interpolation
+ *
+ * @param[in] neval Number of evaluations.
+ ***************************************************************************/
+void benchmark_psf(const long& neval)
+{
+    // Set cube dimensions
+    const int ndeltas = 20;
+    const int nebins  = 10;
+
+    // Setup map-major and pixel-major cubes
+    GSkymap cube_map   = create_cube(1.0, ndeltas * nebins);
+    GSkymap cube_pixel = cube_map;
+    cube_pixel.pixel_major();
+
+    // Setup random directions and interpolation nodes in delta and energy
+    GRan                 ran;
+    std::vector<GSkyDir> dirs;
+    std::vector<int>     inx_delta;
+    std::vector<int>     inx_ebin;
+    std::vector<double>  wgt_delta;
+    std::vector<double>  wgt_ebin;
+    dirs.reserve(neval);
+    for (long i = 0; i < neval; ++i) {
+        GSkyDir dir;
+        dir.lb_deg(360.0 * ran.uniform() - 180.0, 178.0 * ran.uniform() - 89.0);
+        dirs.push_back(dir);
+        inx_delta.push_back(int((ndeltas - 1) * ran.uniform()));
+        inx_ebin.push_back(int((nebins - 1) * ran.uniform()));
+        wgt_delta.push_back(ran.uniform());
+        wgt_ebin.push_back(ran.uniform());
+    }
+
+    // Interpolate cubes
+    double sum[2] = {0.0, 0.0};
+    double t[2]   = {0.0, 0.0};
+    for (int layout = 0; layout < 2; ++layout) {
+        const GSkymap& cube    = (layout == 0) ? cube_map : cube_pixel;
+        clock_t        t_start = clock();
+        for (long i = 0; i < neval; ++i) {
+
+            // Compute map indices and weights as in GCTACubePsf::update()
+            int    inx1 = inx_delta[i]     + inx_ebin[i]     * ndeltas;
+            int    inx2 = inx_delta[i]     + (inx_ebin[i]+1) * ndeltas;
+            int    inx3 = inx_delta[i] + 1 + inx_ebin[i]     * ndeltas;
+            int    inx4 = inx_delta[i] + 1 + (inx_ebin[i]+1) * ndeltas;
+            double wgt1 = (1.0 - wgt_delta[i]) * (1.0 - wgt_ebin[i]);
+            double wgt2 = (1.0 - wgt_delta[i]) * wgt_ebin[i];
+            double wgt3 = wgt_delta[i]         * (1.0 - wgt_ebin[i]);
+            double wgt4 = wgt_delta[i]         * wgt_ebin[i];
+
+            // Interpolate as in GCTACubePsf::operator()
+            GBilinear interpolator = cube.interpolator(dirs[i]);
+            sum[layout] += wgt1 * cube(interpolator, inx1) +
+                           wgt2 * cube(interpolator, inx2) +
+                           wgt3 * cube(interpolator, inx3) +
+                           wgt4 * cube(interpolator, inx4);
+
+        }
+        t[layout] = double(clock() - t_start) / CLOCKS_PER_SEC;
+    }
+
+    // Print results
+    std::printf("PSF cube (%d deltas x %d energies):\n", ndeltas, nebins);
+    std::printf("  %-28s %12s %12s\n", "", "map-major", "pixel-major");
+    std::printf("  %-28s %12.4f %12.4f\n", "CPU time (s)", t[0], t[1]);
+    std::printf("  %-28s %12.4e %12.4e\n", "Evaluations per second",
+                (t[0] > 0.0) ? neval / t[0] : 0.0,
+                (t[1] > 0.0) ? neval / t[1] : 0.0);
+    std::printf("  %-28s %12.6f %12.6f\n", "Mean PSF value",
+                sum[0] / double(neval), sum[1] / double(neval));
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Main entry point
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Set number of evaluations
+    long neval = (argc > 1) ? std::atol(argv[1]) : 1000000;
+
+    // Benchmark diffuse map cube and PSF cube
+    std::printf("%ld evaluations\n", neval);
+    benchmark_diffuse(neval);
+    benchmark_psf(neval);
+
+    // Exit
+    return 0;
+}
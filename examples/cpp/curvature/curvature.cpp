@@ -0,0 +1,182 @@
+/***************************************************************************
+ *        curvature.cpp - Benchmark of curvature matrix accumulation       *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file curvature.cpp
+ * @brief Benchmark of curvature matrix accumulation
+ * @author Juergen Knoedlseder
+ *
+ * Compares the accumulation of the likelihood curvature matrix in a sparse
+ * matrix with fill stack and in a dense symmetric matrix with rank-1
+ * updates for 50 and 200 parameters.
+ *
+ * The number of events can be given as the first argument (defaults to
+ * 1000000).
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <cstdlib>
+#include <ctime>
+#include "GammaLib.hpp"
+
+
+/***********************************************************************//**
+ * @brief Accumulate curvature matrix using a sparse matrix
+ *
+ * @param[in] grad Event gradients.
+ * @param[in] nevents Number of events.
+ * @param[in] npars Number of parameters.
+ * @return Sum of curvature matrix elements.
+ *
+ * Accumulates the curvature matrix column by column using the fill stack
+ * of a sparse matrix, as done by the likelihood computation up to
+ * GammaLib 0.11.
+ ***************************************************************************/
+double sparse(const std::vector<double>& grad, const int& nevents,
+              const int& npars)
+{
+    // Allocate matrix and working arrays
+    GMatrixSparse curvature(npars, npars);
+    int*          inx    = new int[npars];
+    double*       values = new double[npars];
+    for (int i = 0; i < npars; ++i) {
+        inx[i] = i;
+    }
+
+    // Initialise fill stack
+    int stack_size  = (2*npars > 100000) ? 2*npars : 100000;
+    int max_entries =  2*npars;
+    curvature.stack_init(stack_size, max_entries);
+
+    // Loop over events
+    for (int k = 0; k < nevents; ++k) {
+        const double* g  = &grad[(k % 1000) * npars];
+        double        fa = 1.0 / (1.0 + k % 7);
+        for (int j = 0; j < npars; ++j) {
+            double fa_j = fa * g[j];
+            for (int i = 0; i < npars; ++i) {
+                values[i] = fa_j * g[i];
+            }
+            curvature.add_to_column(j, values, inx, npars);
+        }
+    }
+
+    // Destroy fill stack
+    curvature.stack_destroy();
+
+    // Free working arrays
+    delete [] values;
+    delete [] inx;
+
+    // Return sum
+    return curvature.sum();
+}
+
+
+/***********************************************************************//**
+ * @brief Accumulate curvature matrix using a symmetric matrix
+ *
+ * @param[in] grad Event gradients.
+ * @param[in] nevents Number of events.
+ * @param[in] npars Number of parameters.
+ * @return Sum of curvature matrix elements.
+ *
+ * Accumulates the curvature matrix by rank-1 updates of a symmetric matrix
+ * and converts the result into a sparse matrix at the end, as done by the
+ * likelihood computation.
+ ***************************************************************************/
+double symmetric(const std::vector<double>& grad, const int& nevents,
+                 const int& npars)
+{
+    // Allocate matrix and working array
+    GMatrixSymmetric curvature(npars, npars);
+    int*             inx = new int[npars];
+    for (int i = 0; i < npars; ++i) {
+        inx[i] = i;
+    }
+
+    // Loop over events
+    for (int k = 0; k < nevents; ++k) {
+        const double* g  = &grad[(k % 1000) * npars];
+        double        fa = 1.0 / (1.0 + k % 7);
+        curvature.add_outer_product(g, inx, npars, fa);
+    }
+
+    // Convert into sparse matrix
+    GMatrixSparse result(curvature);
+
+    // Free working array
+    delete [] inx;
+
+    // Return sum
+    return result.sum();
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark curvature matrix accumulation
+ *
+ * Usage: curvature [nevents]
+ *
+ * Compares the CPU time needed for accumulating the curvature matrix of
+ * @p nevents events (default: 1000000) for 50 and 200 parameters using a
+ * sparse matrix with fill stack and a symmetric matrix with rank-1 updates.
+ ***************************************************************************/
+int main(int argc, char *argv[]) {
+
+    // Get number of events
+    int nevents = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    // Set number of parameters
+    const int npars[] = {50, 200};
+
+    // Loop over number of parameters
+    for (int ipar = 0; ipar < 2; ++ipar) {
+
+        // Generate gradients for 1000 different events
+        GRan                ran;
+        std::vector<double> grad(1000 * npars[ipar]);
+        for (int i = 0; i < grad.size(); ++i) {
+            grad[i] = ran.normal();
+        }
+
+        // Benchmark sparse matrix
+        std::clock_t t_start    = std::clock();
+        double       sum_sparse = sparse(grad, nevents, npars[ipar]);
+        double       t_sparse   = double(std::clock() - t_start) / CLOCKS_PER_SEC;
+
+        // Benchmark symmetric matrix
+        t_start                 = std::clock();
+        double       sum_sym    = symmetric(grad, nevents, npars[ipar]);
+        double       t_sym      = double(std::clock() - t_start) / CLOCKS_PER_SEC;
+
+        // Print results
+        std::cout << nevents << " events, " << npars[ipar] << " parameters"
+                  << std::endl;
+        std::cout << "  GMatrixSparse ...: " << t_sparse << " sec"
+                  << " (sum=" << sum_sparse << ")" << std::endl;
+        std::cout << "  GMatrixSymmetric : " << t_sym << " sec"
+                  << " (sum=" << sum_sym << ")" << std::endl;
+
+    } // endfor: looped over number of parameters
+
+    // Exit
+    return 0;
+}
@@ -0,0 +1,376 @@
+/***************************************************************************
+ *      integration.cpp - Benchmarks numerical integration methods         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file integration.cpp
+ * @brief Benchmarks numerical integration methods
+ * @author Juergen Knoedlseder
+ *
+ * Compares the accuracy, the number of kernel evaluations and the CPU time
+ * of the Romberg, Gauss-Kronrod and Gauss-Legendre integration
+ * methods of GIntegral for
+ * - a one-dimensional King profile,
+ * - a two-dimensional (rho,omega) integral of a Gaussian PSF over a disk,
+ * - the CTA radial model kernel cta_irf_radial_kern_rho using the
+ *   performance table given as the first argument (defaults to the test
+ *   performance table of the source tree).
+ *
+ * The two-dimensional integrals are computed with Romberg integrations
+ * of fixed order for both angles, as done in GCTAResponseIrf, and with
+ * tensor product Gauss-Legendre rules.
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <ctime>
+#include <cstdio>
+#include "GammaLib.hpp"
+#include "GCTALib.hpp"
+#include "GCTAResponse_helpers.hpp"
+
+
+/***********************************************************************//**
+ * @brief King profile
+ *
+ * Radial King profile times sin(r), as used for the PSF normalisation.
+ ***************************************************************************/
+class king : public GFunction {
+public:
+    king(const double& sigma, const double& gamma) : m_calls(0),
+                                                     m_sigma(sigma),
+                                                     m_gamma(gamma) {}
+    double eval(const double& r) {
+        m_calls++;
+        double u = 0.5 * r * r / (m_sigma * m_sigma);
+        return std::sin(r) * std::pow(1.0 + u/m_gamma, -m_gamma);
+    }
+    int m_calls; //!< Number of kernel calls
+protected:
+    double m_sigma; //!< Width parameter
+    double m_gamma; //!< Tail parameter
+};
+
+
+/***********************************************************************//**
+ * @brief Azimuthal kernel of Gaussian PSF over disk
+ ***************************************************************************/
+class disk_omega : public GFunction {
+public:
+    disk_omega(const double& sigma, const double& zeta, const double& rho,
+               int* calls) : m_sigma(sigma),
+                             m_cos(std::cos(rho)*std::cos(zeta)),
+                             m_sin(std::sin(rho)*std::sin(zeta)),
+                             m_calls(calls) {}
+    double eval(const double& omega) {
+        (*m_calls)++;
+        double delta = gammalib::acos(m_cos + m_sin * std::cos(omega));
+        return std::exp(-0.5 * delta * delta / (m_sigma * m_sigma));
+    }
+protected:
+    double m_sigma; //!< Gaussian width
+    double m_cos;   //!< cos(rho)*cos(zeta)
+    double m_sin;   //!< sin(rho)*sin(zeta)
+    int*   m_calls; //!< Number of kernel calls
+};
+
+
+/***********************************************************************//**
+ * @brief Zenith angle kernel of Gaussian PSF over disk
+ *
+ * The azimuthal integration is done with a Romberg integration of fixed
+ * order @p iter if @p order is 0, and with a Gauss-Legendre rule of given
+ * @p order otherwise.
+ ***************************************************************************/
+class disk_rho : public GFunction {
+public:
+    disk_rho(const double& sigma, const double& zeta, const int& iter,
+             const int& order) : m_calls(0), m_sigma(sigma), m_zeta(zeta),
+                                 m_iter(iter), m_order(order) {}
+    double eval(const double& rho) {
+        disk_omega integrand(m_sigma, m_zeta, rho, &m_calls);
+        GIntegral  integral(&integrand);
+        integral.fixed_iter(m_iter);
+        double value = (m_order > 0)
+                       ? integral.gauss_legendre(0.0, gammalib::pi, m_order)
+                       : integral.romberg(0.0, gammalib::pi, m_iter);
+        return 2.0 * value * std::sin(rho);
+    }
+    int m_calls; //!< Number of kernel calls
+protected:
+    double m_sigma; //!< Gaussian width
+    double m_zeta;  //!< Distance of disk centre
+    int    m_iter;  //!< Romberg iterations
+    int    m_order; //!< Gauss-Legendre order (0: Romberg)
+};
+
+
+/***********************************************************************//**
+ * @brief Integrate kernel with a given method
+ *
+ * @param[in] integral Integral.
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] method Method (0: Romberg, 1: Gauss-Kronrod,
+ *                   >1: Gauss-Legendre of that order).
+ * @param[in] iter Romberg iterations (0: no fixed number of iterations).
+ ***************************************************************************/
+double integrate(GIntegral& integral, const double& a, const double& b,
+                 const int& method, const int& iter)
+{
+    double value = 0.0;
+    if (method == 0) {
+        integral.fixed_iter(iter);
+        value = integral.romberg(a, b, 5);
+    }
+    else if (method == 1) {
+        value = integral.gauss_kronrod(a, b);
+    }
+    else {
+        value = integral.gauss_legendre(a, b, method);
+    }
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Print benchmark result
+ ***************************************************************************/
+void report(const std::string& method, const double& value,
+            const double& reference, const int& calls, const double& cpu)
+{
+    double error = (reference != 0.0) ? std::abs(value/reference - 1.0) : 0.0;
+    std::printf("  %-26s %18.12e  rel.err=%8.2e  calls=%8d  cpu=%8.3f ms\n",
+                method.c_str(), value, error, calls, cpu);
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark one-dimensional integration
+ ***************************************************************************/
+void benchmark_1d(void)
+{
+    // Header
+    std::cout << "King profile over [0,0.1] radians" << std::endl;
+
+    // Setup kernel
+    king      fct(0.02, 2.0);
+    GIntegral integral(&fct);
+    integral.silent(true);
+    integral.eps(1.0e-12);
+
+    // Compute reference
+    double reference = integral.romberg(0.0, 0.1, 5);
+
+    // Set methods
+    const int   n_methods          = 9;
+    const int   methods[n_methods] = {0, 0, 0, 1, 2, 4, 8, 16, 32};
+    const int   iters[n_methods]   = {0, 5, 8, 0, 0, 0, 0, 0, 0};
+    const char* names[n_methods]   = {"Romberg (eps=1e-6)",
+                                      "Romberg (iter=5)",
+                                      "Romberg (iter=8)",
+                                      "Gauss-Kronrod (eps=1e-6)", 
+                                      "Gauss-Legendre (2)",
+                                      "Gauss-Legendre (4)",
+                                      "Gauss-Legendre (8)",
+                                      "Gauss-Legendre (16)",
+                                      "Gauss-Legendre (32)"};
+
+    // Loop over methods
+    integral.eps(1.0e-6);
+    for (int i = 0; i < n_methods; ++i) {
+        const int repeat = 1000;
+        double    value  = 0.0;
+        fct.m_calls      = 0;
+        std::clock_t t0  = std::clock();
+        for (int k = 0; k < repeat; ++k) {
+            value = integrate(integral, 0.0, 0.1, methods[i], iters[i]);
+        }
+        double cpu = double(std::clock() - t0) / CLOCKS_PER_SEC * 1000.0 / repeat;
+        report(names[i], value, reference, fct.m_calls/repeat, cpu);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark two-dimensional integration
+ ***************************************************************************/
+void benchmark_2d(void)
+{
+    // Header
+    std::cout << "Gaussian PSF over disk (rho,omega)" << std::endl;
+
+    // Set parameters
+    double sigma  = 0.05 * gammalib::deg2rad;
+    double zeta   = 0.1  * gammalib::deg2rad;
+    double radius = 0.2  * gammalib::deg2rad;
+
+    // Compute reference
+    disk_rho  ref_kernel(sigma, zeta, 0, 64);
+    GIntegral ref_integral(&ref_kernel);
+    double    reference = 0.0;
+    for (int i = 0; i < 8; ++i) {
+        double a = radius * i / 8.0;
+        double b = radius * (i+1) / 8.0;
+        reference += ref_integral.gauss_legendre(a, b, 64);
+    }
+
+    // Set methods
+    const int   n_methods          = 6;
+    const int   orders[n_methods]  = {0, 0, 8, 16, 24, 32};
+    const int   iters[n_methods]   = {5, 6, 0, 0, 0, 0};
+    const char* names[n_methods]   = {"Romberg (5x5 iter)",
+                                      "Romberg (6x6 iter)",
+                                      "Gauss-Legendre (8x8)",
+                                      "Gauss-Legendre (16x16)",
+                                      "Gauss-Legendre (24x24)",
+                                      "Gauss-Legendre (32x32)"};
+
+    // Loop over methods
+    for (int i = 0; i < n_methods; ++i) {
+        const int repeat = 100;
+        disk_rho  kernel(sigma, zeta, iters[i], orders[i]);
+        GIntegral integral(&kernel);
+        double    value = 0.0;
+        std::clock_t t0 = std::clock();
+        for (int k = 0; k < repeat; ++k) {
+            int method = (orders[i] > 0) ? orders[i] : 0;
+            value      = integrate(integral, 0.0, radius, method, iters[i]);
+        }
+        double cpu = double(std::clock() - t0) / CLOCKS_PER_SEC * 1000.0 / repeat;
+        report(names[i], value, reference, kernel.m_calls/repeat, cpu);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark CTA radial model kernel
+ *
+ * @param[in] filename Performance table filename.
+ ***************************************************************************/
+void benchmark_cta(const std::string& filename)
+{
+    // Header
+    std::cout << "CTA radial disk kernel (" << filename << ")" << std::endl;
+
+    // Setup response
+    GCTAResponseIrf   rsp;
+    GCTAAeffPerfTable aeff(filename);
+    GCTAPsfPerfTable  psf(filename);
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup disk model
+    GSkyDir centre;
+    centre.radec_deg(0.0, 0.0);
+    GModelSpatialRadialDisk model(centre, 0.2);
+
+    // Set geometry
+    GEnergy srcEng;
+    GEnergy obsEng;
+    GTime   srcTime;
+    srcEng.TeV(1.0);
+    obsEng.TeV(1.0);
+    double srcLogEng = srcEng.log10TeV();
+    double zenith    = 0.0;
+    double azimuth   = 0.0;
+    double zeta      = 0.1 * gammalib::deg2rad;
+    double lambda    = 1.0 * gammalib::deg2rad;
+    double omega0    = 0.5 * gammalib::pi;
+    double delta_max = rsp.psf_delta_max(lambda, 0.0, zenith, azimuth,
+                                         srcLogEng);
+    double rho_min   = (zeta > delta_max) ? zeta - delta_max : 0.0;
+    double rho_max   = zeta + delta_max;
+    if (rho_max > model.theta_max()) {
+        rho_max = model.theta_max();
+    }
+
+    // Compute reference
+    int                     iter_ref = 0;
+    cta_irf_radial_kern_rho ref_kernel(rsp, model, zenith, azimuth, srcEng,
+                                       srcTime, srcLogEng, obsEng, zeta,
+                                       lambda, omega0, delta_max, iter_ref,
+                                       64);
+    GIntegral               ref_integral(&ref_kernel);
+    double                  reference = 0.0;
+    for (int i = 0; i < 8; ++i) {
+        double a = rho_min + (rho_max - rho_min) * i / 8.0;
+        double b = rho_min + (rho_max - rho_min) * (i+1) / 8.0;
+        reference += ref_integral.gauss_legendre(a, b, 64);
+    }
+
+    // Set methods
+    const int   n_methods          = 6;
+    const int   orders[n_methods]  = {0, 0, 8, 16, 24, 32};
+    const int   iters[n_methods]   = {5, 6, 0, 0, 0, 0};
+    const char* names[n_methods]   = {"Romberg (5x5 iter)",
+                                      "Romberg (6x6 iter)",
+                                      "Gauss-Legendre (8x8)",
+                                      "Gauss-Legendre (16x16)",
+                                      "Gauss-Legendre (24x24)",
+                                      "Gauss-Legendre (32x32)"};
+
+    // Loop over methods
+    for (int i = 0; i < n_methods; ++i) {
+        const int               repeat = 100;
+        cta_irf_radial_kern_rho kernel(rsp, model, zenith, azimuth, srcEng,
+                                       srcTime, srcLogEng, obsEng, zeta,
+                                       lambda, omega0, delta_max, iters[i],
+                                       orders[i]);
+        GIntegral               integral(&kernel);
+        double                  value = 0.0;
+        std::clock_t            t0    = std::clock();
+        for (int k = 0; k < repeat; ++k) {
+            int method = (orders[i] > 0) ? orders[i] : 0;
+            value      = integrate(integral, rho_min, rho_max, method, iters[i]);
+        }
+        double cpu = double(std::clock() - t0) / CLOCKS_PER_SEC * 1000.0 / repeat;
+        int n      = (orders[i] > 0) ? orders[i] : (1 << (iters[i]-1)) + 1;
+        int calls  = n * n;
+        report(names[i], value, reference, calls, cpu);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Benchmark integration methods
+ ***************************************************************************/
+int main(int argc, char *argv[]) {
+
+    // Get performance table filename
+    std::string filename = (argc > 1) ? argv[1]
+                           : "../../../inst/cta/test/caldb/cta_dummy_irf.dat";
+
+    // Run benchmarks
+    benchmark_1d();
+    benchmark_2d();
+    benchmark_cta(filename);
+
+    // Exit
+    return 0;
+}
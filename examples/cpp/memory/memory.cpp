@@ -0,0 +1,229 @@
+/***************************************************************************
+ *     memory.cpp - Benchmarks memory used in the likelihood evaluation    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file memory.cpp
+ * @brief Benchmarks memory used in the likelihood evaluation
+ * @author Juergen Knoedlseder
+ *
+ * Measures the peak memory that is used by one likelihood evaluation of a
+ * CTA observation for a model that comprises a diffuse map cube, as a
+ * function of the number of OpenMP threads. As each thread works on a copy
+ * of the models, the peak memory increased by the size of the map cube per
+ * thread before the map cube pixels were shared between model copies.
+ *
+ * Usage: memory [size] [table]
+ *
+ * where @p size is the size of the map cube in MB (defaults to 1024) and
+ * @p table is the performance table that is used as response (defaults to
+ * the test performance table of the source tree). Each measurement is done
+ * in a separate process for 1, 2, 4, ..., 64 threads.
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include "GammaLib.hpp"
+#include "GCTALib.hpp"
+#include "GTools.hpp"
+
+
+/***********************************************************************//**
+ * @brief Return peak resident memory of process in MB
+ ***************************************************************************/
+double peak_memory(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    #if defined(__APPLE__)
+    return double(usage.ru_maxrss) / 1024.0 / 1024.0;
+    #else
+    return double(usage.ru_maxrss) / 1024.0;
+    #endif
+}
+
+
+/***********************************************************************//**
+ * @brief Setup observations with diffuse map cube model
+ *
+ * @param[in] size Size of map cube (MB).
+ * @param[in] table Performance table.
+ ***************************************************************************/
+GObservations setup_observations(const double& size, const std::string& table)
+{
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup ROI
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.dir(pntDir);
+    roi.centre(instDir);
+    roi.radius(0.5);
+
+    // Setup event list with events on a grid within the ROI
+    GGti     gti;
+    GEbounds ebounds;
+    gti.append(GTime(0.0), GTime(1800.0));
+    ebounds.append(GEnergy(1.0, "TeV"), GEnergy(1.2, "TeV"));
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+    for (int i = 0; i < 64; ++i) {
+        GSkyDir dir;
+        dir.radec_deg(pntDir.ra_deg()  + 0.05 * (i % 8 - 3.5),
+                      pntDir.dec_deg() + 0.05 * (i / 8 - 3.5));
+        GCTAEventAtom event;
+        event.dir(GCTAInstDir(dir));
+        event.energy(GEnergy(1.1, "TeV"));
+        event.time(GTime(10.0 * i));
+        events.append(event);
+    }
+
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(table);
+    GCTAPsfPerfTable  psf(table);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup observation
+    GCTAObservation run;
+    run.ontime(1800.0);
+    run.livetime(1600.0);
+    run.deadc(1600.0/1800.0);
+    run.response(rsp);
+    run.pointing(pnt);
+    run.events(events);
+
+    // Setup map cube with 4 maps of the requested size
+    int    nmaps = 4;
+    int    npix  = int(size * 1024.0 * 1024.0 / 8.0 / nmaps);
+    int    ny    = int(std::sqrt(npix / 2.0));
+    int    nx    = npix / ny;
+    double dx    = 4.0 / nx;
+    GSkymap cube("CAR", "CEL", pntDir.ra_deg(), pntDir.dec_deg(),
+                 -dx, dx, nx, ny, nmaps);
+    for (int i = 0; i < cube.npix(); ++i) {
+        for (int k = 0; k < nmaps; ++k) {
+            cube(i,k) = 1.0e-6 * (k+1);
+        }
+    }
+
+    // Declare pixels as shared so that the model does not copy the cube
+    cube.share();
+
+    // Setup map cube energies
+    GEnergies energies;
+    energies.append(GEnergy(0.1, "TeV"));
+    energies.append(GEnergy(1.0, "TeV"));
+    energies.append(GEnergy(10.0, "TeV"));
+    energies.append(GEnergy(100.0, "TeV"));
+
+    // Setup diffuse model
+    GModelSpatialDiffuseCube spatial(cube, energies);
+    GModelSpectralConst      spectral(1.0);
+    GModelSky                model(spatial, spectral);
+    model.name("Diffuse");
+    model["Value"].free();
+
+    // Setup models
+    GModels models;
+    models.append(model);
+
+    // Setup observations
+    GObservations obs;
+    obs.append(run);
+    obs.models(models);
+
+    // Return observations
+    return obs;
+}
+
+
+/***********************************************************************//**
+ * @brief Measure peak memory of one likelihood evaluation
+ *
+ * @param[in] size Size of map cube (MB).
+ * @param[in] table Performance table.
+ ***************************************************************************/
+void measure(const double& size, const std::string& table)
+{
+    // Setup observations
+    GObservations obs = setup_observations(size, table);
+
+    // Get peak memory before likelihood evaluation
+    double before = peak_memory();
+
+    // Evaluate likelihood
+    obs.eval();
+
+    // Get peak memory after likelihood evaluation
+    double after = peak_memory();
+
+    // Print result
+    std::printf("%10.1f %10.1f %10.1f\n", before, after, after-before);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Main entry point
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // If the program was called for a single measurement then do it
+    if (argc > 1 && std::string(argv[1]) == "--measure") {
+        measure(gammalib::todouble(argv[2]), argv[3]);
+        return 0;
+    }
+
+    // Get arguments
+    double      size  = (argc > 1) ? gammalib::todouble(argv[1]) : 1024.0;
+    std::string table = (argc > 2) ? argv[2]
+                        : "../../../inst/cta/test/caldb/cta_dummy_irf.dat";
+
+    // Print header
+    std::printf("Map cube of %.1f MB\n", size);
+    std::printf("%7s %10s %10s %10s\n", "Threads", "Before", "Peak",
+                "Increase");
+
+    // Perform measurements in separate processes
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        std::printf("%7d ", threads);
+        std::fflush(stdout);
+        std::string cmd = "OMP_NUM_THREADS="+gammalib::str(threads)+" "+
+                          std::string(argv[0])+" --measure "+
+                          gammalib::str(size)+" "+table;
+        if (std::system(cmd.c_str()) != 0) {
+            std::printf("failed\n");
+        }
+    }
+
+    // Exit
+    return 0;
+}
@@ -0,0 +1,230 @@
+/***************************************************************************
+ *          npred.cpp - Benchmarks Npred and Npred gradient computation    *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file npred.cpp
+ * @brief Benchmarks Npred and Npred gradient computation
+ * @author Juergen Knoedlseder
+ *
+ * Computes Npred and the Npred gradients of a model of 20 point sources
+ * with power law spectra for a CTA observation, once by computing Npred
+ * and a numerical gradient for each parameter (as done before the single
+ * pass computation was introduced), and once using
+ * GObservation::npred(GModels&, GVector*). For both methods the number of
+ * spatially integrated response evaluations (GResponse::nroi() calls),
+ * which corresponds to one likelihood iteration, and the CPU time are
+ * reported. The computation is done with fixed source positions and with
+ * free source positions.
+ *
+ * The performance table given as the first argument is used as response
+ * (defaults to the test performance table of the source tree).
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <ctime>
+#include <cstdio>
+#include "GammaLib.hpp"
+#include "GCTALib.hpp"
+#include "GTools.hpp"
+
+
+/***********************************************************************//**
+ * @brief CTA response that counts the nroi() calls
+ ***************************************************************************/
+class counting_response : public GCTAResponseIrf {
+public:
+    counting_response(void) : GCTAResponseIrf() {}
+    counting_response(const counting_response& rsp) : GCTAResponseIrf(rsp) {}
+    counting_response* clone(void) const {
+        return new counting_response(*this);
+    }
+    double nroi(const GModelSky&    model,
+                const GEnergy&      obsEng,
+                const GTime&        obsTime,
+                const GObservation& obs) const {
+        calls++;
+        return GCTAResponseIrf::nroi(model, obsEng, obsTime, obs);
+    }
+    static long calls; //!< Number of nroi() calls
+};
+long counting_response::calls = 0;
+
+
+/***********************************************************************//**
+ * @brief Setup model of 20 point sources
+ *
+ * @param[in] centre Centre of source distribution.
+ * @param[in] free_position Free source positions?
+ ***************************************************************************/
+GModels setup_models(const GSkyDir& centre, const bool& free_position)
+{
+    // Initialise models
+    GModels models;
+
+    // Append sources on a grid around the centre
+    for (int i = 0; i < 20; ++i) {
+
+        // Set source position
+        GSkyDir dir;
+        dir.radec_deg(centre.ra_deg()  + 0.4 * (i % 5 - 2),
+                      centre.dec_deg() + 0.4 * (i / 5 - 1.5));
+
+        // Setup model
+        GModelSpatialPointSource spatial(dir);
+        GModelSpectralPlaw       spectral(5.7e-16, -2.0 - 0.05 * i,
+                                          GEnergy(0.3, "TeV"));
+        GModelTemporalConst      temporal;
+        GModelSky                model(spatial, spectral, temporal);
+        model.name("Source "+gammalib::str(i));
+
+        // Set free parameters
+        model["Prefactor"].free();
+        model["Index"].free();
+        if (free_position) {
+            model["RA"].free();
+            model["DEC"].free();
+        }
+        else {
+            model["RA"].fix();
+            model["DEC"].fix();
+        }
+
+        // Append model
+        models.append(model);
+
+    } // endfor: looped over sources
+
+    // Return models
+    return models;
+}
+
+
+/***********************************************************************//**
+ * @brief Compare Npred computations
+ *
+ * @param[in] obs Observation.
+ * @param[in] models Models.
+ ***************************************************************************/
+void benchmark(const GCTAObservation& obs, const GModels& models)
+{
+    // Compute Npred and numerical gradients for each parameter
+    GVector grad_old(models.npars());
+    double  npred_old = 0.0;
+    counting_response::calls = 0;
+    clock_t t_start = clock();
+    for (int i = 0, igrad = 0; i < models.size(); ++i) {
+        const GModel* model = models[i];
+        npred_old += obs.npred(*model);
+        for (int k = 0; k < model->size(); ++k, ++igrad) {
+            grad_old[igrad] = obs.npred_grad(*model, (*model)[k]);
+        }
+    }
+    double t_old     = double(clock() - t_start) / CLOCKS_PER_SEC;
+    long   calls_old = counting_response::calls;
+
+    // Compute Npred and gradients in a single pass
+    GVector grad_new(models.npars());
+    counting_response::calls = 0;
+    t_start = clock();
+    double npred_new = obs.npred(models, &grad_new);
+    double t_new     = double(clock() - t_start) / CLOCKS_PER_SEC;
+    long   calls_new = counting_response::calls;
+
+    // Determine maximum relative gradient difference
+    double max_diff = 0.0;
+    for (int i = 0; i < grad_old.size(); ++i) {
+        if (grad_old[i] != 0.0) {
+            double diff = std::abs(grad_new[i]/grad_old[i] - 1.0);
+            if (diff > max_diff) {
+                max_diff = diff;
+            }
+        }
+    }
+
+    // Print results
+    std::printf("  %-28s %12s %12s\n", "", "numerical", "single pass");
+    std::printf("  %-28s %12ld %12ld\n", "nroi() calls per iteration",
+                calls_old, calls_new);
+    std::printf("  %-28s %12.4f %12.4f\n", "CPU time (s)", t_old, t_new);
+    std::printf("  %-28s %12.6f %12.6f\n", "Npred", npred_old, npred_new);
+    std::printf("  Maximum relative gradient difference: %.2e\n", max_diff);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Main entry point
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Set performance table
+    std::string table = (argc > 1) ? argv[1]
+                                   : "../../../inst/cta/test/caldb/cta_dummy_irf.dat";
+
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(table);
+    GCTAPsfPerfTable  psf(table);
+    counting_response rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup ROI
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.dir(pntDir);
+    roi.centre(instDir);
+    roi.radius(3.0);
+
+    // Setup event list without events
+    GGti     gti;
+    GEbounds ebounds;
+    gti.append(GTime(0.0), GTime(1800.0));
+    ebounds.append(GEnergy(0.1, "TeV"), GEnergy(100.0, "TeV"));
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.ontime(1800.0);
+    obs.livetime(1600.0);
+    obs.deadc(1600.0/1800.0);
+    obs.response(rsp);
+    obs.pointing(pnt);
+    obs.events(events);
+
+    // Benchmark with fixed and free source positions
+    std::printf("20 point sources, fixed positions:\n");
+    benchmark(obs, setup_models(pntDir, false));
+    std::printf("20 point sources, free positions:\n");
+    benchmark(obs, setup_models(pntDir, true));
+
+    // Exit
+    return 0;
+}
@@ -0,0 +1,119 @@
+/***************************************************************************
+ *     rotation.cpp - Benchmarks coordinate rotations of response kernels  *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file rotation.cpp
+ * @brief Benchmarks coordinate rotations of response kernels
+ * @author Juergen Knoedlseder
+ *
+ * Evaluates the coordinate rotation that is done for each kernel point of
+ * the azimuth angle integrations of the CTA response (for example in
+ * cta_irf_diffuse_kern_phi::eval()), once using the heap allocated GVector
+ * and GMatrix classes (as done before GVector3 and GMatrix3 were
+ * introduced), and once using the stack allocated GVector3 and GMatrix3
+ * classes. Each kernel evaluation builds a native vector, rotates it into
+ * celestial coordinates and sets a sky direction and a photon. The number
+ * of kernel evaluations per second is reported for both methods.
+ *
+ * The number of kernel evaluations can be given as the first argument
+ * (defaults to 10000000).
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include "GammaLib.hpp"
+
+
+/***********************************************************************//**
+ * @brief Main entry point
+ ***************************************************************************/
+int main(int argc, char *argv[])
+{
+    // Set number of kernel evaluations
+    long neval = (argc > 1) ? std::atol(argv[1]) : 10000000;
+
+    // Set kernel parameters
+    GSkyDir centre;
+    centre.radec_deg(83.6331, 22.0145);
+    GEnergy energy(1.0, "TeV");
+    GTime   time;
+    double  theta     = 0.5 * gammalib::deg2rad;
+    double  sin_theta = std::sin(theta);
+    double  cos_theta = std::cos(theta);
+    double  dphi      = gammalib::twopi / double(neval);
+
+    // Rotate using GVector and GMatrix
+    GMatrix ry;
+    GMatrix rz;
+    ry.eulery(centre.dec_deg() - 90.0);
+    rz.eulerz(-centre.ra_deg());
+    GMatrix rot = (ry * rz).transpose();
+    double  sum_old = 0.0;
+    clock_t t_start = clock();
+    for (long i = 0; i < neval; ++i) {
+        double  phi     = i * dphi;
+        double  cos_phi = std::cos(phi);
+        double  sin_phi = std::sin(phi);
+        GVector native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
+        GVector cel = rot * native;
+        GSkyDir srcDir;
+        srcDir.celvector(cel);
+        GPhoton photon(srcDir, energy, time);
+        sum_old += photon.dir().dec();
+    }
+    double t_old = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Rotate using GVector3 and GMatrix3
+    GMatrix3 ry3;
+    GMatrix3 rz3;
+    ry3.eulery(centre.dec_deg() - 90.0);
+    rz3.eulerz(-centre.ra_deg());
+    GMatrix3 rot3    = (ry3 * rz3).transpose();
+    double   sum_new = 0.0;
+    t_start = clock();
+    for (long i = 0; i < neval; ++i) {
+        double   phi     = i * dphi;
+        double   cos_phi = std::cos(phi);
+        double   sin_phi = std::sin(phi);
+        GVector3 native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
+        GVector3 cel = rot3 * native;
+        GSkyDir  srcDir;
+        srcDir.celvector(cel);
+        GPhoton  photon(srcDir, energy, time);
+        sum_new += photon.dir().dec();
+    }
+    double t_new = double(clock() - t_start) / CLOCKS_PER_SEC;
+
+    // Print results
+    std::printf("%ld kernel evaluations\n", neval);
+    std::printf("  %-28s %12s %12s\n", "", "GMatrix", "GMatrix3");
+    std::printf("  %-28s %12.4f %12.4f\n", "CPU time (s)", t_old, t_new);
+    std::printf("  %-28s %12.4e %12.4e\n", "Evaluations per second",
+                (t_old > 0.0) ? neval / t_old : 0.0,
+                (t_new > 0.0) ? neval / t_new : 0.0);
+    std::printf("  %-28s %12.6f %12.6f\n", "Mean declination (rad)",
+                sum_old / double(neval), sum_new / double(neval));
+
+    // Exit
+    return 0;
+}
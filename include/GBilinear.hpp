@@ -47,21 +47,30 @@ public:
 
     // Operators
     GBilinear& operator=(const GBilinear& interpolator);
-    double     operator()(const double* array);
+    double     operator()(const double* array, const int& stride = 1) const;
+    double     operator()(const float* array, const int& stride = 1) const;
 
     // Methods
-    void        clear(void);
-    GBilinear*  clone(void) const;
-    std::string classname(void) const;
-    int&        index1(void);
-    int&        index2(void);
-    int&        index3(void);
-    int&        index4(void);
-    double&     weight1(void);
-    double&     weight2(void);
-    double&     weight3(void);
-    double&     weight4(void);
-    std::string print(const GChatter& chatter = NORMAL) const;
+    void          clear(void);
+    GBilinear*    clone(void) const;
+    std::string   classname(void) const;
+    int&          index1(void);
+    int&          index2(void);
+    int&          index3(void);
+    int&          index4(void);
+    double&       weight1(void);
+    double&       weight2(void);
+    double&       weight3(void);
+    double&       weight4(void);
+    const int&    index1(void) const;
+    const int&    index2(void) const;
+    const int&    index3(void) const;
+    const int&    index4(void) const;
+    const double& weight1(void) const;
+    const double& weight2(void) const;
+    const double& weight3(void) const;
+    const double& weight4(void) const;
+    std::string   print(const GChatter& chatter = NORMAL) const;
 
 private:
     // Methods
@@ -188,4 +197,100 @@ double& GBilinear::weight4(void)
     return (m_wgt4);
 }
 
+
+/***********************************************************************//**
+ * @brief Access index 1 (const version)
+ *
+ * @return Reference to index 1.
+ ***************************************************************************/
+inline
+const int& GBilinear::index1(void) const
+{
+    return (m_inx1);
+}
+
+
+/***********************************************************************//**
+ * @brief Access index 2 (const version)
+ *
+ * @return Reference to index 2.
+ ***************************************************************************/
+inline
+const int& GBilinear::index2(void) const
+{
+    return (m_inx2);
+}
+
+
+/***********************************************************************//**
+ * @brief Access index 3 (const version)
+ *
+ * @return Reference to index 3.
+ ***************************************************************************/
+inline
+const int& GBilinear::index3(void) const
+{
+    return (m_inx3);
+}
+
+
+/***********************************************************************//**
+ * @brief Access index 4 (const version)
+ *
+ * @return Reference to index 4.
+ ***************************************************************************/
+inline
+const int& GBilinear::index4(void) const
+{
+    return (m_inx4);
+}
+
+
+/***********************************************************************//**
+ * @brief Access weight 1 (const version)
+ *
+ * @return Reference to weight 1.
+ ***************************************************************************/
+inline
+const double& GBilinear::weight1(void) const
+{
+    return (m_wgt1);
+}
+
+
+/***********************************************************************//**
+ * @brief Access weight 2 (const version)
+ *
+ * @return Reference to weight 2.
+ ***************************************************************************/
+inline
+const double& GBilinear::weight2(void) const
+{
+    return (m_wgt2);
+}
+
+
+/***********************************************************************//**
+ * @brief Access weight 3 (const version)
+ *
+ * @return Reference to weight 3.
+ ***************************************************************************/
+inline
+const double& GBilinear::weight3(void) const
+{
+    return (m_wgt3);
+}
+
+
+/***********************************************************************//**
+ * @brief Access weight 4 (const version)
+ *
+ * @return Reference to weight 4.
+ ***************************************************************************/
+inline
+const double& GBilinear::weight4(void) const
+{
+    return (m_wgt4);
+}
+
 #endif /* GBILINEAR_HPP */
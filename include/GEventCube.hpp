@@ -39,6 +39,13 @@
  * @brief Abstract event bin container class
  *
  * This class is an abstract container class for event bins.
+ *
+ * The bin access operators may return a pointer to a single bin that is
+ * updated on each access, and are therefore not safe for concurrent use.
+ * Clients that access bins from several threads should allocate an event
+ * bin view per thread using bin_view() and access the bins using the
+ * bin() method, which sets up the view for a given bin index without
+ * modifying the event cube.
  ***************************************************************************/
 class GEventCube : public GEvents {
 
@@ -68,6 +75,10 @@ public:
     virtual int         number(void) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual GEventBin*       bin_view(void) const;
+    virtual const GEventBin* bin(const int& index, GEventBin* view) const;
+
 protected:
     // Protected methods
     void         init_members(void);
@@ -42,6 +42,13 @@
  * In addition to the base class methods, it defines also an interface to the
  * region of interest (ROI) that is covered by the data space. The ROI can
  * be accessed by the roi() methods.
+ *
+ * The atom access operators may return a pointer to a single atom that is
+ * updated on each access, and are therefore not safe for concurrent use.
+ * Clients that access atoms from several threads should allocate an event
+ * atom view per thread using atom_view() and access the atoms using the
+ * atom() method, which sets up the view for a given atom index without
+ * modifying the event list.
  ***************************************************************************/
 class GEventList : public GEvents {
 
@@ -71,6 +78,10 @@ public:
     virtual const GRoi& roi(void) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual GEventAtom*       atom_view(void) const;
+    virtual const GEventAtom* atom(const int& index, GEventAtom* view) const;
+
 protected:
     // Protected methods
     void         init_members(void);
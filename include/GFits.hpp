@@ -37,8 +37,9 @@
 
 /* __ Prototypes _________________________________________________________ */
 namespace gammalib {
-    int fits_move_to_hdu(const std::string& caller, void* vptr,
-                         const int& hdunum = 0);
+    int  fits_move_to_hdu(const std::string& caller, void* vptr,
+                          const int& hdunum = 0);
+    bool fits_is_reentrant(void);
 }
 
 
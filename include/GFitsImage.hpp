@@ -76,6 +76,8 @@ public:
     const int&  anynul(void) const;
     void        nulval(const void* value);
     const void* nulval(void) const;
+    void        use_mmap(const bool& use_mmap);
+    const bool& use_mmap(void) const;
     std::string print(const GChatter& chatter = NORMAL) const;
 
 protected:
@@ -91,6 +93,7 @@ protected:
     void  open_image(void* vptr);
     void  load_image(int datatype, const void* pixels,
                      const void* nulval, int* anynul);
+    bool  load_image_mmap(void);
     void  save_image(int datatype, const void* pixels);
     void  fetch_data(void);
     int   offset(const int& ix) const;
@@ -112,6 +115,7 @@ protected:
     long* m_naxes;       //!< Number of pixels in each dimension
     int   m_num_pixels;  //!< Number of image pixels
     int   m_anynul;      //!< Number of NULLs encountered
+    bool  m_use_mmap;    //!< Load image pixels by memory mapping
 };
 
 
@@ -176,4 +180,37 @@ const void* GFitsImage::nulval(void) const
     return (const_cast<GFitsImage*>(this)->ptr_nulval());
 }
 
+
+/***********************************************************************//**
+ * @brief Set memory mapping flag
+ *
+ * @param[in] use_mmap Load image pixels by memory mapping?
+ *
+ * Signals whether the image pixels should be loaded by memory mapping the
+ * FITS file (see load_image_mmap()). Memory mapping is disabled by
+ * default. The flag needs to be set before the image pixels are loaded.
+ ***************************************************************************/
+inline
+void GFitsImage::use_mmap(const bool& use_mmap)
+{
+    // Set memory mapping flag
+    m_use_mmap = use_mmap;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns memory mapping flag
+ *
+ * @return True if image pixels are loaded by memory mapping.
+ ***************************************************************************/
+inline
+const bool& GFitsImage::use_mmap(void) const
+{
+    // Return memory mapping flag
+    return m_use_mmap;
+}
+
 #endif /* GFITSIMAGE_HPP */
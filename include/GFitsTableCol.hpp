@@ -95,6 +95,8 @@ public:
     const bool&             is_variable(void) const;
     void                    anynul(const int& anynul);
     const int&              anynul(void) const;
+    void                    use_mmap(const bool& use_mmap);
+    const bool&             use_mmap(void) const;
     std::string             tform_binary(void) const;
     std::string             print(const GChatter& chatter = NORMAL) const;
 
@@ -120,6 +122,7 @@ protected:
     virtual void        load_column(void);
     virtual void        load_column_fixed(void);
     virtual void        load_column_variable(void);
+    bool                load_column_mmap(void);
     virtual void        save_column(void);
     virtual void        save_column_fixed(void);
     virtual void        save_column_variable(void);
@@ -145,6 +148,7 @@ protected:
     std::vector<int> m_rowstart;  //!< Start index of each row
     mutable int      m_size;      //!< Size of allocated data area (0 if not loaded)
     int              m_anynul;    //!< Number of NULLs encountered
+    bool             m_use_mmap;  //!< Load column data by memory mapping
     void*            m_fitsfile;  //!< FITS file pointer associated with column
 };
 
@@ -487,4 +491,37 @@ const int& GFitsTableCol::anynul(void) const
     return m_anynul;
 }
 
+
+/***********************************************************************//**
+ * @brief Set memory mapping flag
+ *
+ * @param[in] use_mmap Load column data by memory mapping?
+ *
+ * Signals whether the column data should be loaded by memory mapping the
+ * FITS file (see load_column_mmap()). Memory mapping is disabled by
+ * default. The flag needs to be set before the column data are loaded.
+ ***************************************************************************/
+inline
+void GFitsTableCol::use_mmap(const bool& use_mmap)
+{
+    // Set memory mapping flag
+    m_use_mmap = use_mmap;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns memory mapping flag
+ *
+ * @return True if column data are loaded by memory mapping.
+ ***************************************************************************/
+inline
+const bool& GFitsTableCol::use_mmap(void) const
+{
+    // Return memory mapping flag
+    return m_use_mmap;
+}
+
 #endif /* GFITSTABLECOL_HPP */
@@ -66,9 +66,10 @@ public:
     virtual bool                 is_loaded(void) const;
     
     // Other methods
-    unsigned short* data(void);
-    unsigned short* nulval(void);
-    void            nulval(const unsigned short* value);
+    unsigned short*       data(void);
+    const unsigned short* data(void) const;
+    unsigned short*       nulval(void);
+    void                  nulval(const unsigned short* value);
 
 private:
     // Private methods
@@ -121,10 +122,30 @@ bool GFitsTableUShortCol::is_loaded(void) const
  * @brief Returns pointer to column data
  *
  * @return Pointer to column data.
+ *
+ * Loads the column data from the FITS file if they are not yet loaded.
  ***************************************************************************/
 inline
 unsigned short* GFitsTableUShortCol::data(void)
 {
+    if (m_data == NULL) fetch_data();
+    return m_data;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pointer to column data (const version)
+ *
+ * @return Pointer to column data.
+ *
+ * Loads the column data from the FITS file if they are not yet loaded.
+ * The pointer gives access to all column elements without any virtual
+ * method call, which makes it suited for reading entire columns.
+ ***************************************************************************/
+inline
+const unsigned short* GFitsTableUShortCol::data(void) const
+{
+    if (m_data == NULL) fetch_data();
     return m_data;
 }
 
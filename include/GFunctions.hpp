@@ -0,0 +1,73 @@
+/***************************************************************************
+ *     GFunctions.hpp - Single parameter functions abstract base class     *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GFunctions.hpp
+ * @brief Single parameter functions abstract base class definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GFUNCTIONS_HPP
+#define GFUNCTIONS_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include "GVector.hpp"
+
+
+/***********************************************************************//**
+ * @class GFunctions
+ *
+ * @brief Single parameter functions abstract base class
+ *
+ * This class implements the abstract interface for a set of functions that
+ * depend on a single parameter. In contrast to GFunction, the eval() method
+ * returns a vector of function values for a given value x. This allows to
+ * evaluate several integrands at the same time, for example a function and
+ * its parameter gradients, which is useful if an expensive computation is
+ * shared by all functions.
+ *
+ * Derived classes need to implement the size() method, which returns the
+ * number of functions, and the eval() method, which returns a vector of
+ * size() function values.
+ ***************************************************************************/
+class GFunctions {
+
+public:
+
+    // Constructors and destructors
+    GFunctions(void);
+    GFunctions(const GFunctions& functions);
+    virtual ~GFunctions(void);
+
+    // Operators
+    GFunctions& operator=(const GFunctions& functions);
+
+    // Methods
+    virtual int     size(void) const = 0;
+    virtual GVector eval(const double& x) = 0;
+
+protected:
+    // Protected methods
+    void init_members(void);
+    void copy_members(const GFunctions& functions);
+    void free_members(void);
+};
+
+#endif /* GFUNCTIONS_HPP */
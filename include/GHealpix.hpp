@@ -74,6 +74,10 @@ public:
     virtual GBilinear   interpolator(const GSkyDir& dir) const;
     virtual std::string print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual base class methods
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
+
     // Other methods
     const int&           npix(void) const;
     const int&           nside(void) const;
@@ -81,6 +81,8 @@ public:
                               const int& n = 1, double result = 0.0);
     double             adaptive_simpson(const double& a, const double& b) const;
     double             gauss_kronrod(const double& a, const double& b) const;
+    double             gauss_legendre(const double& a, const double& b,
+                                      const int& order = 16) const;
     std::string        print(const GChatter& chatter = NORMAL) const;
 
 protected:
@@ -97,6 +99,9 @@ protected:
     double rescale_error(double err,
                          const double& result_abs,
                          const double& result_asc) const;
+    static void gauss_legendre_rule(const int&     order,
+                                    const double** x,
+                                    const double** w);
 
     // Protected data area
     GFunction*  m_kernel;    //!< Pointer to function kernel
@@ -0,0 +1,133 @@
+/***************************************************************************
+ *         GIntegrals.hpp - Integration class for set of functions         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GIntegrals.hpp
+ * @brief Integration class for set of functions interface definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GINTEGRALS_HPP
+#define GINTEGRALS_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <string>
+#include <vector>
+#include "GIntegral.hpp"
+#include "GVector.hpp"
+#include "GFunctions.hpp"
+
+
+/***********************************************************************//**
+ * @class GIntegrals
+ *
+ * @brief Integration class for set of functions
+ *
+ * This class allows to perform the simultaneous integration of a set of
+ * functions that are implemented by a derived class of GFunctions. All
+ * functions are evaluated at the same abscissa values, hence computations
+ * that are common to all functions need only be done once per abscissa.
+ *
+ * The class derives from GIntegral, from which it inherits the integration
+ * parameters, the integration status information and the polynomial
+ * extrapolation of Romberg's method. For each individual function the
+ * result is identical to the result that GIntegral::romberg() would
+ * return. If no fixed number of iterations is specified, the integration
+ * is iterated until the requested relative precision is reached for all
+ * functions.
+ ***************************************************************************/
+class GIntegrals : public GIntegral {
+
+public:
+
+    // Constructors and destructors
+    explicit GIntegrals(void);
+    explicit GIntegrals(GFunctions* kernels);
+    GIntegrals(const GIntegrals& integrals);
+    virtual ~GIntegrals(void);
+
+    // Operators
+    GIntegrals& operator=(const GIntegrals& integrals);
+
+    // Methods
+    void              clear(void);
+    GIntegrals*       clone(void) const;
+    std::string       classname(void) const;
+    void              kernels(GFunctions* kernels);
+    const GFunctions* kernels(void) const;
+    GVector           romberg(std::vector<double> bounds,
+                              const int& order = 5);
+    GVector           romberg(const double& a, const double& b,
+                              const int& order = 5);
+    GVector           trapzd(const double& a, const double& b,
+                             const int& n = 1,
+                             GVector result = GVector());
+    std::string       print(const GChatter& chatter = NORMAL) const;
+
+protected:
+    // Protected methods
+    void init_members(void);
+    void copy_members(const GIntegrals& integrals);
+    void free_members(void);
+
+    // Protected data area
+    GFunctions* m_kernels;   //!< Pointer to function kernels
+};
+
+
+/***********************************************************************//**
+ * @brief Return class name
+ *
+ * @return String containing the class name ("GIntegrals").
+ ***************************************************************************/
+inline
+std::string GIntegrals::classname(void) const
+{
+    return ("GIntegrals");
+}
+
+
+/***********************************************************************//**
+ * @brief Set kernels
+ *
+ * @param[in] kernels Kernels.
+ *
+ * Sets the kernels for which the integrals should be determined.
+ ***************************************************************************/
+inline
+void GIntegrals::kernels(GFunctions* kernels)
+{
+    m_kernels = kernels;
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Get kernels
+ *
+ * @return Kernels.
+ ***************************************************************************/
+inline
+const GFunctions* GIntegrals::kernels(void) const
+{
+    return m_kernels;
+}
+
+#endif /* GINTEGRALS_HPP */
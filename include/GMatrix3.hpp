@@ -0,0 +1,253 @@
+/***************************************************************************
+ *               GMatrix3.hpp - Three-dimensional matrix class             *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GMatrix3.hpp
+ * @brief Three-dimensional matrix class interface definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GMATRIX3_HPP
+#define GMATRIX3_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <cmath>
+#include "GMath.hpp"
+#include "GVector3.hpp"
+
+
+/***********************************************************************//**
+ * @class GMatrix3
+ *
+ * @brief Three-dimensional matrix class
+ *
+ * This class implements a 3 x 3 double precision matrix that holds its
+ * elements on the stack. It is the companion of GVector3 and is mainly
+ * used for the rotation of three-dimensional vectors between coordinate
+ * systems. Like GVector3, the class is not derived from GBase, has no
+ * virtual methods and all methods are inline.
+ *
+ * The Euler rotation matrices are identical to those set by
+ * GMatrix::eulerx(), GMatrix::eulery() and GMatrix::eulerz(), and matrix
+ * products are summed in the same order as for GMatrix, hence rotations
+ * done with GMatrix3 give the same results as rotations done with GMatrix.
+ ***************************************************************************/
+class GMatrix3 {
+
+public:
+    // Constructors
+    GMatrix3(void);
+
+    // Operators
+    double&       operator()(const int& row, const int& column);
+    const double& operator()(const int& row, const int& column) const;
+    GVector3      operator*(const GVector3& vector) const;
+    GMatrix3      operator*(const GMatrix3& matrix) const;
+
+    // Methods
+    GMatrix3 transpose(void) const;
+    void     eulerx(const double& angle);
+    void     eulery(const double& angle);
+    void     eulerz(const double& angle);
+
+private:
+    // Private data area
+    double m_data[3][3];   //!< Matrix elements (row, column)
+};
+
+
+/***********************************************************************//**
+ * @brief Void constructor
+ *
+ * Constructs a null matrix.
+ ***************************************************************************/
+inline
+GMatrix3::GMatrix3(void)
+{
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            m_data[row][col] = 0.0;
+        }
+    }
+}
+
+
+/***********************************************************************//**
+ * @brief Matrix element access operator
+ *
+ * @param[in] row Matrix row [0,...,2].
+ * @param[in] column Matrix column [0,...,2].
+ * @return Reference to matrix element.
+ ***************************************************************************/
+inline
+double& GMatrix3::operator()(const int& row, const int& column)
+{
+    return m_data[row][column];
+}
+
+
+/***********************************************************************//**
+ * @brief Matrix element access operator (const variant)
+ *
+ * @param[in] row Matrix row [0,...,2].
+ * @param[in] column Matrix column [0,...,2].
+ * @return Reference to matrix element.
+ ***************************************************************************/
+inline
+const double& GMatrix3::operator()(const int& row, const int& column) const
+{
+    return m_data[row][column];
+}
+
+
+/***********************************************************************//**
+ * @brief Vector multiplication
+ *
+ * @param[in] vector Vector.
+ * @return Product of matrix and vector.
+ ***************************************************************************/
+inline
+GVector3 GMatrix3::operator*(const GVector3& vector) const
+{
+    GVector3 result;
+    for (int row = 0; row < 3; ++row) {
+        double sum = 0.0;
+        for (int col = 0; col < 3; ++col) {
+            sum += m_data[row][col] * vector[col];
+        }
+        result[row] = sum;
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Matrix multiplication
+ *
+ * @param[in] matrix Matrix.
+ * @return Product of both matrices.
+ ***************************************************************************/
+inline
+GMatrix3 GMatrix3::operator*(const GMatrix3& matrix) const
+{
+    GMatrix3 result;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            double sum = 0.0;
+            for (int i = 0; i < 3; ++i) {
+                sum += m_data[row][i] * matrix.m_data[i][col];
+            }
+            result.m_data[row][col] = sum;
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Return transposed matrix
+ *
+ * @return Transposed matrix.
+ ***************************************************************************/
+inline
+GMatrix3 GMatrix3::transpose(void) const
+{
+    GMatrix3 result;
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            result.m_data[col][row] = m_data[row][col];
+        }
+    }
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around x axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+inline
+void GMatrix3::eulerx(const double& angle)
+{
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+    m_data[0][0] =       1.0;
+    m_data[0][1] =       0.0;
+    m_data[0][2] =       0.0;
+    m_data[1][0] =       0.0;
+    m_data[1][1] =  cosangle;
+    m_data[1][2] = -sinangle;
+    m_data[2][0] =       0.0;
+    m_data[2][1] =  sinangle;
+    m_data[2][2] =  cosangle;
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around y axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+inline
+void GMatrix3::eulery(const double& angle)
+{
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+    m_data[0][0] =  cosangle;
+    m_data[0][1] =       0.0;
+    m_data[0][2] =  sinangle;
+    m_data[1][0] =       0.0;
+    m_data[1][1] =       1.0;
+    m_data[1][2] =       0.0;
+    m_data[2][0] = -sinangle;
+    m_data[2][1] =       0.0;
+    m_data[2][2] =  cosangle;
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Euler rotation matrix around z axis
+ *
+ * @param[in] angle Rotation angle (degrees)
+ ***************************************************************************/
+inline
+void GMatrix3::eulerz(const double& angle)
+{
+    double arg      = angle * gammalib::deg2rad;
+    double cosangle = std::cos(arg);
+    double sinangle = std::sin(arg);
+    m_data[0][0] =  cosangle;
+    m_data[0][1] = -sinangle;
+    m_data[0][2] =       0.0;
+    m_data[1][0] =  sinangle;
+    m_data[1][1] =  cosangle;
+    m_data[1][2] =       0.0;
+    m_data[2][0] =       0.0;
+    m_data[2][1] =       0.0;
+    m_data[2][2] =       1.0;
+    return;
+}
+
+#endif /* GMATRIX3_HPP */
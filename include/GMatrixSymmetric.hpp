@@ -67,6 +67,17 @@ class GVector;
  *
  *     matrix.extract_lower_triangle();
  *     matrix.extract_upper_triangle();
+ *
+ * The outer product of a vector with itself may be added to the matrix
+ * using
+ *
+ *     matrix.add_outer_product(vector, scale);
+ *     matrix.add_outer_product(values, inx, number, scale);
+ *
+ * where the second form operates on a compressed vector that only holds
+ * the @p number non-zero elements @p values at the indices @p inx. These
+ * rank-1 updates operate directly on the packed triangle storage, which
+ * makes the class well suited for accumulating curvature matrices.
  ***************************************************************************/
 class GMatrixSymmetric : public GMatrixBase {
 
@@ -124,6 +135,11 @@ public:
     GMatrixSymmetric cholesky_decompose(const bool& compress = true) const;
     GVector          cholesky_solver(const GVector& vector, const bool& compress = true) const;
     GMatrixSymmetric cholesky_invert(const bool& compress = true) const;
+    void             add_outer_product(const GVector& vector,
+                                       const double&  scale = 1.0);
+    void             add_outer_product(const double* values, const int* inx,
+                                       const int& number,
+                                       const double& scale = 1.0);
 
 private:
     // Private methods
@@ -38,6 +38,7 @@
 
 /* __ Forward declarations _______________________________________________ */
 class GEvent;
+class GVector;
 class GObservation;
 
 
@@ -50,7 +51,12 @@ class GObservation;
  * model evaluation: eval() and eval_gradients().
  * The eval() method evaluates the model for a given event and observation.
  * In addition, eval_gradients() also sets the parameter gradients of the
- * model.
+ * model. A second version of eval_gradients() stores the parameter
+ * gradients in a vector, starting from a given offset. The base class
+ * implementation of that method harvests the gradients that were set
+ * through GModelPar::factor_gradient(); models should overload the method
+ * if they are able to compute the gradients without modifying the model
+ * parameters.
  *
  * A model has the following attributes:
  * - @p name
@@ -127,6 +133,12 @@ public:
     virtual void        write(GXmlElement& xml) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual double      eval_gradients(const GEvent&       event,
+                                       const GObservation& obs,
+                                       GVector&            gradients,
+                                       const int&          offset = 0) const;
+
     // Implemented methods
     int                 size(void) const;
     GModelPar&          at(const int& index);
@@ -78,7 +78,10 @@ public:
     virtual void        read(const GXmlElement& xml) = 0;
     virtual void        write(GXmlElement& xml) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
-    
+
+    // Base class methods
+    using GModel::eval_gradients;
+
 protected:
     // Protected methods
     void init_members(void);
@@ -93,7 +93,10 @@ class GObservation;
  * The class has two methods for model evaluation that evaluate the model
  * for a specific event, given an observation. The eval() method returns
  * the model value, the eval_gradients() returns the model value and sets
- * the analytical gradients for all model parameters.
+ * the analytical gradients for all model parameters. A second version of
+ * eval_gradients() stores the gradients in a vector instead of setting
+ * them as model parameter members, hence this method does not modify the
+ * model.
  * Note that the eval() and eval_gradients() methods call protected
  * methods that handle time dispersion, energy dispersion and the point
  * spread function (spatial dispersion). Dispersion is handled by
@@ -152,6 +155,10 @@ public:
                              const GObservation& obs) const;
     virtual double      eval_gradients(const GEvent& event,
                                        const GObservation& obs) const;
+    virtual double      eval_gradients(const GEvent&       event,
+                                       const GObservation& obs,
+                                       GVector&            gradients,
+                                       const int&          offset = 0) const;
     virtual double      npred(const GEnergy& obsEng,
                               const GTime& obsTime,
                               const GObservation& obs) const;
@@ -38,6 +38,7 @@
 #include "GTime.hpp"
 #include "GXmlElement.hpp"
 #include "GRan.hpp"
+#include "GVector.hpp"
 
 
 /***********************************************************************//**
@@ -65,6 +66,11 @@
  * for all \f$E\f$ and \f$t\f$, hence the spatial component does not
  * impact the spatially integrated spectral and temporal properties of the
  * source.
+ *
+ * The eval_gradients() method that takes a gradient vector returns the
+ * analytical parameter gradients in that vector without modifying the
+ * model. The eval_gradients() method without gradient vector stores the
+ * gradients in the model parameters.
  ***************************************************************************/
 class GModelSpatial : public GBase {
 
@@ -88,7 +94,9 @@ public:
     virtual std::string    type(void) const = 0;
     virtual GClassCode     code(void) const = 0;
     virtual double         eval(const GPhoton& photon) const = 0;
-    virtual double         eval_gradients(const GPhoton& photon) const = 0;
+    virtual double         eval_gradients(const GPhoton& photon,
+                                          GVector&       gradients,
+                                          const int&     offset = 0) const = 0;
     virtual GSkyDir        mc(const GEnergy& energy, const GTime& time,
                               GRan& ran) const = 0;
     virtual double         norm(const GSkyDir& dir,
@@ -100,6 +108,7 @@ public:
     virtual std::string    print(const GChatter& chatter = NORMAL) const = 0;
 
     // Methods
+    double           eval_gradients(const GPhoton& photon) const;
     GModelPar&       at(const int& index);
     const GModelPar& at(const int& index) const;
     bool             has_par(const std::string& name) const;
@@ -63,7 +63,9 @@ public:
     virtual std::string           classname(void) const = 0;
     virtual std::string           type(void) const = 0;
     virtual double                eval(const GPhoton& photon) const = 0;
-    virtual double                eval_gradients(const GPhoton& photon) const = 0;
+    virtual double                eval_gradients(const GPhoton& photon,
+                                                 GVector&       gradients,
+                                                 const int&     offset = 0) const = 0;
     virtual GSkyDir               mc(const GEnergy& energy, const GTime& time,
                                      GRan& ran) const = 0;
     virtual double                norm(const GSkyDir& dir,
@@ -77,6 +79,9 @@ public:
     // Implemented virtual base class methods
     virtual GClassCode code(void) const;
 
+    // Base class methods
+    using GModelSpatial::eval_gradients;
+
 protected:
     // Protected methods
     void init_members(void);
@@ -63,7 +63,9 @@ public:
     virtual std::string                classname(void) const;
     virtual std::string                type(void) const;
     virtual double                     eval(const GPhoton& photon) const;
-    virtual double                     eval_gradients(const GPhoton& photon) const;
+    virtual double                     eval_gradients(const GPhoton& photon,
+                                                      GVector&       gradients,
+                                                      const int&     offset = 0) const;
     virtual GSkyDir                    mc(const GEnergy& energy,
                                           const GTime& time,
                                           GRan& ran) const;
@@ -75,6 +77,9 @@ public:
     virtual void                       write(GXmlElement& xml) const;
     virtual std::string                print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpatialDiffuse::eval_gradients;
+
     // Other methods
     double value(void) const;
     void   value(const double& value);
@@ -74,7 +74,9 @@ public:
     virtual std::string               classname(void) const;
     virtual std::string               type(void) const;
     virtual double                    eval(const GPhoton& photon) const;
-    virtual double                    eval_gradients(const GPhoton& photon) const;
+    virtual double                    eval_gradients(const GPhoton& photon,
+                                                     GVector&       gradients,
+                                                     const int&     offset = 0) const;
     virtual GSkyDir                   mc(const GEnergy& energy,
                                          const GTime& time,
                                          GRan& ran) const;
@@ -86,6 +88,9 @@ public:
     virtual void                      write(GXmlElement& xml) const;
     virtual std::string               print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpatialDiffuse::eval_gradients;
+
     // Other methods
     int                        maps(void) const;
     int                        pixels(void) const;
@@ -257,7 +262,9 @@ const GSkymap& GModelSpatialDiffuseCube::cube(void) const
  *
  * @param[in] cube Sky map.
  *
- * Set the map cube of the spatial map cube model.
+ * Set the map cube of the spatial map cube model. The pixels of the map
+ * cube are declared as shared, so that copies of the model do not copy
+ * the map cube.
  ***************************************************************************/
 inline
 void GModelSpatialDiffuseCube::cube(const GSkymap& cube)
@@ -265,6 +272,7 @@ void GModelSpatialDiffuseCube::cube(const GSkymap& cube)
     m_filename.clear();
     m_loaded = false;
     m_cube   = cube;
+    m_cube.share();
     update_mc_cache();
     return;
 }
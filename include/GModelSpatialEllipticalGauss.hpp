@@ -72,7 +72,9 @@ public:
     virtual double                        eval_gradients(const double&  theta,
                                                          const double&  posangle,
                                                          const GEnergy& energy,
-                                                         const GTime&   time) const;
+                                                         const GTime&   time,
+                                                         GVector&       gradients,
+                                                         const int&     offset = 0) const;
     virtual GSkyDir                       mc(const GEnergy& energy,
                                              const GTime& time,
                                              GRan& ran) const;
@@ -84,6 +86,9 @@ public:
     virtual std::string                   print(const GChatter& chatter = NORMAL) const;
 
 
+    // Base class methods
+    using GModelSpatialElliptical::eval_gradients;
+
 protected:
     // Protected methods
     void init_members(void);
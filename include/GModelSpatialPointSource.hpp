@@ -67,7 +67,9 @@ public:
     virtual std::string               type(void) const;
     virtual GClassCode                code(void) const;
     virtual double                    eval(const GPhoton& photon) const;
-    virtual double                    eval_gradients(const GPhoton& photon) const;
+    virtual double                    eval_gradients(const GPhoton& photon,
+                                                     GVector&       gradients,
+                                                     const int&     offset = 0) const;
     virtual GSkyDir                   mc(const GEnergy& energy,
                                          const GTime& time,
                                          GRan& ran) const;
@@ -79,6 +81,9 @@ public:
     virtual void                      write(GXmlElement& xml) const;
     virtual std::string               print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpatial::eval_gradients;
+
     // Other methods
     double  ra(void) const;
     double  dec(void) const;
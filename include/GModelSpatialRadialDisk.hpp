@@ -67,7 +67,9 @@ public:
                                           const GTime&   time) const;
     virtual double                   eval_gradients(const double&  theta,
                                                     const GEnergy& energy,
-                                                    const GTime&   time) const;
+                                                    const GTime&   time,
+                                                    GVector&       gradients,
+                                                    const int&     offset = 0) const;
     virtual GSkyDir                  mc(const GEnergy& energy,
                                         const GTime&   time,
                                         GRan&          ran) const;
@@ -78,6 +80,9 @@ public:
     virtual void                     write(GXmlElement& xml) const;
     virtual std::string              print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpatialRadial::eval_gradients;
+
     // Other methods
     double radius(void) const;
     void   radius(const double& radius);
@@ -66,9 +66,11 @@ public:
     virtual double                    eval(const double&  theta,
                                            const GEnergy& energy,
                                            const GTime& time) const;
-    virtual double                    eval_gradients(const double& theta,
+    virtual double                    eval_gradients(const double&  theta,
                                                      const GEnergy& energy,
-                                                     const GTime& time) const;
+                                                     const GTime&   time,
+                                                     GVector&       gradients,
+                                                     const int&     offset = 0) const;
     virtual GSkyDir                   mc(const GEnergy& energy,
                                          const GTime& time,
                                          GRan& ran) const;
@@ -79,6 +81,9 @@ public:
     virtual void                      write(GXmlElement& xml) const;
     virtual std::string               print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpatialRadial::eval_gradients;
+
     // Other methods
     double  sigma(void) const;
     void    sigma(const double& sigma);
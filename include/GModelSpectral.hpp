@@ -35,6 +35,7 @@
 #include "GEnergy.hpp"
 #include "GTime.hpp"
 #include "GRan.hpp"
+#include "GVector.hpp"
 #include "GXmlElement.hpp"
 
 
@@ -62,6 +63,12 @@
  * for all \f$t\f$, where \f$\Phi\f$ is the spatially and spectrally
  * integrated total source flux. The spectral component does not impact
  * the temporal properties of the integrated flux \f$\Phi\f$.
+ *
+ * The eval_gradients() method that takes a gradient vector returns the
+ * parameter gradients in that vector without modifying the model, so that
+ * a model can be evaluated concurrently by several threads. The
+ * eval_gradients() method without gradient vector stores the gradients in
+ * the model parameters.
  ***************************************************************************/
 class GModelSpectral : public GBase {
 
@@ -86,7 +93,9 @@ public:
     virtual double          eval(const GEnergy& srcEng,
                                  const GTime& srcTime) const = 0;
     virtual double          eval_gradients(const GEnergy& srcEng,
-                                           const GTime& srcTime) = 0;
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset = 0) const = 0;
     virtual double          flux(const GEnergy& emin,
                                  const GEnergy& emax) const = 0;
     virtual double          eflux(const GEnergy& emin,
@@ -98,6 +107,8 @@ public:
     virtual std::string     print(const GChatter& chatter = NORMAL) const = 0;
 
     // Methods
+    double           eval_gradients(const GEnergy& srcEng,
+                                    const GTime&   srcTime) const;
     GModelPar&       at(const int& index);
     const GModelPar& at(const int& index) const;
     bool             has_par(const std::string& name) const;
@@ -71,7 +71,9 @@ public:
     virtual double               eval(const GEnergy& srcEng,
                                       const GTime&   srcTime) const;
     virtual double               eval_gradients(const GEnergy& srcEng,
-                                                const GTime&   srcTime);
+                                                const GTime&   srcTime,
+                                                GVector&       gradients,
+                                                const int&     offset = 0) const;
     virtual double               flux(const GEnergy& emin,
                                       const GEnergy& emax) const;
     virtual double               eflux(const GEnergy& emin,
@@ -84,6 +86,9 @@ public:
     virtual void                 write(GXmlElement& xml) const;
     virtual std::string          print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpectral::eval_gradients;
+
     // Other methods
     double value(void) const;
     void   value(const double& value);
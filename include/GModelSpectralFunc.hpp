@@ -74,7 +74,9 @@ public:
     virtual double              eval(const GEnergy& srcEng,
                                      const GTime&   srcTime) const;
     virtual double              eval_gradients(const GEnergy& srcEng,
-                                               const GTime&   srcTime);
+                                               const GTime&   srcTime,
+                                               GVector&       gradients,
+                                               const int&     offset = 0) const;
     virtual double              flux(const GEnergy& emin,
                                      const GEnergy& emax) const;
     virtual double              eflux(const GEnergy& emin,
@@ -87,6 +89,9 @@ public:
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelSpectral::eval_gradients;
+
     // Other methods
     const std::string& filename(void) const;
     void               filename(const std::string& filename);
@@ -104,8 +109,8 @@ protected:
 
     // Protected members
     GModelPar           m_norm;       //!< Normalization factor
-    mutable GNodeArray  m_lin_nodes;  //!< Energy nodes of function
-    mutable GNodeArray  m_log_nodes;  //!< lof10(Energy) nodes of function
+    GNodeArray          m_lin_nodes;  //!< Energy nodes of function
+    GNodeArray          m_log_nodes;  //!< lof10(Energy) nodes of function
     std::vector<double> m_lin_values; //!< Function values at nodes
     std::vector<double> m_log_values; //!< log10(Function) values at nodes
     std::string         m_filename;   //!< Name of file function
@@ -35,6 +35,7 @@
 #include "GTime.hpp"
 #include "GTimes.hpp"
 #include "GRan.hpp"
+#include "GVector.hpp"
 
 
 /***********************************************************************//**
@@ -47,6 +48,11 @@
  * relative variation of the source flux with respect to the mean value
  * that is given by the spectral component. Normally, this model will have
  * a mean value of 1.
+ *
+ * As for the spectral component, the eval_gradients() method that takes a
+ * gradient vector returns the parameter gradients without modifying the
+ * model, while the eval_gradients() method without gradient vector stores
+ * the gradients in the model parameters.
  ***************************************************************************/
 class GModelTemporal : public GBase {
 
@@ -69,7 +75,9 @@ public:
     virtual std::string     classname(void) const = 0;
     virtual std::string     type(void) const = 0;
     virtual double          eval(const GTime& srcTime) const = 0;
-    virtual double          eval_gradients(const GTime& srcTime) = 0;
+    virtual double          eval_gradients(const GTime& srcTime,
+                                           GVector&     gradients,
+                                           const int&   offset = 0) const = 0;
     virtual GTimes          mc(const double& rate, const GTime& tmin,
                                const GTime& tmax, GRan& ran) const = 0;
     virtual void            read(const GXmlElement& xml) = 0;
@@ -77,6 +85,7 @@ public:
     virtual std::string     print(const GChatter& chatter = NORMAL) const = 0;
 
     // Methods
+    double           eval_gradients(const GTime& srcTime) const;
     GModelPar&       at(const int& index);
     const GModelPar& at(const int& index) const;
     bool             has_par(const std::string& name) const;
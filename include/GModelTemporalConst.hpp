@@ -71,13 +71,18 @@ public:
     virtual std::string          classname(void) const;
     virtual std::string          type(void) const;
     virtual double               eval(const GTime& srcTime) const;
-    virtual double               eval_gradients(const GTime& srcTime);
+    virtual double               eval_gradients(const GTime& srcTime,
+                                                GVector&     gradients,
+                                                const int&   offset = 0) const;
     virtual GTimes               mc(const double& rate, const GTime& tmin,
                                     const GTime& tmax, GRan& ran) const;
     virtual void                 read(const GXmlElement& xml);
     virtual void                 write(GXmlElement& xml) const;
     virtual std::string          print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelTemporal::eval_gradients;
+
     // Other methods
     double norm(void) const;
     void   norm(const double& norm);
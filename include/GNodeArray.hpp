@@ -48,15 +48,31 @@
  * Nodes are allocated either from a double precision array, a GVector object
  * or a std::vector using the nodes() method. Alternatively, the node array
  * may be built on the fly using the append() method.
- * Interpolation can be either performed using the interpolate() method
- * or using the set_value(). In the latter case, the node indices and
- * weighting factors can be recovered using inx_left(), inx_right(),
+ * Interpolation can be either performed using the interpolate() method,
+ * using the locate() method, or using the set_value() method. The locate()
+ * method returns the node indices and weighting factors. In case of the
+ * set_value() method, the node indices and weighting factors are stored
+ * in the node array and can be recovered using inx_left(), inx_right(),
  * wgt_left() and wgt_right().
  * If the nodes are equally spaced, interpolation is more rapid.
+ *
+ * The interpolate() and locate() methods do not modify the node array,
+ * hence a node array may be used for interpolation from several threads
+ * at the same time. This is not the case for the set_value() method.
  ***************************************************************************/
 class GNodeArray : public GContainer {
 
 public:
+    /***********************************************************************
+     * @brief Node indices and weighting factors for linear interpolation
+     ***********************************************************************/
+    struct weights {
+        int    inx_left;  //!< Index of left node
+        int    inx_right; //!< Index of right node
+        double wgt_left;  //!< Weight of left node
+        double wgt_right; //!< Weight of right node
+    };
+
     // Constructors and destructors
     GNodeArray(void);
     GNodeArray(const int& num, const double* array);
@@ -88,6 +104,7 @@ public:
     void          nodes(const std::vector<double>& vector);
     double        interpolate(const double& value,
                               const std::vector<double>& vector) const;
+    weights       locate(const double& value, int* hint = NULL) const;
     void          set_value(const double& value) const;
     const int&    inx_left(void) const;
     const int&    inx_right(void) const;
@@ -115,9 +132,7 @@ private:
     // Evaluation cache
     mutable bool                m_need_setup;     //!< Call of setup is required
     mutable bool                m_is_linear;      //!< Nodes form a linear array
-    mutable bool                m_has_last_value; //!< Last value is valid
     mutable std::vector<double> m_step;           //!< Distance to next node
-    mutable double              m_last_value;     //!< Last requested value
     mutable double              m_linear_slope;   //!< Slope for linear array
     mutable double              m_linear_offset;  //!< Offset for linear array
     mutable int                 m_inx_left;       //!< Index of left node for linear interpolation
@@ -147,8 +162,9 @@ std::string GNodeArray::classname(void) const
  *
  * Returns a reference to the node with the specified @p index. No range
  * checking is performed on @p index. As this operator may change the
- * values of the node array, the setup method needs to be called before
- * doing the interpolation.
+ * values of the node array, the precomputed node distances are flagged as
+ * outdated and are not used for interpolation until the node array is
+ * modified by another non-const method.
  ***************************************************************************/
 inline
 double& GNodeArray::operator[](const int& index)
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GEvents.hpp"
 #include "GResponse.hpp"
@@ -36,8 +37,12 @@
 #include "GTime.hpp"
 #include "GEnergy.hpp"
 #include "GFunction.hpp"
+#include "GFunctions.hpp"
 #include "GVector.hpp"
-#include "GMatrixSparse.hpp"
+#include "GMatrixSymmetric.hpp"
+
+/* __ Forward declarations _______________________________________________ */
+class GModelSky;
 
 
 /***********************************************************************//**
@@ -61,9 +66,26 @@
  * The methods are defined as virtual and can be overloaded by derived classes
  * that implement instrument specific observations in order to optimize the
  * execution speed for data analysis.
+ *
+ * The is_threadsafe() method signals whether the events of the observation
+ * may be evaluated concurrently. If this is the case, the likelihood methods
+ * distribute the event (or bin) loop over several OpenMP threads. Derived
+ * classes should only return true if the event container and the instrument
+ * response can be accessed concurrently by several threads. Event bins are
+ * accessed through GEventCube::bin() using one event bin view per thread,
+ * hence event cubes fulfil the requirement.
+ *
+ * The prefetch() method loads data that are needed for evaluating the
+ * observation, such as events that are loaded on demand. If observations
+ * are evaluated one after the other, GObservations lets one thread of the
+ * event loop of an observation prefetch the data of the next observation,
+ * so that loading overlaps with the evaluation of the events.
  ***************************************************************************/
 class GObservation : public GBase {
 
+    // Friend classes
+    friend class GObservations;
+
 public:
     // Constructors and destructors
     GObservation(void);
@@ -90,10 +112,10 @@ public:
     // Virtual methods
     virtual const GEvents*   events(void) const;
     virtual void             events(const GEvents& events);
-    virtual double           likelihood(const GModels& models,
-                                        GVector*       gradient,
-                                        GMatrixSparse* curvature,
-                                        double*        npred) const;
+    virtual double           likelihood(const GModels&    models,
+                                        GVector*          gradient,
+                                        GMatrixSymmetric* curvature,
+                                        double*           npred) const;
     virtual double           model(const GModels& models,
                                    const GEvent&  event,
                                    GVector*       gradient = NULL) const;
@@ -105,6 +127,8 @@ public:
                                         const GEvent&    event) const;
     virtual double           npred_grad(const GModel&    model,
                                         const GModelPar& par) const;
+    virtual bool             is_threadsafe(void) const;
+    virtual void             prefetch(void) const;
 
     // Implemented methods
     void               name(const std::string& name);
@@ -121,18 +145,31 @@ protected:
     void free_members(void);
 
     // Likelihood methods
-    virtual double likelihood_poisson_unbinned(const GModels& models,
-                                               GVector*       gradient,
-                                               GMatrixSparse* curvature,
-                                               double*        npred) const;
-    virtual double likelihood_poisson_binned(const GModels& models,
-                                             GVector*       gradient,
-                                             GMatrixSparse* curvature,
-                                             double*        npred) const;
-    virtual double likelihood_gaussian_binned(const GModels& models,
-                                              GVector*       gradient,
-                                              GMatrixSparse* curvature,
-                                              double*        npred) const;
+    virtual double likelihood_poisson_unbinned(const GModels&    models,
+                                               GVector*          gradient,
+                                               GMatrixSymmetric* curvature,
+                                               double*           npred) const;
+    virtual double likelihood_poisson_binned(const GModels&    models,
+                                             GVector*          gradient,
+                                             GMatrixSymmetric* curvature,
+                                             double*           npred) const;
+    virtual double likelihood_gaussian_binned(const GModels&    models,
+                                              GVector*          gradient,
+                                              GMatrixSymmetric* curvature,
+                                              double*           npred) const;
+    double         likelihood_poisson_unbinned_range(const GModels&    models,
+                                                     const int&        first,
+                                                     const int&        last,
+                                                     GVector*          gradient,
+                                                     GMatrixSymmetric* curvature) const;
+    double         likelihood_poisson_binned_range(const GModels&    models,
+                                                   const int&        first,
+                                                   const int&        last,
+                                                   GVector*          gradient,
+                                                   GMatrixSymmetric* curvature,
+                                                   double*           npred) const;
+    int            event_threads(const int& nevents) const;
+    int            par_index(const GModel& model, const GModelPar& par) const;
 
     // Model gradient kernel classes
     class model_func : public GFunction {
@@ -155,6 +192,12 @@ protected:
 
     // Npred methods
     virtual double npred_spec(const GModel& model, const GTime& obsTime) const;
+    double         npred_gradients(const GModel& model,
+                                   GVector*      gradient,
+                                   const int&    offset) const;
+    GVector        npred_spec_gradients(const GModelSky&        model,
+                                        const GTime&            obsTime,
+                                        const std::vector<int>& pars) const;
 
     // Npred kernel classes
     class npred_kern : public GFunction {
@@ -184,6 +227,29 @@ protected:
         const GTime*        m_time;   //!< Pointer to time
     };
 
+    class npred_spec_kerns : public GFunctions {
+    public:
+        npred_spec_kerns(const GObservation*     parent,
+                         const GModelSky*        model,
+                         const GModelSky*        unit,
+                         const GTime*            obsTime,
+                         const std::vector<int>* pars) :
+                         m_parent(parent),
+                         m_model(model),
+                         m_unit(unit),
+                         m_time(obsTime),
+                         m_pars(pars) { }
+        int     size(void) const { return (int)m_pars->size()+1; }
+        GVector eval(const double& x);
+    protected:
+        const GObservation*     m_parent; //!< Pointer to parent
+        const GModelSky*        m_model;  //!< Pointer to sky model
+        const GModelSky*        m_unit;   //!< Pointer to unit spectrum model
+        const GTime*            m_time;   //!< Pointer to time
+        const std::vector<int>* m_pars;   //!< Parameter indices
+        GVector                 m_gradients; //!< Model parameter gradients
+    };
+
     // Npred gradient kernel classes
     class npred_func : public GFunction {
     public:
@@ -205,6 +271,9 @@ protected:
     std::string m_id;          //!< Observation identifier
     std::string m_statistics;  //!< Optimizer statistics (default=Poisson)
     GEvents*    m_events;      //!< Pointer to event container
+
+    // Prefetching
+    mutable const GObservation* m_prefetch; //!< Observation prefetched during evaluation
 };
 
 
@@ -29,18 +29,21 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GFunction.hpp"
+#include "GEnergy.hpp"
 
 /* __ Forward declarations _______________________________________________ */
 class GEvent;
 class GPhoton;
 class GSource;
-class GEnergy;
 class GEbounds;
 class GTime;
 class GObservation;
 class GModelSky;
+class GModelPar;
+class GVector;
 
 
 /***********************************************************************//**
@@ -63,6 +66,31 @@ class GModelSky;
  * The ebounds method returns the true energy boundaries for a specified
  * measured event energy. This method is used for computing the energy
  * dispersion.
+ *
+ * The irf_gradients method returns the instrument response for a specific
+ * source and stores the gradients of the response with respect to the free
+ * spatial model parameters that signal gradient support in a gradient
+ * vector. The base class implementation computes these gradients
+ * numerically from the irf method. Instrument responses may overload the
+ * method to compute the gradients analytically.
+ *
+ * The convolve method convolves a sky model with the instrument response.
+ * If a gradient vector is provided, the parameter gradients of the sky
+ * model are stored in that vector, starting at a given offset, so that the
+ * model parameters are not modified by the evaluation. The methods without
+ * a gradient vector set the gradients through GModelPar::factor_gradient()
+ * and are kept for compatibility.
+ *
+ * If energy dispersion is used, the convolve method integrates the event
+ * probability over the true energy range that is returned by the ebounds
+ * method. By default this integration is done by Romberg integration. If a
+ * number of true energy nodes per decade is set using the edisp_nodes
+ * method, the integration is instead done by a sum over nodes of a fixed
+ * logarithmic energy grid, which needs considerably fewer evaluations of
+ * the instrument response. The accuracy of the sum increases with the
+ * number of nodes. The true energy nodes and weights for all measured
+ * energies of a binned observation are precomputed once before the events
+ * are evaluated using the edisp_kernels method.
  ***************************************************************************/
 class GResponse : public GBase {
 
@@ -95,22 +123,62 @@ public:
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
     // Virtual methods
+    virtual double      irf_gradients(const GEvent&       event,
+                                      const GSource&      source,
+                                      const GObservation& obs,
+                                      GVector&            gradients,
+                                      const int&          offset = 0) const;
     virtual double      convolve(const GModelSky&    model,
                                  const GEvent&       event,
                                  const GObservation& obs,
                                  const bool&         grad = true) const;
+    virtual double      convolve(const GModelSky&    model,
+                                 const GEvent&       event,
+                                 const GObservation& obs,
+                                 GVector&            gradients,
+                                 const int&          offset = 0) const;
+
+    // Other methods
+    void                edisp_nodes(const int& nodes);
+    const int&          edisp_nodes(void) const;
+    void                edisp_kernels(const GObservation& obs) const;
 
 protected:
     // Protected methods
     void   init_members(void);
     void   copy_members(const GResponse& rsp);
     void   free_members(void);
+    double eval_convolve(const GModelSky&    model,
+                         const GEvent&       event,
+                         const GObservation& obs,
+                         GVector*            gradients,
+                         const int&          offset) const;
     double eval_prob(const GModelSky&    model,
                      const GEvent&       event,
                      const GEnergy&      srcEng,
                      const GTime&        srcTime,
                      const GObservation& obs,
-                     const bool&         grad) const;
+                     GVector*            gradients,
+                     const int&          offset) const;
+    double eval_edisp(const GModelSky&    model,
+                      const GEvent&       event,
+                      const GTime&        srcTime,
+                      const GObservation& obs) const;
+    void   edisp_kernel(const GEnergy&        obsEng,
+                        std::vector<GEnergy>* energies,
+                        std::vector<double>*  weights) const;
+    int    edisp_kernel_index(const GEnergy& obsEng) const;
+    void   edisp_grid(const double& xmin, const double& xmax,
+                      int* kmin, int* num) const;
+    double edisp_node(const double& xmin, const double& xmax,
+                      const int& kmin, const int& num, const int& i) const;
+
+    // Protected members
+    int                          m_edisp_nodes;    //!< True energy nodes per decade (0: Romberg)
+    mutable std::vector<double>  m_edisp_eobs;     //!< Measured energies of kernels (MeV)
+    mutable std::vector<int>     m_edisp_start;    //!< Index of first node of kernels
+    mutable std::vector<GEnergy> m_edisp_energies; //!< True energies of kernel nodes
+    mutable std::vector<double>  m_edisp_weights;  //!< Weights of kernel nodes (MeV)
 
     // Protected classes
     class edisp_kern : public GFunction {
@@ -119,14 +187,12 @@ protected:
                    const GModelSky&    model,
                    const GEvent&       event,
                    const GTime&        srcTime,
-                   const GObservation& obs,
-                   const bool&         grad) :
+                   const GObservation& obs) :
                    m_parent(parent),
                    m_model(model),
                    m_event(event),
                    m_srcTime(srcTime),
-                   m_obs(obs),
-                   m_grad(grad) { }
+                   m_obs(obs) { }
         double eval(const double& x);
     protected:
         const GResponse*    m_parent;  //!< Pointer to parent class
@@ -134,8 +200,41 @@ protected:
         const GEvent&       m_event;   //!< Reference to event
         const GTime&        m_srcTime; //!< Reference to true time
         const GObservation& m_obs;     //!< Reference to observation
-        const bool&         m_grad;    //!< Reference to gradient flag
+    };
+
+    class irf_func : public GFunction {
+    public:
+        irf_func(const GResponse*    parent,
+                 const GEvent&       event,
+                 const GSource&      source,
+                 const GObservation& obs,
+                 GModelPar*          par) :
+                 m_parent(parent),
+                 m_event(event),
+                 m_source(source),
+                 m_obs(obs),
+                 m_par(par) { }
+        double eval(const double& x);
+    protected:
+        const GResponse*    m_parent; //!< Pointer to parent class
+        const GEvent&       m_event;  //!< Reference to event
+        const GSource&      m_source; //!< Reference to source
+        const GObservation& m_obs;    //!< Reference to observation
+        GModelPar*          m_par;    //!< Pointer to parameter
     };
 };
 
+
+/***********************************************************************//**
+ * @brief Return number of true energy nodes per decade for energy
+ *        dispersion
+ *
+ * @return Number of true energy nodes per decade (0: Romberg integration).
+ ***************************************************************************/
+inline
+const int& GResponse::edisp_nodes(void) const
+{
+    return (m_edisp_nodes);
+}
+
 #endif /* GRESPONSE_HPP */
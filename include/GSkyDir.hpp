@@ -31,6 +31,7 @@
 #include <string>
 #include "GBase.hpp"
 #include "GVector.hpp"
+#include "GVector3.hpp"
 
 /* __ Compile options ____________________________________________________ */
 #define G_SINCOS_CACHE
@@ -74,6 +75,7 @@ public:
     void          lb(const double& l, const double& b);
     void          lb_deg(const double& l, const double& b);
     void          celvector(const GVector& vector);
+    void          celvector(const GVector3& vector);
     void          rotate_deg(const double& phi, const double& theta);
     const double& l(void) const;
     const double& b(void) const;
@@ -84,6 +86,7 @@ public:
     double        ra_deg(void) const;
     double        dec_deg(void) const;
     GVector       celvector(void) const;
+    GVector3      celvector3(void) const;
     double        dist(const GSkyDir& dir) const;
     double        dist_deg(const GSkyDir& dir) const;
     double        posang(const GSkyDir& dir) const;
@@ -108,14 +111,12 @@ private:
     double m_ra;         //!< Right Ascension in radians
     double m_dec;        //!< Declination in radians
 
-    // Sincos cache
+    // Sincos cache (set together with the coordinates)
     #if defined(G_SINCOS_CACHE)
-    mutable bool   m_has_lb_cache;
-    mutable bool   m_has_radec_cache;
-    mutable double m_sin_b;
-    mutable double m_cos_b;
-    mutable double m_sin_dec;
-    mutable double m_cos_dec;
+    double m_sin_b;      //!< Sine of galactic latitude
+    double m_cos_b;      //!< Cosine of galactic latitude
+    double m_sin_dec;    //!< Sine of Declination
+    double m_cos_dec;    //!< Cosine of Declination
     #endif
 };
 
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GFitsHDU.hpp"
 #include "GSkyDir.hpp"
@@ -43,6 +44,12 @@
  * This class defines an abstract projection from sky coordinates into
  * pixel coordinates. Sky coordinates are implemented using the GSkyDir
  * class, pixel coordinates are implemented using the GSkyPixel class.
+ *
+ * Besides the single point transformations pix2dir() and dir2pix(), the
+ * class provides transformations of pixel and sky direction vectors. The
+ * base class implementation simply loops over the vector elements, derived
+ * classes should overload these methods to perform the transformation for
+ * all vector elements at once.
  ***************************************************************************/
 class GSkyProjection : public GBase {
 
@@ -74,8 +81,10 @@ public:
     virtual std::string     print(const GChatter& chatter = NORMAL) const = 0;
 
     // Virtual methods
-    virtual std::string coordsys(void) const;
-    virtual void        coordsys(const std::string& coordsys);
+    virtual std::string            coordsys(void) const;
+    virtual void                   coordsys(const std::string& coordsys);
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
 
 protected:
     // Protected methods
@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GBase.hpp"
 #include "GSkyDir.hpp"
 #include "GSkyPixel.hpp"
@@ -65,6 +66,19 @@
  * sky direction. While the index and pixel access return the sky map value
  * at the pixel centre, the sky direction access operator performs an
  * interpolation to the exact sky direction.
+ * The bi-linear interpolator for a sky direction is returned by the
+ * interpolator() method, and may be used to interpolate several maps for
+ * the same sky direction without recomputing the interpolation indices and
+ * weights:
+ *
+ *     GBilinear interpolator = map.interpolator(dir);
+ *     double    value1       = map(interpolator, 0);
+ *     double    value2       = map(interpolator, 1);
+ *
+ * The sky directions and solid angles of all pixels are cached on first
+ * request in a thread-safe way, and the interpolation does not modify the
+ * sky map, hence the const access methods may be called from several
+ * threads at the same time.
  *
  * Conversion methods exist to convert between the linear index, the pixel
  * and the sky direction:
@@ -75,6 +89,48 @@
  *     int       index = map.pix2inx(pixel);   // Pixel to index
  *     int       index = map.dir2inx(dir);     // Sky direction to index
  *     GSkyPixel pixel = map.dir2pix(dir);     // Sky direction to pixel
+ *
+ * For loops over all pixels of a sky map, the dirs() method returns the
+ * sky directions of all pixels. The sky directions are computed on first
+ * request by a single vector transformation of the sky projection and are
+ * then kept in a cache.
+ *
+ * Sky map pixels can be declared as shared storage using the share()
+ * method. Copies of a sky map with shared pixels will not copy the pixels
+ * but will reference the same pixels, using a reference counter to keep
+ * track of the number of sky maps that use the pixels. A private copy of
+ * the pixels is only made when pixels of a sky map are modified (copy on
+ * write). The modified sky map no longer shares its pixels. Sharing pixels
+ * is useful for large sky maps that are not modified after their creation,
+ * such as model map cubes.
+ *
+ * To reduce the memory footprint of large sky maps that are only read,
+ * the pixels may be converted into single precision storage using the
+ * single_precision() method. The const access operators then return the
+ * single precision values promoted to double precision. Any non-const
+ * access converts the pixels back into double precision storage. The
+ * single precision pixels are returned by the fpixels() method. As the
+ * pixels() method returns a pointer to double precision values, it
+ * creates on first call a double precision copy of the pixels that is
+ * kept with the sky map, which doubles again the memory needed for the
+ * pixels. Code that only reads the pixels should therefore use the const
+ * access operators or fpixels() instead of pixels(). Single precision
+ * pixels may also be shared.
+ *
+ * Sky maps that are loaded from a FITS file read the image pixels by
+ * memory mapping the file (see GFitsImage::use_mmap()). As FITS stores the
+ * pixels in big-endian byte order, the pixels are converted into native
+ * arrays and the sky map does not keep the file mapped.
+ *
+ * By default, the pixels of all maps are stored one map after the other
+ * (map-major layout), which is also the layout of the FITS file. For map
+ * cubes that are mainly used to look up the values of several maps for
+ * the same sky direction, such as the spectra of a map cube, the pixels
+ * may be rearranged using the pixel_major() method so that the values of
+ * all maps of a given pixel are contiguous in memory (pixel-major layout).
+ * The layout does not change the result of any of the access methods,
+ * except for the pixels() method that returns the pixels in the actual
+ * layout. Sky maps are always written in map-major layout.
  *  
  ***************************************************************************/
 class GSkymap : public GBase {
@@ -113,10 +169,11 @@ public:
     GSkymap&      operator/=(const GSkymap& map);
     GSkymap&      operator/=(const double& factor);
     double&       operator()(const int& index, const int& map = 0);
-    const double& operator()(const int& index, const int& map = 0) const;
+    double        operator()(const int& index, const int& map = 0) const;
     double&       operator()(const GSkyPixel& pixel, const int& map = 0);
-    const double& operator()(const GSkyPixel& pixel, const int& map = 0) const;
+    double        operator()(const GSkyPixel& pixel, const int& map = 0) const;
     double        operator()(const GSkyDir& dir, const int& map = 0) const;
+    double        operator()(const GBilinear& interpolator, const int& map = 0) const;
 
     // Methods
     void                  clear(void);
@@ -129,6 +186,8 @@ public:
     void                  nmaps(const int& nmaps);
     GSkyPixel             inx2pix(const int& index) const;
     GSkyDir               inx2dir(const int& index) const;
+    const std::vector<GSkyDir>& dirs(void) const;
+    GBilinear             interpolator(const GSkyDir& dir) const;
     GSkyDir               pix2dir(const GSkyPixel& pixel) const;
     int                   pix2inx(const GSkyPixel& pixel) const;
     int                   dir2inx(const GSkyDir& dir) const;
@@ -142,6 +201,13 @@ public:
     const GSkyProjection* projection(void) const;
     void                  projection(const GSkyProjection& proj);
     const double*         pixels(void) const;
+    const float*          fpixels(void) const;
+    void                  share(void);
+    bool                  is_shared(void) const;
+    void                  single_precision(void);
+    bool                  is_single_precision(void) const;
+    void                  pixel_major(const bool& pixel_major = true);
+    bool                  is_pixel_major(void) const;
     GSkymap               extract(const int& map, const int& nmaps = 1) const;
     void                  stack_maps(void);
     void                  load(const std::string& filename);
@@ -156,6 +222,11 @@ private:
     void              alloc_pixels(void);
     void              copy_members(const GSkymap& map);
     void              free_members(void);
+    void              free_pixels(void);
+    void              unshare(void);
+    void              set_dirs(void) const;
+    void              set_solidangles(void) const;
+    void              set_pixels(void) const;
     void              set_wcs(const std::string& wcs, const std::string& coords,
                               const double& crval1, const double& crval2,
                               const double& crpix1, const double& crpix2,
@@ -172,18 +243,22 @@ private:
                                  const GSkyDir& dir3, const GSkyDir& dir4) const;
 
     // Private data area
-    int               m_num_pixels; //!< Number of pixels (used for pixel allocation)
-    int               m_num_maps;   //!< Number of maps (used for pixel allocation)
-    int               m_num_x;      //!< Number of pixels in x direction (only 2D)
-    int               m_num_y;      //!< Number of pixels in y direction (only 2D)
-    GSkyProjection*   m_proj;       //!< Pointer to sky projection
-    double*           m_pixels;     //!< Pointer to skymap pixels
-
-    // Computation cache
-    mutable bool      m_hascache;   //!< Cache is valid
-    mutable bool      m_contained;  //!< Sky direction is contained in map
-    mutable GSkyDir   m_last_dir;   //!< Last sky direction
-    mutable GBilinear m_interpol;   //!< Bilinear interpolator
+    int               m_num_pixels;  //!< Number of pixels (used for pixel allocation)
+    int               m_num_maps;    //!< Number of maps (used for pixel allocation)
+    int               m_num_x;       //!< Number of pixels in x direction (only 2D)
+    int               m_num_y;       //!< Number of pixels in y direction (only 2D)
+    GSkyProjection*   m_proj;        //!< Pointer to sky projection
+    double*           m_pixels;      //!< Pointer to skymap pixels
+    float*            m_fpixels;     //!< Pointer to single precision skymap pixels
+    mutable int       m_hasdcopy;    //!< Double precision copy of pixels is valid
+    int*              m_refs;        //!< Reference counter of shared pixels
+    bool              m_pixel_major; //!< Pixels are stored in pixel-major layout
+
+    // Pixel cache
+    mutable int                  m_hasdirs;        //!< Pixel directions are valid
+    mutable int                  m_hassolidangles; //!< Pixel solid angles are valid
+    mutable std::vector<GSkyDir> m_dirs;           //!< Sky directions of all pixels
+    mutable std::vector<double>  m_solidangles;    //!< Solid angles of all pixels
 };
 
 
@@ -270,14 +345,64 @@ const GSkyProjection* GSkymap::projection(void) const
 
 
 /***********************************************************************//**
- * @brief Returns pointer to pixel data
+ * @brief Signals if sky map pixels are shared
+ *
+ * @return True if sky map pixels are shared storage.
+ *
+ * Returns true if the sky map pixels have been declared as shared storage
+ * using the share() method.
+ ***************************************************************************/
+inline
+bool GSkymap::is_shared(void) const
+{
+    return (m_refs != NULL);
+}
+
+
+/***********************************************************************//**
+ * @brief Signals if sky map pixels are stored in single precision
+ *
+ * @return True if sky map pixels are stored in single precision.
+ *
+ * Returns true if the sky map pixels have been converted into single
+ * precision storage using the single_precision() method.
+ ***************************************************************************/
+inline
+bool GSkymap::is_single_precision(void) const
+{
+    return (m_fpixels != NULL);
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pointer to single precision pixel data
+ *
+ * @return Pointer to single precision pixel data (NULL if the pixels are
+ *         stored in double precision).
+ *
+ * Returns a pointer to the single precision pixel data. The pixels are in
+ * the actual layout of the sky map (see is_pixel_major()). The pointer may
+ * not be used to modify the sky map pixels.
+ ***************************************************************************/
+inline
+const float* GSkymap::fpixels(void) const
+{
+    return m_fpixels;
+}
+
+
+/***********************************************************************//**
+ * @brief Signals if sky map pixels are stored in pixel-major layout
+ *
+ * @return True if sky map pixels are stored in pixel-major layout.
  *
- * @return Pointer to pixel data.
+ * Returns true if the values of all maps of a given pixel are contiguous
+ * in memory.
  ***************************************************************************/
 inline
-const double* GSkymap::pixels(void) const
+bool GSkymap::is_pixel_major(void) const
 {
-    return m_pixels;
+    return m_pixel_major;
 }
 
 #endif /* GSKYMAP_HPP */
@@ -0,0 +1,276 @@
+/***************************************************************************
+ *                GVector3.hpp - Three-dimensional vector class            *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GVector3.hpp
+ * @brief Three-dimensional vector class interface definition
+ * @author Juergen Knoedlseder
+ */
+
+#ifndef GVECTOR3_HPP
+#define GVECTOR3_HPP
+
+/* __ Includes ___________________________________________________________ */
+#include <cmath>
+
+
+/***********************************************************************//**
+ * @class GVector3
+ *
+ * @brief Three-dimensional vector class
+ *
+ * This class implements a three-dimensional double precision vector that
+ * holds its elements on the stack. It is intended for coordinate
+ * transformations in the innermost loops of numerical integrations, where
+ * the heap allocations of GVector are too costly. For this reason the
+ * class is not derived from GBase, has no virtual methods and all methods
+ * are inline.
+ ***************************************************************************/
+class GVector3 {
+
+public:
+    // Constructors
+    GVector3(void);
+    GVector3(const double& x, const double& y, const double& z);
+
+    // Operators
+    double&       operator[](const int& index);
+    const double& operator[](const int& index) const;
+    GVector3&     operator+=(const GVector3& vector);
+    GVector3&     operator-=(const GVector3& vector);
+    GVector3&     operator*=(const double& scalar);
+
+private:
+    // Private data area
+    double m_data[3];   //!< Vector elements
+};
+
+
+/***********************************************************************//**
+ * @brief Void constructor
+ *
+ * Constructs a null vector.
+ ***************************************************************************/
+inline
+GVector3::GVector3(void)
+{
+    m_data[0] = 0.0;
+    m_data[1] = 0.0;
+    m_data[2] = 0.0;
+}
+
+
+/***********************************************************************//**
+ * @brief Element constructor
+ *
+ * @param[in] x First vector element.
+ * @param[in] y Second vector element.
+ * @param[in] z Third vector element.
+ ***************************************************************************/
+inline
+GVector3::GVector3(const double& x, const double& y, const double& z)
+{
+    m_data[0] = x;
+    m_data[1] = y;
+    m_data[2] = z;
+}
+
+
+/***********************************************************************//**
+ * @brief Vector element access operator
+ *
+ * @param[in] index Element index [0,...,2]
+ * @return Reference to vector element.
+ ***************************************************************************/
+inline
+double& GVector3::operator[](const int& index)
+{
+    return m_data[index];
+}
+
+
+/***********************************************************************//**
+ * @brief Vector element access operator (const variant)
+ *
+ * @param[in] index Element index [0,...,2]
+ * @return Reference to vector element.
+ ***************************************************************************/
+inline
+const double& GVector3::operator[](const int& index) const
+{
+    return m_data[index];
+}
+
+
+/***********************************************************************//**
+ * @brief Unary addition operator
+ *
+ * @param[in] vector Vector.
+ * @return Vector.
+ ***************************************************************************/
+inline
+GVector3& GVector3::operator+=(const GVector3& vector)
+{
+    m_data[0] += vector.m_data[0];
+    m_data[1] += vector.m_data[1];
+    m_data[2] += vector.m_data[2];
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Unary subtraction operator
+ *
+ * @param[in] vector Vector.
+ * @return Vector.
+ ***************************************************************************/
+inline
+GVector3& GVector3::operator-=(const GVector3& vector)
+{
+    m_data[0] -= vector.m_data[0];
+    m_data[1] -= vector.m_data[1];
+    m_data[2] -= vector.m_data[2];
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Scalar multiplication operator
+ *
+ * @param[in] scalar Scalar.
+ * @return Vector.
+ ***************************************************************************/
+inline
+GVector3& GVector3::operator*=(const double& scalar)
+{
+    m_data[0] *= scalar;
+    m_data[1] *= scalar;
+    m_data[2] *= scalar;
+    return *this;
+}
+
+
+/***********************************************************************//**
+ * @brief Add two vectors
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Sum of vectors @p a and @p b.
+ ***************************************************************************/
+inline
+GVector3 operator+(const GVector3& a, const GVector3& b)
+{
+    GVector3 result = a;
+    result += b;
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Subtract two vectors
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Difference of vectors @p a and @p b.
+ ***************************************************************************/
+inline
+GVector3 operator-(const GVector3& a, const GVector3& b)
+{
+    GVector3 result = a;
+    result -= b;
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply vector by scalar
+ *
+ * @param[in] a Vector.
+ * @param[in] s Scalar.
+ * @return Vector @p a multiplied by scalar @p s.
+ ***************************************************************************/
+inline
+GVector3 operator*(const GVector3& a, const double& s)
+{
+    GVector3 result = a;
+    result *= s;
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Multiply scalar by vector
+ *
+ * @param[in] s Scalar.
+ * @param[in] a Vector.
+ * @return Vector @p a multiplied by scalar @p s.
+ ***************************************************************************/
+inline
+GVector3 operator*(const double& s, const GVector3& a)
+{
+    GVector3 result = a;
+    result *= s;
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Scalar product of two vectors
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Scalar product of vectors @p a and @p b.
+ ***************************************************************************/
+inline
+double operator*(const GVector3& a, const GVector3& b)
+{
+    return (a[0]*b[0] + a[1]*b[1] + a[2]*b[2]);
+}
+
+
+/***********************************************************************//**
+ * @brief Vector cross product
+ *
+ * @param[in] a Vector.
+ * @param[in] b Vector.
+ * @return Vector cross product @p a x @p b.
+ ***************************************************************************/
+inline
+GVector3 cross(const GVector3& a, const GVector3& b)
+{
+    return (GVector3(a[1]*b[2] - a[2]*b[1],
+                     a[2]*b[0] - a[0]*b[2],
+                     a[0]*b[1] - a[1]*b[0]));
+}
+
+
+/***********************************************************************//**
+ * @brief Vector norm
+ *
+ * @param[in] vector Vector.
+ * @return Vector norm.
+ ***************************************************************************/
+inline
+double norm(const GVector3& vector)
+{
+    return (std::sqrt(vector * vector));
+}
+
+#endif /* GVECTOR3_HPP */
@@ -68,12 +68,14 @@ public:
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
     
     // Implemented virtual base class methods
-    virtual int         size(void) const;
-    virtual void        read(const GFitsHDU& hdu);
-    virtual void        write(GFitsHDU& hdu) const;
-    virtual double      solidangle(const GSkyPixel& pixel) const;
-    virtual GSkyDir     pix2dir(const GSkyPixel& pixel) const;
-    virtual GSkyPixel   dir2pix(const GSkyDir& dir) const;
+    virtual int                    size(void) const;
+    virtual void                   read(const GFitsHDU& hdu);
+    virtual void                   write(GFitsHDU& hdu) const;
+    virtual double                 solidangle(const GSkyPixel& pixel) const;
+    virtual GSkyDir                pix2dir(const GSkyPixel& pixel) const;
+    virtual GSkyPixel              dir2pix(const GSkyDir& dir) const;
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
 
     // Other methods
     void   set(const std::string& coords,
@@ -155,7 +157,7 @@ protected:
                          double* x, double* y, int* stat) const = 0;
     
     // World Coordinate System parameters
-    mutable bool                     m_wcsset;  //!< WCS information is set
+    mutable int                      m_wcsset;  //!< WCS information is set
     int                              m_naxis;   //!< Number of axes
     std::vector<double>              m_crval;   //!< CRVALia keyvalues for each coord axis
     std::vector<std::string>         m_cunit;   //!< CUNITia keyvalues for each coord axis
@@ -80,6 +80,10 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GCOMEventBin*       bin_view(void) const;
+    virtual const GCOMEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     void                   map(const GSkymap& map, const double& phimin,
                                const double& dphi);
@@ -100,6 +104,7 @@ protected:
     virtual void set_times(void);
     void         init_bin(void);
     void         set_bin(const int& index);
+    void         set_bin(const int& index, GCOMEventBin* bin) const;
 
     // Protected members
     GCOMEventBin         m_bin;        //!< Actual event bin
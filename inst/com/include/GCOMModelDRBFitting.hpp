@@ -77,6 +77,9 @@ public:
     virtual void                 write(GXmlElement& xml) const;
     virtual std::string          print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelData::eval_gradients;
+
 protected:
     // Protected methods
     void init_members(void);
@@ -74,6 +74,12 @@ public:
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual base class methods
+    virtual double              likelihood(const GModels&    models,
+                                           GVector*          gradient,
+                                           GMatrixSymmetric* curvature,
+                                           double*           npred) const;
+
     // Other methods
     void           load(const std::string& drename,
                         const std::string& drbname,
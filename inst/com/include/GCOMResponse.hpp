@@ -28,8 +28,12 @@
 #define GCOMRESPONSE_HPP
 
 /* __ Includes ___________________________________________________________ */
+#include <vector>
 #include "GResponse.hpp"
 #include "GCaldb.hpp"
+#include "GNodeArray.hpp"
+#include "GSkyDir.hpp"
+#include "GVector.hpp"
 
 /* __ Type definitions ___________________________________________________ */
 
@@ -42,6 +46,8 @@ class GEnergy;
 class GTime;
 class GObservation;
 class GFitsImage;
+class GModels;
+class GCOMObservation;
 
 
 /***********************************************************************//**
@@ -86,12 +92,18 @@ public:
     const std::string& rspname(void) const;
     void               load(const std::string& rspname);
     void               read(const GFitsImage& hdu);
+    GVector            irf_cube(const GPhoton&      photon,
+                                const GObservation& obs) const;
+    void               irf_cubes(const GModels&         models,
+                                 const GCOMObservation& obs) const;
+    void               irf_cubes_clear(void) const;
 
 private:
     // Private methods
-    void init_members(void);
-    void copy_members(const GCOMResponse& rsp);
-    void free_members(void);
+    void                init_members(void);
+    void                copy_members(const GCOMResponse& rsp);
+    void                free_members(void);
+    GNodeArray::weights iaq_weights(const double& phigeo) const;
 
     // Private data members
     GCaldb              m_caldb;             //!< Name of or path to the calibration database
@@ -107,6 +119,10 @@ private:
     double              m_phibar_ref_pixel;  //!< Phigeo reference pixel (starting from 1)
     double              m_phibar_bin_size;   //!< Phigeo binsize (deg)
     double              m_phibar_min;        //!< Phigeo value of first bin (deg)
+
+    // Precomputed instrument response functions for point sources
+    mutable std::vector<GSkyDir> m_irf_dirs;  //!< Point source directions
+    mutable std::vector<GVector> m_irf_cubes; //!< IRFs for all event bins
 };
 
 
@@ -28,6 +28,9 @@
 #include "GCOMEventCube.hpp"
 %}
 
+/* __ Typemaps ___________________________________________________________ */
+%newobject GCOMEventCube::bin_view;
+
 
 /***********************************************************************//**
  * @class GCTAEventCube
@@ -59,6 +62,10 @@ public:
     virtual void           write(GFits& file) const;
     virtual int            number(void) const;
 
+    // Implemented virtual base class methods
+    virtual GCOMEventBin*       bin_view(void) const;
+    virtual const GCOMEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     void                   map(const GSkymap& map, const double& phimin,
                                const double& dphi);
@@ -57,6 +57,9 @@ public:
     virtual GCOMEventCube*       mc(const GObservation& obs, GRan& ran) const;
     virtual void                 read(const GXmlElement& xml);
     virtual void                 write(GXmlElement& xml) const;
+
+    // Base class methods
+    using GModelData::eval_gradients;
 };
 
 
@@ -58,6 +58,12 @@ public:
     virtual void                read(const GXmlElement& xml);
     virtual void                write(GXmlElement& xml) const;
 
+    // Overloaded virtual base class methods
+    virtual double              likelihood(const GModels&    models,
+                                           GVector*          gradient,
+                                           GMatrixSymmetric* curvature,
+                                           double*           npred) const;
+
     // Other methods
     void           load(const std::string& drename,
                         const std::string& drbname,
@@ -66,6 +66,11 @@ public:
     const std::string& rspname(void) const;
     void               load(const std::string& rspname);
     void               read(const GFitsImage& hdu);
+    GVector            irf_cube(const GPhoton&      photon,
+                                const GObservation& obs) const;
+    void               irf_cubes(const GModels&         models,
+                                 const GCOMObservation& obs) const;
+    void               irf_cubes_clear(void) const;
 };
 
 
@@ -39,7 +39,9 @@
 #define G_SET_SCATTER_DIRECTIONS    "GCOMEventCube::set_scatter_directions()"
 #define G_SET_ENERGIES                        "GCOMEventCube::set_energies()"
 #define G_SET_TIMES                              "GCOMEventCube::set_times()"
+#define G_BIN                          "GCOMEventCube::bin(int&, GEventBin*)"
 #define G_SET_BIN                              "GCOMEventCube::set_bin(int&)"
+#define G_SET_BIN_VIEW          "GCOMEventCube::set_bin(int&, GCOMEventBin*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -547,6 +549,54 @@ void GCOMEventCube::map(const GSkymap& map, const double& phimin,
 }
 
 
+/***********************************************************************//**
+ * @brief Allocate event bin view
+ *
+ * @return Pointer to event bin view.
+ *
+ * Allocates an event bin view that can be passed to the bin() method. The
+ * caller is responsible for deleting the view.
+ ***************************************************************************/
+GCOMEventBin* GCOMEventCube::bin_view(void) const
+{
+    // Return
+    return (new GCOMEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin for concurrent access
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin view allocated by bin_view().
+ * @return Pointer to event bin view.
+ *
+ * @exception GException::invalid_argument
+ *            Event bin view is not a COMPTEL event bin.
+ *
+ * Sets the attributes of the event bin @p view to the attributes of the
+ * bin with the specified @p index. Contrary to the bin access operator the
+ * event cube is not modified, hence several threads may access the bins
+ * concurrently as long as each thread uses its own @p view.
+ ***************************************************************************/
+const GCOMEventBin* GCOMEventCube::bin(const int& index, GEventBin* view) const
+{
+    // Get COMPTEL event bin view
+    GCOMEventBin* bin = dynamic_cast<GCOMEventBin*>(view);
+    if (bin == NULL) {
+        std::string msg = "Event bin view is not a COMPTEL event bin. Please "
+                          "allocate the view using the bin_view() method.";
+        throw GException::invalid_argument(G_BIN, msg);
+    }
+
+    // Set event bin view
+    set_bin(index, bin);
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Print event cube information
  *
@@ -877,3 +927,58 @@ void GCOMEventCube::set_bin(const int& index)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Set event bin view
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in,out] bin Event bin view.
+ *
+ * @exception GException::out_of_range
+ *            Event index is outside valid range.
+ * @exception GCOMException::no_dirs
+ *            Sky directions and solid angles vectors have not been set up.
+ *
+ * Copies the attributes of the event bin with the specified @p index into
+ * the event bin view @p bin, which owns the memory of its attributes.
+ * Contrary to set_bin(const int&), the event cube is not modified. Note
+ * that changing the number of counts of the view does not change the
+ * content of the event cube.
+ ***************************************************************************/
+void GCOMEventCube::set_bin(const int& index, GCOMEventBin* bin) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_SET_BIN_VIEW, index, 0, size()-1);
+    }
+    #endif
+
+    // Check for the existence of sky directions and solid angles
+    if (m_dirs.size() != npix() || m_solidangle.size() != npix()) {
+        throw GCOMException::no_dirs(G_SET_BIN_VIEW);
+    }
+
+    // Get pixel and energy bin indices.
+    int ipix = index % npix();
+    int iphi = index / npix();
+
+    // Set indices
+    bin->m_index = index;
+
+    // Set instrument direction
+    bin->m_dir->dir(m_dirs[ipix]);
+    bin->m_dir->phibar(m_phi[iphi]);
+
+    // Set bin attributes
+    *(bin->m_counts)     = m_map.pixels()[index];
+    *(bin->m_solidangle) = m_solidangle[ipix];
+    *(bin->m_time)       = m_time;
+    *(bin->m_ontime)     = m_ontime;
+    *(bin->m_energy)     = m_energy;
+    *(bin->m_ewidth)     = m_ewidth;
+
+    // Return
+    return;
+}
@@ -500,6 +500,48 @@ void GCOMObservation::load(const std::string& drename,
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for COMPTEL observation
+ *
+ * @param[in] models Models.
+ * @param[in,out] gradient Pointer to gradients.
+ * @param[in,out] curvature Pointer to curvature matrix.
+ * @param[in,out] npred Pointer to Npred value.
+ * @return Log-likelihood value.
+ *
+ * Precomputes the instrument response function for all event cube bins
+ * for the point sources in @p models using GCOMResponse::irf_cubes()
+ * before evaluating the log-likelihood function using
+ * GObservation::likelihood(). The precomputed values are dropped after
+ * the evaluation.
+ ***************************************************************************/
+double GCOMObservation::likelihood(const GModels&    models,
+                                   GVector*          gradient,
+                                   GMatrixSymmetric* curvature,
+                                   double*           npred) const
+{
+    // Precompute instrument response functions for point sources
+    m_response.irf_cubes(models, *this);
+
+    // Evaluate log-likelihood value. Drop the precomputed instrument
+    // response functions in case of an exception.
+    double value = 0.0;
+    try {
+        value = GObservation::likelihood(models, gradient, curvature, npred);
+    }
+    catch (...) {
+        m_response.irf_cubes_clear();
+        throw;
+    }
+
+    // Drop precomputed instrument response functions
+    m_response.irf_cubes_clear();
+
+    // Return log-likelihood value
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Print observation information
  *
@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 #include <string>
+#include <vector>
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GFits.hpp"
@@ -40,11 +41,15 @@
 #include "GTime.hpp"
 #include "GObservation.hpp"
 #include "GFitsImage.hpp"
+#include "GVector.hpp"
 #include "GModelSky.hpp"
 #include "GModelSpatialPointSource.hpp"
+#include "GModels.hpp"
+#include "GSkymap.hpp"
 #include "GCOMResponse.hpp"
 #include "GCOMObservation.hpp"
 #include "GCOMEventBin.hpp"
+#include "GCOMEventCube.hpp"
 #include "GCOMInstDir.hpp"
 #include "GCOMException.hpp"
 
@@ -53,6 +58,7 @@
 #define G_NROI            "GCOMResponse::nroi(GModelSky&, GEnergy&, GTime&, "\
                                                              "GObservation&)"
 #define G_EBOUNDS                           "GCOMResponse::ebounds(GEnergy&)"
+#define G_IRF_CUBE           "GCOMResponse::irf_cube(GPhoton&, GObservation&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -250,6 +256,9 @@ GCOMResponse* GCOMResponse::clone(void) const
  * The observed photon direction is spanned by the 3 values (Chi,Psi,Phibar).
  * (Chi,Psi) is the scatter direction of the event, given in sky coordinates.
  * Phibar is the Compton scatter angle, computed from the energy deposits.
+ *
+ * If the response for the photon direction was precomputed using
+ * irf_cubes(), the precomputed value of the event cube bin is returned.
  ***************************************************************************/
 double GCOMResponse::irf(const GEvent&       event,
                          const GPhoton&      photon,
@@ -274,6 +283,18 @@ double GCOMResponse::irf(const GEvent&       event,
     const GSkyDir& srcDir  = photon.dir();
     const GTime&   srcTime = photon.time();
 
+    // If the response was precomputed for the photon direction then
+    // return the precomputed value of the event cube bin
+    int index = bin->index();
+    if (index >= 0) {
+        int ndirs = m_irf_dirs.size();
+        for (int i = 0; i < ndirs; ++i) {
+            if (m_irf_dirs[i] == srcDir && index < m_irf_cubes[i].size()) {
+                return (m_irf_cubes[i][index]);
+            }
+        }
+    }
+
     // Compute angle between true photon arrival direction and scatter
     // direction (Chi,Psi)
     double phigeo = srcDir.dist_deg(obsDir.dir());
@@ -284,28 +305,9 @@ double GCOMResponse::irf(const GEvent&       event,
     // Extract IAQ value by linear inter/extrapolation in Phigeo
     double iaq = 0.0;
     if (iphibar < m_phibar_bins) {
-        double phirat  = phigeo / m_phigeo_bin_size; // 0.5 at bin centre
-        int    iphigeo = int(phirat);                // index into which Phigeo falls
-        double eps     = phirat - iphigeo - 0.5;     // 0.0 at bin centre
-        if (iphigeo < m_phigeo_bins) {
-            int i = iphibar * m_phigeo_bins + iphigeo;
-            if (eps < 0.0) { // interpolate towards left
-                if (iphigeo > 0) {
-                    iaq = (1.0 + eps) * m_iaq[i] - eps * m_iaq[i-1];
-                }
-                else {
-                    iaq = (1.0 - eps) * m_iaq[i] + eps * m_iaq[i+1];
-                }
-            }
-            else {           // interpolate towards right
-                if (iphigeo < m_phigeo_bins-1) {
-                    iaq = (1.0 - eps) * m_iaq[i] + eps * m_iaq[i+1];
-                }
-                else {
-                    iaq = (1.0 + eps) * m_iaq[i] - eps * m_iaq[i-1];
-                }
-            }
-        }
+        GNodeArray::weights w   = iaq_weights(phigeo);
+        const double*       row = &(m_iaq[iphibar * m_phigeo_bins]);
+        iaq = w.wgt_left * row[w.inx_left] + w.wgt_right * row[w.inx_right];
     }
 
     // Get DRG value (units: cm2)
@@ -553,6 +555,220 @@ void GCOMResponse::read(const GFitsImage& image)
 }
 
 
+/***********************************************************************//**
+ * @brief Return instrument response function for all bins of event cube
+ *
+ * @param[in] photon Incident photon.
+ * @param[in] obs Observation.
+ * @return Instrument response function for all event cube bins (cm2 sr-1).
+ *
+ * @exception GCOMException::bad_observation_type
+ *            Observation is not a COMPTEL observation.
+ * @exception GCOMException::bad_event_type
+ *            Observation does not contain a COMPTEL event cube.
+ *
+ * Returns the instrument response function for all bins of the COMPTEL
+ * event cube of the observation for a given incident photon. The vector
+ * has the layout of the event cube, i.e. the index of a bin is given by
+ * ipix + iphibar * npix, and the values are identical to those returned
+ * by irf(const GEvent&, const GPhoton&, const GObservation&) for the
+ * individual bins.
+ *
+ * Since Phigeo only depends on the (Chi,Psi) pixel and DRX only on the
+ * photon direction, the IAQ interpolation weights are computed once for
+ * each pixel and the DRX value once for the photon. The IAQ and DRG
+ * product is then evaluated for each Phibar layer in a loop over
+ * contiguous pixels. This is considerably faster than calling irf() for
+ * each event bin.
+ *
+ * If the DRG has the pixelisation of the event cube its pixels are read
+ * directly, otherwise the DRG is evaluated for the scatter direction of
+ * each pixel. The event cube bins are accessed through an event bin view,
+ * hence the method may be called concurrently.
+ ***************************************************************************/
+GVector GCOMResponse::irf_cube(const GPhoton&      photon,
+                               const GObservation& obs) const
+{
+    // Extract COMPTEL observation
+    const GCOMObservation* observation = dynamic_cast<const GCOMObservation*>(&obs);
+    if (observation == NULL) {
+        throw GCOMException::bad_observation_type(G_IRF_CUBE);
+    }
+
+    // Extract COMPTEL event cube
+    const GCOMEventCube* cube = dynamic_cast<const GCOMEventCube*>(obs.events());
+    if (cube == NULL) {
+        throw GCOMException::bad_event_type(G_IRF_CUBE);
+    }
+
+    // Get cube dimensions
+    int npix = cube->npix();
+    int nphi = cube->nphi();
+
+    // Initialise IRF vector
+    GVector irfs(npix * nphi);
+
+    // Continue only if cube is not empty
+    if (irfs.size() > 0) {
+
+        // Extract photon parameters
+        const GSkyDir& srcDir  = photon.dir();
+        const GTime&   srcTime = photon.time();
+
+        // Allocate event bin view
+        GCOMEventBin* view = cube->bin_view();
+
+        // Compute IAQ interpolation weights for all pixels from the angle
+        // between true photon arrival direction and scatter direction
+        // (Chi,Psi)
+        std::vector<GNodeArray::weights> weights(npix);
+        std::vector<GSkyDir>             dirs(npix);
+        for (int ipix = 0; ipix < npix; ++ipix) {
+            const GCOMEventBin* bin = cube->bin(ipix, view);
+            dirs[ipix]              = bin->dir().dir();
+            weights[ipix]           = iaq_weights(srcDir.dist_deg(dirs[ipix]));
+        }
+
+        // Compute the normalisation that is common to all bins from the
+        // DRX value (units: sec), the ontime (sec) and the deadtime
+        // correction
+        double norm = observation->drx()(srcDir) / observation->ontime() *
+                      obs.deadc(srcTime);
+
+        // Check whether the DRG has the pixelisation of the event cube
+        const GSkymap& drgmap   = observation->drg();
+        const GSkymap& cntmap   = cube->map();
+        bool           same_pix = (drgmap.nx() == cntmap.nx() &&
+                                   drgmap.ny() == cntmap.ny() &&
+                                   drgmap.projection() != NULL &&
+                                   cntmap.projection() != NULL &&
+                                   *drgmap.projection() == *cntmap.projection());
+
+        // Get pointer to IRF values
+        double* values = &(irfs[0]);
+
+        // Loop over Phibar layers
+        for (int iphi = 0; iphi < nphi; ++iphi) {
+
+            // Compute scatter angle index. Skip layers that are outside
+            // the IAQ
+            const GCOMEventBin* bin     = cube->bin(iphi*npix, view);
+            int                 iphibar = int(bin->dir().phibar() / m_phibar_bin_size);
+            if (iphibar >= m_phibar_bins) {
+                continue;
+            }
+
+            // Get pointers to IAQ row and IRF layer
+            const double* row = &(m_iaq[iphibar * m_phigeo_bins]);
+            double*       irf = values + iphi * npix;
+
+            // If the DRG has the pixelisation of the event cube then
+            // compute IRF values for all pixels of layer from the DRG
+            // layer (units: cm2)
+            if (same_pix && iphibar < drgmap.nmaps()) {
+                for (int ipix = 0; ipix < npix; ++ipix) {
+                    const GNodeArray::weights& w = weights[ipix];
+                    double iaq = w.wgt_left * row[w.inx_left] + w.wgt_right * row[w.inx_right];
+                    irf[ipix]  = iaq * drgmap(ipix, iphibar) * norm;
+                }
+            }
+
+            // ... otherwise evaluate the DRG for the scatter direction of
+            // each pixel
+            else {
+                for (int ipix = 0; ipix < npix; ++ipix) {
+                    const GNodeArray::weights& w = weights[ipix];
+                    double iaq = w.wgt_left * row[w.inx_left] + w.wgt_right * row[w.inx_right];
+                    irf[ipix]  = iaq * drgmap(dirs[ipix], iphibar) * norm;
+                }
+            }
+
+        } // endfor: looped over Phibar layers
+
+        // Delete event bin view
+        delete view;
+
+    } // endif: cube was not empty
+
+    // Return IRF values
+    return irfs;
+}
+
+
+/***********************************************************************//**
+ * @brief Precompute instrument response functions for point sources
+ *
+ * @param[in] models Models.
+ * @param[in] obs COMPTEL observation.
+ *
+ * Computes using irf_cube() the instrument response function for all
+ * event cube bins of @p obs for all point sources in @p models that apply
+ * to the observation. As long as the position of a point source is not
+ * changed, irf() returns the precomputed value for a bin of the event cube
+ * instead of computing the value for each bin. Any previously precomputed
+ * values are dropped.
+ *
+ * The method modifies the precomputed values, hence it must not be called
+ * while other threads evaluate the response. Use irf_cubes_clear() to drop
+ * the precomputed values once the models are no longer evaluated.
+ ***************************************************************************/
+void GCOMResponse::irf_cubes(const GModels&         models,
+                             const GCOMObservation& obs) const
+{
+    // Drop precomputed values
+    irf_cubes_clear();
+
+    // Continue only if observation contains an event cube
+    if (dynamic_cast<const GCOMEventCube*>(obs.events()) != NULL) {
+
+        // Loop over models
+        for (int i = 0; i < models.size(); ++i) {
+
+            // Continue only if model is a sky model that applies to the
+            // observation
+            const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+            if (model == NULL || !model->is_valid(obs.instrument(), obs.id())) {
+                continue;
+            }
+
+            // Continue only if model is a point source
+            const GModelSpatialPointSource* ptsrc =
+                  dynamic_cast<const GModelSpatialPointSource*>(model->spatial());
+            if (ptsrc == NULL) {
+                continue;
+            }
+
+            // Precompute instrument response function for point source
+            GPhoton photon(ptsrc->dir(), GEnergy(), GTime());
+            m_irf_dirs.push_back(ptsrc->dir());
+            m_irf_cubes.push_back(irf_cube(photon, obs));
+
+        } // endfor: looped over models
+
+    } // endif: observation contained an event cube
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Drop precomputed instrument response functions
+ *
+ * Drops the instrument response functions that were precomputed using
+ * irf_cubes().
+ ***************************************************************************/
+void GCOMResponse::irf_cubes_clear(void) const
+{
+    // Drop precomputed values
+    m_irf_dirs.clear();
+    m_irf_cubes.clear();
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print COMPTEL response information
  *
@@ -630,6 +846,8 @@ void GCOMResponse::init_members(void)
     m_phibar_ref_pixel = 0.0;
     m_phibar_bin_size  = 0.0;
     m_phibar_min       = 0.0;
+    m_irf_dirs.clear();
+    m_irf_cubes.clear();
     
     // Return
     return;
@@ -657,6 +875,8 @@ void GCOMResponse::copy_members(const GCOMResponse& rsp)
     m_phibar_ref_pixel = rsp.m_phibar_ref_pixel;
     m_phibar_bin_size  = rsp.m_phibar_bin_size;
     m_phibar_min       = rsp.m_phibar_min;
+    m_irf_dirs         = rsp.m_irf_dirs;
+    m_irf_cubes        = rsp.m_irf_cubes;
 
     // Return
     return;
@@ -671,3 +891,59 @@ void GCOMResponse::free_members(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Return IAQ interpolation weights for a geometrical scatter angle
+ *
+ * @param[in] phigeo Geometrical scatter angle (deg).
+ * @return IAQ indices and weighting factors in Phigeo.
+ *
+ * Returns the indices and weighting factors for the linear inter- or
+ * extrapolation of the IAQ in Phigeo. Indices are relative to the start of
+ * a Phibar row of the IAQ. The weights are zero if @p phigeo is beyond the
+ * IAQ.
+ ***************************************************************************/
+GNodeArray::weights GCOMResponse::iaq_weights(const double& phigeo) const
+{
+    // Initialise weights
+    GNodeArray::weights w = {0, 0, 0.0, 0.0};
+
+    // Compute weights
+    double phirat  = phigeo / m_phigeo_bin_size; // 0.5 at bin centre
+    int    iphigeo = int(phirat);                // index into which Phigeo falls
+    double eps     = phirat - iphigeo - 0.5;     // 0.0 at bin centre
+    if (iphigeo < m_phigeo_bins) {
+        if (eps < 0.0) { // interpolate towards left
+            if (iphigeo > 0) {
+                w.inx_left  = iphigeo - 1;
+                w.inx_right = iphigeo;
+                w.wgt_left  = -eps;
+                w.wgt_right = 1.0 + eps;
+            }
+            else {
+                w.inx_left  = iphigeo;
+                w.inx_right = iphigeo + 1;
+                w.wgt_left  = 1.0 - eps;
+                w.wgt_right = eps;
+            }
+        }
+        else {           // interpolate towards right
+            if (iphigeo < m_phigeo_bins-1) {
+                w.inx_left  = iphigeo;
+                w.inx_right = iphigeo + 1;
+                w.wgt_left  = 1.0 - eps;
+                w.wgt_right = eps;
+            }
+            else {
+                w.inx_left  = iphigeo - 1;
+                w.inx_right = iphigeo;
+                w.wgt_left  = -eps;
+                w.wgt_right = 1.0 + eps;
+            }
+        }
+    }
+
+    // Return weights
+    return w;
+}
@@ -60,6 +60,7 @@ void TestGCOMResponse::set(void)
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGCOMResponse::test_inst_dir), "Test instrument direction");
     append(static_cast<pfunction>(&TestGCOMResponse::test_response), "Test response");
+    append(static_cast<pfunction>(&TestGCOMResponse::test_irf_cube), "Test response for all event bins");
 
     // Return
     return;
@@ -245,6 +246,69 @@ void TestGCOMResponse::test_response(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Checks computation of response for all event bins
+ *
+ * Checks that GCOMResponse::irf_cube() returns for all bins of the event
+ * cube the same instrument response as GCOMResponse::irf(), and that
+ * GCOMResponse::irf() returns the values precomputed by
+ * GCOMResponse::irf_cubes().
+ ***************************************************************************/
+void TestGCOMResponse::test_irf_cube(void)
+{
+    // Load binned COMPTEL observation
+    GCOMObservation obs(com_dre, com_drb, com_drg, com_drx);
+    obs.response(com_iaq, GCaldb("cgro", "comptel"));
+
+    // Set incident photon at the position of the Crab
+    GSkyDir dir;
+    dir.radec_deg(83.6331, 22.0145);
+    GPhoton photon(dir, GEnergy(1.0, "MeV"), GTime());
+
+    // Compute response for all event bins
+    const GCOMResponse* rsp  = obs.response();
+    GVector             irfs = rsp->irf_cube(photon, obs);
+    test_value(irfs.size(), obs.events()->size(),
+               "Test size of response vector");
+
+    // Compare to response of individual event bins
+    const GEvents* events = obs.events();
+    double         sum    = 0.0;
+    double         maxdev = 0.0;
+    for (int i = 0; i < events->size(); ++i) {
+        double irf = rsp->irf(*((*events)[i]), photon, obs);
+        double dev = std::abs(irfs[i] - irf);
+        if (irf > 0.0) {
+            dev /= irf;
+        }
+        if (dev > maxdev) {
+            maxdev = dev;
+        }
+        sum += irf;
+    }
+    test_assert(sum > 0.0, "Test non-zero response");
+    test_value(maxdev, 0.0, 1.0e-10, "Test response for all event bins");
+
+    // Precompute response for a point source at the position of the Crab
+    // and compare the response of individual event bins
+    GModels models;
+    models.append(GModelSky(GModelSpatialPointSource(dir), GModelSpectralConst()));
+    rsp->irf_cubes(models, obs);
+    maxdev = 0.0;
+    for (int i = 0; i < events->size(); ++i) {
+        double dev = std::abs(rsp->irf(*((*events)[i]), photon, obs) - irfs[i]);
+        if (dev > maxdev) {
+            maxdev = dev;
+        }
+    }
+    rsp->irf_cubes_clear();
+    test_value(maxdev, 0.0, 1.0e-20, "Test precomputed response");
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Checks handling of binned observations
  *
@@ -493,6 +557,35 @@ void TestGCOMObservation::test_event_cube(void)
                " events in cube, found "+
                gammalib::str(int(sum+0.5))+" by summing over all elements.");
 
+    // Test bin views against bin access operator
+    GEventBin* view = cube2.bin_view();
+    int        nbad = 0;
+    for (int i = 0; i < cube2.size(); ++i) {
+        const GCOMEventBin* bin = static_cast<const GCOMEventBin*>(cube2.bin(i, view));
+        if (bin->counts()       != cube2[i]->counts()       ||
+            bin->size()         != cube2[i]->size()         ||
+            bin->energy()       != cube2[i]->energy()       ||
+            bin->dir().dir()    != cube2[i]->dir().dir()    ||
+            bin->dir().phibar() != cube2[i]->dir().phibar()) {
+            nbad++;
+        }
+    }
+    delete view;
+    test_value(nbad, 0, "Check event bin views");
+
+    // Test concurrent bin access using one bin view per thread
+    double sum_view = 0.0;
+    #pragma omp parallel reduction(+:sum_view)
+    {
+        GEventBin* thread_view = cube2.bin_view();
+        #pragma omp for
+        for (int i = 0; i < cube2.size(); ++i) {
+            sum_view += cube2.bin(i, thread_view)->counts();
+        }
+        delete thread_view;
+    }
+    test_value(sum_view, sum, 1.0e-6, "Check concurrent event bin access");
+
     // Return
     return;
 }
@@ -51,6 +51,7 @@ public:
     virtual std::string       classname(void) const { return "TestGCOMResponse"; }
     void                      test_inst_dir(void);
     void                      test_response(void);
+    void                      test_irf_cube(void);
 };
 
 
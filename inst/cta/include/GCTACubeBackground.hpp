@@ -29,6 +29,7 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
 #include "GSkymap.hpp"
 #include "GNodeArray.hpp"
 #include "GEbounds.hpp"
@@ -39,6 +40,10 @@ class GFitsBinTable;
 class GRan;
 class GObservations;
 class GCTAInstDir;
+class GCTAEventCube;
+class GCTAObservation;
+class GCTARoi;
+class GModels;
 
 
 /***********************************************************************//**
@@ -84,20 +89,27 @@ private:
     void copy_members(const GCTACubeBackground& bgd);
     void free_members(void);
     void set_eng_axis(void);
-    void update(const double& logE) const;
+    void update(const double& logE, int* inx, double* wgt) const;
+    bool is_radial(const GCTAObservation& obs,
+                   const GModels&         models) const;
+    void fill_table(const GCTAEventCube&   cube,
+                    const GCTAObservation& obs,
+                    const GCTARoi&         roi,
+                    const GModels&         models,
+                    std::vector<double>*   rates) const;
+    void fill_bins(const GCTAEventCube&   cube,
+                   const GCTAObservation& obs,
+                   const GCTARoi&         roi,
+                   const GModels&         models,
+                   const int&             first,
+                   const int&             last,
+                   std::vector<double>*   rates) const;
 
     // Members
     mutable std::string m_filename;  //!< Name of background response file
     GSkymap             m_cube;      //!< Background cube
     GEbounds            m_ebounds;   //!< Energy bounds for the background cube
     GNodeArray          m_elogmeans; //!< Mean energy for the background cube
-
-    // Response table computation cache for 1D access
-    mutable int    m_inx_left;       //!< Index of left node
-    mutable int    m_inx_right;      //!< Index of right node
-    mutable double m_wgt_left;       //!< Weight of left node
-    mutable double m_wgt_right;      //!< Weight of right node
-
 };
 
 
@@ -95,7 +95,7 @@ protected:
     void init_members(void);
     void copy_members(const GCTACubeExposure& exp);
     void free_members(void);
-    void update(const double& logE) const;
+    void update(const double& logE, int* inx, double* wgt) const;
     void set_eng_axis(void);
     void read_attributes(const GFitsHDU& hdu);
     void write_attributes(GFitsHDU& hdu) const;
@@ -109,13 +109,6 @@ protected:
 
     // Exposure attributes
     double              m_livetime;  //!< Livetime (sec)
-
-private:
-    // Response table computation cache for 1D access
-    mutable int    m_inx_left;       //!< Index of left node
-    mutable int    m_inx_right;      //!< Index of right node
-    mutable double m_wgt_left;       //!< Weight of left node
-    mutable double m_wgt_right;      //!< Weight of right node
 };
 
 
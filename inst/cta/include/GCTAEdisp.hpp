@@ -42,6 +42,12 @@
  *
  * This class implements the abstract base class for the CTA energy
  * dispersion.
+ *
+ * The eval() method evaluates the energy dispersion for arrays of arguments
+ * into a caller provided array. The base class calls the operator for each
+ * argument set; derived classes may overload the method by a batch
+ * computation. Derived classes do not hold any evaluation state, hence the
+ * energy dispersion may be evaluated concurrently from several threads.
  ***************************************************************************/
 class GCTAEdisp : public GBase {
 
@@ -86,6 +92,13 @@ public:
                                     const double& azimuth = 0.0) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual void        eval(const int&    num,
+                             const double* logEobs,
+                             const double* logEsrc,
+                             const double* theta,
+                             double*       edisp) const;
+
 protected:
     // Methods
     void init_members(void);
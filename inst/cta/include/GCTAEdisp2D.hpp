@@ -45,6 +45,10 @@ class GFitsBinTable;
  * @brief CTA 2D energy dispersion class
  *
  * This class implements the energy dispersion for the CTA 2D response.
+ *
+ * The energy dispersion and the energy boundaries are computed from the
+ * response table for each call and are not cached, hence the energy
+ * dispersion may be evaluated concurrently from several threads.
  ***************************************************************************/
 class GCTAEdisp2D : public GCTAEdisp {
 
@@ -86,6 +90,11 @@ public:
                              const double& phi = 0.0,
                              const double& zenith = 0.0,
                              const double& azimuth = 0.0) const;
+    void         eval(const int&    num,
+                      const double* logEobs,
+                      const double* logEsrc,
+                      const double* theta,
+                      double*       edisp) const;
     std::string  print(const GChatter& chatter = NORMAL) const;
 
     // Methods
@@ -100,18 +109,11 @@ private:
     void init_members(void);
     void copy_members(const GCTAEdisp2D& edisp);
     void free_members(void);
-    void update(const double& logEobs,
-                const double& logEsrc,
-                const double& theta) const;
-    void compute_ebounds_obs(const double& theta = 0.0,
-                             const double& phi = 0.0,
-                             const double& zenith = 0.0,
-                             const double& azimuth = 0.0) const;
-    void compute_ebounds_src(const double& theta = 0.0,
-                             const double& phi = 0.0,
-                             const double& zenith = 0.0,
-                             const double& azimuth = 0.0) const;
-    void set_max_edisp(void) const;
+    GEbounds compute_ebounds_obs(const int&    isrc,
+                                 const double& theta) const;
+    GEbounds compute_ebounds_src(const int&    iobs,
+                                 const double& theta) const;
+    void     set_max_edisp(void);
 
     // Protected classes
     class edisp_kern : public GFunction {
@@ -133,18 +135,7 @@ private:
     std::string       m_filename;  //!< Name of Edisp response file
     GCTAResponseTable m_edisp;     //!< Edisp response table
 
-    // Computation cache
-    mutable bool                  m_ebounds_obs_computed;
-    mutable bool                  m_ebounds_src_computed;
-    mutable double                m_last_theta_obs;
-    mutable double                m_last_theta_src;
-    mutable double                m_last_logEsrc;
-    mutable double                m_last_logEobs;
-    mutable int                   m_index_obs;
-    mutable int                   m_index_src;
-    mutable double                m_max_edisp;
-    mutable std::vector<GEbounds> m_ebounds_obs;
-    mutable std::vector<GEbounds> m_ebounds_src;
+    double            m_max_edisp; //!< Maximum energy dispersion value
 };
 
 
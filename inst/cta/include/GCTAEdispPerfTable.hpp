@@ -92,18 +92,19 @@ private:
     void init_members(void);
     void copy_members(const GCTAEdispPerfTable& psf);
     void free_members(void);
-    void update(const double& logE) const;
+
+    // Gaussian parameters for a given energy
+    struct gaussian {
+        double scale;   //!< Gaussian normalization
+        double sigma;   //!< Gaussian sigma
+        double width;   //!< Gaussian width parameter
+    };
+    gaussian update(const double& logE) const;
 
     // Members
     std::string         m_filename;  //!< Name of response file
     GNodeArray          m_logE;      //!< log(E) nodes for interpolation
     std::vector<double> m_sigma;     //!< Sigma value (rms) of energy resolution
-
-    // Precomputation cache
-    mutable double      m_par_logE;  //!< Energy for which precomputation is done
-    mutable double      m_par_scale; //!< Gaussian normalization
-    mutable double      m_par_sigma; //!< Gaussian sigma
-    mutable double      m_par_width; //!< Gaussian width parameter
 };
 
 
@@ -98,17 +98,8 @@ private:
     void copy_members(const GCTAEdispRmf& psf);
     void free_members(void);
     void set_matrix(void);
-    void set_cache(void) const;
-    void set_max_edisp(void) const;
-    void update(const double& arg1, const double& arg2) const;
-    void compute_ebounds_obs(const double& theta = 0.0,
-                             const double& phi = 0.0,
-                             const double& zenith = 0.0,
-                             const double& azimuth = 0.0) const;
-    void compute_ebounds_src(const double& theta = 0.0,
-                             const double& phi = 0.0,
-                             const double& zenith = 0.0,
-                             const double& azimuth = 0.0) const;
+    void set_cache(void);
+    void set_max_edisp(void);
 
     // Protected classes
     class edisp_kern : public GFunction {
@@ -131,32 +122,12 @@ private:
     GRmf          m_rmf;       //!< Redistribution matrix file
     GMatrixSparse m_matrix;    //!< Normalised redistribution matrix
 
-    // Interpolation cache
-    mutable GNodeArray m_etrue;          //!< Array of log10(Etrue)
-    mutable GNodeArray m_emeasured;      //!< Array of log10(Emeasured)
-    mutable double     m_last_etrue;     //!< Last log10(Etrue)
-    mutable double     m_last_emeasured; //!< Last log10(Emeasured)
-    mutable int        m_itrue1;         //!< Index of left Etrue
-    mutable int        m_itrue2;         //!< Index of right Etrue
-    mutable int        m_imeas1;         //!< Index of left Emeasured
-    mutable int        m_imeas2;         //!< Index of right Emeasured
-    mutable double     m_wgt1;           //!< Weight of lower left node
-    mutable double     m_wgt2;           //!< Weight of upper left node
-    mutable double     m_wgt3;           //!< Weight of lower right node
-    mutable double     m_wgt4;           //!< Weight of upper right node
-
-    // Monte Carlo cache
-    mutable double                m_max_edisp;
-    mutable double                m_last_theta_obs;
-    mutable double                m_last_theta_src;
-    mutable double                m_last_logEsrc;
-    mutable double                m_last_logEobs;
-    mutable int                   m_index_obs;
-    mutable int                   m_index_src;
-    mutable bool                  m_ebounds_obs_computed;
-    mutable bool                  m_ebounds_src_computed;
-    mutable std::vector<GEbounds> m_ebounds_obs;
-    mutable std::vector<GEbounds> m_ebounds_src;
+    // Interpolation and Monte Carlo tables
+    GNodeArray            m_etrue;       //!< Array of log10(Etrue)
+    GNodeArray            m_emeasured;   //!< Array of log10(Emeasured)
+    double                m_max_edisp;   //!< Maximum energy dispersion value
+    std::vector<GEbounds> m_ebounds_obs; //!< Observed energy boundaries
+    std::vector<GEbounds> m_ebounds_src; //!< True energy boundaries
 };
 
 
@@ -79,6 +79,10 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GCTAEventBin*       bin_view(void) const;
+    virtual const GCTAEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     const GTime&           time(void) const;
     const GEnergy&         energy(const int& index) const;
@@ -100,7 +104,7 @@ protected:
     void         set_directions(void);
     virtual void set_energies(void);
     virtual void set_times(void);
-    void         set_bin(const int& index);
+    void         set_bin(const int& index, GCTAEventBin* bin) const;
 
     // Protected members
     GSkymap                  m_map;        //!< Counts map stored as sky map
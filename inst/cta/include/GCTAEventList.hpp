@@ -30,6 +30,7 @@
 /* __ Includes ___________________________________________________________ */
 #include <string>
 #include <vector>
+#include <map>
 #include "GEventList.hpp"
 #include "GCTAEventAtom.hpp"
 #include "GCTARoi.hpp"
@@ -44,6 +45,43 @@
  * @brief CTA event atom container class
  *
  * This class is a container class for CTA event atoms.
+ *
+ * The events are stored column-wise in contiguous arrays. Only the event
+ * direction, the instrument coordinates, the energy, the time and the
+ * event and observation identifiers are always stored. The shower
+ * parameters, the Hillas parameters and the pulse phase are only stored
+ * if they are present in the event file or in one of the appended event
+ * atoms. If the events were read from a file, these optional columns are
+ * only read from the file when an event is accessed for the first time.
+ * By default, the columns of uncompressed event files are read by memory
+ * mapping the file, which can be disabled using use_mmap().
+ *
+ * The access operators return a pointer to an event atom view that is
+ * owned by the event list. A view is built for an event when the event is
+ * accessed for the first time and is kept until the events are cleared,
+ * hence the pointers for different events do not alias and remain valid
+ * while other events are accessed. Modifications of views obtained
+ * through the non-const access operator are written back into the
+ * columns. As the access operators allocate views they are not safe for
+ * concurrent use. Threads that read events concurrently should use the
+ * atom() method with an event atom view allocated by atom_view() for each
+ * thread.
+ *
+ * The event list also holds a cache of IRF values per model and event,
+ * which is used for models that are expensive to convolve with the
+ * instrument response. The cache values of a model are allocated when the
+ * cache key of the model is set by irf_cache_key(), which should be done
+ * once before the events are evaluated. After the evaluation the keys are
+ * released by irf_cache_release(), so that cache values are not used
+ * after model parameters were modified. Reading and storing cache values
+ * does not lock, hence several threads may access the cache values of
+ * different events concurrently. The memory usage of the cache is bounded
+ * by irf_cache_max_memory().
+ *
+ * If energy dispersion is used, a model may cache one IRF value per event
+ * for each node of a range of true energy nodes, which is specified when
+ * setting the cache key. These values are accessed using the
+ * irf_cache_node() methods.
  ***************************************************************************/
 class GCTAEventList : public GEventList {
 
@@ -74,12 +112,30 @@ public:
     virtual const GCTARoi& roi(void) const;
     std::string            print(const GChatter& chatter = NORMAL) const;
 
+    // Other virtual methods
+    virtual GCTAEventAtom*       atom_view(void) const;
+    virtual const GCTAEventAtom* atom(const int& index, GEventAtom* view) const;
+
     // Implement other methods
     void   append(const GCTAEventAtom& event);
     void   reserve(const int& number);
+    void   use_mmap(const bool& use_mmap);
+    bool   use_mmap(void) const;
     double irf_cache(const std::string& name, const int& index) const;
     void   irf_cache(const std::string& name, const int& index,
                      const double& irf) const;
+    double irf_cache_node(const std::string& name, const int& index,
+                          const int& node) const;
+    void   irf_cache_node(const std::string& name, const int& index,
+                          const int& node, const double& irf) const;
+    void   irf_cache_key(const std::string&         name,
+                         const std::vector<double>& key,
+                         const int&                 first = 0,
+                         const int&                 nodes = 1) const;
+    void   irf_cache_release(void) const;
+    double irf_cache_memory(void) const;
+    void   irf_cache_max_memory(const double& mbytes);
+    double memory(void) const;
 
 protected:
     // Protected methods
@@ -92,19 +148,91 @@ protected:
     void         read_events_v0(const GFitsTable& hdu);
     void         read_events_v1(const GFitsTable& hdu);
     void         read_events_hillas(const GFitsTable& hdu);
+    void         read_events_optional(const GFitsTable& hdu);
+    void         read_deferred(void) const;
+    void         read_column(const GFitsTableCol* column,
+                             std::vector<double>& values,
+                             const double& scale = 1.0) const;
+    void         read_column(const GFitsTableCol* column,
+                             std::vector<float>& values) const;
+    void         read_column(const GFitsTableCol* column,
+                             std::vector<unsigned long>& values) const;
     void         write_events(GFitsBinTable& hdu) const;
     void         write_ds_keys(GFitsHDU& hdu) const;
-    int          irf_cache_init(const std::string& name) const;
-    int          irf_cache_index(const std::string& name) const;
+    int          irf_cache_id(const std::string& name) const;
+    void         irf_cache_evict(const double& bytes, const int& keep) const;
+    void         irf_cache_clear(void) const;
+    void         clear_events(void);
+    void         reserve_events(const int& number);
+    void         resize_events(const int& number);
+    void         alloc_shower(void);
+    void         alloc_hillas(void);
+    void         alloc_phase(void);
+    void         set_atom(const int& index, GCTAEventAtom* atom) const;
+    void         write_atom(const int& index, const GCTAEventAtom& atom);
+    void         flush_atoms(void) const;
+    void         free_atoms(void);
 
     // Protected members
-    GCTARoi                    m_roi;       //!< Region of interest
-    std::vector<GCTAEventAtom> m_events;    //!< Events
-    bool                       m_has_phase; //!< Signal presence of phase
+    GCTARoi                    m_roi;         //!< Region of interest
+    std::vector<double>        m_ra;          //!< Right Ascension (radians)
+    std::vector<double>        m_dec;         //!< Declination (radians)
+    std::vector<double>        m_detx;        //!< Instrument X (radians)
+    std::vector<double>        m_dety;        //!< Instrument Y (radians)
+    std::vector<double>        m_energy;      //!< Energy (MeV)
+    std::vector<double>        m_time;        //!< Time (native seconds)
+    std::vector<unsigned long> m_event_id;    //!< Event identifier
+    std::vector<unsigned long> m_obs_id;      //!< Observation identifier
+
+    // Optional shower parameter columns
+    bool                       m_has_shower;  //!< Signal presence of shower
+    std::vector<int>           m_multip;      //!< Multiplicity
+    std::vector<char>          m_telmask;     //!< Telescope mask
+    std::vector<float>         m_dir_err;     //!< Error on event direction
+    std::vector<float>         m_alt;         //!< Event altitude
+    std::vector<float>         m_az;          //!< Event azimuth
+    std::vector<float>         m_corex;       //!< Position on ground (m)
+    std::vector<float>         m_corey;       //!< Position on ground (m)
+    std::vector<float>         m_core_err;    //!< Error on core
+    std::vector<float>         m_xmax;        //!< Shower max (g/cm2)
+    std::vector<float>         m_xmax_err;    //!< Error on shower max
+    std::vector<float>         m_shwidth;     //!< Shower width (m)
+    std::vector<float>         m_shlength;    //!< Shower length (m)
+    std::vector<float>         m_energy_err;  //!< Error on energy (MeV)
+
+    // Optional Hillas parameter columns
+    bool                       m_has_hillas;  //!< Signal presence of Hillas
+    std::vector<float>         m_hil_msw;     //!< Hillas MSW
+    std::vector<float>         m_hil_msw_err; //!< Hillas MSW error
+    std::vector<float>         m_hil_msl;     //!< Hillas MSL
+    std::vector<float>         m_hil_msl_err; //!< Hillas MSL error
+
+    // Optional phase column
+    bool                       m_has_phase;   //!< Signal presence of phase
+    std::vector<float>         m_phase;       //!< Pulse phase
+
+    // Reading of event columns
+    bool                       m_use_mmap;    //!< Memory map event columns
+    std::string                m_filename;    //!< Event file name
+    mutable int                m_deferred;    //!< Optional columns not yet read
+
+    // Event atom views
+    mutable std::map<int,GCTAEventAtom*> m_atoms;       //!< Views by event index
+    mutable bool                         m_atoms_dirty; //!< Views may be modified
 
     // IRF cache for diffuse models
-    mutable std::vector<std::string>          m_irf_names;  //!< Model names
-    mutable std::vector<std::vector<double> > m_irf_values; //!< IRF values
+    mutable std::map<std::string,int>         m_irf_ids;        //!< Source identifiers
+    mutable std::vector<std::string>          m_irf_names;      //!< Source names
+    mutable std::vector<std::vector<double>*> m_irf_values;     //!< IRF values
+    mutable std::vector<std::vector<double> > m_irf_keys;       //!< Cache keys
+    mutable std::vector<int>                  m_irf_first;      //!< First true energy node
+    mutable std::vector<int>                  m_irf_nodes;      //!< Number of true energy nodes
+    mutable std::vector<unsigned long>        m_irf_used;       //!< Last use stamp
+    mutable std::vector<bool>                 m_irf_active;     //!< Key is valid
+    mutable unsigned long                     m_irf_clock;      //!< Use counter
+    mutable double                            m_irf_memory;     //!< Used memory (bytes)
+    double                                    m_irf_max_memory; //!< Memory limit (bytes)
+    mutable void*                             m_irf_lock;       //!< Cache lock
 };
 
 
@@ -128,7 +256,7 @@ std::string GCTAEventList::classname(void) const
 inline
 int GCTAEventList::size(void) const
 {
-    return (m_events.size());
+    return (m_ra.size());
 }
 
 
@@ -140,7 +268,7 @@ int GCTAEventList::size(void) const
 inline
 int GCTAEventList::number(void) const
 {
-    return (m_events.size());
+    return (m_ra.size());
 }
 
 
@@ -166,8 +294,37 @@ const GCTARoi& GCTAEventList::roi(void) const
 inline
 void GCTAEventList::reserve(const int& number)
 {
-    m_events.reserve(number);
+    reserve_events(number);
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set memory mapping of event columns
+ *
+ * @param[in] use_mmap Read event columns by memory mapping?
+ *
+ * Specifies whether the event columns are read by memory mapping the
+ * event file when events are loaded or read. Memory mapping is only used
+ * for uncompressed event files (see GFitsTableCol::use_mmap()).
+ ***************************************************************************/
+inline
+void GCTAEventList::use_mmap(const bool& use_mmap)
+{
+    m_use_mmap = use_mmap;
     return;
 }
 
+
+/***********************************************************************//**
+ * @brief Signal whether event columns are read by memory mapping
+ *
+ * @return True if event columns are read by memory mapping.
+ ***************************************************************************/
+inline
+bool GCTAEventList::use_mmap(void) const
+{
+    return (m_use_mmap);
+}
+
 #endif /* GCTAEVENTLIST_HPP */
@@ -80,6 +80,9 @@ public:
     virtual void                       write(GXmlElement& xml) const;
     virtual std::string                print(const GChatter& chatter = NORMAL) const;
 
+    // Base class methods
+    using GModelData::eval_gradients;
+
     // Other methods
     GCTAModelRadial* radial(void)   const;
     GModelSpectral*  spectral(void) const;
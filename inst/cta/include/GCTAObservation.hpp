@@ -29,6 +29,8 @@
 
 /* __ Includes ___________________________________________________________ */
 #include <string>
+#include <vector>
+#include <map>
 #include "GObservation.hpp"
 #include "GCTAResponse.hpp"
 #include "GCTAPointing.hpp"
@@ -53,6 +55,29 @@ class GCTARoi;
  * @brief CTA observation class
  *
  * This class implements a CTA observation.
+ *
+ * If an event file is attached to the observation, the events are loaded
+ * on first access. Several observations may load their events concurrently
+ * from different threads, so that the reading of event files overlaps with
+ * the likelihood computation for observations that are already loaded.
+ *
+ * The total memory used by event lists that were loaded on demand during
+ * likelihood evaluations may be bounded using events_max_memory(). If the
+ * limit is exceeded, the event lists of the least recently used
+ * observations that are not evaluated at that moment are disposed, and are
+ * reloaded from their files on the next access. Event lists that were
+ * accessed outside a likelihood evaluation are no longer disposed, since
+ * the caller may hold a pointer to them.
+ *
+ * The observation also holds a cache of the spatially integrated response
+ * of sky models as function of energy (see nroi_cache()). The cache is
+ * used by GCTAResponseIrf for models without free spatial parameters, so
+ * that the ROI integrals are only computed once per observation in fits
+ * where only spectral parameters are free.
+ *
+ * The events of a CTA observation may be evaluated by several threads
+ * (see is_threadsafe()). Events that are loaded on demand are loaded
+ * ahead of the evaluation by prefetch().
  ***************************************************************************/
 class GCTAObservation : public GObservation {
 
@@ -90,6 +115,12 @@ public:
     // Overwrite virtual base class methods
     virtual const GEvents* events(void) const;
     virtual void           events(const GEvents& events);
+    virtual double         likelihood(const GModels&    models,
+                                      GVector*          gradient,
+                                      GMatrixSymmetric* curvature,
+                                      double*           npred) const;
+    virtual bool           is_threadsafe(void) const;
+    virtual void           prefetch(void) const;
 
     // Other methods
     bool                has_response(void) const;
@@ -129,6 +160,16 @@ public:
     const double&       hi_user_thres(void) const;
     void                n_tels(const int& tels);
     const int&          n_tels(void) const;
+    static void         events_max_memory(const double& mbytes);
+    static double       events_max_memory(void);
+    static double       events_memory(void);
+    double              nroi_cache(const std::string& name,
+                                   const GEnergy&     energy) const;
+    void                nroi_cache(const std::string& name,
+                                   const GEnergy&     energy,
+                                   const double&      nroi) const;
+    void                nroi_cache_key(const std::string&         name,
+                                       const std::vector<double>& key) const;
 
 protected:
     // Protected methods
@@ -138,6 +179,36 @@ protected:
     void read_attributes(const GFitsHDU& hdu);
     void write_attributes(GFitsHDU& hdu) const;
     void set_event_type(void);
+    void irf_cache_release(void) const;
+    void events_load(void) const;
+    void events_register(void) const;
+    void events_unregister(void) const;
+    void events_pin(void) const;
+    void events_unpin(void) const;
+    void events_remove(void) const;
+    void events_update(void) const;
+    static void events_evict(const GCTAObservation* keep);
+    void nroi_cache_clear(void) const;
+
+    // Event memory management. Use static methods to avoid the static
+    // initialization order fiasco of static members ("construct on first
+    // use")
+    static std::vector<const GCTAObservation*>& events_managed(void) {
+        static std::vector<const GCTAObservation*> m_managed;
+        return m_managed;
+    }
+    static double& events_limit(void) {
+        static double m_limit = 0.0;
+        return m_limit;
+    }
+    static double& events_total(void) {
+        static double m_total = 0.0;
+        return m_total;
+    }
+    static unsigned long& events_clock(void) {
+        static unsigned long m_clock = 0;
+        return m_clock;
+    }
 
     // Protected members
     std::string   m_instrument;    //!< Instrument name
@@ -155,6 +226,18 @@ protected:
     double        m_hi_user_thres; //!< User defined upper energy boundary
     int           m_n_tels;        //!< Number of telescopes
 
+    // Event memory management members
+    mutable bool          m_events_managed; //!< Events are memory managed
+    mutable double        m_events_memory;  //!< Memory of events (bytes)
+    mutable unsigned long m_events_used;    //!< Last use stamp of events
+    mutable int           m_events_pins;    //!< Number of active evaluations
+    mutable int           m_events_valid;   //!< Events online and kept
+    mutable void*         m_events_lock;    //!< Event loading lock
+
+    // Nroi cache members
+    mutable std::map<std::string,std::vector<double> >     m_nroi_keys;   //!< Cache keys
+    mutable std::map<std::string,std::map<double,double> > m_nroi_values; //!< Nroi values
+
     // Special protected member for GCTAModelCubeBackground friend
     std::string   m_bgdfile;     //!< Background filename
 };
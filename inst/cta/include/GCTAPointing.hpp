@@ -33,6 +33,7 @@
 #include "GTime.hpp"
 #include "GTimeReference.hpp"
 #include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GHorizDir.hpp"
 #include "GNodeArray.hpp"
 #include "GFitsTable.hpp"
@@ -110,8 +111,9 @@ protected:
     GTimeReference      m_reference;   //!< Time reference
 
     // Cached members
-    mutable bool    m_has_cache;  //!< Has transformation cache
-    mutable GMatrix m_Rback;      //!< Rotation matrix
+    mutable bool     m_has_cache;  //!< Has transformation cache
+    mutable GMatrix  m_Rback;      //!< Rotation matrix
+    mutable GMatrix3 m_rot;        //!< Rotation matrix (stack allocated)
 };
 
 
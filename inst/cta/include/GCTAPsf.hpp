@@ -41,6 +41,18 @@
  *
  * This class implements the abstract base class for the CTA point spread
  * function.
+ *
+ * The derivative() method returns the derivative of the point spread
+ * function with respect to the angular separation. The base class computes
+ * the derivative numerically; derived classes may overload the method by
+ * an analytical computation.
+ *
+ * The eval() method evaluates the point spread function for arrays of
+ * arguments into a caller provided array. The base class calls the
+ * operator for each argument set; derived classes may overload the method
+ * by a batch computation. Derived classes do not hold any evaluation state,
+ * hence the point spread function may be evaluated concurrently from
+ * several threads.
  ***************************************************************************/
 class GCTAPsf : public GBase {
 
@@ -83,6 +95,20 @@ public:
                                   const bool&   etrue = true) const = 0;
     virtual std::string print(const GChatter& chatter = NORMAL) const = 0;
 
+    // Virtual methods
+    virtual double      derivative(const double& delta,
+                                   const double& logE, 
+                                   const double& theta = 0.0, 
+                                   const double& phi = 0.0,
+                                   const double& zenith = 0.0,
+                                   const double& azimuth = 0.0,
+                                   const bool&   etrue = true) const;
+    virtual void        eval(const int&    num,
+                             const double* delta,
+                             const double* logE,
+                             const double* theta,
+                             double*       psf) const;
+
 protected:
     // Methods
     void init_members(void);
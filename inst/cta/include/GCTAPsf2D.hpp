@@ -45,6 +45,10 @@ class GFitsBinTable;
  *
  * This class implements the CTA point spread function response as function
  * of energy and offset angle.
+ *
+ * The Gaussian parameters are interpolated from the response table for
+ * each evaluation and are not cached, hence the point spread function may
+ * be evaluated concurrently from several threads.
  ***************************************************************************/
 class GCTAPsf2D : public GCTAPsf {
 
@@ -84,6 +88,18 @@ public:
                           const double& zenith = 0.0,
                           const double& azimuth = 0.0,
                           const bool&   etrue = true) const;
+    double      derivative(const double& delta,
+                           const double& logE, 
+                           const double& theta = 0.0, 
+                           const double& phi = 0.0,
+                           const double& zenith = 0.0,
+                           const double& azimuth = 0.0,
+                           const bool&   etrue = true) const;
+    void        eval(const int&    num,
+                     const double* delta,
+                     const double* logE,
+                     const double* theta,
+                     double*       psf) const;
     std::string print(const GChatter& chatter = NORMAL) const;
 
     // Methods
@@ -96,28 +112,33 @@ public:
     
 
 private:
+    // Gaussian parameters for a given energy and offset angle
+    struct gaussians {
+        double norm;    //!< Global normalization
+        double norm2;   //!< Gaussian 2 normalization
+        double norm3;   //!< Gaussian 3 normalization
+        double sigma1;  //!< Gaussian 1 sigma
+        double sigma2;  //!< Gaussian 2 sigma
+        double sigma3;  //!< Gaussian 3 sigma
+        double width1;  //!< Gaussian 1 width
+        double width2;  //!< Gaussian 2 width
+        double width3;  //!< Gaussian 3 width
+    };
+
     // Methods
-    void init_members(void);
-    void copy_members(const GCTAPsf2D& psf);
-    void free_members(void);
-    void update(const double& logE, const double& theta) const;
+    void      init_members(void);
+    void      copy_members(const GCTAPsf2D& psf);
+    void      free_members(void);
+    void      check_table(const std::string& origin) const;
+    gaussians update(const double& logE, const double& theta) const;
+    gaussians update(const double& sigma1, const double& norm2,
+                     const double& sigma2, const double& norm3,
+                     const double& sigma3) const;
+    double    psf(const gaussians& pars, const double& delta) const;
 
     // Members
     std::string       m_filename;   //!< Name of Aeff response file
     GCTAResponseTable m_psf;        //!< PSF response table
-
-    // Precomputation cache
-    mutable double    m_par_logE;   //!< Cache energy
-    mutable double    m_par_theta;  //!< Cache offset angle
-    mutable double    m_norm;       //!< Global normalization
-    mutable double    m_norm2;      //!< Gaussian 2 normalization
-    mutable double    m_norm3;      //!< Gaussian 3 normalization
-    mutable double    m_sigma1;     //!< Gaussian 1 sigma
-    mutable double    m_sigma2;     //!< Gaussian 2 sigma
-    mutable double    m_sigma3;     //!< Gaussian 3 sigma
-    mutable double    m_width1;     //!< Gaussian 1 width
-    mutable double    m_width2;     //!< Gaussian 2 width
-    mutable double    m_width3;     //!< Gaussian 3 width
 };
 
 
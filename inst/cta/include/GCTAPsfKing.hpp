@@ -42,6 +42,10 @@
  *
  * This class implements the CTA point spread function response as function
  * of energy as determined from a FITS table.
+ *
+ * The King profile parameters are interpolated from the response table for
+ * each evaluation and are not cached, hence the point spread function may
+ * be evaluated concurrently from several threads.
  ***************************************************************************/
 class GCTAPsfKing : public GCTAPsf {
 
@@ -81,6 +85,18 @@ public:
                            const double& zenith = 0.0,
                            const double& azimuth = 0.0,
                            const bool&   etrue = true) const;
+    double       derivative(const double& delta,
+                            const double& logE, 
+                            const double& theta = 0.0, 
+                            const double& phi = 0.0,
+                            const double& zenith = 0.0,
+                            const double& azimuth = 0.0,
+                            const bool&   etrue = true) const;
+    void         eval(const int&    num,
+                      const double* delta,
+                      const double* logE,
+                      const double* theta,
+                      double*       psf) const;
     std::string  print(const GChatter& chatter = NORMAL) const;
 
     // Methods
@@ -94,23 +110,27 @@ public:
 
 
 private:
+    // King profile parameters for a given energy and offset angle
+    struct king {
+        double norm;    //!< King profile normalization
+        double sigma;   //!< King profile sigma (radians)
+        double sigma2;  //!< King profile sigma squared
+        double gamma;   //!< King profile gamma parameter
+    };
+
     // Methods
-    void init_members(void);
-    void copy_members(const GCTAPsfKing& psf);
-    void free_members(void);
-    void update(const double& logE, const double& theta) const;
+    void   init_members(void);
+    void   copy_members(const GCTAPsfKing& psf);
+    void   free_members(void);
+    void   check_table(const std::string& origin) const;
+    king   update(const double& logE, const double& theta) const;
+    king   update(const double& gamma, const double& sigma,
+                  const double& logE, const double& theta) const;
+    double psf(const king& pars, const double& delta) const;
 
     // Members
     std::string       m_filename;   //!< Name of Aeff response file
     GCTAResponseTable m_psf;        //!< PSF response table
-
-    // Evaluation cache
-    mutable double m_par_logE;   //!< Cache energy
-    mutable double m_par_theta;  //!< Cache offset angle
-    mutable double m_par_norm;   //!< King profile normalization
-    mutable double m_par_sigma;  //!< King profile sigma (radians)
-    mutable double m_par_sigma2; //!< King profile sigma squared
-    mutable double m_par_gamma;  //!< King profile gamma parameter
 };
 
 
@@ -83,6 +83,13 @@ public:
                                 const double& zenith = 0.0,
                                 const double& azimuth = 0.0,
                                 const bool&   etrue = true) const;
+    double            derivative(const double& delta,
+                                 const double& logE, 
+                                 const double& theta = 0.0, 
+                                 const double& phi = 0.0,
+                                 const double& zenith = 0.0,
+                                 const double& azimuth = 0.0,
+                                 const bool&   etrue = true) const;
     std::string       print(const GChatter& chatter = NORMAL) const;
 
 private:
@@ -90,7 +97,14 @@ private:
     void init_members(void);
     void copy_members(const GCTAPsfPerfTable& psf);
     void free_members(void);
-    void update(const double& logE) const;
+
+    // Gaussian parameters for a given energy
+    struct gaussian {
+        double scale;   //!< Gaussian normalization
+        double sigma;   //!< Gaussian sigma
+        double width;   //!< Gaussian width parameter
+    };
+    gaussian update(const double& logE) const;
 
     // Members
     std::string         m_filename;  //!< Name of Aeff response file
@@ -98,12 +112,6 @@ private:
     std::vector<double> m_r68;       //!< 68% containment radius of PSF in degrees
     std::vector<double> m_r80;       //!< 80% containment radius of PSF in degrees
     std::vector<double> m_sigma;     //!< Sigma value of PSF in radians
-
-    // Precomputation cache
-    mutable double      m_par_logE;  //!< Energy for which precomputation is done
-    mutable double      m_par_scale; //!< Gaussian normalization
-    mutable double      m_par_sigma; //!< Gaussian sigma (radians)
-    mutable double      m_par_width; //!< Gaussian width parameter
 };
 
 
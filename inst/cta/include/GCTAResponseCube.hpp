@@ -41,6 +41,7 @@
 /* __ Forward declarations _______________________________________________ */
 class GPhoton;
 class GEvent;
+class GModels;
 class GObservation;
 class GCTAObservation;
 class GCTAInstDir;
@@ -100,6 +101,9 @@ public:
     const GCTACubeBackground& background(void) const;
     void                      background(const GCTACubeBackground& background);
 
+    // IRF cache methods
+    void irf_caches(const GModels& models, const GObservation& obs) const;
+
 private:
     // Private methods
     void   init_members(void);
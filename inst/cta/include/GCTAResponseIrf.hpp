@@ -47,12 +47,15 @@ class GPhoton;
 class GEbounds;
 class GEvent;
 class GObservation;
+class GModels;
 class GRan;
 class GCTAObservation;
 class GCTAPointing;
 class GCTAEventAtom;
+class GCTAEventList;
 class GCTARoi;
 class GCTAInstDir;
+class GVector;
 
 
 /***********************************************************************//**
@@ -93,6 +96,11 @@ public:
                                   const GTime&        obsTime,
                                   const GObservation& obs) const;
     virtual GEbounds         ebounds(const GEnergy& obsEnergy) const;
+    virtual double           irf_gradients(const GEvent&       event,
+                                           const GSource&      source,
+                                           const GObservation& obs,
+                                           GVector&            gradients,
+                                           const int&          offset = 0) const;
     virtual void             read(const GXmlElement& xml);
     virtual void             write(GXmlElement& xml) const;
     virtual std::string      print(const GChatter& chatter = NORMAL) const;
@@ -109,6 +117,8 @@ public:
     void                  load_background(const std::string& filename);
     void                  offset_sigma(const double& sigma);
     double                offset_sigma(void) const;
+    void                  gauss_legendre_order(const int& order);
+    const int&            gauss_legendre_order(void) const;
     const GCTAAeff*       aeff(void) const;
     void                  aeff(GCTAAeff* aeff);
     const GCTAPsf*        psf(void) const;
@@ -132,6 +142,12 @@ public:
                const double& zenith,
                const double& azimuth,
                const double& srcLogEng) const;
+    double psf_derivative(const double& delta,
+                          const double& theta,
+                          const double& phi,
+                          const double& zenith,
+                          const double& azimuth,
+                          const double& srcLogEng) const;
     double psf_delta_max(const double& theta,
                          const double& phi,
                          const double& zenith,
@@ -159,6 +175,9 @@ public:
                 const GCTAPointing& pnt,
                 const GCTARoi&      roi) const;
 
+    // IRF cache methods
+    void irf_cache_keys(const GModels& models, const GObservation& obs) const;
+
 private:
     // Private methods
     void        init_members(void);
@@ -177,6 +196,29 @@ private:
     double      irf_diffuse(const GEvent&       event,
                             const GSource&      source,
                             const GObservation& obs) const;
+    double      irf_ptsrc_gradients(const GEvent&       event,
+                                    const GSource&      source,
+                                    const GObservation& obs,
+                                    GVector&            gradients,
+                                    const int&          offset) const;
+    double      irf_radial_gradients(const GEvent&       event,
+                                     const GSource&      source,
+                                     const GObservation& obs,
+                                     GVector&            gradients,
+                                     const int&          offset) const;
+    double      irf_elliptical_gradients(const GEvent&       event,
+                                         const GSource&      source,
+                                         const GObservation& obs,
+                                         GVector&            gradients,
+                                         const int&          offset) const;
+    const GCTAEventList* irf_cache_list(const GEvent&       event,
+                                        const GSource&      source,
+                                        const GObservation& obs,
+                                        int*                index,
+                                        int*                node) const;
+    const GCTAObservation* nroi_cache_obs(const GModelSky&    model,
+                                          const GTime&        srcTime,
+                                          const GObservation& obs) const;
     double      nroi_ptsrc(const GModelSky&    model,
                            const GEnergy&      srcEng,
                            const GTime&        srcTime,
@@ -212,6 +254,7 @@ private:
     mutable bool    m_apply_edisp;    //!< Apply energy dispersion
     double          m_lo_save_thres;  //!< Save low energy threshold
     double          m_hi_save_thres;  //!< Save high energy threshold
+    int             m_gl_order;       //!< Gauss-Legendre order (0: Romberg)
 
     // XML response filename
     std::string     m_xml_caldb;      //!< Calibration database string in XML file
@@ -220,12 +263,6 @@ private:
     std::string     m_xml_psf;        //!< PSF file name in XML file
     std::string     m_xml_edisp;      //!< Edisp file name in XML file
     std::string     m_xml_background; //!< Background file name in XML file
-
-    // Npred cache
-    mutable std::vector<std::string> m_npred_names;    //!< Model names
-    mutable std::vector<GEnergy>     m_npred_energies; //!< Model energy
-    mutable std::vector<GTime>       m_npred_times;    //!< Model time
-    mutable std::vector<double>      m_npred_values;   //!< Model values
 };
 
 
@@ -332,6 +369,18 @@ void GCTAResponseIrf::caldb(const GCaldb& caldb)
 }
 
 
+/***********************************************************************//**
+ * @brief Return Gauss-Legendre order of IRF integrations
+ *
+ * @return Gauss-Legendre order (0: Romberg integration).
+ ***************************************************************************/
+inline
+const int& GCTAResponseIrf::gauss_legendre_order(void) const
+{
+    return m_gl_order;
+}
+
+
 /***********************************************************************//**
  * @brief Return pointer to effective area response
  *
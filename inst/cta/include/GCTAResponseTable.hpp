@@ -42,6 +42,12 @@
  *
  * A response table contains response parameters in multi-dimensional vector
  * column format. Each dimension is described by axes columns. 
+ *
+ * Interpolation does not modify the response table, hence a response table
+ * may be evaluated concurrently from several threads. Besides the
+ * interpolation operators for a single argument set, the class provides
+ * batch operators that interpolate the response for arrays of arguments
+ * into caller provided output arrays, without allocating memory.
  ***************************************************************************/
 class GCTAResponseTable : public GBase {
 
@@ -67,6 +73,33 @@ public:
                                    const double& arg2) const;
     double              operator()(const int& index, const double& arg1,
                                    const double& arg2, const double& arg3) const;
+    void                operator()(const int&    num,
+                                   const double* arg,
+                                   double*       pars) const;
+    void                operator()(const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   double*       pars) const;
+    void                operator()(const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   const double* arg3,
+                                   double*       pars) const;
+    void                operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg,
+                                   double*       values) const;
+    void                operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   double*       values) const;
+    void                operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   const double* arg3,
+                                   double*       values) const;
 
     // Methods
     void               clear(void);
@@ -106,10 +139,11 @@ private:
     void read_colnames(const GFitsTable& hdu);
     void read_axes(const GFitsTable& hdu);
     void read_pars(const GFitsTable& hdu);
-    void update(const double& arg) const;
-    void update(const double& arg1, const double& arg2) const;
+    void update(const double& arg, int* inx, double* wgt) const;
+    void update(const double& arg1, const double& arg2,
+                int* inx, double* wgt) const;
     void update(const double& arg1, const double& arg2,
-                const double& arg3) const;
+                const double& arg3, int* inx, double* wgt) const;
 
     // Table information
     int                               m_naxes;       //!< Number of axes
@@ -125,32 +159,6 @@ private:
     std::vector<std::string>          m_units_par;   //!< Parameter units
     std::vector<GNodeArray>           m_axis_nodes;  //!< Axes node arrays
     std::vector<std::vector<double> > m_pars;        //!< Parameters
-
-    // Response table computation cache for 1D access
-    mutable int    m_inx_left;        //!< Index of left node
-    mutable int    m_inx_right;       //!< Index of right node
-    mutable double m_wgt_left;        //!< Weight of left node
-    mutable double m_wgt_right;       //!< Weight of right node
-
-    // Response table computation cache for 2D access
-    mutable int    m_inx1;            //!< Index of upper left node
-    mutable int    m_inx2;            //!< Index of lower left node
-    mutable int    m_inx3;            //!< Index of upper right node
-    mutable int    m_inx4;            //!< Index of lower right node
-    mutable double m_wgt1;            //!< Weight of upper left node
-    mutable double m_wgt2;            //!< Weight of lower left node
-    mutable double m_wgt3;            //!< Weight of upper right node
-    mutable double m_wgt4;            //!< Weight of lower right node
-
-    // Response table computation cache for 3D access
-    mutable int    m_inx5;            //!< Index of upper left node
-    mutable int    m_inx6;            //!< Index of lower left node
-    mutable int    m_inx7;            //!< Index of upper right node
-    mutable int    m_inx8;            //!< Index of lower right node
-    mutable double m_wgt5;            //!< Weight of upper left node
-    mutable double m_wgt6;            //!< Weight of lower left node
-    mutable double m_wgt7;            //!< Weight of upper right node
-    mutable double m_wgt8;            //!< Weight of lower right node
 };
 
 
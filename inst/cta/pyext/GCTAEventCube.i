@@ -28,6 +28,9 @@
 #include "GCTAEventCube.hpp"
 %}
 
+/* __ Returned event bin views are owned by the caller ___________________ */
+%newobject GCTAEventCube::bin_view;
+
 
 /***********************************************************************//**
  * @class GCTAEventCube
@@ -57,6 +60,10 @@ public:
     virtual void           write(GFits& file) const;
     virtual int            number(void) const;
 
+    // Implemented virtual base class methods
+    virtual GCTAEventBin*       bin_view(void) const;
+    virtual const GCTAEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     void                   map(const GSkymap& map);
     const GSkymap&         map(void) const;
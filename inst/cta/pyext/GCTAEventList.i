@@ -28,6 +28,9 @@
 #include "GCTAEventList.hpp"
 %}
 
+/* __ Returned event atom views are owned by the caller __________________ */
+%newobject GCTAEventList::atom_view;
+
 
 /***********************************************************************//**
  * @class GCTAEventList
@@ -57,12 +60,30 @@ public:
     virtual void           roi(const GRoi& roi);
     virtual const GCTARoi& roi(void) const;
 
+    // Other virtual methods
+    virtual GCTAEventAtom*       atom_view(void) const;
+    virtual const GCTAEventAtom* atom(const int& index, GEventAtom* view) const;
+
     // Implement other methods
     void   append(const GCTAEventAtom& event);
     void   reserve(const int& number);
+    void   use_mmap(const bool& use_mmap);
+    bool   use_mmap(void) const;
     double irf_cache(const std::string& name, const int& index) const;
     void   irf_cache(const std::string& name, const int& index,
                      const double& irf) const;
+    double irf_cache_node(const std::string& name, const int& index,
+                          const int& node) const;
+    void   irf_cache_node(const std::string& name, const int& index,
+                          const int& node, const double& irf) const;
+    void   irf_cache_key(const std::string&         name,
+                         const std::vector<double>& key,
+                         const int&                 first = 0,
+                         const int&                 nodes = 1) const;
+    void   irf_cache_release(void) const;
+    double irf_cache_memory(void) const;
+    void   irf_cache_max_memory(const double& mbytes);
+    double memory(void) const;
 };
 
 
@@ -73,9 +94,12 @@ public:
     GCTAEventList copy() {
         return (*self);
     }
-    GCTAEventAtom* __getitem__(int index) {
-        if (index >= 0 && index < self->size())
-            return (*self)[index];
+    GCTAEventAtom __getitem__(int index) {
+        if (index >= 0 && index < self->size()) {
+            GCTAEventAtom atom;
+            self->atom(index, &atom);
+            return atom;
+        }
         else
             throw GException::out_of_range("__getitem__(int)", index, self->size());
     }
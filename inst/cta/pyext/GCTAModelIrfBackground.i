@@ -53,6 +53,10 @@ public:
                                          const GObservation& obs) const;
     virtual double                  eval_gradients(const GEvent& event,
                                                    const GObservation& obs) const;
+    virtual double                  eval_gradients(const GEvent&       event,
+                                                   const GObservation& obs,
+                                                   GVector&            gradients,
+                                                   const int&          offset = 0) const;
     virtual double                  npred(const GEnergy& obsEng,
                                           const GTime& obsTime,
                                           const GObservation& obs) const;
@@ -62,6 +62,9 @@ public:
     virtual void                       read(const GXmlElement& xml);
     virtual void                       write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelData::eval_gradients;
+
     // Other methods
     GCTAModelRadial* radial(void)   const;
     GModelSpectral*  spectral(void) const;
@@ -62,6 +62,8 @@ public:
     // Overwrite virtual base class methods
     virtual const GEvents* events(void) const;
     virtual void           events(const GEvents& events);
+    virtual bool           is_threadsafe(void) const;
+    virtual void           prefetch(void) const;
 
     // Other methods
     bool                has_response(void) const;
@@ -101,6 +103,16 @@ public:
     const double&       hi_user_thres(void) const;
     void                n_tels(const int& tels);
     const int&          n_tels(void) const;
+    static void         events_max_memory(const double& mbytes);
+    static double       events_max_memory(void);
+    static double       events_memory(void);
+    double              nroi_cache(const std::string& name,
+                                   const GEnergy&     energy) const;
+    void                nroi_cache(const std::string& name,
+                                   const GEnergy&     energy,
+                                   const double&      nroi) const;
+    void                nroi_cache_key(const std::string&         name,
+                                       const std::vector<double>& key) const;
 };
 
 
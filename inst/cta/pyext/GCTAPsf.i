@@ -71,6 +71,15 @@ public:
                                   const double& zenith = 0.0,
                                   const double& azimuth = 0.0,
                                   const bool&   etrue = true) const = 0;
+
+    // Virtual methods
+    virtual double      derivative(const double& delta,
+                                   const double& logE, 
+                                   const double& theta = 0.0, 
+                                   const double& phi = 0.0,
+                                   const double& zenith = 0.0,
+                                   const double& azimuth = 0.0,
+                                   const bool&   etrue = true) const;
 };
 
 
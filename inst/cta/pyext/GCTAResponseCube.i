@@ -72,6 +72,9 @@ public:
     void                      psf(const GCTACubePsf& psf);
     const GCTACubeBackground& background(void) const;
     void                      background(const GCTACubeBackground& background);
+
+    // IRF cache methods
+    void irf_caches(const GModels& models, const GObservation& obs) const;
 };
 
 
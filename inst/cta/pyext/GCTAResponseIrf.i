@@ -116,6 +116,11 @@ public:
                                   const GTime&        obsTime,
                                   const GObservation& obs) const;
     virtual GEbounds         ebounds(const GEnergy& obsEnergy) const;
+    virtual double           irf_gradients(const GEvent&       event,
+                                           const GSource&      source,
+                                           const GObservation& obs,
+                                           GVector&            gradients,
+                                           const int&          offset = 0) const;
     virtual void             read(const GXmlElement& xml);
     virtual void             write(GXmlElement& xml) const;
 
@@ -135,6 +140,8 @@ public:
     void                  load_background(const std::string& filename);
     void                  offset_sigma(const double& sigma);
     double                offset_sigma(void) const;
+    void                  gauss_legendre_order(const int& order);
+    const int&            gauss_legendre_order(void) const;
     const GCTAAeff*       aeff(void) const;
     void                  aeff(GCTAAeff* aeff);
     const GCTAPsf*        psf(void) const;
@@ -156,6 +163,12 @@ public:
                const double& zenith,
                const double& azimuth,
                const double& srcLogEng) const;
+    double psf_derivative(const double& delta,
+                          const double& theta,
+                          const double& phi,
+                          const double& zenith,
+                          const double& azimuth,
+                          const double& srcLogEng) const;
     double psf_delta_max(const double& theta,
                          const double& phi,
                          const double& zenith,
@@ -172,6 +185,9 @@ public:
                 const GTime&        srcTime,
                 const GCTAPointing& pnt,
                 const GCTARoi&      roi) const;
+
+    // IRF cache methods
+    void irf_cache_keys(const GModels& models, const GObservation& obs) const;
 };
 
 
@@ -188,40 +188,35 @@ double GCTABackground3D::operator()(const double& logE,
 
         // Get background rate
         #if defined(G_LOG_INTERPOLATION)
-        // Retrieve node arrays
-        const GNodeArray& detx_nodes   = m_background.nodes(0);
-        const GNodeArray& dety_nodes   = m_background.nodes(1);
-        const GNodeArray& energy_nodes = m_background.nodes(2);
-
-        // Set values for node arrays
-        detx_nodes.set_value(detx);
-        dety_nodes.set_value(dety);
-        energy_nodes.set_value(logE);
+        // Get indices and weighting factors for node arrays
+        GNodeArray::weights detx_w   = m_background.nodes(0).locate(detx);
+        GNodeArray::weights dety_w   = m_background.nodes(1).locate(dety);
+        GNodeArray::weights energy_w = m_background.nodes(2).locate(logE);
 
         // Compute offsets of DETY in DETX-DETY plane
         int size1        = m_background.axis(0);
-        int offset_left  = dety_nodes.inx_left()  * size1;
-        int offset_right = dety_nodes.inx_right() * size1;
+        int offset_left  = dety_w.inx_left  * size1;
+        int offset_right = dety_w.inx_right * size1;
 
         // Set indices for bi-linear interpolation in DETX-DETY plane
-        int inx_ll = detx_nodes.inx_left()  + offset_left;
-        int inx_lr = detx_nodes.inx_left()  + offset_right;
-        int inx_rl = detx_nodes.inx_right() + offset_left;
-        int inx_rr = detx_nodes.inx_right() + offset_right;
+        int inx_ll = detx_w.inx_left  + offset_left;
+        int inx_lr = detx_w.inx_left  + offset_right;
+        int inx_rl = detx_w.inx_right + offset_left;
+        int inx_rr = detx_w.inx_right + offset_right;
 
         // Set weighting factors for bi-linear interpolation in DETX-DETY plane
-        double wgt_ll = detx_nodes.wgt_left()  * dety_nodes.wgt_left();
-        double wgt_lr = detx_nodes.wgt_left()  * dety_nodes.wgt_right();
-        double wgt_rl = detx_nodes.wgt_right() * dety_nodes.wgt_left();
-        double wgt_rr = detx_nodes.wgt_right() * dety_nodes.wgt_right();
+        double wgt_ll = detx_w.wgt_left  * dety_w.wgt_left;
+        double wgt_lr = detx_w.wgt_left  * dety_w.wgt_right;
+        double wgt_rl = detx_w.wgt_right * dety_w.wgt_left;
+        double wgt_rr = detx_w.wgt_right * dety_w.wgt_right;
 
         // Set indices for energy interpolation
-        int inx_emin = energy_nodes.inx_left();
-        int inx_emax = energy_nodes.inx_right();
+        int inx_emin = energy_w.inx_left;
+        int inx_emax = energy_w.inx_right;
 
         // Set weighting factors for energy interpolation
-        double wgt_emin = energy_nodes.wgt_left();
-        double wgt_emax = energy_nodes.wgt_right();
+        double wgt_emin = energy_w.wgt_left;
+        double wgt_emax = energy_w.wgt_right;
 
         // Compute offsets in energy dimension
         int npixels     = m_background.axis(0) * m_background.axis(1);
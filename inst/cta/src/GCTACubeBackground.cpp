@@ -36,12 +36,23 @@
 #include "GFitsBinTable.hpp"
 #include "GObservations.hpp"
 #include "GCTAEventCube.hpp"
+#include "GCTAEventAtom.hpp"
 #include "GCTAObservation.hpp"
 #include "GCTARoi.hpp"
 #include "GCTAInstDir.hpp"
+#include "GCTAResponseIrf.hpp"
+#include "GCTABackgroundPerfTable.hpp"
+#include "GCTAModelIrfBackground.hpp"
+#include "GCTAModelRadialAcceptance.hpp"
 #include "GCTACubeBackground.hpp"
 
+/* __ OpenMP section _____________________________________________________ */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* __ Method name definitions ____________________________________________ */
+#define G_FILL                     "GCTACubeBackground::fill(GObservations&)"
 #define G_READ                             "GCTACubeBackground::read(GFits&)"
 #define G_MC                "GCTACubeBackground::mc(GEnergy&, GTime&, GRan&)"
 
@@ -55,6 +66,7 @@
 #define G_LOG_INTERPOLATION   //!< Energy interpolate log10(background rate)
 
 /* __ Constants __________________________________________________________ */
+const double theta_step = 0.01;     //!< Offset angle step of rate tables (deg)
 
 
 /*==========================================================================
@@ -208,11 +220,16 @@ double GCTACubeBackground::operator()(const GCTAInstDir& dir,
                                       const GEnergy&     energy) const
 {
     // Set indices and weighting factors for interpolation
-    update(energy.log10TeV());
+    int    inx[2];
+    double wgt[2];
+    update(energy.log10TeV(), inx, wgt);
+
+    // Compute spatial interpolator that is used for both maps
+    GBilinear interpolator = m_cube.interpolator(dir.dir());
 
     // Perform interpolation
-    double background = m_wgt_left  * m_cube(dir.dir(), m_inx_left) +
-                        m_wgt_right * m_cube(dir.dir(), m_inx_right);
+    double background = wgt[0] * m_cube(interpolator, inx[0]) +
+                        wgt[1] * m_cube(interpolator, inx[1]);
 
     // Make sure that background rate does not become negative
     if (background < 0.0) {
@@ -266,10 +283,32 @@ GCTACubeBackground* GCTACubeBackground::clone(void) const
  *
  * @exception GException::invalid_value
  *            No event list found in CTA observations.
+ * @exception GException::runtime_error
+ *            Model evaluation failed in an OpenMP thread.
  *
  * Set the background cube by computing the livetime weighted background rate
  * for all CTA observations in an observation container. The cube pixel
  * values are computed as the sum over the background rates.
+ *
+ * The models are evaluated for an observation that holds the pointing,
+ * the livetime and the response of each CTA observation, but not its
+ * events, so that the events of the observations are never copied.
+ *
+ * If all models of an observation depend only on the offset angle with
+ * respect to the pointing direction, the background rate is tabulated
+ * once per energy bin on a regular offset angle grid with a spacing of
+ * theta_step degrees, and the cube pixels are filled by linear
+ * interpolation in that table (see fill_table()).
+ *
+ * Otherwise the bins of the background cube are distributed over OpenMP
+ * threads. Each thread evaluates the models for a contiguous range of bins
+ * using its own copies of the models and of the evaluation observation, so
+ * that the computation caches of the models and the response are not
+ * shared between threads. The bins are read from the shared event cube
+ * using thread-specific event bin views. Each bin is only updated by a
+ * single thread, hence the result does not depend on the thread
+ * scheduling. Exceptions that occur in a thread are rethrown once all
+ * threads have terminated.
  ***************************************************************************/
 void GCTACubeBackground::fill(const GObservations& obs)
 {
@@ -279,6 +318,10 @@ void GCTACubeBackground::fill(const GObservations& obs)
     // Initialise event cube to evaluate models
     GCTAEventCube eventcube = GCTAEventCube(m_cube, m_ebounds, obs[0]->events()->gti());
 
+    // Initialise livetime weighted background rates (units: counts/MeV/sr)
+    int                 nbins = eventcube.size();
+    std::vector<double> rates(nbins, 0.0);
+
     // Initialise total livetime
     double total_livetime = 0.0;
 
@@ -290,45 +333,106 @@ void GCTACubeBackground::fill(const GObservations& obs)
 
         if (cta != NULL) {
 
-            // Extract region of interest from CTA observation
-            GCTARoi roi = cta->roi();
-
             // Set GTI of actual observations as the GTI of the event cube
             eventcube.gti(cta->gti());
 
-            // Get observation livetime
-            double livetime = cta->livetime();
-
-            // Loop over all bins in background cube
-            for (int i = 0; i < eventcube.size(); ++i) {
-
-                // Get event bin
-                GCTAEventBin* bin = eventcube[i];
-
-                // Continue only if binned in contained in ROI
-                if (roi.contains(*bin)) {
-
-                    // Compute model value for event bin. The model value is
-                    // given in counts/MeV/s/sr.
-                    double model = obs.models().eval(*bin, *cta);
-
-                    // Multiply by livetime to get the correct weighting for
-                    // each observation. We divide by the total livetime later
-                    // to get the background model in units of counts/MeV/s/sr.
-                    model *= livetime;
-
-                    // Add existing number of counts
-                    model += bin->counts();
-
-                    // Store cumulated value (units: counts/MeV/sr)
-                    bin->counts(model);
-
-                } // endif: bin was contained in RoI
+            // Extract region of interest from CTA observation
+            GCTARoi roi = cta->roi();
 
-            } // endfor: looped over all bins
+            // Setup observation for model evaluation. The observation has
+            // the event cube as events, hence the events of the CTA
+            // observation are not copied.
+            GCTAObservation eval_obs(cta->instrument());
+            eval_obs.id(cta->id());
+            eval_obs.pointing(cta->pointing());
+            eval_obs.ontime(cta->ontime());
+            eval_obs.livetime(cta->livetime());
+            eval_obs.deadc(cta->deadc(GTime()));
+            eval_obs.response(*(cta->response()));
+            eval_obs.events(eventcube);
+
+            // If background rate depends only on offset angle then fill
+            // rates from offset angle table
+            if (is_radial(eval_obs, obs.models())) {
+                fill_table(eventcube, eval_obs, roi, obs.models(), &rates);
+            }
+
+            // ... otherwise evaluate models for all bins
+            else {
+
+                // Determine number of threads for the bin loop
+                int nthreads = 1;
+                #ifdef _OPENMP
+                if (!omp_in_parallel()) {
+                    nthreads = omp_get_max_threads();
+                    if (nthreads > nbins) {
+                        nthreads = nbins;
+                    }
+                }
+                #endif
+
+                // If more than one thread should be used then distribute the
+                // bin loop over the threads
+                if (nthreads > 1) {
+
+                    // Compile option: OpenMP
+                    #ifdef _OPENMP
+
+                    // Initialise error message of threads
+                    std::string error;
+
+                    // Evaluate bin ranges in parallel
+                    #pragma omp parallel num_threads(nthreads)
+                    {
+                        // Determine bin range for this thread
+                        int ithread = omp_get_thread_num();
+                        int nteam   = omp_get_num_threads();
+                        int first   = (int)(((long)nbins * ithread)     / nteam);
+                        int last    = (int)(((long)nbins * (ithread+1)) / nteam);
+
+                        // Evaluate bin range using thread copies of the
+                        // evaluation observation and the models. Exceptions
+                        // must not leave the parallel region, hence they
+                        // are caught and rethrown after the region.
+                        try {
+                            GCTAObservation cpy_obs(eval_obs);
+                            GModels         cpy_models(obs.models());
+                            fill_bins(eventcube, cpy_obs, roi, cpy_models,
+                                      first, last, &rates);
+                        }
+                        catch (std::exception& e) {
+                            #pragma omp critical(GCTACubeBackground_fill)
+                            {
+                                if (error.empty()) {
+                                    error = e.what();
+                                }
+                            }
+                        }
+
+                    } // end pragma omp parallel
+
+                    // Rethrow exception of threads
+                    if (!error.empty()) {
+                        std::string msg = "Unable to evaluate the background "
+                                          "models for observation \""+
+                                          cta->name()+"\": "+error;
+                        throw GException::runtime_error(G_FILL, msg);
+                    }
+
+                    #endif
+
+                } // endif: more than one thread
+
+                // ... otherwise evaluate all bins in the calling thread
+                else {
+                    fill_bins(eventcube, eval_obs, roi, obs.models(),
+                              0, nbins, &rates);
+                }
+
+            } // endelse: evaluated models for all bins
 
             // Accumulate livetime
-            total_livetime += livetime;
+            total_livetime += cta->livetime();
 
         } // endif: cta observation was vaild
 
@@ -337,16 +441,13 @@ void GCTACubeBackground::fill(const GObservations& obs)
     // Re-normalize cube to get units of counts/MeV/s/sr
     if (total_livetime > 0.0) {
 
-      // Loop over all bins in background cube and divide the content
-      // by the total livetime.
-      for (int i = 0; i < eventcube.size(); ++i) {
-          GCTAEventBin* bin  = eventcube[i];
-          double        rate = bin->counts() / total_livetime;
-          bin->counts(rate);
-      }
-
-      // Set background cube values from event cube
-      m_cube = eventcube.map();
+        // Loop over all bins in background cube and set the content divided
+        // by the total livetime. The bin index of the event cube corresponds
+        // to the pixel index of the background cube.
+        int npix = m_cube.npix();
+        for (int i = 0; i < nbins; ++i) {
+            m_cube(i % npix, i / npix) = rates[i] / total_livetime;
+        }
 
     } // endif: livetime was positive
 
@@ -369,8 +470,10 @@ void GCTACubeBackground::fill(const GObservations& obs)
  ***************************************************************************/
 double GCTACubeBackground::integral(const double& logE) const
 {
-    // Update interpolation cache
-    update(logE);
+    // Set indices and weighting factors for interpolation
+    int    inx[2];
+    double wgt[2];
+    update(logE, inx, wgt);
 
     // Initialise result
     double result = 0.0;
@@ -379,8 +482,8 @@ double GCTACubeBackground::integral(const double& logE) const
     for (int i = 0; i < m_cube.npix(); ++i) {
 
         // Get bin value
-        double value = m_wgt_left  * m_cube(i, m_inx_left) +
-                       m_wgt_right * m_cube(i, m_inx_right);
+        double value = wgt[0] * m_cube(i, inx[0]) +
+                       wgt[1] * m_cube(i, inx[1]);
 
         // Sum bin contents
         result += value * m_cube.solidangle(i);
@@ -573,12 +676,6 @@ void GCTACubeBackground::init_members(void)
     m_ebounds.clear();
     m_elogmeans.clear();
 
-    // Initialise cache
-    m_inx_left  = 0;
-    m_inx_right = 0;
-    m_wgt_left  = 0.0;
-    m_wgt_right = 0.0;
-
     // Return
     return;
 }
@@ -597,12 +694,6 @@ void GCTACubeBackground::copy_members(const GCTACubeBackground& bgd)
     m_ebounds   = bgd.m_ebounds;
     m_elogmeans = bgd.m_elogmeans;
 
-    // Copy cache
-    m_inx_left  = bgd.m_inx_left;
-    m_inx_right = bgd.m_inx_right;
-    m_wgt_left  = bgd.m_wgt_left;
-    m_wgt_right = bgd.m_wgt_right;
-
     // Return
     return;
 }
@@ -654,26 +745,237 @@ void GCTACubeBackground::set_eng_axis(void)
 
 
 /***********************************************************************//**
- * @brief Update 1D cache
+ * @brief Compute 1D interpolation indices and weights
  *
  * @param[in] logE Log10 energy in TeV.
+ * @param[out] inx Array of 2 indices.
+ * @param[out] wgt Array of 2 weights.
+ *
+ * Computes the two indices and weights that define the 2 maps of the cube
+ * that are used for linear interpolation in energy.
+ ***************************************************************************/
+void GCTACubeBackground::update(const double& logE, int* inx, double* wgt) const
+{
+    // Set indices and weighting factors for interpolation
+    GNodeArray::weights w = m_elogmeans.locate(logE);
+    inx[0] = w.inx_left;
+    inx[1] = w.inx_right;
+    wgt[0] = w.wgt_left;
+    wgt[1] = w.wgt_right;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Signals whether the background rate depends only on offset angle
  *
- * Updates the 1D interpolation cache. The interpolation cache is composed
- * of two indices and weights that define 2 data values of the 2D skymap
- * that are used for linear interpolation.
+ * @param[in] obs CTA observation.
+ * @param[in] models Models.
+ * @return True if background rate depends only on offset angle.
  *
- * @todo Write down formula
+ * Returns true if all models that are valid for the observation are radial
+ * acceptance models or IRF background models with a performance table
+ * background. The rates of these models depend only on the offset angle
+ * with respect to the pointing direction, on energy and on time.
  ***************************************************************************/
-void GCTACubeBackground::update(const double& logE) const
+bool GCTACubeBackground::is_radial(const GCTAObservation& obs,
+                                   const GModels&         models) const
 {
-    // Set value for node array
-    m_elogmeans.set_value(logE);
+    // Get performance table background of the observation
+    const GCTABackgroundPerfTable* perf = NULL;
+    const GCTAResponseIrf* rsp = dynamic_cast<const GCTAResponseIrf*>(obs.response());
+    if (rsp != NULL) {
+        perf = dynamic_cast<const GCTABackgroundPerfTable*>(rsp->background());
+    }
 
-    // Set indices and weighting factors for interpolation
-    m_inx_left  = m_elogmeans.inx_left();
-    m_inx_right = m_elogmeans.inx_right();
-    m_wgt_left  = m_elogmeans.wgt_left();
-    m_wgt_right = m_elogmeans.wgt_right();
+    // Initialise flag
+    bool radial = true;
+
+    // Loop over all models
+    for (int i = 0; i < models.size(); ++i) {
+
+        // Skip models that are not valid for the observation
+        if (!models[i]->is_valid(obs.instrument(), obs.id())) {
+            continue;
+        }
+
+        // Continue only if model depends only on offset angle
+        if (dynamic_cast<const GCTAModelRadialAcceptance*>(models[i]) != NULL) {
+            continue;
+        }
+        if (dynamic_cast<const GCTAModelIrfBackground*>(models[i]) != NULL &&
+            perf != NULL) {
+            continue;
+        }
+
+        // Signal that model is not radial
+        radial = false;
+        break;
+
+    } // endfor: looped over models
+
+    // Return flag
+    return radial;
+}
+
+
+/***********************************************************************//**
+ * @brief Fill background rates from offset angle table
+ *
+ * @param[in] cube Event cube with the binning of the background cube.
+ * @param[in] obs CTA observation.
+ * @param[in] roi Region of interest of the observation.
+ * @param[in] models Models.
+ * @param[in,out] rates Livetime weighted background rates (counts/MeV/sr).
+ *
+ * Tabulates for each energy bin the model value on a regular offset angle
+ * grid with a spacing of theta_step degrees and adds for all bins that are
+ * contained in the RoI the linearly interpolated model value multiplied by
+ * the livetime of the observation to the @p rates vector. The models are
+ * evaluated in the calling thread, the pixel loop is distributed over
+ * OpenMP threads.
+ *
+ * The method requires that the models depend only on the offset angle with
+ * respect to the pointing direction (see is_radial()).
+ ***************************************************************************/
+void GCTACubeBackground::fill_table(const GCTAEventCube&   cube,
+                                    const GCTAObservation& obs,
+                                    const GCTARoi&         roi,
+                                    const GModels&         models,
+                                    std::vector<double>*   rates) const
+{
+    // Get cube dimensions
+    int npix   = m_cube.npix();
+    int nebins = m_ebounds.size();
+
+    // Get sky directions of all cube pixels and pointing direction
+    const std::vector<GSkyDir>& dirs = m_cube.dirs();
+    const GSkyDir&              pnt  = obs.pointing().dir();
+
+    // Get observation livetime
+    double livetime = obs.livetime();
+
+    // Compute offset angles of all pixels within the RoI (radians). Pixels
+    // outside the RoI get a negative offset angle.
+    std::vector<double> thetas(npix);
+    double              theta_max = 0.0;
+    for (int pixel = 0; pixel < npix; ++pixel) {
+        if (roi.centre().dir().dist_deg(dirs[pixel]) <= roi.radius()) {
+            thetas[pixel] = pnt.dist(dirs[pixel]);
+            if (thetas[pixel] > theta_max) {
+                theta_max = thetas[pixel];
+            }
+        }
+        else {
+            thetas[pixel] = -1.0;
+        }
+    }
+
+    // Setup offset angle grid
+    double dtheta = theta_step * gammalib::deg2rad;
+    int    ntheta = int(theta_max / dtheta) + 2;
+
+    // Allocate background rate table and event bin view
+    std::vector<double> table(ntheta);
+    GCTAEventBin*       view = cube.bin_view();
+
+    // Loop over all background cube energy bins
+    for (int iebin = 0; iebin < nebins; ++iebin) {
+
+        // Setup event atom with energy and time of event cube layer
+        const GCTAEventBin* bin = cube.bin(iebin * npix, view);
+        GCTAEventAtom       atom;
+        atom.energy(bin->energy());
+        atom.time(bin->time());
+
+        // Tabulate model value * livetime
+        for (int k = 0; k < ntheta; ++k) {
+            GSkyDir dir = pnt;
+            dir.rotate_deg(0.0, k * theta_step);
+            atom.dir(GCTAInstDir(dir));
+            table[k] = models.eval(atom, obs) * livetime;
+        }
+
+        // Get pointer on rates of energy bin
+        double* layer = &((*rates)[iebin * npix]);
+
+        // Add to rates
+        #pragma omp parallel for schedule(static)
+        for (int pixel = 0; pixel < npix; ++pixel) {
+            if (thetas[pixel] >= 0.0) {
+                double index  = thetas[pixel] / dtheta;
+                int    k      = int(index);
+                double wgt    = index - double(k);
+                layer[pixel] += (1.0 - wgt) * table[k] + wgt * table[k+1];
+            }
+        }
+
+    } // endfor: looped over energy bins
+
+    // Delete event bin view
+    delete view;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Accumulate livetime weighted background rates for a bin range
+ *
+ * @param[in] cube Event cube with the binning of the background cube.
+ * @param[in] obs CTA observation.
+ * @param[in] roi Region of interest of the observation.
+ * @param[in] models Models.
+ * @param[in] first Index of first bin.
+ * @param[in] last Index of bin after the last bin.
+ * @param[in,out] rates Livetime weighted background rates (counts/MeV/sr).
+ *
+ * Adds for all bins in [@p first, @p last[ that are contained in the RoI
+ * the model value multiplied by the livetime of the observation to the
+ * @p rates vector. The bins are accessed through an event bin view, hence
+ * the event @p cube is not modified. The method only accesses the @p rates
+ * elements of the bin range, so it can be called for disjoint bin ranges
+ * from several threads.
+ ***************************************************************************/
+void GCTACubeBackground::fill_bins(const GCTAEventCube&   cube,
+                                   const GCTAObservation& obs,
+                                   const GCTARoi&         roi,
+                                   const GModels&         models,
+                                   const int&             first,
+                                   const int&             last,
+                                   std::vector<double>*   rates) const
+{
+    // Get observation livetime
+    double livetime = obs.livetime();
+
+    // Allocate event bin view
+    GCTAEventBin* view = cube.bin_view();
+
+    // Loop over bin range
+    for (int i = first; i < last; ++i) {
+
+        // Get event bin
+        const GCTAEventBin* bin = cube.bin(i, view);
+
+        // Continue only if binned in contained in ROI
+        if (roi.contains(*bin)) {
+
+            // Compute model value for event bin. The model value is given
+            // in counts/MeV/s/sr. Multiply by livetime to get the correct
+            // weighting for each observation. We divide by the total
+            // livetime later to get the background model in units of
+            // counts/MeV/s/sr.
+            (*rates)[i] += models.eval(*bin, obs) * livetime;
+
+        } // endif: bin was contained in RoI
+
+    } // endfor: looped over bin range
+
+    // Delete event bin view
+    delete view;
 
     // Return
     return;
@@ -28,6 +28,7 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <vector>
 #include "GCTACubeExposure.hpp"
 #include "GCTAObservation.hpp"
 #include "GCTAResponseIrf.hpp"
@@ -44,6 +45,7 @@
 /* __ Debug definitions __________________________________________________ */
 
 /* __ Constants __________________________________________________________ */
+const double theta_step = 0.01;     //!< Offset angle step of IRF tables (deg)
 
 
 /*==========================================================================
@@ -235,11 +237,16 @@ GCTACubeExposure& GCTACubeExposure::operator=(const GCTACubeExposure& cube)
 double GCTACubeExposure::operator()(const GSkyDir& dir, const GEnergy& energy) const
 { 
     // Set indices and weighting factors for interpolation
-    update(energy.log10TeV());
+    int    inx[2];
+    double wgt[2];
+    update(energy.log10TeV(), inx, wgt);
+
+    // Compute spatial interpolator that is used for both maps
+    GBilinear interpolator = m_cube.interpolator(dir);
 
     // Perform interpolation
-    double exposure = m_wgt_left  * m_cube(dir, m_inx_left) +
-                      m_wgt_right * m_cube(dir, m_inx_right);
+    double exposure = wgt[0] * m_cube(interpolator, inx[0]) +
+                      wgt[1] * m_cube(interpolator, inx[1]);
 
     // Make sure that exposure does not become negative
     if (exposure < 0.0) {
@@ -313,11 +320,14 @@ void GCTACubeExposure::set(const GCTAObservation& obs)
     // Continue only if response is valid
     if (rsp != NULL) {
 
+        // Get sky directions of all pixels
+        const std::vector<GSkyDir>& dirs = m_cube.dirs();
+
         // Loop over all pixels in sky map
         for (int pixel = 0; pixel < m_cube.npix(); ++pixel) {
 
             // Get pixel sky direction
-            GSkyDir dir = m_cube.inx2dir(pixel);
+            const GSkyDir& dir = dirs[pixel];
             
             // Continue only if pixel is within RoI
             if (roi.centre().dir().dist_deg(dir) <= roi.radius()) {
@@ -364,6 +374,14 @@ void GCTACubeExposure::set(const GCTAObservation& obs)
  * Set the exposure cube by summing the exposure for all CTA observations in
  * an observation container. The cube pixel values are computed as the sum
  * over the products of the effective area and the livetime.
+ *
+ * As the effective area depends only on the offset angle with respect to
+ * the pointing direction and on energy, the effective area of each
+ * observation is tabulated once per energy bin on a regular offset angle
+ * grid with a spacing of theta_step degrees, and the cube pixels are
+ * filled by linear interpolation in that table. The pixel loop is
+ * distributed over OpenMP threads. Each pixel is only updated by a single
+ * thread, hence the result does not depend on the thread scheduling.
  ***************************************************************************/
 void GCTACubeExposure::fill(const GObservations& obs)
 {
@@ -372,6 +390,21 @@ void GCTACubeExposure::fill(const GObservations& obs)
     m_livetime = 0.0;
     m_cube     = 0.0;
 
+    // Get cube dimensions
+    int npix   = m_cube.npix();
+    int nebins = m_ebounds.size();
+
+    // Get sky directions of all cube pixels
+    const std::vector<GSkyDir>& dirs = m_cube.dirs();
+
+    // Allocate offset angle of all cube pixels (radians)
+    std::vector<double> thetas(npix);
+
+    // Get pointer on cube pixels. The pixels are not shared with other sky
+    // maps since they have been reset above, hence they can be modified
+    // directly by the threads.
+    double* cube = const_cast<double*>(m_cube.pixels());
+
     // Loop over all observations in container
     for (int i = 0; i < obs.size(); ++i) {
 
@@ -388,39 +421,63 @@ void GCTACubeExposure::fill(const GObservations& obs)
 
             // Continue only if response is valid
             if (rsp != NULL) {
-            
-                // Loop over all pixels in sky map
-                for (int pixel = 0; pixel < m_cube.npix(); ++pixel) {
-
-                    // Get pixel sky direction
-                    GSkyDir dir = m_cube.inx2dir(pixel);
-                    
-                    // Continue only if pixel is within RoI
-                    if (roi.centre().dir().dist_deg(dir) <= roi.radius()) {
-
-                        // Compute theta angle with respect to pointing
-                        // direction in radians
-                        double theta = pnt.dist(dir);
-    
-                        // Loop over all exposure cube energy bins
-                        for (int iebin = 0; iebin < m_ebounds.size(); ++iebin){
 
-                            // Get logE/TeV
-                            double logE = m_ebounds.elogmean(iebin).log10TeV();
+                // Get observation livetime
+                double livetime = cta->livetime();
+
+                // Compute offset angles of all pixels within the RoI (radians).
+                // Pixels outside the RoI get a negative offset angle.
+                double theta_max = 0.0;
+                for (int pixel = 0; pixel < npix; ++pixel) {
+                    if (roi.centre().dir().dist_deg(dirs[pixel]) <= roi.radius()) {
+                        thetas[pixel] = pnt.dist(dirs[pixel]);
+                        if (thetas[pixel] > theta_max) {
+                            theta_max = thetas[pixel];
+                        }
+                    }
+                    else {
+                        thetas[pixel] = -1.0;
+                    }
+                }
+
+                // Setup offset angle grid
+                double dtheta = theta_step * gammalib::deg2rad;
+                int    ntheta = int(theta_max / dtheta) + 2;
+
+                // Allocate effective area table
+                std::vector<double> aeff(ntheta);
 
-                            // Add to exposure cube (effective area * livetime)
-                            m_cube(pixel, iebin) += rsp->aeff(theta, 0.0, 0.0, 0.0, logE) *
-                                                    cta->livetime();
+                // Loop over all exposure cube energy bins
+                for (int iebin = 0; iebin < nebins; ++iebin) {
 
-                        } // endfor: looped over energy bins
+                    // Get logE/TeV
+                    double logE = m_ebounds.elogmean(iebin).log10TeV();
 
-                    } // endif: pixel within RoI
+                    // Tabulate effective area * livetime
+                    for (int k = 0; k < ntheta; ++k) {
+                        aeff[k] = rsp->aeff(k * dtheta, 0.0, 0.0, 0.0, logE) *
+                                  livetime;
+                    }
+
+                    // Get pointer on exposure cube layer
+                    double* layer = cube + iebin * npix;
+
+                    // Add to exposure cube
+                    #pragma omp parallel for schedule(static)
+                    for (int pixel = 0; pixel < npix; ++pixel) {
+                        if (thetas[pixel] >= 0.0) {
+                            double index  = thetas[pixel] / dtheta;
+                            int    k      = int(index);
+                            double wgt    = index - double(k);
+                            layer[pixel] += (1.0 - wgt) * aeff[k] + wgt * aeff[k+1];
+                        }
+                    }
 
-                } // endfor: looped over all pixels
+                } // endfor: looped over energy bins
 
                 // Append GTIs and increment livetime
                 m_gti.extend(cta->gti());
-                m_livetime += cta->livetime();
+                m_livetime += livetime;
             
             } // endif: response was valid
     
@@ -624,12 +681,6 @@ void GCTACubeExposure::init_members(void)
     m_gti.clear();
     m_livetime = 0.0;
 
-    // Initialise cache
-    m_inx_left  = 0;
-    m_inx_right = 0;
-    m_wgt_left  = 0.0;
-    m_wgt_right = 0.0;
-   
     // Return
     return;
 }
@@ -650,12 +701,6 @@ void GCTACubeExposure::copy_members(const GCTACubeExposure& cube)
     m_gti       = cube.m_gti;
     m_livetime  = cube.m_livetime;
 
-    // Copy cache
-    m_inx_left  = cube.m_inx_left;
-    m_inx_right = cube.m_inx_right;
-    m_wgt_left  = cube.m_wgt_left;
-    m_wgt_right = cube.m_wgt_right;
-
     // Return
     return;
 }
@@ -671,26 +716,23 @@ void GCTACubeExposure::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update 1D cache
+ * @brief Compute 1D interpolation indices and weights
  *
  * @param[in] logE Log10 energy in TeV.
+ * @param[out] inx Array of 2 indices.
+ * @param[out] wgt Array of 2 weights.
  *
- * Updates the 1D interpolation cache. The interpolation cache is composed
- * of two indices and weights that define 2 data values of the 2D skymap
- * that are used for linear interpolation.
- *
- * @todo Write down formula
+ * Computes the two indices and weights that define the 2 maps of the cube
+ * that are used for linear interpolation in energy.
  ***************************************************************************/
-void GCTACubeExposure::update(const double& logE) const
+void GCTACubeExposure::update(const double& logE, int* inx, double* wgt) const
 {
-    // Set value for node array
-    m_elogmeans.set_value(logE);
-
     // Set indices and weighting factors for interpolation
-    m_inx_left  = m_elogmeans.inx_left();
-    m_inx_right = m_elogmeans.inx_right();
-    m_wgt_left  = m_elogmeans.wgt_left();
-    m_wgt_right = m_elogmeans.wgt_right();
+    GNodeArray::weights w = m_elogmeans.locate(logE);
+    inx[0] = w.inx_left;
+    inx[1] = w.inx_right;
+    wgt[0] = w.wgt_left;
+    wgt[1] = w.wgt_right;
 
     // Return
     return;
@@ -28,6 +28,8 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <vector>
+#include <algorithm>
 #include "GCTACubePsf.hpp"
 #include "GCTAObservation.hpp"
 #include "GCTAResponseIrf.hpp"
@@ -47,6 +49,7 @@
 /* __ Debug definitions __________________________________________________ */
 
 /* __ Constants __________________________________________________________ */
+const double theta_step = 0.01;     //!< Offset angle step of IRF tables (deg)
 
 
 /*==========================================================================
@@ -293,14 +296,19 @@ double GCTACubePsf::operator()(const GSkyDir& dir,
                                const double&  delta,
                                const GEnergy& energy) const
 {
-    // Update indices and weighting factors for interpolation
-    update(delta, energy.log10TeV());
+    // Set indices and weighting factors for interpolation
+    int    inx[4];
+    double wgt[4];
+    update(delta, energy.log10TeV(), inx, wgt);
+
+    // Compute spatial interpolator that is used for all maps
+    GBilinear interpolator = m_cube.interpolator(dir);
 
     // Perform bi-linear interpolation
-    double psf = m_wgt1 * m_cube(dir, m_inx1) +
-                 m_wgt2 * m_cube(dir, m_inx2) +
-                 m_wgt3 * m_cube(dir, m_inx3) +
-                 m_wgt4 * m_cube(dir, m_inx4);
+    double psf = wgt[0] * m_cube(interpolator, inx[0]) +
+                 wgt[1] * m_cube(interpolator, inx[1]) +
+                 wgt[2] * m_cube(interpolator, inx[2]) +
+                 wgt[3] * m_cube(interpolator, inx[3]);
 
     // Make sure that PSF does not become negative
     if (psf < 0.0) {
@@ -375,11 +383,33 @@ void GCTACubePsf::set(const GCTAObservation& obs)
     // Continue only if response is valid
     if (rsp != NULL) {
 
+        // Throw an exception if there is no point spread function
+        if (rsp->psf() == NULL) {
+            std::string msg = "No point spread function information found "
+                              "in response. Please make sure that the "
+                              "instrument response is properly defined.";
+            throw GException::invalid_value(G_SET, msg);
+        }
+
+        // Get sky directions of all pixels
+        const std::vector<GSkyDir>& dirs = m_cube.dirs();
+
+        // Setup delta values in radians and argument arrays for the batch
+        // evaluation of the point spread function
+        int                 ndeltas = m_deltas.size();
+        std::vector<double> deltas(ndeltas);
+        std::vector<double> logEs(ndeltas);
+        std::vector<double> thetas(ndeltas);
+        std::vector<double> values(ndeltas);
+        for (int idelta = 0; idelta < ndeltas; ++idelta) {
+            deltas[idelta] = m_deltas[idelta] * gammalib::deg2rad;
+        }
+
         // Loop over all pixels in sky map
         for (int pixel = 0; pixel < m_cube.npix(); ++pixel) {
 
             // Get pixel sky direction
-            GSkyDir dir = m_cube.inx2dir(pixel);
+            const GSkyDir& dir = dirs[pixel];
             
             // Continue only if pixel is within RoI
             if (roi.centre().dir().dist_deg(dir) <= roi.radius()) {
@@ -394,19 +424,18 @@ void GCTACubePsf::set(const GCTAObservation& obs)
                     // Get logE/TeV
                     double logE = m_ebounds.elogmean(iebin).log10TeV();
 
-                    // Loop over delta values
-                    for (int idelta = 0; idelta < m_deltas.size(); ++idelta) {
-
-                        // Compute delta in radians
-                        double delta = m_deltas[idelta] * gammalib::deg2rad;
+                    // Evaluate PSF for all delta values
+                    if (ndeltas > 0) {
+                        std::fill(logEs.begin(), logEs.end(), logE);
+                        std::fill(thetas.begin(), thetas.end(), theta);
+                        rsp->psf()->eval(ndeltas, &deltas[0], &logEs[0],
+                                         &thetas[0], &values[0]);
+                    }
 
-                        // Set map index
-                        int imap = offset(idelta, iebin);
-                
-                        // Set PSF cube
-                        m_cube(pixel, imap) = rsp->psf(delta, theta, 0.0, 0.0, 0.0, logE);
-
-                    } // endfor: looped over delta bins
+                    // Set PSF cube
+                    for (int idelta = 0; idelta < ndeltas; ++idelta) {
+                        m_cube(pixel, offset(idelta, iebin)) = values[idelta];
+                    }
 
                 } // endfor: looped over energy bins
 
@@ -430,14 +459,45 @@ void GCTACubePsf::set(const GCTAObservation& obs)
  * @brief Fill PSF cube from observation container
  *
  * @param[in] obs Observation container.
+ *
+ * Set the PSF cube by computing the exposure weighted mean PSF of all CTA
+ * observations in an observation container.
+ *
+ * As effective area and PSF depend only on the offset angle with respect
+ * to the pointing direction and on energy, the exposure weighted PSF of
+ * each observation is tabulated once per energy bin on a regular offset
+ * angle grid with a spacing of theta_step degrees, and the cube pixels are
+ * filled by linear interpolation in that table. The pixel loop is
+ * distributed over OpenMP threads. Each pixel is only updated by a single
+ * thread, hence the result does not depend on the thread scheduling.
  ***************************************************************************/
 void GCTACubePsf::fill(const GObservations& obs)
 {
     // Clear PSF cube
     clear_cube();
 
-    // Initialise skymap for exposure weight accumulation
-    GSkymap exposure(m_cube);
+    // Get cube dimensions
+    int npix    = m_cube.npix();
+    int nebins  = m_ebounds.size();
+    int ndeltas = m_deltas.size();
+
+    // Initialise exposure weights for all pixels and energy bins
+    std::vector<double> exposure(npix * nebins, 0.0);
+
+    // Get sky directions of all cube pixels
+    const std::vector<GSkyDir>& dirs = m_cube.dirs();
+
+    // Allocate offset angle of all cube pixels (radians)
+    std::vector<double> thetas(npix);
+
+    // Get pointer on cube pixels. The pixels are not shared with other sky
+    // maps since they have been reset above, hence they can be modified
+    // directly by the threads.
+    double* cube = const_cast<double*>(m_cube.pixels());
+
+    // Get the memory strides of pixels and maps in the cube layout
+    int pix_stride = (m_cube.is_pixel_major()) ? m_cube.nmaps() : 1;
+    int map_stride = (m_cube.is_pixel_major()) ? 1 : npix;
 
     // Loop over all observations in container
     for (int i = 0; i < obs.size(); ++i) {
@@ -456,52 +516,81 @@ void GCTACubePsf::fill(const GObservations& obs)
             // Continue only if response is valid
             if (rsp != NULL) {
 
-                // Loop over all pixels in sky map
-                for (int pixel = 0; pixel < m_cube.npix(); ++pixel) {
-
-                    // Get pixel sky direction
-                    GSkyDir dir = m_cube.inx2dir(pixel);
-                    
-                    // Continue only if pixel is within RoI
-                    if (roi.centre().dir().dist_deg(dir) <= roi.radius()) {
-
-                        // Compute theta angle with respect to pointing
-                        // direction in radians
-                        double theta = pnt.dist(dir);
-    
-                        // Loop over all energy bins
-                        for (int iebin = 0; iebin < m_ebounds.size(); ++iebin) {
-
-                            // Get logE/TeV
-                            double logE = m_ebounds.elogmean(iebin).log10TeV();
-
-                            // Compute exposure weight
-                            double weight = rsp->aeff(theta, 0.0, 0.0, 0.0, logE) *
-                                            cta->livetime();
-
-                            // Accumulate weights
-                            exposure(pixel, iebin) += weight;
-
-                            // Loop over delta values
-                            for (int idelta = 0; idelta < m_deltas.size(); ++idelta) {
-
-                                // Compute delta in radians
-                                double delta = m_deltas[idelta] * gammalib::deg2rad;
+                // Get observation livetime
+                double livetime = cta->livetime();
+
+                // Compute offset angles of all pixels within the RoI (radians).
+                // Pixels outside the RoI get a negative offset angle.
+                double theta_max = 0.0;
+                for (int pixel = 0; pixel < npix; ++pixel) {
+                    if (roi.centre().dir().dist_deg(dirs[pixel]) <= roi.radius()) {
+                        thetas[pixel] = pnt.dist(dirs[pixel]);
+                        if (thetas[pixel] > theta_max) {
+                            theta_max = thetas[pixel];
+                        }
+                    }
+                    else {
+                        thetas[pixel] = -1.0;
+                    }
+                }
 
-                                // Set map index
-                                int imap = offset(idelta, iebin);
+                // Setup offset angle grid
+                double dtheta = theta_step * gammalib::deg2rad;
+                int    ntheta = int(theta_max / dtheta) + 2;
 
-                                // Add on PSF cube
-                                m_cube(pixel, imap) +=
-                                    rsp->psf(delta, theta, 0.0, 0.0, 0.0, logE) * weight;
+                // Allocate tables of exposure weight and weighted PSF
+                std::vector<double> weights(ntheta);
+                std::vector<double> psfs(ntheta * ndeltas);
 
-                            } // endfor: looped over delta bins
+                // Loop over all energy bins
+                for (int iebin = 0; iebin < nebins; ++iebin) {
 
-                        } // endfor: looped over energy bins
+                    // Get logE/TeV
+                    double logE = m_ebounds.elogmean(iebin).log10TeV();
 
-                    } // endif: pixel was within RoI
+                    // Tabulate exposure weight and weighted PSF
+                    for (int k = 0; k < ntheta; ++k) {
+                        double theta  = k * dtheta;
+                        double weight = rsp->aeff(theta, 0.0, 0.0, 0.0, logE) *
+                                        livetime;
+                        weights[k] = weight;
+                        for (int idelta = 0; idelta < ndeltas; ++idelta) {
+                            double delta = m_deltas[idelta] * gammalib::deg2rad;
+                            psfs[k*ndeltas+idelta] =
+                                rsp->psf(delta, theta, 0.0, 0.0, 0.0, logE) * weight;
+                        }
+                    }
+
+                    // Get offset of first PSF cube map of this energy bin
+                    int imap = offset(0, iebin);
+
+                    // Add exposure weights and weighted PSF to cube
+                    #pragma omp parallel for schedule(static)
+                    for (int pixel = 0; pixel < npix; ++pixel) {
+                        if (thetas[pixel] >= 0.0) {
+
+                            // Get interpolation nodes and weight
+                            double index = thetas[pixel] / dtheta;
+                            int    k     = int(index);
+                            double wgt   = index - double(k);
+                            double wgt0  = 1.0 - wgt;
+
+                            // Accumulate exposure weight
+                            exposure[pixel+iebin*npix] += wgt0 * weights[k] +
+                                                          wgt  * weights[k+1];
+
+                            // Accumulate weighted PSF
+                            const double* psf0 = &(psfs[k*ndeltas]);
+                            const double* psf1 = psf0 + ndeltas;
+                            for (int idelta = 0; idelta < ndeltas; ++idelta) {
+                                cube[pixel*pix_stride+(imap+idelta)*map_stride] +=
+                                    wgt0 * psf0[idelta] + wgt * psf1[idelta];
+                            }
+
+                        } // endif: pixel was within RoI
+                    } // endfor: looped over all pixels
 
-                } // endfor: looped over all pixels
+                } // endfor: looped over energy bins
 
             } // endif: response was valid
 
@@ -510,17 +599,17 @@ void GCTACubePsf::fill(const GObservations& obs)
     } // endfor: looped over observations
 
     // Compute mean PSF cube by dividing though the weights
-    for (int pixel = 0; pixel < m_cube.npix(); ++pixel) {
-        for (int iebin = 0; iebin < m_ebounds.size(); ++iebin) {
-            if (exposure(pixel, iebin) > 0.0) {
-                double norm = 1.0 / exposure(pixel, iebin);
-                for (int idelta = 0; idelta < m_deltas.size(); ++idelta) {
+    for (int pixel = 0; pixel < npix; ++pixel) {
+        for (int iebin = 0; iebin < nebins; ++iebin) {
+            if (exposure[pixel+iebin*npix] > 0.0) {
+                double norm = 1.0 / exposure[pixel+iebin*npix];
+                for (int idelta = 0; idelta < ndeltas; ++idelta) {
                     int imap = offset(idelta, iebin);
                     m_cube(pixel, imap) *= norm;
                 }
             }
             else {
-                for (int idelta = 0; idelta < m_deltas.size(); ++idelta) {
+                for (int idelta = 0; idelta < ndeltas; ++idelta) {
                     int imap = offset(idelta, iebin);
                     m_cube(pixel, imap) = 0.0;
                 }
@@ -555,8 +644,10 @@ void GCTACubePsf::read(const GFits& fits)
     const GFitsTable& hdu_ebounds = *fits.table("EBOUNDS");
     const GFitsTable& hdu_deltas  = *fits.table("DELTAS");
 
-    // Read cube
+    // Read cube and store the pixels in pixel-major layout, so that the
+    // maps that are interpolated in delta and energy are close in memory
     m_cube.read(hdu_psfcube);
+    m_cube.pixel_major();
 
     // Read energy boundaries
     m_ebounds.read(hdu_ebounds);
@@ -734,16 +825,6 @@ void GCTACubePsf::init_members(void)
     m_deltas_cache.clear();
     m_quadratic_binning = false;
 
-    // Initialise cache
-    m_inx1 = 0;
-    m_inx2 = 0;
-    m_inx3 = 0;
-    m_inx4 = 0;
-    m_wgt1 = 0.0;
-    m_wgt2 = 0.0;
-    m_wgt3 = 0.0;
-    m_wgt4 = 0.0;
-   
     // Return
     return;
 }
@@ -765,16 +846,6 @@ void GCTACubePsf::copy_members(const GCTACubePsf& cube)
     m_deltas_cache      = cube.m_deltas_cache;
     m_quadratic_binning = cube.m_quadratic_binning;
 
-    // Copy cache
-    m_inx1 = cube.m_inx1;
-    m_inx2 = cube.m_inx2;
-    m_inx3 = cube.m_inx3;
-    m_inx4 = cube.m_inx4;
-    m_wgt1 = cube.m_wgt1;
-    m_wgt2 = cube.m_wgt2;
-    m_wgt3 = cube.m_wgt3;
-    m_wgt4 = cube.m_wgt4;
-
     // Return
     return;
 }
@@ -812,38 +883,40 @@ void GCTACubePsf::clear_cube(void)
 }
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Compute 2D interpolation indices and weights
  *
  * @param[in] delta Angular separation between true and measured photon
  *            directions (radians).
- * @param[in] logE Log10 true photon energy (TeV). 
+ * @param[in] logE Log10 true photon energy (TeV).
+ * @param[out] inx Array of 4 indices.
+ * @param[out] wgt Array of 4 weights.
  *
- * This method updates the PSF parameter cache.
+ * Computes the four indices and weights that define the 4 maps of the cube
+ * that are used for bi-linear interpolation in delta and energy. Nothing is
+ * stored in the instance, hence the PSF cube can be shared between threads.
  ***************************************************************************/
-void GCTACubePsf::update(const double& delta, const double& logE) const
+void GCTACubePsf::update(const double& delta, const double& logE,
+                         int* inx, double* wgt) const
 {
-    // Set node array for delta interpolation
-    if (m_quadratic_binning) {
-        m_deltas_cache.set_value(std::sqrt(delta));
-    }
-    else {
-        m_deltas_cache.set_value(delta);
-    }
+    // Locate delta node
+    GNodeArray::weights wd = (m_quadratic_binning)
+                             ? m_deltas_cache.locate(std::sqrt(delta))
+                             : m_deltas_cache.locate(delta);
+
+    // Locate energy node
+    GNodeArray::weights we = m_elogmeans.locate(logE);
 
-    // Set node array for energy interpolation
-    m_elogmeans.set_value(logE);
-   
     // Set indices for bi-linear interpolation
-    m_inx1 = offset(m_deltas_cache.inx_left(),  m_elogmeans.inx_left());
-    m_inx2 = offset(m_deltas_cache.inx_left(),  m_elogmeans.inx_right());
-    m_inx3 = offset(m_deltas_cache.inx_right(), m_elogmeans.inx_left());
-    m_inx4 = offset(m_deltas_cache.inx_right(), m_elogmeans.inx_right());
+    inx[0] = offset(wd.inx_left,  we.inx_left);
+    inx[1] = offset(wd.inx_left,  we.inx_right);
+    inx[2] = offset(wd.inx_right, we.inx_left);
+    inx[3] = offset(wd.inx_right, we.inx_right);
 
     // Set weighting factors for bi-linear interpolation
-    m_wgt1 = m_deltas_cache.wgt_left()  * m_elogmeans.wgt_left();
-    m_wgt2 = m_deltas_cache.wgt_left()  * m_elogmeans.wgt_right();
-    m_wgt3 = m_deltas_cache.wgt_right() * m_elogmeans.wgt_left();
-    m_wgt4 = m_deltas_cache.wgt_right() * m_elogmeans.wgt_right();
+    wgt[0] = wd.wgt_left  * we.wgt_left;
+    wgt[1] = wd.wgt_left  * we.wgt_right;
+    wgt[2] = wd.wgt_right * we.wgt_left;
+    wgt[3] = wd.wgt_right * we.wgt_right;
 
     // Return
     return;
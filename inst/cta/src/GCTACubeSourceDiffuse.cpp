@@ -36,6 +36,7 @@
 #include "GEnergy.hpp"
 #include "GTime.hpp"
 #include "GIntegral.hpp"
+#include "GMatrix3.hpp"
 #include "GCTAEventCube.hpp"
 #include "GCTAResponseCube.hpp"
 #include "GCTAResponse_helpers.hpp"
@@ -254,11 +255,14 @@ void GCTACubeSourceDiffuse::set(const std::string&   name,
     // Continue only if livetime is >0
     if (livetime > 0.0)  {
 
+        // Get sky directions of all cube pixels
+        const std::vector<GSkyDir>& obsDirs = cube->map().dirs();
+
         // Loop over all spatial bins
         for (int pixel = 0; pixel < cube->npix(); ++pixel) {
 
             // Get cube pixel sky direction
-            GSkyDir obsDir = cube->map().inx2dir(pixel);
+            const GSkyDir& obsDir = obsDirs[pixel];
 
             // Continue only if model contains that sky direction
             if (spatial->contains(obsDir, delta_max)) {
@@ -369,11 +373,11 @@ double GCTACubeSourceDiffuse::psf(const GCTAResponseCube* rsp,
     // Compute rotation matrix to convert from PSF centred coordinate system
     // spanned by delta and phi into the reference frame of the observed
     // arrival direction given in Right Ascension and Declination.
-    GMatrix ry;
-    GMatrix rz;
+    GMatrix3 ry;
+    GMatrix3 rz;
     ry.eulery(obsDir.dec_deg() - 90.0);
     rz.eulerz(-obsDir.ra_deg());
-    GMatrix rot = (ry * rz).transpose();
+    GMatrix3 rot = (ry * rz).transpose();
 
     // Get offset angle integration interval in radians
     double delta_min = 0.0;
@@ -253,11 +253,14 @@ void GCTACubeSourcePoint::set(const std::string&   name,
 
     } // endfor: looped over energies
 
+    // Get sky directions of all cube pixels
+    const std::vector<GSkyDir>& obsDirs = cube->map().dirs();
+
     // Compute distance map
     for (int i = 0; i < cube->npix(); ++i) {
 
         // Get cube pixel sky direction
-        GSkyDir obsDir = cube->map().inx2dir(i);
+        const GSkyDir& obsDir = obsDirs[i];
 
         // Determine angular distance between point source direction and
         // cube pixel sky direction (radians)
@@ -298,15 +301,15 @@ void GCTACubeSourcePoint::set(const std::string&   name,
  ***************************************************************************/
 double GCTACubeSourcePoint::psf(const int& ieng, const double& delta) const
 {
-    // Set node array interpolation values
-    m_deltas.set_value(delta);
+    // Get node array interpolation values
+    GNodeArray::weights w = m_deltas.locate(delta);
 
     // Compute offset
     int offset = ieng * m_deltas.size();
 
     // Compute PSF by bi-linear interpolation
-    double psf = m_deltas.wgt_left()  * m_psf[offset+m_deltas.inx_left()] +
-                 m_deltas.wgt_right() * m_psf[offset+m_deltas.inx_right()];
+    double psf = w.wgt_left  * m_psf[offset+w.inx_left] +
+                 w.wgt_right * m_psf[offset+w.inx_right];
 
     // Reset negative PSF values
     if (psf < 0.0) {
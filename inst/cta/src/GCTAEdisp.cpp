@@ -130,6 +130,39 @@ GCTAEdisp& GCTAEdisp::operator=(const GCTAEdisp& edisp)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Evaluate energy dispersion for arrays of arguments
+ *
+ * @param[in] num Number of argument sets.
+ * @param[in] logEobs Log10 of the observed photon energies (TeV; array of
+ *            @p num values).
+ * @param[in] logEsrc Log10 of the true photon energies (TeV; array of
+ *            @p num values).
+ * @param[in] theta Offset angles in camera system (radians; array of @p num
+ *            values).
+ * @param[out] edisp Energy dispersion values (array of @p num values).
+ *
+ * Evaluates the energy dispersion for @p num argument sets and writes the
+ * result into the caller provided @p edisp array. The azimuth angle in the
+ * camera system and the zenith and azimuth angles in the Earth system are
+ * set to zero.
+ ***************************************************************************/
+void GCTAEdisp::eval(const int&    num,
+                     const double* logEobs,
+                     const double* logEsrc,
+                     const double* theta,
+                     double*       edisp) const
+{
+    // Evaluate energy dispersion for all argument sets
+    for (int k = 0; k < num; ++k) {
+        edisp[k] = (*this)(logEobs[k], logEsrc[k], theta[k]);
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -47,6 +47,7 @@
 /* __ Debug definitions __________________________________________________ */
 
 /* __ Constants __________________________________________________________ */
+const int batch_size = 64;          //!< Argument sets per table interpolation
 
 
 /*==========================================================================
@@ -483,45 +484,22 @@ GEbounds GCTAEdisp2D::ebounds_obs(const double& logEsrc,
                                   const double& zenith,
                                   const double& azimuth) const
 {
-    // Compute only if parameters changed
-    if (!m_ebounds_obs_computed || theta != m_last_theta_obs) {
-
-        // Set computation flag
-        m_ebounds_obs_computed = true;
-        m_last_theta_obs       = theta;
-
-        // Compute ebounds_obs
-        compute_ebounds_obs(theta, phi, zenith, azimuth);
-
-    }
-
-    // Search index only if logEsrc has changed
-    if (logEsrc != m_last_logEsrc) {
-
-        // Store last log(Esrc)
-        m_last_logEsrc = logEsrc;
-
-        // Find right index with bisection
-        int low  = 0;
-        int high = m_ebounds_obs.size() - 1;
-        while ((high-low) > 1) {
-            int  mid = (low+high) / 2;
-            double e = m_edisp.axis_lo(0, mid);
-            if (logEsrc < std::log10(e)) {
-                high = mid;
-            }
-            else {
-                low = mid;
-            }
+    // Find true energy bin with bisection
+    int low  = 0;
+    int high = m_edisp.axis(0) - 1;
+    while ((high-low) > 1) {
+        int  mid = (low+high) / 2;
+        double e = m_edisp.axis_lo(0, mid);
+        if (logEsrc < std::log10(e)) {
+            high = mid;
+        }
+        else {
+            low = mid;
         }
-
-        // Index found
-        m_index_obs = low;
-
     }
 
     // Return energy boundaries
-    return m_ebounds_obs[m_index_obs];
+    return (compute_ebounds_obs(low, theta));
 }
 
 
@@ -545,45 +523,69 @@ GEbounds GCTAEdisp2D::ebounds_src(const double& logEobs,
                                   const double& zenith,
                                   const double& azimuth) const
 {
-    // Compute only if parameters changed
-    if (!m_ebounds_src_computed || theta != m_last_theta_src) {
+    // Find observed energy bin with bisection
+    int low  = 0;
+    int high = m_edisp.axis(0) - 1;
+    while ((high-low) > 1) {
+        int  mid = (low+high) / 2;
+        double e = m_edisp.axis_lo(0, mid);
+        if (logEobs < std::log10(e)) {
+            high = mid;
+        }
+        else {
+            low = mid;
+        }
+    }
 
-        // Set computation flag
-        m_ebounds_src_computed = true;
-        m_last_theta_src       = theta;
+    // Return energy boundaries
+    return (compute_ebounds_src(low, theta));
+}
 
-        // Compute ebounds_src
-        compute_ebounds_src(theta, phi, zenith, azimuth);
 
-    }
+/***********************************************************************//**
+ * @brief Evaluate energy dispersion for arrays of arguments
+ *
+ * @param[in] num Number of argument sets.
+ * @param[in] logEobs Log10 of the observed photon energies (TeV; array of
+ *            @p num values).
+ * @param[in] logEsrc Log10 of the true photon energies (TeV; array of
+ *            @p num values).
+ * @param[in] theta Offset angles in camera system (radians; array of @p num
+ *            values).
+ * @param[out] edisp Energy dispersion values (array of @p num values).
+ *
+ * Evaluates the energy dispersion for @p num argument sets and writes the
+ * result into the caller provided @p edisp array. The energy migrations
+ * are computed in blocks of argument sets that are then interpolated using
+ * the batch interpolation of the response table. No memory is allocated.
+ ***************************************************************************/
+void GCTAEdisp2D::eval(const int&    num,
+                       const double* logEobs,
+                       const double* logEsrc,
+                       const double* theta,
+                       double*       edisp) const
+{
+    // Allocate energy migrations for one block
+    double migra[batch_size];
 
-    // Search index only if logEobs has changed
-    if (logEobs != m_last_logEobs) {
+    // Loop over blocks of argument sets
+    for (int k0 = 0; k0 < num; k0 += batch_size) {
 
-        // Store observed energy
-        m_last_logEobs = logEobs;
+        // Get number of argument sets in block
+        int n = (num - k0 < batch_size) ? num - k0 : batch_size;
 
-        // Find right index with bisection
-        int low  = 0;
-        int high = m_ebounds_src.size() - 1;
-        while ((high-low) > 1) {
-            int  mid = (low+high) / 2;
-            double e = m_edisp.axis_lo(0, mid);
-            if (logEobs < std::log10(e)) {
-                high = mid;
-            }
-            else {
-                low = mid;
-            }
+        // Compute Eobs/Esrc for all argument sets in block
+        for (int k = 0; k < n; ++k) {
+            migra[k] = std::exp((logEobs[k0+k]-logEsrc[k0+k]) * gammalib::ln10);
         }
 
-        // Index found
-        m_index_src = low;
+        // Interpolate energy dispersion for all argument sets in block
+        m_edisp(0, n, logEsrc+k0, migra, theta+k0, edisp+k0);
 
-    }
+    } // endfor: looped over blocks
 
-    // Return energy boundaries
-    return m_ebounds_src[m_index_src];
+    // Return
+    return;
 }
 
 
@@ -644,19 +646,7 @@ void GCTAEdisp2D::init_members(void)
     // Initialise members
     m_filename.clear();
     m_edisp.clear();
-
-    // Initialise computation cache
-    m_ebounds_obs_computed = false;
-    m_ebounds_src_computed = false;
-    m_last_theta_obs       =  -1.0;
-    m_last_theta_src       =  -1.0;
-    m_last_logEsrc         = -30.0;
-    m_last_logEobs         = -30.0;
-    m_index_obs            =     0;
-    m_index_src            =     0;
-    m_max_edisp            =   0.0;
-    m_ebounds_obs.clear();
-    m_ebounds_src.clear();
+    m_max_edisp = 0.0;
 
     // Return
     return;
@@ -673,19 +663,7 @@ void GCTAEdisp2D::copy_members(const GCTAEdisp2D& edisp)
     // Copy members
     m_filename  = edisp.m_filename;
     m_edisp     = edisp.m_edisp;
-
-    // Copy computation cache
-    m_ebounds_obs_computed = edisp.m_ebounds_obs_computed;
-    m_ebounds_src_computed = edisp.m_ebounds_src_computed;
-    m_last_theta_obs       = edisp.m_last_theta_obs;
-    m_last_theta_src       = edisp.m_last_theta_src;
-    m_last_logEsrc         = edisp.m_last_logEsrc;
-    m_last_logEobs         = edisp.m_last_logEobs;
-    m_index_obs            = edisp.m_index_obs;
-    m_index_src            = edisp.m_index_src;
-    m_max_edisp            = edisp.m_max_edisp;
-    m_ebounds_obs          = edisp.m_ebounds_obs;
-    m_ebounds_src          = edisp.m_ebounds_src;
+    m_max_edisp = edisp.m_max_edisp;
 
     // Return
     return;
@@ -703,177 +681,148 @@ void GCTAEdisp2D::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Compute ebounds_obs vector
+ * @brief Compute observed energy boundaries for a true energy bin
  *
+ * @param[in] isrc True energy bin index.
  * @param[in] theta Offset angle (rad).
- * @param[in] phi Azimuth angle (rad).
- * @param[in] zenith Zenith angle (rad).
- * @param[in] azimuth Azimuth angle (rad).
+ * @return Observed energy boundaries.
  ***************************************************************************/
-void GCTAEdisp2D::compute_ebounds_obs(const double& theta,
-                                      const double& phi,
-                                      const double& zenith,
-                                      const double& azimuth) const
+GEbounds GCTAEdisp2D::compute_ebounds_obs(const int&    isrc,
+                                          const double& theta) const
 {
-    // Clear ebounds_obs vector
-    m_ebounds_obs.clear();
-
     // Set epsilon
     const double eps = 1.0e-12;
 
-    // Loop over Esrc
-    for (int isrc = 0; isrc < m_edisp.axis(0); ++isrc) {
+    // Set Esrc
+    double Esrc    = std::sqrt(m_edisp.axis_hi(0, isrc) *
+                               m_edisp.axis_lo(0, isrc));
+    double logEsrc = std::log10(Esrc);
 
-        // Set Esrc
-        double Esrc    = std::sqrt(m_edisp.axis_hi(0, isrc) *
-                                   m_edisp.axis_lo(0, isrc));
-        double logEsrc = std::log10(Esrc);
+    // Initialise results
+    double logEobsMin = -30.0;
+    double logEobsMax =  10.0;
+    bool   minFound   = false;
+    bool   maxFound   = false;
 
-        // Initialise results
-        double logEobsMin = -30.0;
-        double logEobsMax =  10.0;
-        bool   minFound   = false;
-        bool   maxFound   = false;
+    // Find boundaries, loop over EobsOverEsrc
+    for (int i = 0; i < m_edisp.axis(1); ++i) {
 
-        // Find boundaries, loop over EobsOverEsrc
-        for (int i = 0; i < m_edisp.axis(1); ++i) {
+        // Compute value EobsOverEsrc
+        double EobsOverEsrc = 0.5 * (m_edisp.axis_hi(1, i) +
+                                     m_edisp.axis_lo(1, i));
 
-            // Compute value EobsOverEsrc
-            double EobsOverEsrc = 0.5 * (m_edisp.axis_hi(1, i) +
-                                         m_edisp.axis_lo(1, i));
-
-            // Find first non-negligible matrix term
-            if (!minFound && m_edisp(0, logEsrc, EobsOverEsrc, theta) >= eps) {
-                minFound   = true;
-                logEobsMin = std::log10(EobsOverEsrc * Esrc);
-            }
-
-            // Find last non-negligible matrix term
-            else if (minFound && !maxFound &&
-                     m_edisp(0, logEsrc, EobsOverEsrc, theta) < eps) {
-                maxFound   = true;
-                logEobsMax = std::log10(EobsOverEsrc * Esrc);
-            }
-
-            // Continue searching
-            else if (minFound && maxFound &&
-                     m_edisp(0, logEsrc, EobsOverEsrc, theta) >= eps) {
-                maxFound = false;
-            }
-
-        } // endfor: looped over EobsOverEsrc
+        // Find first non-negligible matrix term
+        if (!minFound && m_edisp(0, logEsrc, EobsOverEsrc, theta) >= eps) {
+            minFound   = true;
+            logEobsMin = std::log10(EobsOverEsrc * Esrc);
+        }
 
+        // Find last non-negligible matrix term
+        else if (minFound && !maxFound &&
+                 m_edisp(0, logEsrc, EobsOverEsrc, theta) < eps) {
+            maxFound   = true;
+            logEobsMax = std::log10(EobsOverEsrc * Esrc);
+        }
 
-        // If energy dispersion has never become negligible until end of loop,
-        // reset logEobsMax
-        if (!maxFound) {
-            logEobsMax = 10.0;
+        // Continue searching
+        else if (minFound && maxFound &&
+                 m_edisp(0, logEsrc, EobsOverEsrc, theta) >= eps) {
+            maxFound = false;
         }
 
-        // Set energy boundaries
-        GEnergy emin;
-        GEnergy emax;
-        emin.log10TeV(logEobsMin);
-        emax.log10TeV(logEobsMax);
+    } // endfor: looped over EobsOverEsrc
 
-        // Add energy boundaries to vector
-        m_ebounds_obs.push_back(GEbounds(emin, emax));
+    // If energy dispersion has never become negligible until end of loop,
+    // reset logEobsMax
+    if (!maxFound) {
+        logEobsMax = 10.0;
+    }
 
-    } // endfor: looped over logEsrc
+    // Set energy boundaries
+    GEnergy emin;
+    GEnergy emax;
+    emin.log10TeV(logEobsMin);
+    emax.log10TeV(logEobsMax);
 
-    // Return
-    return;
+    // Return energy boundaries
+    return (GEbounds(emin, emax));
 }
 
 
 /***********************************************************************//**
- * @brief Compute ebounds_src vector
+ * @brief Compute true energy boundaries for an observed energy bin
  *
+ * @param[in] iobs Observed energy bin index.
  * @param[in] theta Offset angle (rad).
- * @param[in] phi Azimuth angle (rad).
- * @param[in] zenith Zenith angle (rad).
- * @param[in] azimuth Azimuth angle (rad).
+ * @return True energy boundaries.
  ***************************************************************************/
-void GCTAEdisp2D::compute_ebounds_src(const double& theta,
-                                      const double& phi,
-                                      const double& zenith,
-                                      const double& azimuth) const
+GEbounds GCTAEdisp2D::compute_ebounds_src(const int&    iobs,
+                                          const double& theta) const
 {
-    // Clear ebounds_src vector
-    m_ebounds_src.clear();
-
     // Set epsilon
     const double eps = 1.0e-12;
 
-    // Loop over Eobs
-    for (int iobs = 0; iobs < m_edisp.axis(0); ++iobs) {
+    // Set Eobs
+    double Eobs    = std::sqrt(m_edisp.axis_hi(0, iobs) *
+                               m_edisp.axis_lo(0, iobs));
+    double logEobs = std::log10(Eobs);
 
-        // Set Eobs
-        double Eobs    = std::sqrt(m_edisp.axis_hi(0, iobs) *
-                                   m_edisp.axis_lo(0, iobs));
-        double logEobs = std::log10(Eobs);
+    // Initialise results
+    double logEsrcMin = -10.0;
+    double logEsrcMax =  30.0;
+    bool   minFound   = false;
+    bool   maxFound   = false;
 
-        // Initialise results
-        double logEsrcMin = -10.0;
-        double logEsrcMax =  30.0;
-        bool   minFound   = false;
-        bool   maxFound   = false;
-
-        // Find boundaries, loop over Esrc
-        for (int isrc = 0; isrc < m_edisp.axis(0); ++isrc) {
-
-            // Set Esrc
-            double Esrc    = std::sqrt(m_edisp.axis_hi(0, isrc) *
-                                       m_edisp.axis_lo(0, isrc));
-            double logEsrc = std::log10(Esrc);
-
-            // Find first non-negligible matrix term
-            if (!minFound && operator()(logEobs, logEsrc, theta) >= eps) {
-                minFound   = true;
-                logEsrcMin = logEsrc;
-            }
+    // Find boundaries, loop over Esrc
+    for (int isrc = 0; isrc < m_edisp.axis(0); ++isrc) {
 
-            // Find last non-negligible matrix term
-            else if (minFound && !maxFound &&
-                     operator()(logEobs, logEsrc, theta) < eps) {
-                maxFound   = true;
-                logEsrcMax = logEsrc;
-            }
+        // Set Esrc
+        double Esrc    = std::sqrt(m_edisp.axis_hi(0, isrc) *
+                                   m_edisp.axis_lo(0, isrc));
+        double logEsrc = std::log10(Esrc);
 
-            // Continue
-            else if (minFound && maxFound &&
-                     operator()(logEobs, logEsrc, theta) >= eps) {
-                maxFound = false;
-            }
+        // Find first non-negligible matrix term
+        if (!minFound && operator()(logEobs, logEsrc, theta) >= eps) {
+            minFound   = true;
+            logEsrcMin = logEsrc;
+        }
 
-        } // endfor: looped over true energy
+        // Find last non-negligible matrix term
+        else if (minFound && !maxFound &&
+                 operator()(logEobs, logEsrc, theta) < eps) {
+            maxFound   = true;
+            logEsrcMax = logEsrc;
+        }
 
-        // If energy dispersion has never become negligible until end of loop,
-        // reset logEobsMax
-        if (!maxFound) {
-            logEsrcMax = 30.0;
+        // Continue
+        else if (minFound && maxFound &&
+                 operator()(logEobs, logEsrc, theta) >= eps) {
+            maxFound = false;
         }
 
-        // Set energy boundaries
-        GEnergy emin;
-        GEnergy emax;
-        emin.log10TeV(logEsrcMin);
-        emax.log10TeV(logEsrcMax);
+    } // endfor: looped over true energy
 
-        // Add energy boundaries to vector
-        m_ebounds_src.push_back(GEbounds(emin, emax));
+    // If energy dispersion has never become negligible until end of loop,
+    // reset logEsrcMax
+    if (!maxFound) {
+        logEsrcMax = 30.0;
+    }
 
-    } // endfor : loopend over observed energy
+    // Set energy boundaries
+    GEnergy emin;
+    GEnergy emax;
+    emin.log10TeV(logEsrcMin);
+    emax.log10TeV(logEsrcMax);
 
-    // Return
-    return;
+    // Return energy boundaries
+    return (GEbounds(emin, emax));
 }
 
 
 /***********************************************************************//**
  * @brief Set maximum energy dispersion value
  ***************************************************************************/
-void GCTAEdisp2D::set_max_edisp(void) const
+void GCTAEdisp2D::set_max_edisp(void)
 {
     // Initialise maximum
     m_max_edisp = 0.0;
@@ -184,12 +184,12 @@ double GCTAEdispPerfTable::operator()(const double& logEobs,
                                       const double& zenith,
                                       const double& azimuth) const
 {
-    // Update the parameter cache
-    update(logEsrc);
+    // Compute Gaussian parameters
+    gaussian pars = update(logEsrc);
 
     // Compute energy dispersion value
     double delta = logEobs - logEsrc;
-    double edisp = m_par_scale * std::exp(m_par_width * delta * delta);
+    double edisp = pars.scale * std::exp(pars.width * delta * delta);
 
     // Return energy dispersion
     return edisp;
@@ -323,7 +323,7 @@ void GCTAEdispPerfTable::load(const std::string& filename)
  * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
  *
  * Draws observed energy value from a normal distribution of width
- * m_par_sigma around @p logE.
+ * pars.sigma around @p logE.
  ***************************************************************************/
 GEnergy GCTAEdispPerfTable::mc(GRan&         ran,
                                const double& logEsrc,
@@ -332,11 +332,11 @@ GEnergy GCTAEdispPerfTable::mc(GRan&         ran,
                                const double& zenith,
                                const double& azimuth) const
 {
-    // Update the parameter cache
-    update(logEsrc);
+    // Compute Gaussian parameters
+    gaussian pars = update(logEsrc);
 
     // Draw log observed energy in TeV
-    double logEobs = m_par_sigma * ran.normal() + logEsrc;
+    double logEobs = pars.sigma * ran.normal() + logEsrc;
 
     // Set energy
     GEnergy energy;
@@ -480,10 +480,6 @@ void GCTAEdispPerfTable::init_members(void)
     m_filename.clear();
     m_logE.clear();
     m_sigma.clear();
-    m_par_logE  = -1.0e30;
-    m_par_scale = 1.0;
-    m_par_sigma = 0.0;
-    m_par_width = 0.0;
 
     // Return
     return;
@@ -501,10 +497,6 @@ void GCTAEdispPerfTable::copy_members(const GCTAEdispPerfTable& edisp)
     m_filename  = edisp.m_filename;
     m_logE      = edisp.m_logE;
     m_sigma     = edisp.m_sigma;
-    m_par_logE  = edisp.m_par_logE;
-    m_par_scale = edisp.m_par_scale;
-    m_par_sigma = edisp.m_par_sigma;
-    m_par_width = edisp.m_par_width;
 
     // Return
     return;
@@ -522,29 +514,26 @@ void GCTAEdispPerfTable::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update energy dispersion parameter cache
+ * @brief Compute Gaussian parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
+ * @return Gaussian parameters.
  *
- * This method updates the energy dispersion parameter cache.
- * As the performance table energy dispersion only depends on energy,
- * the only parameter on which the cache values depend is the energy.
+ * Interpolates the Gaussian sigma at the specified energy and derives the
+ * Gaussian normalization and width parameter. The parameters are not
+ * cached, hence the energy dispersion may be evaluated concurrently from
+ * several threads.
  ***************************************************************************/
-void GCTAEdispPerfTable::update(const double& logE) const
+GCTAEdispPerfTable::gaussian GCTAEdispPerfTable::update(const double& logE) const
 {
-    // Only compute energy dispersion parameters if arguments have changed
-    if (logE != m_par_logE) {
+    // Initialise Gaussian parameters
+    gaussian pars;
 
-        // Save energy
-        m_par_logE = logE;
+    // Determine Gaussian sigma and pre-compute Gaussian parameters
+    pars.sigma = m_logE.interpolate(logE, m_sigma);
+    pars.scale = gammalib::inv_sqrt2pi / pars.sigma;
+    pars.width = -0.5 / (pars.sigma * pars.sigma);
 
-        // Determine Gaussian sigma and pre-compute Gaussian parameters
-        m_par_sigma = m_logE.interpolate(logE, m_sigma);
-        m_par_scale = gammalib::inv_sqrt2pi / m_par_sigma;
-        m_par_width = -0.5 / (m_par_sigma * m_par_sigma);
-
-    }
-
-    // Return
-    return;
+    // Return Gaussian parameters
+    return pars;
 }
@@ -174,14 +174,20 @@ double GCTAEdispRmf::operator()(const double& logEobs,
                                 const double& zenith,
                                 const double& azimuth) const
 {
-    // Update indexes and weighting factors for interpolation
-    update(logEobs, logEsrc);
+    // Get indices and weighting factors for bi-linear interpolation
+    GNodeArray::weights wtrue = m_etrue.locate(logEsrc);
+    GNodeArray::weights wmeas = m_emeasured.locate(logEobs);
 
     // Perform interpolation
-    double edisp =  m_wgt1 * m_matrix(m_itrue1, m_imeas1) +
-                    m_wgt2 * m_matrix(m_itrue1, m_imeas2) +
-                    m_wgt3 * m_matrix(m_itrue2, m_imeas1) +
-                    m_wgt4 * m_matrix(m_itrue2, m_imeas2);
+    double edisp =
+        wtrue.wgt_left  * wmeas.wgt_left  *
+                          m_matrix(wtrue.inx_left,  wmeas.inx_left)  +
+        wtrue.wgt_left  * wmeas.wgt_right *
+                          m_matrix(wtrue.inx_left,  wmeas.inx_right) +
+        wtrue.wgt_right * wmeas.wgt_left  *
+                          m_matrix(wtrue.inx_right, wmeas.inx_left)  +
+        wtrue.wgt_right * wmeas.wgt_right *
+                          m_matrix(wtrue.inx_right, wmeas.inx_right);
 
     // Return energy dispersion
     return edisp;
@@ -318,45 +324,22 @@ GEbounds GCTAEdispRmf::ebounds_obs(const double& logEsrc,
                                    const double& zenith,
                                    const double& azimuth) const
 {
-    // Compute only if parameters changed
-    if (!m_ebounds_obs_computed || theta != m_last_theta_obs) {
-
-        // Store last theta value
-        m_ebounds_obs_computed = true;
-        m_last_theta_obs       = theta;
-
-        // Compute ebounds_obs
-        compute_ebounds_obs(theta, phi, zenith, azimuth);
-
-    }
-
-    // Search index only if logEsrc has changed
-    if (logEsrc != m_last_logEsrc) {
-
-        // Store last photon energy
-        m_last_logEsrc = logEsrc;
-
-        // Find right index with bisection
-        int low  = 0;
-        int high = m_ebounds_obs.size() - 1;
-        while ((high-low) > 1) {
-            int  mid = (low+high) / 2;
-            double e = m_rmf.etrue().emin(mid).log10TeV();
-            if (logEsrc < e) {
-                high = mid;
-            }
-            else {
-                low = mid;
-            }
+    // Find true energy bin with bisection
+    int low  = 0;
+    int high = m_ebounds_obs.size() - 1;
+    while ((high-low) > 1) {
+        int  mid = (low+high) / 2;
+        double e = m_rmf.etrue().emin(mid).log10TeV();
+        if (logEsrc < e) {
+            high = mid;
+        }
+        else {
+            low = mid;
         }
-
-        // Index found
-        m_index_obs = low;
-
     }
 
     // Return energy boundaries
-    return (m_ebounds_obs[m_index_obs]);
+    return (m_ebounds_obs[low]);
 }
 
 
@@ -378,45 +361,22 @@ GEbounds GCTAEdispRmf::ebounds_src(const double& logEobs,
                                    const double& zenith,
                                    const double& azimuth) const
 {
-    // Compute only if parameters changed
-    if (!m_ebounds_src_computed || theta != m_last_theta_src) {
-
-        // Store last value
-        m_ebounds_src_computed = true;
-        m_last_theta_src       = theta;
-
-        // Compute ebounds_obs
-        compute_ebounds_src(theta, phi, zenith, azimuth);
-
-    }
-
-    // Search index only if logEobs has changed
-    if (logEobs != m_last_logEobs) {
-
-        // Store last value
-        m_last_logEobs = logEobs;
-
-        // Find right index with bisection
-        int low  = 0;
-        int high = m_ebounds_src.size() - 1;
-        while ((high-low) > 1) {
-            int  mid = (low+high) / 2;
-            double e = m_rmf.emeasured().emin(mid).log10TeV();
-            if (logEobs < e) {
-                high = mid;
-            }
-            else {
-                low = mid;
-            }
+    // Find observed energy bin with bisection
+    int low  = 0;
+    int high = m_ebounds_src.size() - 1;
+    while ((high-low) > 1) {
+        int  mid = (low+high) / 2;
+        double e = m_rmf.emeasured().emin(mid).log10TeV();
+        if (logEobs < e) {
+            high = mid;
+        }
+        else {
+            low = mid;
         }
-
-        // Index found
-        m_index_src = low;
-
     }
 
     // Return energy boundaries
-    return (m_ebounds_src[m_index_src]);
+    return (m_ebounds_src[low]);
 }
 
 
@@ -476,30 +436,9 @@ void GCTAEdispRmf::init_members(void)
     m_rmf.clear();
     m_matrix.clear();
 
-    // Initialise interpolation cache
     m_etrue.clear();
     m_emeasured.clear();
-    m_last_etrue     = 9999.0;
-    m_last_emeasured = 9999.0;
-    m_itrue1         = 0;
-    m_itrue2         = 0;
-    m_imeas1         = 0;
-    m_imeas2         = 0;
-    m_wgt1           = 0.0;
-    m_wgt2           = 0.0;
-    m_wgt3           = 0.0;
-    m_wgt4           = 0.0;
-
-    // Initialise Monte Carlo cache
-    m_max_edisp            = 0.0;
-    m_last_theta_obs       = -1.0;
-    m_last_theta_src       = -1.0;
-    m_last_logEsrc         = -30.0;
-    m_last_logEobs         = -30.0;
-    m_index_obs            = 0;
-    m_index_src            = 0;
-    m_ebounds_obs_computed = false;
-    m_ebounds_src_computed = false;
+    m_max_edisp = 0.0;
     m_ebounds_obs.clear();
     m_ebounds_src.clear();
 
@@ -520,32 +459,11 @@ void GCTAEdispRmf::copy_members(const GCTAEdispRmf& edisp)
     m_rmf      = edisp.m_rmf;
     m_matrix   = edisp.m_matrix;
 
-    // Copy interpolation cache
-    m_etrue          = edisp.m_etrue;
-    m_emeasured      = edisp.m_emeasured;
-    m_last_etrue     = edisp.m_last_etrue;
-    m_last_emeasured = edisp.m_last_emeasured;
-    m_itrue1         = edisp.m_itrue1;
-    m_itrue2         = edisp.m_itrue2;
-    m_imeas1         = edisp.m_imeas1;
-    m_imeas2         = edisp.m_imeas2;
-    m_wgt1           = edisp.m_wgt1;
-    m_wgt2           = edisp.m_wgt2;
-    m_wgt3           = edisp.m_wgt3;
-    m_wgt4           = edisp.m_wgt4;
-
-    // Copy Monte Carlo cache
-    m_max_edisp            = edisp.m_max_edisp;
-    m_last_theta_obs       = edisp.m_last_theta_obs;
-    m_last_theta_src       = edisp.m_last_theta_src;
-    m_last_logEsrc         = edisp.m_last_logEsrc;
-    m_last_logEobs         = edisp.m_last_logEobs;
-    m_index_obs            = edisp.m_index_obs;
-    m_index_src            = edisp.m_index_src;
-    m_ebounds_obs_computed = edisp.m_ebounds_obs_computed;
-    m_ebounds_src_computed = edisp.m_ebounds_src_computed;
-    m_ebounds_obs          = edisp.m_ebounds_obs;
-    m_ebounds_src          = edisp.m_ebounds_src;
+    m_etrue       = edisp.m_etrue;
+    m_emeasured   = edisp.m_emeasured;
+    m_max_edisp   = edisp.m_max_edisp;
+    m_ebounds_obs = edisp.m_ebounds_obs;
+    m_ebounds_src = edisp.m_ebounds_src;
 
     // Return
     return;
@@ -637,24 +555,37 @@ void GCTAEdispRmf::set_matrix(void)
 
 
 /***********************************************************************//**
- * @brief Set interpolation cache
+ * @brief Set interpolation and energy boundary tables
  *
- * Sets the interpolation cache.
+ * Sets the node arrays used for interpolation and the observed and true
+ * energy boundaries for all true and observed energy bins. The tables are
+ * filled once when the RMF is loaded so that the energy dispersion can be
+ * evaluated concurrently from several threads.
  ***************************************************************************/
-void GCTAEdispRmf::set_cache(void) const
+void GCTAEdispRmf::set_cache(void)
 {
-    // Clear node arrays
+    // Clear tables
     m_etrue.clear();
     m_emeasured.clear();
+    m_ebounds_obs.clear();
+    m_ebounds_src.clear();
 
-    // Set log10(Etrue) nodes
+    // Set log10(Etrue) nodes and observed energy boundaries
     for (int i = 0; i < m_rmf.ntrue(); ++i) {
-        m_etrue.append(m_rmf.etrue().elogmean(i).log10TeV());
+        double logEsrc = m_rmf.etrue().elogmean(i).log10TeV();
+        GEnergy etrue;
+        etrue.log10TeV(logEsrc);
+        m_etrue.append(logEsrc);
+        m_ebounds_obs.push_back(m_rmf.emeasured(etrue));
     }
 
-    // Set log10(Emeasured) nodes
+    // Set log10(Emeasured) nodes and true energy boundaries
     for (int i = 0; i < m_rmf.nmeasured(); ++i) {
-        m_emeasured.append(m_rmf.emeasured().elogmean(i).log10TeV());
+        double logEobs = m_rmf.emeasured().elogmean(i).log10TeV();
+        GEnergy emeasured;
+        emeasured.log10TeV(logEobs);
+        m_emeasured.append(logEobs);
+        m_ebounds_src.push_back(m_rmf.emeasured(emeasured));
     }
 
     // Return
@@ -665,7 +596,7 @@ void GCTAEdispRmf::set_cache(void) const
 /***********************************************************************//**
  * @brief Set maximum energy dispersion value
  ***************************************************************************/
-void GCTAEdispRmf::set_max_edisp(void) const
+void GCTAEdispRmf::set_max_edisp(void)
 {
     // Initialise maximum
     m_max_edisp = 0.0;
@@ -685,114 +616,6 @@ void GCTAEdispRmf::set_max_edisp(void) const
 }
 
 
-/***********************************************************************//**
- * @brief Update cache
- *
- * @param[in] etrue True energy.
- * @param[in] emeasured Measured energy.
- *
- * Updates the interpolation cache. The interpolation cache is composed
- * of four indices and weights that define 4 data values of the RMF matrix
- * that are used for bilinear interpolation.
- ***************************************************************************/
-void GCTAEdispRmf::update(const double& etrue, const double& emeasured) const
-{
-    // Update cache only of arguments have changed
-    if (etrue != m_last_etrue || emeasured != m_last_emeasured) {
-
-        // Store actual values
-        m_last_etrue     = etrue;
-        m_last_emeasured = emeasured;
-
-        // Set values for node arrays
-        m_etrue.set_value(etrue);
-        m_emeasured.set_value(emeasured);
-
-        // Set indices for bi-linear interpolation
-        m_itrue1 = m_etrue.inx_left();
-        m_itrue2 = m_etrue.inx_right();
-        m_imeas1 = m_emeasured.inx_left();
-        m_imeas2 = m_emeasured.inx_right();
-
-        // Set weighting factors for bi-linear interpolation
-        m_wgt1 = m_etrue.wgt_left()  * m_emeasured.wgt_left();
-        m_wgt2 = m_etrue.wgt_left()  * m_emeasured.wgt_right();
-        m_wgt3 = m_etrue.wgt_right() * m_emeasured.wgt_left();
-        m_wgt4 = m_etrue.wgt_right() * m_emeasured.wgt_right();
-
-    } // endif: update requested
-
-    // Return
-    return;
-}
-
-
-/***********************************************************************//**
- * @brief Compute ebounds_obs vector
- *
- * @param[in] theta Offset angle in camera system (rad). Not used.
- * @param[in] phi Azimuth angle in camera system (rad). Not used.
- * @param[in] zenith Zenith angle in Earth system (rad). Not used.
- * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
- ***************************************************************************/
-void GCTAEdispRmf::compute_ebounds_obs(const double& theta,
-                                       const double& phi,
-                                       const double& zenith,
-                                       const double& azimuth) const
-{
-    // Loop over Etrue
-    for (int i = 0; i < m_rmf.ntrue(); ++i) {
-
-        // Get true photon energy
-        double logEsrc = m_rmf.etrue().elogmean(i).log10TeV();
-
-        // Set true energy
-        GEnergy etrue;
-        etrue.log10TeV(logEsrc);
-
-        // Add ebounds to vector
-        m_ebounds_obs.push_back(m_rmf.emeasured(etrue));
-
-    } // endfor: looped over true photon energies
-
-    // Return
-    return;
-}
-
-
-/***********************************************************************//**
- * @brief Compute ebounds_src vector
- *
- * @param[in] theta Offset angle in camera system (rad). Not used.
- * @param[in] phi Azimuth angle in camera system (rad). Not used.
- * @param[in] zenith Zenith angle in Earth system (rad). Not used.
- * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
- ***************************************************************************/
-void GCTAEdispRmf::compute_ebounds_src(const double& theta,
-                                       const double& phi,
-                                       const double& zenith,
-                                       const double& azimuth) const
-{
-    // Loop over Eobs
-    for (int i = 0; i < m_rmf.nmeasured(); ++i) {
-
-        // Get observed photon energy
-        double logEobs = m_rmf.emeasured().elogmean(i).log10TeV();
-
-        // Set measured energy
-        GEnergy emeasured;
-        emeasured.log10TeV(logEobs);
-
-        // Add ebounds to vector
-        m_ebounds_src.push_back(m_rmf.emeasured(emeasured));
-
-    } // endfor: looped over measured photon energies
-
-    // Return
-    return;
-}
-
-
 /***********************************************************************//**
  * @brief Integration kernel for edisp_kern() class
  *
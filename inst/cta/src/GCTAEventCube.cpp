@@ -39,7 +39,8 @@
 #define G_SET_DIRECTIONS                    "GCTAEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GCTAEventCube::set_energies()"
 #define G_SET_TIME                                "GCTAEventCube::set_time()"
-#define G_SET_BIN                              "GCTAEventCube::set_bin(int&)"
+#define G_BIN                          "GCTAEventCube::bin(int&, GEventBin*)"
+#define G_SET_BIN               "GCTAEventCube::set_bin(int&, GCTAEventBin*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -200,7 +201,7 @@ GCTAEventCube& GCTAEventCube::operator=(const GCTAEventCube& cube)
 GCTAEventBin* GCTAEventCube::operator[](const int& index)
 {
     // Set event bin
-    set_bin(index);
+    set_bin(index, &m_bin);
 
     // Return pointer
     return (&m_bin);
@@ -217,7 +218,7 @@ GCTAEventBin* GCTAEventCube::operator[](const int& index)
 const GCTAEventBin* GCTAEventCube::operator[](const int& index) const
 {
     // Set event bin (circumvent const correctness)
-    (const_cast<GCTAEventCube*>(this))->set_bin(index);
+    set_bin(index, const_cast<GCTAEventBin*>(&m_bin));
 
     // Return pointer
     return (&m_bin);
@@ -487,6 +488,54 @@ const GEnergy& GCTAEventCube::energy(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Allocate event bin view
+ *
+ * @return Pointer to event bin view.
+ *
+ * Allocates an event bin view that can be passed to the bin() method. The
+ * caller is responsible for deleting the view.
+ ***************************************************************************/
+GCTAEventBin* GCTAEventCube::bin_view(void) const
+{
+    // Return
+    return (new GCTAEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin for concurrent access
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin view allocated by bin_view().
+ * @return Pointer to event bin view.
+ *
+ * @exception GException::invalid_argument
+ *            Event bin view is not a CTA event bin.
+ *
+ * Sets up the pointers of the event bin @p view so that it refers to the
+ * bin with the specified @p index. Contrary to the bin access operator the
+ * event cube is not modified, hence several threads may access the bins
+ * concurrently as long as each thread uses its own @p view.
+ ***************************************************************************/
+const GCTAEventBin* GCTAEventCube::bin(const int& index, GEventBin* view) const
+{
+    // Get CTA event bin view
+    GCTAEventBin* bin = dynamic_cast<GCTAEventBin*>(view);
+    if (bin == NULL) {
+        std::string msg = "Event bin view is not a CTA event bin. Please "
+                          "allocate the view using the bin_view() method.";
+        throw GException::invalid_argument(G_BIN, msg);
+    }
+
+    // Set event bin view
+    set_bin(index, bin);
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Print event cube information
  *
@@ -678,11 +727,16 @@ void GCTAEventCube::read_gti(const GFitsTable& hdu)
  * while solid angles are stored in units of sr in an array of double
  * precision variables.
  *
+ * The sky directions of all pixels are computed by a single vector
+ * transformation of the sky projection.
+ *
  * A kluge has been introduced that handles invalid pixels. Invalid pixels
  * may occur if a Hammer-Aitoff projection is used. In this case, pixels may
  * lie outside the valid sky region. As invalid pixels lead to exceptions
- * in the WCS classes, we simply need to catch the exceptions here. Invalid
- * pixels are signaled by setting the solid angle of the pixel to 0.
+ * in the WCS classes, we simply need to catch the exceptions here. If the
+ * vector transformation fails, the sky directions are computed pixel by
+ * pixel. Invalid pixels are signaled by setting the solid angle of the
+ * pixel to 0.
  ***************************************************************************/
 void GCTAEventCube::set_directions(void)
 {
@@ -700,18 +754,40 @@ void GCTAEventCube::set_directions(void)
     m_dirs.reserve(npix());
     m_solidangle.reserve(npix());
 
-    // Set pixel directions and solid angles
+    // Set sky map pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(npix());
     for (int iy = 0; iy < ny(); ++iy) {
         for (int ix = 0; ix < nx(); ++ix) {
-            try {
-                GSkyPixel pixel = GSkyPixel(double(ix), double(iy));
-                m_dirs.push_back(GCTAInstDir(m_map.pix2dir(pixel)));
-                m_solidangle.push_back(m_map.solidangle(pixel));
+            pixels.push_back(GSkyPixel(double(ix), double(iy)));
+        }
+    }
+
+    // Compute sky directions of all pixels at once. If some pixels are
+    // invalid the sky directions are computed pixel by pixel below
+    std::vector<GSkyDir> dirs;
+    try {
+        dirs = m_map.projection()->pix2dir(pixels);
+    }
+    catch (GException::wcs_invalid_x_y& e) {
+        dirs.clear();
+    }
+
+    // Set pixel directions and solid angles
+    int npixels = pixels.size();
+    for (int i = 0; i < npixels; ++i) {
+        try {
+            if (dirs.empty()) {
+                m_dirs.push_back(GCTAInstDir(m_map.pix2dir(pixels[i])));
             }
-            catch (GException::wcs_invalid_x_y& e) {
-                m_dirs.push_back(GCTAInstDir());
-                m_solidangle.push_back(0.0);
+            else {
+                m_dirs.push_back(GCTAInstDir(dirs[i]));
             }
+            m_solidangle.push_back(m_map.solidangle(pixels[i]));
+        }
+        catch (GException::wcs_invalid_x_y& e) {
+            m_dirs.push_back(GCTAInstDir());
+            m_solidangle.push_back(0.0);
         }
     }
 
@@ -797,6 +873,7 @@ void GCTAEventCube::set_times(void)
  * @brief Set event bin
  *
  * @param[in] index Event index [0,...,size()-1].
+ * @param[in] bin Event bin.
  *
  * @exception GException::out_of_range
  *            Event index is outside valid range.
@@ -805,13 +882,14 @@ void GCTAEventCube::set_times(void)
  * @exception GCTAException::no_dirs
  *            Sky directions and solid angles vectors have not been set up.
  *
- * This method provides the event attributes to the event bin. The event bin
- * is in fact physically stored in the event cube, and only a single event
- * bin is indeed allocated. This method sets up the pointers in the event
- * bin so that a client can easily access the information of individual bins
- * as if they were stored in an array.
+ * This method provides the event attributes to the event @p bin. The event
+ * bin is in fact physically stored in the event cube. This method sets up
+ * the pointers in the event @p bin so that a client can easily access the
+ * information of individual bins as if they were stored in an array. The
+ * event cube is not modified, hence the method may be called concurrently
+ * for different event bins.
  ***************************************************************************/
-void GCTAEventCube::set_bin(const int& index)
+void GCTAEventCube::set_bin(const int& index, GCTAEventBin* bin) const
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -831,17 +909,17 @@ void GCTAEventCube::set_bin(const int& index)
     }
 
     // Set pixel and energy bin indices.
-    m_bin.m_ipix = index % npix();
-    m_bin.m_ieng = index / npix();
+    bin->m_ipix = index % npix();
+    bin->m_ieng = index / npix();
 
     // Set pointers
-    m_bin.m_counts     = const_cast<double*>(&(m_map.pixels()[index]));
-    m_bin.m_energy     = &(m_energies[m_bin.m_ieng]);
-    m_bin.m_time       = &m_time;
-    m_bin.m_dir        = &(m_dirs[m_bin.m_ipix]);
-    m_bin.m_solidangle = &(m_solidangle[m_bin.m_ipix]);
-    m_bin.m_ewidth     = &(m_ewidth[m_bin.m_ieng]);
-    m_bin.m_ontime     = &m_ontime;
+    bin->m_counts     = const_cast<double*>(&(m_map.pixels()[index]));
+    bin->m_energy     = const_cast<GEnergy*>(&(m_energies[bin->m_ieng]));
+    bin->m_time       = const_cast<GTime*>(&m_time);
+    bin->m_dir        = const_cast<GCTAInstDir*>(&(m_dirs[bin->m_ipix]));
+    bin->m_solidangle = const_cast<double*>(&(m_solidangle[bin->m_ipix]));
+    bin->m_ewidth     = const_cast<GEnergy*>(&(m_ewidth[bin->m_ieng]));
+    bin->m_ontime     = const_cast<double*>(&m_ontime);
 
     // Return
     return;
@@ -38,19 +38,26 @@
 #include "GFitsTableFloatCol.hpp"
 #include "GFitsTableDoubleCol.hpp"
 #include "GFitsTableULongCol.hpp"
+#include "GFitsTableLongCol.hpp"
 #include "GFitsTableShortCol.hpp"
 #include "GFitsTableStringCol.hpp"
 #include "GTime.hpp"
 #include "GTimeReference.hpp"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 /* __ Method name definitions ____________________________________________ */
 #define G_OPERATOR                          "GCTAEventList::operator[](int&)"
 #define G_ROI                                     "GCTAEventList::roi(GRoi&)"
+#define G_ATOM                       "GCTAEventList::atom(int&, GEventAtom*)"
+#define G_READ_DEFERRED                  "GCTAEventList::read_deferred()"
 #define G_READ_DS_EBOUNDS         "GCTAEventList::read_ds_ebounds(GFitsHDU*)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_IRF_CACHE_MAX_MEMORY 1024.0 //!< Default IRF cache limit (Mbytes)
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -169,7 +176,10 @@ GCTAEventList& GCTAEventList::operator=(const GCTAEventList& list)
  * @exception GException::out_of_range
  *            Event index outside valid range.
  *
- * Returns pointer to an event atom.
+ * Returns pointer to the event atom view of the event with the specified
+ * @p index. The view is built when the event is accessed for the first
+ * time and remains valid until the events are cleared. Modifications of
+ * the event atom are written back into the event list.
  ***************************************************************************/
 GCTAEventAtom* GCTAEventList::operator[](const int& index)
 {
@@ -180,8 +190,19 @@ GCTAEventAtom* GCTAEventList::operator[](const int& index)
     }
     #endif
 
+    // Build event atom view if the event is accessed for the first time
+    std::map<int,GCTAEventAtom*>::iterator it = m_atoms.find(index);
+    if (it == m_atoms.end()) {
+        GCTAEventAtom* atom = new GCTAEventAtom;
+        set_atom(index, atom);
+        it = m_atoms.insert(std::make_pair(index, atom)).first;
+    }
+
+    // Signal that the event atom views may be modified
+    m_atoms_dirty = true;
+
     // Return pointer
-    return (&(m_events[index]));
+    return (it->second);
 }
 
 
@@ -193,7 +214,9 @@ GCTAEventAtom* GCTAEventList::operator[](const int& index)
  * @exception GException::out_of_range
  *            Event index outside valid range.
  *
- * Returns pointer to an event atom.
+ * Returns pointer to the event atom view of the event with the specified
+ * @p index. The view is built when the event is accessed for the first
+ * time and remains valid until the events are cleared.
  ***************************************************************************/
 const GCTAEventAtom* GCTAEventList::operator[](const int& index) const
 {
@@ -204,8 +227,16 @@ const GCTAEventAtom* GCTAEventList::operator[](const int& index) const
     }
     #endif
 
+    // Build event atom view if the event is accessed for the first time
+    std::map<int,GCTAEventAtom*>::iterator it = m_atoms.find(index);
+    if (it == m_atoms.end()) {
+        GCTAEventAtom* atom = new GCTAEventAtom;
+        set_atom(index, atom);
+        it = m_atoms.insert(std::make_pair(index, atom)).first;
+    }
+
     // Return pointer
-    return (&(m_events[index]));
+    return (it->second);
 }
 
 
@@ -263,8 +294,10 @@ GCTAEventList* GCTAEventList::clone(void) const
  ***************************************************************************/
 void GCTAEventList::load(const std::string& filename)
 {
-    // Clear object
+    // Clear object, keeping the memory mapping setting
+    bool use_mmap = m_use_mmap;
     clear();
+    m_use_mmap = use_mmap;
 
     // Open FITS file
     GFits file(filename);
@@ -322,13 +355,19 @@ void GCTAEventList::save(const std::string& filename,
  * The method clears the object before reading, thus any information residing
  * in the event list prior to reading will be lost.
  *
+ * If the FITS object was opened from a file, the shower parameters, the
+ * Hillas parameters and the pulse phase are only read from that file when
+ * an event is accessed for the first time.
+ *
  * @todo Ultimately, any events file should have a GTI extension, hence the
  *       extraction of GTIs from TSTART and TSTOP should not be necessary.
  ***************************************************************************/
 void GCTAEventList::read(const GFits& fits)
 {
-    // Clear object
+    // Clear object, keeping the memory mapping setting
+    bool use_mmap = m_use_mmap;
     clear();
+    m_use_mmap = use_mmap;
 
     // Get event list HDU
     const GFitsTable& events = *fits.table("EVENTS");
@@ -365,6 +404,18 @@ void GCTAEventList::read(const GFits& fits)
     // Load event data
     read_events(events);
 
+    // Read the optional columns now, or defer reading them until an event
+    // is accessed if the events can be read again from the event file
+    if (size() > 0) {
+        if (gammalib::file_exists(fits.filename())) {
+            m_filename = fits.filename();
+            m_deferred = 1;
+        }
+        else {
+            read_events_optional(events);
+        }
+    }
+
     // Read region of interest from data selection keyword
     m_roi = gammalib::read_ds_roi(events);
 
@@ -516,17 +567,26 @@ std::string GCTAEventList::print(const GChatter& chatter) const
 
         // EXPLICIT: Append IRF cache
         if (chatter >= EXPLICIT) {
+            result.append("\n"+gammalib::parformat("IRF cache memory"));
+            result.append(gammalib::str(irf_cache_memory())+" Mbytes (limit ");
+            result.append(gammalib::str(m_irf_max_memory/1048576.0)+" Mbytes)");
             for (int i = 0; i < m_irf_names.size(); ++i) {
                 result.append("\n"+gammalib::parformat("IRF cache " +
                               gammalib::str(i)));
                 result.append(m_irf_names[i]+" = ");
-                int num   = 0;
-                for (int k = 0; k < size(); ++k) {
-                    if ((m_irf_values[i])[k] != -1.0) {
-                        num++;
+                int num = 0;
+                if (m_irf_values[i] != NULL) {
+                    int nvalues = m_irf_values[i]->size();
+                    for (int k = 0; k < nvalues; ++k) {
+                        if ((*m_irf_values[i])[k] != -1.0) {
+                            num++;
+                        }
                     }
+                    result.append(gammalib::str(num)+" values");
+                }
+                else {
+                    result.append("evicted");
                 }
-                result.append(gammalib::str(num)+" values");
             }
         } // endif: chatter was explicit
 
@@ -537,21 +597,94 @@ std::string GCTAEventList::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Allocate event atom view
+ *
+ * @return Pointer to event atom view.
+ *
+ * Allocates an event atom view that can be passed to the atom() method. The
+ * caller is responsible for deleting the view.
+ ***************************************************************************/
+GCTAEventAtom* GCTAEventList::atom_view(void) const
+{
+    // Return
+    return (new GCTAEventAtom);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event atom for concurrent access
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event atom view allocated by atom_view().
+ * @return Pointer to event atom view.
+ *
+ * @exception GException::out_of_range
+ *            Event index outside valid range.
+ * @exception GException::invalid_argument
+ *            Event atom view is not a CTA event atom.
+ *
+ * Fills the event atom @p view with the event of the specified @p index.
+ * Contrary to the atom access operators the event list is not modified,
+ * hence several threads may access the events concurrently as long as each
+ * thread uses its own @p view. If the event has been modified through the
+ * non-const atom access operator, the modified event is returned.
+ ***************************************************************************/
+const GCTAEventAtom* GCTAEventList::atom(const int& index,
+                                         GEventAtom* view) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_ATOM, index, 0, size()-1);
+    }
+    #endif
+
+    // Get CTA event atom view
+    GCTAEventAtom* atom = dynamic_cast<GCTAEventAtom*>(view);
+    if (atom == NULL) {
+        std::string msg = "Event atom view is not a CTA event atom. Please "
+                          "allocate the view using the atom_view() method.";
+        throw GException::invalid_argument(G_ATOM, msg);
+    }
+
+    // Fill event atom view, either from the event atom view of the access
+    // operator, which may have been modified, or from the event columns
+    bool filled = false;
+    if (m_atoms_dirty) {
+        std::map<int,GCTAEventAtom*>::const_iterator it = m_atoms.find(index);
+        if (it != m_atoms.end()) {
+            *atom         = *(it->second);
+            atom->m_index = index;
+            filled        = true;
+        }
+    }
+    if (!filled) {
+        set_atom(index, atom);
+    }
+
+    // Return pointer
+    return atom;
+}
+
+
 /***********************************************************************//**
  * @brief Append event atom to event list
  *
  * @param[in] event Event.
  *
- * Appends an event atom to the event list.
+ * Appends an event atom to the event list. Optional columns are allocated
+ * if the event atom contains shower parameters, Hillas parameters or a
+ * pulse phase that are not yet stored in the event list.
  ***************************************************************************/
 void GCTAEventList::append(const GCTAEventAtom& event)
 {
-    // Append event
-    m_events.push_back(event);
+    // Add one row to all columns
+    int index = size();
+    resize_events(index+1);
 
-    // Set event index
-    int index = m_events.size()-1;
-    m_events[index].m_index = index;
+    // Store event
+    write_atom(index, event);
 
     // Return
     return;
@@ -569,14 +702,31 @@ void GCTAEventList::append(const GCTAEventAtom& event)
  ***************************************************************************/
 void GCTAEventList::init_members(void)
 {
-    // Initialise members
-    m_roi.clear();
-    m_events.clear();
-    m_has_phase = false;
-
-    // Initialise cache
+    // Initialise cache (before clearing the events, which clears the
+    // cache)
+    m_irf_ids.clear();
     m_irf_names.clear();
     m_irf_values.clear();
+    m_irf_keys.clear();
+    m_irf_first.clear();
+    m_irf_nodes.clear();
+    m_irf_used.clear();
+    m_irf_active.clear();
+    m_irf_clock      = 0;
+    m_irf_memory     = 0.0;
+    m_irf_max_memory = G_IRF_CACHE_MAX_MEMORY * 1048576.0;
+    #ifdef _OPENMP
+    omp_lock_t* lock = new omp_lock_t;
+    omp_init_lock(lock);
+    m_irf_lock = lock;
+    #else
+    m_irf_lock = NULL;
+    #endif
+
+    // Initialise members
+    m_roi.clear();
+    m_use_mmap = true;
+    clear_events();
 
     // Return
     return;
@@ -590,14 +740,65 @@ void GCTAEventList::init_members(void)
  ***************************************************************************/
 void GCTAEventList::copy_members(const GCTAEventList& list)
 {
+    // Write back event atom views of list
+    list.flush_atoms();
+
     // Copy members
-    m_roi       = list.m_roi;
-    m_events    = list.m_events;
-    m_has_phase = list.m_has_phase;
+    m_roi         = list.m_roi;
+    m_ra          = list.m_ra;
+    m_dec         = list.m_dec;
+    m_detx        = list.m_detx;
+    m_dety        = list.m_dety;
+    m_energy      = list.m_energy;
+    m_time        = list.m_time;
+    m_event_id    = list.m_event_id;
+    m_obs_id      = list.m_obs_id;
+    m_has_shower  = list.m_has_shower;
+    m_multip      = list.m_multip;
+    m_telmask     = list.m_telmask;
+    m_dir_err     = list.m_dir_err;
+    m_alt         = list.m_alt;
+    m_az          = list.m_az;
+    m_corex       = list.m_corex;
+    m_corey       = list.m_corey;
+    m_core_err    = list.m_core_err;
+    m_xmax        = list.m_xmax;
+    m_xmax_err    = list.m_xmax_err;
+    m_shwidth     = list.m_shwidth;
+    m_shlength    = list.m_shlength;
+    m_energy_err  = list.m_energy_err;
+    m_has_hillas  = list.m_has_hillas;
+    m_hil_msw     = list.m_hil_msw;
+    m_hil_msw_err = list.m_hil_msw_err;
+    m_hil_msl     = list.m_hil_msl;
+    m_hil_msl_err = list.m_hil_msl_err;
+    m_has_phase   = list.m_has_phase;
+    m_phase       = list.m_phase;
+    m_use_mmap    = list.m_use_mmap;
+    m_filename    = list.m_filename;
+    m_deferred    = list.m_deferred;
 
     // Copy cache
-    m_irf_names  = list.m_irf_names;
-    m_irf_values = list.m_irf_values;
+    m_irf_ids        = list.m_irf_ids;
+    m_irf_names      = list.m_irf_names;
+    m_irf_keys       = list.m_irf_keys;
+    m_irf_first      = list.m_irf_first;
+    m_irf_nodes      = list.m_irf_nodes;
+    m_irf_used       = list.m_irf_used;
+    m_irf_active     = list.m_irf_active;
+    m_irf_clock      = list.m_irf_clock;
+    m_irf_memory     = list.m_irf_memory;
+    m_irf_max_memory = list.m_irf_max_memory;
+    m_irf_values.clear();
+    int ncache = list.m_irf_values.size();
+    for (int i = 0; i < ncache; ++i) {
+        if (list.m_irf_values[i] != NULL) {
+            m_irf_values.push_back(new std::vector<double>(*list.m_irf_values[i]));
+        }
+        else {
+            m_irf_values.push_back(NULL);
+        }
+    }
 
     // Return
     return;
@@ -609,6 +810,21 @@ void GCTAEventList::copy_members(const GCTAEventList& list)
  ***************************************************************************/
 void GCTAEventList::free_members(void)
 {
+    // Free event atom views and IRF cache
+    free_atoms();
+    irf_cache_clear();
+
+    // Free IRF cache lock
+    #ifdef _OPENMP
+    if (m_irf_lock != NULL) {
+        omp_destroy_lock(static_cast<omp_lock_t*>(m_irf_lock));
+        delete static_cast<omp_lock_t*>(m_irf_lock);
+    }
+    #endif
+
+    // Signal free pointers
+    m_irf_lock = NULL;
+
     // Return
     return;
 }
@@ -621,12 +837,13 @@ void GCTAEventList::free_members(void)
  *
  * This method reads the CTA event list from a FITS table HDU into memory.
  * Depending on the columns existing in the file, it either selects v0 or
- * v1 of the event list reader.
+ * v1 of the event list reader. Only the mandatory columns are read, the
+ * optional columns are read by read_events_optional().
  ***************************************************************************/
 void GCTAEventList::read_events(const GFitsTable& table)
 {
     // Clear existing events
-    m_events.clear();
+    clear_events();
 
     // Extract number of events in FITS file
     int num = table.integer("NAXIS2");
@@ -644,9 +861,6 @@ void GCTAEventList::read_events(const GFitsTable& table)
             read_events_v0(table);
         }
 
-        // Read (optional) Hillas parameters
-        read_events_hillas(table);
-
     } // endif: there were events
 
     // Return
@@ -667,7 +881,7 @@ void GCTAEventList::read_events(const GFitsTable& table)
 void GCTAEventList::read_events_v0(const GFitsTable& table)
 {
     // Clear existing events
-    m_events.clear();
+    clear_events();
 
     // Extract number of events in FITS file
     int num = table.nrows();
@@ -675,69 +889,32 @@ void GCTAEventList::read_events_v0(const GFitsTable& table)
     // If there are events then load them
     if (num > 0) {
 
-        // Reserve data
-        m_events.reserve(num);
+        // Allocate columns
+        resize_events(num);
 
         // Get column pointers
-        const GFitsTableCol* ptr_eid         = table["EVENT_ID"];
-        const GFitsTableCol* ptr_time        = table["TIME"];
-        const GFitsTableCol* ptr_multip      = table["MULTIP"];
-        const GFitsTableCol* ptr_ra          = table["RA"];
-        const GFitsTableCol* ptr_dec         = table["DEC"];
-        const GFitsTableCol* ptr_dir_err     = table["DIR_ERR"];
-        const GFitsTableCol* ptr_detx        = table["DETX"];
-        const GFitsTableCol* ptr_dety        = table["DETY"];
-        const GFitsTableCol* ptr_alt         = table["ALT"];
-        const GFitsTableCol* ptr_az          = table["AZ"];
-        const GFitsTableCol* ptr_corex       = table["COREX"];
-        const GFitsTableCol* ptr_corey       = table["COREY"];
-        const GFitsTableCol* ptr_core_err    = table["CORE_ERR"];
-        const GFitsTableCol* ptr_xmax        = table["XMAX"];
-        const GFitsTableCol* ptr_xmax_err    = table["XMAX_ERR"];
-        const GFitsTableCol* ptr_energy      = table["ENERGY"];
-        const GFitsTableCol* ptr_energy_err  = table["ENERGY_ERR"];
-
-        // Check for phase column
-        const GFitsTableCol* ptr_phase;
-        if (table.contains("PHASE")) {
-            m_has_phase = true;
-            ptr_phase   = table["PHASE"];
-        }
-        else {
-            m_has_phase = false;
-        }
-
-        // Copy data from columns into GCTAEventAtom objects
-        GCTAEventAtom event;
+        const GFitsTableCol* ptr_eid    = table["EVENT_ID"];
+        const GFitsTableCol* ptr_time   = table["TIME"];
+        const GFitsTableCol* ptr_ra     = table["RA"];
+        const GFitsTableCol* ptr_dec    = table["DEC"];
+        const GFitsTableCol* ptr_detx   = table["DETX"];
+        const GFitsTableCol* ptr_dety   = table["DETY"];
+        const GFitsTableCol* ptr_energy = table["ENERGY"];
+
+        // Copy data from FITS columns into event list columns
+        read_column(ptr_ra,     m_ra,     gammalib::deg2rad);
+        read_column(ptr_dec,    m_dec,    gammalib::deg2rad);
+        read_column(ptr_detx,   m_detx,   gammalib::deg2rad);
+        read_column(ptr_dety,   m_dety,   gammalib::deg2rad);
+        read_column(ptr_energy, m_energy, 1.0e6);
+        read_column(ptr_time,   m_time);
+        read_column(ptr_eid,    m_event_id);
+
+        // Convert times into native reference
+        GTime time;
         for (int i = 0; i < num; ++i) {
-            event.m_index     = i;
-            event.m_time.set(ptr_time->real(i), m_gti.reference());
-            event.m_dir.dir().radec_deg(ptr_ra->real(i), ptr_dec->real(i));
-            event.m_dir.detx(ptr_detx->real(i)*gammalib::deg2rad);
-            event.m_dir.dety(ptr_dety->real(i)*gammalib::deg2rad);
-            event.m_energy.TeV(ptr_energy->real(i));
-            event.m_event_id    = ptr_eid->integer(i);
-            event.m_obs_id      = 0;
-            event.m_multip      = ptr_multip->integer(i);
-            event.m_telmask     = 0;
-            event.m_dir_err     = ptr_dir_err->real(i);
-            event.m_alt         = ptr_alt->real(i);
-            event.m_az          = ptr_az->real(i);
-            event.m_corex       = ptr_corex->real(i);
-            event.m_corey       = ptr_corey->real(i);
-            event.m_core_err    = ptr_core_err->real(i);
-            event.m_xmax        = ptr_xmax->real(i);
-            event.m_xmax_err    = ptr_xmax_err->real(i);
-            event.m_shwidth     = 0.0;
-            event.m_shlength    = 0.0;
-            event.m_energy_err  = ptr_energy_err->real(i);
-
-            // Set pulse phase if available
-            if (m_has_phase) {
-                event.m_phase = ptr_phase->real(i);
-            }
-
-            m_events.push_back(event);
+            time.set(m_time[i], m_gti.reference());
+            m_time[i] = time.secs();
         }
 
     } // endif: there were events
@@ -759,7 +936,7 @@ void GCTAEventList::read_events_v0(const GFitsTable& table)
 void GCTAEventList::read_events_v1(const GFitsTable& table)
 {
     // Clear existing events
-    m_events.clear();
+    clear_events();
 
     // Extract number of events in FITS file
     int num = table.nrows();
@@ -767,72 +944,34 @@ void GCTAEventList::read_events_v1(const GFitsTable& table)
     // If there are events then load them
     if (num > 0) {
 
-        // Reserve data
-        m_events.reserve(num);
+        // Allocate columns
+        resize_events(num);
 
         // Get column pointers
-        const GFitsTableCol* ptr_eid         = table["EVENT_ID"];
-        const GFitsTableCol* ptr_oid         = table["OBS_ID"];
-        const GFitsTableCol* ptr_time        = table["TIME"];
-        const GFitsTableCol* ptr_multip      = table["MULTIP"];
-        const GFitsTableCol* ptr_ra          = table["RA"];
-        const GFitsTableCol* ptr_dec         = table["DEC"];
-        const GFitsTableCol* ptr_dir_err     = table["DIR_ERR"];
-        const GFitsTableCol* ptr_detx        = table["DETX"];
-        const GFitsTableCol* ptr_dety        = table["DETY"];
-        const GFitsTableCol* ptr_alt         = table["ALT"];
-        const GFitsTableCol* ptr_az          = table["AZ"];
-        const GFitsTableCol* ptr_corex       = table["COREX"];
-        const GFitsTableCol* ptr_corey       = table["COREY"];
-        const GFitsTableCol* ptr_core_err    = table["CORE_ERR"];
-        const GFitsTableCol* ptr_xmax        = table["XMAX"];
-        const GFitsTableCol* ptr_xmax_err    = table["XMAX_ERR"];
-        const GFitsTableCol* ptr_shw         = table["SHWIDTH"];
-        const GFitsTableCol* ptr_shl         = table["SHLENGTH"];
-        const GFitsTableCol* ptr_energy      = table["ENERGY"];
-        const GFitsTableCol* ptr_energy_err  = table["ENERGY_ERR"];
-
-        // Check for phase column
-        const GFitsTableCol* ptr_phase;
-        if (table.contains("PHASE")) {
-            m_has_phase = true;
-            ptr_phase   = table["PHASE"];
-        }
-        else {
-            m_has_phase = false;
-        }
-
-        // Copy data from columns into GCTAEventAtom objects
-        GCTAEventAtom event;
+        const GFitsTableCol* ptr_eid    = table["EVENT_ID"];
+        const GFitsTableCol* ptr_oid    = table["OBS_ID"];
+        const GFitsTableCol* ptr_time   = table["TIME"];
+        const GFitsTableCol* ptr_ra     = table["RA"];
+        const GFitsTableCol* ptr_dec    = table["DEC"];
+        const GFitsTableCol* ptr_detx   = table["DETX"];
+        const GFitsTableCol* ptr_dety   = table["DETY"];
+        const GFitsTableCol* ptr_energy = table["ENERGY"];
+
+        // Copy the columns that are used for the likelihood computation
+        read_column(ptr_ra,     m_ra,     gammalib::deg2rad);
+        read_column(ptr_dec,    m_dec,    gammalib::deg2rad);
+        read_column(ptr_detx,   m_detx,   gammalib::deg2rad);
+        read_column(ptr_dety,   m_dety,   gammalib::deg2rad);
+        read_column(ptr_energy, m_energy, 1.0e6);
+        read_column(ptr_time,   m_time);
+        read_column(ptr_eid,    m_event_id);
+        read_column(ptr_oid,    m_obs_id);
+
+        // Convert times into native reference
+        GTime time;
         for (int i = 0; i < num; ++i) {
-            event.m_index     = i;
-            event.m_time.set(ptr_time->real(i), m_gti.reference());
-            event.m_dir.dir().radec_deg(ptr_ra->real(i), ptr_dec->real(i));
-            event.m_dir.detx(ptr_detx->real(i)*gammalib::deg2rad);
-            event.m_dir.dety(ptr_dety->real(i)*gammalib::deg2rad);
-            event.m_energy.TeV(ptr_energy->real(i));
-            event.m_event_id    = ptr_eid->integer(i);
-            event.m_obs_id      = ptr_oid->integer(i);
-            event.m_multip      = ptr_multip->integer(i);
-            event.m_telmask     = 0;
-            event.m_dir_err     = ptr_dir_err->real(i);
-            event.m_alt         = ptr_alt->real(i);
-            event.m_az          = ptr_az->real(i);
-            event.m_corex       = ptr_corex->real(i);
-            event.m_corey       = ptr_corey->real(i);
-            event.m_core_err    = ptr_core_err->real(i);
-            event.m_xmax        = ptr_xmax->real(i);
-            event.m_xmax_err    = ptr_xmax_err->real(i);
-            event.m_shwidth     = ptr_shw->real(i);
-            event.m_shlength    = ptr_shl->real(i);
-            event.m_energy_err  = ptr_energy_err->real(i);
-
-            // Set phase if available
-            if (m_has_phase) {
-                event.m_phase = ptr_phase->real(i);
-            }
-
-            m_events.push_back(event);
+            time.set(m_time[i], m_gti.reference());
+            m_time[i] = time.secs();
         }
 
     } // endif: there were events
@@ -850,8 +989,9 @@ void GCTAEventList::read_events_v1(const GFitsTable& table)
  * This method reads the Hillas reconstruction information for CTA events
  * from an EVENTS file. It searches for the columns HIL_MSW, HIL_MSW_ERR,
  * HIL_MSL, and HIL_MSL_ERR in the FITS table and extracts the relevant
- * columns from the FITS file. If a column is not found, no action is
- * performed.
+ * columns from the FITS file. The Hillas parameter columns are only
+ * allocated if at least one of the columns is found. If a column is not
+ * found, its values are set to zero.
  *
  * @todo Verify consistency of event list size
  ***************************************************************************/
@@ -868,36 +1008,95 @@ void GCTAEventList::read_events_hillas(const GFitsTable& table)
 
         // HIL_MSW
         if (table.contains("HIL_MSW")) {
-            const GFitsTableCol* ptr = table["HIL_MSW"];
-            for (int i = 0; i < num; ++i) {
-                m_events[i].m_hil_msw = ptr->real(i);
-            }
+            alloc_hillas();
+            read_column(table["HIL_MSW"], m_hil_msw);
         }
 
         // HIL_MSW_ERR
         if (table.contains("HIL_MSW_ERR")) {
-            const GFitsTableCol* ptr = table["HIL_MSW_ERR"];
-            for (int i = 0; i < num; ++i) {
-                m_events[i].m_hil_msw_err = ptr->real(i);
-            }
+            alloc_hillas();
+            read_column(table["HIL_MSW_ERR"], m_hil_msw_err);
         }
 
         // HIL_MSL
         if (table.contains("HIL_MSL")) {
-            const GFitsTableCol* ptr = table["HIL_MSL"];
-            for (int i = 0; i < num; ++i) {
-                m_events[i].m_hil_msl = ptr->real(i);
-            }
+            alloc_hillas();
+            read_column(table["HIL_MSL"], m_hil_msl);
         }
 
         // HIL_MSL_ERR
         if (table.contains("HIL_MSL_ERR")) {
-            const GFitsTableCol* ptr = table["HIL_MSL_ERR"];
-            for (int i = 0; i < num; ++i) {
-                m_events[i].m_hil_msl_err = ptr->real(i);
-            }
+            alloc_hillas();
+            read_column(table["HIL_MSL_ERR"], m_hil_msl_err);
+        }
+
+    } // endif: there were events
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read optional CTA event columns from FITS table
+ *
+ * @param[in] table FITS table.
+ *
+ * This method reads the shower parameters, the pulse phase and the Hillas
+ * parameters of the events that were read by read_events() from a FITS
+ * table HDU. The shower width and length are only present in the v1
+ * format and the pulse phase and the Hillas parameters are only read if
+ * they exist in the FITS table.
+ ***************************************************************************/
+void GCTAEventList::read_events_optional(const GFitsTable& table)
+{
+    // Continue only if there are events
+    if (size() > 0) {
+
+        // Allocate columns
+        alloc_shower();
+
+        // Get column pointers
+        const GFitsTableCol* ptr_multip     = table["MULTIP"];
+        const GFitsTableCol* ptr_dir_err    = table["DIR_ERR"];
+        const GFitsTableCol* ptr_alt        = table["ALT"];
+        const GFitsTableCol* ptr_az         = table["AZ"];
+        const GFitsTableCol* ptr_corex      = table["COREX"];
+        const GFitsTableCol* ptr_corey      = table["COREY"];
+        const GFitsTableCol* ptr_core_err   = table["CORE_ERR"];
+        const GFitsTableCol* ptr_xmax       = table["XMAX"];
+        const GFitsTableCol* ptr_xmax_err   = table["XMAX_ERR"];
+        const GFitsTableCol* ptr_energy_err = table["ENERGY_ERR"];
+
+        // Copy the shower parameter columns
+        read_column(ptr_dir_err,    m_dir_err);
+        read_column(ptr_alt,        m_alt);
+        read_column(ptr_az,         m_az);
+        read_column(ptr_corex,      m_corex);
+        read_column(ptr_corey,      m_corey);
+        read_column(ptr_core_err,   m_core_err);
+        read_column(ptr_xmax,       m_xmax);
+        read_column(ptr_xmax_err,   m_xmax_err);
+        read_column(ptr_energy_err, m_energy_err);
+        for (int i = 0; i < size(); ++i) {
+            m_multip[i] = ptr_multip->integer(i);
+        }
+
+        // Copy shower width and length for v1
+        if (table.contains("SHWIDTH") && table.contains("SHLENGTH")) {
+            read_column(table["SHWIDTH"],  m_shwidth);
+            read_column(table["SHLENGTH"], m_shlength);
         }
 
+        // Read pulse phase if available
+        if (table.contains("PHASE")) {
+            alloc_phase();
+            read_column(table["PHASE"], m_phase);
+        }
+
+        // Read (optional) Hillas parameters
+        read_events_hillas(table);
+
     } // endif: there were events
 
     // Return
@@ -905,6 +1104,246 @@ void GCTAEventList::read_events_hillas(const GFitsTable& table)
 }
 
 
+/***********************************************************************//**
+ * @brief Read deferred optional CTA event columns from event file
+ *
+ * @exception GException::file_error
+ *            Event file could not be read.
+ *
+ * Reads the optional event columns from the event file if their reading
+ * was deferred by read(). The flag that signals deferred reading is read
+ * atomically and the columns are read in a critical region, so that the
+ * method may be called concurrently when events are accessed through the
+ * atom() method. The critical region is shared with the loading of event
+ * files by GCTAObservation, which serialises the access to cfitsio if
+ * cfitsio is not reentrant.
+ ***************************************************************************/
+void GCTAEventList::read_deferred(void) const
+{
+    // Check whether the reading of optional columns was deferred. If not,
+    // make sure that the columns are read after the flag.
+    int deferred = 0;
+    #pragma omp atomic read
+    deferred = m_deferred;
+    if (deferred == 0) {
+        #pragma omp flush
+    }
+
+    // ... otherwise read the optional columns now. Exceptions must not
+    // leave the critical zone.
+    else {
+        std::string msg;
+        #pragma omp critical(GCTAObservation_events_load)
+        {
+            if (m_deferred != 0) {
+                try {
+                    GFits fits(m_filename);
+                    const GFitsTable& events = *fits.table("EVENTS");
+                    const_cast<GCTAEventList*>(this)->read_events_optional(events);
+                    fits.close();
+                    #pragma omp flush
+                    #pragma omp atomic write
+                    m_deferred = 0;
+                }
+                catch (std::exception& e) {
+                    msg = e.what();
+                }
+            }
+        }
+        if (!msg.empty()) {
+            msg = "Unable to read optional event columns from file \""+
+                  m_filename+"\": "+msg;
+            throw GException::file_error(G_READ_DEFERRED, msg);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read FITS table column into double precision event column
+ *
+ * @param[in] column FITS table column.
+ * @param[in,out] values Event column.
+ * @param[in] scale Scaling factor applied to all values.
+ *
+ * Reads the first size() elements of a scalar FITS table column into an
+ * event column. Float and double precision FITS columns are read through
+ * their typed data array, avoiding one virtual method call per element.
+ * If use_mmap() is set, the column data are read by memory mapping the
+ * FITS file, provided that they have not yet been loaded.
+ ***************************************************************************/
+void GCTAEventList::read_column(const GFitsTableCol* column,
+                                std::vector<double>& values,
+                                const double& scale) const
+{
+    // Get number of values
+    int num = values.size();
+
+    // Request memory mapping of the column data. This has no effect if
+    // the column data were already loaded.
+    if (m_use_mmap) {
+        const_cast<GFitsTableCol*>(column)->use_mmap(true);
+    }
+
+    // Get typed column pointers for scalar columns
+    const GFitsTableFloatCol*  fcol = NULL;
+    const GFitsTableDoubleCol* dcol = NULL;
+    if (column->number() == 1) {
+        fcol = dynamic_cast<const GFitsTableFloatCol*>(column);
+        dcol = dynamic_cast<const GFitsTableDoubleCol*>(column);
+    }
+
+    // Read float column
+    if (fcol != NULL) {
+        const float* data = fcol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = data[i] * scale;
+        }
+    }
+
+    // ... otherwise read double column
+    else if (dcol != NULL) {
+        const double* data = dcol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = data[i] * scale;
+        }
+    }
+
+    // ... otherwise read column element by element
+    else {
+        for (int i = 0; i < num; ++i) {
+            values[i] = column->real(i) * scale;
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read FITS table column into single precision event column
+ *
+ * @param[in] column FITS table column.
+ * @param[in,out] values Event column.
+ *
+ * Reads the first size() elements of a scalar FITS table column into an
+ * event column. Float and double precision FITS columns are read through
+ * their typed data array, avoiding one virtual method call per element.
+ * If use_mmap() is set, the column data are read by memory mapping the
+ * FITS file, provided that they have not yet been loaded.
+ ***************************************************************************/
+void GCTAEventList::read_column(const GFitsTableCol* column,
+                                std::vector<float>& values) const
+{
+    // Get number of values
+    int num = values.size();
+
+    // Request memory mapping of the column data. This has no effect if
+    // the column data were already loaded.
+    if (m_use_mmap) {
+        const_cast<GFitsTableCol*>(column)->use_mmap(true);
+    }
+
+    // Get typed column pointers for scalar columns
+    const GFitsTableFloatCol*  fcol = NULL;
+    const GFitsTableDoubleCol* dcol = NULL;
+    if (column->number() == 1) {
+        fcol = dynamic_cast<const GFitsTableFloatCol*>(column);
+        dcol = dynamic_cast<const GFitsTableDoubleCol*>(column);
+    }
+
+    // Read float column
+    if (fcol != NULL) {
+        const float* data = fcol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = data[i];
+        }
+    }
+
+    // ... otherwise read double column
+    else if (dcol != NULL) {
+        const double* data = dcol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = (float)data[i];
+        }
+    }
+
+    // ... otherwise read column element by element
+    else {
+        for (int i = 0; i < num; ++i) {
+            values[i] = (float)column->real(i);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Read FITS table column into identifier event column
+ *
+ * @param[in] column FITS table column.
+ * @param[in,out] values Event column.
+ *
+ * Reads the first size() elements of a scalar FITS table column into an
+ * event column. Unsigned long and long FITS columns are read through
+ * their typed data array, avoiding one virtual method call per element.
+ * If use_mmap() is set, the column data are read by memory mapping the
+ * FITS file, provided that they have not yet been loaded.
+ ***************************************************************************/
+void GCTAEventList::read_column(const GFitsTableCol* column,
+                                std::vector<unsigned long>& values) const
+{
+    // Get number of values
+    int num = values.size();
+
+    // Request memory mapping of the column data. This has no effect if
+    // the column data were already loaded.
+    if (m_use_mmap) {
+        const_cast<GFitsTableCol*>(column)->use_mmap(true);
+    }
+
+    // Get typed column pointers for scalar columns
+    const GFitsTableULongCol* ucol = NULL;
+    const GFitsTableLongCol*  lcol = NULL;
+    if (column->number() == 1) {
+        ucol = dynamic_cast<const GFitsTableULongCol*>(column);
+        lcol = dynamic_cast<const GFitsTableLongCol*>(column);
+    }
+
+    // Read unsigned long column
+    if (ucol != NULL) {
+        const unsigned long* data = ucol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = data[i];
+        }
+    }
+
+    // ... otherwise read long column
+    else if (lcol != NULL) {
+        const long* data = lcol->data();
+        for (int i = 0; i < num; ++i) {
+            values[i] = (unsigned long)data[i];
+        }
+    }
+
+    // ... otherwise read column element by element
+    else {
+        for (int i = 0; i < num; ++i) {
+            values[i] = (unsigned long)column->integer(i);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Write CTA events into FITS table
  *
@@ -920,6 +1359,10 @@ void GCTAEventList::write_events(GFitsBinTable& hdu) const
     // Set extension name
     hdu.extname("EVENTS");
 
+    // Read deferred optional columns and write back event atom views
+    read_deferred();
+    flush_atoms();
+
     // If there are events then write them now
     if (size() > 0) {
 
@@ -958,37 +1401,47 @@ void GCTAEventList::write_events(GFitsBinTable& hdu) const
         }
 
         // Fill columns
+        GTime time;
         for (int i = 0; i < size(); ++i) {
-            col_eid(i)         = m_events[i].m_event_id;
-            col_oid(i)         = m_events[i].m_obs_id;
-            col_time(i)        = m_events[i].time().convert(m_gti.reference());
+            time.secs(m_time[i]);
+            col_eid(i)         = m_event_id[i];
+            col_oid(i)         = m_obs_id[i];
+            col_time(i)        = time.convert(m_gti.reference());
             col_live(i)        = 0.0;
             col_multip(i)      = 0;
             //col_telmask
-            col_ra(i)          = m_events[i].dir().dir().ra_deg();
-            col_dec(i)         = m_events[i].dir().dir().dec_deg();
-            col_direrr(i)      = m_events[i].m_dir_err;
-            col_detx(i)        = m_events[i].dir().detx() * gammalib::rad2deg;
-            col_dety(i)        = m_events[i].dir().dety() * gammalib::rad2deg;
-            col_alt(i)         = m_events[i].m_alt;
-            col_az(i)          = m_events[i].m_az;
-            col_corex(i)       = m_events[i].m_corex;
-            col_corey(i)       = m_events[i].m_corey;
-            col_core_err(i)    = m_events[i].m_core_err;
-            col_xmax(i)        = m_events[i].m_xmax;
-            col_xmax_err(i)    = m_events[i].m_xmax_err;
-            col_shw(i)         = m_events[i].m_shwidth;
-            col_shl(i)         = m_events[i].m_shlength;
-            col_energy(i)      = m_events[i].energy().TeV();
-            col_energy_err(i)  = m_events[i].m_energy_err;
-            col_hil_msw(i)     = m_events[i].m_hil_msw;
-            col_hil_msw_err(i) = m_events[i].m_hil_msw_err;
-            col_hil_msl(i)     = m_events[i].m_hil_msl;
-            col_hil_msl_err(i) = m_events[i].m_hil_msl_err;
+            col_ra(i)          = m_ra[i]   * gammalib::rad2deg;
+            col_dec(i)         = m_dec[i]  * gammalib::rad2deg;
+            col_detx(i)        = m_detx[i] * gammalib::rad2deg;
+            col_dety(i)        = m_dety[i] * gammalib::rad2deg;
+            col_energy(i)      = m_energy[i] * 1.0e-6;
+
+            // Optionally fill shower parameter columns
+            if (m_has_shower) {
+                col_direrr(i)      = m_dir_err[i];
+                col_alt(i)         = m_alt[i];
+                col_az(i)          = m_az[i];
+                col_corex(i)       = m_corex[i];
+                col_corey(i)       = m_corey[i];
+                col_core_err(i)    = m_core_err[i];
+                col_xmax(i)        = m_xmax[i];
+                col_xmax_err(i)    = m_xmax_err[i];
+                col_shw(i)         = m_shwidth[i];
+                col_shl(i)         = m_shlength[i];
+                col_energy_err(i)  = m_energy_err[i];
+            }
+
+            // Optionally fill Hillas parameter columns
+            if (m_has_hillas) {
+                col_hil_msw(i)     = m_hil_msw[i];
+                col_hil_msw_err(i) = m_hil_msw_err[i];
+                col_hil_msl(i)     = m_hil_msl[i];
+                col_hil_msl_err(i) = m_hil_msl_err[i];
+            }
 
             // Optionally fill pulse phase column
             if (m_has_phase) {
-                col_phase(i) = m_events[i].m_phase;
+                col_phase(i) = m_phase[i];
             }
 
         } // endfor: looped over rows
@@ -1100,79 +1553,89 @@ void GCTAEventList::write_ds_keys(GFitsHDU& hdu) const
 
 
 /***********************************************************************//**
- * @brief Initialize IRF cache for a given model
+ * @brief Get cache IRF value
  *
  * @param[in] name Model name.
- * @return Cache index (-1 if invalid).
+ * @param[in] index Event index [0,...,size()-1].
+ * @return IRF value (-1 if no cache value found).
+ *
+ * Returns the cached IRF value of a model for an event. The method does
+ * not modify the cache and does not lock, hence it may be called
+ * concurrently from several threads. Cache values exist only for models
+ * for which a cache key was set using irf_cache_key() since the last call
+ * of irf_cache_release().
  ***************************************************************************/
-int GCTAEventList::irf_cache_init(const std::string& name) const
+double GCTAEventList::irf_cache(const std::string& name, const int& index) const
 {
-    // Initialise cache index
-    int index = irf_cache_index(name);
-
-    // Continue only if model does not yet exist
-    if (index == -1) {
-
-        // Add model name and vector to cache. The vector is initialized
-        // to -1, which signals that no cache values exist
-        m_irf_names.push_back(name);
-        m_irf_values.push_back(std::vector<double>(size(), -1.0));
-
-        // Set index
-        index = m_irf_names.size()-1;
+    // Initialise IRF value to invalid value
+    double irf = -1.0;
 
-    } // endif: model cache did not yet exist
+    // Get cache values. Continue only if they exist
+    int id = irf_cache_id(name);
+    if (id != -1 && m_irf_active[id] && m_irf_values[id] != NULL) {
+        irf = (*m_irf_values[id])[index * m_irf_nodes[id]];
+    }
 
-    // Return index
-    return index;
+    // Return IRF value
+    return irf;
 }
 
 
 /***********************************************************************//**
- * @brief Determines the cache index for a given model name
+ * @brief Set cache IRF value
  *
  * @param[in] name Model name.
- * @return Cache index (-1 if model has not been found).
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] irf IRF value.
+ *
+ * Stores an IRF value in the cache. The value is only stored if cache
+ * values were allocated for the model by irf_cache_key() and if the cache
+ * key was not released by irf_cache_release(). The method does
+ * not lock. Several threads may store values concurrently as long as they
+ * work on different events.
  ***************************************************************************/
-int GCTAEventList::irf_cache_index(const std::string& name) const
+void GCTAEventList::irf_cache(const std::string& name, const int& index,
+                              const double& irf) const
 {
-    // Initialise index
-    int index = -1;
-
-    // Continue only if there are models in cache
-    if (!m_irf_names.empty()) {
-
-         // Search for model name
-         for (int i = 0; i < m_irf_names.size(); ++i) {
-             if (m_irf_names[i] == name) {
-                 index = i;
-                 break;
-             }
-         }
-
-    } // endif: there were models in cache
+    // Get cache values. Continue only if they exist
+    int id = irf_cache_id(name);
+    if (id != -1 && m_irf_active[id] && m_irf_values[id] != NULL) {
+        (*m_irf_values[id])[index * m_irf_nodes[id]] = irf;
+    }
 
-    // Return index
-    return index;
+    // Return
+    return;
 }
 
 
 /***********************************************************************//**
- * @brief Get cache IRF value
+ * @brief Get cache IRF value for a true energy node
  *
  * @param[in] name Model name.
  * @param[in] index Event index [0,...,size()-1].
+ * @param[in] node True energy node.
  * @return IRF value (-1 if no cache value found).
+ *
+ * Returns the cached IRF value of a model for an event and a true energy
+ * node. Cache values exist only for the range of true energy nodes that
+ * was specified when setting the cache key using irf_cache_key(). Like
+ * irf_cache(), the method does not modify the cache and does not lock.
  ***************************************************************************/
-double GCTAEventList::irf_cache(const std::string& name, const int& index) const
+double GCTAEventList::irf_cache_node(const std::string& name,
+                                     const int&         index,
+                                     const int&         node) const
 {
     // Initialise IRF value to invalid value
     double irf = -1.0;
 
-    // Get cache index. Continue only if index is valid
-    int icache = irf_cache_index(name);
-    if (icache != -1) {
-        irf = (m_irf_values[icache])[index];
+    // Get cache values. Continue only if they exist and if the node is
+    // within the node range of the cache values
+    int id = irf_cache_id(name);
+    if (id != -1 && m_irf_active[id] && m_irf_values[id] != NULL) {
+        int slot = node - m_irf_first[id];
+        if (slot >= 0 && slot < m_irf_nodes[id]) {
+            irf = (*m_irf_values[id])[index * m_irf_nodes[id] + slot];
+        }
     }
 
     // Return IRF value
@@ -1181,21 +1644,852 @@ double GCTAEventList::irf_cache(const std::string& name, const int& index) const
 
 
 /***********************************************************************//**
- * @brief Set cache IRF value
+ * @brief Set cache IRF value for a true energy node
  *
  * @param[in] name Model name.
  * @param[in] index Event index [0,...,size()-1].
+ * @param[in] node True energy node.
  * @param[in] irf IRF value.
+ *
+ * Stores an IRF value for an event and a true energy node in the cache.
+ * The value is only stored if the node is within the range of true energy
+ * nodes that was specified when setting the cache key using
+ * irf_cache_key(). Like irf_cache(), the method does not lock.
  ***************************************************************************/
-void GCTAEventList::irf_cache(const std::string& name, const int& index,
-                              const double& irf) const
+void GCTAEventList::irf_cache_node(const std::string& name,
+                                   const int&         index,
+                                   const int&         node,
+                                   const double&      irf) const
 {
-    // Initialize cache index. Continue only if index is valid
-    int icache = irf_cache_init(name);
-    if (icache != -1) {
-        (m_irf_values[icache])[index] = irf;
+    // Get cache values. Continue only if they exist and if the node is
+    // within the node range of the cache values
+    int id = irf_cache_id(name);
+    if (id != -1 && m_irf_active[id] && m_irf_values[id] != NULL) {
+        int slot = node - m_irf_first[id];
+        if (slot >= 0 && slot < m_irf_nodes[id]) {
+            (*m_irf_values[id])[index * m_irf_nodes[id] + slot] = irf;
+        }
     }
 
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Set IRF cache key
+ *
+ * @param[in] name Model name.
+ * @param[in] key Cache key.
+ * @param[in] first First true energy node (default: 0).
+ * @param[in] nodes Number of true energy nodes (default: 1).
+ *
+ * Sets the key for the cached IRF values of a model and allocates the
+ * cache values of the model if they do not yet exist. The key is typically
+ * composed of the model parameter values on which the IRF values depend.
+ * If the key differs from the key that was set before, all cached IRF
+ * values of the model are invalidated.
+ *
+ * One IRF value is cached per event for each of the @p nodes true energy
+ * nodes starting from node @p first (see irf_cache_node()). If the node
+ * range differs from the range that was set before, the cache values of
+ * the model are reallocated.
+ *
+ * If allocating the cache values would exceed the memory limit, the least
+ * recently used cache values of other models are evicted. If this does
+ * not free enough memory, no cache values are allocated for the model.
+ *
+ * The method modifies the structure of the cache, hence it should be
+ * called once for each model before the events are evaluated, and it must
+ * not be called while other threads access the cache values of the event
+ * list. Concurrent calls of the method are serialised by a lock of the
+ * event list.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_key(const std::string&         name,
+                                  const std::vector<double>& key,
+                                  const int&                 first,
+                                  const int&                 nodes) const
+{
+    // Acquire cache lock
+    #ifdef _OPENMP
+    omp_set_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Get source identifier. Intern the source name if it is not yet
+    // known.
+    int id = irf_cache_id(name);
+    if (id == -1) {
+        id              = m_irf_names.size();
+        m_irf_ids[name] = id;
+        m_irf_names.push_back(name);
+        m_irf_values.push_back(NULL);
+        m_irf_keys.push_back(std::vector<double>());
+        m_irf_first.push_back(first);
+        m_irf_nodes.push_back(nodes);
+        m_irf_used.push_back(0);
+        m_irf_active.push_back(false);
+    }
+
+    // If the node range has changed then store the node range and free
+    // the cache values
+    if (m_irf_first[id] != first || m_irf_nodes[id] != nodes) {
+        m_irf_first[id] = first;
+        m_irf_nodes[id] = nodes;
+        if (m_irf_values[id] != NULL) {
+            m_irf_memory -= double(m_irf_values[id]->size()) * sizeof(double);
+            delete m_irf_values[id];
+            m_irf_values[id] = NULL;
+        }
+    }
+
+    // If the key has changed then store key and invalidate the cached
+    // values
+    if (m_irf_keys[id] != key) {
+        m_irf_keys[id] = key;
+        if (m_irf_values[id] != NULL) {
+            m_irf_values[id]->assign(m_irf_values[id]->size(), -1.0);
+        }
+    }
+
+    // Allocate cache values if they do not exist. The values are
+    // initialised to -1, which signals that no cache values exist
+    if (m_irf_values[id] == NULL) {
+        double bytes = double(size()) * double(nodes) * sizeof(double);
+        if (m_irf_memory + bytes > m_irf_max_memory) {
+            irf_cache_evict(bytes, id);
+        }
+        if (m_irf_memory + bytes <= m_irf_max_memory) {
+            m_irf_values[id] = new std::vector<double>(size() * nodes, -1.0);
+            m_irf_memory    += bytes;
+        }
+    }
+
+    // Update usage stamp and signal that the cache values of the model
+    // may be used
+    m_irf_used[id]   = ++m_irf_clock;
+    m_irf_active[id] = true;
+
+    // Release cache lock
+    #ifdef _OPENMP
+    omp_unset_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Release IRF cache keys
+ *
+ * Signals that the cache keys of all models are no longer valid, for
+ * example because the model parameters may be modified after an
+ * evaluation. The cache values can not be used until the cache key of a
+ * model is set again using irf_cache_key(). The cache values are kept, so
+ * that they become valid again if the key of a model did not change.
+ *
+ * The method must not be called while other threads access the cache
+ * values of the event list.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_release(void) const
+{
+    // Acquire cache lock
+    #ifdef _OPENMP
+    omp_set_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Signal that no cache values may be used
+    m_irf_active.assign(m_irf_active.size(), false);
+
+    // Release cache lock
+    #ifdef _OPENMP
+    omp_unset_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return memory used by IRF cache
+ *
+ * @return Memory used by IRF cache (Mbytes).
+ ***************************************************************************/
+double GCTAEventList::irf_cache_memory(void) const
+{
+    // Return memory in Mbytes
+    return (m_irf_memory / 1048576.0);
+}
+
+
+/***********************************************************************//**
+ * @brief Set memory limit of IRF cache
+ *
+ * @param[in] mbytes Memory limit (Mbytes).
+ *
+ * Sets the maximum amount of memory that may be used by the IRF cache. If
+ * the cache already uses more memory, the least recently used model caches
+ * are evicted.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_max_memory(const double& mbytes)
+{
+    // Acquire cache lock
+    #ifdef _OPENMP
+    omp_set_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Set memory limit
+    m_irf_max_memory = mbytes * 1048576.0;
+
+    // Evict model caches if the limit is exceeded
+    if (m_irf_memory > m_irf_max_memory) {
+        irf_cache_evict(0.0, -1);
+    }
+
+    // Release cache lock
+    #ifdef _OPENMP
+    omp_unset_lock(static_cast<omp_lock_t*>(m_irf_lock));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return memory used by event columns
+ *
+ * @return Memory used by event columns (Mbytes).
+ *
+ * Returns the memory that is allocated for the event columns. The memory
+ * used by the IRF cache is not included (see irf_cache_memory()).
+ ***************************************************************************/
+double GCTAEventList::memory(void) const
+{
+    // Sum memory of mandatory columns
+    double bytes = double(m_ra.capacity()       * sizeof(double) +
+                          m_dec.capacity()      * sizeof(double) +
+                          m_detx.capacity()     * sizeof(double) +
+                          m_dety.capacity()     * sizeof(double) +
+                          m_energy.capacity()   * sizeof(double) +
+                          m_time.capacity()     * sizeof(double) +
+                          m_event_id.capacity() * sizeof(unsigned long) +
+                          m_obs_id.capacity()   * sizeof(unsigned long));
+
+    // Add memory of shower columns
+    bytes += double(m_multip.capacity()     * sizeof(int) +
+                    m_telmask.capacity()    * sizeof(char) +
+                    (m_dir_err.capacity()    + m_alt.capacity()      +
+                     m_az.capacity()         + m_corex.capacity()    +
+                     m_corey.capacity()      + m_core_err.capacity() +
+                     m_xmax.capacity()       + m_xmax_err.capacity() +
+                     m_shwidth.capacity()    + m_shlength.capacity() +
+                     m_energy_err.capacity()) * sizeof(float));
+
+    // Add memory of Hillas and phase columns
+    bytes += double((m_hil_msw.capacity() + m_hil_msw_err.capacity() +
+                     m_hil_msl.capacity() + m_hil_msl_err.capacity() +
+                     m_phase.capacity()) * sizeof(float));
+
+    // Return memory in Mbytes
+    return (bytes / 1048576.0);
+}
+
+
+/***********************************************************************//**
+ * @brief Return IRF cache source identifier for a given model
+ *
+ * @param[in] name Model name.
+ * @return Source identifier (-1 if model is not known).
+ *
+ * Each model name is interned into a source identifier by irf_cache_key(),
+ * which indexes the per-model cache vectors.
+ ***************************************************************************/
+int GCTAEventList::irf_cache_id(const std::string& name) const
+{
+    // Initialise source identifier
+    int id = -1;
+
+    // Search source identifier
+    std::map<std::string,int>::const_iterator it = m_irf_ids.find(name);
+    if (it != m_irf_ids.end()) {
+        id = it->second;
+    }
+
+    // Return source identifier
+    return id;
+}
+
+
+/***********************************************************************//**
+ * @brief Evict least recently used IRF cache values
+ *
+ * @param[in] bytes Number of bytes that should become available.
+ * @param[in] keep Source identifier that should not be evicted (-1 if
+ *                 none).
+ *
+ * Frees the least recently used cache vectors until @p bytes can be
+ * allocated without exceeding the memory limit. The source identifiers are
+ * kept so that evicted caches can be allocated again by irf_cache_key().
+ * The method must not be called while other threads access the cache
+ * values.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_evict(const double& bytes, const int& keep) const
+{
+    // Evict least recently used cache vectors until enough memory is
+    // available
+    while (m_irf_memory + bytes > m_irf_max_memory) {
+
+        // Find least recently used cache vector
+        int lru    = -1;
+        int ncache = m_irf_values.size();
+        for (int i = 0; i < ncache; ++i) {
+            if (i != keep && m_irf_values[i] != NULL &&
+                (lru == -1 || m_irf_used[i] < m_irf_used[lru])) {
+                lru = i;
+            }
+        }
+
+        // Break if there is nothing left to evict
+        if (lru == -1) {
+            break;
+        }
+
+        // Free cache vector
+        m_irf_memory -= double(m_irf_values[lru]->size()) * sizeof(double);
+        delete m_irf_values[lru];
+        m_irf_values[lru] = NULL;
+
+    } // endwhile: evicted cache vectors
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clear IRF cache
+ *
+ * Frees all IRF cache values and forgets all source identifiers.
+ ***************************************************************************/
+void GCTAEventList::irf_cache_clear(void) const
+{
+    // Free cache vectors
+    int ncache = m_irf_values.size();
+    for (int i = 0; i < ncache; ++i) {
+        if (m_irf_values[i] != NULL) {
+            delete m_irf_values[i];
+        }
+    }
+
+    // Clear cache
+    m_irf_ids.clear();
+    m_irf_names.clear();
+    m_irf_values.clear();
+    m_irf_keys.clear();
+    m_irf_first.clear();
+    m_irf_nodes.clear();
+    m_irf_used.clear();
+    m_irf_active.clear();
+    m_irf_clock  = 0;
+    m_irf_memory = 0.0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clear event columns
+ *
+ * Removes all events from the event list, drops all optional columns,
+ * frees the event atom views and clears the IRF cache.
+ ***************************************************************************/
+void GCTAEventList::clear_events(void)
+{
+    // Clear mandatory columns
+    m_ra.clear();
+    m_dec.clear();
+    m_detx.clear();
+    m_dety.clear();
+    m_energy.clear();
+    m_time.clear();
+    m_event_id.clear();
+    m_obs_id.clear();
+
+    // Clear shower parameter columns
+    m_has_shower = false;
+    m_multip.clear();
+    m_telmask.clear();
+    m_dir_err.clear();
+    m_alt.clear();
+    m_az.clear();
+    m_corex.clear();
+    m_corey.clear();
+    m_core_err.clear();
+    m_xmax.clear();
+    m_xmax_err.clear();
+    m_shwidth.clear();
+    m_shlength.clear();
+    m_energy_err.clear();
+
+    // Clear Hillas parameter columns
+    m_has_hillas = false;
+    m_hil_msw.clear();
+    m_hil_msw_err.clear();
+    m_hil_msl.clear();
+    m_hil_msl_err.clear();
+
+    // Clear phase column
+    m_has_phase = false;
+    m_phase.clear();
+
+    // Clear deferred reading of optional columns
+    m_filename.clear();
+    m_deferred = 0;
+
+    // Free event atom views
+    free_atoms();
+
+    // Clear IRF cache as its vectors are sized to the number of events
+    irf_cache_clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Reserve space in event columns
+ *
+ * @param[in] number Number of events.
+ *
+ * Reserves space for @p number events in the mandatory columns and in all
+ * optional columns that are present.
+ ***************************************************************************/
+void GCTAEventList::reserve_events(const int& number)
+{
+    // Read deferred optional columns
+    read_deferred();
+
+    // Reserve mandatory columns
+    m_ra.reserve(number);
+    m_dec.reserve(number);
+    m_detx.reserve(number);
+    m_dety.reserve(number);
+    m_energy.reserve(number);
+    m_time.reserve(number);
+    m_event_id.reserve(number);
+    m_obs_id.reserve(number);
+
+    // Reserve shower parameter columns
+    if (m_has_shower) {
+        m_multip.reserve(number);
+        m_telmask.reserve(number);
+        m_dir_err.reserve(number);
+        m_alt.reserve(number);
+        m_az.reserve(number);
+        m_corex.reserve(number);
+        m_corey.reserve(number);
+        m_core_err.reserve(number);
+        m_xmax.reserve(number);
+        m_xmax_err.reserve(number);
+        m_shwidth.reserve(number);
+        m_shlength.reserve(number);
+        m_energy_err.reserve(number);
+    }
+
+    // Reserve Hillas parameter columns
+    if (m_has_hillas) {
+        m_hil_msw.reserve(number);
+        m_hil_msw_err.reserve(number);
+        m_hil_msl.reserve(number);
+        m_hil_msl_err.reserve(number);
+    }
+
+    // Reserve phase column
+    if (m_has_phase) {
+        m_phase.reserve(number);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Resize event columns
+ *
+ * @param[in] number Number of events.
+ *
+ * Resizes the mandatory columns and all optional columns that are present
+ * to @p number events. New events are initialised to zero. The IRF cache
+ * is cleared.
+ ***************************************************************************/
+void GCTAEventList::resize_events(const int& number)
+{
+    // Read deferred optional columns
+    read_deferred();
+
+    // Resize mandatory columns
+    m_ra.resize(number, 0.0);
+    m_dec.resize(number, 0.0);
+    m_detx.resize(number, 0.0);
+    m_dety.resize(number, 0.0);
+    m_energy.resize(number, 0.0);
+    m_time.resize(number, 0.0);
+    m_event_id.resize(number, 0);
+    m_obs_id.resize(number, 0);
+
+    // Resize shower parameter columns
+    if (m_has_shower) {
+        m_multip.resize(number, 0);
+        m_telmask.resize(number, 0);
+        m_dir_err.resize(number, 0.0);
+        m_alt.resize(number, 0.0);
+        m_az.resize(number, 0.0);
+        m_corex.resize(number, 0.0);
+        m_corey.resize(number, 0.0);
+        m_core_err.resize(number, 0.0);
+        m_xmax.resize(number, 0.0);
+        m_xmax_err.resize(number, 0.0);
+        m_shwidth.resize(number, 0.0);
+        m_shlength.resize(number, 0.0);
+        m_energy_err.resize(number, 0.0);
+    }
+
+    // Resize Hillas parameter columns
+    if (m_has_hillas) {
+        m_hil_msw.resize(number, 0.0);
+        m_hil_msw_err.resize(number, 0.0);
+        m_hil_msl.resize(number, 0.0);
+        m_hil_msl_err.resize(number, 0.0);
+    }
+
+    // Resize phase column
+    if (m_has_phase) {
+        m_phase.resize(number, 0.0);
+    }
+
+    // Clear IRF cache as its vectors are sized to the number of events
+    irf_cache_clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate shower parameter columns
+ *
+ * Allocates the shower parameter columns for all events in the list and
+ * initialises them to zero. The method does nothing if the columns exist
+ * already.
+ ***************************************************************************/
+void GCTAEventList::alloc_shower(void)
+{
+    // Continue only if columns do not yet exist
+    if (!m_has_shower) {
+
+        // Signal presence of shower parameters
+        m_has_shower = true;
+
+        // Allocate columns
+        int num = size();
+        m_multip.assign(num, 0);
+        m_telmask.assign(num, 0);
+        m_dir_err.assign(num, 0.0);
+        m_alt.assign(num, 0.0);
+        m_az.assign(num, 0.0);
+        m_corex.assign(num, 0.0);
+        m_corey.assign(num, 0.0);
+        m_core_err.assign(num, 0.0);
+        m_xmax.assign(num, 0.0);
+        m_xmax_err.assign(num, 0.0);
+        m_shwidth.assign(num, 0.0);
+        m_shlength.assign(num, 0.0);
+        m_energy_err.assign(num, 0.0);
+
+    } // endif: columns did not exist
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate Hillas parameter columns
+ *
+ * Allocates the Hillas parameter columns for all events in the list and
+ * initialises them to zero. The method does nothing if the columns exist
+ * already.
+ ***************************************************************************/
+void GCTAEventList::alloc_hillas(void)
+{
+    // Continue only if columns do not yet exist
+    if (!m_has_hillas) {
+
+        // Signal presence of Hillas parameters
+        m_has_hillas = true;
+
+        // Allocate columns
+        int num = size();
+        m_hil_msw.assign(num, 0.0);
+        m_hil_msw_err.assign(num, 0.0);
+        m_hil_msl.assign(num, 0.0);
+        m_hil_msl_err.assign(num, 0.0);
+
+    } // endif: columns did not exist
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Allocate phase column
+ *
+ * Allocates the pulse phase column for all events in the list and
+ * initialises it to zero. The method does nothing if the column exists
+ * already.
+ ***************************************************************************/
+void GCTAEventList::alloc_phase(void)
+{
+    // Continue only if column does not yet exist
+    if (!m_has_phase) {
+
+        // Signal presence of phase
+        m_has_phase = true;
+
+        // Allocate column
+        m_phase.assign(size(), 0.0);
+
+    } // endif: column did not exist
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Fill event atom
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in,out] atom Event atom.
+ *
+ * Fills the event @p atom with the event of the specified @p index.
+ * Optional information that is not stored in the event list is set to
+ * zero. Apart from reading deferred optional columns the method only
+ * reads the event columns.
+ ***************************************************************************/
+void GCTAEventList::set_atom(const int& index, GCTAEventAtom* atom) const
+{
+    // Read deferred optional columns
+    read_deferred();
+
+    // Set mandatory information
+    atom->m_index    = index;
+    atom->m_dir.dir().radec(m_ra[index], m_dec[index]);
+    atom->m_dir.detx(m_detx[index]);
+    atom->m_dir.dety(m_dety[index]);
+    atom->m_energy.MeV(m_energy[index]);
+    atom->m_time.secs(m_time[index]);
+    atom->m_event_id = m_event_id[index];
+    atom->m_obs_id   = m_obs_id[index];
+
+    // Set shower parameters
+    if (m_has_shower) {
+        atom->m_multip     = m_multip[index];
+        atom->m_telmask    = m_telmask[index];
+        atom->m_dir_err    = m_dir_err[index];
+        atom->m_alt        = m_alt[index];
+        atom->m_az         = m_az[index];
+        atom->m_corex      = m_corex[index];
+        atom->m_corey      = m_corey[index];
+        atom->m_core_err   = m_core_err[index];
+        atom->m_xmax       = m_xmax[index];
+        atom->m_xmax_err   = m_xmax_err[index];
+        atom->m_shwidth    = m_shwidth[index];
+        atom->m_shlength   = m_shlength[index];
+        atom->m_energy_err = m_energy_err[index];
+    }
+    else {
+        atom->m_multip     = 0;
+        atom->m_telmask    = 0;
+        atom->m_dir_err    = 0.0;
+        atom->m_alt        = 0.0;
+        atom->m_az         = 0.0;
+        atom->m_corex      = 0.0;
+        atom->m_corey      = 0.0;
+        atom->m_core_err   = 0.0;
+        atom->m_xmax       = 0.0;
+        atom->m_xmax_err   = 0.0;
+        atom->m_shwidth    = 0.0;
+        atom->m_shlength   = 0.0;
+        atom->m_energy_err = 0.0;
+    }
+
+    // Set Hillas parameters
+    if (m_has_hillas) {
+        atom->m_hil_msw     = m_hil_msw[index];
+        atom->m_hil_msw_err = m_hil_msw_err[index];
+        atom->m_hil_msl     = m_hil_msl[index];
+        atom->m_hil_msl_err = m_hil_msl_err[index];
+    }
+    else {
+        atom->m_hil_msw     = 0.0;
+        atom->m_hil_msw_err = 0.0;
+        atom->m_hil_msl     = 0.0;
+        atom->m_hil_msl_err = 0.0;
+    }
+
+    // Set phase
+    atom->m_phase = (m_has_phase) ? m_phase[index] : 0.0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Store event atom in event columns
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] atom Event atom.
+ *
+ * Stores the event atom at the specified @p index of the event columns.
+ * Optional columns are allocated if the event atom holds non-zero values
+ * for information that is not yet stored in the event list.
+ ***************************************************************************/
+void GCTAEventList::write_atom(const int& index, const GCTAEventAtom& atom)
+{
+    // Read deferred optional columns
+    read_deferred();
+
+    // Allocate shower parameter columns if needed
+    if (!m_has_shower &&
+        (atom.m_multip   != 0   || atom.m_telmask    != 0   ||
+         atom.m_dir_err  != 0.0 || atom.m_alt        != 0.0 ||
+         atom.m_az       != 0.0 || atom.m_corex      != 0.0 ||
+         atom.m_corey    != 0.0 || atom.m_core_err   != 0.0 ||
+         atom.m_xmax     != 0.0 || atom.m_xmax_err   != 0.0 ||
+         atom.m_shwidth  != 0.0 || atom.m_shlength   != 0.0 ||
+         atom.m_energy_err != 0.0)) {
+        alloc_shower();
+    }
+
+    // Allocate Hillas parameter columns if needed
+    if (!m_has_hillas &&
+        (atom.m_hil_msw != 0.0 || atom.m_hil_msw_err != 0.0 ||
+         atom.m_hil_msl != 0.0 || atom.m_hil_msl_err != 0.0)) {
+        alloc_hillas();
+    }
+
+    // Allocate phase column if needed
+    if (!m_has_phase && atom.m_phase != 0.0) {
+        alloc_phase();
+    }
+
+    // Store mandatory information
+    m_ra[index]       = atom.m_dir.dir().ra();
+    m_dec[index]      = atom.m_dir.dir().dec();
+    m_detx[index]     = atom.m_dir.detx();
+    m_dety[index]     = atom.m_dir.dety();
+    m_energy[index]   = atom.m_energy.MeV();
+    m_time[index]     = atom.m_time.secs();
+    m_event_id[index] = atom.m_event_id;
+    m_obs_id[index]   = atom.m_obs_id;
+
+    // Store shower parameters
+    if (m_has_shower) {
+        m_multip[index]     = atom.m_multip;
+        m_telmask[index]    = atom.m_telmask;
+        m_dir_err[index]    = atom.m_dir_err;
+        m_alt[index]        = atom.m_alt;
+        m_az[index]         = atom.m_az;
+        m_corex[index]      = atom.m_corex;
+        m_corey[index]      = atom.m_corey;
+        m_core_err[index]   = atom.m_core_err;
+        m_xmax[index]       = atom.m_xmax;
+        m_xmax_err[index]   = atom.m_xmax_err;
+        m_shwidth[index]    = atom.m_shwidth;
+        m_shlength[index]   = atom.m_shlength;
+        m_energy_err[index] = atom.m_energy_err;
+    }
+
+    // Store Hillas parameters
+    if (m_has_hillas) {
+        m_hil_msw[index]     = atom.m_hil_msw;
+        m_hil_msw_err[index] = atom.m_hil_msw_err;
+        m_hil_msl[index]     = atom.m_hil_msl;
+        m_hil_msl_err[index] = atom.m_hil_msl_err;
+    }
+
+    // Store phase
+    if (m_has_phase) {
+        m_phase[index] = atom.m_phase;
+    }
+
+    // Update event atom view if one exists for the modified event
+    std::map<int,GCTAEventAtom*>::iterator it = m_atoms.find(index);
+    if (it != m_atoms.end() && it->second != &atom) {
+        *(it->second)       = atom;
+        it->second->m_index = index;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Write back event atom views
+ *
+ * Writes the event atom views back into the event columns if they may
+ * have been modified through the non-const access operator. The views are
+ * logically part of the event list, hence writing them back does not
+ * change the state of the event list and the method is declared const.
+ * As the caller may still modify the views, they remain flagged as
+ * modifiable.
+ ***************************************************************************/
+void GCTAEventList::flush_atoms(void) const
+{
+    // Continue only if the views may have been modified
+    if (m_atoms_dirty) {
+
+        // Write back views
+        std::map<int,GCTAEventAtom*>::const_iterator it;
+        for (it = m_atoms.begin(); it != m_atoms.end(); ++it) {
+            const_cast<GCTAEventList*>(this)->write_atom(it->first, *(it->second));
+        }
+
+    } // endif: views may have been modified
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Free event atom views
+ *
+ * Deletes all event atom views that were built by the access operators.
+ * Pointers to event atoms that were returned by the access operators are
+ * no longer valid after calling this method.
+ ***************************************************************************/
+void GCTAEventList::free_atoms(void)
+{
+    // Delete views
+    std::map<int,GCTAEventAtom*>::iterator it;
+    for (it = m_atoms.begin(); it != m_atoms.end(); ++it) {
+        delete it->second;
+    }
+
+    // Clear views
+    m_atoms.clear();
+    m_atoms_dirty = false;
+
+    // Return
+    return;
+}
@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 #include "GTools.hpp"
+#include "GVector.hpp"
 #include "GModelRegistry.hpp"
 #include "GModelSpectralRegistry.hpp"
 #include "GModelTemporalRegistry.hpp"
@@ -46,7 +47,7 @@ const GModelRegistry          g_cta_inst_background_registry(&g_cta_inst_backgro
 /* __ Method name definitions ____________________________________________ */
 #define G_EVAL        "GCTAModelCubeBackground::eval(GEvent&, GObservation&)"
 #define G_EVAL_GRADIENTS   "GCTAModelCubeBackground::eval_gradients(GEvent&,"\
-                                                            " GObservation&)"
+                                            " GObservation&, GVector&, int&)"
 #define G_NPRED            "GCTAModelCubeBackground::npred(GEnergy&, GTime&,"\
                                                             " GObservation&)"
 #define G_MC              "GCTAModelCubeBackground::mc(GObservation&, GRan&)"
@@ -309,11 +310,42 @@ double GCTAModelCubeBackground::eval(const GEvent&       event,
  * @param[in] obs Observation.
  * @return Function value.
  *
+ * Evaluates the function and sets the parameter gradients through
+ * GModelPar::factor_gradient().
+ ***************************************************************************/
+double GCTAModelCubeBackground::eval_gradients(const GEvent&       event,
+                                               const GObservation& obs) const
+{
+    // Evaluate function and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(event, obs, gradients);
+
+    // Set parameter gradients
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
+
+    // Return value
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate function and store gradients in vector
+ *
+ * @param[in] event Observed event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first model parameter gradient (default: 0).
+ * @return Function value.
+ *
  * @exception GException::invalid_argument
  *            Specified observation is not of the expected type.
  ***************************************************************************/
 double GCTAModelCubeBackground::eval_gradients(const GEvent&       event,
-                                               const GObservation& obs) const
+                                              const GObservation& obs,
+                                              GVector&            gradients,
+                                              const int&          offset) const
 {
     // Get pointer on CTA observation
     const GCTAObservation* cta = dynamic_cast<const GCTAObservation*>(&obs);
@@ -344,12 +376,16 @@ double GCTAModelCubeBackground::eval_gradients(const GEvent&       event,
     // Evaluate function
     double logE = event.energy().log10TeV();
     double spat = bgd((*dir), event.energy());
-    double spec = (spectral() != NULL)
-                  ? spectral()->eval_gradients(event.energy(), event.time())
-                  : 1.0;
-    double temp = (temporal() != NULL)
-                  ? temporal()->eval_gradients(event.time())
-                  : 1.0;
+    int    n_spec = (spectral() != NULL) ? spectral()->size() : 0;
+    int    n_temp = (temporal() != NULL) ? temporal()->size() : 0;
+    double spec   = (spectral() != NULL)
+                    ? spectral()->eval_gradients(event.energy(), event.time(),
+                                                 gradients, offset)
+                    : 1.0;
+    double temp   = (temporal() != NULL)
+                    ? temporal()->eval_gradients(event.time(), gradients,
+                                                 offset+n_spec)
+                    : 1.0;
 
     // Compute value
     double value = spat * spec * temp;
@@ -359,20 +395,18 @@ double GCTAModelCubeBackground::eval_gradients(const GEvent&       event,
     value       *= deadc;
 
     // Multiply factors to spectral gradients
-    if (spectral() != NULL) {
-        double fact = spat * temp * deadc;
-        if (fact != 1.0) {
-            for (int i = 0; i < spectral()->size(); ++i)
-                (*spectral())[i].factor_gradient( (*spectral())[i].factor_gradient() * fact );
+    double fact = spat * temp * deadc;
+    if (fact != 1.0) {
+        for (int i = 0; i < n_spec; ++i) {
+            gradients[offset+i] *= fact;
         }
     }
 
     // Multiply factors to temporal gradients
-    if (temporal() != NULL) {
-        double fact = spat * spec * deadc;
-        if (fact != 1.0) {
-            for (int i = 0; i < temporal()->size(); ++i)
-                (*temporal())[i].factor_gradient( (*temporal())[i].factor_gradient() * fact );
+    fact = spat * spec * deadc;
+    if (fact != 1.0) {
+        for (int i = 0; i < n_temp; ++i) {
+            gradients[offset+n_spec+i] *= fact;
         }
     }
 
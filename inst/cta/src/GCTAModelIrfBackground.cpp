@@ -29,6 +29,7 @@
 #include <config.h>
 #endif
 #include "GTools.hpp"
+#include "GVector.hpp"
 #include "GMath.hpp"
 #include "GIntegral.hpp"
 #include "GModelRegistry.hpp"
@@ -48,7 +49,7 @@ const GModelRegistry         g_cta_inst_background_registry(&g_cta_inst_backgrou
 /* __ Method name definitions ____________________________________________ */
 #define G_EVAL         "GCTAModelIrfBackground::eval(GEvent&, GObservation&)"
 #define G_EVAL_GRADIENTS    "GCTAModelIrfBackground::eval_gradients(GEvent&,"\
-                                                            " GObservation&)"
+                                            " GObservation&, GVector&, int&)"
 #define G_NPRED             "GCTAModelIrfBackground::npred(GEnergy&, GTime&,"\
                                                             " GObservation&)"
 #define G_MC               "GCTAModelIrfBackground::mc(GObservation&, GRan&)"
@@ -344,13 +345,44 @@ double GCTAModelIrfBackground::eval(const GEvent& event,
  * @param[in] obs Observation.
  * @return Function value.
  *
+ * Evaluates the function and sets the parameter gradients through
+ * GModelPar::factor_gradient().
+ ***************************************************************************/
+double GCTAModelIrfBackground::eval_gradients(const GEvent& event,
+                                              const GObservation& obs) const
+{
+    // Evaluate function and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(event, obs, gradients);
+
+    // Set parameter gradients
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
+
+    // Return value
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate function and store gradients in vector
+ *
+ * @param[in] event Observed event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first model parameter gradient (default: 0).
+ * @return Function value.
+ *
  * @exception GException::invalid_argument
  *            Specified observation is not of the expected type.
  *
  * @todo Make sure that DETX and DETY are always set in GCTAInstDir.
  ***************************************************************************/
-double GCTAModelIrfBackground::eval_gradients(const GEvent& event,
-                                              const GObservation& obs) const
+double GCTAModelIrfBackground::eval_gradients(const GEvent&       event,
+                                             const GObservation& obs,
+                                             GVector&            gradients,
+                                             const int&          offset) const
 {
     // Get pointer on CTA observation
     const GCTAObservation* cta = dynamic_cast<const GCTAObservation*>(&obs);
@@ -389,12 +421,16 @@ double GCTAModelIrfBackground::eval_gradients(const GEvent& event,
     // Evaluate function
     double logE = event.energy().log10TeV();
     double spat = (*bgd)(logE, inst_dir.detx(), inst_dir.dety());
-    double spec = (spectral() != NULL)
-                  ? spectral()->eval_gradients(event.energy(), event.time())
-                  : 1.0;
-    double temp = (temporal() != NULL)
-                  ? temporal()->eval_gradients(event.time())
-                  : 1.0;
+    int    n_spec = (spectral() != NULL) ? spectral()->size() : 0;
+    int    n_temp = (temporal() != NULL) ? temporal()->size() : 0;
+    double spec   = (spectral() != NULL)
+                    ? spectral()->eval_gradients(event.energy(), event.time(),
+                                                 gradients, offset)
+                    : 1.0;
+    double temp   = (temporal() != NULL)
+                    ? temporal()->eval_gradients(event.time(), gradients,
+                                                 offset+n_spec)
+                    : 1.0;
 
     // Compute value
     double value = spat * spec * temp;
@@ -404,20 +440,18 @@ double GCTAModelIrfBackground::eval_gradients(const GEvent& event,
     value       *= deadc;
 
     // Multiply factors to spectral gradients
-    if (spectral() != NULL) {
-        double fact = spat * temp * deadc;
-        if (fact != 1.0) {
-            for (int i = 0; i < spectral()->size(); ++i)
-                (*spectral())[i].factor_gradient( (*spectral())[i].factor_gradient() * fact );
+    double fact = spat * temp * deadc;
+    if (fact != 1.0) {
+        for (int i = 0; i < n_spec; ++i) {
+            gradients[offset+i] *= fact;
         }
     }
 
     // Multiply factors to temporal gradients
-    if (temporal() != NULL) {
-        double fact = spat * spec * deadc;
-        if (fact != 1.0) {
-            for (int i = 0; i < temporal()->size(); ++i)
-                (*temporal())[i].factor_gradient( (*temporal())[i].factor_gradient() * fact );
+    fact = spat * spec * deadc;
+    if (fact != 1.0) {
+        for (int i = 0; i < n_temp; ++i) {
+            gradients[offset+n_spec+i] *= fact;
         }
     }
 
@@ -28,6 +28,9 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GObservationRegistry.hpp"
 #include "GException.hpp"
 #include "GFits.hpp"
@@ -266,6 +269,9 @@ void GCTAObservation::response(const GResponse& rsp)
     if (m_response != NULL) delete m_response;
     m_response = NULL;
 
+    // Clear Nroi cache as it depends on the response
+    nroi_cache_clear();
+
     // Get pointer on CTA response
     const GCTAResponse* cta = dynamic_cast<const GCTAResponse*>(&rsp);
     if (cta == NULL) {
@@ -323,6 +329,9 @@ void GCTAObservation::response(const std::string& rspname, const GCaldb& caldb)
     if (m_response != NULL) delete m_response;
     m_response = NULL;
 
+    // Clear Nroi cache as it depends on the response
+    nroi_cache_clear();
+
     // Allocate fresh response function
     GCTAResponseIrf* rsp = new GCTAResponseIrf;
 
@@ -360,6 +369,9 @@ void GCTAObservation::response(const GCTACubeExposure&   expcube,
     if (m_response != NULL) delete m_response;
     m_response = NULL;
 
+    // Clear Nroi cache as it depends on the response
+    nroi_cache_clear();
+
     // Allocate fresh response function
     GCTAResponseCube* rsp = new GCTAResponseCube(expcube, psfcube, bkgcube);
 
@@ -1055,6 +1067,7 @@ void GCTAObservation::read(const GFits& fits)
 {
     // Delete any existing event container (do not call clear() as we do not
     // want to delete the response function)
+    events_unregister();
     if (m_events != NULL) delete m_events;
     m_events = NULL;
 
@@ -1250,6 +1263,7 @@ void GCTAObservation::save(const std::string& filename, const bool& clobber) con
 void GCTAObservation::events(const GEvents& events)
 {
     // Remove an existing event container
+    events_unregister();
     if (m_events != NULL) delete m_events;
 
     // Clone events
@@ -1274,24 +1288,38 @@ void GCTAObservation::events(const GEvents& events)
  * Returns a pointer to the event container. If no events exist the method
  * tries to fetch events from the file specified by the m_eventfile member.
  * If this fails, an exception will be thrown.
+ *
+ * The method may be called concurrently from several threads. Events of
+ * different observations are loaded in parallel if cfitsio is reentrant.
+ *
+ * The returned pointer remains valid until the events are disposed
+ * explicitly. If the method is called while the observation is evaluated
+ * by likelihood(), the pointer is only guaranteed to remain valid until
+ * the end of the evaluation, as the events may then be disposed to satisfy
+ * the memory limit set by events_max_memory(). Events that are accessed
+ * outside a likelihood evaluation are removed from memory management.
  ***************************************************************************/
 const GEvents* GCTAObservation::events(void) const
 {
-    // If event container is offline then bring it online now
-    if (m_events == NULL) {
-
-        // Try loading the events from FITS file. Catch any exception. Put
-        // the code into a critical zone as it might be called from within
-        // a parallelized thread.
-        #pragma omp critical
-        {
-        try {
-                const_cast<GCTAObservation*>(this)->load(m_eventfile);
-        }
-        catch (...) {
-            ;
-        }
-        }
+    // Get flag that signals that the events are online and are not disposed
+    // by the memory management. Events flagged as valid are returned without
+    // acquiring any lock.
+    int valid = 0;
+    #pragma omp atomic read
+    valid = m_events_valid;
+
+    // If events are valid then make sure that the event pointer is read
+    // after the flag ...
+    if (valid != 0) {
+        #pragma omp flush
+    }
+
+    // ... otherwise load the events if they are offline and protect them
+    // from disposal
+    if (valid == 0 || m_events == NULL) {
+
+        // Load the events from the FITS file
+        events_load();
 
         // Throw an exception if the event container is still not valid
         if (m_events == NULL) {
@@ -1325,6 +1353,7 @@ const GEvents* GCTAObservation::events(void) const
 void GCTAObservation::dispose_events(void)
 {
     // Delete any existing event container
+    events_unregister();
     if (m_events != NULL) delete m_events;
 
     // Signal that we disposed the events
@@ -1335,6 +1364,295 @@ void GCTAObservation::dispose_events(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Compute likelihood function
+ *
+ * @param[in] models Models.
+ * @param[in,out] gradient Pointer to gradients.
+ * @param[in,out] curvature Pointer to curvature matrix.
+ * @param[in,out] npred Pointer to Npred value.
+ * @return Likelihood.
+ *
+ * Computes the likelihood using GObservation::likelihood(). While the
+ * likelihood is computed the events are flagged as being in use, so that
+ * they are not disposed to satisfy the memory limit set by
+ * events_max_memory().
+ *
+ * Before the events are evaluated, the IRF cache keys of the models are
+ * set once, so that the evaluation of the events only reads and stores
+ * IRF cache values (see GCTAResponseIrf::irf_cache_keys()). The keys are
+ * released after the evaluation, as the model parameters may be modified
+ * before the next evaluation. For a cube response, the pre-computation
+ * cache of the diffuse models is filled before the event bins are
+ * evaluated (see GCTAResponseCube::irf_caches()).
+ ***************************************************************************/
+double GCTAObservation::likelihood(const GModels&    models,
+                                   GVector*          gradient,
+                                   GMatrixSymmetric* curvature,
+                                   double*           npred) const
+{
+    // Flag events as being in use
+    events_pin();
+
+    // Compute likelihood. Release the IRF cache keys and the events in case
+    // of an exception.
+    double value = 0.0;
+    try {
+
+        // Set IRF cache keys of models
+        const GCTAResponseIrf* rsp =
+              dynamic_cast<const GCTAResponseIrf*>(m_response);
+        if (rsp != NULL) {
+            rsp->irf_cache_keys(models, *this);
+        }
+
+        // Fill pre-computation cache of diffuse models
+        const GCTAResponseCube* cube =
+              dynamic_cast<const GCTAResponseCube*>(m_response);
+        if (cube != NULL) {
+            cube->irf_caches(models, *this);
+        }
+
+        // Compute likelihood
+        value = GObservation::likelihood(models, gradient, curvature, npred);
+    }
+    catch (...) {
+        irf_cache_release();
+        events_unpin();
+        throw;
+    }
+
+    // Release IRF cache keys and events
+    irf_cache_release();
+    events_unpin();
+
+    // Return likelihood
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Signals whether observation events may be evaluated in parallel
+ *
+ * @return True.
+ *
+ * The events of a CTA observation are accessed through event atom or bin
+ * views, and the response cubes are interpolated without modifying the
+ * response. The IRF cache values of event lists are read and stored
+ * without locking; only the allocation of cache keys, which is done by
+ * likelihood() before the events are evaluated, takes the cache lock. The
+ * pre-computation cache of the cube response is also filled by likelihood()
+ * before the events are evaluated. Hence the events of binned and unbinned
+ * observations can be evaluated in parallel.
+ ***************************************************************************/
+bool GCTAObservation::is_threadsafe(void) const
+{
+    // Return
+    return true;
+}
+
+
+/***********************************************************************//**
+ * @brief Prefetch events for evaluation
+ *
+ * Loads the events from the event file if they are offline, and reads
+ * the optional event columns whose reading is deferred until the first
+ * event access (see GCTAEventList). The events are flagged as being in use
+ * while they are loaded, so that they are put under memory management. The
+ * instrument response is loaded when it is set and hence needs no
+ * prefetching.
+ *
+ * The method is called by GObservations while the previous observation is
+ * evaluated. Any exception is caught, so that the events are loaded again
+ * on access, which then reports the error.
+ ***************************************************************************/
+void GCTAObservation::prefetch(void) const
+{
+    // Flag events as being in use
+    events_pin();
+
+    // Load events and access the first event of an event list. Catch any
+    // exception.
+    try {
+        events_load();
+        const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(m_events);
+        if (list != NULL && list->size() > 0) {
+            GCTAEventAtom view;
+            list->atom(0, &view);
+        }
+    }
+    catch (...) {
+        ;
+    }
+
+    // Release events
+    events_unpin();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set memory limit for event lists loaded on demand
+ *
+ * @param[in] mbytes Memory limit (Mbytes; 0 for no limit).
+ *
+ * Sets the maximum amount of memory that may be used by the event lists
+ * of all CTA observations that were loaded on demand from an event file.
+ * If the limit is exceeded, the event lists of the least recently used
+ * observations are disposed. Disposed event lists are reloaded on the next
+ * access. Event lists that were set explicitly are not affected.
+ ***************************************************************************/
+void GCTAObservation::events_max_memory(const double& mbytes)
+{
+    // Set limit and dispose event lists if the limit is exceeded
+    #pragma omp critical(GCTAObservation_events)
+    {
+        events_limit() = (mbytes > 0.0) ? mbytes * 1048576.0 : 0.0;
+        events_evict(NULL);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return memory limit for event lists loaded on demand
+ *
+ * @return Memory limit (Mbytes; 0 for no limit).
+ ***************************************************************************/
+double GCTAObservation::events_max_memory(void)
+{
+    // Get limit
+    double limit = 0.0;
+    #pragma omp critical(GCTAObservation_events)
+    {
+        limit = events_limit();
+    }
+
+    // Return limit in Mbytes
+    return (limit / 1048576.0);
+}
+
+
+/***********************************************************************//**
+ * @brief Return memory used by event lists loaded on demand
+ *
+ * @return Memory used by event lists loaded on demand (Mbytes).
+ ***************************************************************************/
+double GCTAObservation::events_memory(void)
+{
+    // Get memory
+    double memory = 0.0;
+    #pragma omp critical(GCTAObservation_events)
+    {
+        memory = events_total();
+    }
+
+    // Return memory in Mbytes
+    return (memory / 1048576.0);
+}
+
+
+/***********************************************************************//**
+ * @brief Get cached Nroi value
+ *
+ * @param[in] name Model name.
+ * @param[in] energy True photon energy.
+ * @return Nroi value (-1 if no cache value found).
+ *
+ * Returns the spatially integrated response of a model that was stored
+ * for the given energy using nroi_cache(). The cached value depends only
+ * on the spatial model, the pointing, the ROI and the response, hence it
+ * remains valid as long as the cache key set by nroi_cache_key() does not
+ * change.
+ ***************************************************************************/
+double GCTAObservation::nroi_cache(const std::string& name,
+                                   const GEnergy&     energy) const
+{
+    // Initialise Nroi value to invalid value
+    double nroi = -1.0;
+
+    // Serialise lookup
+    #pragma omp critical(GCTAObservation_nroi_cache)
+    {
+        std::map<std::string,std::map<double,double> >::const_iterator it =
+            m_nroi_values.find(name);
+        if (it != m_nroi_values.end()) {
+            std::map<double,double>::const_iterator value =
+                it->second.find(energy.MeV());
+            if (value != it->second.end()) {
+                nroi = value->second;
+            }
+        }
+    }
+
+    // Return Nroi value
+    return nroi;
+}
+
+
+/***********************************************************************//**
+ * @brief Set cached Nroi value
+ *
+ * @param[in] name Model name.
+ * @param[in] energy True photon energy.
+ * @param[in] nroi Nroi value.
+ *
+ * Stores the spatially integrated response of a model for a given energy.
+ * The values are stored at the energies at which they were computed, which
+ * are the same in each iteration of a fit since the Npred integration uses
+ * a fixed number of iterations.
+ ***************************************************************************/
+void GCTAObservation::nroi_cache(const std::string& name,
+                                 const GEnergy&     energy,
+                                 const double&      nroi) const
+{
+    // Serialise insertion
+    #pragma omp critical(GCTAObservation_nroi_cache)
+    {
+        m_nroi_values[name][energy.MeV()] = nroi;
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Nroi cache key
+ *
+ * @param[in] name Model name.
+ * @param[in] key Cache key.
+ *
+ * Sets the key for the cached Nroi values of a model. The key is typically
+ * composed of the spatial model parameter values and of all observation
+ * attributes on which the Nroi values depend. If the key differs from the
+ * key that was set before, all cached Nroi values of the model are
+ * invalidated.
+ ***************************************************************************/
+void GCTAObservation::nroi_cache_key(const std::string&         name,
+                                     const std::vector<double>& key) const
+{
+    // Serialise key update
+    #pragma omp critical(GCTAObservation_nroi_cache)
+    {
+        // If the key has changed then store key and invalidate the cached
+        // values
+        std::vector<double>& current = m_nroi_keys[name];
+        if (current != key) {
+            current = key;
+            m_nroi_values.erase(name);
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print CTA observation information
  *
@@ -1446,6 +1764,24 @@ void GCTAObservation::init_members(void)
     m_hi_user_thres = 0.0;
     m_n_tels        = 0;
 
+    // Initialise event memory management
+    m_events_managed = false;
+    m_events_memory  = 0.0;
+    m_events_used    = 0;
+    m_events_pins    = 0;
+    m_events_valid   = 0;
+    #ifdef _OPENMP
+    omp_lock_t* lock = new omp_lock_t;
+    omp_init_lock(lock);
+    m_events_lock = lock;
+    #else
+    m_events_lock = NULL;
+    #endif
+
+    // Initialise Nroi cache
+    m_nroi_keys.clear();
+    m_nroi_values.clear();
+
     // Return
     return;
 }
@@ -1477,6 +1813,13 @@ void GCTAObservation::copy_members(const GCTAObservation& obs)
     // Clone members
     m_response = (obs.m_response != NULL) ? obs.m_response->clone() : NULL;
 
+    // Copy Nroi cache
+    m_nroi_keys   = obs.m_nroi_keys;
+    m_nroi_values = obs.m_nroi_values;
+
+    // Events of the copy are not memory managed since they are a clone of
+    // the events of the original observation
+
     // Return
     return;
 }
@@ -1487,11 +1830,21 @@ void GCTAObservation::copy_members(const GCTAObservation& obs)
  ***************************************************************************/
 void GCTAObservation::free_members(void)
 {
+    // Remove events from memory management
+    events_unregister();
+
     // Free memory
     if (m_response != NULL) delete m_response;
+    #ifdef _OPENMP
+    if (m_events_lock != NULL) {
+        omp_destroy_lock(static_cast<omp_lock_t*>(m_events_lock));
+        delete static_cast<omp_lock_t*>(m_events_lock);
+    }
+    #endif
 
     // Initialise pointers
-    m_response = NULL;
+    m_response    = NULL;
+    m_events_lock = NULL;
 
     // Return
     return;
@@ -1689,3 +2042,315 @@ void GCTAObservation::set_event_type(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Release IRF cache keys
+ *
+ * Releases the IRF cache keys of the event list, so that cached IRF values
+ * are only used by evaluations for which the keys were set (see
+ * GCTAEventList::irf_cache_release()).
+ ***************************************************************************/
+void GCTAObservation::irf_cache_release(void) const
+{
+    // Release IRF cache keys if the events are an event list
+    const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(m_events);
+    if (list != NULL) {
+        list->irf_cache_release();
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Load events from event file
+ *
+ * Loads the events from the event file if they are not yet loaded. The
+ * method holds a lock of the observation, so that concurrent calls load
+ * the events only once, while events of different observations may be
+ * loaded in parallel. If cfitsio is not reentrant, the loading of event
+ * files is serialised over all observations.
+ *
+ * Event lists loaded by this method while the observation is evaluated
+ * are subject to the memory limit set by events_max_memory(). If the
+ * method is called outside an evaluation, the events are removed from
+ * memory management, since the caller may keep a pointer to them.
+ ***************************************************************************/
+void GCTAObservation::events_load(void) const
+{
+    // Acquire observation lock
+    #ifdef _OPENMP
+    omp_set_lock(static_cast<omp_lock_t*>(m_events_lock));
+    #endif
+
+    // Protect online events from disposal if the observation is not
+    // evaluated, and check whether the events are offline
+    bool offline = false;
+    #pragma omp critical(GCTAObservation_events)
+    {
+        if (m_events_pins == 0) {
+            events_remove();
+        }
+        events_update();
+        offline = (m_events == NULL);
+    }
+
+    // Continue only if events are offline
+    if (offline) {
+
+        // Load events. Catch any exception. Exceptions must not leave
+        // the critical zone.
+        if (gammalib::fits_is_reentrant()) {
+            try {
+                const_cast<GCTAObservation*>(this)->load(m_eventfile);
+            }
+            catch (...) {
+                ;
+            }
+        }
+        else {
+            #pragma omp critical(GCTAObservation_events_load)
+            {
+            try {
+                const_cast<GCTAObservation*>(this)->load(m_eventfile);
+            }
+            catch (...) {
+                ;
+            }
+            }
+        }
+
+        // Put loaded events under memory management
+        if (m_events != NULL) {
+            events_register();
+        }
+
+    } // endif: events were offline
+
+    // Release observation lock
+    #ifdef _OPENMP
+    omp_unset_lock(static_cast<omp_lock_t*>(m_events_lock));
+    #endif
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Put events under memory management
+ *
+ * Puts an event list under memory management if the observation is
+ * evaluated, and disposes the event lists of other observations if the
+ * memory limit is exceeded. Event cubes are not memory managed.
+ ***************************************************************************/
+void GCTAObservation::events_register(void) const
+{
+    // Get event list
+    const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(m_events);
+
+    // Register event list
+    #pragma omp critical(GCTAObservation_events)
+    {
+        if (list != NULL && !m_events_managed && m_events_pins > 0) {
+            m_events_managed = true;
+            m_events_memory  = list->memory() * 1048576.0;
+            m_events_used    = ++events_clock();
+            events_managed().push_back(this);
+            events_total() += m_events_memory;
+            events_evict(this);
+        }
+        events_update();
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Remove events from memory management
+ ***************************************************************************/
+void GCTAObservation::events_unregister(void) const
+{
+    // Unregister events
+    #pragma omp critical(GCTAObservation_events)
+    {
+        events_remove();
+        events_update();
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Flag events as being in use
+ *
+ * Flags the events as being in use, so that they are not disposed by the
+ * memory management. The method also marks the events as recently used.
+ ***************************************************************************/
+void GCTAObservation::events_pin(void) const
+{
+    // Increment usage counter
+    #pragma omp critical(GCTAObservation_events)
+    {
+        m_events_pins++;
+        m_events_used = ++events_clock();
+        events_update();
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Release events
+ *
+ * Releases the events after use and disposes the event lists of other
+ * observations if the memory limit is exceeded.
+ ***************************************************************************/
+void GCTAObservation::events_unpin(void) const
+{
+    // Decrement usage counter and enforce memory limit
+    #pragma omp critical(GCTAObservation_events)
+    {
+        m_events_pins--;
+        events_update();
+        events_evict(this);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Remove events from registry of memory managed events
+ *
+ * The method needs to be called from within the
+ * GCTAObservation_events critical zone.
+ ***************************************************************************/
+void GCTAObservation::events_remove(void) const
+{
+    // Continue only if events are managed
+    if (m_events_managed) {
+
+        // Remove events from registry
+        std::vector<const GCTAObservation*>& managed = events_managed();
+        int                                  num     = managed.size();
+        for (int i = 0; i < num; ++i) {
+            if (managed[i] == this) {
+                managed.erase(managed.begin() + i);
+                events_total() -= m_events_memory;
+                break;
+            }
+        }
+        m_events_managed = false;
+        m_events_memory  = 0.0;
+
+    } // endif: events were managed
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Update validity flag of events
+ *
+ * Sets the flag that signals to events() that the events are online and
+ * are not disposed by the memory management, which is the case if the
+ * events are not managed or if the observation is evaluated. The flag is
+ * written after a flush, so that a thread that reads the flag also sees
+ * the event pointer.
+ *
+ * The method needs to be called from within the
+ * GCTAObservation_events critical zone.
+ ***************************************************************************/
+void GCTAObservation::events_update(void) const
+{
+    // Determine flag
+    int valid = (m_events != NULL && (!m_events_managed || m_events_pins > 0))
+                ? 1 : 0;
+
+    // Write flag
+    #pragma omp flush
+    #pragma omp atomic write
+    m_events_valid = valid;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Dispose least recently used event lists
+ *
+ * @param[in] keep Observation that should be kept (NULL if none).
+ *
+ * Disposes the event lists of the least recently used observations that
+ * are not in use until the memory limit is satisfied. The events of the
+ * @p keep observation are never disposed.
+ *
+ * The method needs to be called from within the
+ * GCTAObservation_events critical zone.
+ ***************************************************************************/
+void GCTAObservation::events_evict(const GCTAObservation* keep)
+{
+    // Get registry
+    std::vector<const GCTAObservation*>& managed = events_managed();
+
+    // Dispose events until memory limit is satisfied
+    while (events_limit() > 0.0 && events_total() > events_limit()) {
+
+        // Find least recently used observation that is not in use
+        int victim = -1;
+        int num    = managed.size();
+        for (int i = 0; i < num; ++i) {
+            const GCTAObservation* obs = managed[i];
+            if (obs != keep && obs->m_events_pins == 0 &&
+                (victim < 0 || obs->m_events_used < managed[victim]->m_events_used)) {
+                victim = i;
+            }
+        }
+
+        // Break if no observation can be disposed
+        if (victim < 0) {
+            break;
+        }
+
+        // Dispose events of observation. The validity flag of managed
+        // events that are not in use is not set, hence no thread accesses
+        // the events without lock.
+        GCTAObservation* obs = const_cast<GCTAObservation*>(managed[victim]);
+        obs->events_remove();
+        delete obs->m_events;
+        obs->m_events = NULL;
+        obs->events_update();
+
+    } // endwhile: disposed events
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clear Nroi cache
+ *
+ * Removes all cached Nroi values and cache keys.
+ ***************************************************************************/
+void GCTAObservation::nroi_cache_clear(void) const
+{
+    // Clear cache
+    m_nroi_keys.clear();
+    m_nroi_values.clear();
+
+    // Return
+    return;
+}
@@ -230,15 +230,18 @@ GCTAPointing* GCTAPointing::clone(void) const
  *
  * @param[in] dir Sky direction of pointing.
  *
- * Set the pointing direction to the specified @p sky direction.
+ * Set the pointing direction to the specified @p sky direction. The
+ * coordinate transformation cache is updated immediately, so that the
+ * const methods never modify the pointing.
  ***************************************************************************/
 void GCTAPointing::dir(const GSkyDir& dir)
 {
     // Set sky direction
     m_dir = dir;
 
-    // Invalidate cache
+    // Invalidate and update cache
     m_has_cache = false;
+    update();
 
     // Return
     return;
@@ -259,10 +262,10 @@ GCTAInstDir GCTAPointing::instdir(const GSkyDir& skydir) const
 	update();
 
 	// Get celestial vector from sky coordinate
-	GVector celvector = skydir.celvector();
+	GVector3 celvector = skydir.celvector3();
 
 	// Transform to instrument system
-	GVector inst = m_Rback.transpose() * celvector;
+	GVector3 inst = m_rot.transpose() * celvector;
 
 	// Initialise instrument coordinates
     double detx(0.0);
@@ -324,10 +327,10 @@ GSkyDir GCTAPointing::skydir(const GCTAInstDir& instdir)const
     double cos_theta = std::cos(theta);
 
 	// Build vector from polar coordinates
-	GVector native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
+	GVector3 native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
 
 	// Rotate from instrument system into sky system
-	GVector skyvector = m_Rback * native;
+	GVector3 skyvector = m_rot * native;
 	GSkyDir sky;
 	sky.celvector(skyvector);
 
@@ -542,6 +545,10 @@ void GCTAPointing::read(const GXmlElement& xml)
         throw GException::invalid_value(G_READ_XML, msg);
     }
 
+    // Invalidate and update cache
+    m_has_cache = false;
+    update();
+
     // Return
     return;
 }
@@ -626,6 +633,10 @@ void GCTAPointing::init_members(void)
     // Initialise cache
     m_has_cache = false;
     m_Rback.clear();
+    m_rot       = GMatrix3();
+
+    // Set up cache for initial pointing direction
+    update();
 
     // Return
     return;
@@ -654,6 +665,7 @@ void GCTAPointing::copy_members(const GCTAPointing& pnt)
     // Copy cache
     m_has_cache = pnt.m_has_cache;
     m_Rback     = pnt.m_Rback;
+    m_rot       = pnt.m_rot;
 
     // Return
     return;
@@ -672,6 +684,10 @@ void GCTAPointing::free_members(void)
 
 /***********************************************************************//**
  * @brief Update coordinate transformation cache
+ *
+ * The cache is set up whenever the pointing direction is set, hence the
+ * calls from the const methods only check the cache flag. This allows
+ * using the same pointing from several threads.
  ***************************************************************************/
 void GCTAPointing::update(void) const
 {
@@ -679,13 +695,21 @@ void GCTAPointing::update(void) const
     if (!m_has_cache) {
 
         // Set up Euler matrices
-        GMatrix Ry;
-        GMatrix Rz;
+        GMatrix3 Ry;
+        GMatrix3 Rz;
         Ry.eulery(m_dir.dec_deg() - 90.0);
         Rz.eulerz(-m_dir.ra_deg());
 
         // Compute rotation matrix
-        m_Rback = (Ry * Rz).transpose();
+        m_rot = (Ry * Rz).transpose();
+
+        // Store rotation matrix also as general matrix
+        m_Rback = GMatrix(3,3);
+        for (int row = 0; row < 3; ++row) {
+            for (int col = 0; col < 3; ++col) {
+                m_Rback(row,col) = m_rot(row,col);
+            }
+        }
 
         // Signal that we have a valid transformation cache
         m_has_cache = true;
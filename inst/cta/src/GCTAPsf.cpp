@@ -130,6 +130,89 @@ GCTAPsf& GCTAPsf::operator= (const GCTAPsf& psf)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to the
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (radians).
+ * @param[in] phi Azimuth angle in camera system (radians).
+ * @param[in] zenith Zenith angle in Earth system (radians).
+ * @param[in] azimuth Azimuth angle in Earth system (radians).
+ * @param[in] etrue Use true energy (true/false).
+ * @return Derivative of point spread function.
+ *
+ * Computes the derivative of the point spread function with respect to
+ * @p delta using a symmetric difference. A right-sided difference is used
+ * if @p delta is smaller than the step size.
+ ***************************************************************************/
+double GCTAPsf::derivative(const double& delta,
+                           const double& logE, 
+                           const double& theta, 
+                           const double& phi,
+                           const double& zenith,
+                           const double& azimuth,
+                           const bool&   etrue) const
+{
+    // Set step size (radians)
+    const double h = 1.0e-6;
+
+    // Compute derivative
+    double derivative = 0.0;
+    if (delta >= h) {
+        double delta_min = delta - h;
+        double delta_max = delta + h;
+        derivative = ((*this)(delta_max, logE, theta, phi, zenith, azimuth, etrue) -
+                      (*this)(delta_min, logE, theta, phi, zenith, azimuth, etrue)) /
+                     (2.0 * h);
+    }
+    else {
+        double delta_max = delta + h;
+        derivative = ((*this)(delta_max, logE, theta, phi, zenith, azimuth, etrue) -
+                      (*this)(delta, logE, theta, phi, zenith, azimuth, etrue)) / h;
+    }
+
+    // Return derivative
+    return derivative;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate point spread function for arrays of arguments
+ *
+ * @param[in] num Number of argument sets.
+ * @param[in] delta Angular separations between true and measured photon
+ *            directions (radians; array of @p num values).
+ * @param[in] logE Log10 of the true photon energies (TeV; array of @p num
+ *            values).
+ * @param[in] theta Offset angles in camera system (radians; array of @p num
+ *            values).
+ * @param[out] psf Point spread function values (sr^-1; array of @p num
+ *             values).
+ *
+ * Evaluates the point spread function for @p num argument sets and writes
+ * the result into the caller provided @p psf array. The azimuth angle in
+ * the camera system and the zenith and azimuth angles in the Earth system
+ * are set to zero.
+ ***************************************************************************/
+void GCTAPsf::eval(const int&    num,
+                   const double* delta,
+                   const double* logE,
+                   const double* theta,
+                   double*       psf) const
+{
+    // Evaluate point spread function for all argument sets
+    for (int k = 0; k < num; ++k) {
+        psf[k] = (*this)(delta[k], logE[k], theta[k]);
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Private methods                              =
@@ -40,6 +40,9 @@
 /* __ Method name definitions ____________________________________________ */
 #define G_READ                                      "GCTAPsf2D::read(GFits&)"
 #define G_LOAD                                "GCTAPsf2D::load(std::string&)"
+#define G_EVAL             "GCTAPsf2D::eval(int&, double*, double*, double*,"\
+                                                                  " double*)"
+#define G_UPDATE                        "GCTAPsf2D::update(double&, double&)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -49,6 +52,7 @@
 /* __ Debug definitions __________________________________________________ */
 
 /* __ Constants __________________________________________________________ */
+const int batch_size = 64;          //!< Argument sets per table interpolation
 
 
 /*==========================================================================
@@ -181,54 +185,12 @@ double GCTAPsf2D::operator()(const double& delta,
                              const double& azimuth,
                              const bool&   etrue) const
 {
-    #if defined(G_SMOOTH_PSF)
-    // Compute offset so that PSF goes to 0 at 5 times the sigma value. This
-    // is a kluge to get a PSF that smoothly goes to zero at the edge, which
-    // prevents steps or kinks in the log-likelihood function.
-    static const double offset = std::exp(-0.5*5.0*5.0);
-    #endif
-
-    // Initialise PSF value
-    double psf = 0.0;
-
-    // Update the parameter cache
-    update(logE, theta);
-
-    // Continue only if normalization is positive
-    if (m_norm > 0.0) {
+    // Interpolate Gaussian parameters
+    gaussians pars = update(logE, theta);
 
-        // Compute distance squared
-        double delta2 = delta * delta;
+    // Compute PSF
+    double psf = this->psf(pars, delta);
 
-        // Compute Psf value
-        #if defined(G_SMOOTH_PSF)
-        psf = std::exp(m_width1 * delta2) - offset;
-        if (m_norm2 > 0.0) {
-            psf += (std::exp(m_width2 * delta2)-offset) * m_norm2;
-        }
-        if (m_norm3 > 0.0) {
-            psf += (std::exp(m_width3 * delta2)-offset) * m_norm3;
-        }
-        #else
-        psf = std::exp(m_width1 * delta2);
-        if (m_norm2 > 0.0) {
-            psf += std::exp(m_width2 * delta2) * m_norm2;
-        }
-        if (m_norm3 > 0.0) {
-            psf += std::exp(m_width3 * delta2) * m_norm3;
-        }
-        #endif
-        psf *= m_norm;
-
-        #if defined(G_SMOOTH_PSF)
-        // Make sure that PSF is non-negative
-        if (psf < 0.0) {
-            psf = 0.0;
-        }
-        #endif
-
-    } // endif: normalization was positive
-    
     // Return PSF
     return psf;
 }
@@ -430,21 +392,21 @@ double GCTAPsf2D::mc(GRan&         ran,
                      const double& azimuth,
                      const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE, theta);
+    // Interpolate Gaussian parameters
+    gaussians pars = update(logE, theta);
 
     // Select in which Gaussian we are
-    double sigma = m_sigma1;
-    double sum1  = m_sigma1;
-    double sum2  = m_sigma2 * m_norm2;
-    double sum3  = m_sigma3 * m_norm3;
+    double sigma = pars.sigma1;
+    double sum1  = pars.sigma1;
+    double sum2  = pars.sigma2 * pars.norm2;
+    double sum3  = pars.sigma3 * pars.norm3;
     double sum   = sum1 + sum2 + sum3;
     double u     = ran.uniform() * sum;
     if (sum2 > 0.0 && u >= sum2) {
-        sigma = m_sigma3;
+        sigma = pars.sigma3;
     }
     else if (sum1 > 0.0 && u >= sum1) {
-        sigma = m_sigma2;
+        sigma = pars.sigma2;
     }
 
     // Now draw from the selected Gaussian
@@ -476,13 +438,13 @@ double GCTAPsf2D::delta_max(const double& logE,
                             const double& azimuth,
                             const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE, theta);
+    // Interpolate Gaussian parameters
+    gaussians pars = update(logE, theta);
 
     // Compute maximum sigma
-    double sigma = m_sigma1;
-    if (m_sigma2 > sigma) sigma = m_sigma2;
-    if (m_sigma3 > sigma) sigma = m_sigma3;
+    double sigma = pars.sigma1;
+    if (pars.sigma2 > sigma) sigma = pars.sigma2;
+    if (pars.sigma3 > sigma) sigma = pars.sigma3;
 
     // Compute maximum PSF radius
     double radius = 5.0 * sigma;
@@ -492,6 +454,144 @@ double GCTAPsf2D::delta_max(const double& logE,
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to the
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[in] phi Azimuth angle in camera system (rad). Not used.
+ * @param[in] zenith Zenith angle in Earth system (rad). Not used.
+ * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
+ * @param[in] etrue Use true energy (true/false). Not used.
+ * @return Derivative of point spread function.
+ *
+ * Computes the analytical derivative of the sum of three Gaussians with
+ * respect to @p delta.
+ ***************************************************************************/
+double GCTAPsf2D::derivative(const double& delta,
+                             const double& logE, 
+                             const double& theta, 
+                             const double& phi,
+                             const double& zenith,
+                             const double& azimuth,
+                             const bool&   etrue) const
+{
+    #if defined(G_SMOOTH_PSF)
+    // Compute offset so that PSF goes to 0 at 5 times the sigma value. This
+    // is a kluge to get a PSF that smoothly goes to zero at the edge, which
+    // prevents steps or kinks in the log-likelihood function.
+    static const double offset = std::exp(-0.5*5.0*5.0);
+    #endif
+
+    // Initialise derivative
+    double derivative = 0.0;
+
+    // Interpolate Gaussian parameters
+    gaussians pars = update(logE, theta);
+
+    // Continue only if normalization is positive
+    if (pars.norm > 0.0) {
+
+        // Compute distance squared
+        double delta2 = delta * delta;
+
+        // Compute Gaussians
+        double exp1 = std::exp(pars.width1 * delta2);
+        double exp2 = (pars.norm2 > 0.0) ? std::exp(pars.width2 * delta2) : 0.0;
+        double exp3 = (pars.norm3 > 0.0) ? std::exp(pars.width3 * delta2) : 0.0;
+
+        // Compute derivative
+        derivative = pars.width1 * exp1;
+        if (pars.norm2 > 0.0) {
+            derivative += pars.width2 * exp2 * pars.norm2;
+        }
+        if (pars.norm3 > 0.0) {
+            derivative += pars.width3 * exp3 * pars.norm3;
+        }
+        derivative *= 2.0 * pars.norm * delta;
+
+        #if defined(G_SMOOTH_PSF)
+        // Set derivative to zero where PSF is zero
+        double psf = exp1 - offset;
+        if (pars.norm2 > 0.0) {
+            psf += (exp2 - offset) * pars.norm2;
+        }
+        if (pars.norm3 > 0.0) {
+            psf += (exp3 - offset) * pars.norm3;
+        }
+        if (psf < 0.0) {
+            derivative = 0.0;
+        }
+        #endif
+
+    } // endif: normalization was positive
+
+    // Return derivative
+    return derivative;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate point spread function for arrays of arguments
+ *
+ * @param[in] num Number of argument sets.
+ * @param[in] delta Angular separations between true and measured photon
+ *            directions (radians; array of @p num values).
+ * @param[in] logE Log10 of the true photon energies (TeV; array of @p num
+ *            values).
+ * @param[in] theta Offset angles in camera system (radians; array of @p num
+ *            values).
+ * @param[out] psf Point spread function values (sr^-1; array of @p num
+ *             values).
+ *
+ * @exception GException::invalid_value
+ *            Response table does not contain 6 parameters.
+ *
+ * Evaluates the point spread function for @p num argument sets and writes
+ * the result into the caller provided @p psf array. The Gaussian
+ * parameters are interpolated from the response table in blocks of
+ * argument sets using the batch interpolation of the response table. No
+ * memory is allocated.
+ ***************************************************************************/
+void GCTAPsf2D::eval(const int&    num,
+                     const double* delta,
+                     const double* logE,
+                     const double* theta,
+                     double*       psf) const
+{
+    // Throw an exception if the response table is not a PSF table
+    check_table(G_EVAL);
+
+    // Allocate interpolated table parameters for one block
+    double tpars[6*batch_size];
+
+    // Loop over blocks of argument sets
+    for (int k0 = 0; k0 < num; k0 += batch_size) {
+
+        // Get number of argument sets in block
+        int n = (num - k0 < batch_size) ? num - k0 : batch_size;
+
+        // Interpolate table parameters for all argument sets in block
+        m_psf(n, logE+k0, theta+k0, tpars);
+
+        // Compute PSF values for all argument sets in block
+        for (int k = 0; k < n; ++k) {
+            gaussians pars = update(tpars[n+k],   tpars[2*n+k],
+                                    tpars[3*n+k], tpars[4*n+k],
+                                    tpars[5*n+k]);
+            psf[k0+k] = this->psf(pars, delta[k0+k]);
+        }
+
+    } // endfor: looped over blocks
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print point spread function information
  *
@@ -549,17 +649,6 @@ void GCTAPsf2D::init_members(void)
     // Initialise members
     m_filename.clear();
     m_psf.clear();
-    m_par_logE  = -1.0e30;
-    m_par_theta = -1.0;
-    m_norm      = 1.0;
-    m_norm2     = 0.0;
-    m_norm3     = 0.0;
-    m_sigma1    = 0.0;
-    m_sigma2    = 0.0;
-    m_sigma3    = 0.0;
-    m_width1    = 0.0;
-    m_width2    = 0.0;
-    m_width3    = 0.0;
 
     // Return
     return;
@@ -574,19 +663,8 @@ void GCTAPsf2D::init_members(void)
 void GCTAPsf2D::copy_members(const GCTAPsf2D& psf)
 {
     // Copy members
-    m_filename  = psf.m_filename;
-    m_psf       = psf.m_psf;
-    m_par_logE  = psf.m_par_logE;
-    m_par_theta = psf.m_par_theta;
-    m_norm      = psf.m_norm;
-    m_norm2     = psf.m_norm2;
-    m_norm3     = psf.m_norm3;
-    m_sigma1    = psf.m_sigma1;
-    m_sigma2    = psf.m_sigma2;
-    m_sigma3    = psf.m_sigma3;
-    m_width1    = psf.m_width1;
-    m_width2    = psf.m_width2;
-    m_width3    = psf.m_width3;
+    m_filename = psf.m_filename;
+    m_psf      = psf.m_psf;
 
     // Return
     return;
@@ -604,69 +682,179 @@ void GCTAPsf2D::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Check that the response table holds the PSF parameters
+ *
+ * @param[in] origin Method name.
+ *
+ * @exception GException::invalid_value
+ *            Response table does not contain 6 parameters.
+ ***************************************************************************/
+void GCTAPsf2D::check_table(const std::string& origin) const
+{
+    // Throw an exception if there are not 6 parameters
+    if (m_psf.size() != 6) {
+        std::string msg = gammalib::str(m_psf.size()) + " parameters have"
+                          " been found in the response table of the"
+                          " point spread function while 6 parameters are"
+                          " expected.\n"
+                          "Possibly, the point spread function information"
+                          " has not yet been loaded. Please load the point"
+                          " spread function before using it.";
+        throw GException::invalid_value(origin, msg);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Interpolate Gaussian parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
  * @param[in] theta Offset angle in camera system (rad).
+ * @return Gaussian parameters.
+ *
+ * @exception GException::invalid_value
+ *            Response table does not contain 6 parameters.
  *
- * This method updates the PSF parameter cache.
+ * Interpolates the Gaussian parameters from the response table for the
+ * specified energy and offset angle.
  ***************************************************************************/
-void GCTAPsf2D::update(const double& logE, const double& theta) const
+GCTAPsf2D::gaussians GCTAPsf2D::update(const double& logE,
+                                       const double& theta) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE || theta != m_par_theta) {
+    // Throw an exception if the response table is not a PSF table
+    check_table(G_UPDATE);
 
-        // Save parameters
-        m_par_logE  = logE;
-        m_par_theta = theta;
+    // Interpolate response parameters
+    double tpars[6];
+    m_psf(1, &logE, &theta, tpars);
 
-        // Interpolate response parameters
-        std::vector<double> pars = m_psf(logE, theta);
+    // Return Gaussian parameters
+    return (update(tpars[1], tpars[2], tpars[3], tpars[4], tpars[5]));
+}
 
-        // Set Gaussian sigmas
-        m_sigma1 = pars[1];
-        m_sigma2 = pars[3];
-        m_sigma3 = pars[5];
 
-        // Set width parameters
-        double sigma1 = m_sigma1 * m_sigma1;
-        double sigma2 = m_sigma2 * m_sigma2;
-        double sigma3 = m_sigma3 * m_sigma3;
+/***********************************************************************//**
+ * @brief Compute Gaussian parameters
+ *
+ * @param[in] sigma1 Gaussian 1 sigma (rad).
+ * @param[in] norm2 Gaussian 2 amplitude.
+ * @param[in] sigma2 Gaussian 2 sigma (rad).
+ * @param[in] norm3 Gaussian 3 amplitude.
+ * @param[in] sigma3 Gaussian 3 sigma (rad).
+ * @return Gaussian parameters.
+ *
+ * Derives the widths and normalizations of the three Gaussians from the
+ * response table parameters.
+ ***************************************************************************/
+GCTAPsf2D::gaussians GCTAPsf2D::update(const double& sigma1,
+                                       const double& norm2,
+                                       const double& sigma2,
+                                       const double& norm3,
+                                       const double& sigma3) const
+{
+    // Initialise Gaussian parameters
+    gaussians pars;
+
+    // Set Gaussian sigmas
+    pars.sigma1 = sigma1;
+    pars.sigma2 = sigma2;
+    pars.sigma3 = sigma3;
+
+    // Set width parameters
+    double s1 = sigma1 * sigma1;
+    double s2 = sigma2 * sigma2;
+    double s3 = sigma3 * sigma3;
+
+    // Compute Gaussian 1
+    pars.width1 = (s1 > 0.0) ? -0.5 / s1 : 0.0;
+
+    // Compute Gaussian 2
+    if (s2 > 0.0) {
+        pars.width2 = -0.5 / s2;
+        pars.norm2  = norm2;
+    }
+    else {
+        pars.width2 = 0.0;
+        pars.norm2  = 0.0;
+    }
 
-        // Compute Gaussian 1
-        if (sigma1 > 0.0) {
-            m_width1 = -0.5 / sigma1;
-        }
-        else {
-            m_width1 = 0.0;
-        }
+    // Compute Gaussian 3
+    if (s3 > 0.0) {
+        pars.width3 = -0.5 / s3;
+        pars.norm3  = norm3;
+    }
+    else {
+        pars.width3 = 0.0;
+        pars.norm3  = 0.0;
+    }
 
-        // Compute Gaussian 2
-        if (sigma2 > 0.0) {
-            m_width2 = -0.5 / sigma2;
-            m_norm2  = pars[2];
+    // Compute global normalization parameter
+    double integral = gammalib::twopi * (s1 + s2*pars.norm2 + s3*pars.norm3);
+    pars.norm = (integral > 0.0) ? 1.0 / integral : 0.0;
+
+    // Return Gaussian parameters
+    return pars;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute point spread function value
+ *
+ * @param[in] pars Gaussian parameters.
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @return Point spread function value (sr^-1).
+ ***************************************************************************/
+double GCTAPsf2D::psf(const gaussians& pars, const double& delta) const
+{
+    #if defined(G_SMOOTH_PSF)
+    // Compute offset so that PSF goes to 0 at 5 times the sigma value. This
+    // is a kluge to get a PSF that smoothly goes to zero at the edge, which
+    // prevents steps or kinks in the log-likelihood function.
+    static const double offset = std::exp(-0.5*5.0*5.0);
+    #endif
+
+    // Initialise PSF value
+    double psf = 0.0;
+
+    // Continue only if normalization is positive
+    if (pars.norm > 0.0) {
+
+        // Compute distance squared
+        double delta2 = delta * delta;
+
+        // Compute Psf value
+        #if defined(G_SMOOTH_PSF)
+        psf = std::exp(pars.width1 * delta2) - offset;
+        if (pars.norm2 > 0.0) {
+            psf += (std::exp(pars.width2 * delta2)-offset) * pars.norm2;
         }
-        else {
-            m_width2 = 0.0;
-            m_norm2  = 0.0;
+        if (pars.norm3 > 0.0) {
+            psf += (std::exp(pars.width3 * delta2)-offset) * pars.norm3;
         }
-
-        // Compute Gaussian 3
-        if (sigma3 > 0.0) {
-            m_width3 = -0.5 / sigma3;
-            m_norm3  = pars[4];
+        #else
+        psf = std::exp(pars.width1 * delta2);
+        if (pars.norm2 > 0.0) {
+            psf += std::exp(pars.width2 * delta2) * pars.norm2;
         }
-        else {
-            m_width3 = 0.0;
-            m_norm3  = 0.0;
+        if (pars.norm3 > 0.0) {
+            psf += std::exp(pars.width3 * delta2) * pars.norm3;
         }
+        #endif
+        psf *= pars.norm;
 
-        // Compute global normalization parameter
-        double integral = gammalib::twopi * (sigma1 + sigma2*m_norm2 + sigma3*m_norm3);
-        m_norm = (integral > 0.0) ? 1.0 / integral : 0.0;
+        #if defined(G_SMOOTH_PSF)
+        // Make sure that PSF is non-negative
+        if (psf < 0.0) {
+            psf = 0.0;
+        }
+        #endif
 
-    }
+    } // endif: normalization was positive
 
-    // Return
-    return;
+    // Return PSF
+    return psf;
 }
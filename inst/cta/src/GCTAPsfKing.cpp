@@ -39,6 +39,8 @@
 
 /* __ Method name definitions ____________________________________________ */
 #define G_READ                                    "GCTAPsfKing::read(GFits&)"
+#define G_EVAL           "GCTAPsfKing::eval(int&, double*, double*, double*,"\
+                                                                  " double*)"
 #define G_UPDATE                      "GCTAPsfKing::update(double&, double&)"
 
 /* __ Macros _____________________________________________________________ */
@@ -52,6 +54,8 @@
 /* __ Constants __________________________________________________________ */
 const double r_max = 0.7 * gammalib::deg2rad;  // Maximum delta for fixed 
                                                // delta_max computation
+const int    batch_size = 64;                  // Argument sets per table
+                                               // interpolation
 
 
 /*==========================================================================
@@ -184,46 +188,16 @@ double GCTAPsfKing::operator()(const double& delta,
                                const double& azimuth,
                                const bool&   etrue) const
 {
-    #if defined(G_FIX_DELTA_MAX)
-    #if defined(G_SMOOTH_PSF)
-    // Set ramp down radius
-    static const double ramp_down = 0.95 * r_max;
-    static const double norm_down = 1.0 / (r_max - ramp_down);
-    #endif
-    #endif
-
-	// Initialise PSF value
-	double psf = 0.0;
+    // Initialise PSF value
+    double psf = 0.0;
 
     // Compile option: set PSF to zero outside delta_max
     #if defined(G_FIX_DELTA_MAX)
     if (delta <= r_max) {
     #endif
 
-    // Update the parameter cache
-    update(logE, theta);
-
-    // Continue only if normalization is positive
-    if (m_par_norm > 0.0) {
-
-		// Compute PSF value
-        double arg  = delta / m_par_sigma;
-        double arg2 = arg * arg;
-		psf = m_par_norm * 
-              std::pow((1.0 + 1.0 / (2.0 * m_par_gamma) * arg2), -m_par_gamma);
-
-        // If we are at large offset angles, add a smooth ramp down to
-        // avoid steps in the log-likelihood computation
-        #if defined(G_FIX_DELTA_MAX)
-        #if defined(G_SMOOTH_PSF)
-        if (delta > ramp_down) {
-            double x = norm_down * (delta - ramp_down);
-            psf     *= 1.0 - x * x;
-        }
-        #endif
-        #endif
-
-    } // endif: normalization was positive
+    // Interpolate King profile parameters and compute PSF
+    psf = this->psf(update(logE, theta), delta);
 
     // Compile option: set PSF to zero outside delta_max
     #if defined(G_FIX_DELTA_MAX)
@@ -423,11 +397,11 @@ double GCTAPsfKing::mc(GRan&         ran,
 	// Initialise random offset
 	double delta = 0.0;
 
-    // Update the parameter cache
-    update(logE, theta);
+    // Interpolate King profile parameters
+    king pars = update(logE, theta);
 
     // Compute exponent
-    double exponent = 1.0 / (1.0-m_par_gamma);
+    double exponent = 1.0 / (1.0-pars.gamma);
 
     // Compile option: sample until delta <= r_max
     #if defined(G_FIX_DELTA_MAX)
@@ -438,8 +412,8 @@ double GCTAPsfKing::mc(GRan&         ran,
     double u = ran.uniform();
 
     // Draw random offset using inversion sampling
-    double u_max = (std::pow((1.0 - u), exponent) - 1.0) * m_par_gamma;
-    delta = m_par_sigma * std::sqrt(2.0 * u_max);
+    double u_max = (std::pow((1.0 - u), exponent) - 1.0) * pars.gamma;
+    delta = pars.sigma * std::sqrt(2.0 * u_max);
 
     // Compile option: sample until delta <= r_max
     #if defined(G_FIX_DELTA_MAX)
@@ -477,14 +451,14 @@ double GCTAPsfKing::delta_max(const double& logE,
     double radius = r_max;
     #else
 
-    // Update the parameter cache
-    update(logE, theta);
+    // Interpolate King profile parameters
+    king pars = update(logE, theta);
 
     // Compute maximum PSF radius (99.995% containment)
     double F      = 0.99995;
-    double u_max  = (std::pow((1.0 - F), (1.0/(1.0-m_par_gamma))) - 1.0) * 
-                    m_par_gamma;
-    double radius = m_par_sigma * std::sqrt(2.0 * u_max);
+    double u_max  = (std::pow((1.0 - F), (1.0/(1.0-pars.gamma))) - 1.0) * 
+                    pars.gamma;
+    double radius = pars.sigma * std::sqrt(2.0 * u_max);
     #endif
 
     // Return maximum PSF radius
@@ -492,6 +466,147 @@ double GCTAPsfKing::delta_max(const double& logE,
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to the
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @param[in] phi Azimuth angle in camera system (rad). Not used.
+ * @param[in] zenith Zenith angle in Earth system (rad). Not used.
+ * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
+ * @param[in] etrue Use true energy (true/false). Not used.
+ * @return Derivative of point spread function.
+ *
+ * Computes the analytical derivative of the King profile with respect to
+ * @p delta, including the smooth ramp down at large offset angles.
+ ***************************************************************************/
+double GCTAPsfKing::derivative(const double& delta,
+                               const double& logE, 
+                               const double& theta, 
+                               const double& phi,
+                               const double& zenith,
+                               const double& azimuth,
+                               const bool&   etrue) const
+{
+    #if defined(G_FIX_DELTA_MAX)
+    #if defined(G_SMOOTH_PSF)
+    // Set ramp down radius
+    static const double ramp_down = 0.95 * r_max;
+    static const double norm_down = 1.0 / (r_max - ramp_down);
+    #endif
+    #endif
+
+    // Initialise derivative
+    double derivative = 0.0;
+
+    // Compile option: set derivative to zero outside delta_max
+    #if defined(G_FIX_DELTA_MAX)
+    if (delta <= r_max) {
+    #endif
+
+    // Interpolate King profile parameters
+    king pars = update(logE, theta);
+
+    // Continue only if normalization is positive
+    if (pars.norm > 0.0) {
+
+        // Compute PSF value and derivative
+        double arg  = delta / pars.sigma;
+        double arg2 = arg * arg;
+        double base = 1.0 + 1.0 / (2.0 * pars.gamma) * arg2;
+        double psf  = pars.norm * std::pow(base, -pars.gamma);
+        derivative  = -psf * delta / (pars.sigma2 * base);
+
+        // If we are at large offset angles, add the derivative of the smooth
+        // ramp down
+        #if defined(G_FIX_DELTA_MAX)
+        #if defined(G_SMOOTH_PSF)
+        if (delta > ramp_down) {
+            double x    = norm_down * (delta - ramp_down);
+            derivative *= 1.0 - x * x;
+            derivative -= psf * 2.0 * x * norm_down;
+        }
+        #endif
+        #endif
+
+    } // endif: normalization was positive
+
+    // Compile option: set derivative to zero outside delta_max
+    #if defined(G_FIX_DELTA_MAX)
+    }
+    #endif
+
+    // Return derivative
+    return derivative;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate point spread function for arrays of arguments
+ *
+ * @param[in] num Number of argument sets.
+ * @param[in] delta Angular separations between true and measured photon
+ *            directions (radians; array of @p num values).
+ * @param[in] logE Log10 of the true photon energies (TeV; array of @p num
+ *            values).
+ * @param[in] theta Offset angles in camera system (radians; array of @p num
+ *            values).
+ * @param[out] psf Point spread function values (sr^-1; array of @p num
+ *             values).
+ *
+ * @exception GException::invalid_value
+ *            Response table does not contain 2 parameters.
+ *
+ * Evaluates the point spread function for @p num argument sets and writes
+ * the result into the caller provided @p psf array. The King profile
+ * parameters are interpolated from the response table in blocks of
+ * argument sets using the batch interpolation of the response table. No
+ * memory is allocated.
+ ***************************************************************************/
+void GCTAPsfKing::eval(const int&    num,
+                       const double* delta,
+                       const double* logE,
+                       const double* theta,
+                       double*       psf) const
+{
+    // Throw an exception if the response table is not a King profile table
+    check_table(G_EVAL);
+
+    // Allocate interpolated table parameters for one block
+    double tpars[2*batch_size];
+
+    // Loop over blocks of argument sets
+    for (int k0 = 0; k0 < num; k0 += batch_size) {
+
+        // Get number of argument sets in block
+        int n = (num - k0 < batch_size) ? num - k0 : batch_size;
+
+        // Interpolate table parameters for all argument sets in block
+        m_psf(n, logE+k0, theta+k0, tpars);
+
+        // Compute PSF values for all argument sets in block
+        for (int k = 0; k < n; ++k) {
+            int i = k0 + k;
+            #if defined(G_FIX_DELTA_MAX)
+            if (delta[i] > r_max) {
+                psf[i] = 0.0;
+                continue;
+            }
+            #endif
+            king pars = update(tpars[k], tpars[n+k], logE[i], theta[i]);
+            psf[i]    = this->psf(pars, delta[i]);
+        }
+
+    } // endfor: looped over blocks
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print point spread function information
  *
@@ -529,12 +644,6 @@ void GCTAPsfKing::init_members(void)
     // Initialise members
     m_filename.clear();
     m_psf.clear();
-    m_par_logE   = -1.0e30;
-    m_par_theta  = -1.0;
-    m_par_norm   = 0.0;
-    m_par_gamma  = 0.0;
-    m_par_sigma  = 0.0;
-    m_par_sigma2 = 0.0;
 
     // Return
     return;
@@ -549,14 +658,8 @@ void GCTAPsfKing::init_members(void)
 void GCTAPsfKing::copy_members(const GCTAPsfKing& psf)
 {
     // Copy members
-    m_filename   = psf.m_filename;
-    m_psf        = psf.m_psf;
-    m_par_logE   = psf.m_par_logE;
-    m_par_theta  = psf.m_par_theta;
-    m_par_norm   = psf.m_par_norm;
-    m_par_gamma  = psf.m_par_gamma;
-    m_par_sigma  = psf.m_par_sigma;
-    m_par_sigma2 = psf.m_par_sigma2;
+    m_filename = psf.m_filename;
+    m_psf      = psf.m_psf;
 
     // Return
     return;
@@ -574,73 +677,160 @@ void GCTAPsfKing::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Check that the response table holds the King profile parameters
+ *
+ * @param[in] origin Method name.
+ *
+ * @exception GException::invalid_value
+ *            Response table does not contain 2 parameters.
+ ***************************************************************************/
+void GCTAPsfKing::check_table(const std::string& origin) const
+{
+    // Throw an exception if there are not 2 parameters
+    if (m_psf.size() != 2) {
+        std::string msg = gammalib::str(m_psf.size()) + " parameters have"
+                          " been found in the response table of the"
+                          " King profile response function while 2"
+                          " parameters are expected.\n"
+                          "Possibly, the point spread function information"
+                          " has not yet been loaded. Please load the point"
+                          " spread function before using it.";
+        throw GException::invalid_value(origin, msg);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Interpolate King profile parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
- * @param[in] theta Offset angle.
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return King profile parameters.
  *
  * @exception GException::invalid_value
- *            No valid point spread function information has been found.
+ *            Response table does not contain 2 parameters.
  *
- * This method updates the PSF parameter cache. As the performance table PSF
- * only depends on energy, the only parameter on which the cache values
- * depend is the energy.
+ * Interpolates the King profile parameters from the response table for the
+ * specified energy and offset angle.
  ***************************************************************************/
-void GCTAPsfKing::update(const double& logE, const double& theta) const
+GCTAPsfKing::king GCTAPsfKing::update(const double& logE,
+                                      const double& theta) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE || theta != m_par_theta) {
-
-        // Save parameters
-        m_par_logE  = logE;
-        m_par_theta = theta;
-    
-        // Determine sigma and gamma by interpolating between nodes
-        std::vector<double> pars = m_psf(logE,theta);
-
-        // Throw an exception if there are not 2 parameters
-        if (pars.size() != 2) {
-            std::string msg = gammalib::str(pars.size()) + " parameters have"
-                              " been found in the response table of the"
-                              " King profile response function while 2"
-                              " parameters are expected.\n"
-                              "Possibly, the point spread function information"
-                              " has not yet been loaded. Please load the point"
-                              " spread function before using it.";
-            throw GException::invalid_value(G_UPDATE, msg);
-        }
+    // Throw an exception if the response table is not a King profile table
+    check_table(G_UPDATE);
 
-        // Set parameters
-        m_par_gamma  = pars[0];
-        m_par_sigma  = pars[1];
-        m_par_sigma2 = m_par_sigma * m_par_sigma;
-
-        // Check for parameter sanity
-        if (m_par_gamma <= 0.0 || m_par_sigma <= 0.0) {
-            m_par_norm = 0.0;
-            std::string msg = "King function parameters m_par_gamma and"
-                              " m_par_sigma are zero (for "
-                              " parameter space logE=" +
-                              gammalib::str(logE) + " and theta=" + 
-                              gammalib::str(theta) + 
-                              "), setting normalization m_norm to zero."; 
-            gammalib::warning(G_UPDATE, msg);
-        }
-        else {   
-            // Determine normalisation for given parameters
-            m_par_norm = 1.0 / gammalib::twopi * (1.0 - 1.0 / m_par_gamma) /
-                         m_par_sigma2;
-        }
+    // Determine sigma and gamma by interpolating between nodes
+    double tpars[2];
+    m_psf(1, &logE, &theta, tpars);
+
+    // Return King profile parameters
+    return (update(tpars[0], tpars[1], logE, theta));
+}
+
+
+/***********************************************************************//**
+ * @brief Compute King profile parameters
+ *
+ * @param[in] gamma King profile gamma parameter.
+ * @param[in] sigma King profile sigma (rad).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad).
+ * @return King profile parameters.
+ *
+ * Derives the normalization of the King profile from the response table
+ * parameters. The energy and offset angle are only used for reporting
+ * invalid parameters.
+ ***************************************************************************/
+GCTAPsfKing::king GCTAPsfKing::update(const double& gamma,
+                                      const double& sigma,
+                                      const double& logE,
+                                      const double& theta) const
+{
+    // Initialise King profile parameters
+    king pars;
+
+    // Set parameters
+    pars.gamma  = gamma;
+    pars.sigma  = sigma;
+    pars.sigma2 = sigma * sigma;
+
+    // Check for parameter sanity
+    if (pars.gamma <= 0.0 || pars.sigma <= 0.0) {
+        pars.norm = 0.0;
+        std::string msg = "King function parameters gamma and sigma are"
+                          " zero (for parameter space logE=" +
+                          gammalib::str(logE) + " and theta=" + 
+                          gammalib::str(theta) + 
+                          "), setting normalization to zero."; 
+        gammalib::warning(G_UPDATE, msg);
+    }
+    else {   
+        // Determine normalisation for given parameters
+        pars.norm = 1.0 / gammalib::twopi * (1.0 - 1.0 / pars.gamma) /
+                    pars.sigma2;
+    }
 
-        // Optionally correct for fixed delta_max
+    // Optionally correct for fixed delta_max
+    #if defined(G_FIX_DELTA_MAX)
+    double u_max = (r_max*r_max) / (2.0 * pars.sigma2);
+    double norm  = 1.0 - std::pow((1.0 + u_max/pars.gamma), 1.0-pars.gamma);
+    pars.norm /= norm;
+    #endif
+
+    // Return King profile parameters
+    return pars;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute point spread function value
+ *
+ * @param[in] pars King profile parameters.
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (rad).
+ * @return Point spread function value (sr^-1).
+ *
+ * Computes the King profile. Values of @p delta beyond the fixed maximum
+ * delta are not handled by this method.
+ ***************************************************************************/
+double GCTAPsfKing::psf(const king& pars, const double& delta) const
+{
+    #if defined(G_FIX_DELTA_MAX)
+    #if defined(G_SMOOTH_PSF)
+    // Set ramp down radius
+    static const double ramp_down = 0.95 * r_max;
+    static const double norm_down = 1.0 / (r_max - ramp_down);
+    #endif
+    #endif
+
+    // Initialise PSF value
+    double psf = 0.0;
+
+    // Continue only if normalization is positive
+    if (pars.norm > 0.0) {
+
+        // Compute PSF value
+        double arg  = delta / pars.sigma;
+        double arg2 = arg * arg;
+        psf = pars.norm * 
+              std::pow((1.0 + 1.0 / (2.0 * pars.gamma) * arg2), -pars.gamma);
+
+        // If we are at large offset angles, add a smooth ramp down to
+        // avoid steps in the log-likelihood computation
         #if defined(G_FIX_DELTA_MAX)
-        double u_max = (r_max*r_max) / (2.0 * m_par_sigma2);
-        double norm  = 1.0 - std::pow((1.0 + u_max/m_par_gamma), 1.0-m_par_gamma);
-        m_par_norm /= norm;
+        #if defined(G_SMOOTH_PSF)
+        if (delta > ramp_down) {
+            double x = norm_down * (delta - ramp_down);
+            psf     *= 1.0 - x * x;
+        }
+        #endif
         #endif
 
-    }
+    } // endif: normalization was positive
 
-    // Return
-    return;
+    // Return PSF
+    return psf;
 }
@@ -185,14 +185,14 @@ double GCTAPsfPerfTable::operator()(const double& delta,
     static const double offset = std::exp(-0.5*5.0*5.0);
     #endif
     
-    // Update the parameter cache
-    update(logE);
+    // Compute Gaussian parameters
+    gaussian pars = update(logE);
 
     // Compute PSF value
     #if defined(G_SMOOTH_PSF)
-    double psf = m_par_scale * (std::exp(m_par_width * delta * delta) - offset);
+    double psf = pars.scale * (std::exp(pars.width * delta * delta) - offset);
     #else
-    double psf = m_par_scale * (std::exp(m_par_width * delta * delta));
+    double psf = pars.scale * (std::exp(pars.width * delta * delta));
     #endif
 
     #if defined(G_SMOOTH_PSF)
@@ -338,11 +338,11 @@ double GCTAPsfPerfTable::mc(GRan&         ran,
                             const double& azimuth,
                             const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Compute Gaussian parameters
+    gaussian pars = update(logE);
 
     // Draw offset
-    double delta = m_par_sigma * ran.chisq2();
+    double delta = pars.sigma * ran.chisq2();
     
     // Return PSF offset
     return delta;
@@ -370,17 +370,70 @@ double GCTAPsfPerfTable::delta_max(const double& logE,
                                    const double& azimuth,
                                    const bool&   etrue) const
 {
-    // Update the parameter cache
-    update(logE);
+    // Compute Gaussian parameters
+    gaussian pars = update(logE);
 
     // Compute maximum PSF radius
-    double radius = 5.0 * m_par_sigma;
+    double radius = 5.0 * pars.sigma;
     
     // Return maximum PSF radius
     return radius;
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to the
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] logE Log10 of the true photon energy (TeV).
+ * @param[in] theta Offset angle in camera system (rad). Not used.
+ * @param[in] phi Azimuth angle in camera system (rad). Not used.
+ * @param[in] zenith Zenith angle in Earth system (rad). Not used.
+ * @param[in] azimuth Azimuth angle in Earth system (rad). Not used.
+ * @param[in] etrue Use true energy (true/false). Not used.
+ * @return Derivative of point spread function.
+ *
+ * Computes the analytical derivative of the Gaussian point spread function
+ * with respect to @p delta.
+ ***************************************************************************/
+double GCTAPsfPerfTable::derivative(const double& delta,
+                                    const double& logE, 
+                                    const double& theta, 
+                                    const double& phi,
+                                    const double& zenith,
+                                    const double& azimuth,
+                                    const bool&   etrue) const
+{
+    #if defined(G_SMOOTH_PSF)
+    // Compute offset so that PSF goes to 0 at 5 times the sigma value. This
+    // is a kluge to get a PSF that smoothly goes to zero at the edge, which
+    // prevents steps or kinks in the log-likelihood function.
+    static const double offset = std::exp(-0.5*5.0*5.0);
+    #endif
+
+    // Compute Gaussian parameters
+    gaussian pars = update(logE);
+
+    // Compute exponential
+    double exponential = std::exp(pars.width * delta * delta);
+
+    // Compute derivative
+    double derivative = 2.0 * pars.scale * pars.width * delta * exponential;
+
+    #if defined(G_SMOOTH_PSF)
+    // Set derivative to zero where PSF is zero
+    if (exponential < offset) {
+        derivative = 0.0;
+    }
+    #endif
+
+    // Return derivative
+    return derivative;
+}
+
+
 /***********************************************************************//**
  * @brief Print point spread function information
  *
@@ -434,10 +487,6 @@ void GCTAPsfPerfTable::init_members(void)
     m_r68.clear();
     m_r80.clear();
     m_sigma.clear();
-    m_par_logE  = -1.0e30;
-    m_par_scale = 1.0;
-    m_par_sigma = 0.0;
-    m_par_width = 0.0;
 
     // Return
     return;
@@ -457,10 +506,6 @@ void GCTAPsfPerfTable::copy_members(const GCTAPsfPerfTable& psf)
     m_r68       = psf.m_r68;
     m_r80       = psf.m_r80;
     m_sigma     = psf.m_sigma;
-    m_par_logE  = psf.m_par_logE;
-    m_par_scale = psf.m_par_scale;
-    m_par_sigma = psf.m_par_sigma;
-    m_par_width = psf.m_par_width;
 
     // Return
     return;
@@ -478,32 +523,29 @@ void GCTAPsfPerfTable::free_members(void)
 
 
 /***********************************************************************//**
- * @brief Update PSF parameter cache
+ * @brief Compute Gaussian parameters
  *
  * @param[in] logE Log10 of the true photon energy (TeV).
+ * @return Gaussian parameters.
  *
- * This method updates the PSF parameter cache. As the performance table PSF
- * only depends on energy, the only parameter on which the cache values
- * depend is the energy.
+ * Interpolates the Gaussian sigma at the specified energy and derives the
+ * Gaussian normalization and width parameter. The parameters are not
+ * cached, hence the point spread function may be evaluated concurrently from
+ * several threads.
  ***************************************************************************/
-void GCTAPsfPerfTable::update(const double& logE) const
+GCTAPsfPerfTable::gaussian GCTAPsfPerfTable::update(const double& logE) const
 {
-    // Only compute PSF parameters if arguments have changed
-    if (logE != m_par_logE) {
+    // Initialise Gaussian parameters
+    gaussian pars;
 
-        // Save energy
-        m_par_logE = logE;
-    
-        // Determine Gaussian sigma in radians
-        m_par_sigma = m_logE.interpolate(logE, m_sigma);
-
-        // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
-        double sigma2 = m_par_sigma * m_par_sigma;
-        m_par_scale   =  1.0 / (gammalib::twopi * sigma2);
-        m_par_width   = -0.5 / sigma2;
+    // Determine Gaussian sigma in radians
+    pars.sigma = m_logE.interpolate(logE, m_sigma);
 
-    }
+    // Derive width=-0.5/(sigma*sigma) and scale=1/(twopi*sigma*sigma)
+    double sigma2 = pars.sigma * pars.sigma;
+    pars.scale    =  1.0 / (gammalib::twopi * sigma2);
+    pars.width    = -0.5 / sigma2;
 
-    // Return
-    return;
+    // Return Gaussian parameters
+    return pars;
 }
@@ -30,6 +30,9 @@
 #endif
 #include <cmath>
 #include <string>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "GTools.hpp"
 #include "GCTAResponseCube.hpp"
 #include "GCTAResponse_helpers.hpp"
@@ -41,6 +44,8 @@
 #include "GModelSpatialRadialShell.hpp"
 #include "GModelSpatialElliptical.hpp"
 #include "GModelSpatialDiffuse.hpp"
+#include "GModelSky.hpp"
+#include "GModels.hpp"
 #include "GPhoton.hpp"
 #include "GSource.hpp"
 #include "GEvent.hpp"
@@ -577,6 +582,47 @@ std::string GCTAResponseCube::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Fill pre-computation cache for diffuse models
+ *
+ * @param[in] models Models.
+ * @param[in] obs Observation.
+ *
+ * Allocates and initialises the pre-computation cache entries of all
+ * diffuse sky models in @p models that apply to the observation @p obs and
+ * for which no cache entry exists yet. Calling this method before the
+ * event bins are evaluated ensures that the cache is not modified while
+ * the response is computed for different event bins in parallel.
+ ***************************************************************************/
+void GCTAResponseCube::irf_caches(const GModels&      models,
+                                  const GObservation& obs) const
+{
+    // Loop over models
+    for (int i = 0; i < models.size(); ++i) {
+
+        // Continue only if model is a diffuse sky model that applies to
+        // the observation
+        const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+        if (model == NULL || model->spatial() == NULL ||
+            model->spatial()->code() != GMODEL_SPATIAL_DIFFUSE ||
+            !model->is_valid(obs.instrument(), obs.id())) {
+            continue;
+        }
+
+        // Allocate and initialise cache entry if none exists
+        if (cache_index(model->name()) == -1) {
+            GCTACubeSourceDiffuse* cache = new GCTACubeSourceDiffuse;
+            cache->set(model->name(), *model->spatial(), obs);
+            m_cache.push_back(cache);
+        }
+
+    } // endfor: looped over models
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -1293,6 +1339,11 @@ double GCTAResponseCube::irf_elliptical(const GEvent&       event,
  * @param[in] obs Observation.
  * @return Instrument response to diffuse source.
  *
+ * @exception GException::invalid_value
+ *            Event is not a CTA event bin or cached model is not diffuse.
+ * @exception GException::runtime_error
+ *            No pre-computation cache exists within a parallel region.
+ *
  * Returns the instrument response to a specified diffuse source.
  *
  * The method uses a pre-computation cache to store the instrument response
@@ -1300,6 +1351,13 @@ double GCTAResponseCube::irf_elliptical(const GEvent&       event,
  * if no cache has yet been allocated, or if at the beginning of a scan over
  * the events, the model parameters have changed. The beginning of a scan is
  * defined by an event bin index of 0.
+ *
+ * Within an OpenMP parallel region the pre-computation cache must not be
+ * modified. The cache therefore needs to be filled beforehand using
+ * irf_caches(), which is done by GCTAObservation::likelihood(). As
+ * building a cache entry requires a full pass over the cube pixels, a
+ * missing cache entry within a parallel region is signalled by an
+ * exception instead of building a temporary entry for every event bin.
  ***************************************************************************/
 double GCTAResponseCube::irf_diffuse(const GEvent&       event,
                                      const GSource&      source,
@@ -1325,6 +1383,18 @@ double GCTAResponseCube::irf_diffuse(const GEvent&       event,
     GCTACubeSourceDiffuse* cache(NULL);
     int index = cache_index(source.name());
     if (index == -1) {
+
+        // Throw an exception if we are in a parallel region where the
+        // cache must not be modified
+        #ifdef _OPENMP
+        if (omp_in_parallel()) {
+            std::string msg = "No pre-computation cache found for diffuse "
+                              "model \""+source.name()+"\". Please fill the "
+                              "cache using irf_caches() before evaluating "
+                              "the event bins in parallel.";
+            throw GException::runtime_error(G_IRF_DIFFUSE, msg);
+        }
+        #endif
     
         // No cache entry was found, thus allocate and initialise a new one
         cache = new GCTACubeSourceDiffuse;
@@ -30,18 +30,25 @@
 #endif
 #include <cmath>
 #include <vector>
+#include <algorithm>
 #include <string>
 #include "GFits.hpp"
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GIntegral.hpp"
+#include "GIntegrals.hpp"
+#include "GVector.hpp"
+#include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GCaldb.hpp"
 #include "GSource.hpp"
 #include "GRan.hpp"
+#include "GModels.hpp"
 #include "GModelSky.hpp"
 #include "GModelSpatialPointSource.hpp"
 #include "GModelSpatialRadial.hpp"
 #include "GModelSpatialRadialShell.hpp"
+#include "GModelSpatialRadialDisk.hpp"
 #include "GModelSpatialElliptical.hpp"
 #include "GCTAObservation.hpp"
 #include "GCTAResponseIrf.hpp"
@@ -84,26 +91,39 @@
                                                             " GObservation&)"
 #define G_IRF_DIFFUSE       "GCTAResponseIrf::irf_diffuse(GEvent&, GSource&,"\
                                                             " GObservation&)"
+#define G_IRF_PTSRC_GRADIENTS              "GCTAResponseIrf::irf_ptsrc_gradients"\
+                                        "(GEvent&, GSource&, GObservation&)"
+#define G_IRF_RADIAL_GRADIENTS            "GCTAResponseIrf::irf_radial_gradients"\
+                                        "(GEvent&, GSource&, GObservation&)"
+#define G_IRF_ELLIPTICAL_GRADIENTS    "GCTAResponseIrf::irf_elliptical_gradients"\
+                                        "(GEvent&, GSource&, GObservation&)"
+#define G_NROI          "GCTAResponseIrf::nroi(GModelSky&, GEnergy&, GTime&,"\
+                                                            " GObservation&)"
 #define G_NROI_RADIAL    "GCTAResponseIrf::nroi_radial(GModelSky&, GEnergy&,"\
                                   " GTime&, GEnergy&, GTime&, GObservation&)"
 #define G_NROI_ELLIPTICAL      "GCTAResponseIrf::nroi_elliptical(GModelSky&,"\
                         " GEnergy&, GTime&, GEnergy&, GTime&, GObservation&)"
 #define G_NROI_DIFFUSE  "GCTAResponseIrf::nroi_diffuse(GModelSky&, GEnergy&,"\
                                   " GTime&, GEnergy&, GTime&, GObservation&)"
+#define G_IRF_CACHE_KEYS          "GCTAResponseIrf::irf_cache_keys(GModels&,"\
+                                                            " GObservation&)"
+#define G_GAUSS_LEGENDRE_ORDER  "GCTAResponseIrf::gauss_legendre_order(int&)"
 #define G_AEFF    "GCTAResponseIrf::aeff(double&, double&, double&, double&,"\
                                                                   " double&)"
 #define G_PSF      "GCTAResponseIrf::psf(double&, double&, double&, double&,"\
                                                                   " double&)"
 #define G_PSF_DELTA_MAX    "GCTAResponseIrf::psf_delta_max(double&, double&,"\
                                                 " double&, double&, double&)"
+#define G_PSF_DERIVATIVE  "GCTAResponseIrf::psf_derivative(double&, double&,"\
+                                       " double&, double&, double&, double&)"
 #define G_EDISP  "GCTAResponseIrf::edisp(double&, double&, double&, double&,"\
                                                                   " double&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
-#define G_USE_IRF_CACHE            //!< Use IRF cache in irf_diffuse method
-#define G_USE_NPRED_CACHE      //!< Use Npred cache in npred_diffuse method
+#define G_USE_IRF_CACHE   //!< Use IRF cache for extended & diffuse models
+#define G_USE_NROI_CACHE    //!< Use Nroi cache for fixed spatial models
 //#define G_USE_PSF_SYSTEM      //!< Do radial Irf integrations in Psf system
 
 /* __ Debug definitions __________________________________________________ */
@@ -406,6 +426,17 @@ double GCTAResponseIrf::irf(const GEvent&       event,
  * @return Instrument response.
  *
  * Returns the instrument response for a given event, source and observation.
+ *
+ * For extended and diffuse models the instrument response requires a
+ * convolution of the model with the IRF, which is expensive. If the events
+ * are an event list for which the cache key of the source was set by
+ * irf_cache_keys(), the convolved values are stored in the IRF cache of
+ * the event list and reused in subsequent evaluations (see
+ * irf_cache_list()). The response is independent of the spectral and
+ * temporal model components, hence the cached values remain valid while
+ * these components are fitted. If energy dispersion is summed over true
+ * energy nodes (see GResponse::edisp_nodes()), one value is cached for
+ * each true energy node.
  ***************************************************************************/
 double GCTAResponseIrf::irf(const GEvent&       event,
                             const GSource&      source,
@@ -414,8 +445,31 @@ double GCTAResponseIrf::irf(const GEvent&       event,
     // Initialise IRF value
     double irf = 0.0;
 
+    // Get model code
+    int code = source.model()->code();
+
+    // Try getting the IRF value of extended and diffuse models from the
+    // cache
+    #if defined(G_USE_IRF_CACHE)
+    const GCTAEventList* list  = NULL;
+    int                  index = -1;
+    int                  node  = 0;
+    if (code == GMODEL_SPATIAL_RADIAL     ||
+        code == GMODEL_SPATIAL_ELLIPTICAL ||
+        code == GMODEL_SPATIAL_DIFFUSE) {
+        list = irf_cache_list(event, source, obs, &index, &node);
+        if (list != NULL) {
+            irf = list->irf_cache_node(source.name(), index, node);
+            if (irf >= 0.0) {
+                return irf;
+            }
+            irf = 0.0;
+        }
+    }
+    #endif
+
     // Select IRF depending on the spatial model type
-    switch (source.model()->code()) {
+    switch (code) {
         case GMODEL_SPATIAL_POINT_SOURCE:
             irf = irf_ptsrc(event, source, obs);
             break;
@@ -432,6 +486,97 @@ double GCTAResponseIrf::irf(const GEvent&       event,
             break;
     }
 
+    // Put IRF value in cache
+    #if defined(G_USE_IRF_CACHE)
+    if (list != NULL) {
+        list->irf_cache_node(source.name(), index, node, irf);
+    }
+    #endif
+
+    // Return IRF value
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return instrument response and spatial parameter gradients
+ *
+ * @param[in] event Event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first spatial parameter gradient (default: 0).
+ * @return Instrument response.
+ *
+ * Returns the instrument response for a given event, source and observation
+ * and stores the gradients of the response with respect to the spatial
+ * model parameters in the @p gradients vector. For point sources, radial
+ * and elliptical models the gradients are computed together with the
+ * instrument response in a single integration, while for all other models
+ * and in case that energy dispersion is used the numerical gradient
+ * computation of GResponse::irf_gradients() is used. Note that elliptical
+ * models signal gradient support only for their shape parameters, hence
+ * their position gradients are computed by numerical differentiation of
+ * the convolved model. If the spatial model has no free parameters, no
+ * gradients are needed and the response is computed by irf(), which may
+ * use the IRF cache.
+ ***************************************************************************/
+double GCTAResponseIrf::irf_gradients(const GEvent&       event,
+                                      const GSource&      source,
+                                      const GObservation& obs,
+                                      GVector&            gradients,
+                                      const int&          offset) const
+{
+    // Initialise IRF value
+    double irf = 0.0;
+
+    // Check whether the spatial model has free parameters
+    bool has_free = false;
+    for (int i = 0; i < source.model()->size(); ++i) {
+        if ((*source.model())[i].is_free()) {
+            has_free = true;
+            break;
+        }
+    }
+
+    // If the spatial model has no free parameters then no gradients are
+    // needed. Use the response without gradients, which may use the IRF
+    // cache
+    if (!has_free) {
+        irf = this->irf(event, source, obs);
+        for (int i = 0; i < source.model()->size(); ++i) {
+            gradients[offset+i] = 0.0;
+        }
+    }
+
+    // ... otherwise if energy dispersion is used then use numerical
+    // gradients
+    else if (use_edisp()) {
+        irf = GResponse::irf_gradients(event, source, obs, gradients, offset);
+    }
+
+    // ... otherwise select method depending on the spatial model type
+    else {
+        switch (source.model()->code()) {
+            case GMODEL_SPATIAL_POINT_SOURCE:
+                irf = irf_ptsrc_gradients(event, source, obs, gradients,
+                                          offset);
+                break;
+            case GMODEL_SPATIAL_RADIAL:
+                irf = irf_radial_gradients(event, source, obs, gradients,
+                                           offset);
+                break;
+            case GMODEL_SPATIAL_ELLIPTICAL:
+                irf = irf_elliptical_gradients(event, source, obs, gradients,
+                                               offset);
+                break;
+            default:
+                irf = GResponse::irf_gradients(event, source, obs, gradients,
+                                               offset);
+                break;
+        }
+    }
+
     // Return IRF value
     return irf;
 }
@@ -464,6 +609,12 @@ double GCTAResponseIrf::irf(const GEvent&       event,
  *
  * for a given sky model \f$S(p,E,t)\f$ and response function
  * \f$R(p',E',t'|p,E,t)\f$ over the Region of Interest (ROI).
+ *
+ * If no energy dispersion is used and if the spatial model has no free
+ * parameters, the spatial integral over the ROI is stored in the Nroi
+ * cache of the observation (see nroi_cache_obs()), so that it is only
+ * computed once per energy in fits where only spectral or temporal
+ * parameters are free.
  ***************************************************************************/
 double GCTAResponseIrf::nroi(const GModelSky&    model,
                              const GEnergy&      obsEng,
@@ -521,8 +672,26 @@ double GCTAResponseIrf::nroi(const GModelSky&    model,
         // No energy dispersion
         const GEnergy& srcEng = obsEng;
 
+        // Get spatial response component from Nroi cache if possible
+        double npred_spatial = -1.0;
+        #if defined(G_USE_NROI_CACHE)
+        const GCTAObservation* cache = nroi_cache_obs(model, srcTime, obs);
+        if (cache != NULL) {
+            npred_spatial = cache->nroi_cache(model.name(), srcEng);
+        }
+        #endif
+
+        // Compute spatial response component if it was not cached
+        if (npred_spatial < 0.0) {
+            npred_spatial = this->nroi(model, srcEng, srcTime, obsEng, obsTime, obs);
+            #if defined(G_USE_NROI_CACHE)
+            if (cache != NULL) {
+                cache->nroi_cache(model.name(), srcEng, npred_spatial);
+            }
+            #endif
+        }
+
         // Compute response components
-        double npred_spatial  = this->nroi(model, srcEng, srcTime, obsEng, obsTime, obs);
         double npred_spectral = model.spectral()->eval(srcEng, srcTime);
         double npred_temporal = model.temporal()->eval(srcTime);
 
@@ -1382,6 +1551,39 @@ double GCTAResponseIrf::offset_sigma(void) const
 }
 
 
+/***********************************************************************//**
+ * @brief Set Gauss-Legendre order of IRF integrations
+ *
+ * @param[in] order Gauss-Legendre order (0: Romberg integration).
+ *
+ * @exception GException::invalid_argument
+ *            Order is outside the valid range.
+ *
+ * Sets the integration method for the convolution of radial, elliptical
+ * and diffuse models with the IRF. For an @p order of 0 (the default), the
+ * model is integrated using Romberg integrations. Otherwise the model is
+ * integrated using tensor product Gauss-Legendre rules with @p order nodes
+ * in each dimension, which requires considerably fewer kernel evaluations
+ * for the same precision in case of smooth models.
+ ***************************************************************************/
+void GCTAResponseIrf::gauss_legendre_order(const int& order)
+{
+    // Throw an exception if order is out of range
+    if (order < 0 || order > 64) {
+        std::string msg = "Gauss-Legendre order "+gammalib::str(order)+
+                          " is outside the valid range [0,64]. Please "
+                          "specify a valid order.";
+        throw GException::invalid_argument(G_GAUSS_LEGENDRE_ORDER, msg);
+    }
+
+    // Set order
+    m_gl_order = order;
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print CTA response information
  *
@@ -1438,6 +1640,16 @@ std::string GCTAResponseIrf::print(const GChatter& chatter) const
             result.append("undefined");
         }
 
+        // Append IRF integration information
+        result.append("\n"+gammalib::parformat("IRF integration"));
+        if (m_gl_order > 0) {
+            result.append("Gauss-Legendre ("+gammalib::str(m_gl_order)+
+                          " nodes)");
+        }
+        else {
+            result.append("Romberg");
+        }
+
         // Append detailed information
         GChatter reduced_chatter = gammalib::reduce(chatter);
         if (reduced_chatter > SILENT) {
@@ -1467,20 +1679,6 @@ std::string GCTAResponseIrf::print(const GChatter& chatter) const
 
         }
 
-        // EXPLICIT: Append Npred cache information
-        if (chatter >= EXPLICIT) {
-            if (!m_npred_names.empty()) {
-                for (int i = 0; i < m_npred_names.size(); ++i) {
-                    result.append("\n"+gammalib::parformat("Npred cache " +
-                                  gammalib::str(i)));
-                    result.append(m_npred_names[i]+", ");
-                    result.append(m_npred_energies[i].print()+", ");
-                    result.append(m_npred_times[i].print()+" = ");
-                    result.append(gammalib::str(m_npred_values[i]));
-                }
-            }
-        } // endif: chatter was explicit
-
     } // endif: chatter was not silent
 
     // Return result
@@ -1574,6 +1772,49 @@ double GCTAResponseIrf::psf(const double& delta,
 }
 
 
+/***********************************************************************//**
+ * @brief Return derivative of point spread function with respect to the
+ *        angular separation (in units of sr^-1 radians^-1)
+ *
+ * @param[in] delta Angular separation between true and measured photon
+ *            directions (radians).
+ * @param[in] theta Radial offset angle of photon in camera (radians).
+ * @param[in] phi Polar angle of photon in camera (radians).
+ * @param[in] zenith Zenith angle of telescope pointing (radians).
+ * @param[in] azimuth Azimuth angle of telescope pointing (radians).
+ * @param[in] srcLogEng Log10 of true photon energy (E/TeV).
+ *
+ * @exception GException::invalid_value
+ *            No point spread function information found.
+ *
+ * Returns the derivative of the point spread function with respect to the
+ * angular separation @p delta (see GCTAPsf::derivative()).
+ ***************************************************************************/
+double GCTAResponseIrf::psf_derivative(const double& delta,
+                                       const double& theta,
+                                       const double& phi,
+                                       const double& zenith,
+                                       const double& azimuth,
+                                       const double& srcLogEng) const
+{
+    // Throw an exception if instrument response is not defined
+    if (m_psf == NULL) {
+        std::string msg = "No point spread function information found in"
+                          " response.\n"
+                          "Please make sure that the instrument response is"
+                          " properly defined.";
+        throw GException::invalid_value(G_PSF_DERIVATIVE, msg);
+    }
+
+    // Compute PSF derivative
+    double derivative = m_psf->derivative(delta, srcLogEng, theta, phi,
+                                          zenith, azimuth);
+
+    // Return PSF derivative
+    return derivative;
+}
+
+
 /***********************************************************************//**
  * @brief Return maximum angular separation (in radians)
  *
@@ -1903,6 +2144,146 @@ double GCTAResponseIrf::npsf(const GSkyDir&      srcDir,
 }
 
 
+/***********************************************************************//**
+ * @brief Set IRF cache keys of models
+ *
+ * @param[in] models Models.
+ * @param[in] obs Observation.
+ *
+ * Sets the IRF cache keys of all extended and diffuse sky models that
+ * apply to the observation in the event list of the observation. The key
+ * of a model is composed of its spatial model type, its spatial parameter
+ * values and the pointing direction, hence the cached IRF values of a
+ * model are invalidated if one of these changes. The keys are built once
+ * for each evaluation of the events, and are released after the evaluation
+ * using GCTAEventList::irf_cache_release(), so that cached values are not
+ * used once the model parameters may have been modified.
+ *
+ * IRF values are only cached for models without free spatial parameters.
+ * The IRF values of models with free spatial parameters change in every
+ * iteration of a fit, and their gradients are computed from the IRF values
+ * of the model with modified parameters, hence these IRF values can not
+ * be reused.
+ *
+ * If energy dispersion is used, IRF values are only cached if the energy
+ * dispersion is summed over the nodes of a logarithmic true energy grid
+ * (see GResponse::edisp_nodes()). In that case one IRF value is cached for
+ * each event and each grid node within the true energy range of the
+ * energy dispersion for the energy range of the events. The number of
+ * nodes per decade is part of the cache key.
+ *
+ * The method should be called once before the events of the observation
+ * are evaluated, and must not be called while other threads evaluate the
+ * events of the observation.
+ ***************************************************************************/
+void GCTAResponseIrf::irf_cache_keys(const GModels&      models,
+                                     const GObservation& obs) const
+{
+    // Continue only if energy dispersion is not used or if energy
+    // dispersion is summed over true energy nodes
+    if (!use_edisp() || edisp_nodes() > 0) {
+
+        // Get event list. Continue only if events are an event list.
+        const GCTAEventList* events =
+              dynamic_cast<const GCTAEventList*>(obs.events());
+        if (events != NULL) {
+
+            // Determine range of true energy nodes. Without energy
+            // dispersion a single value is cached per event. With energy
+            // dispersion the range covers the true energies of the energy
+            // dispersion for the lower and upper event energy boundaries.
+            int first = 0;
+            int nodes = 1;
+            if (use_edisp()) {
+                const double step = gammalib::ln10 / double(edisp_nodes());
+                double       emin = 0.0;
+                double       emax = 0.0;
+                for (int k = 0; k < 2; ++k) {
+                    if (events->ebounds().size() < 1) {
+                        break;
+                    }
+                    GEnergy  eobs    = (k == 0) ? events->ebounds().emin()
+                                                : events->ebounds().emax();
+                    GEbounds ebounds = this->ebounds(eobs);
+                    for (int i = 0; i < ebounds.size(); ++i) {
+                        double e1 = ebounds.emin(i).MeV();
+                        double e2 = ebounds.emax(i).MeV();
+                        if (e1 > 0.0 && e2 > e1) {
+                            if (emin == 0.0 || e1 < emin) {
+                                emin = e1;
+                            }
+                            if (e2 > emax) {
+                                emax = e2;
+                            }
+                        }
+                    }
+                }
+                if (emax > emin && emin > 0.0) {
+                    first = int(std::ceil(std::log(emin)/step));
+                    nodes = int(std::floor(std::log(emax)/step)) - first + 1;
+                }
+                else {
+                    nodes = 0;
+                }
+            }
+
+            // Loop over models
+            for (int i = 0; i < models.size(); ++i) {
+
+                // Continue only for sky models that apply to the
+                // observation
+                const GModelSky* sky = dynamic_cast<const GModelSky*>(models[i]);
+                if (sky == NULL || sky->spatial() == NULL ||
+                    !sky->is_valid(obs.instrument(), obs.id())) {
+                    continue;
+                }
+
+                // Continue only for extended and diffuse models
+                const GModelSpatial* model = sky->spatial();
+                int                  code  = model->code();
+                if (code != GMODEL_SPATIAL_RADIAL     &&
+                    code != GMODEL_SPATIAL_ELLIPTICAL &&
+                    code != GMODEL_SPATIAL_DIFFUSE) {
+                    continue;
+                }
+
+                // Build cache key from spatial model type and parameters.
+                // Break if one of the parameters is free.
+                std::vector<double> key;
+                bool                has_free = false;
+                key.push_back(double(code));
+                for (int k = 0; k < model->size(); ++k) {
+                    const GModelPar& par = (*model)[k];
+                    if (par.is_free()) {
+                        has_free = true;
+                        break;
+                    }
+                    key.push_back(par.value());
+                }
+
+                // If no parameter is free and if there are true energy
+                // nodes then add the pointing direction and the number of
+                // true energy nodes per decade to the cache key and set the
+                // cache key
+                if (!has_free && nodes > 0) {
+                    const GCTAPointing& pnt = retrieve_pnt(G_IRF_CACHE_KEYS, obs);
+                    key.push_back(pnt.dir().ra_deg());
+                    key.push_back(pnt.dir().dec_deg());
+                    key.push_back(double(use_edisp() ? edisp_nodes() : 0));
+                    events->irf_cache_key(sky->name(), key, first, nodes);
+                }
+
+            } // endfor: looped over models
+
+        } // endif: events were an event list
+
+    } // endif: IRF values may be cached
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -1924,6 +2305,7 @@ void GCTAResponseIrf::init_members(void)
     m_apply_edisp   = false;  //!< Switched off by default
     m_lo_save_thres = 0.0;
     m_hi_save_thres = 0.0;
+    m_gl_order      = 0;      //!< Romberg integration by default
 
     // XML response filenames
     m_xml_caldb.clear();
@@ -1933,12 +2315,6 @@ void GCTAResponseIrf::init_members(void)
     m_xml_edisp.clear();
     m_xml_background.clear();
 
-    // Initialise Npred cache
-    m_npred_names.clear();
-    m_npred_energies.clear();
-    m_npred_times.clear();
-    m_npred_values.clear();
-
     // Return
     return;
 }
@@ -1957,6 +2333,7 @@ void GCTAResponseIrf::copy_members(const GCTAResponseIrf& rsp)
     m_apply_edisp   = rsp.m_apply_edisp;
     m_lo_save_thres = rsp.m_lo_save_thres;
     m_hi_save_thres = rsp.m_hi_save_thres;
+    m_gl_order      = rsp.m_gl_order;
 
     // Copy response filenames
     m_xml_caldb      = rsp.m_xml_caldb;
@@ -1966,12 +2343,6 @@ void GCTAResponseIrf::copy_members(const GCTAResponseIrf& rsp)
     m_xml_edisp      = rsp.m_xml_edisp;
     m_xml_background = rsp.m_xml_background;
 
-    // Copy cache
-    m_npred_names    = rsp.m_npred_names;
-    m_npred_energies = rsp.m_npred_energies;
-    m_npred_times    = rsp.m_npred_times;
-    m_npred_values   = rsp.m_npred_values;
-
     // Clone members
     m_aeff       = (rsp.m_aeff       != NULL) ? rsp.m_aeff->clone()  : NULL;
     m_psf        = (rsp.m_psf        != NULL) ? rsp.m_psf->clone()   : NULL;
@@ -2194,6 +2565,9 @@ double GCTAResponseIrf::irf_radial(const GEvent&       event,
     // Perform zenith angle integration if interval is valid
     if (rho_max > rho_min) {
 
+        // Set Gauss-Legendre order of the integrations (0: Romberg)
+        const int& order = m_gl_order;
+
         // Setup integration kernel
         cta_irf_radial_kern_rho integrand(*this,
                                           *model,
@@ -2207,7 +2581,8 @@ double GCTAResponseIrf::irf_radial(const GEvent&       event,
                                           lambda,
                                           omega0,
                                           delta_max,
-                                          iter_phi);
+                                          iter_phi,
+                                          order);
 
         // Integrate over model's zenith angle
         GIntegral integral(&integrand);
@@ -2237,8 +2612,18 @@ double GCTAResponseIrf::irf_radial(const GEvent&       event,
             }
         }
 
-        // Integrate kernel
-        irf = integral.romberg(bounds, iter_rho);
+        // Integrate kernel. If Gauss-Legendre integration was selected the
+        // kernel is integrated with a rule of the same order in each of the
+        // intervals, resulting in a tensor product cubature over (rho,omega)
+        if (order > 0) {
+            std::sort(bounds.begin(), bounds.end());
+            for (std::size_t i = 1; i < bounds.size(); ++i) {
+                irf += integral.gauss_legendre(bounds[i-1], bounds[i], order);
+            }
+        }
+        else {
+            irf = integral.romberg(bounds, iter_rho);
+        }
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -2409,6 +2794,9 @@ double GCTAResponseIrf::irf_elliptical(const GEvent&       event,
     // Perform zenith angle integration if interval is valid
     if (rho_max > rho_min) {
 
+        // Set Gauss-Legendre order of the integrations (0: Romberg)
+        const int& order = m_gl_order;
+
         // Setup integration kernel
         cta_irf_elliptical_kern_rho integrand(*this,
                                               *model,
@@ -2426,7 +2814,8 @@ double GCTAResponseIrf::irf_elliptical(const GEvent&       event,
                                               rho_pnt,
                                               omega_pnt,
                                               delta_max,
-                                              iter_phi);
+                                              iter_phi,
+                                              order);
 
         // Integrate over model's zenith angle
         GIntegral integral(&integrand);
@@ -2443,8 +2832,18 @@ double GCTAResponseIrf::irf_elliptical(const GEvent&       event,
             bounds.push_back(semiminor);
         }
 
-        // Integrate kernel
-        irf = integral.romberg(bounds, iter_rho);
+        // Integrate kernel. If Gauss-Legendre integration was selected the
+        // kernel is integrated with a rule of the same order in each of the
+        // intervals, resulting in a tensor product cubature over (rho,omega)
+        if (order > 0) {
+            std::sort(bounds.begin(), bounds.end());
+            for (std::size_t i = 1; i < bounds.size(); ++i) {
+                irf += integral.gauss_legendre(bounds[i-1], bounds[i], order);
+            }
+        }
+        else {
+            irf = integral.romberg(bounds, iter_rho);
+        }
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
@@ -2521,141 +2920,118 @@ double GCTAResponseIrf::irf_diffuse(const GEvent&       event,
     static const int iter_phi = 5;
 
     // Initialise IRF value
-    bool   has_irf = false;
-    double irf     = 0.0;
+    double irf = 0.0;
 
     // Retrieve CTA pointing
     const GCTAPointing& pnt = retrieve_pnt(G_IRF_DIFFUSE, obs);
 
-    // Try getting the IRF value from cache
-    #if defined(G_USE_IRF_CACHE)
-    const GCTAEventList* list = dynamic_cast<const GCTAEventList*>(obs.events());
-    const GCTAEventAtom* atom = dynamic_cast<const GCTAEventAtom*>(&event);
-    if (list != NULL && atom != NULL) {
-        irf = list->irf_cache(source.name(), atom->index());
-        if (irf >= 0.0) {
-            has_irf = true;
-            #if defined(G_DEBUG_IRF_DIFFUSE)
-            std::cout << "GCTAResponseIrf::irf_diffuse:";
-            std::cout << " cached irf=" << irf << std::endl;
-            #endif
-        }
-        else {
-            irf = 0.0;
-        }
+    // Get CTA instrument direction
+    const GCTAInstDir&  dir = retrieve_dir(G_IRF_ELLIPTICAL, event);
+
+    // Get pointer on spatial model
+    const GModelSpatial* model =
+        dynamic_cast<const GModelSpatial*>(source.model());
+    if (model == NULL) {
+        throw GCTAException::bad_model_type(G_IRF_DIFFUSE);
     }
-    #endif
 
-    // Continue only if we have no IRF value
-    if (!has_irf) {
+    // Get event attributes
+    //const GSkyDir& obsDir = dir.dir();
+    const GEnergy& obsEng = event.energy();
 
-        // Get CTA instrument direction
-        const GCTAInstDir&  dir = retrieve_dir(G_IRF_ELLIPTICAL, event);
+    // Get source attributes
+    const GEnergy& srcEng  = source.energy();
+    const GTime&   srcTime = source.time();
 
-        // Get pointer on spatial model
-        const GModelSpatial* model =
-            dynamic_cast<const GModelSpatial*>(source.model());
-        if (model == NULL) {
-            throw GCTAException::bad_model_type(G_IRF_DIFFUSE);
-        }
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt.zenith();
+    double azimuth = pnt.azimuth();
 
-        // Get event attributes
-        //const GSkyDir& obsDir = dir.dir();
-        const GEnergy& obsEng = event.energy();
-
-        // Get source attributes
-        const GEnergy& srcEng  = source.energy();
-        const GTime&   srcTime = source.time();
-
-        // Get pointing direction zenith angle and azimuth [radians]
-        double zenith  = pnt.zenith();
-        double azimuth = pnt.azimuth();
-
-        // Determine angular distance between measured photon direction and
-        // pointing direction [radians]
-        double eta = pnt.dir().dist(dir.dir());
-
-        // Get log10(E/TeV) of true photon energy
-        double srcLogEng = srcEng.log10TeV();
-
-        // Assign the observed theta angle (eta) as the true theta angle
-        // between the source and the pointing directions. This is a (not
-        // too bad) approximation which helps to speed up computations.
-        // If we want to do this correctly, however, we would need to move
-        // the psf_dummy_sigma down to the integration kernel, and we would
-        // need to make sure that psf_delta_max really gives the absolute
-        // maximum (this is certainly less critical)
-        double theta = eta;
-        double phi   = 0.0; //TODO: Implement Phi dependence
-
-        // Get maximum PSF radius in radians
-        double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
-
-        // Perform zenith angle integration if interval is valid
-        if (delta_max > 0.0) {
-
-            // Compute rotation matrix to convert from coordinates (theta,phi)
-            // in the reference frame of the observed arrival direction into
-            // celestial coordinates
-            GMatrix ry;
-            GMatrix rz;
-            ry.eulery(dir.dir().dec_deg() - 90.0);
-            rz.eulerz(-dir.dir().ra_deg());
-            GMatrix rot = (ry * rz).transpose();
+    // Determine angular distance between measured photon direction and
+    // pointing direction [radians]
+    double eta = pnt.dir().dist(dir.dir());
 
-            // Setup integration kernel
-            cta_irf_diffuse_kern_theta integrand(*this,
-                                                 *model,
-                                                 theta,
-                                                 phi,
-                                                 zenith,
-                                                 azimuth,
-                                                 srcEng,
-                                                 srcTime,
-                                                 srcLogEng,
-                                                 obsEng,
-                                                 rot,
-                                                 eta,
-                                                 iter_phi);
-
-            // Integrate over Psf delta angle
-            GIntegral integral(&integrand);
-            integral.fixed_iter(iter_rho);
-            irf = integral.romberg(0.0, delta_max);
+    // Get log10(E/TeV) of true photon energy
+    double srcLogEng = srcEng.log10TeV();
 
-            // Compile option: Check for NaN/Inf
-            #if defined(G_NAN_CHECK)
-            if (gammalib::is_notanumber(irf) || gammalib::is_infinite(irf)) {
-                std::cout << "*** ERROR: GCTAResponseIrf::irf_diffuse:";
-                std::cout << " NaN/Inf encountered";
-                std::cout << " (irf=" << irf;
-                std::cout << ", delta_max=" << delta_max << ")";
-                std::cout << std::endl;
-            }
-            #endif
-        }
+    // Assign the observed theta angle (eta) as the true theta angle
+    // between the source and the pointing directions. This is a (not
+    // too bad) approximation which helps to speed up computations.
+    // If we want to do this correctly, however, we would need to move
+    // the psf_dummy_sigma down to the integration kernel, and we would
+    // need to make sure that psf_delta_max really gives the absolute
+    // maximum (this is certainly less critical)
+    double theta = eta;
+    double phi   = 0.0; //TODO: Implement Phi dependence
 
-        // Apply deadtime correction
-        irf *= obs.deadc(srcTime);
+    // Get maximum PSF radius in radians
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
 
-        // Put IRF value in cache
-        #if defined(G_USE_IRF_CACHE)
-        if (list != NULL && atom != NULL) {
-            list->irf_cache(source.name(), atom->index(), irf);
+    // Perform zenith angle integration if interval is valid
+    if (delta_max > 0.0) {
+
+        // Compute rotation matrix to convert from coordinates (theta,phi)
+        // in the reference frame of the observed arrival direction into
+        // celestial coordinates
+        GMatrix3 ry;
+        GMatrix3 rz;
+        ry.eulery(dir.dir().dec_deg() - 90.0);
+        rz.eulerz(-dir.dir().ra_deg());
+        GMatrix3 rot = (ry * rz).transpose();
+
+        // Set Gauss-Legendre order of the integrations (0: Romberg)
+        const int& order = m_gl_order;
+
+        // Setup integration kernel
+        cta_irf_diffuse_kern_theta integrand(*this,
+                                             *model,
+                                             theta,
+                                             phi,
+                                             zenith,
+                                             azimuth,
+                                             srcEng,
+                                             srcTime,
+                                             srcLogEng,
+                                             obsEng,
+                                             rot,
+                                             eta,
+                                             iter_phi,
+                                             order);
+
+        // Integrate over Psf delta angle
+        GIntegral integral(&integrand);
+        integral.fixed_iter(iter_rho);
+        if (order > 0) {
+            irf = integral.gauss_legendre(0.0, delta_max, order);
+        }
+        else {
+            irf = integral.romberg(0.0, delta_max);
         }
-        #endif
 
-        // Compile option: Show integration results
-        #if defined(G_DEBUG_IRF_DIFFUSE)
-        std::cout << "GCTAResponseIrf::irf_diffuse:";
-        std::cout << " srcLogEng=" << srcLogEng;
-        std::cout << " obsLogEng=" << obsLogEng;
-        std::cout << " eta=" << eta;
-        std::cout << " delta_max=" << delta_max;
-        std::cout << " irf=" << irf << std::endl;
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (gammalib::is_notanumber(irf) || gammalib::is_infinite(irf)) {
+            std::cout << "*** ERROR: GCTAResponseIrf::irf_diffuse:";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << irf;
+            std::cout << ", delta_max=" << delta_max << ")";
+            std::cout << std::endl;
+        }
         #endif
+    }
 
-    } // endif: has no IRF
+    // Apply deadtime correction
+    irf *= obs.deadc(srcTime);
+
+    // Compile option: Show integration results
+    #if defined(G_DEBUG_IRF_DIFFUSE)
+    std::cout << "GCTAResponseIrf::irf_diffuse:";
+    std::cout << " srcLogEng=" << srcLogEng;
+    std::cout << " obsLogEng=" << obsLogEng;
+    std::cout << " eta=" << eta;
+    std::cout << " delta_max=" << delta_max;
+    std::cout << " irf=" << irf << std::endl;
+    #endif
 
     // Return IRF value
     return irf;
@@ -2663,51 +3039,780 @@ double GCTAResponseIrf::irf_diffuse(const GEvent&       event,
 
 
 /***********************************************************************//**
- * @brief Return spatial integral of point source model
+ * @brief Return point source instrument response and position gradients
  *
- * @param[in] model Sky Model.
- * @param[in] srcEng True photon energy.
- * @param[in] srcTime True photon arrival time.
- * @param[in] obsEng Observed event energy.
- * @param[in] obsTime Observed event arrival time.
+ * @param[in] event Observed event.
+ * @param[in] source Source.
  * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first spatial parameter gradient.
+ * @return Value of instrument response function for a point source.
  *
- * Computes the integral
- *
- * \f[
- *    N_{\rm ROI}(E',t'|E,t) = \int_{\rm ROI} P(p',E',t'|E,t) dp'
- * \f]
+ * Returns the value of the instrument response function for a point source
+ * (see irf_ptsrc()) and stores the gradients of the response with respect
+ * to the Right Ascension and Declination of the source in @p gradients.
  *
- * of
+ * The gradients are computed by considering infinitesimal rotations of the
+ * source direction \f$\vec{s}\f$ around the axis \f$\vec{k}\f$, where
+ * \f$\vec{k}\f$ is the celestial pole for a shift in Right Ascension, and
+ * the axis \f$(\sin \alpha, -\cos \alpha, 0)\f$ for a shift in
+ * Declination. The derivatives of the angular separation \f$\delta\f$
+ * between true and measured photon direction \f$\vec{p'}\f$ and of the
+ * offset angle \f$\theta\f$ between true photon direction and pointing
+ * \f$\vec{d}\f$ are given by
  *
  * \f[
- *    P(p',E',t'|E,t) = \int
- *                      S(p,E,t) \times R(p',E',t'|p,E,t) \, dp
+ *    \frac{\partial \delta}{\partial \epsilon} =
+ *    -\frac{\vec{k} \cdot (\vec{s} \times \vec{p'})}{\sin \delta}
+ *    \quad {\rm and} \quad
+ *    \frac{\partial \theta}{\partial \epsilon} =
+ *    -\frac{\vec{k} \cdot (\vec{s} \times \vec{d})}{\sin \theta}
  * \f]
  *
- * over the Region of Interest (ROI) for a point source model \f$S(p,E,t)\f$
- * and the response function \f$R(p',E',t'|p,E,t)\f$.
+ * The derivative of the point spread function with respect to
+ * \f$\delta\f$ is computed analytically, the derivative of the response
+ * with respect to \f$\theta\f$ is computed numerically from the response
+ * tables.
  ***************************************************************************/
-double GCTAResponseIrf::nroi_ptsrc(const GModelSky&    model,
-                                   const GEnergy&      srcEng,
-                                   const GTime&        srcTime,
-                                   const GEnergy&      obsEng,
-                                   const GTime&        obsTime,
-                                   const GObservation& obs) const
+double GCTAResponseIrf::irf_ptsrc_gradients(const GEvent&       event,
+                                            const GSource&      source,
+                                            const GObservation& obs,
+                                            GVector&            gradients,
+                                            const int&          offset) const
 {
-    // Get point source spatial model
-    const GModelSpatialPointSource* src =
-          static_cast<const GModelSpatialPointSource*>(model.spatial());
+    // Set step size for offset angle derivative (radians)
+    const double h = 1.0e-5;
 
-    // Set Photon
-    GPhoton photon(src->dir(), srcEng, srcTime);
+    // Retrieve CTA pointing and instrument direction
+    const GCTAPointing& pnt = retrieve_pnt(G_IRF_PTSRC_GRADIENTS, obs);
+    const GCTAInstDir&  dir = retrieve_dir(G_IRF_PTSRC_GRADIENTS, event);
 
-    // Compute Nroi
-    double nroi = nirf(photon, obsEng, obsTime, obs);
+    // Get point source spatial model
+    const GModelSpatialPointSource* model =
+        static_cast<const GModelSpatialPointSource*>(source.model());
 
-    // Return Nroi
-    return nroi;
-}
+    // Get event attributes
+    const GSkyDir& obsDir = dir.dir();
+
+    // Get source attributes
+    GSkyDir srcDir = model->dir();
+
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt.zenith();
+    double azimuth = pnt.azimuth();
+
+    // Get radial offset and polar angles of true photon in camera [radians]
+    double theta = pnt.dir().dist(srcDir);
+    double phi   = 0.0; // Polar angle is not used by the CTA IRFs
+
+    // Get log10(E/TeV) of true photon energy.
+    double srcLogEng = source.energy().log10TeV();
+
+    // Determine angular separation between true and measured photon
+    // direction in radians
+    double delta = obsDir.dist(srcDir);
+
+    // Get maximum angular separation for which PSF is significant
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+
+    // Initialise IRF value and gradients
+    double irf    = 0.0;
+    double g_ra   = 0.0;
+    double g_dec  = 0.0;
+
+    // Compute only if we're sufficiently close to PSF
+    if (delta <= delta_max) {
+
+        // Get effective area component
+        double aeff = this->aeff(theta, phi, zenith, azimuth, srcLogEng);
+
+        // Continue only if effective area is positive
+        if (aeff > 0.0) {
+
+            // Compute IRF
+            irf = aeff * psf(delta, theta, phi, zenith, azimuth, srcLogEng);
+
+            // Compute derivatives of IRF with respect to PSF offset angle
+            // and photon offset angle in camera
+            double theta_h      = theta + h;
+            double dirf_ddelta  = aeff * psf_derivative(delta, theta, phi,
+                                                        zenith, azimuth,
+                                                        srcLogEng);
+            double dirf_dtheta  = (this->aeff(theta_h, phi, zenith, azimuth,
+                                              srcLogEng) *
+                                   psf(delta, theta_h, phi, zenith, azimuth,
+                                       srcLogEng) - irf) / h;
+
+            // Setup rotation axes for Right Ascension and Declination
+            double  ra = srcDir.ra();
+            GVector k_ra(0.0, 0.0, 1.0);
+            GVector k_dec(std::sin(ra), -std::cos(ra), 0.0);
+
+            // Compute cross products of source direction with measured
+            // photon direction and pointing direction
+            GVector s      = srcDir.celvector();
+            GVector s_x_p  = cross(s, obsDir.celvector());
+            GVector s_x_d  = cross(s, pnt.dir().celvector());
+
+            // Compute gradients with respect to rotations
+            double sin_delta = std::sin(delta);
+            double sin_theta = std::sin(theta);
+            if (sin_delta > 0.0) {
+                g_ra  -= dirf_ddelta * (k_ra  * s_x_p) / sin_delta;
+                g_dec -= dirf_ddelta * (k_dec * s_x_p) / sin_delta;
+            }
+            if (sin_theta > 0.0) {
+                g_ra  -= dirf_dtheta * (k_ra  * s_x_d) / sin_theta;
+                g_dec -= dirf_dtheta * (k_dec * s_x_d) / sin_theta;
+            }
+
+            // Apply deadtime correction
+            double deadc = obs.deadc(source.time());
+            irf   *= deadc;
+            g_ra  *= deadc;
+            g_dec *= deadc;
+
+        } // endif: Aeff was non-zero
+
+    } // endif: we were sufficiently close to PSF
+
+    // Set gradients. Right Ascension and Declination are the first two
+    // parameters of the point source model
+    gradients[offset]   = g_ra  * gammalib::deg2rad * (*model)[0].scale();
+    gradients[offset+1] = g_dec * gammalib::deg2rad * (*model)[1].scale();
+
+    // Return IRF value
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Return radial model instrument response and parameter gradients
+ *
+ * @param[in] event Observed event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first spatial parameter gradient.
+ * @return Value of instrument response function for a radial model.
+ *
+ * @exception GCTAException::bad_model_type
+ *            Model is not a radial model.
+ *
+ * Returns the value of the instrument response function for a radial model
+ * (see irf_radial()) and stores the gradients of the response with respect
+ * to the Right Ascension and Declination of the model centre and with
+ * respect to all free shape parameters of the model that signal gradient
+ * support in @p gradients. The gradients of all other shape parameters are
+ * set to zero.
+ *
+ * The instrument response and its gradients are integrated simultaneously
+ * using the same integration scheme as irf_radial(). The position gradients
+ * are obtained from infinitesimal rotations of the model (see
+ * irf_ptsrc_gradients()), the shape gradients from the gradients of the
+ * model that are provided by GModelSpatialRadial::eval_gradients(). For a
+ * disk model, the contribution of the disk edge to the radius gradient is
+ * added explicitly.
+ ***************************************************************************/
+double GCTAResponseIrf::irf_radial_gradients(const GEvent&       event,
+                                             const GSource&      source,
+                                             const GObservation& obs,
+                                             GVector&            gradients,
+                                             const int&          offset) const
+{
+    // Set number of iterations for Romberg integration (see irf_radial())
+    static const int iter_rho = 5;
+    static const int iter_phi = 5;
+
+    // Retrieve CTA pointing
+    const GCTAPointing& pnt = retrieve_pnt(G_IRF_RADIAL_GRADIENTS, obs);
+    const GCTAInstDir&  dir = retrieve_dir(G_IRF_RADIAL_GRADIENTS, event);
+
+    // Get pointer on radial model
+    const GModelSpatialRadial* model =
+          dynamic_cast<const GModelSpatialRadial*>(source.model());
+    if (model == NULL) {
+        throw GCTAException::bad_model_type(G_IRF_RADIAL_GRADIENTS);
+    }
+
+    // Collect free shape parameters that have gradients. Right Ascension
+    // and Declination are the first two parameters of the radial model.
+    std::vector<int> pars;
+    for (int i = 2; i < model->size(); ++i) {
+        if ((*model)[i].is_free() && (*model)[i].has_grad()) {
+            pars.push_back(i);
+        }
+    }
+
+    // Get event attributes
+    const GSkyDir& obsDir = dir.dir();
+
+    // Get source attributes
+    GSkyDir        centre  = model->dir();
+    const GEnergy& srcEng  = source.energy();
+    const GTime&   srcTime = source.time();
+
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt.zenith();
+    double azimuth = pnt.azimuth();
+
+    // Determine angular distances between measured photon direction, model
+    // centre and pointing direction [radians]
+    double zeta   = centre.dist(obsDir);
+    double eta    = pnt.dir().dist(obsDir);
+    double lambda = centre.dist(pnt.dir());
+
+    // Setup basis of model system. The first vector points to the model
+    // centre, the second towards the measured photon direction and the
+    // third completes the right-handed system.
+    GVector c = centre.celvector();
+    GVector p = obsDir.celvector();
+    GVector d = pnt.dir().celvector();
+    GVector u = p - (p * c) * c;
+    if (norm(u) <= 0.0) {
+        u = cross(c, GVector(0.0, 0.0, 1.0));
+        if (norm(u) <= 0.0) {
+            u = GVector(1.0, 0.0, 0.0);
+        }
+    }
+    u = u / norm(u);
+    GVector w = cross(c, u);
+
+    // Compute signed azimuth angle of pointing in model system [radians]
+    double omega0 = std::atan2(d * w, d * u);
+
+    // Setup rotation axes for Right Ascension and Declination
+    double  ra = centre.ra();
+    GVector k_ra(0.0, 0.0, 1.0);
+    GVector k_dec(std::sin(ra), -std::cos(ra), 0.0);
+
+    // Precompute rotation terms for PSF and photon offset angles
+    GMatrix dpsf(2,3);
+    GMatrix dph(2,3);
+    GVector basis[3] = {c, u, w};
+    for (int j = 0; j < 3; ++j) {
+        GVector b_x_p = cross(basis[j], p);
+        GVector b_x_d = cross(basis[j], d);
+        dpsf(0,j)     = k_ra  * b_x_p;
+        dpsf(1,j)     = k_dec * b_x_p;
+        dph(0,j)      = k_ra  * b_x_d;
+        dph(1,j)      = k_dec * b_x_d;
+    }
+
+    // Get log10(E/TeV) of true photon energy
+    double srcLogEng = srcEng.log10TeV();
+
+    // Assign the observed theta angle (eta) as the true theta angle
+    // between the source and the pointing directions (see irf_radial())
+    double theta = eta;
+    double phi   = 0.0; // Polar angle is not used by the CTA IRFs
+
+    // Get maximum PSF and source radius in radians.
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+    double src_max   = model->theta_max();
+
+    // Set radial model zenith angle range
+    double rho_min = (zeta > delta_max) ? zeta - delta_max : 0.0;
+    double rho_max = zeta + delta_max;
+    if (rho_max > src_max) {
+        rho_max = src_max;
+    }
+
+    // Initialise IRF value and gradients
+    int     npars = pars.size();
+    GVector values(3 + npars);
+
+    // Perform zenith angle integration if interval is valid
+    if (rho_max > rho_min) {
+
+        // Setup integration kernel
+        cta_irf_radial_grad_kern_rho integrand(*this,
+                                               *model,
+                                               pars,
+                                               zenith,
+                                               azimuth,
+                                               srcEng,
+                                               srcTime,
+                                               srcLogEng,
+                                               zeta,
+                                               lambda,
+                                               omega0,
+                                               delta_max,
+                                               dpsf,
+                                               dph,
+                                               iter_phi);
+
+        // Integrate over model's zenith angle
+        GIntegrals integral(&integrand);
+        integral.fixed_iter(iter_rho);
+
+        // Setup integration boundaries
+        std::vector<double> bounds;
+        bounds.push_back(rho_min);
+        bounds.push_back(rho_max);
+
+        // If the integration range includes a transition between full
+        // containment of model within Psf and partial containment, then
+        // add a boundary at this location
+        double transition_point = delta_max - zeta;
+        if (transition_point > rho_min && transition_point < rho_max) {
+            bounds.push_back(transition_point);
+        }
+
+        // If we have a shell model then add an integration boundary for the
+        // shell radius as a function discontinuity will occur at this
+        // location
+        const GModelSpatialRadialShell* shell = dynamic_cast<const GModelSpatialRadialShell*>(model);
+        if (shell != NULL) {
+            double shell_radius = shell->radius() * gammalib::deg2rad;
+            if (shell_radius > rho_min && shell_radius < rho_max) {
+                bounds.push_back(shell_radius);
+            }
+        }
+
+        // Integrate kernel
+        values = integral.romberg(bounds, iter_rho);
+
+        // If we have a disk model with a free radius then add the
+        // contribution of the disk edge to the radius gradient
+        const GModelSpatialRadialDisk* disk = dynamic_cast<const GModelSpatialRadialDisk*>(model);
+        if (disk != NULL) {
+            double disk_radius = disk->radius() * gammalib::deg2rad;
+            if (disk_radius > rho_min && disk_radius <= rho_max) {
+                for (int i = 0; i < npars; ++i) {
+                    if (&((*model)[pars[i]]) == &((*model)["Radius"])) {
+                        values[3+i] += integrand.eval(disk_radius)[0] *
+                                       gammalib::deg2rad *
+                                       (*model)[pars[i]].scale();
+                    }
+                }
+            }
+        }
+
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (gammalib::is_notanumber(values[0]) || gammalib::is_infinite(values[0])) {
+            std::cout << "*** ERROR: GCTAResponseIrf::irf_radial_gradients:";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << values[0];
+            std::cout << ", rho_min=" << rho_min;
+            std::cout << ", rho_max=" << rho_max;
+            std::cout << ", omega0=" << omega0 << ")";
+            std::cout << std::endl;
+        }
+        #endif
+
+        // Apply deadtime correction
+        values *= obs.deadc(srcTime);
+
+    } // endif: integration interval is valid
+
+    // Initialise gradients
+    for (int i = 0; i < model->size(); ++i) {
+        gradients[offset+i] = 0.0;
+    }
+
+    // Set position gradients
+    gradients[offset]   = values[1] * gammalib::deg2rad * (*model)[0].scale();
+    gradients[offset+1] = values[2] * gammalib::deg2rad * (*model)[1].scale();
+
+    // Set shape gradients
+    for (int i = 0; i < npars; ++i) {
+        gradients[offset+pars[i]] = values[3+i];
+    }
+
+    // Return IRF value
+    return (values[0]);
+}
+
+
+/***********************************************************************//**
+ * @brief Return instrument response and gradients for elliptical source
+ *        model
+ *
+ * @param[in] event Observed event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first spatial parameter gradient.
+ * @return Value of instrument response function for an elliptical model.
+ *
+ * @exception GCTAException::bad_model_type
+ *            Model is not an elliptical model.
+ *
+ * Returns the value of the instrument response function for an elliptical
+ * model (see irf_elliptical()) and stores the gradients of the response
+ * with respect to all free shape parameters of the model that signal
+ * gradient support in @p gradients. The gradients of all other parameters
+ * are set to zero.
+ *
+ * The instrument response and its gradients are integrated simultaneously
+ * using the Romberg integration scheme of irf_elliptical(), using the
+ * gradients of the model that are provided by
+ * GModelSpatialElliptical::eval_gradients(). The dependence of the
+ * integration boundaries on the shape parameters is neglected, as the
+ * boundary ellipse encloses the model up to its edge (see theta_max()). If
+ * no shape parameter needs a gradient, the response is computed by
+ * irf_elliptical().
+ ***************************************************************************/
+double GCTAResponseIrf::irf_elliptical_gradients(const GEvent&       event,
+                                                 const GSource&      source,
+                                                 const GObservation& obs,
+                                                 GVector&            gradients,
+                                                 const int&          offset) const
+{
+    // Set number of iterations for Romberg integration (see
+    // irf_elliptical())
+    static const int iter_rho = 5;
+    static const int iter_phi = 5;
+
+    // Get pointer on elliptical model
+    const GModelSpatialElliptical* model =
+          dynamic_cast<const GModelSpatialElliptical*>(source.model());
+    if (model == NULL) {
+        throw GCTAException::bad_model_type(G_IRF_ELLIPTICAL_GRADIENTS);
+    }
+
+    // Collect free shape parameters that have gradients. Right Ascension
+    // and Declination are the first two parameters of the elliptical model.
+    std::vector<int> pars;
+    for (int i = 2; i < model->size(); ++i) {
+        if ((*model)[i].is_free() && (*model)[i].has_grad()) {
+            pars.push_back(i);
+        }
+    }
+
+    // Initialise gradients
+    for (int i = 0; i < model->size(); ++i) {
+        gradients[offset+i] = 0.0;
+    }
+
+    // If no shape parameter needs a gradient then return the response
+    if (pars.empty()) {
+        return (irf_elliptical(event, source, obs));
+    }
+
+    // Retrieve CTA pointing
+    const GCTAPointing& pnt = retrieve_pnt(G_IRF_ELLIPTICAL_GRADIENTS, obs);
+    const GCTAInstDir&  dir = retrieve_dir(G_IRF_ELLIPTICAL_GRADIENTS, event);
+
+    // Get event attributes (measured photon)
+    const GSkyDir& obsDir = dir.dir();
+
+    // Get source attributes
+    const GSkyDir& centre  = model->dir();
+    const GEnergy& srcEng  = source.energy();
+    const GTime&   srcTime = source.time();
+
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt.zenith();
+    double azimuth = pnt.azimuth();
+
+    // Determine angular distance between observed photon direction and model
+    // centre and position angle of observed photon direction seen from the
+    // model centre [radians]
+    double rho_obs      = centre.dist(obsDir);
+    double posangle_obs = centre.posang(obsDir);
+
+    // Determine angular distance between model centre and pointing direction
+    // [radians]
+    double rho_pnt      = centre.dist(pnt.dir());
+    double posangle_pnt = centre.posang(pnt.dir());
+
+    // Compute azimuth angle of pointing in model coordinate system [radians]
+    double omega_pnt = posangle_pnt - posangle_obs;
+
+    // Get log10(E/TeV) of true photon energy
+    double srcLogEng = srcEng.log10TeV();
+
+    // Get maximum PSF radius [radians] (see irf_elliptical())
+    double theta     = pnt.dir().dist(obsDir);
+    double phi       = 0.0; //TODO: Implement IRF Phi dependence
+    double delta_max = psf_delta_max(theta, phi, zenith, azimuth, srcLogEng);
+
+    // Get the ellipse boundary (radians) (see irf_elliptical())
+    double semimajor;
+    double semiminor;
+    double posangle;
+    double aspect_ratio;
+    if (model->semimajor() >= model->semiminor()) {
+        aspect_ratio = (model->semimajor() > 0.0) ?
+                        model->semiminor() / model->semimajor() : 0.0;
+        posangle     = model->posangle() * gammalib::deg2rad;
+    }
+    else {
+        aspect_ratio = (model->semiminor() > 0.0) ?
+                        model->semimajor() / model->semiminor() : 0.0;
+        posangle     = model->posangle() * gammalib::deg2rad + gammalib::pihalf;
+    }
+    semimajor = model->theta_max();
+    semiminor = semimajor * aspect_ratio;
+
+    // Set zenith angle integration range for elliptical model
+    double rho_min = (rho_obs > delta_max) ? rho_obs - delta_max : 0.0;
+    double rho_max = rho_obs + delta_max;
+    if (rho_max > semimajor) {
+        rho_max = semimajor;
+    }
+
+    // Initialise IRF value and gradients
+    int     npars = pars.size();
+    GVector values(1 + npars);
+
+    // Perform zenith angle integration if interval is valid
+    if (rho_max > rho_min) {
+
+        // Setup integration kernel
+        cta_irf_elliptical_grad_kern_rho integrand(*this,
+                                                   *model,
+                                                   pars,
+                                                   semimajor,
+                                                   semiminor,
+                                                   posangle,
+                                                   zenith,
+                                                   azimuth,
+                                                   srcEng,
+                                                   srcTime,
+                                                   srcLogEng,
+                                                   rho_obs,
+                                                   posangle_obs,
+                                                   rho_pnt,
+                                                   omega_pnt,
+                                                   delta_max,
+                                                   iter_phi);
+
+        // Integrate over model's zenith angle
+        GIntegrals integral(&integrand);
+        integral.fixed_iter(iter_rho);
+
+        // Setup integration boundaries
+        std::vector<double> bounds;
+        bounds.push_back(rho_min);
+        bounds.push_back(rho_max);
+
+        // If the integration range includes the semiminor boundary, then
+        // add an integration boundary at that location
+        if (semiminor > rho_min && semiminor < rho_max) {
+            bounds.push_back(semiminor);
+        }
+
+        // Integrate kernel
+        values = integral.romberg(bounds, iter_rho);
+
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (gammalib::is_notanumber(values[0]) || gammalib::is_infinite(values[0])) {
+            std::cout << "*** ERROR: GCTAResponseIrf::irf_elliptical_gradients:";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << values[0];
+            std::cout << ", rho_min=" << rho_min;
+            std::cout << ", rho_max=" << rho_max << ")";
+            std::cout << std::endl;
+        }
+        #endif
+
+        // Apply deadtime correction
+        values *= obs.deadc(srcTime);
+
+    } // endif: integration interval is valid
+
+    // Set shape gradients
+    for (int i = 0; i < npars; ++i) {
+        gradients[offset+pars[i]] = values[1+i];
+    }
+
+    // Return IRF value
+    return (values[0]);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event list for IRF caching
+ *
+ * @param[in] event Event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[out] index Index of event in event list.
+ * @param[out] node True energy node.
+ * @return Pointer to event list (NULL if IRF values can not be cached).
+ *
+ * Returns a pointer to the event list in which the IRF value for @p event
+ * and @p source can be cached. IRF values can only be cached if the event
+ * is an atom of an event list. If no energy dispersion is used, the true
+ * energy equals the measured event energy and the true energy node is
+ * set to 0. If energy dispersion is summed over the nodes of a logarithmic
+ * true energy grid (see GResponse::edisp_nodes()), IRF values can only be
+ * cached if the source energy is a grid node, and the index of that grid
+ * node is returned. Cache values exist only for sources for which a cache
+ * key was set by irf_cache_keys().
+ ***************************************************************************/
+const GCTAEventList* GCTAResponseIrf::irf_cache_list(const GEvent&       event,
+                                                     const GSource&      source,
+                                                     const GObservation& obs,
+                                                     int*                index,
+                                                     int*                node) const
+{
+    // Initialise event list pointer
+    const GCTAEventList* list = NULL;
+
+    // Continue only if energy dispersion is not used or if energy
+    // dispersion is summed over true energy nodes
+    if (!use_edisp() || edisp_nodes() > 0) {
+
+        // Get event list and event atom
+        const GCTAEventList* events =
+              dynamic_cast<const GCTAEventList*>(obs.events());
+        const GCTAEventAtom* atom   =
+              dynamic_cast<const GCTAEventAtom*>(&event);
+
+        // Continue only if event is an atom of an event list
+        if (events != NULL && atom != NULL) {
+
+            // Without energy dispersion return event list
+            if (!use_edisp()) {
+                list   = events;
+                *index = atom->index();
+                *node  = 0;
+            }
+
+            // ... otherwise return event list if the source energy is a
+            // true energy grid node
+            else {
+                double x = std::log(source.energy().MeV()) *
+                           double(edisp_nodes()) / gammalib::ln10;
+                int    k = int(std::floor(x + 0.5));
+                if (std::abs(x - double(k)) < 1.0e-6) {
+                    list   = events;
+                    *index = atom->index();
+                    *node  = k;
+                }
+            }
+
+        } // endif: event was an atom of an event list
+
+    } // endif: IRF values may be cached
+
+    // Return event list
+    return list;
+}
+
+
+/***********************************************************************//**
+ * @brief Return observation for Nroi caching
+ *
+ * @param[in] model Sky model.
+ * @param[in] srcTime True photon arrival time.
+ * @param[in] obs Observation.
+ * @return Pointer to CTA observation (NULL if Nroi can not be cached).
+ *
+ * Returns a pointer to the CTA observation in which the spatial integral of
+ * @p model over the ROI can be cached. Nroi values can only be cached for
+ * named models without free spatial parameters, so that the cached values
+ * are not invalidated in every iteration of a fit. The method should only
+ * be called if no energy dispersion is used.
+ *
+ * The model type, the values of all spatial model parameters, the deadtime
+ * correction, the pointing and the ROI are set as the cache key of the
+ * model, so that a modification of any of them invalidates the cached
+ * values of the model.
+ ***************************************************************************/
+const GCTAObservation* GCTAResponseIrf::nroi_cache_obs(const GModelSky&    model,
+                                                       const GTime&        srcTime,
+                                                       const GObservation& obs) const
+{
+    // Initialise observation pointer
+    const GCTAObservation* cache = NULL;
+
+    // Get CTA observation and event list
+    const GCTAObservation* cta = dynamic_cast<const GCTAObservation*>(&obs);
+
+    // Continue only if the model is named and if the observation is a CTA
+    // observation with an event list
+    if (!model.name().empty() && cta != NULL &&
+        dynamic_cast<const GCTAEventList*>(cta->events()) != NULL) {
+
+        // Build cache key from spatial model type and parameters. Break if
+        // one of the parameters is free.
+        const GModelSpatial* spatial  = model.spatial();
+        std::vector<double>  key;
+        bool                 has_free = false;
+        key.push_back(double(spatial->code()));
+        for (int i = 0; i < spatial->size(); ++i) {
+            const GModelPar& par = (*spatial)[i];
+            if (par.is_free()) {
+                has_free = true;
+                break;
+            }
+            key.push_back(par.value());
+        }
+
+        // If no parameter is free then add the observation attributes to
+        // the cache key, set the cache key and return the observation
+        if (!has_free) {
+            const GCTARoi& roi = retrieve_roi(G_NROI, obs);
+            key.push_back(obs.deadc(srcTime));
+            key.push_back(cta->pointing().dir().ra_deg());
+            key.push_back(cta->pointing().dir().dec_deg());
+            key.push_back(roi.centre().dir().ra_deg());
+            key.push_back(roi.centre().dir().dec_deg());
+            key.push_back(roi.radius());
+            cta->nroi_cache_key(model.name(), key);
+            cache = cta;
+        }
+
+    } // endif: observation was CTA observation with event list
+
+    // Return observation
+    return cache;
+}
+
+
+/***********************************************************************//**
+ * @brief Return spatial integral of point source model
+ *
+ * @param[in] model Sky Model.
+ * @param[in] srcEng True photon energy.
+ * @param[in] srcTime True photon arrival time.
+ * @param[in] obsEng Observed event energy.
+ * @param[in] obsTime Observed event arrival time.
+ * @param[in] obs Observation.
+ *
+ * Computes the integral
+ *
+ * \f[
+ *    N_{\rm ROI}(E',t'|E,t) = \int_{\rm ROI} P(p',E',t'|E,t) dp'
+ * \f]
+ *
+ * of
+ *
+ * \f[
+ *    P(p',E',t'|E,t) = \int
+ *                      S(p,E,t) \times R(p',E',t'|p,E,t) \, dp
+ * \f]
+ *
+ * over the Region of Interest (ROI) for a point source model \f$S(p,E,t)\f$
+ * and the response function \f$R(p',E',t'|p,E,t)\f$.
+ ***************************************************************************/
+double GCTAResponseIrf::nroi_ptsrc(const GModelSky&    model,
+                                   const GEnergy&      srcEng,
+                                   const GTime&        srcTime,
+                                   const GEnergy&      obsEng,
+                                   const GTime&        obsTime,
+                                   const GObservation& obs) const
+{
+    // Get point source spatial model
+    const GModelSpatialPointSource* src =
+          static_cast<const GModelSpatialPointSource*>(model.spatial());
+
+    // Set Photon
+    GPhoton photon(src->dir(), srcEng, srcTime);
+
+    // Compute Nroi
+    double nroi = nirf(photon, obsEng, obsTime, obs);
+
+    // Return Nroi
+    return nroi;
+}
 
 
 /***********************************************************************//**
@@ -2804,11 +3909,11 @@ double GCTAResponseIrf::nroi_radial(const GModelSky&    model,
 
         // Compute rotation matrix to convert from native model coordinates,
         // given by (rho,omega), into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(spatial->dec() - 90.0);
         rz.eulerz(-spatial->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Compute position angle of ROI centre with respect to model
         // centre (radians)
@@ -3009,11 +4114,11 @@ double GCTAResponseIrf::nroi_elliptical(const GModelSky&    model,
 
         // Compute rotation matrix to convert from native model coordinates,
         // given by (rho,omega), into celestial coordinates.
-        GMatrix ry;
-        GMatrix rz;
+        GMatrix3 ry;
+        GMatrix3 rz;
         ry.eulery(spatial->dec() - 90.0);
         rz.eulerz(-spatial->ra());
-        GMatrix rot = (ry * rz).transpose();
+        GMatrix3 rot = (ry * rz).transpose();
 
         // Compute position angle of ROI centre with respect to model
         // centre (radians)
@@ -3121,130 +4226,88 @@ double GCTAResponseIrf::nroi_diffuse(const GModelSky&    model,
     static const int iter_phi = 9;
 
     // Initialise Nroi value
-    double nroi     = 0.0;
-    bool   has_nroi = false;
-
-    // Build unique identifier
-    std::string id = model.name() + "::" + obs.id();
-
-    // Check if Nroi value is already in cache
-    #if defined(G_USE_NPRED_CACHE)
-    if (!m_npred_names.empty()) {
-
-         // Search for unique identifier, and if found, recover Npred value
-         // and break
-         for (int i = 0; i < m_npred_names.size(); ++i) {
-             if (m_npred_names[i]    == id &&
-                 m_npred_energies[i] == srcEng &&
-                 m_npred_times[i]    == srcTime) {
-                 nroi     = m_npred_values[i];
-                 has_nroi = true;
-                 #if defined(G_DEBUG_NROI_DIFFUSE)
-                 std::cout << "GCTAResponseIrf::nroi_diffuse:";
-                 std::cout << " cache=" << i;
-                 std::cout << " nroi=" << nroi << std::endl;
-                 #endif
-                 break;
-             }
-         }
-
-    } // endif: there were values in the Npred cache
-    #endif
-
-    // Continue only if no Npred cache value was found
-    if (!has_nroi) {
+    double nroi = 0.0;
 
-        // Retrieve CTA observation, ROI and pointing
-        const GCTAObservation& cta = retrieve_obs(G_NROI_DIFFUSE, obs);
-        const GCTARoi&         roi = retrieve_roi(G_NROI_DIFFUSE, obs);
-        const GCTAPointing&    pnt = cta.pointing();
+    // Retrieve CTA observation, ROI and pointing
+    const GCTAObservation& cta = retrieve_obs(G_NROI_DIFFUSE, obs);
+    const GCTARoi&         roi = retrieve_roi(G_NROI_DIFFUSE, obs);
+    const GCTAPointing&    pnt = cta.pointing();
 
-        // Get pointer on spatial model
-        const GModelSpatial* spatial =
-            dynamic_cast<const GModelSpatial*>(model.spatial());
-        if (spatial == NULL) {
-            throw GCTAException::bad_model_type(G_NROI_DIFFUSE);
-        }
+    // Get pointer on spatial model
+    const GModelSpatial* spatial =
+        dynamic_cast<const GModelSpatial*>(model.spatial());
+    if (spatial == NULL) {
+        throw GCTAException::bad_model_type(G_NROI_DIFFUSE);
+    }
 
-        // Get pointing direction zenith angle and azimuth [radians]
-        double zenith  = pnt.zenith();
-        double azimuth = pnt.azimuth();
+    // Get pointing direction zenith angle and azimuth [radians]
+    double zenith  = pnt.zenith();
+    double azimuth = pnt.azimuth();
 
-        // Get log10(E/TeV) of true photon energy
-        double srcLogEng = srcEng.log10TeV();
+    // Get log10(E/TeV) of true photon energy
+    double srcLogEng = srcEng.log10TeV();
 
-        // Get maximum PSF radius (radians). We do this for the onaxis PSF only,
-        // as this allows us doing this computation in the outer loop. This
-        // should be sufficient here, unless the offaxis PSF becomes much worse
-        // than the onaxis PSF. In this case, we may add a safety factor here
-        // to make sure we encompass the entire PSF.
-        double psf_max_radius = psf_delta_max(0.0, 0.0, zenith, azimuth, srcLogEng);
+    // Get maximum PSF radius (radians). We do this for the onaxis PSF only,
+    // as this allows us doing this computation in the outer loop. This
+    // should be sufficient here, unless the offaxis PSF becomes much worse
+    // than the onaxis PSF. In this case, we may add a safety factor here
+    // to make sure we encompass the entire PSF.
+    double psf_max_radius = psf_delta_max(0.0, 0.0, zenith, azimuth, srcLogEng);
 
-        // Extract ROI radius (radians)
-        double roi_radius = roi.radius() * gammalib::deg2rad;
+    // Extract ROI radius (radians)
+    double roi_radius = roi.radius() * gammalib::deg2rad;
 
-        // Compute the ROI radius plus maximum PSF radius (radians). Any photon
-        // coming from beyond this radius will not make it in the dataspace and
-        // thus can be neglected.
-        double roi_psf_radius = roi_radius + psf_max_radius;
+    // Compute the ROI radius plus maximum PSF radius (radians). Any photon
+    // coming from beyond this radius will not make it in the dataspace and
+    // thus can be neglected.
+    double roi_psf_radius = roi_radius + psf_max_radius;
 
-        // Perform offset angle integration only if interval is valid
-        if (roi_psf_radius > 0.0) {
+    // Perform offset angle integration only if interval is valid
+    if (roi_psf_radius > 0.0) {
 
-            // Compute rotation matrix to convert from native ROI coordinates,
-            // given by (theta,phi), into celestial coordinates.
-            GMatrix ry;
-            GMatrix rz;
-            ry.eulery(roi.centre().dir().dec_deg() - 90.0);
-            rz.eulerz(-roi.centre().dir().ra_deg());
-            GMatrix rot = (ry * rz).transpose();
+        // Compute rotation matrix to convert from native ROI coordinates,
+        // given by (theta,phi), into celestial coordinates.
+        GMatrix3 ry;
+        GMatrix3 rz;
+        ry.eulery(roi.centre().dir().dec_deg() - 90.0);
+        rz.eulerz(-roi.centre().dir().ra_deg());
+        GMatrix3 rot = (ry * rz).transpose();
 
-            // Setup integration kernel
-            cta_nroi_diffuse_kern_theta integrand(*this,
-                                                  *spatial,
-                                                  srcEng,
-                                                  srcTime,
-                                                  obsEng,
-                                                  obsTime,
-                                                  cta,
-                                                  rot,
-                                                  iter_phi);
-
-            // Integrate over model's zenith angle
-            GIntegral integral(&integrand);
-            integral.fixed_iter(iter_rho);
-            nroi = integral.romberg(0.0, roi_psf_radius);
-
-            // Compile option: Show integration results
-            #if defined(G_DEBUG_NROI_DIFFUSE)
-            std::cout << "GCTAResponseIrf::nroi_diffuse:";
-            std::cout << " roi_psf_radius=" << roi_psf_radius;
-            std::cout << " nroi=" << npred;
-            std::cout << " id=" << id << std::endl;
-            #endif
+        // Setup integration kernel
+        cta_nroi_diffuse_kern_theta integrand(*this,
+                                              *spatial,
+                                              srcEng,
+                                              srcTime,
+                                              obsEng,
+                                              obsTime,
+                                              cta,
+                                              rot,
+                                              iter_phi);
 
-        } // endif: offset angle range was valid
+        // Integrate over model's zenith angle
+        GIntegral integral(&integrand);
+        integral.fixed_iter(iter_rho);
+        nroi = integral.romberg(0.0, roi_psf_radius);
 
-        // Store result in Npred cache
-        #if defined(G_USE_NPRED_CACHE)
-        m_npred_names.push_back(id);
-        m_npred_energies.push_back(srcEng);
-        m_npred_times.push_back(srcTime);
-        m_npred_values.push_back(nroi);
+        // Compile option: Show integration results
+        #if defined(G_DEBUG_NROI_DIFFUSE)
+        std::cout << "GCTAResponseIrf::nroi_diffuse:";
+        std::cout << " roi_psf_radius=" << roi_psf_radius;
+        std::cout << " nroi=" << nroi << std::endl;
         #endif
 
-        // Debug: Check for NaN
-        #if defined(G_NAN_CHECK)
-        if (gammalib::is_notanumber(nroi) || gammalib::is_infinite(nroi)) {
-            std::cout << "*** ERROR: GCTAResponseIrf::nroi_diffuse:";
-            std::cout << " NaN/Inf encountered";
-            std::cout << " (nroi=" << nroi;
-            std::cout << ", roi_psf_radius=" << roi_psf_radius;
-            std::cout << ")" << std::endl;
-        }
-        #endif
+    } // endif: offset angle range was valid
 
-    } // endif: Nroi computation required
+    // Debug: Check for NaN
+    #if defined(G_NAN_CHECK)
+    if (gammalib::is_notanumber(nroi) || gammalib::is_infinite(nroi)) {
+        std::cout << "*** ERROR: GCTAResponseIrf::nroi_diffuse:";
+        std::cout << " NaN/Inf encountered";
+        std::cout << " (nroi=" << nroi;
+        std::cout << ", roi_psf_radius=" << roi_psf_radius;
+        std::cout << ")" << std::endl;
+    }
+    #endif
 
     // Return Nroi
     return nroi;
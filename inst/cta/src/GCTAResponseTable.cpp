@@ -50,6 +50,18 @@
                                                                   " double&)"
 #define G_INX_OPERATOR3        "GCTAResponseTable::operator()(int&, double&,"\
                                                          " double&, double&)"
+#define G_BATCH_OPERATOR1      "GCTAResponseTable::operator()(int&, double*,"\
+                                                                  " double*)"
+#define G_BATCH_OPERATOR2      "GCTAResponseTable::operator()(int&, double*,"\
+                                                         " double*, double*)"
+#define G_BATCH_OPERATOR3      "GCTAResponseTable::operator()(int&, double*,"\
+                                                " double*, double*, double*)"
+#define G_BATCH_INX_OPERATOR1     "GCTAResponseTable::operator()(int&, int&,"\
+                                                         " double*, double*)"
+#define G_BATCH_INX_OPERATOR2     "GCTAResponseTable::operator()(int&, int&,"\
+                                                " double*, double*, double*)"
+#define G_BATCH_INX_OPERATOR3     "GCTAResponseTable::operator()(int&, int&,"\
+                                       " double*, double*, double*, double*)"
 #define G_AXIS                                "GCTAResponseTable::axis(int&)"
 #define G_AXIS_LO_NAME                "GCTAResponseTable::axis_lo_name(int&)"
 #define G_AXIS_HI_NAME                "GCTAResponseTable::axis_hi_name(int&)"
@@ -223,8 +235,8 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg) const
 
     // Optionally check that we have at least one dimension
     #if defined(G_RANGE_CHECK)
-    if (num < 1) {
-        throw GCTAException::bad_rsp_table_dim(G_OPERATOR1, num, 1);
+    if (m_naxes < 1) {
+        throw GCTAException::bad_rsp_table_dim(G_OPERATOR1, m_naxes, 1);
     }
     #endif
 
@@ -232,12 +244,14 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg) const
     std::vector<double> result(num);
 
     // Set indices and weighting factors for interpolation
-    update(arg);
+    int    inx[2];
+    double wgt[2];
+    update(arg, inx, wgt);
 
     // Perform 1D interpolation
     for (int i = 0; i < num; ++i) {
-        result[i] = m_wgt_left  * m_pars[i][m_inx_left] +
-                    m_wgt_right * m_pars[i][m_inx_right];
+        result[i] = wgt[0] * m_pars[i][inx[0]] +
+                    wgt[1] * m_pars[i][inx[1]];
     }
 
     // Return result vector
@@ -271,8 +285,8 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg1,
 
     // Optionally check that we have at least two dimensions
     #if defined(G_RANGE_CHECK)
-    if (num < 2) {
-        throw GCTAException::bad_rsp_table_dim(G_OPERATOR2, num, 2);
+    if (m_naxes < 2) {
+        throw GCTAException::bad_rsp_table_dim(G_OPERATOR2, m_naxes, 2);
     }
     #endif
 
@@ -280,14 +294,16 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg1,
     std::vector<double> result(num);
 
     // Set indices and weighting factors for interpolation
-    update(arg1, arg2);
+    int    inx[4];
+    double wgt[4];
+    update(arg1, arg2, inx, wgt);
 
     // Perform 2D interpolation
     for (int i = 0; i < num; ++i) {
-        result[i] = m_wgt1 * m_pars[i][m_inx1] +
-                    m_wgt2 * m_pars[i][m_inx2] +
-                    m_wgt3 * m_pars[i][m_inx3] +
-                    m_wgt4 * m_pars[i][m_inx4];
+        result[i] = wgt[0] * m_pars[i][inx[0]] +
+                    wgt[1] * m_pars[i][inx[1]] +
+                    wgt[2] * m_pars[i][inx[2]] +
+                    wgt[3] * m_pars[i][inx[3]];
     }
 
     // Return result vector
@@ -323,8 +339,8 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg1,
 
     // Optionally check that we have at least three dimensions
     #if defined(G_RANGE_CHECK)
-    if (num < 3) {
-        throw GCTAException::bad_rsp_table_dim(G_OPERATOR3, num, 3);
+    if (m_naxes < 3) {
+        throw GCTAException::bad_rsp_table_dim(G_OPERATOR3, m_naxes, 3);
     }
     #endif
 
@@ -332,18 +348,20 @@ std::vector<double> GCTAResponseTable::operator()(const double& arg1,
     std::vector<double> result(num);
 
     // Set indices and weighting factors for interpolation
-    update(arg1, arg2, arg3);
+    int    inx[8];
+    double wgt[8];
+    update(arg1, arg2, arg3, inx, wgt);
 
     // Perform 3D interpolation
     for (int i = 0; i < num; ++i) {
-        result[i] = m_wgt1 * m_pars[i][m_inx1] +
-                    m_wgt2 * m_pars[i][m_inx2] +
-                    m_wgt3 * m_pars[i][m_inx3] +
-                    m_wgt4 * m_pars[i][m_inx4] +
-                    m_wgt5 * m_pars[i][m_inx5] +
-                    m_wgt6 * m_pars[i][m_inx6] +
-                    m_wgt7 * m_pars[i][m_inx7] +
-                    m_wgt8 * m_pars[i][m_inx8] ;
+        result[i] = wgt[0] * m_pars[i][inx[0]] +
+                    wgt[1] * m_pars[i][inx[1]] +
+                    wgt[2] * m_pars[i][inx[2]] +
+                    wgt[3] * m_pars[i][inx[3]] +
+                    wgt[4] * m_pars[i][inx[4]] +
+                    wgt[5] * m_pars[i][inx[5]] +
+                    wgt[6] * m_pars[i][inx[6]] +
+                    wgt[7] * m_pars[i][inx[7]];
     }
 
     // Return result vector
@@ -479,11 +497,13 @@ double GCTAResponseTable::operator()(const int& index, const double& arg) const
     #endif
 
     // Set indices and weighting factors for interpolation
-    update(arg);
+    int    inx[2];
+    double wgt[2];
+    update(arg, inx, wgt);
 
     // Perform 1D interpolation
-    double result = m_wgt_left  * m_pars[index][m_inx_left] +
-                    m_wgt_right * m_pars[index][m_inx_right];
+    double result = wgt[0] * m_pars[index][inx[0]] +
+                    wgt[1] * m_pars[index][inx[1]];
 
     // Return result
     return result;
@@ -520,13 +540,15 @@ double GCTAResponseTable::operator()(const int& index, const double& arg1,
     #endif
 
     // Set indices and weighting factors for interpolation
-    update(arg1, arg2);
+    int    inx[4];
+    double wgt[4];
+    update(arg1, arg2, inx, wgt);
 
     // Perform 2D interpolation
-    double result = m_wgt1 * m_pars[index][m_inx1] +
-                    m_wgt2 * m_pars[index][m_inx2] +
-                    m_wgt3 * m_pars[index][m_inx3] +
-                    m_wgt4 * m_pars[index][m_inx4];
+    double result = wgt[0] * m_pars[index][inx[0]] +
+                    wgt[1] * m_pars[index][inx[1]] +
+                    wgt[2] * m_pars[index][inx[2]] +
+                    wgt[3] * m_pars[index][inx[3]];
 
     // Return result
     return result;
@@ -566,23 +588,320 @@ double GCTAResponseTable::operator()(const int&    index,
     #endif
 
     // Set indices and weighting factors for interpolation
-    update(arg1, arg2, arg3);
+    int    inx[8];
+    double wgt[8];
+    update(arg1, arg2, arg3, inx, wgt);
 
     // Perform 3D interpolation
-    double result = m_wgt1 * m_pars[index][m_inx1] +
-                    m_wgt2 * m_pars[index][m_inx2] +
-                    m_wgt3 * m_pars[index][m_inx3] +
-                    m_wgt4 * m_pars[index][m_inx4] +
-                    m_wgt5 * m_pars[index][m_inx5] +
-                    m_wgt6 * m_pars[index][m_inx6] +
-                    m_wgt7 * m_pars[index][m_inx7] +
-                    m_wgt8 * m_pars[index][m_inx8];
+    double result = wgt[0] * m_pars[index][inx[0]] +
+                    wgt[1] * m_pars[index][inx[1]] +
+                    wgt[2] * m_pars[index][inx[2]] +
+                    wgt[3] * m_pars[index][inx[3]] +
+                    wgt[4] * m_pars[index][inx[4]] +
+                    wgt[5] * m_pars[index][inx[5]] +
+                    wgt[6] * m_pars[index][inx[6]] +
+                    wgt[7] * m_pars[index][inx[7]];
 
     // Return result
     return result;
 }
 
 
+/***********************************************************************//**
+ * @brief Batch linear interpolation operator for 1D tables
+ *
+ * @param[in] num Number of arguments.
+ * @param[in] arg Arguments (array of @p num values).
+ * @param[out] pars Response parameters (array of @p num*size() values).
+ *
+ * @exception GCTAException::bad_rsp_table_dim
+ *            Response table has less than one dimension.
+ *
+ * Evaluates all response parameters for an array of arguments. Response
+ * parameter @p i at argument @p k is written into @p pars[i*num+k]. The
+ * result is identical to calling operator()(double&) for each argument, but
+ * no memory is allocated and the interpolation indices and weights are
+ * computed only once per argument.
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    num,
+                                   const double* arg,
+                                   double*       pars) const
+{
+    // Optionally check that we have at least one dimension
+    #if defined(G_RANGE_CHECK)
+    if (m_naxes < 1) {
+        throw GCTAException::bad_rsp_table_dim(G_BATCH_OPERATOR1, m_naxes, 1);
+    }
+    #endif
+
+    // Loop over arguments
+    for (int k = 0; k < num; ++k) {
+
+        // Set indices and weighting factors for interpolation
+        int    inx[2];
+        double wgt[2];
+        update(arg[k], inx, wgt);
+
+        // Perform 1D interpolation
+        for (int i = 0; i < m_npars; ++i) {
+            pars[i*num+k] = wgt[0] * m_pars[i][inx[0]] +
+                            wgt[1] * m_pars[i][inx[1]];
+        }
+
+    } // endfor: looped over arguments
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Batch bilinear interpolation operator for 2D tables
+ *
+ * @param[in] num Number of argument pairs.
+ * @param[in] arg1 Arguments for first axis (array of @p num values).
+ * @param[in] arg2 Arguments for second axis (array of @p num values).
+ * @param[out] pars Response parameters (array of @p num*size() values).
+ *
+ * @exception GCTAException::bad_rsp_table_dim
+ *            Response table has less than two dimensions.
+ *
+ * Evaluates all response parameters for arrays of argument pairs. Response
+ * parameter @p i at argument pair @p k is written into @p pars[i*num+k].
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   double*       pars) const
+{
+    // Optionally check that we have at least two dimensions
+    #if defined(G_RANGE_CHECK)
+    if (m_naxes < 2) {
+        throw GCTAException::bad_rsp_table_dim(G_BATCH_OPERATOR2, m_naxes, 2);
+    }
+    #endif
+
+    // Loop over argument pairs
+    for (int k = 0; k < num; ++k) {
+
+        // Set indices and weighting factors for interpolation
+        int    inx[4];
+        double wgt[4];
+        update(arg1[k], arg2[k], inx, wgt);
+
+        // Perform 2D interpolation
+        for (int i = 0; i < m_npars; ++i) {
+            const double* par = &(m_pars[i][0]);
+            pars[i*num+k] = wgt[0] * par[inx[0]] +
+                            wgt[1] * par[inx[1]] +
+                            wgt[2] * par[inx[2]] +
+                            wgt[3] * par[inx[3]];
+        }
+
+    } // endfor: looped over argument pairs
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Batch trilinear interpolation operator for 3D tables
+ *
+ * @param[in] num Number of argument triplets.
+ * @param[in] arg1 Arguments for first axis (array of @p num values).
+ * @param[in] arg2 Arguments for second axis (array of @p num values).
+ * @param[in] arg3 Arguments for third axis (array of @p num values).
+ * @param[out] pars Response parameters (array of @p num*size() values).
+ *
+ * @exception GCTAException::bad_rsp_table_dim
+ *            Response table has less than three dimensions.
+ *
+ * Evaluates all response parameters for arrays of argument triplets.
+ * Response parameter @p i at argument triplet @p k is written into
+ * @p pars[i*num+k].
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   const double* arg3,
+                                   double*       pars) const
+{
+    // Optionally check that we have at least three dimensions
+    #if defined(G_RANGE_CHECK)
+    if (m_naxes < 3) {
+        throw GCTAException::bad_rsp_table_dim(G_BATCH_OPERATOR3, m_naxes, 3);
+    }
+    #endif
+
+    // Loop over argument triplets
+    for (int k = 0; k < num; ++k) {
+
+        // Set indices and weighting factors for interpolation
+        int    inx[8];
+        double wgt[8];
+        update(arg1[k], arg2[k], arg3[k], inx, wgt);
+
+        // Perform 3D interpolation
+        for (int i = 0; i < m_npars; ++i) {
+            const double* par = &(m_pars[i][0]);
+            pars[i*num+k] = wgt[0] * par[inx[0]] +
+                            wgt[1] * par[inx[1]] +
+                            wgt[2] * par[inx[2]] +
+                            wgt[3] * par[inx[3]] +
+                            wgt[4] * par[inx[4]] +
+                            wgt[5] * par[inx[5]] +
+                            wgt[6] * par[inx[6]] +
+                            wgt[7] * par[inx[7]];
+        }
+
+    } // endfor: looped over argument triplets
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Batch linear interpolation operator for 1D tables
+ *
+ * @param[in] index Table index [0,...,size()-1].
+ * @param[in] num Number of arguments.
+ * @param[in] arg Arguments (array of @p num values).
+ * @param[out] values Response parameter (array of @p num values).
+ *
+ * @exception GException::out_of_range
+ *            Table index out of valid range.
+ *
+ * Evaluates one response parameter for an array of arguments.
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg,
+                                   double*       values) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_BATCH_INX_OPERATOR1, index, size()-1);
+    }
+    #endif
+
+    // Get pointer to parameter
+    const double* par = &(m_pars[index][0]);
+
+    // Perform 1D interpolation
+    for (int k = 0; k < num; ++k) {
+        int    inx[2];
+        double wgt[2];
+        update(arg[k], inx, wgt);
+        values[k] = wgt[0] * par[inx[0]] +
+                    wgt[1] * par[inx[1]];
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Batch bilinear interpolation operator for 2D tables
+ *
+ * @param[in] index Table index [0,...,size()-1].
+ * @param[in] num Number of argument pairs.
+ * @param[in] arg1 Arguments for first axis (array of @p num values).
+ * @param[in] arg2 Arguments for second axis (array of @p num values).
+ * @param[out] values Response parameter (array of @p num values).
+ *
+ * @exception GException::out_of_range
+ *            Table index out of valid range.
+ *
+ * Evaluates one response parameter for arrays of argument pairs.
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   double*       values) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_BATCH_INX_OPERATOR2, index, size()-1);
+    }
+    #endif
+
+    // Get pointer to parameter
+    const double* par = &(m_pars[index][0]);
+
+    // Perform 2D interpolation
+    for (int k = 0; k < num; ++k) {
+        int    inx[4];
+        double wgt[4];
+        update(arg1[k], arg2[k], inx, wgt);
+        values[k] = wgt[0] * par[inx[0]] +
+                    wgt[1] * par[inx[1]] +
+                    wgt[2] * par[inx[2]] +
+                    wgt[3] * par[inx[3]];
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Batch trilinear interpolation operator for 3D tables
+ *
+ * @param[in] index Table index [0,...,size()-1].
+ * @param[in] num Number of argument triplets.
+ * @param[in] arg1 Arguments for first axis (array of @p num values).
+ * @param[in] arg2 Arguments for second axis (array of @p num values).
+ * @param[in] arg3 Arguments for third axis (array of @p num values).
+ * @param[out] values Response parameter (array of @p num values).
+ *
+ * @exception GException::out_of_range
+ *            Table index out of valid range.
+ *
+ * Evaluates one response parameter for arrays of argument triplets.
+ ***************************************************************************/
+void GCTAResponseTable::operator()(const int&    index,
+                                   const int&    num,
+                                   const double* arg1,
+                                   const double* arg2,
+                                   const double* arg3,
+                                   double*       values) const
+{
+    // Optionally check if the index is valid
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= size()) {
+        throw GException::out_of_range(G_BATCH_INX_OPERATOR3, index, size()-1);
+    }
+    #endif
+
+    // Get pointer to parameter
+    const double* par = &(m_pars[index][0]);
+
+    // Perform 3D interpolation
+    for (int k = 0; k < num; ++k) {
+        int    inx[8];
+        double wgt[8];
+        update(arg1[k], arg2[k], arg3[k], inx, wgt);
+        values[k] = wgt[0] * par[inx[0]] +
+                    wgt[1] * par[inx[1]] +
+                    wgt[2] * par[inx[2]] +
+                    wgt[3] * par[inx[3]] +
+                    wgt[4] * par[inx[4]] +
+                    wgt[5] * par[inx[5]] +
+                    wgt[6] * par[inx[6]] +
+                    wgt[7] * par[inx[7]];
+    }
+
+    // Return
+    return;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Public methods                              =
@@ -975,7 +1294,8 @@ const std::string& GCTAResponseTable::unit(const int& index) const
  * @param[in] name Axis name. 
  * @param[in] unit Axis unit.
  *
- * Append an axis to the response table.
+ * Append an axis to the response table. The interpolation nodes of the
+ * axis are set to the bin centres.
  *
  * @todo Throw an exception when the length of axis_lo and axis_hi are
  * different.
@@ -997,6 +1317,15 @@ void GCTAResponseTable::append_axis(const std::vector<double>& axis_lo,
     m_units_lo.push_back(unit);
     m_units_hi.push_back(unit);
 
+    // Create node array using the bin centres
+    int                 num = (axis_lo.size() < axis_hi.size()) ? axis_lo.size()
+                                                                 : axis_hi.size();
+    std::vector<double> axis_nodes(num);
+    for (int k = 0; k < num; ++k) {
+        axis_nodes[k] = 0.5*(axis_lo[k] + axis_hi[k]);
+    }
+    m_axis_nodes.push_back(GNodeArray(axis_nodes));
+
     // Increment number of axes
     m_naxes++;
 
@@ -1292,28 +1621,6 @@ void GCTAResponseTable::init_members(void)
     m_axis_nodes.clear();
     m_pars.clear();
 
-    // Initialise cache
-    m_inx_left  = 0;
-    m_inx_right = 0;
-    m_wgt_left  = 0.0;
-    m_wgt_right = 0.0;
-    m_inx1      = 0;
-    m_inx2      = 0;
-    m_inx3      = 0;
-    m_inx4      = 0;
-    m_inx5      = 0;
-    m_inx6      = 0;
-    m_inx7      = 0;
-    m_inx8      = 0;
-    m_wgt1      = 0.0;
-    m_wgt2      = 0.0;
-    m_wgt3      = 0.0;
-    m_wgt4      = 0.0;
-    m_wgt5      = 0.0;
-    m_wgt6      = 0.0;
-    m_wgt7      = 0.0;
-    m_wgt8      = 0.0;
-
     // Return
     return;
 }
@@ -1343,28 +1650,6 @@ void GCTAResponseTable::copy_members(const GCTAResponseTable& table)
     m_axis_nodes  = table.m_axis_nodes;
     m_pars        = table.m_pars;
 
-    // Copy cache
-    m_inx_left  = table.m_inx_left;
-    m_inx_right = table.m_inx_right;
-    m_wgt_left  = table.m_wgt_left;
-    m_wgt_right = table.m_wgt_right;
-    m_inx1      = table.m_inx1;
-    m_inx2      = table.m_inx2;
-    m_inx3      = table.m_inx3;
-    m_inx4      = table.m_inx4;
-    m_inx5      = table.m_inx5;
-    m_inx6      = table.m_inx6;
-    m_inx7      = table.m_inx7;
-    m_inx8      = table.m_inx8;
-    m_wgt1      = table.m_wgt1;
-    m_wgt2      = table.m_wgt2;
-    m_wgt3      = table.m_wgt3;
-    m_wgt4      = table.m_wgt4;
-    m_wgt5      = table.m_wgt5;
-    m_wgt6      = table.m_wgt6;
-    m_wgt7      = table.m_wgt7;
-    m_wgt8      = table.m_wgt8;
-
     // Return
     return;
 }
@@ -1678,29 +1963,23 @@ void GCTAResponseTable::read_pars(const GFitsTable& hdu)
 
 
 /***********************************************************************//**
- * @brief Update 1D cache
+ * @brief Compute 1D interpolation indices and weights
  *
  * @param[in] arg Argument.
+ * @param[out] inx Array of 2 indices.
+ * @param[out] wgt Array of 2 weights.
  *
- * Updates the 1D interpolation cache. The interpolation cache is composed
- * of two indices and weights that define 2 data values of the 2D table
- * that are used for linear interpolation.
- *
- * @todo Write down formula
+ * Computes the two indices and weights that define the 2 data values of
+ * the table that are used for linear interpolation.
  ***************************************************************************/
-void GCTAResponseTable::update(const double& arg) const
+void GCTAResponseTable::update(const double& arg, int* inx, double* wgt) const
 {
-    // Get pointer to node array
-    const GNodeArray* nodes = &(m_axis_nodes[0]);
-
-    // Set value for node array
-    nodes->set_value(arg);
-
     // Set indices and weighting factors for interpolation
-    m_inx_left  = nodes->inx_left();
-    m_inx_right = nodes->inx_right();
-    m_wgt_left  = nodes->wgt_left();
-    m_wgt_right = nodes->wgt_right();
+    GNodeArray::weights w = m_axis_nodes[0].locate(arg);
+    inx[0] = w.inx_left;
+    inx[1] = w.inx_right;
+    wgt[0] = w.wgt_left;
+    wgt[1] = w.wgt_right;
 
     // Return
     return;
@@ -1708,43 +1987,47 @@ void GCTAResponseTable::update(const double& arg) const
 
 
 /***********************************************************************//**
- * @brief Update 2D cache
+ * @brief Compute 2D interpolation indices and weights
  *
  * @param[in] arg1 Argument for first axis.
  * @param[in] arg2 Argument for second axis.
+ * @param[out] inx Array of 4 indices.
+ * @param[out] wgt Array of 4 weights.
  *
- * Updates the 2D interpolation cache. The interpolation cache is composed
- * of four indices and weights that define 4 data values of the 2D table
- * that are used for bilinear interpolation.
- *
- * @todo Write down formula
+ * Computes the four indices and weights that define the 4 data values of
+ * the 2D table that are used for bilinear interpolation.
  ***************************************************************************/
-void GCTAResponseTable::update(const double& arg1, const double& arg2) const
+void GCTAResponseTable::update(const double& arg1, const double& arg2,
+                               int* inx, double* wgt) const
 {
-    // Get pointers to node arrays
-    const GNodeArray* nodes1 = &(m_axis_nodes[0]);
-    const GNodeArray* nodes2 = &(m_axis_nodes[1]);
-
-    // Set values for node arrays
-    nodes1->set_value(arg1);
-    nodes2->set_value(arg2);
+    // Locate arguments on node arrays
+    GNodeArray::weights w1 = m_axis_nodes[0].locate(arg1);
+    GNodeArray::weights w2 = m_axis_nodes[1].locate(arg2);
+    int    inx1_left  = w1.inx_left;
+    int    inx1_right = w1.inx_right;
+    int    inx2_left  = w2.inx_left;
+    int    inx2_right = w2.inx_right;
+    double wgt1_left  = w1.wgt_left;
+    double wgt1_right = w1.wgt_right;
+    double wgt2_left  = w2.wgt_left;
+    double wgt2_right = w2.wgt_right;
 
     // Compute offsets
-    int size1        = axis(0);
-    int offset_left  = nodes2->inx_left()  * size1;
-    int offset_right = nodes2->inx_right() * size1;
+    int size1        = m_axis_nodes[0].size();
+    int offset_left  = inx2_left  * size1;
+    int offset_right = inx2_right * size1;
 
     // Set indices for bi-linear interpolation
-    m_inx1 = nodes1->inx_left()  + offset_left;
-    m_inx2 = nodes1->inx_left()  + offset_right;
-    m_inx3 = nodes1->inx_right() + offset_left;
-    m_inx4 = nodes1->inx_right() + offset_right;
+    inx[0] = inx1_left  + offset_left;
+    inx[1] = inx1_left  + offset_right;
+    inx[2] = inx1_right + offset_left;
+    inx[3] = inx1_right + offset_right;
 
     // Set weighting factors for bi-linear interpolation
-    m_wgt1 = nodes1->wgt_left()  * nodes2->wgt_left();
-    m_wgt2 = nodes1->wgt_left()  * nodes2->wgt_right();
-    m_wgt3 = nodes1->wgt_right() * nodes2->wgt_left();
-    m_wgt4 = nodes1->wgt_right() * nodes2->wgt_right();
+    wgt[0] = wgt1_left  * wgt2_left;
+    wgt[1] = wgt1_left  * wgt2_right;
+    wgt[2] = wgt1_right * wgt2_left;
+    wgt[3] = wgt1_right * wgt2_right;
 
     // Return
     return;
@@ -1752,59 +2035,64 @@ void GCTAResponseTable::update(const double& arg1, const double& arg2) const
 
 
 /***********************************************************************//**
- * @brief Update 3D cache
+ * @brief Compute 3D interpolation indices and weights
  *
  * @param[in] arg1 Argument for first axis.
  * @param[in] arg2 Argument for second axis.
  * @param[in] arg3 Argument for third axis.
+ * @param[out] inx Array of 8 indices.
+ * @param[out] wgt Array of 8 weights.
  *
- * Updates the 3D interpolation cache. The interpolation cache is composed
- * of four indices and weights that define 4 data values of the 2D table
- * that are used for bilinear interpolation.
- *
- * @todo Write down formula
+ * Computes the eight indices and weights that define the 8 data values of
+ * the 3D table that are used for trilinear interpolation.
  ***************************************************************************/
 void GCTAResponseTable::update(const double& arg1, const double& arg2,
-                               const double& arg3) const
+                               const double& arg3, int* inx, double* wgt) const
 {
-
-    // Get pointers to node arrays (circumvent const correctness)
-    const GNodeArray* nodes1 = &(m_axis_nodes[0]);
-    const GNodeArray* nodes2 = &(m_axis_nodes[1]);
-    const GNodeArray* nodes3 = &(m_axis_nodes[2]);
-
-    // Set values for node arrays
-    nodes1->set_value(arg1);
-    nodes2->set_value(arg2);
-    nodes3->set_value(arg3);
+    // Locate arguments on node arrays
+    GNodeArray::weights w1 = m_axis_nodes[0].locate(arg1);
+    GNodeArray::weights w2 = m_axis_nodes[1].locate(arg2);
+    GNodeArray::weights w3 = m_axis_nodes[2].locate(arg3);
+    int    inx1_left  = w1.inx_left;
+    int    inx1_right = w1.inx_right;
+    int    inx2_left  = w2.inx_left;
+    int    inx2_right = w2.inx_right;
+    int    inx3_left  = w3.inx_left;
+    int    inx3_right = w3.inx_right;
+    double wgt1_left  = w1.wgt_left;
+    double wgt1_right = w1.wgt_right;
+    double wgt2_left  = w2.wgt_left;
+    double wgt2_right = w2.wgt_right;
+    double wgt3_left  = w3.wgt_left;
+    double wgt3_right = w3.wgt_right;
 
     // Compute offsets
-    int size1          = axis(0);
-    int size2          = axis(1);
-    int offset_left_2  = nodes2->inx_left()  * size1;
-    int offset_right_2 = nodes2->inx_right() * size1;
-    int offset_left_3  = nodes3->inx_left()  * size1 * size2;
-    int offset_right_3 = nodes3->inx_right() * size1 * size2;
+    int size1          = m_axis_nodes[0].size();
+    int size2          = m_axis_nodes[1].size();
+    int offset_left_2  = inx2_left  * size1;
+    int offset_right_2 = inx2_right * size1;
+    int offset_left_3  = inx3_left  * size1 * size2;
+    int offset_right_3 = inx3_right * size1 * size2;
 
     // Set indices for tri-linear interpolation
-    m_inx1 = nodes1->inx_left()  + offset_left_2  + offset_left_3 ;
-    m_inx2 = nodes1->inx_left()  + offset_left_2  + offset_right_3;
-    m_inx3 = nodes1->inx_left()  + offset_right_2 + offset_left_3 ;
-    m_inx4 = nodes1->inx_left()  + offset_right_2 + offset_right_3;
-    m_inx5 = nodes1->inx_right() + offset_left_2  + offset_left_3 ;
-    m_inx6 = nodes1->inx_right() + offset_left_2  + offset_right_3;
-    m_inx7 = nodes1->inx_right() + offset_right_2 + offset_left_3 ;
-    m_inx8 = nodes1->inx_right() + offset_right_2 + offset_right_3;
+    inx[0] = inx1_left  + offset_left_2  + offset_left_3;
+    inx[1] = inx1_left  + offset_left_2  + offset_right_3;
+    inx[2] = inx1_left  + offset_right_2 + offset_left_3;
+    inx[3] = inx1_left  + offset_right_2 + offset_right_3;
+    inx[4] = inx1_right + offset_left_2  + offset_left_3;
+    inx[5] = inx1_right + offset_left_2  + offset_right_3;
+    inx[6] = inx1_right + offset_right_2 + offset_left_3;
+    inx[7] = inx1_right + offset_right_2 + offset_right_3;
 
     // Set weighting factors for tri-linear interpolation
-    m_wgt1 = nodes1->wgt_left()  * nodes2->wgt_left()  *  nodes3->wgt_left();
-    m_wgt2 = nodes1->wgt_left()  * nodes2->wgt_left()  *  nodes3->wgt_right();
-    m_wgt3 = nodes1->wgt_left()  * nodes2->wgt_right() *  nodes3->wgt_left();
-    m_wgt4 = nodes1->wgt_left()  * nodes2->wgt_right() *  nodes3->wgt_right();
-    m_wgt5 = nodes1->wgt_right() * nodes2->wgt_left()  *  nodes3->wgt_left();
-    m_wgt6 = nodes1->wgt_right() * nodes2->wgt_left()  *  nodes3->wgt_right();
-    m_wgt7 = nodes1->wgt_right() * nodes2->wgt_right() *  nodes3->wgt_left();
-    m_wgt8 = nodes1->wgt_right() * nodes2->wgt_right() *  nodes3->wgt_right();
+    wgt[0] = wgt1_left  * wgt2_left  * wgt3_left;
+    wgt[1] = wgt1_left  * wgt2_left  * wgt3_right;
+    wgt[2] = wgt1_left  * wgt2_right * wgt3_left;
+    wgt[3] = wgt1_left  * wgt2_right * wgt3_right;
+    wgt[4] = wgt1_right * wgt2_left  * wgt3_left;
+    wgt[5] = wgt1_right * wgt2_left  * wgt3_right;
+    wgt[6] = wgt1_right * wgt2_right * wgt3_left;
+    wgt[7] = wgt1_right * wgt2_right * wgt3_right;
 
     // Return
     return;
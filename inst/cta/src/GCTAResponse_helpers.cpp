@@ -32,6 +32,7 @@
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GIntegral.hpp"
+#include "GIntegrals.hpp"
 #include "GVector.hpp"
 #include "GCTAResponse_helpers.hpp"
 #include "GCTAEdisp.hpp"
@@ -341,11 +342,17 @@ double cta_irf_radial_kern_rho::eval(const double& rho)
                                                     cos_ph,
                                                     sin_ph);
 
-                // Integrate over phi
+                // Integrate over omega, either using a Gauss-Legendre rule
+                // or the Romberg method
                 GIntegral integral(&integrand);
                 integral.fixed_iter(m_iter);
-                irf = integral.romberg(omega_min, omega_max, m_iter) *
-                      model * sin_rho;
+                if (m_order > 0) {
+                    irf = integral.gauss_legendre(omega_min, omega_max, m_order);
+                }
+                else {
+                    irf = integral.romberg(omega_min, omega_max, m_iter);
+                }
+                irf *= model * sin_rho;
 
                 // Compile option: Check for NaN/Inf
                 #if defined(G_NAN_CHECK)
@@ -449,6 +456,235 @@ double cta_irf_radial_kern_omega::eval(const double& omega)
 }
 
 
+/***********************************************************************//**
+ * @brief Kernel for radial model zenith angle integration of IRF and its
+ *        parameter gradients
+ *
+ * @param[in] rho Zenith angle with respect to model centre [radians].
+ * @return Kernel values.
+ *
+ * Computes the kernel values for the integration of the IRF and of its
+ * gradients with respect to the model parameters. The first element of the
+ * returned vector is the IRF kernel (see cta_irf_radial_kern_rho::eval()),
+ * the second and third elements are the kernels for the gradients with
+ * respect to infinitesimal rotations of the model in Right Ascension and
+ * Declination, and the remaining elements are the kernels for the
+ * gradients with respect to the shape parameters of the model.
+ *
+ * The gradients of the model with respect to the shape parameters are
+ * obtained from GModelSpatialRadial::eval_gradients().
+ ***************************************************************************/
+GVector cta_irf_radial_grad_kern_rho::eval(const double& rho)
+{
+    // Initialise result
+    GVector irf(size());
+
+    // Continue only if rho is positive (otherwise the integral will be
+    // zero)
+    if (rho > 0.0) {
+
+        // Compute half length of arc that lies within PSF validity circle
+        // (in radians)
+        double domega = 0.5 * gammalib::cta_roi_arclength(rho,
+                                                          m_zeta,
+                                                          m_cos_zeta,
+                                                          m_sin_zeta,
+                                                          m_delta_max,
+                                                          m_cos_delta_max);
+
+        // Continue only if arc length is positive
+        if (domega > 0.0) {
+
+            // Compute omega integration range
+            double omega_min = -domega;
+            double omega_max = +domega;
+
+            // Reduce rho by an infinite amount to avoid rounding errors
+            // at the boundary of a sharp edged model
+            double rho_kluge = rho - g_kulge_radius;
+            if (rho_kluge < 0.0) {
+                rho_kluge = 0.0;
+            }
+
+            // Evaluate sky model and, if required, its shape gradients
+            double model = (m_pars.empty())
+                           ? m_model.eval(rho_kluge, m_srcEng, m_srcTime)
+                           : m_model.eval_gradients(rho_kluge, m_srcEng, m_srcTime,
+                                                    m_gradients);
+
+            // Continue only if model is positive
+            if (model > 0.0) {
+
+                // Precompute cosine and sine terms for azimuthal
+                // integration
+                double cos_rho = std::cos(rho);
+                double sin_rho = std::sin(rho);
+                double cos_psf = cos_rho*m_cos_zeta;
+                double sin_psf = sin_rho*m_sin_zeta;
+                double cos_ph  = cos_rho*m_cos_lambda;
+                double sin_ph  = sin_rho*m_sin_lambda;
+
+                // Precompute rotation terms for azimuthal integration
+                GMatrix dpsf(2,3);
+                GMatrix dph(2,3);
+                for (int k = 0; k < 2; ++k) {
+                    dpsf(k,0) = cos_rho * m_dpsf(k,0);
+                    dpsf(k,1) = sin_rho * m_dpsf(k,1);
+                    dpsf(k,2) = sin_rho * m_dpsf(k,2);
+                    dph(k,0)  = cos_rho * m_dph(k,0);
+                    dph(k,1)  = sin_rho * m_dph(k,1);
+                    dph(k,2)  = sin_rho * m_dph(k,2);
+                }
+
+                // Setup integration kernel
+                cta_irf_radial_grad_kern_omega integrand(m_rsp,
+                                                         m_zenith,
+                                                         m_azimuth,
+                                                         m_srcLogEng,
+                                                         m_omega0,
+                                                         cos_psf,
+                                                         sin_psf,
+                                                         cos_ph,
+                                                         sin_ph,
+                                                         dpsf,
+                                                         dph);
+
+                // Integrate over phi
+                GIntegrals integral(&integrand);
+                integral.fixed_iter(m_iter);
+                GVector values = integral.romberg(omega_min, omega_max, m_iter);
+
+                // Set IRF and position gradient kernels
+                irf[0] = values[0] * model * sin_rho;
+                irf[1] = values[1] * model * sin_rho;
+                irf[2] = values[2] * model * sin_rho;
+
+                // Set shape gradient kernels
+                int npars = m_pars.size();
+                for (int i = 0; i < npars; ++i) {
+                    irf[3+i] = values[0] * sin_rho *
+                               m_gradients[m_pars[i]];
+                }
+
+            } // endif: model was positive
+
+        } // endif: arclength was positive
+
+    } // endif: rho was positive
+
+    // Return result
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Kernel for radial model azimuth angle integration of IRF and its
+ *        position gradients
+ *
+ * @param[in] omega Azimuth angle (radians).
+ * @return IRF and its derivatives with respect to model rotations.
+ *
+ * Computes the IRF as described in cta_irf_radial_kern_omega::eval() and
+ * its derivatives with respect to infinitesimal rotations of the model.
+ * A rotation of the model by \f$\epsilon\f$ around an axis \f$\vec{k}\f$
+ * changes the cosine of the angle between the true photon direction
+ * \f$\vec{p}\f$ and any fixed direction \f$\vec{d}\f$ by
+ *
+ * \f[
+ *    \frac{\partial \cos \delta}{\partial \epsilon} =
+ *    \vec{k} \cdot (\vec{p} \times \vec{d})
+ * \f]
+ *
+ * The rotation terms for the measured photon direction and the pointing
+ * direction are precomputed in the basis of the model system, so that the
+ * cosine derivatives are linear combinations of \f$1\f$,
+ * \f$\cos \omega\f$ and \f$\sin \omega\f$. The derivative of the
+ * PSF with respect to the offset angle is computed analytically, while the
+ * derivative of the IRF with respect to the photon offset angle in the
+ * camera is computed numerically from the response tables.
+ ***************************************************************************/
+GVector cta_irf_radial_grad_kern_omega::eval(const double& omega)
+{
+    // Set step size for offset angle derivative (radians)
+    const double h = 1.0e-5;
+
+    // Initialise result
+    GVector irf(3);
+
+    // Precompute sine and cosine of azimuth angle
+    double cos_omega = std::cos(omega);
+    double sin_omega = std::sin(omega);
+
+    // Compute PSF offset angle [radians]
+    double delta = std::acos(m_cos_psf + m_sin_psf * cos_omega);
+
+    // Compute true photon offset angle in camera system [radians]
+    double offset = std::acos(m_cos_ph + m_sin_ph * std::cos(m_omega0 - omega));
+
+    // Azimuth angle of true photon in camera is not used by the CTA IRFs
+    double azimuth = 0.0;
+
+    // Evaluate IRF
+    double aeff = m_rsp.aeff(offset, azimuth, m_zenith, m_azimuth, m_srcLogEng);
+    double psf  = m_rsp.psf(delta, offset, azimuth, m_zenith, m_azimuth, m_srcLogEng);
+    irf[0]      = aeff * psf;
+
+    // Continue only if effective area is positive
+    if (aeff > 0.0) {
+
+        // Compute derivative of IRF with respect to PSF offset angle
+        double dirf_ddelta = aeff * m_rsp.psf_derivative(delta, offset, azimuth,
+                                                         m_zenith, m_azimuth,
+                                                         m_srcLogEng);
+
+        // Compute derivative of IRF with respect to photon offset angle
+        double offset_h    = offset + h;
+        double dirf_doffset = (m_rsp.aeff(offset_h, azimuth, m_zenith,
+                                          m_azimuth, m_srcLogEng) *
+                               m_rsp.psf(delta, offset_h, azimuth, m_zenith,
+                                         m_azimuth, m_srcLogEng) - irf[0]) / h;
+
+        // Compute sines of angles
+        double sin_delta  = std::sin(delta);
+        double sin_offset = std::sin(offset);
+
+        // Compute derivatives with respect to model rotations
+        for (int k = 0; k < 2; ++k) {
+            double value = 0.0;
+            if (sin_delta > 0.0) {
+                double dcos = m_dpsf(k,0) + m_dpsf(k,1) * cos_omega +
+                                            m_dpsf(k,2) * sin_omega;
+                value -= dirf_ddelta * dcos / sin_delta;
+            }
+            if (sin_offset > 0.0) {
+                double dcos = m_dph(k,0) + m_dph(k,1) * cos_omega +
+                                           m_dph(k,2) * sin_omega;
+                value -= dirf_doffset * dcos / sin_offset;
+            }
+            irf[k+1] = value;
+        }
+
+    } // endif: effective area was positive
+
+    // Compile option: Check for NaN/Inf
+    #if defined(G_NAN_CHECK)
+    if (gammalib::is_notanumber(irf[0]) || gammalib::is_infinite(irf[0])) {
+        std::cout << "*** ERROR: cta_irf_radial_grad_kern_omega::eval";
+        std::cout << "(omega=" << omega << "):";
+        std::cout << " NaN/Inf encountered";
+        std::cout << " (irf=" << irf[0];
+        std::cout << ", delta=" << delta;
+        std::cout << ", offset=" << offset;
+        std::cout << ", azimuth=" << azimuth << ")";
+        std::cout << std::endl;
+    }
+    #endif
+
+    // Return
+    return irf;
+}
+
+
 /***********************************************************************//**
  * @brief Kernel for zenith angle Nroi integration or radial model
  *
@@ -573,12 +809,12 @@ double cta_nroi_radial_kern_rho::eval(const double& rho)
 double cta_nroi_radial_kern_omega::eval(const double& omega)
 {
     // Compute sky direction vector in native coordinates
-    double  cos_omega = std::cos(omega);
-    double  sin_omega = std::sin(omega);
-    GVector native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
+    double   cos_omega = std::cos(omega);
+    double   sin_omega = std::sin(omega);
+    GVector3 native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -711,8 +947,10 @@ double cta_irf_elliptical_kern_rho::eval(const double& rho)
                 double omega_max = +domega;
 
                 // Integrate over omega
-                irf = integral.romberg(omega_min, omega_max, m_iter) *
-                      sin_rho;
+                irf = (m_order > 0)
+                      ? integral.gauss_legendre(omega_min, omega_max, m_order)
+                      : integral.romberg(omega_min, omega_max, m_iter);
+                irf *= sin_rho;
 
             } // endif: circle comprised in ellipse
 
@@ -763,14 +1001,20 @@ double cta_irf_elliptical_kern_rho::eval(const double& rho)
                     for (int i = 0; i < intervals1.size(); ++i) {
                         double min = intervals1[i].first;
                         double max = intervals1[i].second;
-                        irf       += integral.romberg(min, max, m_iter) * sin_rho;
+                        double value = (m_order > 0)
+                                       ? integral.gauss_legendre(min, max, m_order)
+                                       : integral.romberg(min, max, m_iter);
+                        irf += value * sin_rho;
                     }
 
                     // Integrate over all intervals for omega2
                     for (int i = 0; i < intervals2.size(); ++i) {
                         double min = intervals2[i].first;
                         double max = intervals2[i].second;
-                        irf       += integral.romberg(min, max, m_iter) * sin_rho;
+                        double value = (m_order > 0)
+                                       ? integral.gauss_legendre(min, max, m_order)
+                                       : integral.romberg(min, max, m_iter);
+                        irf += value * sin_rho;
                     }
 
                 } // endif: arc length was positive
@@ -917,6 +1161,221 @@ double cta_irf_elliptical_kern_omega::eval(const double& omega)
 }
 
 
+/***********************************************************************//**
+ * @brief Kernel for elliptical model zenith angle integration of IRF and
+ *        its parameter gradients
+ *
+ * @param[in] rho Zenith angle with respect to model centre [radians].
+ * @return Kernel values.
+ *
+ * Computes the kernel values for the integration of the IRF and of its
+ * gradients with respect to the shape parameters of the model. The first
+ * element of the returned vector is the IRF kernel (see
+ * cta_irf_elliptical_kern_rho::eval()), the remaining elements are the
+ * kernels for the gradients. The azimuthal integration is done over the
+ * same intervals as in cta_irf_elliptical_kern_rho::eval().
+ ***************************************************************************/
+GVector cta_irf_elliptical_grad_kern_rho::eval(const double& rho)
+{
+    // Initialise result
+    GVector irf(size());
+
+    // Continue only if rho is positive
+    if (rho > 0.0) {
+
+        // Compute half length of the arc (in radians) from a circle with
+        // radius rho that intersects with the point spread function, defined
+        // as a circle with maximum radius m_delta_max
+        double domega = 0.5 * gammalib::cta_roi_arclength(rho,
+                                                          m_rho_obs,
+                                                          m_cos_rho_obs,
+                                                          m_sin_rho_obs,
+                                                          m_delta_max,
+                                                          m_cos_delta_max);
+
+        // Continue only if arc length is positive
+        if (domega > 0.0) {
+
+            // Precompute cosine and sine terms for azimuthal integration
+            double cos_rho = std::cos(rho);
+            double sin_rho = std::sin(rho);
+            double cos_psf = cos_rho * m_cos_rho_obs;
+            double sin_psf = sin_rho * m_sin_rho_obs;
+            double cos_ph  = cos_rho * m_cos_rho_pnt;
+            double sin_ph  = sin_rho * m_sin_rho_pnt;
+
+            // Reduce rho by an infinite amount to avoid rounding errors
+            // at the boundary of a sharp edged model
+            double rho_kluge = rho - g_ellipse_kulge_radius;
+            if (rho_kluge < 0.0) {
+                rho_kluge = 0.0;
+            }
+
+            // Setup integration kernel
+            cta_irf_elliptical_grad_kern_omega integrand(m_rsp,
+                                                         m_model,
+                                                         m_pars,
+                                                         m_zenith,
+                                                         m_azimuth,
+                                                         m_srcEng,
+                                                         m_srcTime,
+                                                         m_srcLogEng,
+                                                         m_posangle_obs,
+                                                         m_omega_pnt,
+                                                         rho_kluge,
+                                                         cos_psf,
+                                                         sin_psf,
+                                                         cos_ph,
+                                                         sin_ph);
+
+            // Setup integrator
+            GIntegrals integral(&integrand);
+            integral.fixed_iter(m_iter);
+
+            // If the radius rho is not larger than the semiminor axis
+            // boundary, the circle with that radius is fully contained in
+            // the ellipse and we can just integrate over the relevant arc
+            if (rho <= m_semiminor) {
+                irf = integral.romberg(-domega, +domega, m_iter) * sin_rho;
+            }
+
+            // ... otherwise integrate over the arcs that intersect with the
+            // Psf circle
+            else {
+
+                // Compute half the arc length (in radians) of a circle of
+                // radius rho, centred on the model, that intersects with
+                // the ellipse boundary
+                double arg1 = 1.0 - (m_semiminor*m_semiminor) / (rho*rho);
+                double arg2 = 1.0 - (m_semiminor*m_semiminor) /
+                                    (m_semimajor*m_semimajor);
+                double omega_width = std::acos(std::sqrt(arg1/arg2));
+
+                // Continue only if the arclength is positive
+                if (omega_width > 0.0) {
+
+                    // Compute azimuth angle difference between ellipse
+                    // position angle and position angle of observed
+                    // photon in the model system (see
+                    // cta_irf_elliptical_kern_rho::eval())
+                    double omega_0 = m_posangle - m_posangle_obs;
+                    if (omega_0 > gammalib::pi) {
+                        omega_0 -= gammalib::pi;
+                    }
+                    else if (omega_0 < -gammalib::pi) {
+                        omega_0 += gammalib::pi;
+                    }
+
+                    // Compute azimuth angle intervals
+                    double omega1_min = omega_0    - omega_width;
+                    double omega1_max = omega_0    + omega_width;
+                    double omega2_min = omega1_min + gammalib::pi;
+                    double omega2_max = omega1_max + gammalib::pi;
+
+                    // Limit intervals to the intersection of the ellipse with
+                    // the Psf circle
+                    cta_omega_intervals intervals1 = 
+                        gammalib::limit_omega(omega1_min, omega1_max, domega);
+                    cta_omega_intervals intervals2 = 
+                        gammalib::limit_omega(omega2_min, omega2_max, domega);
+
+                    // Integrate over all intervals for omega1
+                    int n1 = intervals1.size();
+                    for (int i = 0; i < n1; ++i) {
+                        double min = intervals1[i].first;
+                        double max = intervals1[i].second;
+                        irf += integral.romberg(min, max, m_iter) * sin_rho;
+                    }
+
+                    // Integrate over all intervals for omega2
+                    int n2 = intervals2.size();
+                    for (int i = 0; i < n2; ++i) {
+                        double min = intervals2[i].first;
+                        double max = intervals2[i].second;
+                        irf += integral.romberg(min, max, m_iter) * sin_rho;
+                    }
+
+                } // endif: arc length was positive
+
+            } // endelse: circle was not comprised in ellipse
+
+        } // endif: arc length was positive
+    
+    } // endif: rho was positive
+
+    // Return result
+    return irf;
+}
+
+
+/***********************************************************************//**
+ * @brief Kernel for elliptical model azimuth angle integration of IRF and
+ *        its parameter gradients
+ *
+ * @param[in] omega Azimuth angle (radians).
+ * @return IRF and its derivatives with respect to the shape parameters.
+ *
+ * Computes the product of model and IRF as described in
+ * cta_irf_elliptical_kern_omega::eval() and the products of the model
+ * gradients with the IRF. Energy dispersion is not taken into account as
+ * gradients are computed numerically if energy dispersion is used.
+ ***************************************************************************/
+GVector cta_irf_elliptical_grad_kern_omega::eval(const double& omega)
+{
+    // Initialise result
+    GVector irf(size());
+
+    // Compute azimuth angle in model coordinate system (radians)
+    double omega_model = omega + m_posangle_obs;
+
+    // Evaluate sky model and its gradients
+    double model = m_model.eval_gradients(m_rho, omega_model, m_srcEng,
+                                          m_srcTime, m_gradients);
+
+    // Continue only if model is positive
+    if (model > 0.0) {
+
+        // Compute Psf offset angle [radians]
+        double delta = std::acos(m_cos_psf + m_sin_psf * std::cos(omega));
+    
+        // Compute true photon offset and azimuth angle in camera system
+        // [radians]
+        double theta = std::acos(m_cos_ph + m_sin_ph * std::cos(m_omega_pnt - omega));
+        double phi   = 0.0; //TODO: Implement IRF Phi dependence
+
+        // Evaluate IRF
+        double value = m_rsp.aeff(theta, phi, m_zenith, m_azimuth, m_srcLogEng) *
+                       m_rsp.psf(delta, theta, phi, m_zenith, m_azimuth, m_srcLogEng);
+
+        // Set IRF and gradient kernels
+        irf[0] = value * model;
+        int npars = m_pars.size();
+        for (int i = 0; i < npars; ++i) {
+            irf[1+i] = value * m_gradients[m_pars[i]];
+        }
+
+        // Compile option: Check for NaN/Inf
+        #if defined(G_NAN_CHECK)
+        if (gammalib::is_notanumber(irf[0]) || gammalib::is_infinite(irf[0])) {
+            std::cout << "*** ERROR: cta_irf_elliptical_grad_kern_omega::eval";
+            std::cout << "(omega=" << omega << "):";
+            std::cout << " NaN/Inf encountered";
+            std::cout << " (irf=" << irf[0];
+            std::cout << ", model=" << model;
+            std::cout << ", delta=" << delta;
+            std::cout << ", theta=" << theta;
+            std::cout << ", phi=" << phi << ")";
+            std::cout << std::endl;
+        }
+        #endif
+
+    } // endif: model is positive
+
+    // Return
+    return irf;
+}
+
+
 /***********************************************************************//**
  * @brief Kernel for zenith angle Nroi integration of elliptical model
  *
@@ -1150,12 +1609,12 @@ double cta_nroi_elliptical_kern_omega::eval(const double& omega)
     if (model > 0.0) {
     
         // Compute sky direction vector in native coordinates
-        double  cos_omega = std::cos(omega_model);
-        double  sin_omega = std::sin(omega_model);
-        GVector native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
+        double   cos_omega = std::cos(omega_model);
+        double   sin_omega = std::sin(omega_model);
+        GVector3 native(-cos_omega*m_sin_rho, sin_omega*m_sin_rho, m_cos_rho);
 
         // Rotate from native into celestial system
-        GVector cel = m_rot * native;
+        GVector3 cel = m_rot * native;
 
         // Set sky direction
         GSkyDir srcDir;
@@ -1255,10 +1714,17 @@ double cta_irf_diffuse_kern_theta::eval(const double& theta)
                                                cos_theta,
                                                sin_ph,
                                                cos_ph);
-            // Integrate over phi
+            // Integrate over phi, either using a Gauss-Legendre rule or
+            // the Romberg method
             GIntegral integral(&integrand);
             integral.fixed_iter(m_iter);
-            irf = integral.romberg(0.0, gammalib::twopi) * psf * sin_theta;
+            if (m_order > 0) {
+                irf = integral.gauss_legendre(0.0, gammalib::twopi, m_order);
+            }
+            else {
+                irf = integral.romberg(0.0, gammalib::twopi);
+            }
+            irf *= psf * sin_theta;
             #if defined(G_DEBUG_INTEGRAL)
             if (!integral.isvalid()) {
                 std::cout << "cta_irf_diffuse_kern_theta(theta=";
@@ -1332,10 +1798,10 @@ double cta_irf_diffuse_kern_phi::eval(const double& phi)
     double cos_phi = std::cos(phi);
 
     // Compute sky direction vector in native coordinates
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
+    GVector3 native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -1486,12 +1952,12 @@ double cta_nroi_diffuse_kern_phi::eval(const double& phi)
     double nroi = 0.0;
 
     // Compute sky direction vector in native coordinates
-    double  cos_phi = std::cos(phi);
-    double  sin_phi = std::sin(phi);
-    GVector native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
+    double   cos_phi = std::cos(phi);
+    double   sin_phi = std::sin(phi);
+    GVector3 native(-cos_phi*m_sin_theta, sin_phi*m_sin_theta, m_cos_theta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -2228,12 +2694,12 @@ double cta_psf_diffuse_kern_delta::eval(const double& delta)
 double cta_psf_diffuse_kern_phi::eval(const double& phi)
 {
     // Compute sky direction vector in native coordinates
-    double  cos_phi = std::cos(phi);
-    double  sin_phi = std::sin(phi);
-    GVector native(-cos_phi*m_sin_delta, sin_phi*m_sin_delta, m_cos_delta);
+    double   cos_phi = std::cos(phi);
+    double   sin_phi = std::sin(phi);
+    GVector3 native(-cos_phi*m_sin_delta, sin_phi*m_sin_delta, m_cos_delta);
 
     // Rotate from native into celestial system
-    GVector cel = m_rot * native;
+    GVector3 cel = m_rot * native;
 
     // Set sky direction
     GSkyDir srcDir;
@@ -34,6 +34,7 @@
 #include "GCTAResponseIrf.hpp"
 #include "GCTAObservation.hpp"
 #include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GEnergy.hpp"
 #include "GTime.hpp"
 #include "GModelSky.hpp"
@@ -42,6 +43,8 @@
 #include "GCTAResponseCube.hpp"
 #include "GModelSpatialElliptical.hpp"
 #include "GFunction.hpp"
+#include "GFunctions.hpp"
+#include "GVector.hpp"
 
 /* __ Type definitions ___________________________________________________ */
 
@@ -223,7 +226,8 @@ public:
                             const double&              lambda,
                             const double&              omega0,
                             const double&              delta_max,
-                            const int&                 iter) :
+                            const int&                 iter,
+                            const int&                 order = 0) :
                             m_rsp(rsp),
                             m_model(model),
                             m_zenith(zenith),
@@ -241,7 +245,8 @@ public:
                             m_omega0(omega0),
                             m_delta_max(delta_max),
                             m_cos_delta_max(std::cos(delta_max)),
-                            m_iter(iter) { }
+                            m_iter(iter),
+                            m_order(order) { }
     double eval(const double& rho);
 protected:
     const GCTAResponseIrf&     m_rsp;           //!< CTA response
@@ -262,6 +267,7 @@ protected:
     const double&              m_delta_max;     //!< Maximum PSF radius
     double                     m_cos_delta_max; //!< Cosine of maximum PSF radius
     const int&                 m_iter;          //!< Integration iterations
+    int                        m_order;         //!< Gauss-Legendre order (0: Romberg)
 };
 
 
@@ -329,6 +335,171 @@ protected:
 };
 
 
+/***********************************************************************//**
+ * @class cta_irf_radial_grad_kern_rho
+ *
+ * @brief Kernel for radial model zenith angle integration of IRF and its
+ *        parameter gradients
+ *
+ * This class implements the integration kernels for the simultaneous
+ * computation of the IRF of a radial model and its gradients with respect
+ * to the model parameters. The eval() method returns a vector with the
+ * elements
+ *
+ * \f[
+ *    K(\rho | E, t) = \sin \rho \times S_{\rm p}(\rho | E, t) \times
+ *                     \int_{\omega_{\rm min}}^{\omega_{\rm max}} 
+ *                     IRF(\rho, \omega) d\omega
+ * \f]
+ *
+ * \f[
+ *    \frac{\partial K}{\partial \epsilon_{\alpha,\delta}} =
+ *                     \sin \rho \times S_{\rm p}(\rho | E, t) \times
+ *                     \int_{\omega_{\rm min}}^{\omega_{\rm max}} 
+ *                     \frac{\partial IRF(\rho, \omega)}
+ *                           {\partial \epsilon_{\alpha,\delta}} d\omega
+ * \f]
+ *
+ * \f[
+ *    \frac{\partial K}{\partial p_i} =
+ *                     \sin \rho \times
+ *                     \frac{\partial S_{\rm p}(\rho | E, t)}{\partial p_i}
+ *                     \times
+ *                     \int_{\omega_{\rm min}}^{\omega_{\rm max}} 
+ *                     IRF(\rho, \omega) d\omega
+ * \f]
+ *
+ * where
+ * - \f$\epsilon_{\alpha,\delta}\f$ are infinitesimal rotations of the
+ *   model that shift the model centre in Right Ascension and Declination,
+ *   respectively, and
+ * - \f$p_i\f$ are the shape parameters of the radial model for which
+ *   gradients are requested.
+ ***************************************************************************/
+class cta_irf_radial_grad_kern_rho : public GFunctions {
+public:
+    cta_irf_radial_grad_kern_rho(const GCTAResponseIrf&     rsp,
+                                 const GModelSpatialRadial& model,
+                                 const std::vector<int>&    pars,
+                                 const double&              zenith,
+                                 const double&              azimuth,
+                                 const GEnergy&             srcEng,
+                                 const GTime&               srcTime,
+                                 const double&              srcLogEng,
+                                 const double&              zeta,
+                                 const double&              lambda,
+                                 const double&              omega0,
+                                 const double&              delta_max,
+                                 const GMatrix&             dpsf,
+                                 const GMatrix&             dph,
+                                 const int&                 iter) :
+                                 m_rsp(rsp),
+                                 m_model(model),
+                                 m_pars(pars),
+                                 m_zenith(zenith),
+                                 m_azimuth(azimuth),
+                                 m_srcEng(srcEng),
+                                 m_srcTime(srcTime),
+                                 m_srcLogEng(srcLogEng),
+                                 m_zeta(zeta),
+                                 m_cos_zeta(std::cos(zeta)),
+                                 m_sin_zeta(std::sin(zeta)),
+                                 m_lambda(lambda),
+                                 m_cos_lambda(std::cos(lambda)),
+                                 m_sin_lambda(std::sin(lambda)),
+                                 m_omega0(omega0),
+                                 m_delta_max(delta_max),
+                                 m_cos_delta_max(std::cos(delta_max)),
+                                 m_dpsf(dpsf),
+                                 m_dph(dph),
+                                 m_iter(iter),
+                                 m_gradients(model.size()) { }
+    int     size(void) const { return 3 + m_pars.size(); }
+    GVector eval(const double& rho);
+protected:
+    const GCTAResponseIrf&     m_rsp;           //!< CTA response
+    const GModelSpatialRadial& m_model;         //!< Radial spatial model
+    const std::vector<int>&    m_pars;          //!< Indices of shape parameters
+    const double&              m_zenith;        //!< Zenith angle
+    const double&              m_azimuth;       //!< Azimuth angle
+    const GEnergy&             m_srcEng;        //!< True photon energy
+    const GTime&               m_srcTime;       //!< True photon time
+    const double&              m_srcLogEng;     //!< True photon log10 energy
+    const double&              m_zeta;          //!< Distance model centre - measured photon
+    double                     m_cos_zeta;      //!< Cosine of zeta
+    double                     m_sin_zeta;      //!< Sine of zeta
+    const double&              m_lambda;        //!< Distance model centre - pointing
+    double                     m_cos_lambda;    //!< Cosine of lambda
+    double                     m_sin_lambda;    //!< Sine of lambda
+    const double&              m_omega0;        //!< Azimuth of pointing in model system
+    const double&              m_delta_max;     //!< Maximum PSF radius
+    double                     m_cos_delta_max; //!< Cosine of maximum PSF radius
+    const GMatrix&             m_dpsf;          //!< Rotation terms for PSF offset angle
+    const GMatrix&             m_dph;           //!< Rotation terms for photon offset angle
+    const int&                 m_iter;          //!< Integration iterations
+    GVector                    m_gradients;     //!< Model parameter gradients
+};
+
+
+/***********************************************************************//**
+ * @class cta_irf_radial_grad_kern_omega
+ *
+ * @brief Kernel for radial model azimuth angle integration of IRF and its
+ *        position gradients
+ *
+ * This class implements the computation of the IRF in the reference frame
+ * of the radial source model and of its derivatives with respect to
+ * infinitesimal rotations of the model that shift the model centre in
+ * Right Ascension and Declination. The eval() method returns the vector
+ *
+ * \f[
+ *    \left( IRF(\rho, \omega),
+ *           \frac{\partial IRF(\rho, \omega)}{\partial \epsilon_\alpha},
+ *           \frac{\partial IRF(\rho, \omega)}{\partial \epsilon_\delta}
+ *    \right)
+ * \f]
+ ***************************************************************************/
+class cta_irf_radial_grad_kern_omega : public GFunctions {
+public:
+    cta_irf_radial_grad_kern_omega(const GCTAResponseIrf& rsp,
+                                   const double&          zenith,
+                                   const double&          azimuth,
+                                   const double&          srcLogEng,
+                                   const double&          omega0,
+                                   const double&          cos_psf,
+                                   const double&          sin_psf,
+                                   const double&          cos_ph,
+                                   const double&          sin_ph,
+                                   const GMatrix&         dpsf,
+                                   const GMatrix&         dph) :
+                                   m_rsp(rsp),
+                                   m_zenith(zenith),
+                                   m_azimuth(azimuth),
+                                   m_srcLogEng(srcLogEng),
+                                   m_omega0(omega0),
+                                   m_cos_psf(cos_psf),
+                                   m_sin_psf(sin_psf),
+                                   m_cos_ph(cos_ph),
+                                   m_sin_ph(sin_ph),
+                                   m_dpsf(dpsf),
+                                   m_dph(dph) { }
+    int     size(void) const { return 3; }
+    GVector eval(const double& omega);
+protected:
+    const GCTAResponseIrf& m_rsp;       //!< CTA response
+    const double&          m_zenith;    //!< Zenith angle
+    const double&          m_azimuth;   //!< Azimuth angle
+    const double&          m_srcLogEng; //!< True photon energy
+    const double&          m_omega0;    //!< Azimuth of pointing in model system
+    const double&          m_cos_psf;   //!< Cosine term for PSF offset angle computation
+    const double&          m_sin_psf;   //!< Sine term for PSF offset angle computation
+    const double&          m_cos_ph;    //!< Cosine term for photon offset angle computation
+    const double&          m_sin_ph;    //!< Sine term for photon offset angle computation
+    const GMatrix&         m_dpsf;      //!< Rotation terms for PSF offset angle
+    const GMatrix&         m_dph;       //!< Rotation terms for photon offset angle
+};
+
+
 /***********************************************************************//**
  * @class cta_nroi_radial_kern_rho
  *
@@ -368,7 +539,7 @@ public:
                              const GEnergy&             obsEng,
                              const GTime&               obsTime,
                              const GCTAObservation&     obs,
-                             const GMatrix&             rot,
+                             const GMatrix3&            rot,
                              const double&              dist,
                              const double&              radius,
                              const double&              omega0,
@@ -397,7 +568,7 @@ protected:
     const GEnergy&             m_obsEng;     //!< Observed photon energy
     const GTime&               m_obsTime;    //!< Observed photon arrival time
     const GCTAObservation&     m_obs;        //!< CTA observation
-    const GMatrix&             m_rot;        //!< Rotation matrix
+    const GMatrix3&            m_rot;        //!< Rotation matrix
     const double&              m_dist;       //!< Distance model-ROI centre
     double                     m_cos_dist;   //!< Cosine of distance model-ROI centre
     double                     m_sin_dist;   //!< Sine of distance model-ROI centre
@@ -436,7 +607,7 @@ public:
                                const GEnergy&         obsEng,
                                const GTime&           obsTime,
                                const GCTAObservation& obs,
-                               const GMatrix&         rot,
+                               const GMatrix3&        rot,
                                double                 sin_rho,
                                double                 cos_rho) :
                                m_rsp(rsp),
@@ -456,7 +627,7 @@ protected:
     const GEnergy&         m_obsEng;     //!< Observed photon energy
     const GTime&           m_obsTime;    //!< Observed photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     double                 m_cos_rho;    //!< Cosine of offset angle
     double                 m_sin_rho;    //!< Sine of offset angle
 };
@@ -509,7 +680,8 @@ public:
                                 const double&                  rho_pnt,
                                 const double&                  omega_pnt,
                                 const double&                  delta_max,
-                                const int&                     iter) :
+                                const int&                     iter,
+                                const int&                     order = 0) :
                                 m_rsp(rsp),
                                 m_model(model),
                                 m_semimajor(semimajor),
@@ -531,7 +703,8 @@ public:
                                 m_omega_pnt(omega_pnt),
                                 m_delta_max(delta_max),
                                 m_cos_delta_max(std::cos(delta_max)),
-                                m_iter(iter) { }
+                                m_iter(iter),
+                                m_order(order) { }
     double eval(const double& rho);
 public:
     const GCTAResponseIrf&         m_rsp;           //!< CTA response
@@ -556,6 +729,7 @@ public:
     const double&                  m_delta_max;     //!< Maximum PSF radius
     double                         m_cos_delta_max; //!< Cosine of maximum PSF radius
     const int&                     m_iter;          //!< Integration iterations
+    int                            m_order;         //!< Gauss-Legendre order (0: Romberg)
 };
 
 
@@ -630,6 +804,177 @@ public:
 };
 
 
+/***********************************************************************//**
+ * @class cta_irf_elliptical_grad_kern_rho
+ *
+ * @brief Kernel for elliptical model zenith angle integration of IRF and
+ *        its parameter gradients
+ *
+ * This class implements the integration kernels for the simultaneous
+ * computation of the IRF of an elliptical model and its gradients with
+ * respect to the shape parameters of the model. The eval() method returns
+ * a vector with the elements
+ *
+ * \f[
+ *    K(\rho | E, t) = \sin \rho \times
+ *                     \int_{\omega_{\rm min}}^{\omega_{\rm max}} 
+ *                     S_{\rm p}(\rho, \omega | E, t) \, IRF(\rho, \omega)
+ *                     d\omega
+ * \f]
+ *
+ * \f[
+ *    \frac{\partial K}{\partial p_i} = \sin \rho \times
+ *                     \int_{\omega_{\rm min}}^{\omega_{\rm max}} 
+ *                     \frac{\partial S_{\rm p}(\rho, \omega | E, t)}
+ *                           {\partial p_i} \, IRF(\rho, \omega)
+ *                     d\omega
+ * \f]
+ *
+ * where \f$p_i\f$ are the shape parameters of the elliptical model for
+ * which gradients are requested. The integration intervals are the same as
+ * for cta_irf_elliptical_kern_rho.
+ ***************************************************************************/
+class cta_irf_elliptical_grad_kern_rho : public GFunctions {
+public:
+    cta_irf_elliptical_grad_kern_rho(const GCTAResponseIrf&         rsp,
+                                     const GModelSpatialElliptical& model,
+                                     const std::vector<int>&        pars,
+                                     const double&                  semimajor,
+                                     const double&                  semiminor,
+                                     const double&                  posangle,
+                                     const double&                  zenith,
+                                     const double&                  azimuth,
+                                     const GEnergy&                 srcEng,
+                                     const GTime&                   srcTime,
+                                     const double&                  srcLogEng,
+                                     const double&                  rho_obs,
+                                     const double&                  posangle_obs,
+                                     const double&                  rho_pnt,
+                                     const double&                  omega_pnt,
+                                     const double&                  delta_max,
+                                     const int&                     iter) :
+                                     m_rsp(rsp),
+                                     m_model(model),
+                                     m_pars(pars),
+                                     m_semimajor(semimajor),
+                                     m_semiminor(semiminor),
+                                     m_posangle(posangle),
+                                     m_zenith(zenith),
+                                     m_azimuth(azimuth),
+                                     m_srcEng(srcEng),
+                                     m_srcTime(srcTime),
+                                     m_srcLogEng(srcLogEng),
+                                     m_rho_obs(rho_obs),
+                                     m_cos_rho_obs(std::cos(rho_obs)),
+                                     m_sin_rho_obs(std::sin(rho_obs)),
+                                     m_posangle_obs(posangle_obs),
+                                     m_rho_pnt(rho_pnt),
+                                     m_cos_rho_pnt(std::cos(rho_pnt)),
+                                     m_sin_rho_pnt(std::sin(rho_pnt)),
+                                     m_omega_pnt(omega_pnt),
+                                     m_delta_max(delta_max),
+                                     m_cos_delta_max(std::cos(delta_max)),
+                                     m_iter(iter) { }
+    int     size(void) const { return 1 + m_pars.size(); }
+    GVector eval(const double& rho);
+protected:
+    const GCTAResponseIrf&         m_rsp;           //!< CTA response
+    const GModelSpatialElliptical& m_model;         //!< Elliptical model
+    const std::vector<int>&        m_pars;          //!< Indices of shape parameters
+    const double&                  m_semimajor;     //!< Ellipse boundary semimajor axis
+    const double&                  m_semiminor;     //!< Ellipse boundary semiminor axis
+    const double&                  m_posangle;      //!< Ellipse boundary position angle
+    const double&                  m_zenith;        //!< Zenith angle
+    const double&                  m_azimuth;       //!< Azimuth angle
+    const GEnergy&                 m_srcEng;        //!< True photon energy
+    const GTime&                   m_srcTime;       //!< True photon time
+    const double&                  m_srcLogEng;     //!< True photon log energy
+    const double&                  m_rho_obs;       //!< Distance of model centre from measured photon
+    double                         m_cos_rho_obs;   //!< Cosine of m_rho_obs
+    double                         m_sin_rho_obs;   //!< Sine of m_rho_obs
+    const double&                  m_posangle_obs;  //!< Photon position angle measured from model centre
+    const double&                  m_rho_pnt;       //!< Distance of model centre from pointing
+    double                         m_cos_rho_pnt;   //!< Cosine of m_rho_pnt
+    double                         m_sin_rho_pnt;   //!< Sine of m_rho_pnt
+    const double&                  m_omega_pnt;     //!< Azimuth of pointing in model system
+    const double&                  m_delta_max;     //!< Maximum PSF radius
+    double                         m_cos_delta_max; //!< Cosine of maximum PSF radius
+    const int&                     m_iter;          //!< Integration iterations
+};
+
+
+/***********************************************************************//**
+ * @class cta_irf_elliptical_grad_kern_omega
+ *
+ * @brief Kernel for elliptical model azimuth angle integration of IRF and
+ *        its parameter gradients
+ *
+ * This class implements the computation of
+ *
+ * \f[
+ *    \left( S_{\rm p}(\rho, \omega | E, t) \, IRF(\rho, \omega),
+ *           \frac{\partial S_{\rm p}(\rho, \omega | E, t)}{\partial p_i}
+ *           \, IRF(\rho, \omega) \right)
+ * \f]
+ *
+ * where the model gradients are obtained from
+ * GModelSpatialElliptical::eval_gradients().
+ ***************************************************************************/
+class cta_irf_elliptical_grad_kern_omega : public GFunctions {
+public:
+    cta_irf_elliptical_grad_kern_omega(const GCTAResponseIrf&         rsp,
+                                       const GModelSpatialElliptical& model,
+                                       const std::vector<int>&        pars,
+                                       const double&                  zenith,
+                                       const double&                  azimuth,
+                                       const GEnergy&                 srcEng,
+                                       const GTime&                   srcTime,
+                                       const double&                  srcLogEng,
+                                       const double&                  posangle_obs,
+                                       const double&                  omega_pnt,
+                                       const double&                  rho,
+                                       const double&                  cos_psf,
+                                       const double&                  sin_psf,
+                                       const double&                  cos_ph,
+                                       const double&                  sin_ph) :
+                                       m_rsp(rsp),
+                                       m_model(model),
+                                       m_pars(pars),
+                                       m_zenith(zenith),
+                                       m_azimuth(azimuth),
+                                       m_srcEng(srcEng),
+                                       m_srcTime(srcTime),
+                                       m_srcLogEng(srcLogEng),
+                                       m_posangle_obs(posangle_obs),
+                                       m_omega_pnt(omega_pnt),
+                                       m_rho(rho),
+                                       m_cos_psf(cos_psf),
+                                       m_sin_psf(sin_psf),
+                                       m_cos_ph(cos_ph),
+                                       m_sin_ph(sin_ph),
+                                       m_gradients(model.size()) { }
+    int     size(void) const { return 1 + m_pars.size(); }
+    GVector eval(const double& omega);
+protected:
+    const GCTAResponseIrf&         m_rsp;          //!< CTA response
+    const GModelSpatialElliptical& m_model;        //!< Spatial model
+    const std::vector<int>&        m_pars;         //!< Indices of shape parameters
+    const double&                  m_zenith;       //!< Zenith angle
+    const double&                  m_azimuth;      //!< Azimuth angle
+    const GEnergy&                 m_srcEng;       //!< True photon energy
+    const GTime&                   m_srcTime;      //!< True photon time
+    const double&                  m_srcLogEng;    //!< True photon log energy
+    const double&                  m_posangle_obs; //!< Measured photon position angle from model centre
+    const double&                  m_omega_pnt;    //!< Azimuth of pointing in model system
+    const double&                  m_rho;          //!< Model zenith angle
+    const double&                  m_cos_psf;      //!< Cosine term for PSF offset angle computation
+    const double&                  m_sin_psf;      //!< Sine term for PSF offset angle computation
+    const double&                  m_cos_ph;       //!< Cosine term for photon offset angle computation
+    const double&                  m_sin_ph;       //!< Sine term for photon offset angle computation
+    GVector                        m_gradients;    //!< Model parameter gradients
+};
+
+
 /***********************************************************************//**
  * @class cta_nroi_elliptical_kern_rho
  *
@@ -673,7 +1018,7 @@ public:
                                  const GEnergy&                 obsEng,
                                  const GTime&                   obsTime,
                                  const GCTAObservation&         obs,
-                                 const GMatrix&                 rot,
+                                 const GMatrix3&                rot,
                                  const double&                  rho_roi,
                                  const double&                  posangle_roi,
                                  const double&                  radius_roi,
@@ -708,7 +1053,7 @@ protected:
     const GEnergy&                 m_obsEng;         //!< Observed photon energy
     const GTime&                   m_obsTime;        //!< Observed photon arrival time
     const GCTAObservation&         m_obs;            //!< CTA observation
-    const GMatrix&                 m_rot;            //!< Rotation matrix
+    const GMatrix3&                m_rot;            //!< Rotation matrix
     const double&                  m_rho_roi;        //!< Distance between model and ROI centre
     double                         m_cos_rho_roi;    //!< Cosine of m_rho_roi
     double                         m_sin_rho_roi;    //!< Sine of m_rho_roi
@@ -750,7 +1095,7 @@ public:
                                    const GEnergy&                 obsEng,
                                    const GTime&                   obsTime,
                                    const GCTAObservation&         obs,
-                                   const GMatrix&                 rot,
+                                   const GMatrix3&                rot,
                                    const double&                  rho,
                                    const double&                  sin_rho,
                                    const double&                  cos_rho,
@@ -776,7 +1121,7 @@ protected:
     const GEnergy&                 m_obsEng;       //!< Observed photon energy
     const GTime&                   m_obsTime;      //!< Observed photon arrival time
     const GCTAObservation&         m_obs;          //!< Pointer to observation
-    const GMatrix&                 m_rot;          //!< Rotation matrix
+    const GMatrix3&                m_rot;          //!< Rotation matrix
     const double&                  m_rho;
     const double&                  m_sin_rho;      //!< Sine of offset angle
     const double&                  m_cos_rho;      //!< Cosine of offset angle
@@ -826,9 +1171,10 @@ public:
                                const GTime&           srcTime,
                                const double&          srcLogEng,
                                const GEnergy&         obsEng,
-                               const GMatrix&         rot,
+                               const GMatrix3&        rot,
                                const double&          eta,
-                               const int&             iter) :
+                               const int&             iter,
+                               const int&             order = 0) :
                                m_rsp(rsp),
                                m_model(model),
                                m_theta(theta),
@@ -842,7 +1188,8 @@ public:
                                m_rot(rot),
                                m_sin_eta(std::sin(eta)),
                                m_cos_eta(std::cos(eta)),
-                               m_iter(iter) { }
+                               m_iter(iter),
+                               m_order(order) { }
     double eval(const double& theta);
 protected:
     const GCTAResponseIrf& m_rsp;        //!< CTA response
@@ -855,7 +1202,7 @@ protected:
     const GTime&           m_srcTime;    //!< True photon arrival time
     const double&          m_srcLogEng;  //!< True photon log energy
     const GEnergy&         m_obsEng;     //!< Measured event energy
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     double                 m_sin_eta;    //!< Sine of angular distance between
                                          //   observed photon direction and
                                          //   camera centre
@@ -863,6 +1210,7 @@ protected:
                                          //   observed photon direction and
                                          //   camera centre
     const int&             m_iter;       // Integration iterations
+    int                    m_order;      //!< Gauss-Legendre order (0: Romberg)
 };
 
 
@@ -896,7 +1244,7 @@ public:
                              const GTime&           srcTime,
                              const double&          srcLogEng,
                              const GEnergy&         obsEng,
-                             const GMatrix&         rot,
+                             const GMatrix3&        rot,
                              const double&          sin_theta,
                              const double&          cos_theta,
                              const double&          sin_ph,
@@ -924,7 +1272,7 @@ protected:
     const GTime&           m_srcTime;    //!< True photon arrival time
     const double&          m_srcLogEng;  //!< True photon log energy
     const GEnergy&         m_obsEng;     //!< Measured event energy
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     const double&          m_sin_theta;  //!< Sine of offset angle
     const double&          m_cos_theta;  //!< Cosine of offset angle
     const double&          m_sin_ph;     //!< Sine term in angular distance equation
@@ -971,7 +1319,7 @@ public:
                                 const GEnergy&         obsEng,
                                 const GTime&           obsTime,
                                 const GCTAObservation& obs,
-                                const GMatrix&         rot,
+                                const GMatrix3&        rot,
                                 const int&             iter) :
                                 m_rsp(rsp),
                                 m_model(model),
@@ -991,7 +1339,7 @@ protected:
     const GEnergy&         m_obsEng;     //!< Observed photon energy
     const GTime&           m_obsTime;    //!< Observed photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     const int&             m_iter;       //!< Integration iterations
 };
 
@@ -1025,7 +1373,7 @@ public:
                               const GEnergy&         obsEng,
                               const GTime&           obsTime,
                               const GCTAObservation& obs,
-                              const GMatrix&         rot,
+                              const GMatrix3&        rot,
                               const double&          theta,
                               const double&          sin_theta) :
                               m_rsp(rsp),
@@ -1048,7 +1396,7 @@ protected:
     const GEnergy&         m_obsEng;     //!< Observed photon energy
     const GTime&           m_obsTime;    //!< Observed photon arrival time
     const GCTAObservation& m_obs;        //!< CTA observation
-    const GMatrix&         m_rot;        //!< Rotation matrix
+    const GMatrix3&        m_rot;        //!< Rotation matrix
     const double&          m_theta;      //!< Offset angle (radians)
     double                 m_cos_theta;  //!< Cosine of offset angle
     const double&          m_sin_theta;  //!< Sine of offset angle
@@ -1374,7 +1722,7 @@ public:
                                const GSkyDir&          srcDir,
                                const GEnergy&          srcEng,
                                const GTime&            srcTime,
-                               const GMatrix&          rot,
+                               const GMatrix3&         rot,
                                const int&              iter) :
                                m_rsp(rsp),
                                m_model(model),
@@ -1391,7 +1739,7 @@ protected:
     const GSkyDir&          m_srcDir;  //!< True photon arrival direction
     const GEnergy&          m_srcEng;  //!< True photon energy
     const GTime&            m_srcTime; //!< True photon arrival time
-    const GMatrix&          m_rot;     //!< Rotation matrix
+    const GMatrix3&         m_rot;     //!< Rotation matrix
     const int&              m_iter;    //!< Romberg iterations
     double                  m_psf_max; //!< Maximum PSF value
 };
@@ -1407,7 +1755,7 @@ public:
     cta_psf_diffuse_kern_phi(const GModelSpatial* model,
                              const GEnergy&       srcEng,
                              const GTime&         srcTime,
-                             const GMatrix&       rot,
+                             const GMatrix3&      rot,
                              const double&        sin_delta,
                              const double&        cos_delta) :
                              m_model(model),
@@ -1421,7 +1769,7 @@ protected:
     const GModelSpatial* m_model;     //!< Spatial model
     const GEnergy&       m_srcEng;    //!< True photon energy
     const GTime&         m_srcTime;   //!< True photon arrival time
-    const GMatrix&       m_rot;       //!< Rotation matrix
+    const GMatrix3&      m_rot;       //!< Rotation matrix
     const double&        m_sin_delta; //!< sin(delta)
     const double&        m_cos_delta; //!< cos(delta)
 };
@@ -79,6 +79,7 @@ void TestGCTAResponse::set(void)
     // Append tests to test suite
     append(static_cast<pfunction>(&TestGCTAResponse::test_response), "Test response");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_aeff), "Test effective area");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_table), "Test response table");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_psf), "Test PSF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_psf_king), "Test King profile PSF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npsf), "Test integrated PSF");
@@ -86,11 +87,18 @@ void TestGCTAResponse::set(void)
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_edisp_PerfTable), "Test energy dispersion Performance Table computation");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_edisp_RMF), "Test energy dispersion RMF computation");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_edisp_2D), "Test energy dispersion 2D computation");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_edisp_convolve), "Test energy dispersion convolution");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_diffuse), "Test diffuse IRF");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_diffuse), "Test diffuse IRF integration");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_gradients), "Test IRF gradients");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_gauss_legendre), "Test Gauss-Legendre IRF integration");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_irf_cache), "Test IRF cache");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_npred_gradients), "Test Npred gradients");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_nroi_cache), "Test Nroi cache");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_expcube), "Test exposure cube");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_psfcube), "Test PSF cube");
     append(static_cast<pfunction>(&TestGCTAResponse::test_response_bkgcube), "Test background cube");
+    append(static_cast<pfunction>(&TestGCTAResponse::test_response_cube_fill), "Test cube filling");
 
     // Return
     return;
@@ -150,6 +158,8 @@ void TestGCTAObservation::set(void)
     append(static_cast<pfunction>(&TestGCTAObservation::test_unbinned_obs), "Test unbinned observations");
     append(static_cast<pfunction>(&TestGCTAObservation::test_binned_obs), "Test binned observation");
     append(static_cast<pfunction>(&TestGCTAObservation::test_cube_obs), "Test cube-style observation");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_event_list), "Test event list");
+    append(static_cast<pfunction>(&TestGCTAObservation::test_event_memory), "Test event memory management");
 
     // Return
     return;
@@ -360,6 +370,77 @@ void TestGCTAResponse::test_response_aeff(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test CTA response table interpolation
+ *
+ * Builds a three-dimensional response table with two parameters and checks
+ * that the batch interpolation operators return the same values as the
+ * interpolation operators for single arguments, including arguments that
+ * lie outside the axis ranges.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_table(void)
+{
+    // Setup axes
+    std::vector<double> lo1, hi1, lo2, hi2, lo3, hi3;
+    for (int i = 0; i < 5; ++i) {
+        lo1.push_back(-1.0 + 0.5*i);
+        hi1.push_back(-0.5 + 0.5*i);
+    }
+    for (int i = 0; i < 4; ++i) {
+        lo2.push_back(i*i);
+        hi2.push_back((i+1)*(i+1));
+    }
+    for (int i = 0; i < 3; ++i) {
+        lo3.push_back(2.0*i);
+        hi3.push_back(2.0*i+1.0);
+    }
+
+    // Setup response table with two parameters
+    GCTAResponseTable table;
+    table.append_axis(lo1, hi1, "ENERG", "TeV");
+    table.append_axis(lo2, hi2, "THETA", "deg");
+    table.append_axis(lo3, hi3, "PHI", "deg");
+    table.append_parameter("PAR1", "m2");
+    table.append_parameter("PAR2", "m2");
+    table.axis_log10(0);
+    for (int i = 0; i < table.elements(); ++i) {
+        table(0,i) = 1.0 + i;
+        table(1,i) = std::sin(0.3*i);
+    }
+
+    // Setup arguments, some of which lie outside the axes
+    std::vector<double> arg1, arg2, arg3;
+    for (int k = 0; k < 50; ++k) {
+        arg1.push_back(-1.5 + 0.06*k);
+        arg2.push_back(-2.0 + 0.5*k);
+        arg3.push_back(-1.0 + 0.2*((k*7) % 50));
+    }
+
+    // Perform batch interpolation
+    int                 num = arg1.size();
+    std::vector<double> all(2*num);
+    std::vector<double> par(num);
+    std::vector<double> par2(num);
+    table(num, &arg1[0], &arg2[0], &arg3[0], &all[0]);
+    table(1, num, &arg1[0], &arg2[0], &arg3[0], &par[0]);
+    table(1, num, &arg1[0], &arg2[0], &par2[0]);
+
+    // Compare batch interpolation to single argument interpolation
+    for (int k = 0; k < num; ++k) {
+        std::vector<double> ref = table(arg1[k], arg2[k], arg3[k]);
+        test_value(all[k], ref[0], 1.0e-10, "Check batch interpolation");
+        test_value(all[num+k], ref[1], 1.0e-10, "Check batch interpolation");
+        test_value(par[k], table(1, arg1[k], arg2[k], arg3[k]), 1.0e-10,
+                   "Check batch interpolation of single parameter");
+        test_value(par2[k], table(1, arg1[k], arg2[k]), 1.0e-10,
+                   "Check 2D batch interpolation of single parameter");
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test CTA psf computation
  *
@@ -392,6 +473,9 @@ void TestGCTAResponse::test_response_psf(void)
         test_value(sum, 1.0, 0.001, "PSF integration for "+eng.print());
     }
 
+    // Test batch evaluation against individual evaluations
+    test_psf_batch(*rsp.psf());
+
     // Return
     return;
 }
@@ -430,6 +514,9 @@ void TestGCTAResponse::test_response_psf_king(void)
         test_value(sum, 1.0, 0.001, "PSF integration for "+eng.print());
     }
 
+    // Test batch evaluation against individual evaluations
+    test_psf_batch(*rsp.psf());
+
     // Return
     return;
 }
@@ -614,6 +701,9 @@ void TestGCTAResponse::test_response_edisp_RMF(void)
     // Test normalisation
     test_edisp_integration(edisp, 0.5, 10.0);
 
+    // Test batch evaluation against individual evaluations
+    test_edisp_batch(edisp);
+
     // Return
     return;
 }
@@ -649,6 +739,115 @@ void TestGCTAResponse::test_response_edisp_2D(void)
     // Test normalisation
     test_edisp_integration(edisp);
 
+    // Test batch evaluation against individual evaluations
+    test_edisp_batch(edisp);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test convolution of energy dispersion on true energy grid
+ *
+ * Compares the event probabilities that are obtained by summing over the
+ * nodes of a logarithmic true energy grid to those obtained by Romberg
+ * integration over true energy.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_edisp_convolve(void)
+{
+    // Setup response from performance table with energy dispersion
+    GCTAAeffPerfTable  aeff(cta_edisp_perf);
+    GCTAPsfPerfTable   psf(cta_edisp_perf);
+    GCTAEdispPerfTable edisp(cta_edisp_perf);
+    GCTAResponseIrf    rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+    rsp.edisp(&edisp);
+    rsp.apply_edisp(true);
+
+    // Test invalid number of nodes
+    test_try("Test negative number of true energy nodes");
+    try {
+        rsp.edisp_nodes(-1);
+        test_try_failure("Negative number of nodes shall throw an exception.");
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.response(rsp);
+    obs.pointing(pnt);
+
+    // Setup point source model
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+    GModelSpatialPointSource spatial(srcDir);
+    GModelSpectralPlaw       spectral(5.7e-16, -2.48, GEnergy(0.3, "TeV"));
+    GModelSky                model(spatial, spectral);
+
+    // Setup event direction
+    GCTAInstDir instDir;
+    instDir.dir().radec_deg(84.3, 22.6);
+
+    // Loop over measured energies
+    const double energies[] = {0.3, 1.0, 3.0};
+    for (int i = 0; i < 3; ++i) {
+
+        // Setup event
+        GCTAEventAtom event;
+        event.dir(instDir);
+        event.energy(GEnergy(energies[i], "TeV"));
+
+        // Compute event probability by Romberg integration
+        rsp.edisp_nodes(0);
+        double ref = rsp.convolve(model, event, obs, false);
+
+        // Compute event probability on true energy grid
+        rsp.edisp_nodes(50);
+        double prob = rsp.convolve(model, event, obs, false);
+
+        // Compare event probabilities
+        test_assert(ref > 0.0, "Check that event probability is positive");
+        test_value(prob, ref, 0.01*ref,
+                   "Check event probability at "+gammalib::str(energies[i])+
+                   " TeV");
+
+    } // endfor: looped over measured energies
+
+    // Setup event cube with energy bins for precomputed kernels
+    GSkymap  map("CAR", "CEL", 84.3, 22.6, 0.5, 0.5, 5, 5, 3);
+    GEbounds ebounds(3, GEnergy(0.3, "TeV"), GEnergy(3.0, "TeV"));
+    GGti     gti(GTime(0.0), GTime(1800.0));
+    GCTAEventCube cube(map, ebounds, gti);
+    obs.events(cube);
+    rsp.edisp_nodes(50);
+    obs.response(rsp);
+
+    // Setup event at the energy of the second event cube bin
+    GCTAEventAtom event;
+    event.dir(instDir);
+    event.energy(cube[1]->energy());
+
+    // Compare event probability with precomputed kernels to that computed
+    // without precomputed kernels
+    double ref = obs.response()->convolve(model, event, obs, false);
+    obs.response()->edisp_kernels(obs);
+    double prob = obs.response()->convolve(model, event, obs, false);
+    test_assert(ref > 0.0, "Check that event probability is positive");
+    test_value(prob, ref, 1.0e-10*ref,
+               "Check event probability with precomputed kernels");
 
     // Return
     return;
@@ -736,6 +935,454 @@ void TestGCTAResponse::test_response_irf_diffuse(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test CTA IRF gradient computation
+ *
+ * Tests the analytical computation of the spatial parameter gradients in
+ * GCTAResponseIrf::irf_gradients() by comparing the gradients to those
+ * obtained by numerical differentiation of the IRF using
+ * GResponse::irf_gradients(). The test is done for a point source, a
+ * radial Gaussian, a radial disk and an elliptical Gaussian model.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_irf_gradients(void)
+{
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(cta_edisp_perf);
+    GCTAPsfPerfTable  psf(cta_edisp_perf);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.response(rsp);
+    obs.pointing(pnt);
+
+    // Setup event
+    GCTAInstDir instDir;
+    instDir.dir().radec_deg(84.3, 22.6);
+    GCTAEventAtom event;
+    event.dir(instDir);
+    event.energy(GEnergy(1.0, "TeV"));
+
+    // Setup source centre
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+
+    // Test point source
+    GModelSpatialPointSource ptsrc(srcDir);
+    test_irf_gradients(rsp, obs, event, &ptsrc, "Point source");
+
+    // Test radial Gaussian
+    GModelSpatialRadialGauss gauss(srcDir, 0.1);
+    test_irf_gradients(rsp, obs, event, &gauss, "Radial Gaussian");
+
+    // Test radial disk
+    GModelSpatialRadialDisk disk(srcDir, 0.1);
+    test_irf_gradients(rsp, obs, event, &disk, "Radial disk");
+
+    // Test elliptical Gaussian
+    GModelSpatialEllipticalGauss egauss(srcDir, 0.2, 0.1, 30.0);
+    test_irf_gradients(rsp, obs, event, &egauss, "Elliptical Gaussian");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test Gauss-Legendre integration of extended model IRFs
+ *
+ * Checks that the IRF of a radial Gaussian computed with Gauss-Legendre
+ * integration agrees with the Romberg integration, and that an invalid
+ * Gauss-Legendre order is rejected.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_irf_gauss_legendre(void)
+{
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(cta_edisp_perf);
+    GCTAPsfPerfTable  psf(cta_edisp_perf);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.response(rsp);
+    obs.pointing(pnt);
+
+    // Setup event
+    GCTAInstDir instDir;
+    instDir.dir().radec_deg(84.3, 22.6);
+    GCTAEventAtom event;
+    event.dir(instDir);
+    event.energy(GEnergy(1.0, "TeV"));
+
+    // Setup radial Gaussian source
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+    GModelSpatialRadialGauss gauss(srcDir, 0.1);
+    GSource source("Radial Gaussian", &gauss, event.energy(), event.time());
+
+    // Check default integration method
+    test_value(rsp.gauss_legendre_order(), 0, "Check default order");
+
+    // Compute IRF using Romberg and Gauss-Legendre integration
+    double romberg = rsp.irf(event, source, obs);
+    rsp.gauss_legendre_order(16);
+    double legendre = rsp.irf(event, source, obs);
+    test_value(rsp.gauss_legendre_order(), 16, "Check order");
+    test_assert(romberg > 0.0, "Check Romberg IRF is positive");
+    test_value(legendre, romberg, 1.0e-3 * romberg,
+               "Check Gauss-Legendre IRF against Romberg IRF");
+
+    // Check that copies keep the order
+    GCTAResponseIrf cpy(rsp);
+    test_value(cpy.gauss_legendre_order(), 16, "Check order of copy");
+
+    // Check that an invalid order is rejected
+    test_try("Check invalid order");
+    try {
+        rsp.gauss_legendre_order(-1);
+        test_try_failure();
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test caching of IRF values of extended models
+ *
+ * Checks that the IRF value of a radial model with fixed parameters is
+ * stored in the IRF cache of the event list once the cache keys have been
+ * set, that it is reused, and that the cached value is invalidated when a
+ * model parameter changes.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_irf_cache(void)
+{
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(cta_edisp_perf);
+    GCTAPsfPerfTable  psf(cta_edisp_perf);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup event list with a single event
+    GCTAInstDir instDir;
+    instDir.dir().radec_deg(84.3, 22.6);
+    GCTAEventAtom atom;
+    atom.dir(instDir);
+    atom.energy(GEnergy(1.0, "TeV"));
+    GCTAEventList events;
+    events.append(atom);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.response(rsp);
+    obs.pointing(pnt);
+    obs.events(events);
+    const GCTAEventList* list  = dynamic_cast<const GCTAEventList*>(obs.events());
+    const GEvent*        event = (*list)[0];
+
+    // Setup models with a radial disk with fixed parameters and a radial
+    // disk with a free radius
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+    GModelSpatialRadialDisk disk(srcDir, 0.1);
+    for (int i = 0; i < disk.size(); ++i) {
+        disk[i].fix();
+    }
+    GModelSpatialRadialDisk free_disk(srcDir, 0.1);
+    free_disk[2].free();
+    GModelSky sky_disk(disk, GModelSpectralConst());
+    GModelSky sky_free_disk(free_disk, GModelSpectralConst());
+    sky_disk.name("Disk");
+    sky_free_disk.name("Free disk");
+    GModels models;
+    models.append(sky_disk);
+    models.append(sky_free_disk);
+    GModelSky*               model      = static_cast<GModelSky*>(models["Disk"]);
+    GModelSpatialRadialDisk* model_disk =
+                             static_cast<GModelSpatialRadialDisk*>(model->spatial());
+    GSource source("Disk", model_disk, GEnergy(1.0, "TeV"), GTime());
+
+    // Check that IRF value is cached and reused
+    rsp.irf_cache_keys(models, obs);
+    double irf = rsp.irf(*event, source, obs);
+    test_assert(irf > 0.0, "Check IRF value of radial disk");
+    test_value(list->irf_cache("Disk", 0), irf, 1.0e-10,
+               "Check cached IRF value");
+    test_value(rsp.irf(*event, source, obs), irf, 1.0e-10,
+               "Check IRF value from cache");
+
+    // Check that the cached value is invalidated if the radius changes
+    model_disk->radius(0.2);
+    rsp.irf_cache_keys(models, obs);
+    test_value(list->irf_cache("Disk", 0), -1.0, 1.0e-10,
+               "Check that cached IRF value is invalidated");
+    double irf2 = rsp.irf(*event, source, obs);
+    test_assert(std::abs(irf2 - irf) > 1.0e-6 * irf,
+                "Check that IRF value changes with radius");
+    test_value(list->irf_cache("Disk", 0), irf2, 1.0e-10,
+               "Check updated cached IRF value");
+
+    // Check that the cached value is not used once the cache keys were
+    // released
+    list->irf_cache_release();
+    test_value(list->irf_cache("Disk", 0), -1.0, 1.0e-10,
+               "Check that cached IRF value is not used after release");
+
+    // Check that no IRF value is cached if a parameter is free
+    GSource free_source("Free disk", &free_disk, GEnergy(1.0, "TeV"), GTime());
+    rsp.irf(*event, free_source, obs);
+    test_value(list->irf_cache("Free disk", 0), -1.0, 1.0e-10,
+               "Check that IRF value is not cached for free parameters");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test Npred gradients
+ *
+ * Checks that the Npred value and the Npred gradients that are computed in
+ * a single pass by GObservation::npred(GModels&, GVector*) agree with the
+ * Npred value and the numerical Npred gradients of the individual
+ * parameters.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_npred_gradients(void)
+{
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(cta_edisp_perf);
+    GCTAPsfPerfTable  psf(cta_edisp_perf);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup ROI
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.dir(pntDir);
+    roi.centre(instDir);
+    roi.radius(3.0);
+
+    // Setup dummy event list
+    GGti     gti;
+    GEbounds ebounds;
+    gti.append(GTime(0.0), GTime(1800.0));
+    ebounds.append(GEnergy(0.1, "TeV"), GEnergy(100.0, "TeV"));
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.ontime(1800.0);
+    obs.livetime(1600.0);
+    obs.deadc(1600.0/1800.0);
+    obs.response(rsp);
+    obs.pointing(pnt);
+    obs.events(events);
+
+    // Setup point source model with free spatial, spectral and temporal
+    // parameters
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+    GModelSpatialPointSource  spatial(srcDir);
+    GModelSpectralPlaw        spectral(5.7e-16, -2.48, GEnergy(0.3, "TeV"));
+    GModelTemporalConst       temporal;
+    GModelSky                 model(spatial, spectral, temporal);
+    model.name("Point source");
+    for (int i = 0; i < model.size(); ++i) {
+        if (model[i].name() != "PivotEnergy") {
+            model[i].free();
+        }
+    }
+    GModels models;
+    models.append(model);
+
+    // Compute Npred and gradients in a single pass
+    GVector gradient(models.npars());
+    double  npred = obs.npred(models, &gradient);
+
+    // Check Npred value
+    test_assert(npred > 0.0, "Check that Npred is positive");
+    test_value(npred, obs.npred(*models[0]), 1.0e-10 * npred,
+               "Check Npred value");
+
+    // Check gradients against numerical gradients
+    for (int i = 0; i < models[0]->size(); ++i) {
+        const GModelPar& par  = (*models[0])[i];
+        double           grad = obs.npred_grad(*models[0], par);
+        double           eps  = 1.0e-4 * std::abs(grad) + 1.0e-10;
+        test_value(gradient[i], grad, eps,
+                   "Check Npred gradient of parameter \""+par.name()+"\"");
+    }
+
+    // Check that the prefactor gradient does not vanish for a vanishing
+    // prefactor. Since Npred is linear in the prefactor, the gradient
+    // should not change.
+    int iprefactor = 0;
+    for (int i = 0; i < models[0]->size(); ++i) {
+        if ((*models[0])[i].name() == "Prefactor") {
+            iprefactor = i;
+        }
+    }
+    double grad_prefactor = gradient[iprefactor];
+    (*models[0])["Prefactor"].remove_min();
+    (*models[0])["Prefactor"].value(0.0);
+    GVector gradient0(models.npars());
+    double  npred0 = obs.npred(models, &gradient0);
+    test_value(npred0, 0.0, 1.0e-20, "Check Npred for vanishing prefactor");
+    test_value(gradient0[iprefactor], grad_prefactor,
+               1.0e-6 * std::abs(grad_prefactor),
+               "Check prefactor gradient for vanishing prefactor");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test Nroi cache
+ *
+ * Checks that the spatial ROI integral of a named radial model with fixed
+ * spatial parameters is stored in the Nroi cache of the observation, that
+ * Npred is not changed by the cache, and that the cache is invalidated if
+ * a spatial parameter changes.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_nroi_cache(void)
+{
+    // Setup response from performance table
+    GCTAAeffPerfTable aeff(cta_edisp_perf);
+    GCTAPsfPerfTable  psf(cta_edisp_perf);
+    GCTAResponseIrf   rsp;
+    rsp.aeff(&aeff);
+    rsp.psf(&psf);
+
+    // Setup pointing
+    GSkyDir pntDir;
+    pntDir.radec_deg(83.6331, 22.0145);
+    GCTAPointing pnt;
+    pnt.dir(pntDir);
+
+    // Setup ROI
+    GCTARoi     roi;
+    GCTAInstDir instDir;
+    instDir.dir(pntDir);
+    roi.centre(instDir);
+    roi.radius(3.0);
+
+    // Setup dummy event list
+    GGti     gti;
+    GEbounds ebounds;
+    gti.append(GTime(0.0), GTime(1800.0));
+    ebounds.append(GEnergy(0.1, "TeV"), GEnergy(100.0, "TeV"));
+    GCTAEventList events;
+    events.roi(roi);
+    events.gti(gti);
+    events.ebounds(ebounds);
+
+    // Setup observation
+    GCTAObservation obs;
+    obs.ontime(1800.0);
+    obs.livetime(1600.0);
+    obs.deadc(1600.0/1800.0);
+    obs.response(rsp);
+    obs.pointing(pnt);
+    obs.events(events);
+
+    // Setup radial disk model with fixed spatial parameters
+    GSkyDir srcDir;
+    srcDir.radec_deg(84.25, 22.55);
+    GModelSpatialRadialDisk disk(srcDir, 0.2);
+    GModelSpectralPlaw      spectral(5.7e-16, -2.48, GEnergy(0.3, "TeV"));
+    GModelSky               model(disk, spectral);
+    for (int i = 0; i < model.spatial()->size(); ++i) {
+        (*model.spatial())[i].fix();
+    }
+    model.name("Disk");
+
+    // Compute Npred of unnamed model, which is not cached
+    GModelSky unnamed(model);
+    unnamed.name("");
+    double ref = obs.npred(unnamed);
+
+    // Check that Nroi values are cached and that Npred is unchanged
+    GEnergy energy(1.0, "TeV");
+    test_value(obs.nroi_cache("Disk", energy), -1.0, 1.0e-10,
+               "Check that Nroi cache is initially empty");
+    double npred = obs.npred(model);
+    test_value(npred, ref, 1.0e-10 * ref, "Check Npred computation");
+    test_value(obs.npred(model), ref, 1.0e-10 * ref,
+               "Check Npred computation from Nroi cache");
+    rsp.nroi(model, energy, GTime(0.0), obs);
+    double nroi = rsp.nroi(model, energy, GTime(0.0), energy, GTime(0.0), obs);
+    test_value(obs.nroi_cache("Disk", energy), nroi, 1.0e-10 * nroi,
+               "Check cached Nroi value");
+
+    // Check that Npred changes with the spectral model
+    model["Prefactor"].value(2.0 * 5.7e-16);
+    test_value(obs.npred(model), 2.0 * ref, 1.0e-10 * ref,
+               "Check Npred computation after spectral change");
+
+    // Check that the cached values are invalidated if the radius changes
+    model["Radius"].value(0.4);
+    double npred2 = obs.npred(model);
+    test_assert(std::abs(npred2 - 2.0 * ref) > 1.0e-6 * ref,
+                "Check that Npred changes with radius");
+    unnamed["Prefactor"].value(2.0 * 5.7e-16);
+    unnamed["Radius"].value(0.4);
+    test_value(npred2, obs.npred(unnamed), 1.0e-10 * npred2,
+               "Check Npred computation after radius change");
+
+    // Check that no Nroi value is cached if a spatial parameter is free
+    GModelSky free_model(model);
+    free_model.name("Free disk");
+    free_model["Radius"].free();
+    obs.npred(free_model);
+    test_value(obs.nroi_cache("Free disk", energy), -1.0, 1.0e-10,
+               "Check that Nroi is not cached for free parameters");
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test CTA Npred computation
  *
@@ -930,6 +1577,163 @@ void TestGCTAResponse::test_response_bkgcube(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test filling of exposure, PSF and background cubes
+ *
+ * Fills exposure and PSF cubes of a typical size from a single observation
+ * and compares the result to the cubes obtained by direct evaluation of the
+ * response using the set() methods. The background cube filled from an
+ * offset angle table is compared to the background cube obtained by model
+ * evaluation for all bins. The test duration serves as benchmark of the
+ * cube filling.
+ ***************************************************************************/
+void TestGCTAResponse::test_response_cube_fill(void)
+{
+    // Setup observation container with a single CTA observation
+    GCTAObservation obs_cta;
+    obs_cta.load(cta_events);
+    obs_cta.response(cta_irf, GCaldb(cta_caldb));
+    GObservations obs;
+    obs.append(obs_cta);
+
+    // Fill exposure cube and compare to direct evaluation
+    GEbounds         ebounds(20, GEnergy(0.1, "TeV"), GEnergy(100.0, "TeV"));
+    GCTACubeExposure expcube("CAR", "CEL", 83.63, 22.01, 0.02, 0.02, 200, 200, ebounds);
+    GCTACubeExposure expref(expcube);
+    expcube.fill(obs);
+    expref.set(obs_cta);
+    double expmax = 0.0;
+    double expdev = 0.0;
+    for (int imap = 0; imap < expref.cube().nmaps(); ++imap) {
+        for (int pixel = 0; pixel < expref.cube().npix(); ++pixel) {
+            double ref = expref.cube()(pixel, imap);
+            double dev = std::abs(expcube.cube()(pixel, imap) - ref);
+            if (ref > expmax) {
+                expmax = ref;
+            }
+            if (dev > expdev) {
+                expdev = dev;
+            }
+        }
+    }
+    test_assert(expmax > 0.0, "Check that exposure cube is not empty");
+    test_value(expdev/expmax, 0.0, 1.0e-4, "Exposure cube filling");
+    test_value(expcube.livetime(), obs_cta.livetime(), 1.0e-6,
+               "Exposure cube livetime");
+
+    // Fill PSF cube and compare to direct evaluation
+    GCTACubePsf psfcube("CAR", "CEL", 83.63, 22.01, 0.1, 0.1, 50, 50, ebounds, 0.1, 20);
+    GCTACubePsf psfref(psfcube);
+    psfcube.fill(obs);
+    psfref.set(obs_cta);
+    double psfmax = 0.0;
+    double psfdev = 0.0;
+    for (int imap = 0; imap < psfref.map().nmaps(); ++imap) {
+        for (int pixel = 0; pixel < psfref.map().npix(); ++pixel) {
+            double ref = psfref.map()(pixel, imap);
+            double dev = std::abs(psfcube.map()(pixel, imap) - ref);
+            if (ref > psfmax) {
+                psfmax = ref;
+            }
+            if (dev > psfdev) {
+                psfdev = dev;
+            }
+        }
+    }
+    test_assert(psfmax > 0.0, "Check that PSF cube is not empty");
+    test_value(psfdev/psfmax, 0.0, 1.0e-4, "PSF cube filling");
+
+    // Fill background cube for an IRF background model, which is filled
+    // from an offset angle table, and compare to the background cube that
+    // is obtained by evaluating the models for all bins. The evaluation for
+    // all bins is enforced by adding a point source with zero intensity.
+    GSkymap            bkgmap("CAR", "CEL", 83.63, 22.01, 0.1, 0.1, 50, 50, 20);
+    GCTAEventCube      bkgevents(bkgmap, ebounds, obs_cta.gti());
+    GCTACubeBackground bkgcube(bkgevents);
+    GCTACubeBackground bkgref(bkgevents);
+    GModels            models(cta_irf_bgd_xml);
+    obs.models(models);
+    bkgcube.fill(obs);
+    GModelSky ptsrc(GModelSpatialPointSource(GSkyDir()),
+                    GModelSpectralConst(0.0));
+    ptsrc.name("Zero");
+    models.append(ptsrc);
+    obs.models(models);
+    bkgref.fill(obs);
+    double bkgmax = 0.0;
+    double bkgdev = 0.0;
+    for (int imap = 0; imap < bkgref.cube().nmaps(); ++imap) {
+        for (int pixel = 0; pixel < bkgref.cube().npix(); ++pixel) {
+            double ref = bkgref.cube()(pixel, imap);
+            double dev = std::abs(bkgcube.cube()(pixel, imap) - ref);
+            if (ref > bkgmax) {
+                bkgmax = ref;
+            }
+            if (dev > bkgdev) {
+                bkgdev = dev;
+            }
+        }
+    }
+    test_assert(bkgmax > 0.0, "Check that background cube is not empty");
+    test_value(bkgdev/bkgmax, 0.0, 1.0e-4, "Background cube filling");
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compare analytical and numerical IRF gradients
+ *
+ * @param[in] rsp CTA response.
+ * @param[in] obs CTA observation.
+ * @param[in] event Event.
+ * @param[in] model Spatial model.
+ * @param[in] name Test name.
+ *
+ * Frees all spatial model parameters that have gradients and compares the
+ * IRF value and gradients computed by GCTAResponseIrf::irf_gradients() to
+ * the numerical values computed by GResponse::irf_gradients().
+ ***************************************************************************/
+void TestGCTAResponse::test_irf_gradients(const GCTAResponseIrf& rsp,
+                                          const GCTAObservation& obs,
+                                          const GEvent&          event,
+                                          GModelSpatial*         model,
+                                          const std::string&     name)
+{
+    // Free all parameters that have gradients
+    for (int i = 0; i < model->size(); ++i) {
+        if ((*model)[i].has_grad()) {
+            (*model)[i].free();
+        }
+    }
+
+    // Setup source
+    GSource source(name, model, event.energy(), event.time());
+
+    // Compute analytical gradients
+    GVector grad(model->size());
+    double  irf = rsp.irf_gradients(event, source, obs, grad);
+
+    // Compute numerical gradients
+    GVector num(model->size());
+    double  ref = rsp.GResponse::irf_gradients(event, source, obs, num);
+
+    // Compare IRF values and gradients
+    test_assert(irf > 0.0, name+" IRF is positive");
+    test_value(irf, ref, 1.0e-6*ref, name+" IRF value");
+    for (int i = 0; i < model->size(); ++i) {
+        if ((*model)[i].has_grad()) {
+            test_value(grad[i], num[i], 0.02*std::abs(num[i])+1.0e-6*ref,
+                       name+" "+(*model)[i].name()+" gradient");
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Utility function for energy dispersion tests
  *
@@ -1051,6 +1855,82 @@ void TestGCTAResponse::test_edisp_integration(const GCTAEdisp& edisp,
 }
 
 
+/***********************************************************************//**
+ * @brief Utility function for point spread function batch tests
+ *
+ * @param[in] psf Point spread function
+ *
+ * Checks that the batch evaluation of the point spread function gives the
+ * same values as the individual evaluations. The number of evaluations
+ * exceeds the block size of the batch implementations.
+ ***************************************************************************/
+void TestGCTAResponse::test_psf_batch(const GCTAPsf& psf)
+{
+    // Setup arguments
+    const int           num = 200;
+    std::vector<double> delta(num);
+    std::vector<double> logE(num);
+    std::vector<double> theta(num);
+    std::vector<double> values(num);
+    for (int k = 0; k < num; ++k) {
+        delta[k] = 0.0001 * k * gammalib::deg2rad;
+        logE[k]  = -1.0 + 0.01 * k;
+        theta[k] = 0.01 * (k % 10) * gammalib::deg2rad;
+    }
+
+    // Perform batch evaluation
+    psf.eval(num, &delta[0], &logE[0], &theta[0], &values[0]);
+
+    // Compare to individual evaluations
+    for (int k = 0; k < num; ++k) {
+        double value = psf(delta[k], logE[k], theta[k]);
+        test_value(values[k], value, 1.0e-10,
+                   psf.classname()+" batch evaluation "+gammalib::str(k));
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Utility function for energy dispersion batch tests
+ *
+ * @param[in] edisp Energy dispersion
+ *
+ * Checks that the batch evaluation of the energy dispersion gives the same
+ * values as the individual evaluations. The number of evaluations exceeds
+ * the block size of the batch implementations.
+ ***************************************************************************/
+void TestGCTAResponse::test_edisp_batch(const GCTAEdisp& edisp)
+{
+    // Setup arguments
+    const int           num = 200;
+    std::vector<double> logEobs(num);
+    std::vector<double> logEsrc(num);
+    std::vector<double> theta(num);
+    std::vector<double> values(num);
+    for (int k = 0; k < num; ++k) {
+        logEsrc[k] = -1.0 + 0.01 * k;
+        logEobs[k] = logEsrc[k] + 0.002 * (k % 50) - 0.05;
+        theta[k]   = 0.01 * (k % 10) * gammalib::deg2rad;
+    }
+
+    // Perform batch evaluation
+    edisp.eval(num, &logEobs[0], &logEsrc[0], &theta[0], &values[0]);
+
+    // Compare to individual evaluations
+    for (int k = 0; k < num; ++k) {
+        double value = edisp(logEobs[k], logEsrc[k], theta[k]);
+        test_value(values[k], value, 1.0e-10,
+                   edisp.classname()+" batch evaluation "+gammalib::str(k));
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test CTA cube background
  ***************************************************************************/
@@ -1251,6 +2131,78 @@ void TestGCTAObservation::test_unbinned_obs(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test memory management of events loaded on demand
+ *
+ * Checks that event lists are loaded on first access during a likelihood
+ * evaluation, that the least recently used event list is disposed if the
+ * memory limit is exceeded, that disposed event lists are reloaded on the
+ * next evaluation, and that event lists that are accessed outside an
+ * evaluation are removed from memory management.
+ ***************************************************************************/
+void TestGCTAObservation::test_event_memory(void)
+{
+    // Setup two observations that load their events on demand
+    GCTAObservation run;
+    run.eventfile(cta_events);
+    run.response(cta_irf, GCaldb(cta_caldb));
+    GObservations obs;
+    run.id("0001");
+    obs.append(run);
+    run.id("0002");
+    obs.append(run);
+    obs.models(cta_model_xml);
+
+    // Load events of both observations in a likelihood evaluation without
+    // memory limit
+    GCTAObservation::events_max_memory(0.0);
+    obs.eval();
+    double logL   = obs.logL();
+    double memory = GCTAObservation::events_memory();
+    test_assert(memory > 0.0, "Check that event memory is positive");
+
+    // Set memory limit below the memory of both event lists. The events of
+    // the least recently used observation should be disposed.
+    GCTAObservation::events_max_memory(0.75 * memory);
+    test_value(GCTAObservation::events_memory(), 0.5 * memory, 1.0e-10,
+               "Check event memory after disposal");
+
+    // Evaluate the likelihood again, which reloads the disposed events and
+    // disposes the events of the other observation
+    obs.eval();
+    test_value(obs.logL(), logL, 1.0e-6, "Check likelihood with reloaded events");
+    test_value(GCTAObservation::events_memory(), 0.5 * memory, 1.0e-10,
+               "Check event memory after reloading");
+
+    // Access the events outside an evaluation. The events are loaded but
+    // are no longer memory managed, hence they are not disposed while the
+    // pointers are held.
+    const GEvents* events1 = obs[0]->events();
+    const GEvents* events2 = obs[1]->events();
+    test_value(events1->size(), 4134, "Check events of first run");
+    test_value(events2->size(), 4134, "Check events of second run");
+    test_value(GCTAObservation::events_memory(), 0.0, 1.0e-10,
+               "Check that accessed events are not managed");
+    obs.eval();
+    test_value(events1->size(), 4134, "Check events of first run after evaluation");
+    test_value(events2->size(), 4134, "Check events of second run after evaluation");
+    test_value(GCTAObservation::events_memory(), 0.0, 1.0e-10,
+               "Check that accessed events are not managed after evaluation");
+
+    // Check that events that were set explicitly are not managed
+    GCTAObservation run3;
+    run3.events(*events1);
+    test_value(GCTAObservation::events_memory(), 0.0, 1.0e-10,
+               "Check that explicit events are not managed");
+
+    // Reset memory limit
+    GCTAObservation::events_max_memory(0.0);
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test binned observation handling
  ***************************************************************************/
@@ -1314,6 +2266,35 @@ void TestGCTAObservation::test_cube_obs(void)
         test_try_failure(e);
     }
 
+    // Test bin views against bin access operator
+    GCTAEventCube cube(cta_cntmap);
+    GEventBin*    view = cube.bin_view();
+    int           nbad = 0;
+    for (int i = 0; i < cube.size(); ++i) {
+        const GEventBin* bin = cube.bin(i, view);
+        if (bin->counts() != cube[i]->counts() ||
+            bin->size()   != cube[i]->size()   ||
+            bin->energy() != cube[i]->energy()) {
+            nbad++;
+        }
+    }
+    delete view;
+    test_value(nbad, 0, "Check event bin views");
+
+    // Test concurrent bin access using one bin view per thread
+    double sum = 0.0;
+    #pragma omp parallel reduction(+:sum)
+    {
+        GEventBin* thread_view = cube.bin_view();
+        #pragma omp for
+        for (int i = 0; i < cube.size(); ++i) {
+            sum += cube.bin(i, thread_view)->counts();
+        }
+        delete thread_view;
+    }
+    test_value(sum, double(cube.number()), 1.0e-6,
+               "Check concurrent event bin access");
+
     // Test XML loading and saving
     test_try("Test XML loading and saving");
     try {
@@ -1325,12 +2306,258 @@ void TestGCTAObservation::test_cube_obs(void)
         test_try_failure(e);
     }
 
+    // Test concurrent evaluation of the cube response
+    if (obs.size() > 0) {
+        const GCTAObservation*  cta =
+              static_cast<const GCTAObservation*>(obs[0]);
+        const GCTAResponseCube* rsp =
+              static_cast<const GCTAResponseCube*>(cta->response());
+        test_assert(cta->is_threadsafe(),
+                    "Check that cube-style observation is thread safe");
+        const GSkymap&      map = rsp->exposure().cube();
+        GEnergy             energy(1.0, "TeV");
+        std::vector<double> ref(map.npix());
+        for (int i = 0; i < map.npix(); ++i) {
+            GSkyDir dir = map.inx2dir(i);
+            ref[i]      = rsp->exposure()(dir, energy) *
+                          rsp->psf()(dir, 0.001, energy) +
+                          rsp->background()(GCTAInstDir(dir), energy);
+        }
+        int nbad = 0;
+        #pragma omp parallel for reduction(+:nbad)
+        for (int i = 0; i < map.npix(); ++i) {
+            GSkyDir dir   = map.inx2dir(i);
+            double  value = rsp->exposure()(dir, energy) *
+                            rsp->psf()(dir, 0.001, energy) +
+                            rsp->background()(GCTAInstDir(dir), energy);
+            if (value != ref[i]) {
+                nbad++;
+            }
+        }
+        test_value(nbad, 0, "Check concurrent evaluation of cube response");
+    }
+
     // Exit test
     return;
  
 }
 
 
+/***********************************************************************//**
+ * @brief Test event list
+ *
+ * Tests the column-wise storage of the event list by appending events,
+ * reading them back through the access operators and modifying events
+ * through the event atom views. Also tests the deferred reading of the
+ * optional columns and the reading of event files by memory mapping.
+ ***************************************************************************/
+void TestGCTAObservation::test_event_list(void)
+{
+    // Setup event list
+    GCTAEventList list;
+    for (int i = 0; i < 3; ++i) {
+        GCTAInstDir dir;
+        dir.dir().radec_deg(83.0+i, 22.0-i);
+        dir.detx(0.001*i);
+        dir.dety(-0.002*i);
+        GCTAEventAtom event;
+        event.dir(dir);
+        event.energy(GEnergy(1.0+i, "TeV"));
+        event.time(GTime(100.0*i));
+        event.event_id(i+1);
+        if (i == 2) {
+            event.phase(0.25);
+        }
+        list.append(event);
+    }
+    test_value(list.size(), 3, "Check number of events");
+
+    // Check events
+    const GCTAEventList& clist = list;
+    for (int i = 0; i < 3; ++i) {
+        const GCTAEventAtom* event = clist[i];
+        test_value(event->index(), i, "Check event index");
+        test_value(event->dir().dir().ra_deg(), 83.0+i, 1.0e-10,
+                   "Check event Right Ascension");
+        test_value(event->dir().dir().dec_deg(), 22.0-i, 1.0e-10,
+                   "Check event Declination");
+        test_value(event->dir().detx(), 0.001*i, 1.0e-12,
+                   "Check event DETX");
+        test_value(event->dir().dety(), -0.002*i, 1.0e-12,
+                   "Check event DETY");
+        test_value(event->energy().TeV(), 1.0+i, 1.0e-10,
+                   "Check event energy");
+        test_value(event->time().secs(), 100.0*i, 1.0e-10,
+                   "Check event time");
+        test_assert(event->event_id() == (unsigned long)(i+1),
+                    "Check event identifier");
+        test_value(event->phase(), (i == 2) ? 0.25 : 0.0, 1.0e-7,
+                   "Check event phase");
+    }
+
+    // Modify an event through the event atom view and check that the
+    // modification survives access to another event and copying
+    list[1]->energy(GEnergy(5.0, "TeV"));
+    test_value(list[0]->energy().TeV(), 1.0, 1.0e-10,
+               "Check energy of unmodified event");
+    test_value(list[1]->energy().TeV(), 5.0, 1.0e-10,
+               "Check energy of modified event");
+    list[2]->energy(GEnergy(7.0, "TeV"));
+    GCTAEventList copy = list;
+    test_value(copy[2]->energy().TeV(), 7.0, 1.0e-10,
+               "Check energy of modified event in copy");
+
+    // Check that event atom views of different events do not alias and
+    // remain valid while other events are accessed
+    GCTAEventAtom*       event0  = list[0];
+    GCTAEventAtom*       event1  = list[1];
+    const GCTAEventAtom* cevent0 = clist[0];
+    test_assert(event0 != event1, "Check that event atom views do not alias");
+    test_assert(event0 == cevent0, "Check that event atom views are stable");
+    test_value(event0->energy().TeV(), 1.0, 1.0e-10,
+               "Check energy of first view after access to second view");
+    event0->energy(GEnergy(3.0, "TeV"));
+    event1->energy(GEnergy(4.0, "TeV"));
+    test_value(list[0]->energy().TeV(), 3.0, 1.0e-10,
+               "Check energy of first modified view");
+    test_value(list[1]->energy().TeV(), 4.0, 1.0e-10,
+               "Check energy of second modified view");
+    GCTAEventList copy2 = list;
+    test_value(copy2[0]->energy().TeV(), 3.0, 1.0e-10,
+               "Check energy of first modified view in copy");
+    test_value(copy2[1]->energy().TeV(), 4.0, 1.0e-10,
+               "Check energy of second modified view in copy");
+
+    // Check that events can be read through caller owned event atom views
+    // without modifying the event list
+    GEventAtom* view = clist.atom_view();
+    for (int i = 0; i < 3; ++i) {
+        const GCTAEventAtom* event = clist.atom(i, view);
+        test_value(event->index(), i, "Check index of event atom view");
+        test_value(event->dir().dir().ra_deg(), 83.0+i, 1.0e-10,
+                   "Check Right Ascension of event atom view");
+        test_value(event->energy().TeV(), clist[i]->energy().TeV(), 1.0e-10,
+                   "Check energy of event atom view");
+    }
+    delete view;
+
+    // Check IRF cache
+    test_value(list.irf_cache("Model1", 1), -1.0, 1.0e-10,
+               "Check IRF cache of unknown model");
+    list.irf_cache("Model1", 1, 3.0);
+    test_value(list.irf_cache("Model1", 1), -1.0, 1.0e-10,
+               "Check that no IRF cache value is stored without key");
+    std::vector<double> key(1, 1.0);
+    list.irf_cache_key("Model1", key);
+    list.irf_cache("Model1", 1, 3.0);
+    test_value(list.irf_cache("Model1", 1), 3.0, 1.0e-10,
+               "Check IRF cache value");
+    test_value(list.irf_cache("Model1", 0), -1.0, 1.0e-10,
+               "Check IRF cache value that was not set");
+    double mbytes = list.size() * sizeof(double) / 1048576.0;
+    test_value(list.irf_cache_memory(), mbytes, 1.0e-10,
+               "Check IRF cache memory");
+
+    // Check that the least recently used IRF cache is evicted once the
+    // memory limit is reached
+    list.irf_cache_max_memory(1.5 * mbytes);
+    list.irf_cache_key("Model2", key);
+    list.irf_cache("Model2", 1, 4.0);
+    test_value(list.irf_cache("Model2", 1), 4.0, 1.0e-10,
+               "Check IRF cache value of second model");
+    test_value(list.irf_cache("Model1", 1), -1.0, 1.0e-10,
+               "Check that IRF cache of first model was evicted");
+    test_value(list.irf_cache_memory(), mbytes, 1.0e-10,
+               "Check IRF cache memory after eviction");
+
+    // Check that released IRF cache keys disable the IRF cache values
+    // until the same key is set again
+    list.irf_cache_release();
+    test_value(list.irf_cache("Model2", 1), -1.0, 1.0e-10,
+               "Check that IRF cache is not used after releasing the key");
+    list.irf_cache_key("Model2", key);
+    test_value(list.irf_cache("Model2", 1), 4.0, 1.0e-10,
+               "Check that IRF cache is kept for an unchanged key");
+
+    // Check that a modified key invalidates the IRF cache values
+    list.irf_cache_key("Model2", std::vector<double>(1, 2.0));
+    test_value(list.irf_cache("Model2", 1), -1.0, 1.0e-10,
+               "Check that IRF cache is invalidated by a modified key");
+    list.irf_cache("Model2", 1, 4.0);
+
+    // Check IRF cache values for true energy nodes
+    list.irf_cache_max_memory(100.0);
+    list.irf_cache_key("Model3", key, 10, 3);
+    list.irf_cache_node("Model3", 1, 11, 5.0);
+    list.irf_cache_node("Model3", 1, 13, 6.0);
+    test_value(list.irf_cache_node("Model3", 1, 11), 5.0, 1.0e-10,
+               "Check IRF cache value of true energy node");
+    test_value(list.irf_cache_node("Model3", 1, 12), -1.0, 1.0e-10,
+               "Check IRF cache value of true energy node that was not set");
+    test_value(list.irf_cache_node("Model3", 1, 13), -1.0, 1.0e-10,
+               "Check that no IRF cache value is stored outside node range");
+    test_value(list.irf_cache_node("Model3", 0, 11), -1.0, 1.0e-10,
+               "Check IRF cache value of true energy node of other event");
+    test_value(list.irf_cache_memory(), 4.0 * mbytes, 1.0e-10,
+               "Check IRF cache memory with true energy nodes");
+    list.irf_cache_key("Model3", key, 11, 3);
+    test_value(list.irf_cache_node("Model3", 1, 11), -1.0, 1.0e-10,
+               "Check that IRF cache is invalidated by a modified node range");
+
+    // Check that appending an event clears the IRF cache
+    list.append(GCTAEventAtom());
+    test_value(list.irf_cache("Model2", 1), -1.0, 1.0e-10,
+               "Check that IRF cache is cleared when appending events");
+
+    // Check that the optional columns of events loaded from a file are
+    // only read when an event is accessed, also for a copy of the list
+    GCTAEventList loaded(cta_events);
+    GCTAEventList loaded_copy = loaded;
+    double        mandatory   = loaded.memory();
+    GCTAEventAtom first       = *(loaded[0]);
+    test_assert(loaded.memory() > mandatory,
+                "Check that optional columns are read on first access");
+    test_value(loaded_copy.memory(), mandatory, 1.0e-10,
+               "Check that optional columns of copy are not yet read");
+    test_value(loaded_copy[0]->energy().MeV(), first.energy().MeV(), 1.0e-6,
+               "Check event of copy");
+    test_value(loaded_copy.memory(), loaded.memory(), 1.0e-10,
+               "Check that optional columns of copy are read on access");
+
+    // Check that events read by memory mapping an uncompressed event file
+    // are identical to events read using cfitsio
+    loaded.save("test_cta_events_mmap.fits", true);
+    GCTAEventList list_cfitsio;
+    GCTAEventList list_mmap;
+    list_cfitsio.use_mmap(false);
+    list_cfitsio.load("test_cta_events_mmap.fits");
+    list_mmap.load("test_cta_events_mmap.fits");
+    test_assert(list_mmap.use_mmap(), "Check that memory mapping is enabled");
+    test_assert(!list_cfitsio.use_mmap(), "Check that memory mapping is disabled");
+    test_value(list_mmap.size(), list_cfitsio.size(),
+               "Check number of memory mapped events");
+    int mismatch = 0;
+    for (int i = 0; i < list_mmap.size(); ++i) {
+        const GCTAEventAtom* event_mmap    = list_mmap[i];
+        const GCTAEventAtom* event_cfitsio = list_cfitsio[i];
+        if (event_mmap->dir().dir().ra()  != event_cfitsio->dir().dir().ra()  ||
+            event_mmap->dir().dir().dec() != event_cfitsio->dir().dir().dec() ||
+            event_mmap->dir().detx()      != event_cfitsio->dir().detx()      ||
+            event_mmap->dir().dety()      != event_cfitsio->dir().dety()      ||
+            event_mmap->energy().MeV()    != event_cfitsio->energy().MeV()    ||
+            event_mmap->time().secs()     != event_cfitsio->time().secs()     ||
+            event_mmap->event_id()        != event_cfitsio->event_id()        ||
+            event_mmap->obs_id()          != event_cfitsio->obs_id()) {
+            mismatch++;
+        }
+    }
+    test_value(mismatch, 0, "Check that memory mapped events are identical");
+
+    // Exit test
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Test unbinned optimizer
  ***************************************************************************/
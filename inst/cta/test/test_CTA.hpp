@@ -50,6 +50,7 @@ public:
     virtual std::string       classname(void) const { return "TestGCTAResponse"; }
     void                      test_response(void);
     void                      test_response_aeff(void);
+    void                      test_response_table(void);
     void                      test_response_psf(void);
     void                      test_response_psf_king(void);
     void                      test_response_npsf(void);
@@ -57,19 +58,33 @@ public:
     void                      test_response_edisp_PerfTable(void);
     void                      test_response_edisp_RMF(void);
     void                      test_response_edisp_2D(void);
+    void                      test_response_edisp_convolve(void);
     void                      test_response_irf_diffuse(void);
     void                      test_response_npred_diffuse(void);
+    void                      test_response_irf_gradients(void);
+    void                      test_response_irf_gauss_legendre(void);
+    void                      test_response_irf_cache(void);
+    void                      test_response_npred_gradients(void);
+    void                      test_response_nroi_cache(void);
     void                      test_response_expcube(void);
     void                      test_response_psfcube(void);
     void                      test_response_bkgcube(void);
+    void                      test_response_cube_fill(void);
 
     // Utility methods
+    void test_irf_gradients(const GCTAResponseIrf& rsp,
+                            const GCTAObservation& obs,
+                            const GEvent&          event,
+                            GModelSpatial*         model,
+                            const std::string&     name);
     void test_response_edisp_integration(const GCTAResponseIrf& rsp,
                                          const double&          e_src_min = 0.1,
                                          const double&          e_src_max = 10.0);
     void test_edisp_integration(const GCTAEdisp& edisp,
                                 const double&    e_src_min = 0.1,
                                 const double&    e_src_max = 10.0);
+    void test_psf_batch(const GCTAPsf& psf);
+    void test_edisp_batch(const GCTAEdisp& edisp);
 };
 
 
@@ -115,6 +130,8 @@ public:
     void                         test_unbinned_obs(void);
     void                         test_binned_obs(void);
     void                         test_cube_obs(void);
+    void                         test_event_list(void);
+    void                         test_event_memory(void);
 };
 
 
@@ -30,6 +30,7 @@
 /* __ Includes ___________________________________________________________ */
 #include <string>
 #include <vector>
+#include <map>
 #include "GEventCube.hpp"
 #include "GLATInstDir.hpp"
 #include "GLATEventBin.hpp"
@@ -76,6 +77,10 @@ public:
     virtual int            number(void) const;
     virtual std::string    print(const GChatter& chatter = NORMAL) const;
 
+    // Implemented virtual base class methods
+    virtual GLATEventBin*       bin_view(void) const;
+    virtual const GLATEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     void              time(const GTime& time);
     void              map(const GSkymap& map);
@@ -91,8 +96,10 @@ public:
     int               ebins(void) const;
     int               ndiffrsp(void) const;
     std::string       diffname(const int& index) const;
+    int               diffindex(const std::string& name) const;
     GSkymap*          diffrsp(const int& index) const;
     double            maxrad(const GSkyDir& dir) const;
+    const GNodeArray::weights& eweights(const int& ieng) const;
 
 protected:
     // Protected methods
@@ -106,20 +113,23 @@ protected:
     void         set_directions(void);
     virtual void set_energies(void);
     virtual void set_times(void);
-    void         set_bin(const int& index);
+    void         set_eweights(void);
+    void         set_bin(const int& index, GLATEventBin* bin) const;
 
     // Protected data area
-    GLATEventBin             m_bin;          //!< Actual energy bin
-    GSkymap                  m_map;          //!< Counts map stored as sky map
-    GTime                    m_time;         //!< Event cube mean time
-    double                   m_ontime;       //!< Event cube ontime (sec)
-    std::vector<GLATInstDir> m_dirs;         //!< Array of event directions
-    std::vector<double>      m_solidangle;   //!< Array of solid angles (sr)
-    std::vector<GEnergy>     m_energies;     //!< Array of log mean energies
-    std::vector<GEnergy>     m_ewidth;       //!< Array of energy bin widths
-    std::vector<GSkymap*>    m_srcmap;       //!< Pointers to source maps
-    std::vector<std::string> m_srcmap_names; //!< Source map names
-    GNodeArray               m_enodes;       //!< Energy nodes
+    GLATEventBin                     m_bin;          //!< Actual energy bin
+    GSkymap                          m_map;          //!< Counts map stored as sky map
+    GTime                            m_time;         //!< Event cube mean time
+    double                           m_ontime;       //!< Event cube ontime (sec)
+    std::vector<GLATInstDir>         m_dirs;         //!< Array of event directions
+    std::vector<double>              m_solidangle;   //!< Array of solid angles (sr)
+    std::vector<GEnergy>             m_energies;     //!< Array of log mean energies
+    std::vector<GEnergy>             m_ewidth;       //!< Array of energy bin widths
+    std::vector<GSkymap*>            m_srcmap;       //!< Pointers to source maps
+    std::vector<std::string>         m_srcmap_names; //!< Source map names
+    std::map<std::string,int>        m_srcmap_index; //!< Source map indices
+    GNodeArray                       m_enodes;       //!< Energy nodes
+    std::vector<GNodeArray::weights> m_eweights;     //!< Energy node weights of bins
 };
 
 
@@ -157,6 +167,7 @@ inline
 void GLATEventCube::enodes(const GNodeArray& enodes)
 {
     m_enodes = enodes;
+    set_eweights();
     return;
 }
 
@@ -281,4 +292,21 @@ int GLATEventCube::ndiffrsp(void) const
     return m_srcmap.size();
 }
 
+
+/***********************************************************************//**
+ * @brief Return energy node weights of energy layer
+ *
+ * @param[in] ieng Energy layer index [0,...,ebins()-1].
+ * @return Energy node indices and weighting factors.
+ *
+ * Returns the indices and weighting factors of the energy nodes for the
+ * mean energy of the energy layer @p ieng. The weights are used for the
+ * interpolation of source maps at the energy of an event bin.
+ ***************************************************************************/
+inline
+const GNodeArray::weights& GLATEventCube::eweights(const int& ieng) const
+{
+    return m_eweights[ieng];
+}
+
 #endif /* GLATEVENTCUBE_HPP */
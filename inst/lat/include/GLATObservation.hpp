@@ -69,6 +69,13 @@ public:
     virtual void                write(GXmlElement& xml) const;
     virtual std::string         print(const GChatter& chatter = NORMAL) const;
 
+    // Overloaded virtual base class methods
+    virtual double              likelihood(const GModels&    models,
+                                           GVector*          gradient,
+                                           GMatrixSymmetric* curvature,
+                                           double*           npred) const;
+    virtual bool                is_threadsafe(void) const;
+
     // Other methods
     void              load_unbinned(const std::string& ft1name,
                                     const std::string& ft2name,
@@ -30,6 +30,7 @@
 /* __ Includes ___________________________________________________________ */
 #include <vector>
 #include <string>
+#include <map>
 #include "GLATEventAtom.hpp"
 #include "GLATEventBin.hpp"
 #include "GLATAeff.hpp"
@@ -43,12 +44,21 @@
 
 /* __ Forward declarations _______________________________________________ */
 class GSource;
+class GModels;
+class GLATObservation;
 
 
 /***********************************************************************//**
  * @class GLATResponse
  *
  * @brief Fermi/LAT Response class
+ *
+ * The response of point sources is computed from mean PSFs that are
+ * allocated once per source and looked up by source name. Before event
+ * bins are evaluated concurrently the mean PSFs should be allocated using
+ * the meanpsfs() method, so that the irf() methods only read the mean PSF
+ * table. Mean PSFs that are missing within a parallel region are computed
+ * as temporaries and are not added to the table.
  ***************************************************************************/
 class GLATResponse : public GResponse {
 
@@ -92,6 +102,8 @@ public:
     GLATAeff*          aeff(const int& index) const;
     GLATPsf*           psf(const int& index) const;
     GLATEdisp*         edisp(const int& index) const;
+    void               meanpsfs(const GModels&          models,
+                                const GLATObservation& obs) const;
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -106,6 +118,10 @@ private:
     void init_members(void);
     void copy_members(const GLATResponse& rsp);
     void free_members(void);
+    const GLATMeanPsf* meanpsf(const std::string& name) const;
+    const GLATMeanPsf* meanpsf(const std::string&     name,
+                               const GSkyDir&         dir,
+                               const GLATObservation& obs) const;
 
     // Private members
     std::string               m_caldb;      //!< Name of or path to the calibration database
@@ -117,6 +133,7 @@ private:
     std::vector<GLATPsf*>     m_psf;        //!< Point spread functions
     std::vector<GLATEdisp*>   m_edisp;      //!< Energy dispersions
     std::vector<GLATMeanPsf*> m_ptsrc;      //!< Mean PSFs for point sources
+    std::map<std::string,int> m_ptsrc_index; //!< Mean PSF indices
 };
 
 
@@ -28,6 +28,9 @@
 #include "GLATEventCube.hpp"
 %}
 
+/* __ Returned event bin views are owned by the caller ___________________ */
+%newobject GLATEventCube::bin_view;
+
 
 /***********************************************************************//**
  * @class GLATEventCube
@@ -57,6 +60,10 @@ public:
     virtual void           write(GFits& file) const;
     virtual int            number(void) const;
 
+    // Implemented virtual base class methods
+    virtual GLATEventBin*       bin_view(void) const;
+    virtual const GLATEventBin* bin(const int& index, GEventBin* view) const;
+
     // Other methods
     void              time(const GTime& time);
     void              map(const GSkymap& map);
@@ -72,6 +79,7 @@ public:
     int               ebins(void) const;
     int               ndiffrsp(void) const;
     std::string       diffname(const int& index) const;
+    int               diffindex(const std::string& name) const;
     GSkymap*          diffrsp(const int& index) const;
     double            maxrad(const GSkyDir& dir) const;
 };
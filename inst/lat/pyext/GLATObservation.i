@@ -54,6 +54,13 @@ public:
     virtual void                read(const GXmlElement& xml);
     virtual void                write(GXmlElement& xml) const;
 
+    // Overloaded virtual base class methods
+    virtual double              likelihood(const GModels&    models,
+                                           GVector*          gradient,
+                                           GMatrixSymmetric* curvature,
+                                           double*           npred) const;
+    virtual bool                is_threadsafe(void) const;
+
     // Other methods
     void              load_unbinned(const std::string& ft1name,
                                     const std::string& ft2name,
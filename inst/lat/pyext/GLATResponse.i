@@ -71,6 +71,8 @@ public:
     GLATAeff*          aeff(const int& index) const;
     GLATPsf*           psf(const int& index) const;
     GLATEdisp*         edisp(const int& index) const;
+    void               meanpsfs(const GModels&          models,
+                                const GLATObservation& obs) const;
 
     // Reponse methods
     double irf(const GLATEventAtom& event,
@@ -42,7 +42,8 @@
 #define G_SET_DIRECTIONS                    "GLATEventCube::set_directions()"
 #define G_SET_ENERGIES                        "GLATEventCube::set_energies()"
 #define G_SET_TIMES                              "GLATEventCube::set_times()"
-#define G_SET_BIN                              "GLATEventCube::set_bin(int&)"
+#define G_BIN                          "GLATEventCube::bin(int&, GEventBin*)"
+#define G_SET_BIN               "GLATEventCube::set_bin(int&, GLATEventBin*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -168,7 +169,7 @@ GLATEventCube& GLATEventCube::operator= (const GLATEventCube& cube)
 GLATEventBin* GLATEventCube::operator[](const int& index)
 {
     // Set event bin
-    set_bin(index);
+    set_bin(index, &m_bin);
 
     // Return pointer
     return (&m_bin);
@@ -186,7 +187,7 @@ GLATEventBin* GLATEventCube::operator[](const int& index)
 const GLATEventBin* GLATEventCube::operator[](const int& index) const
 {
     // Set event bin (circumvent const correctness)
-    const_cast<GLATEventCube*>(this)->set_bin(index);
+    set_bin(index, const_cast<GLATEventBin*>(&m_bin));
 
     // Return pointer
     return (&m_bin);
@@ -460,6 +461,54 @@ void GLATEventCube::map(const GSkymap& map)
 }
 
 
+/***********************************************************************//**
+ * @brief Allocate event bin view
+ *
+ * @return Pointer to event bin view.
+ *
+ * Allocates an event bin view that can be passed to the bin() method. The
+ * caller is responsible for deleting the view.
+ ***************************************************************************/
+GLATEventBin* GLATEventCube::bin_view(void) const
+{
+    // Return
+    return (new GLATEventBin);
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin for concurrent access
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event bin view allocated by bin_view().
+ * @return Pointer to event bin view.
+ *
+ * @exception GException::invalid_argument
+ *            Event bin view is not a LAT event bin.
+ *
+ * Sets up the pointers of the event bin @p view so that it refers to the
+ * bin with the specified @p index. Contrary to the bin access operator the
+ * event cube is not modified, hence several threads may access the bins
+ * concurrently as long as each thread uses its own @p view.
+ ***************************************************************************/
+const GLATEventBin* GLATEventCube::bin(const int& index, GEventBin* view) const
+{
+    // Get LAT event bin view
+    GLATEventBin* bin = dynamic_cast<GLATEventBin*>(view);
+    if (bin == NULL) {
+        std::string msg = "Event bin view is not a LAT event bin. Please "
+                          "allocate the view using the bin_view() method.";
+        throw GException::invalid_argument(G_BIN, msg);
+    }
+
+    // Set event bin view
+    set_bin(index, bin);
+
+    // Return pointer
+    return bin;
+}
+
+
 /***********************************************************************//**
  * @brief Print event cube information
  *
@@ -564,6 +613,33 @@ std::string GLATEventCube::diffname(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Return index of diffuse model
+ *
+ * @param[in] name Name of diffuse model.
+ * @return Diffuse model index [0,...,ndiffrsp()-1] (-1 if not found).
+ *
+ * Returns the index of the source map for the diffuse model with the
+ * specified @p name. The index is looked up in a table that is set up when
+ * the source maps are read, hence the method does not perform any string
+ * copies or memory allocations.
+ ***************************************************************************/
+int GLATEventCube::diffindex(const std::string& name) const
+{
+    // Initialise index
+    int index = -1;
+
+    // Search source map
+    std::map<std::string,int>::const_iterator it = m_srcmap_index.find(name);
+    if (it != m_srcmap_index.end()) {
+        index = it->second;
+    }
+
+    // Return index
+    return index;
+}
+
+
 /***********************************************************************//**
  * @brief Return diffuse response map
  *
@@ -675,7 +751,9 @@ void GLATEventCube::init_members(void)
     m_time.clear();
     m_srcmap.clear();
     m_srcmap_names.clear();
+    m_srcmap_index.clear();
     m_enodes.clear();
+    m_eweights.clear();
     m_dirs.clear();
     m_solidangle.clear();
     m_energies.clear(); 
@@ -700,6 +778,7 @@ void GLATEventCube::copy_members(const GLATEventCube& cube)
     m_time         = cube.m_time;
     m_ontime       = cube.m_ontime;
     m_enodes       = cube.m_enodes;
+    m_eweights     = cube.m_eweights;
     m_dirs         = cube.m_dirs;
     m_solidangle   = cube.m_solidangle;
     m_energies     = cube.m_energies;
@@ -711,6 +790,7 @@ void GLATEventCube::copy_members(const GLATEventCube& cube)
         m_srcmap.push_back(cube.m_srcmap[i]->clone());
     }
     m_srcmap_names = cube.m_srcmap_names;
+    m_srcmap_index = cube.m_srcmap_index;
 
     // Return
     return;
@@ -729,6 +809,7 @@ void GLATEventCube::free_members(void)
     }
     m_srcmap.clear();
     m_srcmap_names.clear();
+    m_srcmap_index.clear();
 
     // Return
     return;
@@ -795,7 +876,8 @@ void GLATEventCube::read_srcmap(const GFitsImage& hdu)
         throw GLATException::wcs_incompatible(G_READ_SRCMAP, hdu.extname());
     }
 
-    // Append source map to list of maps
+    // Append source map to list of maps and store index of source map
+    m_srcmap_index[hdu.extname()] = m_srcmap.size();
     m_srcmap.push_back(map);
     m_srcmap_names.push_back(hdu.extname());
 
@@ -922,12 +1004,40 @@ void GLATEventCube::set_energies(void)
         m_enodes.append(log10(ebounds().emin(i).MeV()));
     }
     m_enodes.append(log10(ebounds().emax(ebins()-1).MeV()));
+
+    // Set energy node weights of bin energies
+    set_eweights();
     
     // Return
     return;
 }
 
 
+/***********************************************************************//**
+ * @brief Set energy node weights of bin energies
+ *
+ * Sets for each energy layer the indices and weighting factors of the
+ * energy nodes at the mean energy of the layer. This avoids locating the
+ * energy nodes for each event bin when source maps are interpolated.
+ ***************************************************************************/
+void GLATEventCube::set_eweights(void)
+{
+    // Clear energy node weights
+    m_eweights.clear();
+
+    // Set energy node weights if energy nodes are available
+    if (m_enodes.size() > 0) {
+        m_eweights.reserve(m_energies.size());
+        for (int i = 0; i < m_energies.size(); ++i) {
+            m_eweights.push_back(m_enodes.locate(m_energies[i].log10MeV()));
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set mean event time and ontime of event cube.
  *
@@ -965,6 +1075,7 @@ void GLATEventCube::set_times(void)
  * @brief Set event bin
  *
  * @param[in] index Event index [0,...,size()-1].
+ * @param[in] bin Event bin.
  *
  * @exception GException::out_of_range
  *            Event index is outside valid range.
@@ -973,13 +1084,14 @@ void GLATEventCube::set_times(void)
  * @exception GLATException::no_dirs
  *            Sky directions and solid angles vectors have not been set up.
  *
- * This method provides the event attributes to the event bin. The event bin
- * is in fact physically stored in the event cube, and only a single event
- * bin is indeed allocated. This method sets up the pointers in the event
- * bin so that a client can easily access the information of individual bins
- * as if they were stored in an array.
+ * This method provides the event attributes to the event @p bin. The event
+ * bin is in fact physically stored in the event cube. This method sets up
+ * the pointers in the event @p bin so that a client can easily access the
+ * information of individual bins as if they were stored in an array. The
+ * event cube is not modified, hence the method may be called concurrently
+ * for different event bins.
  ***************************************************************************/
-void GLATEventCube::set_bin(const int& index)
+void GLATEventCube::set_bin(const int& index, GLATEventBin* bin) const
 {
     // Optionally check if the index is valid
     #if defined(G_RANGE_CHECK)
@@ -999,19 +1111,19 @@ void GLATEventCube::set_bin(const int& index)
     }
 
     // Get pixel and energy bin indices.
-    m_bin.m_index = index;
-    m_bin.m_ipix  = index % npix();
-    m_bin.m_ieng  = index / npix();
+    bin->m_index = index;
+    bin->m_ipix  = index % npix();
+    bin->m_ieng  = index / npix();
 
     // Set pointers
-    m_bin.m_cube       = this;
-    m_bin.m_counts     = const_cast<double*>(&(m_map.pixels()[index]));
-    m_bin.m_energy     = &(m_energies[m_bin.m_ieng]);
-    m_bin.m_time       = &m_time;
-    m_bin.m_dir        = &(m_dirs[m_bin.m_ipix]);
-    m_bin.m_solidangle = &(m_solidangle[m_bin.m_ipix]);
-    m_bin.m_ewidth     = &(m_ewidth[m_bin.m_ieng]);
-    m_bin.m_ontime     = &m_ontime;
+    bin->m_cube       = const_cast<GLATEventCube*>(this);
+    bin->m_counts     = const_cast<double*>(&(m_map.pixels()[index]));
+    bin->m_energy     = const_cast<GEnergy*>(&(m_energies[bin->m_ieng]));
+    bin->m_time       = const_cast<GTime*>(&m_time);
+    bin->m_dir        = const_cast<GLATInstDir*>(&(m_dirs[bin->m_ipix]));
+    bin->m_solidangle = const_cast<double*>(&(m_solidangle[bin->m_ipix]));
+    bin->m_ewidth     = const_cast<GEnergy*>(&(m_ewidth[bin->m_ieng]));
+    bin->m_ontime     = const_cast<double*>(&m_ontime);
 
     // Return
     return;
@@ -172,7 +172,7 @@ GLATMeanPsf& GLATMeanPsf::operator=(const GLATMeanPsf& psf)
  * A zero value is returned if the offset angle is equal or larger than
  * 70 degrees or if \f$\log E\f$ is not positive.
  ***************************************************************************/
-double GLATMeanPsf::operator() (const double& offset, const double& logE)
+double GLATMeanPsf::operator() (const double& offset, const double& logE) const
 {
     // Initialise response
     double value = 0.0;
@@ -180,58 +180,29 @@ double GLATMeanPsf::operator() (const double& offset, const double& logE)
     // Continue only if arguments are within valid range
     if (offset < 70.0 && logE > 0.0) {
 
-        // Flag no change of values
-        //bool change = false;
-
-        // Set offset interpolation
-        //if (offset != m_last_offset) {
-            m_offset.set_value(offset);
-        //    m_last_offset = offset;
-        //    change        = true;
-        //}
-
-        // Set energy interpolation
-        //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
-        //    m_last_energy = logE;
-        //    change        = true;
-        //}
-
-        // If change occured then update interpolation indices and weighting
-        // factors
-        //if (change) {
-
-            // Set energy indices for exposure computation
-            m_inx1_exp = m_energy.inx_left();
-            m_inx2_exp = m_energy.inx_right();
-
-            // Set energy indices for PSF computation
-            int inx_energy_left  = m_inx1_exp  * noffsets();
-            int inx_energy_right = m_inx2_exp * noffsets();
-            
-            // Set array indices for bi-linear interpolation
-            m_inx1 = m_offset.inx_left()  + inx_energy_left;
-            m_inx2 = m_offset.inx_left()  + inx_energy_right;
-            m_inx3 = m_offset.inx_right() + inx_energy_left;
-            m_inx4 = m_offset.inx_right() + inx_energy_right;
+        // Get offset and energy interpolation indices and weighting factors.
+        // The locate() method does not modify the node arrays, hence the
+        // operator may be called concurrently.
+        GNodeArray::weights woff = m_offset.locate(offset);
+        GNodeArray::weights weng = m_energy.locate(logE);
 
-            // Set weighting factors for bi-linear interpolation
-            m_wgt1 = m_offset.wgt_left()  * m_energy.wgt_left();
-            m_wgt2 = m_offset.wgt_left()  * m_energy.wgt_right();
-            m_wgt3 = m_offset.wgt_right() * m_energy.wgt_left();
-            m_wgt4 = m_offset.wgt_right() * m_energy.wgt_right();
-
-        //} // endif: logE or ctheta changed
+        // Set energy indices for PSF computation
+        int inx_energy_left  = weng.inx_left  * noffsets();
+        int inx_energy_right = weng.inx_right * noffsets();
 
         // Compute energy dependent exposure and map corrections
-        double fac_left  = m_exposure[m_inx1_exp] * m_mapcorr[m_inx1_exp];
-        double fac_right = m_exposure[m_inx2_exp] * m_mapcorr[m_inx2_exp];
+        double fac_left  = m_exposure[weng.inx_left]  * m_mapcorr[weng.inx_left];
+        double fac_right = m_exposure[weng.inx_right] * m_mapcorr[weng.inx_right];
 
         // Perform bi-linear interpolation
-        value = m_wgt1 * m_psf[m_inx1] * fac_left  +
-                m_wgt2 * m_psf[m_inx2] * fac_right +
-                m_wgt3 * m_psf[m_inx3] * fac_left  +
-                m_wgt4 * m_psf[m_inx4] * fac_right;
+        value = woff.wgt_left  * weng.wgt_left  *
+                m_psf[woff.inx_left  + inx_energy_left]  * fac_left  +
+                woff.wgt_left  * weng.wgt_right *
+                m_psf[woff.inx_left  + inx_energy_right] * fac_right +
+                woff.wgt_right * weng.wgt_left  *
+                m_psf[woff.inx_right + inx_energy_left]  * fac_left  +
+                woff.wgt_right * weng.wgt_right *
+                m_psf[woff.inx_right + inx_energy_right] * fac_right;
 
         // Optionally check for negative values
         #if defined(G_SIGNAL_NEGATIVE_MEAN_PSF)
@@ -416,16 +387,16 @@ double GLATMeanPsf::psf(const double& offset, const double& logE)
         // Flag no change of values
         //bool change = false;
 
-        // Set offset interpolation
+        // Get offset interpolation
         //if (offset != m_last_offset) {
-            m_offset.set_value(offset);
+            GNodeArray::weights w_offset = m_offset.locate(offset);
         //    m_last_offset = offset;
         //    change        = true;
         //}
 
-        // Set energy interpolation
+        // Get energy interpolation
         //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
+            GNodeArray::weights w_energy = m_energy.locate(logE);
         //    m_last_energy = logE;
         //    change        = true;
         //}
@@ -435,24 +406,24 @@ double GLATMeanPsf::psf(const double& offset, const double& logE)
         //if (change) {
 
             // Set energy indices for exposure computation
-            m_inx1_exp = m_energy.inx_left();
-            m_inx2_exp = m_energy.inx_right();
+            m_inx1_exp = w_energy.inx_left;
+            m_inx2_exp = w_energy.inx_right;
 
             // Set energy indices
-            int inx_energy_left  = m_energy.inx_left()  * noffsets();
-            int inx_energy_right = m_energy.inx_right() * noffsets();
+            int inx_energy_left  = w_energy.inx_left  * noffsets();
+            int inx_energy_right = w_energy.inx_right * noffsets();
             
             // Set array indices for bi-linear interpolation
-            m_inx1 = m_offset.inx_left()  + inx_energy_left;
-            m_inx2 = m_offset.inx_left()  + inx_energy_right;
-            m_inx3 = m_offset.inx_right() + inx_energy_left;
-            m_inx4 = m_offset.inx_right() + inx_energy_right;
+            m_inx1 = w_offset.inx_left  + inx_energy_left;
+            m_inx2 = w_offset.inx_left  + inx_energy_right;
+            m_inx3 = w_offset.inx_right + inx_energy_left;
+            m_inx4 = w_offset.inx_right + inx_energy_right;
 
             // Set weighting factors for bi-linear interpolation
-            m_wgt1 = m_offset.wgt_left()  * m_energy.wgt_left();
-            m_wgt2 = m_offset.wgt_left()  * m_energy.wgt_right();
-            m_wgt3 = m_offset.wgt_right() * m_energy.wgt_left();
-            m_wgt4 = m_offset.wgt_right() * m_energy.wgt_right();
+            m_wgt1 = w_offset.wgt_left  * w_energy.wgt_left;
+            m_wgt2 = w_offset.wgt_left  * w_energy.wgt_right;
+            m_wgt3 = w_offset.wgt_right * w_energy.wgt_left;
+            m_wgt4 = w_offset.wgt_right * w_energy.wgt_right;
 
         //} // endif: logE or ctheta changed
 
@@ -500,17 +471,17 @@ double GLATMeanPsf::exposure(const double& logE)
     // Continue only if arguments are within valid range
     if (logE > 0.0) {
 
-        // Set energy interpolation
+        // Get energy interpolation
         //if (logE != m_last_energy) {
-            m_energy.set_value(logE);
+            GNodeArray::weights w_energy = m_energy.locate(logE);
         //    m_last_energy = logE;
-            m_inx1_exp    = m_energy.inx_left();
-            m_inx2_exp    = m_energy.inx_right();
+            m_inx1_exp    = w_energy.inx_left;
+            m_inx2_exp    = w_energy.inx_right;
         //}
 
         // Perform linear interpolation
-        value = m_energy.wgt_left()  * m_exposure[m_inx1_exp] +
-                m_energy.wgt_right() * m_exposure[m_inx2_exp];
+        value = w_energy.wgt_left  * m_exposure[m_inx1_exp] +
+                w_energy.wgt_right * m_exposure[m_inx2_exp];
 
     } // endif: arguments were in valid range
 
@@ -777,13 +748,13 @@ void GLATMeanPsf::set_map_corrections(const GLATObservation& obs)
  ***************************************************************************/
 double GLATMeanPsf::integral(const double& offsetmax, const double& logE)
 {
-    // Set energy and offset interpolation weigths
-    m_energy.set_value(logE);
-    m_offset.set_value(offsetmax);
+    // Get energy and offset interpolation weigths
+    GNodeArray::weights w_energy = m_energy.locate(logE);
+    GNodeArray::weights w_offset = m_offset.locate(offsetmax);
 
     // Get PSF array offsets
-    int inx_energy_left  = m_energy.inx_left()  * noffsets();
-    int inx_energy_right = m_energy.inx_right() * noffsets();
+    int inx_energy_left  = w_energy.inx_left  * noffsets();
+    int inx_energy_right = w_energy.inx_right * noffsets();
 
     // Initialise integrals
     double int_left  = 0.0;
@@ -810,10 +781,10 @@ double GLATMeanPsf::integral(const double& offsetmax, const double& logE)
         else {
             double theta_min = m_offset[i] * gammalib::deg2rad;
             double theta_max = offsetmax   * gammalib::deg2rad;
-            double psf_left  = m_psf[inx_energy_left+i]    * m_offset.wgt_left() +
-                               m_psf[inx_energy_left+i+1]  * m_offset.wgt_right();
-            double psf_right = m_psf[inx_energy_right+i]   * m_offset.wgt_left() +
-                               m_psf[inx_energy_right+i+1] * m_offset.wgt_right();                               
+            double psf_left  = m_psf[inx_energy_left+i]    * w_offset.wgt_left +
+                               m_psf[inx_energy_left+i+1]  * w_offset.wgt_right;
+            double psf_right = m_psf[inx_energy_right+i]   * w_offset.wgt_left +
+                               m_psf[inx_energy_right+i+1] * w_offset.wgt_right;                               
             int_left  += 0.5 * (m_psf[inx_energy_left+i] * sin(theta_min) +
                                 psf_left                 * sin(theta_max)) *
                                (theta_max - theta_min);
@@ -824,8 +795,8 @@ double GLATMeanPsf::integral(const double& offsetmax, const double& logE)
             // Debug option: Dump integral computation results
             #if defined(G_DEBUG_INTEGRAL)
             std::cout << "offsetmax=" << offsetmax;
-            std::cout << " offset.left=" << m_offset.inx_left();
-            std::cout << " offset.right=" << m_offset.inx_right();
+            std::cout << " offset.left=" << w_offset.inx_left;
+            std::cout << " offset.right=" << w_offset.inx_right;
             std::cout << " i=" << i;
             std::cout << " psf_left=" << psf_left;
             std::cout << " psf_right=" << psf_right;
@@ -838,8 +809,8 @@ double GLATMeanPsf::integral(const double& offsetmax, const double& logE)
     } // endfor: looped over offset angles
 
     // Interpolate now in energy
-    double integral = gammalib::twopi * (m_energy.wgt_left()  * int_left +
-                                         m_energy.wgt_right() * int_right);
+    double integral = gammalib::twopi * (w_energy.wgt_left  * int_left +
+                                         w_energy.wgt_right * int_right);
 
     // Debug option: Dump integral computation results
     #if defined(G_DEBUG_INTEGRAL)
@@ -543,6 +543,50 @@ std::string GLATObservation::print(const GChatter& chatter) const
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for LAT observation
+ *
+ * @param[in] models Models.
+ * @param[in,out] gradient Pointer to gradients.
+ * @param[in,out] curvature Pointer to curvature matrix.
+ * @param[in,out] npred Pointer to Npred value.
+ * @return Log-likelihood value.
+ *
+ * Builds the mean PSFs for all point sources of the observation that are
+ * not covered by a source map before evaluating the log-likelihood
+ * function using GObservation::likelihood(). This assures that the mean
+ * PSFs are not built while event bins are processed in parallel.
+ ***************************************************************************/
+double GLATObservation::likelihood(const GModels&    models,
+                                   GVector*          gradient,
+                                   GMatrixSymmetric* curvature,
+                                   double*           npred) const
+{
+    // Build mean PSFs
+    m_response.meanpsfs(models, *this);
+
+    // Return log-likelihood value
+    return (GObservation::likelihood(models, gradient, curvature, npred));
+}
+
+
+/***********************************************************************//**
+ * @brief Signals whether observation events may be evaluated in parallel
+ *
+ * @return True if observation holds an event cube.
+ *
+ * The response of a LAT event cube is computed from source maps or from
+ * mean PSFs that are built beforehand by likelihood(), hence the event
+ * bins of a binned observation can be evaluated in parallel. Unbinned
+ * observations are not thread safe.
+ ***************************************************************************/
+bool GLATObservation::is_threadsafe(void) const
+{
+    // Return
+    return (dynamic_cast<const GLATEventCube*>(m_events) != NULL);
+}
+
+
 /***********************************************************************//**
  * @brief Load data for unbinned analysis
  *
@@ -36,6 +36,8 @@
 #include "GTools.hpp"
 #include "GCaldb.hpp"
 #include "GSource.hpp"
+#include "GModels.hpp"
+#include "GModelSky.hpp"
 #include "GModelSpatialPointSource.hpp"
 #include "GLATInstDir.hpp"
 #include "GLATResponse.hpp"
@@ -45,6 +47,11 @@
 #include "GLATEventCube.hpp"
 #include "GLATException.hpp"
 
+/* __ OpenMP section _____________________________________________________ */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* __ Method name definitions ____________________________________________ */
 #define G_CALDB                           "GLATResponse::caldb(std::string&)"
 #define G_LOAD                             "GLATResponse::load(std::string&)"
@@ -247,43 +254,42 @@ double GLATResponse::irf(const GEvent&       event,
     const GEnergy& srcEng = photon.energy();
 
     // Search for mean PSF
-    int ipsf = -1;
+    const GLATMeanPsf* psf = NULL;
     for (int i = 0; i < m_ptsrc.size(); ++i) {
         if (m_ptsrc[i]->dir() == srcDir) {
-            ipsf = i;
+            psf = m_ptsrc[i];
             break;
         }
     }
 
-    // If mean PSF has not been found then create it now
-    if (ipsf == -1) {
-
-        // Allocate new mean PSF
-        GLATMeanPsf* psf = new GLATMeanPsf(srcDir, static_cast<const GLATObservation&>(obs));
-
-        // Set source name
-        std::string name = "SRC("+gammalib::str(srcDir.ra_deg()) +
-                                "," +
-                                gammalib::str(srcDir.dec_deg())+")";
-        psf->name(name);
-
-        // Push mean PSF on stack
-        const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-        // Set index of mean PSF
-        ipsf = m_ptsrc.size()-1;
-
-        // Debug option: dump mean PSF
-        #if G_DUMP_MEAN_PSF
-        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
-        std::cout << *psf << std::endl;
+    // If mean PSF has not been found then create it now. Within a parallel
+    // region the mean PSF table must not be modified, hence a temporary
+    // mean PSF is used.
+    GLATMeanPsf* tmp = NULL;
+    if (psf == NULL) {
+        const GLATObservation& lat = static_cast<const GLATObservation&>(obs);
+        #ifdef _OPENMP
+        if (omp_in_parallel()) {
+            tmp = new GLATMeanPsf(srcDir, lat);
+            psf = tmp;
+        }
         #endif
-
-    } // endif: created new mean PSF
+        if (psf == NULL) {
+            std::string name = "SRC("+gammalib::str(srcDir.ra_deg()) +
+                                    "," +
+                                    gammalib::str(srcDir.dec_deg())+")";
+            psf = meanpsf(name, srcDir, lat);
+        }
+    }
 
     // Get IRF value
     double offset = dir->dir().dist_deg(srcDir);
-    double irf    = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV());
+    double irf    = (*psf)(offset, srcEng.log10MeV());
+
+    // Delete temporary mean PSF
+    if (tmp != NULL) {
+        delete tmp;
+    }
 
     // Return IRF value
     return irf;
@@ -364,8 +370,10 @@ double GLATResponse::irf(const GLATEventAtom& event,
  *
  * @todo Extract event cube from observation. We do not need the cube
  *       pointer in the event anymore.
- * @todo Implement more efficient method for response search (name search is
- *       not very rapid).
+ * Source maps and mean PSFs are looked up by name in index tables, hence
+ * the method can be called in parallel for different event bins provided
+ * that the mean PSFs were built beforehand using meanpsfs().
+ *
  * @todo Instead of calling "offset = event.dir().dist_deg(srcDir)" we can
  *       precompute and store for each PSF the offsets. This should save
  *       quite some time since the distance computation is time
@@ -389,26 +397,23 @@ double GLATResponse::irf(const GLATEventBin& event,
     GEnergy srcEng = source.energy();
 
     // Search for diffuse response in event cube
-    int idiff = -1;
-    for (int i = 0; i < cube->ndiffrsp(); ++i) {
-        if (cube->diffname(i) == source.name()) {
-            idiff = i;
-            break;
-        }
-    }
+    int idiff = cube->diffindex(source.name());
 
     // If diffuse response has been found then get response from source map
     if (idiff != -1) {
 
-        // Get srcmap indices and weighting factors
-        GNodeArray nodes = cube->enodes();
-        nodes.set_value(srcEng.log10MeV());
+        // Get srcmap indices and weighting factors. If the source energy
+        // is the energy of the event bin then use the precomputed weights
+        // of the energy layer.
+        GNodeArray::weights w = (srcEng == event.energy())
+                                ? cube->eweights(event.ieng())
+                                : cube->enodes().locate(srcEng.log10MeV());
 
-        // Compute diffuse response
-        GSkymap*      map    = cube->diffrsp(idiff);
-        const double* pixels = map->pixels() + event.ipix();
-        rsp                  = nodes.wgt_left()  * pixels[nodes.inx_left()  * map->npix()] +
-                               nodes.wgt_right() * pixels[nodes.inx_right() * map->npix()];
+        // Compute diffuse response. The source map is accessed through the
+        // const access operator, which does not modify the map.
+        const GSkymap& map = *(cube->diffrsp(idiff));
+        rsp                = w.wgt_left  * map(event.ipix(), w.inx_left) +
+                             w.wgt_right * map(event.ipix(), w.inx_right);
 
         // Divide by solid angle and ontime since source maps are given in units of
         // counts/pixel/MeV.
@@ -420,43 +425,27 @@ double GLATResponse::irf(const GLATEventBin& event,
     // then return response from mean PSF
     if ((idiff == -1 || m_force_mean) && ptsrc != NULL) {
 
-        // Search for mean PSF
-        int ipsf = -1;
-        for (int i = 0; i < m_ptsrc.size(); ++i) {
-            if (m_ptsrc[i]->name() == source.name()) {
-                ipsf = i;
-                break;
+        // Get mean PSF. If the mean PSF was not built using meanpsfs() it
+        // is built now. Within a parallel region the mean PSF table must not
+        // be modified, hence a temporary mean PSF is used.
+        const GLATMeanPsf* psf = meanpsf(source.name());
+        GLATMeanPsf*       tmp = NULL;
+        if (psf == NULL) {
+            const GLATObservation& lat = static_cast<const GLATObservation&>(obs);
+            #ifdef _OPENMP
+            if (omp_in_parallel()) {
+                tmp = new GLATMeanPsf(ptsrc->dir(), lat);
+                psf = tmp;
             }
-        }
-
-        // If mean PSF has not been found then create it now
-        if (ipsf == -1) {
-
-            // Allocate new mean PSF
-            GLATMeanPsf* psf = 
-                new GLATMeanPsf(ptsrc->dir(), static_cast<const GLATObservation&>(obs));
-
-            // Set source name
-            psf->name(source.name());
-
-            // Push mean PSF on stack
-            const_cast<GLATResponse*>(this)->m_ptsrc.push_back(psf);
-
-            // Set index of mean PSF
-            ipsf = m_ptsrc.size()-1;
-
-            // Debug option: dump mean PSF
-            #if G_DUMP_MEAN_PSF 
-            std::cout << "Added new mean PSF \""+source.name() << "\"" << std::endl;
-            std::cout << *psf << std::endl;
             #endif
-
-        } // endif: created new mean PSF
+            if (psf == NULL) {
+                psf = meanpsf(source.name(), ptsrc->dir(), lat);
+            }
+        }
 
         // Get PSF value
-        GSkyDir srcDir   = m_ptsrc[ipsf]->dir();
-        double  offset   = event.dir().dir().dist_deg(srcDir);
-        double  mean_psf = (*m_ptsrc[ipsf])(offset, srcEng.log10MeV()) / (event.ontime());
+        double offset   = event.dir().dir().dist_deg(psf->dir());
+        double mean_psf = (*psf)(offset, srcEng.log10MeV()) / (event.ontime());
 
         // Debug option: compare mean PSF to diffuse response
         #if G_DEBUG_MEAN_PSF
@@ -473,6 +462,11 @@ double GLATResponse::irf(const GLATEventBin& event,
         std::cout << std::endl;
         #endif
 
+        // Delete temporary mean PSF
+        if (tmp != NULL) {
+            delete tmp;
+        }
+
         // Set response
         rsp = mean_psf;
 
@@ -719,6 +713,57 @@ GLATEdisp* GLATResponse::edisp(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Build mean PSFs for all point sources of an observation
+ *
+ * @param[in] models Models.
+ * @param[in] obs LAT observation.
+ *
+ * Builds the mean PSFs for all point sources in @p models that apply to
+ * the binned observation @p obs and that are not covered by a source map
+ * (or all point sources if a mean PSF is enforced). Calling this method
+ * before evaluating the binned likelihood ensures that no mean PSF needs
+ * to be built while the event bins are processed, so that the response
+ * can be computed for different event bins in parallel.
+ ***************************************************************************/
+void GLATResponse::meanpsfs(const GModels&         models,
+                            const GLATObservation& obs) const
+{
+    // Get pointer to event cube. Continue only for binned observations
+    const GLATEventCube* cube = dynamic_cast<const GLATEventCube*>(obs.events());
+    if (cube != NULL) {
+
+        // Loop over models
+        for (int i = 0; i < models.size(); ++i) {
+
+            // Continue only if model is a sky model that applies to the
+            // observation
+            const GModelSky* model = dynamic_cast<const GModelSky*>(models[i]);
+            if (model == NULL || !model->is_valid(obs.instrument(), obs.id())) {
+                continue;
+            }
+
+            // Continue only if model is a point source
+            const GModelSpatialPointSource* ptsrc =
+                  dynamic_cast<const GModelSpatialPointSource*>(model->spatial());
+            if (ptsrc == NULL) {
+                continue;
+            }
+
+            // Build mean PSF if no source map exists for the source
+            if (cube->diffindex(model->name()) == -1 || m_force_mean) {
+                meanpsf(model->name(), ptsrc->dir(), obs);
+            }
+
+        } // endfor: looped over models
+
+    } // endif: observation was binned
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Print Fermi-LAT response information
  *
@@ -793,6 +838,7 @@ void GLATResponse::init_members(void)
     m_psf.clear();
     m_edisp.clear();
     m_ptsrc.clear();
+    m_ptsrc_index.clear();
     
     // By default use HANDOFF response database.
     char* handoff = std::getenv("HANDOFF_IRF_DIR");
@@ -842,6 +888,7 @@ void GLATResponse::copy_members(const GLATResponse& rsp)
     for (int i = 0; i < rsp.m_ptsrc.size(); ++i) {
         m_ptsrc.push_back(rsp.m_ptsrc[i]->clone());
     }
+    m_ptsrc_index = rsp.m_ptsrc_index;
 
     // Return
     return;
@@ -880,7 +927,81 @@ void GLATResponse::free_members(void)
         m_ptsrc[i] = NULL;
     }
     m_ptsrc.clear();
+    m_ptsrc_index.clear();
 
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Return mean PSF for a point source
+ *
+ * @param[in] name Source name.
+ * @return Pointer to mean PSF (NULL if no mean PSF exists for the source).
+ *
+ * Returns the mean PSF for the point source @p name. The method does not
+ * modify the mean PSF table, hence it can be called concurrently.
+ ***************************************************************************/
+const GLATMeanPsf* GLATResponse::meanpsf(const std::string& name) const
+{
+    // Initialise mean PSF pointer
+    const GLATMeanPsf* psf = NULL;
+
+    // Search for mean PSF in index
+    std::map<std::string,int>::const_iterator it = m_ptsrc_index.find(name);
+    if (it != m_ptsrc_index.end()) {
+        psf = m_ptsrc[it->second];
+    }
+
+    // Return mean PSF
+    return psf;
+}
+
+
+/***********************************************************************//**
+ * @brief Build mean PSF for a point source
+ *
+ * @param[in] name Source name.
+ * @param[in] dir Source direction.
+ * @param[in] obs LAT observation.
+ * @return Pointer to mean PSF.
+ *
+ * Returns the mean PSF for the point source @p name. If no mean PSF exists
+ * so far for the source, the mean PSF is computed and appended to the mean
+ * PSF table. As the table is modified, the method must not be called while
+ * other threads access the mean PSFs.
+ ***************************************************************************/
+const GLATMeanPsf* GLATResponse::meanpsf(const std::string&     name,
+                                         const GSkyDir&         dir,
+                                         const GLATObservation& obs) const
+{
+    // Search for mean PSF
+    const GLATMeanPsf* psf = meanpsf(name);
+
+    // If mean PSF was not found then create it now
+    if (psf == NULL) {
+
+        // Allocate new mean PSF
+        GLATMeanPsf* ptsrc = new GLATMeanPsf(dir, obs);
+
+        // Set source name
+        ptsrc->name(name);
+
+        // Push mean PSF on stack
+        GLATResponse* rsp = const_cast<GLATResponse*>(this);
+        rsp->m_ptsrc_index[name] = m_ptsrc.size();
+        rsp->m_ptsrc.push_back(ptsrc);
+        psf = ptsrc;
+
+        // Debug option: dump mean PSF
+        #if G_DUMP_MEAN_PSF
+        std::cout << "Added new mean PSF \""+name+"\"" << std::endl;
+        std::cout << *ptsrc << std::endl;
+        #endif
+
+    } // endif: created new mean PSF
+
+    // Return mean PSF
+    return psf;
+}
@@ -353,16 +353,14 @@ void GLATResponseTable::set(const double& logE, const double& ctheta)
     // Flag no change of values
     bool change = false;
 
-    // Set energy interpolation
+    // Check for change of energy
     if (logE != m_last_energy) {
-        m_logE.set_value(logE);
         m_last_energy = logE;
         change        = true;
     }
 
-    // Set cos(theta) interpolation
+    // Check for change of cos(theta)
     if (ctheta != m_last_ctheta) {
-        m_ctheta.set_value(ctheta);
         m_last_ctheta = ctheta;
         change        = true;
     }
@@ -371,19 +369,23 @@ void GLATResponseTable::set(const double& logE, const double& ctheta)
     // factors
     if (change) {
 
+        // Get energy and cos(theta) interpolation values
+        GNodeArray::weights w_logE   = m_logE.locate(logE);
+        GNodeArray::weights w_ctheta = m_ctheta.locate(ctheta);
+
         // Set array indices for bi-linear interpolation
-        int inx_ctheta_left  = m_ctheta.inx_left()  * m_energy_num;
-        int inx_ctheta_right = m_ctheta.inx_right() * m_energy_num;
-        m_inx1 = m_logE.inx_left()  + inx_ctheta_left;
-        m_inx2 = m_logE.inx_left()  + inx_ctheta_right;
-        m_inx3 = m_logE.inx_right() + inx_ctheta_left;
-        m_inx4 = m_logE.inx_right() + inx_ctheta_right;
+        int inx_ctheta_left  = w_ctheta.inx_left  * m_energy_num;
+        int inx_ctheta_right = w_ctheta.inx_right * m_energy_num;
+        m_inx1 = w_logE.inx_left  + inx_ctheta_left;
+        m_inx2 = w_logE.inx_left  + inx_ctheta_right;
+        m_inx3 = w_logE.inx_right + inx_ctheta_left;
+        m_inx4 = w_logE.inx_right + inx_ctheta_right;
 
         // Set weighting factors for bi-linear interpolation
-        m_wgt1 = m_logE.wgt_left()  * m_ctheta.wgt_left();
-        m_wgt2 = m_logE.wgt_left()  * m_ctheta.wgt_right();
-        m_wgt3 = m_logE.wgt_right() * m_ctheta.wgt_left();
-        m_wgt4 = m_logE.wgt_right() * m_ctheta.wgt_right();
+        m_wgt1 = w_logE.wgt_left  * w_ctheta.wgt_left;
+        m_wgt2 = w_logE.wgt_left  * w_ctheta.wgt_right;
+        m_wgt3 = w_logE.wgt_right * w_ctheta.wgt_left;
+        m_wgt4 = w_logE.wgt_right * w_ctheta.wgt_right;
 
     } // endif: logE or ctheta changed
 
@@ -402,19 +404,31 @@ void GLATResponseTable::set(const double& logE, const double& ctheta)
  * Bi-linear interpolation is performed in log10 of energy and in cos theta.
  * The array is stored in a std::vector object with the logE axis varying
  * more rapidely.
+ *
+ * The interpolation indices and weights are computed locally, hence the
+ * method does not modify the response table.
  ***************************************************************************/
 double GLATResponseTable::interpolate(const double&              logE,
                                       const double&              ctheta,
                                       const std::vector<double>& array)
 {
-    // Set interpolation indices and weights
-    set(logE, ctheta);
+    // Get interpolation indices and weights
+    GNodeArray::weights w_logE   = m_logE.locate(logE);
+    GNodeArray::weights w_ctheta = m_ctheta.locate(ctheta);
+
+    // Set array indices for bi-linear interpolation
+    int inx_ctheta_left  = w_ctheta.inx_left  * m_energy_num;
+    int inx_ctheta_right = w_ctheta.inx_right * m_energy_num;
 
     // Perform bi-linear interpolation
-    double value = m_wgt1 * array[m_inx1] +
-                   m_wgt2 * array[m_inx2] +
-                   m_wgt3 * array[m_inx3] +
-                   m_wgt4 * array[m_inx4];
+    double value = w_logE.wgt_left  * w_ctheta.wgt_left  *
+                   array[w_logE.inx_left  + inx_ctheta_left]  +
+                   w_logE.wgt_left  * w_ctheta.wgt_right *
+                   array[w_logE.inx_left  + inx_ctheta_right] +
+                   w_logE.wgt_right * w_ctheta.wgt_left  *
+                   array[w_logE.inx_right + inx_ctheta_left]  +
+                   w_logE.wgt_right * w_ctheta.wgt_right *
+                   array[w_logE.inx_right + inx_ctheta_right];
 
     // Return bi-linear interpolated value
     return value;
@@ -570,10 +584,10 @@ std::vector<double> GLATResponseTable::energies(void) const
 
     // Push energies on vector
     if (m_energy_num > 0) {
-        energies.push_back(m_energy[m_logE.inx_left()]);
-        energies.push_back(m_energy[m_logE.inx_left()]);
-        energies.push_back(m_energy[m_logE.inx_right()]);
-        energies.push_back(m_energy[m_logE.inx_right()]);
+        energies.push_back(m_energy[m_inx1 % m_energy_num]);
+        energies.push_back(m_energy[m_inx2 % m_energy_num]);
+        energies.push_back(m_energy[m_inx3 % m_energy_num]);
+        energies.push_back(m_energy[m_inx4 % m_energy_num]);
     }
 
     // Return vector
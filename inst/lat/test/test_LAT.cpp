@@ -586,6 +586,26 @@ void TestGLATObservation::test_one_binned_obs(const std::string& datadir, const
     test_value(sum, nevents, 1.0e-20, "Test event iterator (counts)");
     test_value(num, nsize, 1.0e-20, "Test event iterator (bins)");
 
+    // Loop over all events using event bin view
+    const GEventCube* evtcube = static_cast<const GEventCube*>(events);
+    GEventBin*        view    = evtcube->bin_view();
+    sum = 0;
+    for (int i = 0; i < evtcube->size(); ++i) {
+        sum += (int)(evtcube->bin(i, view)->counts());
+    }
+    delete view;
+    test_value(sum, nevents, 1.0e-20, "Test event bin view (counts)");
+
+    // Test source map index
+    const GLATEventCube* latcube = static_cast<const GLATEventCube*>(events);
+    test_assert(latcube->ndiffrsp() > 0, "Test presence of source maps");
+    for (int i = 0; i < latcube->ndiffrsp(); ++i) {
+        test_value(latcube->diffindex(latcube->diffname(i)), i,
+                   "Test source map index of \""+latcube->diffname(i)+"\"");
+    }
+    test_value(latcube->diffindex("Unknown source"), -1,
+               "Test source map index of unknown source");
+
     // Test mean PSF
     test_try("Test mean PSF");
     try {
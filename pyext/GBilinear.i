@@ -43,7 +43,8 @@ public:
     virtual ~GBilinear(void);
 
     // Operators
-    double operator()(const double* array);
+    double operator()(const double* array, const int& stride = 1) const;
+    double operator()(const float* array, const int& stride = 1) const;
 
     // Methods
     void        clear(void);
@@ -28,6 +28,9 @@
 #include "GEventCube.hpp"
 %}
 
+/* __ Returned event bin views are owned by the caller ___________________ */
+%newobject GEventCube::bin_view;
+
 
 /***********************************************************************//**
  * @class GEventCube
@@ -54,6 +57,10 @@ public:
     virtual void        read(const GFits& file) = 0;
     virtual void        write(GFits& file) const = 0;
     virtual int         number(void) const = 0;
+
+    // Virtual methods
+    virtual GEventBin*       bin_view(void) const;
+    virtual const GEventBin* bin(const int& index, GEventBin* view) const;
 };
 
 
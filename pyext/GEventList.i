@@ -28,6 +28,9 @@
 #include "GEventList.hpp"
 %}
 
+/* __ Returned event atom views are owned by the caller __________________ */
+%newobject GEventList::atom_view;
+
 
 /***********************************************************************//**
  * @class GEventList
@@ -54,6 +57,10 @@ public:
     virtual int         number(void) const = 0;
     virtual void        roi(const GRoi& roi) = 0;
     virtual const GRoi& roi(void) const = 0;
+
+    // Virtual methods
+    virtual GEventAtom*       atom_view(void) const;
+    virtual const GEventAtom* atom(const int& index, GEventAtom* view) const;
 };
 
 
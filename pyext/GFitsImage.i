@@ -126,6 +126,8 @@ public:
     const int&  anynul(void) const;
     void        nulval(const void* value);
     const void* nulval(void) const;
+    void        use_mmap(const bool& use_mmap);
+    const bool& use_mmap(void) const;
 };
 
 
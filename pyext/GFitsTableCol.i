@@ -97,6 +97,8 @@ public:
     const bool&             is_variable(void) const;
     void                    anynul(const int& anynul);
     const int&              anynul(void) const;
+    void                    use_mmap(const bool& use_mmap);
+    const bool&             use_mmap(void) const;
     std::string             tform_binary(void) const;
 };
 
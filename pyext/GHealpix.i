@@ -28,9 +28,6 @@
 #include "GHealpix.hpp"
 %}
 %include "std_vector.i"
-namespace std {
-   %template(SkyDirVector) vector<GSkyDir>;
-}
 namespace std {
    %template(IntVector) vector<int>;
 }
@@ -66,6 +63,10 @@ public:
     virtual GSkyPixel   dir2pix(const GSkyDir& dir) const;
     virtual GBilinear   interpolator(const GSkyDir& dir) const;
 
+    // Overloaded virtual base class methods
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
+
     // Other methods
     const int&           npix(void) const;
     const int&           nside(void) const;
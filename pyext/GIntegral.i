@@ -72,6 +72,8 @@ public:
                               const int& n = 1, double result = 0.0);
     double             adaptive_simpson(const double& a, const double& b) const;
     double             gauss_kronrod(const double& a, const double& b) const;
+    double             gauss_legendre(const double& a, const double& b,
+                                      const int& order = 16) const;
 };
 
 
@@ -0,0 +1,73 @@
+/***************************************************************************
+ *          GIntegrals.i - Integration class for set of functions          *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GIntegrals.i
+ * @brief Integration class Python interface definition
+ * @author Juergen Knoedlseder
+ */
+%{
+/* Put headers and other declarations here that are needed for compilation */
+#include "GIntegrals.hpp"
+%}
+
+
+/***********************************************************************//**
+ * @class GIntegrals
+ *
+ * @brief Integration class for set of functions Python interface definition
+ *
+ * This class allows to perform the simultaneous integration of a set of
+ * functions. The integrands are implemented by a derived class of
+ * GFunctions.
+ ***************************************************************************/
+class GIntegrals : public GIntegral {
+public:
+
+    // Constructors and destructors
+    explicit GIntegrals(void);
+    explicit GIntegrals(GFunctions* kernels);
+    GIntegrals(const GIntegrals& integrals);
+    virtual ~GIntegrals(void);
+
+    // Methods
+    void              clear(void);
+    GIntegrals*       clone(void) const;
+    std::string       classname(void) const;
+    void              kernels(GFunctions* kernels);
+    const GFunctions* kernels(void) const;
+    GVector           romberg(std::vector<double> bounds,
+                              const int& order = 5);
+    GVector           romberg(const double& a, const double& b,
+                              const int& order = 5);
+    GVector           trapzd(const double& a, const double& b,
+                             const int& n = 1,
+                             GVector result = GVector());
+};
+
+
+/***********************************************************************//**
+ * @brief GIntegrals class extension
+ ***************************************************************************/
+%extend GIntegrals {
+    GIntegrals copy() {
+        return (*self);
+    }
+};
@@ -86,6 +86,11 @@ public:
     GMatrixSymmetric cholesky_decompose(bool compress = true) const;
     GVector          cholesky_solver(const GVector& vector, bool compress = true) const;
     GMatrixSymmetric cholesky_invert(bool compress = true) const;
+    void             add_outer_product(const GVector& vector,
+                                       const double&  scale = 1.0);
+    void             add_outer_product(const double* values, const int* inx,
+                                       const int& number,
+                                       const double& scale = 1.0);
 };
 
 
@@ -59,6 +59,12 @@ public:
     virtual void        read(const GXmlElement& xml) = 0;
     virtual void        write(GXmlElement& xml) const = 0;
 
+    // Virtual methods
+    virtual double      eval_gradients(const GEvent&       event,
+                                       const GObservation& obs,
+                                       GVector&            gradients,
+                                       const int&          offset = 0) const;
+
     // Implemented methods
     int                 size(void) const;
     GModelPar&          at(const int& index);
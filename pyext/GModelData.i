@@ -58,6 +58,9 @@ public:
     virtual GEvents*    mc(const GObservation& obs, GRan& ran) const = 0;
     virtual void        read(const GXmlElement& xml) = 0;
     virtual void        write(GXmlElement& xml) const = 0;
+
+    // Base class methods
+    using GModel::eval_gradients;
 };
 
 
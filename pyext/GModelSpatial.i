@@ -48,7 +48,9 @@ public:
     virtual std::string    classname(void) const = 0;
     virtual std::string    type(void) const = 0;
     virtual double         eval(const GPhoton& photon) const = 0;
-    virtual double         eval_gradients(const GPhoton& photon) const = 0;
+    virtual double         eval_gradients(const GPhoton& photon,
+                                          GVector&       gradients,
+                                          const int&     offset = 0) const = 0;
     virtual GSkyDir        mc(const GEnergy& energy, const GTime& time,
                               GRan& ran) const = 0;
     virtual double         norm(const GSkyDir& dir,
@@ -59,6 +61,7 @@ public:
     virtual void           write(GXmlElement& xml) const = 0;
 
     // Methods
+    double     eval_gradients(const GPhoton& photon) const;
     GModelPar& at(const int& index);
     bool       has_par(const std::string& name) const;
     int        size(void) const;
@@ -47,7 +47,9 @@ public:
     virtual std::string           classname(void) const = 0;
     virtual std::string           type(void) const = 0;
     virtual double                eval(const GPhoton& photon) const = 0;
-    virtual double                eval_gradients(const GPhoton& photon) const = 0;
+    virtual double                eval_gradients(const GPhoton& photon,
+                                                 GVector&       gradients,
+                                                 const int&     offset = 0) const = 0;
     virtual GSkyDir               mc(const GEnergy& energy, const GTime& time,
                                      GRan& ran) const = 0;
     virtual double                norm(const GSkyDir& dir,
@@ -56,6 +58,9 @@ public:
                                            const double&  margin = 0.0) const = 0;
     virtual void                  read(const GXmlElement& xml) = 0;
     virtual void                  write(GXmlElement& xml) const = 0;
+
+    // Base class methods
+    using GModelSpatial::eval_gradients;
 };
 
 
@@ -54,7 +54,9 @@ public:
     virtual std::string              classname(void) const;
     virtual std::string              type(void) const;
     virtual double                   eval(const GPhoton& photon) const;
-    virtual double                   eval_gradients(const GPhoton& photon) const;
+    virtual double                   eval_gradients(const GPhoton& photon,
+                                                    GVector&       gradients,
+                                                    const int&     offset = 0) const;
     virtual GSkyDir                  mc(const GEnergy& energy,
                                         const GTime& time,
                                         GRan& ran) const;
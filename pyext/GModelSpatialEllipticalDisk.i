@@ -59,7 +59,9 @@ public:
     virtual double                       eval_gradients(const double&  theta,
                                                         const double&  posangle,
                                                         const GEnergy& energy,
-                                                        const GTime&   time) const;
+                                                        const GTime&   time,
+                                                        GVector&       gradients,
+                                                        const int&     offset = 0) const;
     virtual GSkyDir                      mc(const GEnergy& energy,
                                             const GTime& time,
                                             GRan& ran) const;
@@ -68,6 +70,9 @@ public:
     virtual double                       theta_max(void) const;
     virtual void                         read(const GXmlElement& xml);
     virtual void                         write(GXmlElement& xml) const;
+
+    // Base class methods
+    using GModelSpatialElliptical::eval_gradients;
 };
 
 
@@ -81,7 +86,4 @@ public:
     double eval(const GPhoton& photon) const {
         return self->GModelSpatialElliptical::eval(photon);
     }
-    double eval_gradients(const GPhoton& photon) const {
-        return self->GModelSpatialElliptical::eval_gradients(photon);
-    }
 };
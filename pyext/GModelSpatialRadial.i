@@ -51,9 +51,11 @@ public:
     virtual double               eval(const double&  theta,
                                       const GEnergy& energy,
                                       const GTime& time) const = 0;
-    virtual double               eval_gradients(const double& theta,
+    virtual double               eval_gradients(const double&  theta,
                                                 const GEnergy& energy,
-                                                const GTime& time) const = 0;
+                                                const GTime&   time,
+                                                GVector&       gradients,
+                                                const int&     offset = 0) const = 0;
     virtual GSkyDir              mc(const GEnergy& energy,
                                     const GTime& time,
                                     GRan& ran) const = 0;
@@ -63,12 +65,20 @@ public:
 
     // Implemented virtual base class methods
     virtual double eval(const GPhoton& photon) const;
-    virtual double eval_gradients(const GPhoton& photon) const;
+    virtual double eval_gradients(const GPhoton& photon,
+                                  GVector&       gradients,
+                                  const int&     offset = 0) const;
     virtual double norm(const GSkyDir& dir, const double&  radius) const;
     virtual void   read(const GXmlElement& xml);
     virtual void   write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpatial::eval_gradients;
+
     // Other methods
+    double  eval_gradients(const double&  theta,
+                           const GEnergy& energy,
+                           const GTime&   time) const;
     double  ra(void) const;
     double  dec(void) const;
     void    ra(const double& ra);
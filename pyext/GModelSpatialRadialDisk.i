@@ -57,7 +57,9 @@ public:
                                           const GTime&   time) const;
     virtual double                   eval_gradients(const double&  theta,
                                                     const GEnergy& energy,
-                                                    const GTime&   time) const;
+                                                    const GTime&   time,
+                                                    GVector&       gradients,
+                                                    const int&     offset = 0) const;
     virtual GSkyDir                  mc(const GEnergy& energy,
                                         const GTime&   time,
                                         GRan&          ran) const;
@@ -67,6 +69,9 @@ public:
     virtual void                     read(const GXmlElement& xml);
     virtual void                     write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpatialRadial::eval_gradients;
+
     // Other methods
     double radius(void) const;
     void   radius(const double& radius);
@@ -76,11 +81,10 @@ public:
 /***********************************************************************//**
  * @brief GModelSpatialRadialDisk class extension
  *
- * The eval(GSkyDir&) and eval_gradients(GSkyDir&) need to be defined in the
- * extension to force swig to build also the interface for these methods that
- * are implemented in the base class only. It's not clear to me why these
- * methods are not inherited automatically. Maybe this could also be handled
- * by a %typemap(typecheck) construct.
+ * The eval(GSkyDir&) method needs to be defined in the extension to force
+ * swig to build also the interface for this method that is implemented in
+ * the base class only. The eval_gradients() methods of the base classes are
+ * made visible by a using declaration.
  ***************************************************************************/
 %extend GModelSpatialRadialDisk {
     GModelSpatialRadialDisk copy() {
@@ -89,7 +93,4 @@ public:
     double eval(const GPhoton& photon) const {
         return self->GModelSpatialRadial::eval(photon);
     }
-    double eval_gradients(const GPhoton& photon) const {
-        return self->GModelSpatialRadial::eval_gradients(photon);
-    }
 };
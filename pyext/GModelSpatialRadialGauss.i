@@ -52,9 +52,11 @@ public:
     virtual double                    eval(const double&  theta,
                                            const GEnergy& energy,
                                            const GTime& time) const;
-    virtual double                    eval_gradients(const double& theta,
+    virtual double                    eval_gradients(const double&  theta,
                                                      const GEnergy& energy,
-                                                     const GTime& time) const;
+                                                     const GTime&   time,
+                                                     GVector&       gradients,
+                                                     const int&     offset = 0) const;
     virtual GSkyDir                   mc(const GEnergy& energy,
                                          const GTime& time,
                                          GRan& ran) const;
@@ -64,6 +66,9 @@ public:
     virtual void                      read(const GXmlElement& xml);
     virtual void                      write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpatialRadial::eval_gradients;
+
     // Other methods
     double  sigma(void) const;
     void    sigma(const double& sigma);
@@ -73,11 +78,10 @@ public:
 /***********************************************************************//**
  * @brief GModelSpatialRadialGauss class extension
  *
- * The eval(GSkyDir&) and eval_gradients(GSkyDir&) need to be defined in the
- * extension to force swig to build also the interface for these methods that
- * are implemented in the base class only. It's not clear to me why these
- * methods are not inherited automatically. Maybe this could also be handled
- * by a %typemap(typecheck) construct.
+ * The eval(GSkyDir&) method needs to be defined in the extension to force
+ * swig to build also the interface for this method that is implemented in
+ * the base class only. The eval_gradients() methods of the base classes are
+ * made visible by a using declaration.
  ***************************************************************************/
 %extend GModelSpatialRadialGauss {
     GModelSpatialRadialGauss copy() {
@@ -86,7 +90,4 @@ public:
     double eval(const GPhoton& photon) const {
         return self->GModelSpatialRadial::eval(photon);
     }
-    double eval_gradients(const GPhoton& photon) const {
-        return self->GModelSpatialRadial::eval_gradients(photon);
-    }
 };
@@ -50,7 +50,9 @@ public:
     virtual double          eval(const GEnergy& srcEng,
                                  const GTime& srcTime) const = 0;
     virtual double          eval_gradients(const GEnergy& srcEng,
-                                           const GTime& srcTime) = 0;
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset = 0) const = 0;
     virtual double          flux(const GEnergy& emin,
                                  const GEnergy& emax) const = 0;
     virtual double          eflux(const GEnergy& emin,
@@ -61,6 +63,8 @@ public:
     virtual void            write(GXmlElement& xml) const = 0;
 
     // Methods
+    double     eval_gradients(const GEnergy& srcEng,
+                              const GTime&   srcTime) const;
     GModelPar& at(const int& index);
     bool       has_par(const std::string& name) const;
     int        size(void) const;
@@ -54,7 +54,9 @@ public:
     virtual double                    eval(const GEnergy& srcEng,
                                            const GTime&   srcTime) const;
     virtual double                    eval_gradients(const GEnergy& srcEng,
-                                                     const GTime&   srcTime);
+                                                     const GTime&   srcTime,
+                                                     GVector&       gradients,
+                                                     const int&     offset = 0) const;
     virtual double                    flux(const GEnergy& emin,
                                            const GEnergy& emax) const;
     virtual double                    eflux(const GEnergy& emin,
@@ -66,6 +68,9 @@ public:
     virtual void                      read(const GXmlElement& xml);
     virtual void                      write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpectral::eval_gradients;
+
     // Other methods
     double  prefactor(void) const;
     double  index1(void) const;
@@ -51,7 +51,9 @@ public:
     virtual double               eval(const GEnergy& srcEng,
                                       const GTime& srcTime) const;
     virtual double               eval_gradients(const GEnergy& srcEng,
-                                                const GTime& srcTime);
+                                                const GTime&   srcTime,
+                                                GVector&       gradients,
+                                                const int&     offset = 0) const;
     virtual double               flux(const GEnergy& emin,
                                       const GEnergy& emax) const;
     virtual double               eflux(const GEnergy& emin,
@@ -61,6 +63,9 @@ public:
     virtual void                 read(const GXmlElement& xml);
     virtual void                 write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpectral::eval_gradients;
+
     // Other methods
     double value(void) const;
     void   value(const double& value);
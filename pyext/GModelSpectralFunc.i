@@ -52,7 +52,9 @@ public:
     virtual double              eval(const GEnergy& srcEng,
                                      const GTime&   srcTime) const;
     virtual double              eval_gradients(const GEnergy& srcEng,
-                                               const GTime&   srcTime);
+                                               const GTime&   srcTime,
+                                               GVector&       gradients,
+                                               const int&     offset = 0) const;
     virtual double              flux(const GEnergy& emin,
                                      const GEnergy& emax) const;
     virtual double              eflux(const GEnergy& emin,
@@ -64,6 +66,9 @@ public:
     virtual void                read(const GXmlElement& xml);
     virtual void                write(GXmlElement& xml) const;
 
+    // Base class methods
+    using GModelSpectral::eval_gradients;
+
     // Other methods
     const std::string& filename(void) const;
     void               filename(const std::string& filename);
@@ -48,13 +48,16 @@ public:
     virtual std::string     classname(void) const = 0;
     virtual std::string     type(void) const = 0;
     virtual double          eval(const GTime& srcTime) const = 0;
-    virtual double          eval_gradients(const GTime& srcTime) = 0;
+    virtual double          eval_gradients(const GTime& srcTime,
+                                           GVector&     gradients,
+                                           const int&   offset = 0) const = 0;
     virtual GTimes          mc(const double& rate, const GTime& tmin,
                                const GTime& tmax, GRan& ran) const = 0;
     virtual void            read(const GXmlElement& xml) = 0;
     virtual void            write(GXmlElement& xml) const = 0;
 
     // Methods
+    double     eval_gradients(const GTime& srcTime) const;
     GModelPar& at(const int& index);
     bool       has_par(const std::string& name) const;
     int        size(void) const;
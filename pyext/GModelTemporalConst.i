@@ -49,7 +49,9 @@ public:
     virtual std::string          classname(void) const;
     virtual std::string          type(void) const;
     virtual double               eval(const GTime& srcTime) const;
-    virtual double               eval_gradients(const GTime& srcTime);
+    virtual double               eval_gradients(const GTime& srcTime,
+                                                GVector&     gradients,
+                                                const int&   offset = 0) const;
     virtual GTimes               mc(const double& rate, const GTime& tmin,
                                     const GTime& tmax, GRan& ran) const;
     virtual void                 read(const GXmlElement& xml);
@@ -61,10 +61,10 @@ public:
     // Virtual methods
     virtual const GEvents*   events(void) const;
     virtual void             events(const GEvents& events);
-    virtual double           likelihood(const GModels& models,
-                                        GVector*       gradient,
-                                        GMatrixSparse* curvature,
-                                        double*        npred) const;
+    virtual double           likelihood(const GModels&    models,
+                                        GVector*          gradient,
+                                        GMatrixSymmetric* curvature,
+                                        double*           npred) const;
     virtual double           model(const GModels& models,
                                    const GEvent&  event,
                                    GVector*       gradient = NULL) const;
@@ -76,6 +76,8 @@ public:
                                         const GEvent&    event) const;
     virtual double           npred_grad(const GModel&    model,
                                         const GModelPar& par) const;
+    virtual bool             is_threadsafe(void) const;
+    virtual void             prefetch(void) const;
 
     // Implemented methods
     void               name(const std::string& name);
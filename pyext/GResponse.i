@@ -61,10 +61,25 @@ public:
     virtual GEbounds    ebounds(const GEnergy& obsEnergy) const = 0;
 
     // Virtual methods
+    virtual double      irf_gradients(const GEvent&       event,
+                                      const GSource&      source,
+                                      const GObservation& obs,
+                                      GVector&            gradients,
+                                      const int&          offset = 0) const;
     virtual double      convolve(const GModelSky&    model,
                                  const GEvent&       event,
                                  const GObservation& obs,
                                  const bool&         grad = true) const;
+    virtual double      convolve(const GModelSky&    model,
+                                 const GEvent&       event,
+                                 const GObservation& obs,
+                                 GVector&            gradients,
+                                 const int&          offset = 0) const;
+
+    // Other methods
+    void                edisp_nodes(const int& nodes);
+    const int&          edisp_nodes(void) const;
+    void                edisp_kernels(const GObservation& obs) const;
 };
 
 
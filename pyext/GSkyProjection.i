@@ -27,6 +27,11 @@
 /* Put headers and other declarations here that are needed for compilation */
 #include "GSkyProjection.hpp"
 %}
+%include "std_vector.i"
+namespace std {
+   %template(SkyDirVector) vector<GSkyDir>;
+   %template(SkyPixelVector) vector<GSkyPixel>;
+}
 
 
 /***********************************************************************//**
@@ -58,8 +63,10 @@ public:
     virtual GSkyPixel       dir2pix(const GSkyDir& dir) const = 0;
 
     // Virtual methods
-    virtual std::string coordsys(void) const;
-    virtual void        coordsys(const std::string& coordsys);
+    virtual std::string            coordsys(void) const;
+    virtual void                   coordsys(const std::string& coordsys);
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
 };
 
 
@@ -137,6 +137,7 @@ public:
     double&       operator()(const int& index, const int& map = 0);
     double&       operator()(const GSkyPixel& pixel, const int& map = 0);
     double        operator()(const GSkyDir& dir, const int& map = 0) const;
+    double        operator()(const GBilinear& interpolator, const int& map = 0) const;
 
     // Methods
     void                  clear(void);
@@ -149,6 +150,7 @@ public:
     void                  nmaps(const int& nmaps);
     GSkyPixel             inx2pix(const int& index) const;
     GSkyDir               inx2dir(const int& index) const;
+    GBilinear             interpolator(const GSkyDir& dir) const;
     GSkyDir               pix2dir(const GSkyPixel& pixel) const;
     int                   pix2inx(const GSkyPixel& pixel) const;
     int                   dir2inx(const GSkyDir& dir) const;
@@ -162,6 +164,13 @@ public:
     const GSkyProjection* projection(void) const;
     void                  projection(const GSkyProjection& proj);
     const double*         pixels(void) const;
+    const float*          fpixels(void) const;
+    void                  share(void);
+    bool                  is_shared(void) const;
+    void                  single_precision(void);
+    bool                  is_single_precision(void) const;
+    void                  pixel_major(const bool& pixel_major = true);
+    bool                  is_pixel_major(void) const;
     GSkymap               extract(const int& map, const int& nmaps = 1) const;
     void                  stack_maps(void);
     void                  load(const std::string& filename);
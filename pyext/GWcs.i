@@ -54,12 +54,14 @@ public:
     virtual std::string name(void) const = 0;
     
     // Implemented virtual methods
-    virtual int         size(void) const;
-    virtual void        read(const GFitsHDU& hdu);
-    virtual void        write(GFitsHDU& hdu) const;
-    virtual double      solidangle(const GSkyPixel& pixel) const;
-    virtual GSkyDir     pix2dir(const GSkyPixel& pixel) const;
-    virtual GSkyPixel   dir2pix(const GSkyDir& dir) const;
+    virtual int                    size(void) const;
+    virtual void                   read(const GFitsHDU& hdu);
+    virtual void                   write(GFitsHDU& hdu) const;
+    virtual double                 solidangle(const GSkyPixel& pixel) const;
+    virtual GSkyDir                pix2dir(const GSkyPixel& pixel) const;
+    virtual GSkyPixel              dir2pix(const GSkyDir& dir) const;
+    virtual std::vector<GSkyDir>   pix2dir(const std::vector<GSkyPixel>& pixels) const;
+    virtual std::vector<GSkyPixel> dir2pix(const std::vector<GSkyDir>& dirs) const;
 
     // Other methods
     void   set(const std::string& coords,
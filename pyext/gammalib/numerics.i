@@ -45,8 +45,13 @@
 /* __ Make sure that exceptions are catched ______________________________ */
 %import(module="gammalib.support") "GException.i"; 
 
+/* __ Import vector class ________________________________________________ */
+%import(module="gammalib.linalg") "GVector.i";
+
 /* __ Numerics module ____________________________________________________ */
 %include "GDerivative.i"
 %include "GFunction.i"
+%include "GFunctions.i"
 %include "GIntegral.i"
+%include "GIntegrals.i"
 %include "GMath.i"
@@ -1632,3 +1632,19 @@ int gammalib::fits_move_to_hdu(const std::string& caller, void* vptr,
     // Return HDU type
     return type;
 }
+
+
+/***********************************************************************//**
+ * @brief Signal whether FITS files may be accessed from several threads
+ *
+ * @return True if cfitsio was compiled as reentrant library.
+ *
+ * If cfitsio was compiled with the reentrant option, different FITS files
+ * may be opened and read concurrently from several threads. Otherwise all
+ * FITS file access needs to be serialised by the caller.
+ ***************************************************************************/
+bool gammalib::fits_is_reentrant(void)
+{
+    // Return reentrancy flag
+    return (__ffreentrant() != 0);
+}
@@ -57,12 +57,16 @@
 #define __ffdelt(A, B) ffdelt(A, B)
 #define __ffdhdu(A, B, C) ffdhdu(A, B, C)
 #define __ffdrow(A, B, C, D) ffdrow(A, B, C, D)
+#define __ffflnm(A, B, C) ffflnm(A, B, C)
+#define __ffflus(A, B) ffflus(A, B)
 #define __ffgabc(A, B, C, D, E, F) ffgabc(A, B, C, D, E, F)
 #define __ffgcv(A, B, C, D, E, F, G, H, I, J) ffgcv(A, B, C, D, E, F, G, H, I, J)
 #define __ffgcvb(A, B, C, D, E, F, G, H, I) ffgcvb(A, B, C, D, E, F, G, H, I)
 #define __ffgcvs(A, B, C, D, E, F, G, H, I) ffgcvs(A, B, C, D, E, F, G, H, I)
 #define __ffgdes(A, B, C, D, E, F) ffgdes(A, B, C, D, E, F)
+#define __ffgbclll(A, B, C, D, E, F, G, H, I, J, K) ffgbclll(A, B, C, D, E, F, G, H, I, J, K)
 #define __ffgerr(A, B) ffgerr(A, B)
+#define __ffghadll(A, B, C, D, E) ffghadll(A, B, C, D, E)
 #define __ffghdt(A, B, C) ffghdt(A, B, C)
 #define __ffghsp(A, B, C, D) ffghsp(A, B, C, D)
 #define __ffgidm(A, B, C) ffgidm(A, B, C)
@@ -72,11 +76,14 @@
 #define __ffgisz(A, B, C, D) ffgisz(A, B, C, D)
 #define __ffgky(A, B, C, D, E, F) ffgky(A, B, C, D, E, F)
 #define __ffgkey(A, B, C, D, E) ffgkey(A, B, C, D, E)
+#define __ffgkyjj(A, B, C, D, E) ffgkyjj(A, B, C, D, E)
 #define __ffgkyn(A, B, C, D, E, F) ffgkyn(A, B, C, D, E, F)
 #define __ffgnrw(A, B, C) ffgnrw(A, B, C)
+#define __ffgnrwll(A, B, C) ffgnrwll(A, B, C)
 #define __ffgncl(A, B, C) ffgncl(A, B, C)
 #define __ffgsv(A, B, C, D, E, F, G, H, I) ffgsv(A, B, C, D, E, F, G, H, I)
 #define __ffgtcl(A, B, C, D, E, F) ffgtcl(A, B, C, D, E, F)
+#define __ffgtclll(A, B, C, D, E, F) ffgtclll(A, B, C, D, E, F)
 #define __ffibin(A, B, C, D, E, F, G, H, I) ffibin(A, B, C, D, E, F, G, H, I)
 #define __fficol(A, B, C, D, E) fficol(A, B, C, D, E)
 #define __ffiimg(A, B, C, D, E) ffiimg(A, B, C, D, E)
@@ -91,8 +98,11 @@
 #define __ffphis(A, B, C) ffphis(A, B, C)
 #define __ffpss(A, B, C, D, E, F) ffpss(A, B, C, D, E, F)
 #define __ffprec(A, B, C) ffprec(A, B, C)
+#define __ffreentrant() ::fits_is_reentrant()
+#define __ffrtnm(A, B, C) ffrtnm(A, B, C)
 #define __ffsrow(A, B, C, D) ffsrow(A, B, C, D)
 #define __ffthdu(A, B, C) ffthdu(A, B, C)
+#define __ffurlt(A, B, C) ffurlt(A, B, C)
 #define __ffuky(A, B, C, D, E, F) ffuky(A, B, C, D, E, F)
 #define __ffukye(A, B, C, D, E, F) ffukye(A, B, C, D, E, F)
 #define __ffukyd(A, B, C, D, E, F) ffukyd(A, B, C, D, E, F)
@@ -134,12 +144,16 @@ typedef fitsfile __fitsfile;
 #define __ffdelt(A, B) __dummy()
 #define __ffdhdu(A, B, C) __dummy()
 #define __ffdrow(A, B, C, D) __dummy()
+#define __ffflnm(A, B, C) __dummy()
+#define __ffflus(A, B) __dummy()
 #define __ffgabc(A, B, C, D, E, F) __dummy()
 #define __ffgcv(A, B, C, D, E, F, G, H, I, J) __dummy()
 #define __ffgcvb(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgcvs(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgdes(A, B, C, D, E, F) __dummy()
+#define __ffgbclll(A, B, C, D, E, F, G, H, I, J, K) __dummy()
 #define __ffgerr(A, B) __error(A, B)
+#define __ffghadll(A, B, C, D, E) __dummy()
 #define __ffghdt(A, B, C) __dummy()
 #define __ffghsp(A, B, C, D) __dummy()
 #define __ffgidm(A, B, C) __dummy()
@@ -149,11 +163,14 @@ typedef fitsfile __fitsfile;
 #define __ffgisz(A, B, C, D) __dummy()
 #define __ffgky(A, B, C, D, E, F) __dummy()
 #define __ffgkey(A, B, C, D, E) __dummy()
+#define __ffgkyjj(A, B, C, D, E) __dummy()
 #define __ffgkyn(A, B, C, D, E, F) __dummy()
 #define __ffgnrw(A, B, C) __dummy()
+#define __ffgnrwll(A, B, C) __dummy()
 #define __ffgncl(A, B, C) __dummy()
 #define __ffgsv(A, B, C, D, E, F, G, H, I) __dummy()
 #define __ffgtcl(A, B, C, D, E, F) __dummy()
+#define __ffgtclll(A, B, C, D, E, F) __dummy()
 #define __ffibin(A, B, C, D, E, F, G, H, I) __dummy()
 #define __fficol(A, B, C, D, E) __dummy()
 #define __ffiimg(A, B, C, D, E) __dummy()
@@ -168,8 +185,11 @@ typedef fitsfile __fitsfile;
 #define __ffphis(A, B, C) __dummy()
 #define __ffpss(A, B, C, D, E, F) __dummy()
 #define __ffprec(A, B, C) __dummy()
+#define __ffreentrant() __dummy()
+#define __ffrtnm(A, B, C) __dummy()
 #define __ffsrow(A, B, C, D) __dummy()
 #define __ffthdu(A, B, C) __dummy()
+#define __ffurlt(A, B, C) __dummy()
 #define __ffuky(A, B, C, D, E, F) __dummy()
 #define __ffukye(A, B, C, D, E, F) __dummy()
 #define __ffukyd(A, B, C, D, E, F) __dummy()
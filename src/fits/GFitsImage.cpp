@@ -28,11 +28,19 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cstring>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
 #include "GFits.hpp"
 #include "GFitsImage.hpp"
 #include "GTools.hpp"
+#if defined(HAVE_LIBCFITSIO) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define G_HAVE_MMAP
+#endif
 
 /* __ Method name definitions ____________________________________________ */
 #define G_NAXES                                      "GFitsImage::naxes(int)"
@@ -449,6 +457,7 @@ void GFitsImage::init_members(void)
     m_naxes      = NULL;
     m_num_pixels = 0;
     m_anynul     = 0;
+    m_use_mmap   = false;
 
     // Return
     return;
@@ -467,6 +476,7 @@ void GFitsImage::copy_members(const GFitsImage& image)
     m_naxis      = image.m_naxis;
     m_num_pixels = image.m_num_pixels;
     m_anynul     = image.m_anynul;
+    m_use_mmap   = image.m_use_mmap;
 
     // Copy axes
     m_naxes = NULL;
@@ -705,6 +715,187 @@ void GFitsImage::load_image(int datatype, const void* pixels,
 }
 
 
+/***********************************************************************//**
+ * @brief Load FITS image by memory mapping
+ *
+ * @return True if the image pixels were loaded, false otherwise.
+ *
+ * Loads the image pixels by memory mapping the data unit of the FITS file
+ * and by converting the big-endian pixel values in a single pass into the
+ * pixel array. This avoids the buffering of cfitsio.
+ *
+ * Memory mapping is only used for uncompressed images of disk files, if
+ * the storage type of the image has the same size as the FITS pixels, if
+ * the image is not scaled, and if no NULL value substitution is requested.
+ * In all other cases, or if memory mapping fails, the method returns false,
+ * and the image pixels need to be loaded using cfitsio.
+ *
+ * The pixels can not be used directly from the mapped file since FITS
+ * stores them in big-endian byte order, hence the mapping is released
+ * after the pixels were converted. The method assumes that the pixel
+ * array has been allocated.
+ ***************************************************************************/
+bool GFitsImage::load_image_mmap(void)
+{
+    // Initialise result
+    bool loaded = false;
+
+    #if defined(G_HAVE_MMAP)
+    // Determine size of one pixel in the FITS file. Storage types that
+    // have a different size than the FITS pixels or that are stored with
+    // an offset (signed bytes and unsigned integers) are not handled.
+    int nbytes   = 0;
+    int datatype = type();
+    if (m_bitpix == 8 && datatype == __TBYTE) {
+        nbytes = 1;
+    }
+    else if (m_bitpix == 16 && datatype == __TSHORT) {
+        nbytes = 2;
+    }
+    else if (m_bitpix == 32 && datatype == __TLONG && sizeof(long) == 4) {
+        nbytes = 4;
+    }
+    else if (m_bitpix == 64 && datatype == __TLONGLONG) {
+        nbytes = 8;
+    }
+    else if (m_bitpix == -32 && datatype == __TFLOAT) {
+        nbytes = 4;
+    }
+    else if (m_bitpix == -64 && datatype == __TDOUBLE) {
+        nbytes = 8;
+    }
+
+    // Continue only if the pixel size is known, if there are pixels and
+    // if no NULL value substitution is requested
+    if (nbytes > 0 && m_num_pixels > 0 && ptr_nulval() == NULL) {
+
+        // Move to HDU
+        move_to_hdu();
+
+        // Get file type and HDU type
+        int  status  = 0;
+        int  hdutype = 0;
+        char urltype[FLEN_FILENAME];
+        __ffurlt(FPTR(m_fitsfile), urltype, &status);
+        __ffghdt(FPTR(m_fitsfile), &hdutype, &status);
+
+        // Get scaling of image. Missing keywords signal an unscaled image.
+        int    kstatus = 0;
+        double bscale  = 1.0;
+        double bzero   = 0.0;
+        if (__ffgky(FPTR(m_fitsfile), __TDOUBLE, (char*)"BSCALE", &bscale,
+                    NULL, &kstatus) != 0) {
+            bscale  = 1.0;
+            kstatus = 0;
+        }
+        if (__ffgky(FPTR(m_fitsfile), __TDOUBLE, (char*)"BZERO", &bzero,
+                    NULL, &kstatus) != 0) {
+            bzero   = 0.0;
+            kstatus = 0;
+        }
+
+        // Check whether the image is compressed. Compressed images are
+        // stored in binary tables that have the ZIMAGE keyword.
+        char zimage[FLEN_VALUE];
+        bool compressed = (__ffgkey(FPTR(m_fitsfile), (char*)"ZIMAGE", zimage,
+                                    NULL, &kstatus) == 0);
+
+        // Get start and end of data unit in file
+        LONGLONG headstart = 0;
+        LONGLONG datastart = 0;
+        LONGLONG dataend   = 0;
+        __ffghadll(FPTR(m_fitsfile), &headstart, &datastart, &dataend, &status);
+
+        // Continue only for unscaled and uncompressed images of disk files
+        // if the data unit holds all pixels
+        LONGLONG length = (LONGLONG)m_num_pixels * nbytes;
+        if (status == 0 && std::strcmp(urltype, "file://") == 0 &&
+            hdutype == IMAGE_HDU && !compressed &&
+            bscale == 1.0 && bzero == 0.0 &&
+            datastart >= 0 && datastart + length <= dataend) {
+
+            // Get name of disk file
+            char url[FLEN_FILENAME];
+            char rootname[FLEN_FILENAME];
+            __ffflnm(FPTR(m_fitsfile), url, &status);
+            __ffrtnm(url, rootname, &status);
+            std::string filename(rootname);
+            if (filename.compare(0, 7, "file://") == 0) {
+                filename.erase(0, 7);
+            }
+
+            // Write pending cfitsio buffers to the disk file
+            __ffflus(FPTR(m_fitsfile), &status);
+
+            // Open disk file
+            int fd = (status == 0) ? ::open(filename.c_str(), O_RDONLY) : -1;
+            if (fd != -1) {
+
+                // Map data unit if the file holds all pixels
+                struct stat info;
+                if (fstat(fd, &info) == 0 &&
+                    datastart + length <= (LONGLONG)info.st_size) {
+
+                    // Map data unit starting from a page boundary
+                    LONGLONG page   = sysconf(_SC_PAGESIZE);
+                    LONGLONG offset = (datastart / page) * page;
+                    size_t   size   = (size_t)(datastart + length - offset);
+                    void*    map    = mmap(NULL, size, PROT_READ,
+                                           MAP_PRIVATE, fd, (off_t)offset);
+
+                    // Continue only if mapping was successful
+                    if (map != MAP_FAILED) {
+
+                        // Signal sequential access
+                        madvise(map, size, MADV_SEQUENTIAL);
+
+                        // Determine whether bytes need to be swapped
+                        const int one  = 1;
+                        bool      swap = (*((const char*)&one) == 1);
+
+                        // Copy and convert pixels
+                        const unsigned char* src =
+                              (const unsigned char*)map + (datastart - offset);
+                        unsigned char* dst = (unsigned char*)ptr_data();
+                        if (swap && nbytes > 1) {
+                            for (int i = 0; i < m_num_pixels; ++i) {
+                                for (int k = 0; k < nbytes; ++k) {
+                                    dst[k] = src[nbytes-1-k];
+                                }
+                                src += nbytes;
+                                dst += nbytes;
+                            }
+                        }
+                        else {
+                            std::memcpy(dst, src, (size_t)length);
+                        }
+
+                        // Unmap data unit
+                        munmap(map, size);
+
+                        // Signal success
+                        m_anynul = 0;
+                        loaded   = true;
+
+                    } // endif: mapping was successful
+
+                } // endif: file holds all pixels
+
+                // Close disk file
+                ::close(fd);
+
+            } // endif: disk file was opened
+
+        } // endif: image was eligible for memory mapping
+
+    } // endif: pixel type was valid
+    #endif
+
+    // Return result
+    return loaded;
+}
+
+
 /***********************************************************************//**
  * @brief Save FITS image
  *
@@ -806,7 +997,9 @@ void GFitsImage::save_image(int datatype, const void* pixels)
  * new ones.
  * There are two possibilities to fetch the pixels:
  * (1) In case that a FITS file is attached to the image, the pixel array
- * will be loaded from the FITS file using the load_image() method.
+ * will be loaded from the FITS file using the load_image() method, or
+ * using the load_image_mmap() method if memory mapping was requested using
+ * use_mmap().
  * (2) In case that no FITS file is attached, a new pixel array will be
  * allocated that is initalised to zero.
  ***************************************************************************/
@@ -819,9 +1012,13 @@ void GFitsImage::fetch_data(void)
         alloc_data();
         init_data();
 
-        // If a FITS file is attached then load pixels from FITS file.
+        // If a FITS file is attached then load pixels from FITS file. If
+        // memory mapping was requested then try first to load the pixels
+        // by memory mapping.
         if (FPTR(m_fitsfile)->Fptr != NULL) {
-            load_image(type(), ptr_data(), ptr_nulval(), &m_anynul);
+            if (!m_use_mmap || !load_image_mmap()) {
+                load_image(type(), ptr_data(), ptr_nulval(), &m_anynul);
+            }
         }
 
     } // endif: there were pixels available
@@ -29,10 +29,18 @@
 #include <config.h>
 #endif
 #include <cstdlib>
+#include <cstring>
 #include "GException.hpp"
 #include "GFitsCfitsio.hpp"
 #include "GFitsTableCol.hpp"
 #include "GTools.hpp"
+#if defined(HAVE_LIBCFITSIO) && (defined(__unix__) || defined(__APPLE__))
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define G_HAVE_MMAP
+#endif
 
 /* __ Method name definitions ____________________________________________ */
 #define G_ELEMENTS1                     "GFitsTableCol::elements(int&, int&)"
@@ -539,6 +547,10 @@ void GFitsTableCol::load_column(void)
  * from the FITS file. If no FITS file is attached, memory is allocated
  * to hold the column data and all cells are set to 0.
  *
+ * If memory mapping was requested using use_mmap(), column data of
+ * uncompressed disk files are read by memory mapping the file (see
+ * load_column_mmap()). All other column data are read using cfitsio.
+ *
  * The method makes use of the virtual methods 
  * GFitsTableCol::alloc_data,
  * GFitsTableCol::init_data,
@@ -585,13 +597,16 @@ void GFitsTableCol::load_column_fixed(void)
                                   status);
                 }
 
-                // Load data
-                status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, 
-                                 1, 1, m_size, ptr_nulval(), ptr_data(),
-                                 &m_anynul, &status);
-                if (status != 0) {
-                    throw GException::fits_error(G_LOAD_COLUMN_FIXED, status,
-                                    "for column '"+m_name+"'.");
+                // Load data by memory mapping the FITS file if requested
+                // and possible, otherwise load data using cfitsio
+                if (!m_use_mmap || !load_column_mmap()) {
+                    status = __ffgcv(FPTR(m_fitsfile), m_type, m_colnum, 
+                                     1, 1, m_size, ptr_nulval(), ptr_data(),
+                                     &m_anynul, &status);
+                    if (status != 0) {
+                        throw GException::fits_error(G_LOAD_COLUMN_FIXED,
+                                     status, "for column '"+m_name+"'.");
+                    }
                 }
         
             } // endif: no primary HDU found
@@ -734,6 +749,226 @@ void GFitsTableCol::load_column_variable(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Load fixed-length column from FITS file by memory mapping
+ *
+ * @return True if the column data were loaded, false otherwise.
+ *
+ * Loads the column data by memory mapping the table rows of the FITS file
+ * and by converting the big-endian column values in a single pass into the
+ * column data array. This avoids the row-wise buffering of cfitsio.
+ *
+ * Memory mapping is only used for binary table columns of uncompressed
+ * disk files without variable-length columns, if the storage type of the
+ * column has the same size as the FITS data type, if the column is not
+ * scaled, and if no NULL value substitution is requested. The layout of
+ * the table rows is determined from the column formats and the data
+ * unit address that are returned by cfitsio. In all other cases, or if
+ * memory mapping fails, the method returns false, and the column data
+ * need to be loaded using cfitsio.
+ *
+ * The method assumes that the FITS file is positioned at the HDU of the
+ * column and that the column data have been allocated.
+ ***************************************************************************/
+bool GFitsTableCol::load_column_mmap(void)
+{
+    // Initialise result
+    bool loaded = false;
+
+    #if defined(G_HAVE_MMAP)
+    // Determine size of one column element in the FITS file. Storage
+    // types that have a different size than the FITS data type are
+    // not handled.
+    int nbytes = 0;
+    switch (m_type) {
+    case __TBYTE:
+        nbytes = 1;
+        break;
+    case __TSHORT:
+        nbytes = 2;
+        break;
+    case __TLONG:
+        nbytes = (sizeof(long) == 4) ? 4 : 0;
+        break;
+    case __TLONGLONG:
+        nbytes = 8;
+        break;
+    case __TFLOAT:
+        nbytes = 4;
+        break;
+    case __TDOUBLE:
+        nbytes = 8;
+        break;
+    default:
+        break;
+    }
+
+    // Get file type, HDU type, number of columns and number of rows
+    int      status  = 0;
+    int      hdutype = 0;
+    int      ncols   = 0;
+    LONGLONG nrows   = 0;
+    char     urltype[FLEN_FILENAME];
+    __ffurlt(FPTR(m_fitsfile), urltype, &status);
+    __ffghdt(FPTR(m_fitsfile), &hdutype, &status);
+    __ffgncl(FPTR(m_fitsfile), &ncols, &status);
+    __ffgnrwll(FPTR(m_fitsfile), &nrows, &status);
+
+    // Continue only for binary table columns of uncompressed disk files
+    // for which no NULL value substitution is requested
+    if (nbytes > 0 && status == 0 && ptr_nulval() == NULL &&
+        std::strcmp(urltype, "file://") == 0 &&
+        hdutype == BINARY_TBL                &&
+        m_colnum >= 1 && m_colnum <= ncols   &&
+        nrows >= m_length) {
+
+        // Get data type and scaling of column
+        int      typecode = 0;
+        LONGLONG trepeat  = 0;
+        LONGLONG tnull    = 0;
+        double   tscale   = 1.0;
+        double   tzero    = 0.0;
+        char     ttype[FLEN_VALUE];
+        char     tunit[FLEN_VALUE];
+        char     dtype[FLEN_VALUE];
+        char     tdisp[FLEN_VALUE];
+        __ffgtclll(FPTR(m_fitsfile), m_colnum, &typecode, NULL, NULL, &status);
+        __ffgbclll(FPTR(m_fitsfile), m_colnum, ttype, tunit, dtype, &trepeat,
+                   &tscale, &tzero, &tnull, tdisp, &status);
+
+        // Determine byte offset of the column in a table row and the row
+        // length from the formats of all columns. Tables with variable-
+        // length columns are not handled.
+        LONGLONG tbcol  = 0;
+        LONGLONG rowlen = 0;
+        for (int col = 1; col <= ncols && status == 0; ++col) {
+            int      code   = 0;
+            LONGLONG repeat = 0;
+            LONGLONG width  = 0;
+            __ffgtclll(FPTR(m_fitsfile), col, &code, &repeat, &width, &status);
+            if (code < 0) {
+                rowlen = -1;
+                break;
+            }
+            if (col == m_colnum) {
+                tbcol = rowlen;
+            }
+            if (code == __TBIT) {
+                rowlen += (repeat + 7) / 8;
+            }
+            else if (code == __TSTRING) {
+                rowlen += repeat;
+            }
+            else {
+                rowlen += repeat * width;
+            }
+        }
+
+        // Get row length from header and start of data unit in file
+        LONGLONG naxis1    = 0;
+        LONGLONG headstart = 0;
+        LONGLONG datastart = 0;
+        LONGLONG dataend   = 0;
+        __ffgkyjj(FPTR(m_fitsfile), "NAXIS1", &naxis1, NULL, &status);
+        __ffghadll(FPTR(m_fitsfile), &headstart, &datastart, &dataend, &status);
+
+        // Continue only for unscaled columns of the requested type and if
+        // the row length is consistent with the header
+        if (status == 0 && typecode == m_type &&
+            tscale == 1.0 && tzero == 0.0 && rowlen == naxis1) {
+
+            // Get name of disk file
+            char url[FLEN_FILENAME];
+            char rootname[FLEN_FILENAME];
+            __ffflnm(FPTR(m_fitsfile), url, &status);
+            __ffrtnm(url, rootname, &status);
+            std::string filename(rootname);
+            if (filename.compare(0, 7, "file://") == 0) {
+                filename.erase(0, 7);
+            }
+
+            // Write pending cfitsio buffers to the disk file
+            __ffflus(FPTR(m_fitsfile), &status);
+
+            // Determine range of bytes that hold the column data
+            LONGLONG first  = datastart + tbcol;
+            LONGLONG last   = first + (LONGLONG)(m_length-1) * rowlen +
+                              (LONGLONG)m_number * nbytes;
+
+            // Open disk file
+            int fd = (status == 0 && first >= 0)
+                     ? open(filename.c_str(), O_RDONLY) : -1;
+            if (fd != -1) {
+
+                // Map range if the file holds all column data
+                struct stat info;
+                if (fstat(fd, &info) == 0 &&
+                    last <= (LONGLONG)info.st_size) {
+
+                    // Map range starting from a page boundary
+                    LONGLONG page   = sysconf(_SC_PAGESIZE);
+                    LONGLONG offset = (first / page) * page;
+                    size_t   length = (size_t)(last - offset);
+                    void*    map    = mmap(NULL, length, PROT_READ,
+                                           MAP_PRIVATE, fd, (off_t)offset);
+
+                    // Continue only if mapping was successful
+                    if (map != MAP_FAILED) {
+
+                        // Signal sequential access
+                        madvise(map, length, MADV_SEQUENTIAL);
+
+                        // Determine whether bytes need to be swapped
+                        const int one  = 1;
+                        bool      swap = (*((const char*)&one) == 1);
+
+                        // Copy and convert column data
+                        const unsigned char* src =
+                              (const unsigned char*)map + (first - offset);
+                        unsigned char* dst = (unsigned char*)ptr_data();
+                        for (int row = 0; row < m_length; ++row) {
+                            const unsigned char* in = src;
+                            for (int i = 0; i < m_number; ++i) {
+                                if (swap) {
+                                    for (int k = 0; k < nbytes; ++k) {
+                                        dst[k] = in[nbytes-1-k];
+                                    }
+                                }
+                                else {
+                                    std::memcpy(dst, in, nbytes);
+                                }
+                                in  += nbytes;
+                                dst += nbytes;
+                            }
+                            src += rowlen;
+                        }
+
+                        // Unmap range
+                        munmap(map, length);
+
+                        // Signal success
+                        m_anynul = 0;
+                        loaded   = true;
+
+                    } // endif: mapping was successful
+
+                } // endif: file holds all column data
+
+                // Close disk file
+                close(fd);
+
+            } // endif: disk file was opened
+
+        } // endif: column type and row length were valid
+
+    } // endif: column was eligible for memory mapping
+    #endif
+
+    // Return result
+    return loaded;
+}
+
+
 /***********************************************************************//**
  * @brief Save table column into FITS file
  *
@@ -942,6 +1177,7 @@ void GFitsTableCol::init_members(void)
     m_varlen   = 0;
     m_size     = 0;
     m_anynul   = 0;
+    m_use_mmap = false;
 
     // Optionally print call graph
     #if defined(G_CALL_GRAPH)
@@ -975,6 +1211,7 @@ void GFitsTableCol::copy_members(const GFitsTableCol& column)
     m_rowstart = column.m_rowstart;
     m_size     = column.m_size;
     m_anynul   = column.m_anynul;
+    m_use_mmap = column.m_use_mmap;
     FPTR_COPY(m_fitsfile, column.m_fitsfile);
 
     // Return
@@ -51,6 +51,10 @@
 #define G_SET_COLUMN               "GMatrixSymmetric::column(int&, GVector&)"
 #define G_ADD_TO_ROW           "GMatrixSymmetric::add_to_row(int&, GVector&)"
 #define G_ADD_TO_COLUMN     "GMatrixSymmetric::add_to_column(int&, GVector&)"
+#define G_ADD_OUTER_PRODUCT      "GMatrixSymmetric::add_outer_product(GVector&,"\
+                                                                  " double&)"
+#define G_ADD_OUTER_PRODUCT2     "GMatrixSymmetric::add_outer_product(double*,"\
+                                                    " int*, int&, double&)"
 #define G_CHOL_DECOMP            "GMatrixSymmetric::cholesky_decompose(int&)"
 #define G_CHOL_SOLVE      "GMatrixSymmetric::cholesky_solver(GVector&, int&)"
 #define G_CHOL_INVERT               "GMatrixSymmetric::cholesky_invert(int&)"
@@ -710,6 +714,132 @@ void GMatrixSymmetric::add_to_column(const int& column, const GVector& vector)
 }
 
 
+/***********************************************************************//**
+ * @brief Add outer product of a vector to matrix
+ *
+ * @param[in] vector Vector.
+ * @param[in] scale Scaling factor.
+ *
+ * @exception GException::matrix_vector_mismatch
+ *            Matrix dimension mismatches the vector size.
+ *
+ * Adds the scaled outer product
+ *
+ * \f[
+ *    M_{ij} = M_{ij} + s \, v_i \, v_j
+ * \f]
+ *
+ * of a vector \f$v\f$ to the matrix (rank-1 update). Only the stored
+ * triangle is updated, which halves the number of operations with respect
+ * to a general matrix.
+ ***************************************************************************/
+void GMatrixSymmetric::add_outer_product(const GVector& vector,
+                                         const double&  scale)
+{
+    // Raise an exception if the matrix and vector dimensions are not
+    // compatible
+    if (m_rows != vector.size()) {
+        throw GException::matrix_vector_mismatch(G_ADD_OUTER_PRODUCT,
+                                                 vector.size(),
+                                                 m_rows, m_cols);
+    }
+
+    // Loop over columns
+    for (int col = 0; col < m_cols; ++col) {
+
+        // Get scaled column factor. Skip column if factor is zero
+        double factor = scale * vector[col];
+        if (factor == 0.0) {
+            continue;
+        }
+
+        // Update stored part of column. The column elements are stored
+        // contiguously for row >= column
+        double* ptr = m_data + m_colstart[col] - col;
+        for (int row = col; row < m_rows; ++row) {
+            ptr[row] += factor * vector[row];
+        }
+
+    } // endfor: looped over columns
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Add outer product of a compressed vector to matrix
+ *
+ * @param[in] values Compressed vector values.
+ * @param[in] inx Row/column indices of compressed vector values.
+ * @param[in] number Number of elements in compressed vector.
+ * @param[in] scale Scaling factor.
+ *
+ * @exception GException::out_of_range
+ *            Invalid row/column index specified.
+ *
+ * Adds the scaled outer product
+ *
+ * \f[
+ *    M_{inx[k],inx[l]} = M_{inx[k],inx[l]} + s \, v_k \, v_l
+ * \f]
+ *
+ * of a compressed vector to the matrix (rank-1 update). The compressed
+ * vector holds the @p number elements @p values that are found at the
+ * row/column indices @p inx, all other vector elements are zero. The
+ * indices need to be given in ascending order.
+ *
+ * If the compressed vector covers all rows of the matrix, the update is
+ * done using contiguous memory access, which allows for vectorisation by
+ * the compiler.
+ ***************************************************************************/
+void GMatrixSymmetric::add_outer_product(const double* values,
+                                         const int*    inx,
+                                         const int&    number,
+                                         const double& scale)
+{
+    // Raise an exception if the indices are invalid
+    #if defined(G_RANGE_CHECK)
+    if (number > 0) {
+        if (inx[0] < 0) {
+            throw GException::out_of_range(G_ADD_OUTER_PRODUCT2, inx[0],
+                                           0, m_cols-1);
+        }
+        if (inx[number-1] >= m_cols) {
+            throw GException::out_of_range(G_ADD_OUTER_PRODUCT2,
+                                           inx[number-1], 0, m_cols-1);
+        }
+    }
+    #endif
+
+    // Case A: the compressed vector is a full vector, hence the columns
+    // are stored contiguously
+    if (number == m_cols) {
+        for (int col = 0; col < m_cols; ++col) {
+            double  factor = scale * values[col];
+            double* ptr    = m_data + m_colstart[col] - col;
+            for (int row = col; row < m_rows; ++row) {
+                ptr[row] += factor * values[row];
+            }
+        }
+    }
+
+    // Case B: the compressed vector is sparse, hence use index array
+    else {
+        for (int k = 0; k < number; ++k) {
+            double  factor = scale * values[k];
+            double* ptr    = m_data + m_colstart[inx[k]] - inx[k];
+            for (int l = k; l < number; ++l) {
+                ptr[inx[l]] += factor * values[l];
+            }
+        }
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Return inverted matrix
  *
@@ -31,6 +31,7 @@
 #include "GTools.hpp"
 #include "GException.hpp"
 #include "GModel.hpp"
+#include "GVector.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_ACCESS                           "GModel::operator[](std::string&)"
@@ -224,6 +225,42 @@ const GModelPar& GModel::operator[](const std::string& name) const
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Evaluate model and store parameter gradients in vector
+ *
+ * @param[in] event Observed event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first model parameter gradient (default: 0).
+ * @return Value of model.
+ *
+ * Evaluates the model and its parameter gradients for an @p event of a
+ * specific observation @p obs, and stores the gradient of the i-th model
+ * parameter at index @p offset + i of the @p gradients vector.
+ *
+ * This base class implementation calls the eval_gradients() method that
+ * sets the gradients through GModelPar::factor_gradient() and copies the
+ * parameter gradients into the vector. Models that compute their gradients
+ * without modifying the model parameters should overload this method.
+ ***************************************************************************/
+double GModel::eval_gradients(const GEvent&       event,
+                              const GObservation& obs,
+                              GVector&            gradients,
+                              const int&          offset) const
+{
+    // Evaluate model and set parameter gradients
+    double value = eval_gradients(event, obs);
+
+    // Copy parameter gradients
+    for (int i = 0; i < size(); ++i) {
+        gradients[offset+i] = (*this)[i].factor_gradient();
+    }
+
+    // Return value
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Returns reference to model parameter by index
  *
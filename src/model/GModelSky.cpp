@@ -440,20 +440,31 @@ double GModelSky::value(const GPhoton& photon)
  ***************************************************************************/
 GVector GModelSky::gradients(const GPhoton& photon)
 {
-    // Evaluate source model gradients
-    if (m_spatial  != NULL) m_spatial->eval_gradients(photon);
-    if (m_spectral != NULL) m_spectral->eval_gradients(photon.energy(),
-                                                       photon.time());
-    if (m_temporal != NULL) m_temporal->eval_gradients(photon.time());
-
-    // Set vector of gradients
+    // Initialise vector of gradients
     GVector gradients;
+
+    // Continue only if there are parameters
     if (size() > 0) {
+
+        // Allocate vector of gradients
         gradients = GVector(size());
-        for (int i = 0; i < size(); ++i) {
-            gradients[i] = m_pars[i]->factor_gradient();
-        }
-    }
+
+        // Determine indices of first spectral and temporal parameters
+        int i_spectral = (m_spatial  != NULL) ? m_spatial->size() : 0;
+        int i_temporal = (m_spectral != NULL) ? m_spectral->size() + i_spectral
+                                              : i_spectral;
+
+        // Evaluate source model gradients
+        if (m_spatial  != NULL) m_spatial->eval_gradients(photon, gradients);
+        if (m_spectral != NULL) m_spectral->eval_gradients(photon.energy(),
+                                                           photon.time(),
+                                                           gradients,
+                                                           i_spectral);
+        if (m_temporal != NULL) m_temporal->eval_gradients(photon.time(),
+                                                           gradients,
+                                                           i_temporal);
+
+    } // endif: there were parameters
 
     // Return gradients
     return gradients;
@@ -467,7 +478,7 @@ GVector GModelSky::gradients(const GPhoton& photon)
  * @param[in] obs Observation.
  * @return Value of sky model
  *
- * Evalutes the value of the sky model for an @p event of a specific
+ * Evaluates the value of the sky model for an @p event of a specific
  * observation @p obs.
  ***************************************************************************/
 double GModelSky::eval(const GEvent& event, const GObservation& obs) const
@@ -488,7 +499,7 @@ double GModelSky::eval(const GEvent& event, const GObservation& obs) const
  * @param[in] obs Observation.
  * @return Value of sky model
  *
- * Evalutes the value of the sky model and of the parameter for an @p event
+ * Evaluates the value of the sky model and of the parameter for an @p event
  * of a specific observation @p obs.
  *
  * While the value of the sky model is returned by the method, the parameter
@@ -505,6 +516,34 @@ double GModelSky::eval_gradients(const GEvent&       event,
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate sky model and store parameter gradients in vector
+ *
+ * @param[in] event Observed event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first model parameter gradient (default: 0).
+ * @return Value of sky model
+ *
+ * Evaluates the value of the sky model and of the parameter gradients for
+ * an @p event of a specific observation @p obs. The gradient of the i-th
+ * model parameter is stored at index @p offset + i of the @p gradients
+ * vector. The model parameters are not modified by this method.
+ ***************************************************************************/
+double GModelSky::eval_gradients(const GEvent&       event,
+                                 const GObservation& obs,
+                                 GVector&            gradients,
+                                 const int&          offset) const
+{
+    // Evaluate function
+    double value = obs.response()->convolve(*this, event, obs, gradients,
+                                            offset);
+
+    // Return
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Return spatially integrated sky model
  *
@@ -266,6 +266,31 @@ bool GModelSpatial::has_par(const std::string& name) const
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate function and set parameter gradients
+ *
+ * @param[in] photon Incident photon.
+ * @return Model value.
+ *
+ * Evaluates the spatial model and sets the analytical gradients of all
+ * model parameters using GModelPar::factor_gradient().
+ ***************************************************************************/
+double GModelSpatial::eval_gradients(const GPhoton& photon) const
+{
+    // Evaluate model and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(photon, gradients);
+
+    // Set parameter gradients (circumvent const correctness)
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
+
+    // Return value
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Autoscale parameters
  *
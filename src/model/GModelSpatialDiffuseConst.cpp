@@ -247,13 +247,17 @@ double GModelSpatialDiffuseConst::eval(const GPhoton& photon) const
  * @brief Evaluate function and gradients
  *
  * @param[in] photon Incident photon (ignored).
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * Evaluates the spatial part for an isotropic source model and set the
  * parameter gradient. By definition, the value and gradient is independent
  * from the sky direction. The value is 1, the parameter gradient is 0.
  ***************************************************************************/
-double GModelSpatialDiffuseConst::eval_gradients(const GPhoton& photon) const
+double GModelSpatialDiffuseConst::eval_gradients(const GPhoton& photon,
+                                                 GVector&       gradients,
+                                                 const int&     offset) const
 {
     // Compute function value
     double value = m_value.value();
@@ -261,8 +265,8 @@ double GModelSpatialDiffuseConst::eval_gradients(const GPhoton& photon) const
     // Compute partial derivatives of the parameter values
     double g_norm = (m_value.is_free()) ? m_value.scale() : 0.0;
 
-    // Set gradient (circumvent const correctness)
-    const_cast<GModelSpatialDiffuseConst*>(this)->m_value.factor_gradient(g_norm);
+    // Set gradient
+    gradients[offset] = g_norm;
 
     // Return value
     return value;
@@ -34,6 +34,7 @@
 #include "GHealpix.hpp"
 #include "GModelSpatialDiffuseCube.hpp"
 #include "GModelSpatialRegistry.hpp"
+#include "GFits.hpp"
 #include "GFitsTable.hpp"
 #include "GFitsTableCol.hpp"
 
@@ -294,12 +295,14 @@ double GModelSpatialDiffuseCube::eval(const GPhoton& photon) const
     // Continue only if there is energy information for the map cube
     if (m_logE.size() > 0) {
 
+        // Compute bi-linear interpolator for photon direction. The
+        // interpolator is used for both energy layers
+        GBilinear interpolator = m_cube.interpolator(photon.dir());
+
         // Compute diffuse model value by interpolation in log10(energy)
-        m_logE.set_value(photon.energy().log10MeV());
-        double intensity = m_logE.wgt_left() *
-                           m_cube(photon.dir(), m_logE.inx_left()) +
-                           m_logE.wgt_right() *
-                           m_cube(photon.dir(), m_logE.inx_right());
+        GNodeArray::weights w = m_logE.locate(photon.energy().log10MeV());
+        double intensity = w.wgt_left  * m_cube(interpolator, w.inx_left) +
+                           w.wgt_right * m_cube(interpolator, w.inx_right);
 
         // Set the intensity times the scaling factor as model value
         value = intensity * m_value.value();
@@ -320,12 +323,16 @@ double GModelSpatialDiffuseCube::eval(const GPhoton& photon) const
  * @brief Evaluate function and gradients
  *
  * @param[in] photon Incident photon.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * Computes the spatial diffuse model as function of photon parameters and
  * sets the value gradient.
  ***************************************************************************/
-double GModelSpatialDiffuseCube::eval_gradients(const GPhoton& photon) const
+double GModelSpatialDiffuseCube::eval_gradients(const GPhoton& photon,
+                                                GVector&       gradients,
+                                                const int&     offset) const
 {
     // Initialise intensity
     double intensity = 0.0;
@@ -336,12 +343,14 @@ double GModelSpatialDiffuseCube::eval_gradients(const GPhoton& photon) const
     // Continue only if there is energy information for the map cube
     if (m_logE.size() > 0) {
 
+        // Compute bi-linear interpolator for photon direction. The
+        // interpolator is used for both energy layers
+        GBilinear interpolator = m_cube.interpolator(photon.dir());
+
         // Compute diffuse model value by interpolation in log10(energy)
-        m_logE.set_value(photon.energy().log10MeV());
-        intensity = m_logE.wgt_left() *
-                    m_cube(photon.dir(), m_logE.inx_left()) +
-                    m_logE.wgt_right() *
-                    m_cube(photon.dir(), m_logE.inx_right());
+        GNodeArray::weights w = m_logE.locate(photon.energy().log10MeV());
+        intensity = w.wgt_left  * m_cube(interpolator, w.inx_left) +
+                    w.wgt_right * m_cube(interpolator, w.inx_right);
 
 
     } // endif: energy information was available
@@ -358,8 +367,8 @@ double GModelSpatialDiffuseCube::eval_gradients(const GPhoton& photon) const
         g_value = 0.0;
     }
 
-	// Set gradient to 0 (circumvent const correctness)
-	const_cast<GModelSpatialDiffuseCube*>(this)->m_value.factor_gradient(g_value);
+    // Set gradient
+    gradients[offset] = g_value;
 
     // Return value
     return value;
@@ -727,6 +736,23 @@ void GModelSpatialDiffuseCube::load(const std::string& filename)
     // Load cube
     m_cube.load(fname);
 
+    // If the cube is stored in single precision in the FITS file then keep
+    // the pixels in single precision, as the model only reads the cube
+    GFits fits(fname);
+    if (fits.size() > 0 && fits.at(0)->exttype() == GFitsHDU::HT_IMAGE &&
+        fits.image(0)->bitpix() == -32) {
+        m_cube.single_precision();
+    }
+    fits.close();
+
+    // Store the pixels in pixel-major layout, so that the two maps that
+    // are interpolated in energy are close in memory
+    m_cube.pixel_major();
+
+    // Declare the pixels as shared, so that copies of the model do not
+    // copy the cube
+    m_cube.share();
+
     // Load energies
     GEnergies energies(fname);
 
@@ -868,6 +894,10 @@ void GModelSpatialDiffuseCube::set_mc_cone(const GSkyDir& centre,
     // Fetch cube
     fetch_cube();
 
+    // Get constant reference to map cube to make sure that the pixels of
+    // the map cube are not modified
+    const GSkymap& cube = m_cube;
+
     // Determine number of cube pixels and maps
     int npix  = pixels();
     int nmaps = maps();
@@ -959,10 +989,10 @@ void GModelSpatialDiffuseCube::set_mc_cone(const GSkyDir& centre,
                     std::vector<int> neighbours = healpix->neighbours(k);
 
                     // Loop over neighbours
-                    double max = m_cube(k,i);
+                    double max = cube(k,i);
                     for (int j = 0; j < neighbours.size(); ++j) {
                         if (neighbours[j] != -1) {
-                            double value = m_cube(neighbours[j],i);
+                            double value = cube(neighbours[j],i);
                             if (value > max) {
                                 max = value;
                             }
@@ -985,7 +1015,7 @@ void GModelSpatialDiffuseCube::set_mc_cone(const GSkyDir& centre,
                 // and the centre of each edge.
                 for (int k = 0; k < npix; ++k) {
                     GSkyPixel pixel = m_cube.inx2pix(k);
-                    double    max   = m_cube(pixel,i);
+                    double    max   = cube(pixel,i);
                     for (int ix = -1; ix < 2; ++ix) {
                         for (int iy = -1; iy < 2; ++iy) {
                             if (ix != 0 || iy != 0) {
@@ -1153,6 +1183,10 @@ void GModelSpatialDiffuseCube::init_members(void)
  * @brief Copy class members
  *
  * @param[in] model Spatial map cube model.
+ *
+ * The map cube pixels are shared between the copies if they were declared
+ * as shared, which is the case for map cubes that were loaded from a file
+ * or set using the cube() method.
  ***************************************************************************/
 void GModelSpatialDiffuseCube::copy_members(const GModelSpatialDiffuseCube& model)
 {
@@ -1194,14 +1228,18 @@ void GModelSpatialDiffuseCube::free_members(void)
  * @brief Fetch cube
  *
  * Load diffuse cube if it is not yet loaded. The loading is thread save.
+ * The loaded flag is checked again within the critical section so that the
+ * cube is loaded only once if several threads request it at the same time.
  ***************************************************************************/
 void GModelSpatialDiffuseCube::fetch_cube(void) const
 {
     // Load cube if it is not yet loaded
     if (!m_loaded && !m_filename.empty()) {
-        #pragma omp critical
+        #pragma omp critical(GModelSpatialDiffuseCube_fetch_cube)
         {
-            const_cast<GModelSpatialDiffuseCube*>(this)->load(m_filename);
+            if (!m_loaded) {
+                const_cast<GModelSpatialDiffuseCube*>(this)->load(m_filename);
+            }
         }
     }
 
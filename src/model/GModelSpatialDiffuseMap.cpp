@@ -292,6 +292,8 @@ double GModelSpatialDiffuseMap::eval(const GPhoton& photon) const
  * @brief Return intensity of skymap and gradient
  *
  * @param[in] photon Incident photon.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Sky map intensity.
  *
  * Returns the intensity of the skymap at the specified sky direction
@@ -299,7 +301,9 @@ double GModelSpatialDiffuseMap::eval(const GPhoton& photon) const
  * with respect to the normalization factor. If the sky direction falls
  * outside the skymap, an intensity of 0 is returned.
  ***************************************************************************/
-double GModelSpatialDiffuseMap::eval_gradients(const GPhoton& photon) const
+double GModelSpatialDiffuseMap::eval_gradients(const GPhoton& photon,
+                                               GVector&       gradients,
+                                               const int&     offset) const
 {
     // Get skymap intensity
     double intensity = m_map(photon.dir());
@@ -307,8 +311,8 @@ double GModelSpatialDiffuseMap::eval_gradients(const GPhoton& photon) const
     // Compute partial derivatives of the parameter values
     double g_value = (m_value.is_free()) ? intensity * m_value.scale() : 0.0;
 
-    // Set gradient to 0 (circumvent const correctness)
-    const_cast<GModelSpatialDiffuseMap*>(this)->m_value.factor_gradient(g_value);
+    // Set gradient
+    gradients[offset] = g_value;
 
     // Return intensity times normalization factor
     return (intensity * m_value.value());
@@ -724,6 +728,8 @@ void GModelSpatialDiffuseMap::init_members(void)
  * @brief Copy class members
  *
  * @param[in] model Spatial map cube model.
+ *
+ * The sky map pixels are shared between the copies.
  ***************************************************************************/
 void GModelSpatialDiffuseMap::copy_members(const GModelSpatialDiffuseMap& model)
 {
@@ -731,14 +737,16 @@ void GModelSpatialDiffuseMap::copy_members(const GModelSpatialDiffuseMap& model)
     m_value         = model.m_value;
     m_map           = model.m_map;
     m_filename      = model.m_filename;
-    m_mc_cache      = model.m_mc_cache;
-    m_mc_max        = model.m_mc_max;
     m_normalize     = model.m_normalize;
     m_has_normalize = model.m_has_normalize;
     m_norm          = model.m_norm;
     m_centre        = model.m_centre;
     m_radius        = model.m_radius;
 
+    // Copy MC cache
+    m_mc_cache      = model.m_mc_cache;
+    m_mc_max        = model.m_mc_max;
+
     // Set parameter pointer(s)
     m_pars.clear();
     m_pars.push_back(&m_value);
@@ -763,13 +771,11 @@ void GModelSpatialDiffuseMap::free_members(void)
  *
  * Prepares a sky map after loading. The map is normalized so that the total
  * flux in the map amounts to 1 ph/cm2/s. Negative skymap pixels are set to
- * zero intensity.
+ * zero intensity. The pixels of the sky map are then declared as shared,
+ * so that copies of the model do not copy the sky map.
  *
- * The method also initialises a cache for Monte Carlo sampling of the
- * skymap. This Monte Carlo cache consists of a linear array that maps a
- * value between 0 and 1 into the skymap pixel. A second array contains the
- * maximum expected value for each pixel which is also used in Monte Carlo
- * sampling.
+ * The method also initialises the cache for Monte Carlo sampling of the
+ * skymap (see set_mc_cache()).
  *
  * Note that if the GSkymap object contains multiple maps, only the first
  * map is used.
@@ -788,16 +794,9 @@ void GModelSpatialDiffuseMap::prepare_map(void)
     // Continue only if there are skymap pixels
     if (npix > 0) {
 
-        // Reserve space for all pixels in cache
-        m_mc_cache.reserve(npix+1);
-        m_mc_max.reserve(npix);
-
-        // Set first cache value to 0
-        m_mc_cache.push_back(0.0);
-
-        // Initialise cache with cumulative pixel fluxes and compute total
-        // flux in skymap for normalization. Negative pixels are set to
-        // zero intensity in the skymap. Invalid pixels are also filtered.
+        // Compute total flux in skymap for normalization. Negative pixels
+        // are set to zero intensity in the skymap. Invalid pixels are also
+        // filtered.
         double sum = 0.0;
         for (int i = 0; i < npix; ++i) {
             double flux = m_map.flux(i);
@@ -808,43 +807,128 @@ void GModelSpatialDiffuseMap::prepare_map(void)
                 flux     = 0.0;
             }
             sum += flux;
-            m_mc_cache.push_back(sum);
         }
 
-        // Normalize fluxes in the cache so that the values in the cache
-        // run from 0 to 1. Optionally also normalize the sky map.
+        // Optionally normalize the sky map
         if (sum > 0.0) {
             if (normalize()) {
                 for (int i = 0; i < npix; ++i) {
-                    m_map(i)      /= sum;
-                    m_mc_cache[i] /= sum;
+                    m_map(i) /= sum;
                 }
                 m_norm = 1.0;
             }
             else {
-                for (int i = 0; i < npix; ++i) {
-                    m_mc_cache[i] /= sum;
-                }
                 m_norm = sum;
             }
         }
 
+        // If we have a HealPix map then set radius to 180 deg
+        if (m_map.projection()->code() == "HPX") {
+            m_radius = 180.0;
+        }
+
+        // ... otherwise compute map centre and radius
+        else {
+        
+            // Get map centre
+            GSkyPixel centre(m_map.nx()/2.0, m_map.ny()/2.0);
+            m_centre = m_map.pix2dir(centre);
+
+            // Determine map radius
+            for (int i = 0; i < npix; ++i) {
+                double radius = m_map.inx2dir(i).dist_deg(m_centre);
+                if (radius > m_radius) {
+                    m_radius = radius;
+                }
+            }
+
+        } // endelse: computed map centre and radius
+
+        // Dump preparation results
+        #if defined(G_DEBUG_PREPARE)
+        double sum_control = 0.0;
+        for (int i = 0; i < npix; ++i) {
+            double flux = m_map.flux(i);
+            if (flux >= 0.0) {
+                sum_control += flux;
+            }
+        }
+        std::cout << "Total flux before normalization: " << sum << std::endl;
+        std::cout << "Total flux after normalization : " << sum_control << std::endl;
+        #endif
+
+        // Declare sky map pixels as shared
+        m_map.share();
+
+        // Set Monte Carlo cache
+        set_mc_cache();
+
+    } // endif: there were skymap pixels
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set Monte Carlo cache
+ *
+ * Initialises a cache for Monte Carlo sampling of the skymap. This Monte
+ * Carlo cache consists of a linear array that maps a value between 0 and 1
+ * into the skymap pixel. A second array contains the maximum expected value
+ * for each pixel which is also used in Monte Carlo sampling.
+ ***************************************************************************/
+void GModelSpatialDiffuseMap::set_mc_cache(void)
+{
+    // Initialise cache
+    m_mc_cache.clear();
+    m_mc_max.clear();
+
+    // Determine number of skymap pixels
+    int npix = m_map.npix();
+
+    // Continue only if there are skymap pixels
+    if (npix > 0) {
+
+        // Reserve space for all pixels in cache
+        m_mc_cache.reserve(npix+1);
+        m_mc_max.reserve(npix);
+
+        // Set first cache value to 0
+        m_mc_cache.push_back(0.0);
+
+        // Initialise cache with cumulative pixel fluxes and compute total
+        // flux in skymap for normalization. Negative pixels are ignored.
+        double sum = 0.0;
+        for (int i = 0; i < npix; ++i) {
+            double flux = m_map.flux(i);
+            if (flux > 0.0) {
+                sum += flux;
+            }
+            m_mc_cache.push_back(sum);
+        }
+
+        // Normalize fluxes in the cache so that the values in the cache
+        // run from 0 to 1
+        if (sum > 0.0) {
+            for (int i = 0; i < npix; ++i) {
+                m_mc_cache[i] /= sum;
+            }
+        }
+
         // Make sure that last pixel in the cache is >1
         m_mc_cache[npix] = 1.0001;
 
-        // If we have a HealPix map then set radius to 180 deg
+        // If we have a HealPix map then compute maximum value that may occur
+        // from bilinear interpolation within this pixel and push this value
+        // on the stack. We do this by checking values of all neighbours.
         if (m_map.projection()->code() == "HPX") {
 
             // Get pointer on HealPix projection
             const GHealpix* healpix =
                 static_cast<const GHealpix*>(m_map.projection());
 
-            // Set the map radius to full sky
-            m_radius = 180.0;
-
-            // Compute maximum value that may occur from bilinear
-            // interpolation within this pixel and push this value on the
-            // stack. We do this by checking values of all neighbours.
+            // Loop over pixels
             for (int i = 0; i < npix; ++i) {
 
                 // Get neighbours
@@ -868,25 +952,11 @@ void GModelSpatialDiffuseMap::prepare_map(void)
 
         } // endif: Healpix projection
 
-        // ... otherwise compute map centre and radius
+        // ... otherwise compute maximum value that may occur from bilinear
+        // interpolation within this pixel and push this value on the
+        // stack. We do this by checking the map values at the corners
+        // and the centre of each edge.
         else {
-        
-            // Get map centre
-            GSkyPixel centre(m_map.nx()/2.0, m_map.ny()/2.0);
-            m_centre = m_map.pix2dir(centre);
-
-            // Determine map radius
-            for (int i = 0; i < npix; ++i) {
-                double radius = m_map.inx2dir(i).dist_deg(m_centre);
-                if (radius > m_radius) {
-                    m_radius = radius;
-                }
-            }
-
-            // Compute maximum value that may occur from bilinear
-            // interpolation within this pixel and push this value on the
-            // stack. We do this by checking the map values at the corners
-            // and the centre of each edge.
             for (int i = 0; i < npix; ++i) {
                 GSkyPixel pixel = m_map.inx2pix(i);
                 double    max   = m_map(pixel);
@@ -906,21 +976,7 @@ void GModelSpatialDiffuseMap::prepare_map(void)
                 }
                 m_mc_max.push_back(max);
             }
-
-        } // endelse: computed map centre and radius
-
-        // Dump preparation results
-        #if defined(G_DEBUG_PREPARE)
-        double sum_control = 0.0;
-        for (int i = 0; i < npix; ++i) {
-            double flux = m_map.flux(i);
-            if (flux >= 0.0) {
-                sum_control += flux;
-            }
-        }
-        std::cout << "Total flux before normalization: " << sum << std::endl;
-        std::cout << "Total flux after normalization : " << sum_control << std::endl;
-        #endif
+        } // endelse: computed maximum values
 
         // Dump cache values for debugging
         #if defined(G_DEBUG_CACHE)
@@ -181,23 +181,57 @@ double GModelSpatialElliptical::eval(const GPhoton& photon) const
 
 
 /***********************************************************************//**
- * @brief Return model value and set analytical gradients
+ * @brief Return model value and analytical gradients
  *
  * @param[in] photon Incident Photon.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  *
  * Evaluates the elliptical spatial model value and analytical model
  * parameter gradients for a specific incident @p photon.
  ***************************************************************************/
-double GModelSpatialElliptical::eval_gradients(const GPhoton& photon) const
+double GModelSpatialElliptical::eval_gradients(const GPhoton& photon,
+                                               GVector&       gradients,
+                                               const int&     offset) const
 {
     // Compute distance from source and position angle (in radians)
     const GSkyDir& srcDir = photon.dir();
     double theta          = dir().dist(srcDir);
     double posang         = dir().posang(srcDir);
 
-    // Evaluate model and set gradients
+    // Evaluate model and gradients
     double value = eval_gradients(theta, posang, photon.energy(),
-                                  photon.time());
+                                  photon.time(), gradients, offset);
+
+    // Return result
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Return model value and set analytical gradients
+ *
+ * @param[in] theta Angular distance from model centre (radians).
+ * @param[in] posangle Position angle (counterclockwise from North) (radians).
+ * @param[in] energy Photon energy.
+ * @param[in] time Photon arrival time.
+ *
+ * Evaluates the elliptical spatial model value and sets the analytical
+ * gradients of all model parameters using GModelPar::factor_gradient().
+ ***************************************************************************/
+double GModelSpatialElliptical::eval_gradients(const double&  theta,
+                                               const double&  posangle,
+                                               const GEnergy& energy,
+                                               const GTime&   time) const
+{
+    // Evaluate model and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(theta, posangle, energy, time, gradients);
+
+    // Set parameter gradients (circumvent const correctness)
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
 
     // Return result
     return value;
@@ -476,7 +510,7 @@ void GModelSpatialElliptical::init_members(void)
     m_semimajor.free();
     m_semimajor.scale(1.0);
     m_semimajor.gradient(0.0);
-    m_semimajor.has_grad(false); // Elliptical components never have gradients
+    m_semimajor.has_grad(false); // Gradient support is signalled by derived classes
 
     // Initialise semi-minor axis
     m_semiminor.clear();
@@ -487,7 +521,7 @@ void GModelSpatialElliptical::init_members(void)
     m_semiminor.free();
     m_semiminor.scale(1.0);
     m_semiminor.gradient(0.0);
-    m_semiminor.has_grad(false); // Elliptical components never have gradients
+    m_semiminor.has_grad(false); // Gradient support is signalled by derived classes
 
     // Set parameter pointer(s)
     m_pars.clear();
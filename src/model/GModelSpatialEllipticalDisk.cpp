@@ -335,9 +335,12 @@ double GModelSpatialEllipticalDisk::eval(const double&  theta,
  * @param[in] posangle Position angle (counterclockwise from North) (radians).
  * @param[in] energy Photon energy.
  * @param[in] time Photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
- * Evaluates the function value. No gradient computation is implemented as
+ * Evaluates the function value and sets all gradients to zero. No
+ * gradient computation is implemented as
  * Elliptical models will be convolved with the instrument response and thus
  * require the numerical computation of the derivatives.
  *
@@ -346,8 +349,15 @@ double GModelSpatialEllipticalDisk::eval(const double&  theta,
 double GModelSpatialEllipticalDisk::eval_gradients(const double&  theta,
                                                    const double&  posangle,
                                                    const GEnergy& energy,
-                                                   const GTime&   time) const
+                                                   const GTime&   time,
+                                                   GVector&       gradients,
+                                                   const int&     offset) const
 {
+    // Set gradients
+    for (int i = 0; i < size(); ++i) {
+        gradients[offset+i] = 0.0;
+    }
+
     // Return value
     return (eval(theta, posangle, energy, time));
 }
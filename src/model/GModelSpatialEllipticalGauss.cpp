@@ -338,21 +338,104 @@ double GModelSpatialEllipticalGauss::eval(const double&  theta,
  * @param[in] posangle Position angle (counterclockwise from North) (radians).
  * @param[in] energy Photon energy.
  * @param[in] time Photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
- * Evaluates the function value. No gradient computation is implemented as
- * Elliptical models will be convolved with the instrument response and thus
- * require the numerical computation of the derivatives.
+ * Evaluates the function value and the gradients with respect to the
+ * position angle and the semi-major and semi-minor axes. With the
+ * exponent
+ *
+ * \f[
+ *    x = \theta^2 \left( t_1 \cos^2 \phi + t_2 \sin^2 \phi +
+ *                       t_3 \sin \phi \cos \phi \right)
+ * \f]
+ *
+ * and the help terms \f$t_1\f$, \f$t_2\f$ and \f$t_3\f$ that are
+ * computed by update(), the model is
+ * \f$S_{\rm p} = {\tt m\_norm} \exp(-x)\f$ with
+ * \f${\tt m\_norm} = 1 / (2 \pi a b)\f$. The gradients are hence
+ *
+ * \f[
+ *    \frac{\partial S_{\rm p}}{\partial a} = S_{\rm p} \left(
+ *    \frac{\theta^2 s_a}{a^3} - \frac{1}{a} \right) , \quad
+ *    \frac{\partial S_{\rm p}}{\partial b} = S_{\rm p} \left(
+ *    \frac{\theta^2 s_b}{b^3} - \frac{1}{b} \right) , \quad
+ *    \frac{\partial S_{\rm p}}{\partial \phi_0} = -S_{\rm p}
+ *    \frac{\partial x}{\partial \phi_0}
+ * \f]
+ *
+ * where
+ * \f$s_a = \sin^2 \phi_0 \cos^2 \phi + \cos^2 \phi_0 \sin^2 \phi +
+ *          \sin 2\phi_0 \sin \phi \cos \phi\f$,
+ * \f$s_b = \cos^2 \phi_0 \cos^2 \phi + \sin^2 \phi_0 \sin^2 \phi -
+ *          \sin 2\phi_0 \sin \phi \cos \phi\f$,
+ * \f$a\f$ and \f$b\f$ are the semi-major and semi-minor axes and
+ * \f$\phi_0\f$ is the position angle of the ellipse. The gradients with
+ * respect to the position of the model centre are set to zero as they are
+ * computed numerically.
  *
  * See the eval() method for more information.
  ***************************************************************************/
 double GModelSpatialEllipticalGauss::eval_gradients(const double&  theta,
                                                     const double&  posangle,
                                                     const GEnergy& energy,
-                                                    const GTime&   time) const
+                                                    const GTime&   time,
+                                                    GVector&       gradients,
+                                                    const int&     offset) const
 {
+    // Compute value
+    double value = eval(theta, posangle, energy, time);
+
+    // Initialise gradients
+    double g_posangle  = 0.0;
+    double g_semimajor = 0.0;
+    double g_semiminor = 0.0;
+
+    // Compute gradients only if the model is positive. In that case the
+    // precomputation cache was updated by eval()
+    if (value > 0.0) {
+
+        // Perform computations
+        double sinphi = std::sin(posangle);
+        double cosphi = std::cos(posangle);
+        double sin2   = sinphi * sinphi;
+        double cos2   = cosphi * cosphi;
+        double sincos = sinphi * cosphi;
+        double theta2 = theta * theta;
+
+        // Compute help terms for the semi-axis derivatives
+        double s_major = m_sinpos2 * cos2 + m_cospos2 * sin2 + m_sin2pos * sincos;
+        double s_minor = m_cospos2 * cos2 + m_sinpos2 * sin2 - m_sin2pos * sincos;
+
+        // Compute derivative of exponent with respect to position angle
+        double cos2pos = m_cospos2 - m_sinpos2;
+        double d_pos   = m_term3 * (cos2 - sin2) +
+                         cos2pos * (1.0/m_major2 - 1.0/m_minor2) * sincos;
+
+        // Compute partial derivatives
+        g_posangle  = -value * theta2 * d_pos;
+        g_semimajor = value * (theta2 * s_major / (m_major2 * m_major_rad) -
+                               1.0 / m_major_rad);
+        g_semiminor = value * (theta2 * s_minor / (m_minor2 * m_minor_rad) -
+                               1.0 / m_minor_rad);
+
+        // Convert to parameter factor gradients
+        g_posangle  *= gammalib::deg2rad * m_posangle.scale();
+        g_semimajor *= gammalib::deg2rad * m_semimajor.scale();
+        g_semiminor *= gammalib::deg2rad * m_semiminor.scale();
+
+    } // endif: model was positive
+
+    // Set gradients
+    gradients[offset]   = 0.0;
+    gradients[offset+1] = 0.0;
+    gradients[offset+2] = g_posangle;
+    gradients[offset+3] = g_semimajor;
+    gradients[offset+4] = g_semiminor;
+
     // Return value
-    return (eval(theta, posangle, energy, time));
+    return value;
 }
 
 
@@ -659,6 +742,12 @@ std::string GModelSpatialEllipticalGauss::print(const GChatter& chatter) const
  ***************************************************************************/
 void GModelSpatialEllipticalGauss::init_members(void)
 {
+    // Signal gradient support for the shape parameters. The gradients are
+    // computed by eval_gradients()
+    m_posangle.has_grad(true);
+    m_semimajor.has_grad(true);
+    m_semiminor.has_grad(true);
+
     // Initialise precomputation cache. Note that zero values flag
     // uninitialised as a zero radius is not meaningful
     m_last_minor        = 0.0;
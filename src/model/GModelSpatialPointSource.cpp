@@ -269,6 +269,8 @@ double GModelSpatialPointSource::eval(const GPhoton& photon) const
  * @brief Evaluate function and gradients
  *
  * @param[in] photon Incident photon.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * Evaluates the spatial part for a point source model and the gradient.
@@ -277,10 +279,17 @@ double GModelSpatialPointSource::eval(const GPhoton& photon) const
  * 0.1 arcsec, i.e. well below the angular resolution of gamma-ray
  * telescopes).
  *
- * This method does not provide valid parameter gradients.
+ * This method does not provide parameter gradients. The gradients with
+ * respect to the source position are set to zero.
  ***************************************************************************/
-double GModelSpatialPointSource::eval_gradients(const GPhoton& photon) const
+double GModelSpatialPointSource::eval_gradients(const GPhoton& photon,
+                                                GVector&       gradients,
+                                                const int&     offset) const
 {
+    // Set gradients
+    gradients[offset]   = 0.0;
+    gradients[offset+1] = 0.0;
+
     // Return value
     return (eval(photon));
 }
@@ -567,7 +576,7 @@ void GModelSpatialPointSource::init_members(void)
     m_ra.fix();
     m_ra.scale(1.0);
     m_ra.gradient(0.0);
-    m_ra.has_grad(false);
+    m_ra.has_grad(true);
 
     // Initialise Declination
     m_dec.clear();
@@ -576,7 +585,7 @@ void GModelSpatialPointSource::init_members(void)
     m_dec.fix();
     m_dec.scale(1.0);
     m_dec.gradient(0.0);
-    m_dec.has_grad(false);
+    m_dec.has_grad(true);
 
     // Set parameter pointer(s)
     m_pars.clear();
@@ -180,20 +180,53 @@ double GModelSpatialRadial::eval(const GPhoton& photon) const
 
 
 /***********************************************************************//**
- * @brief Return model value and set analytical gradients
+ * @brief Return model value and analytical gradients
  *
  * @param[in] photon Incident Photon.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  *
  * Evaluates the radial spatial model value and analytical model parameter
  * gradients for a specific incident @p photon.
  ***************************************************************************/
-double GModelSpatialRadial::eval_gradients(const GPhoton& photon) const
+double GModelSpatialRadial::eval_gradients(const GPhoton& photon,
+                                           GVector&       gradients,
+                                           const int&     offset) const
 {
     // Compute distance from source (in radians)
     double theta = photon.dir().dist(dir());
 
-    // Evaluate model and set gradients
-    double value = eval_gradients(theta, photon.energy(), photon.time());
+    // Evaluate model and gradients
+    double value = eval_gradients(theta, photon.energy(), photon.time(),
+                                  gradients, offset);
+
+    // Return result
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Return model value and set analytical gradients
+ *
+ * @param[in] theta Angular distance from model centre (radians).
+ * @param[in] energy Photon energy.
+ * @param[in] time Photon arrival time.
+ *
+ * Evaluates the radial spatial model value and sets the analytical
+ * gradients of all model parameters using GModelPar::factor_gradient().
+ ***************************************************************************/
+double GModelSpatialRadial::eval_gradients(const double&  theta,
+                                           const GEnergy& energy,
+                                           const GTime&   time) const
+{
+    // Evaluate model and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(theta, energy, time, gradients);
+
+    // Set parameter gradients (circumvent const correctness)
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
 
     // Return result
     return value;
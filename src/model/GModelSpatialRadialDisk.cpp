@@ -286,20 +286,48 @@ double GModelSpatialRadialDisk::eval(const double&  theta,
  * @param[in] theta Angular distance from disk centre (radians).
  * @param[in] energy Photon energy.
  * @param[in] time Photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
- * Evaluates the function value. No gradient computation is implemented as
- * radial models will be convolved with the instrument response and thus
- * require the numerical computation of the derivatives.
+ * Evaluates the function value and sets the gradient with respect to the
+ * disk radius using
+ *
+ * \f[
+ *    \frac{\partial S_{\rm p}}{\partial r} =
+ *    -2 \pi \sin r \times {\tt m\_norm}^2
+ * \f]
+ *
+ * for \f$\theta \le r\f$ and zero otherwise. Note that this gradient
+ * does not include the contribution of the moving disk edge, which needs
+ * to be taken into account when the model is convolved with the instrument
+ * response.
  *
  * See the eval() method for more information.
  ***************************************************************************/
 double GModelSpatialRadialDisk::eval_gradients(const double&  theta,
                                                const GEnergy& energy,
-                                               const GTime&   time) const
+                                               const GTime&   time,
+                                               GVector&       gradients,
+                                               const int&     offset) const
 {
+    // Compute value (this also updates the precomputation cache)
+    double value = eval(theta, energy, time);
+
+    // Compute partial derivative with respect to radius
+    double g_radius = (theta <= m_radius_rad)
+                      ? -gammalib::twopi * std::sin(m_radius_rad) *
+                        m_norm * m_norm * gammalib::deg2rad * m_radius.scale()
+                      : 0.0;
+
+    // Set gradients. The gradients with respect to the disk centre depend
+    // on the instrument response and are set to zero.
+    gradients[offset]   = 0.0;
+    gradients[offset+1] = 0.0;
+    gradients[offset+2] = g_radius;
+
     // Return value
-    return (eval(theta, energy, time));
+    return value;
 }
 
 
@@ -549,6 +577,11 @@ std::string GModelSpatialRadialDisk::print(const GChatter& chatter) const
  ***************************************************************************/
 void GModelSpatialRadialDisk::init_members(void)
 {
+    // Signal gradient support for the model centre. The position gradients
+    // are computed by the instrument response (see GResponse::irf_gradients())
+    m_ra.has_grad(true);
+    m_dec.has_grad(true);
+
     // Initialise Radius
     m_radius.clear();
     m_radius.name("Radius");
@@ -558,7 +591,7 @@ void GModelSpatialRadialDisk::init_members(void)
     m_radius.free();
     m_radius.scale(1.0);
     m_radius.gradient(0.0);
-    m_radius.has_grad(false);  // Radial components never have gradients
+    m_radius.has_grad(true);
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_radius);
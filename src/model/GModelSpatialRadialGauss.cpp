@@ -280,17 +280,44 @@ double GModelSpatialRadialGauss::eval(const double&  theta,
  * @param[in] theta Angular distance from Gaussian centre (radians).
  * @param[in] energy Photon energy.
  * @param[in] time Photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
- * This method simply calls the eval() method as no analytical gradients
- * will be computed. See the eval() method for more details.
+ * Evaluates the spatial component for a Gaussian source model and sets
+ * the gradient with respect to the Gaussian width using
+ *
+ * \f[
+ *    \frac{\partial S_{\rm p}}{\partial \sigma} =
+ *    S_{\rm p}(\vec{p} | E, t) \left( \frac{\theta^2}{\sigma^3} -
+ *                                    \frac{2}{\sigma} \right)
+ * \f]
+ *
+ * The gradients with respect to the source position are set to zero by
+ * this method as they depend on the instrument response. See the eval()
+ * method for more details.
  ***************************************************************************/
 double GModelSpatialRadialGauss::eval_gradients(const double&  theta,
                                                 const GEnergy& energy,
-                                                const GTime&   time) const
+                                                const GTime&   time,
+                                                GVector&       gradients,
+                                                const int&     offset) const
 {
+    // Compute value
+    double value = eval(theta, energy, time);
+
+    // Compute partial derivative with respect to sigma
+    double sigma_rad = sigma() * gammalib::deg2rad;
+    double g_sigma   = value * (theta * theta / (sigma_rad * sigma_rad) - 2.0) /
+                       sigma_rad * gammalib::deg2rad * m_sigma.scale();
+
+    // Set gradients
+    gradients[offset]   = 0.0;
+    gradients[offset+1] = 0.0;
+    gradients[offset+2] = g_sigma;
+
     // Return value
-    return (eval(theta, energy, time));
+    return value;
 }
 
 
@@ -542,12 +569,15 @@ std::string GModelSpatialRadialGauss::print(const GChatter& chatter) const
 /***********************************************************************//**
  * @brief Initialise class members
  *
- * Note that this model implements no gradients, as spatial models will
- * always require numerical gradient computations. The minimum Gaussian
- * width is set to 1 arcsec.
+ * The Gaussian width signals analytical gradient support. The minimum
+ * Gaussian width is set to 1 arcsec.
  ***************************************************************************/
 void GModelSpatialRadialGauss::init_members(void)
 {
+    // Signal gradient support for the model centre. The position gradients
+    // are computed by the instrument response (see GResponse::irf_gradients())
+    m_ra.has_grad(true);
+    m_dec.has_grad(true);
 
     // Initialise Gaussian sigma
     m_sigma.clear();
@@ -558,7 +588,7 @@ void GModelSpatialRadialGauss::init_members(void)
     m_sigma.free();
     m_sigma.scale(1.0);
     m_sigma.gradient(0.0);
-    m_sigma.has_grad(false);  // Radial components never have gradients
+    m_sigma.has_grad(true);
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_sigma);
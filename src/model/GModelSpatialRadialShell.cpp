@@ -348,15 +348,25 @@ double GModelSpatialRadialShell::eval(const double&  theta,
  * @param[in] theta Angular distance from shell centre (radians).
  * @param[in] energy Photon energy.
  * @param[in] time Photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * This method simply calls the eval() method as no analytical gradients will
- * be computed. See the eval() method for details.
+ * be computed, and sets all gradients to zero. See the eval() method for
+ * details.
  ***************************************************************************/
 double GModelSpatialRadialShell::eval_gradients(const double&  theta,
                                                 const GEnergy& energy,
-                                                const GTime&   time) const
+                                                const GTime&   time,
+                                                GVector&       gradients,
+                                                const int&     offset) const
 {
+    // Set gradients
+    for (int i = 0; i < size(); ++i) {
+        gradients[offset+i] = 0.0;
+    }
+
     // Return value
     return (eval(theta, energy, time));
 }
@@ -658,6 +668,11 @@ std::string GModelSpatialRadialShell::print(const GChatter& chatter) const
  ***************************************************************************/
 void GModelSpatialRadialShell::init_members(void)
 {
+    // Signal gradient support for the model centre. The position gradients
+    // are computed by the instrument response (see GResponse::irf_gradients())
+    m_ra.has_grad(true);
+    m_dec.has_grad(true);
+
     // Initialise Radius
     m_radius.clear();
     m_radius.name("Radius");
@@ -667,7 +682,7 @@ void GModelSpatialRadialShell::init_members(void)
     m_radius.free();
     m_radius.scale(1.0);
     m_radius.gradient(0.0);
-    m_radius.has_grad(false);  // Radial components never have gradients
+    m_radius.has_grad(false);  // No gradients for shell components
 
     // Initialise Width
     m_width.clear();
@@ -678,7 +693,7 @@ void GModelSpatialRadialShell::init_members(void)
     m_width.free();
     m_width.scale(1.0);
     m_width.gradient(0.0);
-    m_width.has_grad(false);  // Radial components never have gradients
+    m_width.has_grad(false);  // No gradients for shell components
 
     // Set parameter pointer(s)
     m_pars.push_back(&m_radius);
@@ -260,6 +260,35 @@ bool GModelSpectral::has_par(const std::string& name) const
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate function and set parameter gradients
+ *
+ * @param[in] srcEng True photon energy.
+ * @param[in] srcTime True photon arrival time.
+ * @return Model value (ph/cm2/s/MeV).
+ *
+ * Evaluates the spectral model and sets the gradients of all model
+ * parameters using GModelPar::factor_gradient(). Use the eval_gradients()
+ * method that takes a gradient vector to evaluate the model without
+ * modifying it.
+ ***************************************************************************/
+double GModelSpectral::eval_gradients(const GEnergy& srcEng,
+                                      const GTime&   srcTime) const
+{
+    // Evaluate model and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(srcEng, srcTime, gradients);
+
+    // Set parameter gradients
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
+
+    // Return value
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Autoscale parameters
  *
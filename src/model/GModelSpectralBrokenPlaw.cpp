@@ -294,6 +294,8 @@ double GModelSpectralBrokenPlaw::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Evaluates
@@ -330,7 +332,9 @@ double GModelSpectralBrokenPlaw::eval(const GEnergy& srcEng,
  * @todo The method expects that energy!=0. Otherwise Inf or NaN may result.
  ***************************************************************************/
 double GModelSpectralBrokenPlaw::eval_gradients(const GEnergy& srcEng,
-                                                const GTime&   srcTime)
+                                                const GTime&   srcTime,
+                                                GVector&       gradients,
+                                                const int&     offset) const
 {
     // Update the evaluation cache
     update_eval_cache(srcEng);
@@ -341,7 +345,7 @@ double GModelSpectralBrokenPlaw::eval_gradients(const GEnergy& srcEng,
     // Compute normalisation gradient
     double g_norm  = (m_norm.is_free())
                      ? m_norm.scale() * m_last_power : 0.0;
-    m_norm.factor_gradient(g_norm);
+    gradients[offset] = g_norm;
 
     // Compute index and break value gradients
     if (srcEng.MeV() < m_breakenergy.value()) {
@@ -351,9 +355,9 @@ double GModelSpectralBrokenPlaw::eval_gradients(const GEnergy& srcEng,
         double g_break = (m_breakenergy.is_free())
                          ? -value * m_last_index1 / m_breakenergy.factor_value()
                          : 0.0;
-        m_index1.factor_gradient(g_index);
-        m_index2.factor_gradient(0.0);
-        m_breakenergy.factor_gradient(g_break);
+        gradients[offset+1] = g_index;
+        gradients[offset+3] = 0.0;
+        gradients[offset+2] = g_break;
     }
     else {
         double g_index = (m_index2.is_free()) 
@@ -362,9 +366,9 @@ double GModelSpectralBrokenPlaw::eval_gradients(const GEnergy& srcEng,
         double g_break = (m_breakenergy.is_free())
                          ? -value * m_last_index2 / m_breakenergy.factor_value()
                          : 0.0;
-        m_index1.factor_gradient(0.0);
-        m_index2.factor_gradient(g_index);
-        m_breakenergy.factor_gradient(g_break);
+        gradients[offset+1] = 0.0;
+        gradients[offset+3] = g_index;
+        gradients[offset+2] = g_break;
     }
 
     // Compile option: Check for NaN/Inf
@@ -253,6 +253,8 @@ double GModelSpectralConst::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Evaluates
@@ -273,7 +275,9 @@ double GModelSpectralConst::eval(const GEnergy& srcEng,
  * \f]
  ***************************************************************************/
 double GModelSpectralConst::eval_gradients(const GEnergy& srcEng,
-                                           const GTime&   srcTime)
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset) const
 {
     // Compute function value
     double value = m_norm.value();
@@ -283,7 +287,7 @@ double GModelSpectralConst::eval_gradients(const GEnergy& srcEng,
 
     // Set factor gradient (the parameter gradient is obtained by dividing
     // the factor gradient by the scale factor)
-    m_norm.factor_gradient(g_norm);
+    gradients[offset] = g_norm;
 
     // Return
     return value;
@@ -293,6 +293,8 @@ double GModelSpectralExpPlaw::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * Evaluates
@@ -338,7 +340,9 @@ double GModelSpectralExpPlaw::eval(const GEnergy& srcEng,
  *       values.
  ***************************************************************************/
 double GModelSpectralExpPlaw::eval_gradients(const GEnergy& srcEng,
-                                             const GTime&   srcTime)
+                                             const GTime&   srcTime,
+                                             GVector&       gradients,
+                                             const int&     offset) const
 {
     // Update the evaluation cache
     update_eval_cache(srcEng);
@@ -359,10 +363,10 @@ double GModelSpectralExpPlaw::eval_gradients(const GEnergy& srcEng,
                      ? -value * m_last_index / m_pivot.factor_value() : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
-    m_index.factor_gradient(g_index);
-    m_ecut.factor_gradient(g_ecut);
-    m_pivot.factor_gradient(g_pivot);
+    gradients[offset] = g_norm;
+    gradients[offset+1] = g_index;
+    gradients[offset+2] = g_ecut;
+    gradients[offset+3] = g_pivot;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
@@ -279,6 +279,8 @@ double GModelSpectralFunc::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Evaluates
@@ -299,7 +301,9 @@ double GModelSpectralFunc::eval(const GEnergy& srcEng,
  * \f]
  ***************************************************************************/
 double GModelSpectralFunc::eval_gradients(const GEnergy& srcEng,
-                                          const GTime&   srcTime)
+                                          const GTime&   srcTime,
+                                          GVector&       gradients,
+                                          const int&     offset) const
 {
     // Interpolate function. This is done in log10-log10 space, but the
     // linear value is returned.
@@ -313,7 +317,7 @@ double GModelSpectralFunc::eval_gradients(const GEnergy& srcEng,
     double g_norm  = (m_norm.is_free())  ? m_norm.scale() * func : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
+    gradients[offset] = g_norm;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
@@ -365,12 +369,10 @@ double GModelSpectralFunc::flux(const GEnergy& emin, const GEnergy& emax) const
         double e_max = emax.MeV();
     
         // Determine left node index for minimum energy
-        m_lin_nodes.set_value(e_min);
-        int inx_emin = m_lin_nodes.inx_left();
+        int inx_emin = m_lin_nodes.locate(e_min).inx_left;
 
         // Determine left node index for maximum energy
-        m_lin_nodes.set_value(e_max);
-        int inx_emax = m_lin_nodes.inx_left();
+        int inx_emax = m_lin_nodes.locate(e_max).inx_left;
     
         // If both energies are within the same nodes then simply
         // integrate over the energy interval using the appropriate power
@@ -453,12 +455,10 @@ double GModelSpectralFunc::eflux(const GEnergy& emin, const GEnergy& emax) const
         double e_max = emax.MeV();
     
         // Determine left node index for minimum energy
-        m_lin_nodes.set_value(e_min);
-        int inx_emin = m_lin_nodes.inx_left();
+        int inx_emin = m_lin_nodes.locate(e_min).inx_left;
 
         // Determine left node index for maximum energy
-        m_lin_nodes.set_value(e_max);
-        int inx_emax = m_lin_nodes.inx_left();
+        int inx_emax = m_lin_nodes.locate(e_max).inx_left;
     
         // If both energies are within the same nodes then simply
         // integrate over the energy interval using the appropriate power
@@ -1015,12 +1015,10 @@ void GModelSpectralFunc::mc_update(const GEnergy& emin,
             double flux;
     
             // Determine left node index for minimum energy
-            m_lin_nodes.set_value(e_min);
-            int inx_emin = m_lin_nodes.inx_left();
+            int inx_emin = m_lin_nodes.locate(e_min).inx_left;
 
             // Determine left node index for maximum energy
-            m_lin_nodes.set_value(e_max);
-            int inx_emax = m_lin_nodes.inx_left();
+            int inx_emax = m_lin_nodes.locate(e_max).inx_left;
     
             // If both energies are within the same node then just
             // add this one node on the stack
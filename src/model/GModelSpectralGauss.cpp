@@ -286,6 +286,8 @@ double GModelSpectralGauss::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Evaluates
@@ -321,7 +323,9 @@ double GModelSpectralGauss::eval(const GEnergy& srcEng,
  *
  ***************************************************************************/
 double GModelSpectralGauss::eval_gradients(const GEnergy& srcEng,
-                                           const GTime&   srcTime)
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset) const
 {
     // Get parameter values
     double energy = srcEng.MeV();
@@ -353,9 +357,9 @@ double GModelSpectralGauss::eval_gradients(const GEnergy& srcEng,
                      : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
-    m_mean.factor_gradient(g_mean);
-    m_sigma.factor_gradient(g_sigma);
+    gradients[offset] = g_norm;
+    gradients[offset+1] = g_mean;
+    gradients[offset+2] = g_sigma;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
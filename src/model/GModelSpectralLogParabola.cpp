@@ -294,6 +294,8 @@ double GModelSpectralLogParabola::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Computes
@@ -338,7 +340,9 @@ double GModelSpectralLogParabola::eval(const GEnergy& srcEng,
  * @todo The method expects that energy!=0. Otherwise Inf or NaN may result.
  ***************************************************************************/
 double GModelSpectralLogParabola::eval_gradients(const GEnergy& srcEng,
-                                                 const GTime&   srcTime)
+                                                 const GTime&   srcTime,
+                                                 GVector&       gradients,
+                                                 const int&     offset) const
 {
     // Update the evaluation cache
     update_eval_cache(srcEng);
@@ -359,10 +363,10 @@ double GModelSpectralLogParabola::eval_gradients(const GEnergy& srcEng,
                        m_last_log_e_norm) / m_pivot.factor_value() : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
-    m_index.factor_gradient(g_index);
-    m_curvature.factor_gradient(g_curvature);
-    m_pivot.factor_gradient(g_pivot);
+    gradients[offset] = g_norm;
+    gradients[offset+1] = g_index;
+    gradients[offset+2] = g_curvature;
+    gradients[offset+3] = g_pivot;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
@@ -267,6 +267,8 @@ double GModelSpectralNodes::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Computes
@@ -300,19 +302,19 @@ double GModelSpectralNodes::eval(const GEnergy& srcEng,
  * \f]
  ***************************************************************************/
 double GModelSpectralNodes::eval_gradients(const GEnergy& srcEng,
-                                           const GTime&   srcTime)
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset) const
 {
     // Update evaluation cache
     update_eval_cache();
 
-    // Set interpolation value
-    m_log_energies.set_value(srcEng.log10MeV());
-
     // Get indices and weights for interpolation
-    int    inx_left  = m_log_energies.inx_left();
-    int    inx_right = m_log_energies.inx_right();
-    double wgt_left  = m_log_energies.wgt_left();
-    double wgt_right = m_log_energies.wgt_right();
+    GNodeArray::weights w = m_log_energies.locate(srcEng.log10MeV());
+    int    inx_left       = w.inx_left;
+    int    inx_right      = w.inx_right;
+    double wgt_left       = w.wgt_left;
+    double wgt_right      = w.wgt_right;
 
     // Interpolate function
     double exponent = m_log_values[inx_left]  * wgt_left +
@@ -321,21 +323,22 @@ double GModelSpectralNodes::eval_gradients(const GEnergy& srcEng,
     // Compute linear value
     double value = std::pow(10.0, exponent);
 
-    // Initialise gradients
-    for (int i = 0; i < m_values.size(); ++i) {
-        m_values[i].factor_gradient(0.0);
+    // Initialise gradients. The energy and intensity of node i are the
+    // model parameters 2*i and 2*i+1
+    for (int i = 0; i < size(); ++i) {
+        gradients[offset+i] = 0.0;
     }
 
     // Gradient for left node
     if (m_values[inx_left].is_free()) {
         double grad = value * wgt_left / m_values[inx_left].factor_value();
-        m_values[inx_left].factor_gradient(grad);
+        gradients[offset+2*inx_left+1] = grad;
     }
 
     // Gradient for right node
     if (m_values[inx_right].is_free()) {
         double grad = value * wgt_right / m_values[inx_right].factor_value();
-        m_values[inx_right].factor_gradient(grad);
+        gradients[offset+2*inx_right+1] = grad;
     }
 
     // Compile option: Check for NaN/Inf
@@ -389,12 +392,10 @@ double GModelSpectralNodes::flux(const GEnergy& emin, const GEnergy& emax) const
         double e_max = emax.MeV();
     
         // Determine left node index for minimum energy
-        m_lin_energies.set_value(e_min);
-        int inx_emin = m_lin_energies.inx_left();
+        int inx_emin = m_lin_energies.locate(e_min).inx_left;
 
         // Determine left node index for maximum energy
-        m_lin_energies.set_value(e_max);
-        int inx_emax = m_lin_energies.inx_left();
+        int inx_emax = m_lin_energies.locate(e_max).inx_left;
     
         // If both energies are within the same nodes then simply
         // integrate over the energy interval using the appropriate power
@@ -476,12 +477,10 @@ double GModelSpectralNodes::eflux(const GEnergy& emin, const GEnergy& emax) cons
         double e_max = emax.MeV();
     
         // Determine left node index for minimum energy
-        m_lin_energies.set_value(e_min);
-        int inx_emin = m_lin_energies.inx_left();
+        int inx_emin = m_lin_energies.locate(e_min).inx_left;
 
         // Determine left node index for maximum energy
-        m_lin_energies.set_value(e_max);
-        int inx_emax = m_lin_energies.inx_left();
+        int inx_emax = m_lin_energies.locate(e_max).inx_left;
     
         // If both energies are within the same nodes then simply
         // integrate over the energy interval using the appropriate power
@@ -1449,27 +1448,52 @@ void GModelSpectralNodes::set_flux_cache(void) const
  * Updates the evaluation cache by computing only results for values that
  * changed.
  *
+ * As the method may be called from several threads that evaluate the
+ * model at the same time, the cache is only modified within a critical
+ * section, and only if some energy or intensity has changed.
+ *
  * @todo Check that all energies and intensities are > 0
  ***************************************************************************/
 void GModelSpectralNodes::update_eval_cache(void) const
 {
-    // Update energies
+    // Check whether an update is required
+    bool update = false;
     for (int i = 0; i < m_energies.size(); ++i) {
-        double energy = m_energies[i].value();
-        if (energy != m_old_energies[i]) {
-            m_log_energies[i] = std::log10(energy);
-            m_old_energies[i] = energy;
+        if (m_energies[i].value() != m_old_energies[i] ||
+            m_values[i].value()   != m_old_values[i]) {
+            update = true;
+            break;
         }
     }
 
-    // Update intensities
-    for (int i = 0; i < m_values.size(); ++i) {
-        double value = m_values[i].value();
-        if (value != m_old_values[i]) {
-            m_log_values[i] = std::log10(value);
-            m_old_values[i] = value;
+    // Continue only if an update is required
+    if (update) {
+
+        // Update cache in a critical section
+        #pragma omp critical(GModelSpectralNodes_update_eval_cache)
+        {
+
+        // Update energies
+        for (int i = 0; i < m_energies.size(); ++i) {
+            double energy = m_energies[i].value();
+            if (energy != m_old_energies[i]) {
+                m_log_energies[i] = std::log10(energy);
+                m_old_energies[i] = energy;
+            }
         }
-    }
+
+        // Update intensities
+        for (int i = 0; i < m_values.size(); ++i) {
+            double value = m_values[i].value();
+            if (value != m_old_values[i]) {
+                m_log_values[i] = std::log10(value);
+                m_old_values[i] = value;
+            }
+        }
+
+        } // end of critical section
+
+    } // endif: update was required
 
     // Return
     return;
@@ -1492,9 +1516,11 @@ void GModelSpectralNodes::update_flux_cache(void) const
     // Loop over all nodes-1
     for (int i = 0; i < nodes-1; ++i) {
     
-        // Get energies and function values
-        double emin = m_lin_energies[i];
-        double emax = m_lin_energies[i+1];
+        // Get energies and function values. The node array is accessed
+        // through a constant reference to keep the node array setup.
+        const GNodeArray& energies = m_lin_energies;
+        double emin = energies[i];
+        double emax = energies[i+1];
         double fmin = m_values[i].value();
         double fmax = m_values[i+1].value();
 
@@ -1576,12 +1602,10 @@ void GModelSpectralNodes::mc_update(const GEnergy& emin, const GEnergy& emax) co
             double flux;
     
             // Determine left node index for minimum energy
-            m_lin_energies.set_value(e_min);
-            int inx_emin = m_lin_energies.inx_left();
+            int inx_emin = m_lin_energies.locate(e_min).inx_left;
 
             // Determine left node index for maximum energy
-            m_lin_energies.set_value(e_max);
-            int inx_emax = m_lin_energies.inx_left();
+            int inx_emax = m_lin_energies.locate(e_max).inx_left;
     
             // If both energies are within the same node then just
             // add this one node on the stack
@@ -286,6 +286,8 @@ double GModelSpectralPlaw::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Evaluates
@@ -322,7 +324,9 @@ double GModelSpectralPlaw::eval(const GEnergy& srcEng,
  * @todo The method expects that energy!=0. Otherwise Inf or NaN may result.
  ***************************************************************************/
 double GModelSpectralPlaw::eval_gradients(const GEnergy& srcEng,
-                                          const GTime&   srcTime)
+                                          const GTime&   srcTime,
+                                          GVector&       gradients,
+                                          const int&     offset) const
 {
     // Update the evaluation cache
     update_eval_cache(srcEng);
@@ -339,9 +343,9 @@ double GModelSpectralPlaw::eval_gradients(const GEnergy& srcEng,
                      ? -value * m_last_index / m_pivot.factor_value() : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
-    m_index.factor_gradient(g_index);
-    m_pivot.factor_gradient(g_pivot);
+    gradients[offset] = g_norm;
+    gradients[offset+1] = g_index;
+    gradients[offset+2] = g_pivot;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
@@ -302,6 +302,8 @@ double GModelSpectralPlaw2::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value (ph/cm2/s/MeV).
  *
  * Computes
@@ -361,7 +363,9 @@ double GModelSpectralPlaw2::eval(const GEnergy& srcEng,
  * No partial derivatives are supported for the energy boundaries.
  ***************************************************************************/
 double GModelSpectralPlaw2::eval_gradients(const GEnergy& srcEng,
-                                           const GTime&   srcTime)
+                                           const GTime&   srcTime,
+                                           GVector&       gradients,
+                                           const int&     offset) const
 {
     // Initialise gradients
     double g_integral = 0.0;
@@ -385,8 +389,10 @@ double GModelSpectralPlaw2::eval_gradients(const GEnergy& srcEng,
     }
 
     // Set gradients
-    m_integral.factor_gradient(g_integral);
-    m_index.factor_gradient(g_index);
+    gradients[offset] = g_integral;
+    gradients[offset+1] = g_index;
+    gradients[offset+2] = 0.0;
+    gradients[offset+3] = 0.0;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
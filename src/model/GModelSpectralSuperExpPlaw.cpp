@@ -300,6 +300,8 @@ double GModelSpectralSuperExpPlaw::eval(const GEnergy& srcEng,
  *
  * @param[in] srcEng True photon energy.
  * @param[in] srcTime True photon arrival time.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  * @return Model value.
  *
  * Evaluates
@@ -354,7 +356,9 @@ double GModelSpectralSuperExpPlaw::eval(const GEnergy& srcEng,
  *       values.
  ***************************************************************************/
 double GModelSpectralSuperExpPlaw::eval_gradients(const GEnergy& srcEng,
-                                                  const GTime&   srcTime)
+                                                  const GTime&   srcTime,
+                                                  GVector&       gradients,
+                                                  const int&     offset) const
 {
     // Update the evaluation cache
     update_eval_cache(srcEng);
@@ -382,11 +386,11 @@ double GModelSpectralSuperExpPlaw::eval_gradients(const GEnergy& srcEng,
             : 0.0;
 
     // Set gradients
-    m_norm.factor_gradient(g_norm);
-    m_index1.factor_gradient(g_index1);
-    m_ecut.factor_gradient(g_ecut);
-    m_pivot.factor_gradient(g_pivot);
-    m_index2.factor_gradient(g_index2);
+    gradients[offset] = g_norm;
+    gradients[offset+1] = g_index1;
+    gradients[offset+2] = g_ecut;
+    gradients[offset+3] = g_pivot;
+    gradients[offset+4] = g_index2;
 
     // Compile option: Check for NaN/Inf
     #if defined(G_NAN_CHECK)
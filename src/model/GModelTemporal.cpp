@@ -256,6 +256,31 @@ bool GModelTemporal::has_par(const std::string& name) const
 }
 
 
+/***********************************************************************//**
+ * @brief Evaluate function and set parameter gradients
+ *
+ * @param[in] srcTime True photon arrival time.
+ * @return Model value.
+ *
+ * Evaluates the temporal model and sets the gradients of all model
+ * parameters using GModelPar::factor_gradient().
+ ***************************************************************************/
+double GModelTemporal::eval_gradients(const GTime& srcTime) const
+{
+    // Evaluate model and gradients
+    GVector gradients(size());
+    double  value = eval_gradients(srcTime, gradients);
+
+    // Set parameter gradients
+    for (int i = 0; i < size(); ++i) {
+        m_pars[i]->factor_gradient(gradients[i]);
+    }
+
+    // Return value
+    return value;
+}
+
+
 /***********************************************************************//**
  * @brief Autoscale parameters
  *
@@ -249,6 +249,8 @@ double GModelTemporalConst::eval(const GTime& srcTime) const
  * @brief Evaluate function and gradients
  *
  * @param[in] srcTime True photon arrival time (not used).
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first parameter gradient (default: 0).
  *
  * Computes
  *
@@ -266,7 +268,9 @@ double GModelTemporalConst::eval(const GTime& srcTime) const
  *    \frac{\delta S_{\rm t}(t)}{\delta {\tt m\_norm}} = 1
  * \f]
  ***************************************************************************/
-double GModelTemporalConst::eval_gradients(const GTime& srcTime)
+double GModelTemporalConst::eval_gradients(const GTime& srcTime,
+                                           GVector&     gradients,
+                                           const int&   offset) const
 {
     // Compute function value
     double value = m_norm.value();
@@ -276,7 +280,7 @@ double GModelTemporalConst::eval_gradients(const GTime& srcTime)
 
     // Set factor gradient (the parameter gradient is obtained by dividing
     // the factor gradient by the scale factor)
-    m_norm.factor_gradient(g_norm);
+    gradients[offset] = g_norm;
 
     // Return
     return value;
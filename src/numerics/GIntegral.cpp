@@ -31,15 +31,18 @@
 #include "GIntegral.hpp"
 #include "GException.hpp"
 #include "GTools.hpp"
+#include "GMath.hpp"
 
 /* __ Method name definitions ____________________________________________ */
 #define G_ROMBERG                "GIntegral::romberg(double&, double&, int&)"
 #define G_TRAPZD          "GIntegral::trapzd(double&, double&, int&, double)"
 #define G_POLINT  "GIntegral::polint(double*, double*, int, double, double*)"
+#define G_GAUSS_LEGENDRE "GIntegral::gauss_legendre(double&, double&, int&)"
 
 /* __ Macros _____________________________________________________________ */
 
 /* __ Coding definitions _________________________________________________ */
+#define G_GAUSS_LEGENDRE_MAX_ORDER 64 //!< Maximum Gauss-Legendre order
 
 /* __ Debug definitions __________________________________________________ */
 
@@ -218,6 +221,70 @@ namespace gammalib {
 } // end gammalib namespace
 
 
+/* __ Gauss-Legendre rules _______________________________________________ */
+/***********************************************************************//**
+ * @class gauss_legendre_rules
+ *
+ * @brief Table of Gauss-Legendre rules
+ *
+ * Holds the nodes and weights on the interval [-1,1] of the Gauss-Legendre
+ * rules of all orders up to G_GAUSS_LEGENDRE_MAX_ORDER. The roots of the
+ * Legendre polynomials are computed by Newton iterations, exploiting the
+ * symmetry of the roots.
+ ***************************************************************************/
+class gauss_legendre_rules {
+public:
+    gauss_legendre_rules(void) {
+        for (int order = 1; order <= G_GAUSS_LEGENDRE_MAX_ORDER; ++order) {
+            nodes[order].assign(order, 0.0);
+            weights[order].assign(order, 0.0);
+            int m = (order + 1) / 2;
+            for (int i = 0; i < m; ++i) {
+                double z  = std::cos(gammalib::pi * (i + 0.75) / (order + 0.5));
+                double pp = 0.0;
+                for (int iter = 0; iter < 100; ++iter) {
+                    double p1 = 1.0;
+                    double p2 = 0.0;
+                    for (int j = 0; j < order; ++j) {
+                        double p3 = p2;
+                        p2        = p1;
+                        p1        = ((2.0*j + 1.0) * z * p2 - j * p3) / (j + 1.0);
+                    }
+                    pp        = order * (z * p1 - p2) / (z * z - 1.0);
+                    double z1 = z;
+                    z         = z1 - p1 / pp;
+                    if (std::abs(z - z1) < 1.0e-15) {
+                        break;
+                    }
+                }
+                nodes[order][i]           = -z;
+                nodes[order][order-1-i]   =  z;
+                weights[order][i]         = 2.0 / ((1.0 - z * z) * pp * pp);
+                weights[order][order-1-i] = weights[order][i];
+            }
+        }
+    }
+    std::vector<double> nodes[G_GAUSS_LEGENDRE_MAX_ORDER+1];   //!< Nodes
+    std::vector<double> weights[G_GAUSS_LEGENDRE_MAX_ORDER+1]; //!< Weights
+};
+
+/***********************************************************************//**
+ * @brief Return table of Gauss-Legendre rules
+ *
+ * The table is constructed on first use, which happens during static
+ * initialisation through the initialiser below. The table is therefore
+ * complete before any integral is computed, also if an integral is
+ * computed during the static initialisation of another translation unit.
+ ***************************************************************************/
+static const gauss_legendre_rules& gauss_legendre_table(void)
+{
+    static const gauss_legendre_rules table;
+    return table;
+}
+static const gauss_legendre_rules& gauss_legendre_table_init =
+             gauss_legendre_table();
+
+
 /*==========================================================================
  =                                                                         =
  =                        Constructors/destructors                         =
@@ -902,6 +969,66 @@ double GIntegral::gauss_kronrod(const double& a, const double& b) const
 }
 
 
+/***********************************************************************//**
+ * @brief Gauss-Legendre integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] order Number of Gauss-Legendre nodes [1,...,64] (default: 16).
+ * @return Integral of kernel over interval [a,b].
+ *
+ * @exception GException::invalid_argument
+ *            Order is out of valid range.
+ *
+ * Integrates the kernel using a fixed Gauss-Legendre rule with @p order
+ * nodes. The rule integrates polynomials up to degree 2*order-1 exactly
+ * and requires exactly @p order kernel evaluations, which makes it well
+ * suited for smooth integrands such as the PSF kernels. The nodes and
+ * weights are computed once per order and are then shared by all
+ * integrals.
+ *
+ * The method does not provide an error estimate.
+ ***************************************************************************/
+double GIntegral::gauss_legendre(const double& a, const double& b,
+                                 const int& order) const
+{
+    // Throw an exception if order is out of range
+    if (order < 1 || order > G_GAUSS_LEGENDRE_MAX_ORDER) {
+        std::string msg = "Gauss-Legendre order "+gammalib::str(order)+
+                          " is outside the valid range [1,"+
+                          gammalib::str(G_GAUSS_LEGENDRE_MAX_ORDER)+"].";
+        throw GException::invalid_argument(G_GAUSS_LEGENDRE, msg);
+    }
+
+    // Initialise integration status information
+    m_isvalid    = true;
+    m_iter       = 1;
+    m_calls      = 0;
+    m_has_abserr = false;
+    m_has_relerr = false;
+
+    // Get nodes and weights of rule on the interval [-1,1]
+    const double* x = NULL;
+    const double* w = NULL;
+    gauss_legendre_rule(order, &x, &w);
+
+    // Compute half length and centre of interval
+    double h = 0.5 * (b - a);
+    double c = 0.5 * (b + a);
+
+    // Sum kernel values
+    double result = 0.0;
+    for (int i = 0; i < order; ++i) {
+        result += w[i] * m_kernel->eval(c + h * x[i]);
+    }
+    m_calls += order;
+    result  *= h;
+
+    // Return result
+    return result;
+}
+
+
 /***********************************************************************//**
  * @brief Print integral information
  *
@@ -1223,3 +1350,31 @@ double GIntegral::rescale_error(double err, const double& result_abs, const doub
     // Return error
     return err;
 }
+
+
+/***********************************************************************//**
+ * @brief Get Gauss-Legendre nodes and weights
+ *
+ * @param[in] order Number of nodes [1,...,64].
+ * @param[out] x Pointer to nodes on the interval [-1,1].
+ * @param[out] w Pointer to weights.
+ *
+ * Returns pointers to the nodes and weights of the Gauss-Legendre rule of
+ * given @p order. The rules of all orders are computed once during static
+ * initialisation and are never modified afterwards, hence the rules can be
+ * used from several threads without locking.
+ ***************************************************************************/
+void GIntegral::gauss_legendre_rule(const int&     order,
+                                    const double** x,
+                                    const double** w)
+{
+    // Get rules
+    const gauss_legendre_rules& rules = gauss_legendre_table();
+
+    // Set pointers to nodes and weights
+    *x = &(rules.nodes[order][0]);
+    *w = &(rules.weights[order][0]);
+
+    // Return
+    return;
+}
@@ -0,0 +1,590 @@
+/***************************************************************************
+ *         GIntegrals.cpp - Integration class for set of functions         *
+ * ----------------------------------------------------------------------- *
+ *  copyright (C) 2015 by Juergen Knoedlseder                              *
+ * ----------------------------------------------------------------------- *
+ *                                                                         *
+ *  This program is free software: you can redistribute it and/or modify   *
+ *  it under the terms of the GNU General Public License as published by   *
+ *  the Free Software Foundation, either version 3 of the License, or      *
+ *  (at your option) any later version.                                    *
+ *                                                                         *
+ *  This program is distributed in the hope that it will be useful,        *
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of         *
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          *
+ *  GNU General Public License for more details.                           *
+ *                                                                         *
+ *  You should have received a copy of the GNU General Public License      *
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.  *
+ *                                                                         *
+ ***************************************************************************/
+/**
+ * @file GIntegrals.cpp
+ * @brief Integration class for set of functions implementation
+ * @author Juergen Knoedlseder
+ */
+
+/* __ Includes ___________________________________________________________ */
+#include <cmath>            // std::abs()
+#include <vector>
+#include <algorithm>        // std::sort
+#include "GIntegrals.hpp"
+#include "GException.hpp"
+#include "GTools.hpp"
+
+/* __ Method name definitions ____________________________________________ */
+#define G_ROMBERG               "GIntegrals::romberg(double&, double&, int&)"
+#define G_TRAPZD        "GIntegrals::trapzd(double&, double&, int&, GVector)"
+
+/* __ Macros _____________________________________________________________ */
+
+/* __ Coding definitions _________________________________________________ */
+
+/* __ Debug definitions __________________________________________________ */
+
+
+/*==========================================================================
+ =                                                                         =
+ =                        Constructors/destructors                         =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Void constructor
+ ***************************************************************************/
+GIntegrals::GIntegrals(void) : GIntegral()
+{
+    // Initialise members
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Function kernels constructor
+ *
+ * @param[in] kernels Pointer to function kernels.
+ *
+ * The function kernels constructor assigns the function kernels pointer in
+ * constructing the object.
+ ***************************************************************************/
+GIntegrals::GIntegrals(GFunctions* kernels) : GIntegral()
+{
+    // Initialise members
+    init_members();
+
+    // Set function kernels
+    m_kernels = kernels;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy constructor
+ *
+ * @param[in] integrals Integrals.
+ ***************************************************************************/
+GIntegrals::GIntegrals(const GIntegrals& integrals) : GIntegral(integrals)
+{
+    // Initialise members
+    init_members();
+
+    // Copy members
+    copy_members(integrals);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Destructor
+ ***************************************************************************/
+GIntegrals::~GIntegrals(void)
+{
+    // Free members
+    free_members();
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                               Operators                                 =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Assignment operator
+ *
+ * @param[in] integrals Integrals.
+ * @return Integrals.
+ ***************************************************************************/
+GIntegrals& GIntegrals::operator=(const GIntegrals& integrals)
+{ 
+    // Execute only if object is not identical
+    if (this != &integrals) {
+
+        // Copy base class members
+        this->GIntegral::operator=(integrals);
+
+        // Free members
+        free_members();
+
+        // Initialise integrals
+        init_members();
+
+        // Copy members
+        copy_members(integrals);
+
+    } // endif: object was not identical
+
+    // Return this object
+    return *this;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                              Public methods                             =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Clear integrals
+ ***************************************************************************/
+void GIntegrals::clear(void)
+{
+    // Free class members (base and derived classes, derived class first)
+    free_members();
+    this->GIntegral::free_members();
+
+    // Initialise members
+    this->GIntegral::init_members();
+    init_members();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Clone integrals
+ *
+ * @return Pointer to deep copy of integrals.
+ ***************************************************************************/
+GIntegrals* GIntegrals::clone(void) const
+{
+    return new GIntegrals(*this);
+}
+
+
+/***********************************************************************//**
+ * @brief Perform Romberg integration
+ *
+ * @param[in] bounds Integration boundaries.
+ * @param[in] order Integration order (default: 5)
+ * @return Vector of integrals.
+ *
+ * @exception GException::invalid_argument
+ *            Integration order incompatible with number of iterations.
+ *
+ * Returns the integrals of the integrands, computed over a number of
+ * intervals [a0,a1], [a1,a2], ... that are given as an unordered vector
+ * by the @p bounds argument.
+ *
+ * See romberg(const double&, const double&, const int&) for a description
+ * of the integration method.
+ ***************************************************************************/
+GVector GIntegrals::romberg(std::vector<double> bounds, const int& order)
+{
+    // Sort integration boundaries in ascending order
+    std::sort(bounds.begin(), bounds.end());
+
+    // Initialise integrals
+    GVector values(m_kernels->size());
+
+    // Add integrals of all intervals
+    for (int i = 0; i < int(bounds.size())-1; ++i) {
+        values += romberg(bounds[i], bounds[i+1], order);
+    }
+
+    // Return values
+    return values;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform Romberg integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] order Integration order (default: 5)
+ * @return Vector of integrals.
+ *
+ * @exception GException::invalid_argument
+ *            Integration order incompatible with number of iterations.
+ *
+ * Returns the integrals of the integrands from a to b. Integration is
+ * performed by Romberg's method of order 2*order, where
+ *
+ *     order=1 is equivalent to the trapezoidal rule,
+ *     order=2 is equivalent to Simpson's rule, and
+ *     order=3 is equivalent to Boole's rule.
+ *
+ * The number of iterations is limited by m_max_iter. m_eps specifies the
+ * requested fractional accuracy, which needs to be reached for all
+ * integrands. By default it is set to 1e-6. For integrals that vanish,
+ * the tolerance is floored by m_eps squared times the largest integral.
+ ***************************************************************************/
+GVector GIntegrals::romberg(const double& a, const double& b, const int& order)
+{
+    // Get number of integrands
+    int n = m_kernels->size();
+
+    // Initialise result
+    GVector result(n);
+
+    // Initialise integration status information
+    m_isvalid    = true;
+    m_calls      = 0;
+    m_has_abserr = false;
+    m_has_relerr = false;
+
+    // Continue only if integration range is valid
+    if (b > a) {
+
+        // Initialise variables
+        bool   converged = false;
+        double dss_max   = 0.0;
+
+        // Determine (maximum) number of iterations
+        int max_iter = (m_fix_iter > 0) ? m_fix_iter : m_max_iter;
+
+        // Check whether maximum number of iterations is compliant with
+        // order
+        if (order > max_iter) {
+            std::string msg = "Requested integration order "+
+                              gammalib::str(order)+" is larger than the "
+                              "maximum number of iterations "+
+                              gammalib::str(max_iter)+". Either reduce the "
+                              "integration order or increase the (maximum) "
+                              "number of iterations.";
+            throw GException::invalid_argument(G_ROMBERG, msg);
+        }
+
+        // Allocate temporal storage
+        std::vector<GVector> s(max_iter+2);
+        std::vector<double>  h(max_iter+2);
+        std::vector<double>  ys(max_iter+2);
+
+        // Initialise step size
+        h[1] = 1.0;
+        s[0] = GVector(n);
+
+        // Iterative loop
+        for (m_iter = 1; m_iter <= max_iter; ++m_iter) {
+
+            // Integration using Trapezoid rule
+            s[m_iter] = trapzd(a, b, m_iter, s[m_iter-1]);
+
+            // Starting from iteration order on, use polynomial interpolation
+            if (m_iter >= order) {
+
+                // Compute results using polynom interpolation for all
+                // integrands and determine the precision of the least
+                // precise integrand
+                GVector dss(n);
+                for (int k = 0; k < n; ++k) {
+                    for (int i = 0; i < order; ++i) {
+                        ys[i+1] = s[m_iter-order+i+1][k];
+                    }
+                    result[k] = polint(&h[m_iter-order], &ys[0],
+                                       order, 0.0, &dss[k]);
+                }
+
+                // Integrals that vanish can not reach a fractional
+                // accuracy, hence their tolerance is floored by m_eps
+                // squared times the largest integral
+                double tol_min = m_eps * m_eps * max(abs(result));
+                bool   precise = true;
+                dss_max        = 0.0;
+                for (int k = 0; k < n; ++k) {
+                    double tol = m_eps * std::abs(result[k]);
+                    if (tol < tol_min) {
+                        tol = tol_min;
+                    }
+                    if (std::abs(dss[k]) > dss_max) {
+                        dss_max = std::abs(dss[k]);
+                    }
+                    if (std::abs(dss[k]) > tol) {
+                        precise = false;
+                    }
+                }
+
+                // If a fixed number of iterations has been requested then
+                // check whether we reached the final one; otherwise check
+                // whether we reached the requested precision.
+                if (m_fix_iter > 0) {
+                    if (m_iter == max_iter) {
+                        converged = true;
+                    }
+                }
+                else if (precise) {
+                    converged = true;
+                }
+                if (converged) {
+                    m_has_abserr = true;
+                    m_abserr     = dss_max;
+                    double value = max(result);
+                    if (std::abs(min(result)) > value) {
+                        value = std::abs(min(result));
+                    }
+                    if (value > 0) {
+                        m_has_relerr = true;
+                        m_relerr     = m_abserr / value;
+                    }
+                    break;
+                }
+
+            } // endif: polynomial interpolation performed
+
+            // Reduce step size
+            h[m_iter+1]= 0.25 * h[m_iter];
+
+        } // endfor: iterative loop
+
+        // Set status and optionally dump warning
+        if (!converged) {
+            m_isvalid = false;
+            m_message = "Integration uncertainty "+
+                        gammalib::str(dss_max)+
+                        " exceeds relative tolerance of "+
+                        gammalib::str(m_eps)+
+                        " after "+gammalib::str(m_iter)+
+                        " iterations. Result is inaccurate.";
+            if (!m_silent) {
+                std::string origin = "GIntegrals::romberg("+
+                                     gammalib::str(a)+", "+
+                                     gammalib::str(b)+", "+
+                                     gammalib::str(order)+")";
+                gammalib::warning(origin, m_message);
+            }
+        }
+    
+    } // endif: integration range was valid
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Perform Trapezoidal integration
+ *
+ * @param[in] a Left integration boundary.
+ * @param[in] b Right integration boundary.
+ * @param[in] n Number of steps.
+ * @param[in] result Result from a previous trapezoidal integration step.
+ * @return Vector of integrals.
+ *
+ * Performs one refinement step of the trapezoidal rule for all integrands.
+ * Result initialisation is done if n=1.
+ ***************************************************************************/
+GVector GIntegrals::trapzd(const double& a, const double& b, const int& n,
+                           GVector result)
+{
+    // Handle case of identical boundaries
+    if (a == b) {
+        result = GVector(m_kernels->size());
+    }
+    
+    // ... otherwise use trapeziodal rule
+    else {
+    
+        // Case A: Only a single step is requested
+        if (n == 1) {
+        
+            // Evaluate integrands at boundaries
+            GVector y_a = m_kernels->eval(a);
+            GVector y_b = m_kernels->eval(b);
+            m_calls += 2;
+            
+            // Compute result
+            result = 0.5*(b-a)*(y_a + y_b);
+            
+        } // endif: only a single step was requested
+
+        // Case B: More than a single step is requested
+        else {
+
+            // Compute step level 2^(n-1)
+            int it = 1;
+            for (int j = 1; j < n-1; ++j) {
+                it <<= 1;
+            }
+
+            // Verify that step level is valid
+            if (it == 0) {
+                m_isvalid = false;
+                m_message = "Invalid step level "+gammalib::str(it)+
+                            " encountered for"
+                            " a="+gammalib::str(a)+
+                            ", b="+gammalib::str(b)+
+                            ", n="+gammalib::str(n)+
+                            ". Looks like n is too large.";
+                gammalib::warning(G_TRAPZD, m_message);
+            }
+
+            // Set step size
+            double tnm = double(it);
+            double del = (b-a)/tnm;
+
+            // Verify that step is >0
+            if (del == 0) {
+                m_isvalid = false;
+                m_message = "Invalid step size "+gammalib::str(del)+
+                            " encountered for"
+                            " a="+gammalib::str(a)+
+                            ", b="+gammalib::str(b)+
+                            ", n="+gammalib::str(n)+
+                            ". Step is too small to make sense.";
+                gammalib::warning(G_TRAPZD, m_message);
+            }
+
+            // Sum up values
+            double  x = a + 0.5*del;
+            GVector sum(m_kernels->size());
+            for (int j = 0; j < it; ++j, x+=del) {
+                
+                // Add integrands
+                sum += m_kernels->eval(x);
+                m_calls++;
+
+            } // endfor: looped over steps
+
+            // Set result
+            result = 0.5*(result + (b-a)*sum/tnm);
+        }
+        
+    } // endelse: trapeziodal rule was applied
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Print integrals information
+ *
+ * @param[in] chatter Chattiness (defaults to NORMAL).
+ * @return String containing integrals information.
+ ***************************************************************************/
+std::string GIntegrals::print(const GChatter& chatter) const
+{
+    // Initialise result string
+    std::string result;
+
+    // Continue only if chatter is not silent
+    if (chatter != SILENT) {
+
+        // Append header
+        result.append("=== GIntegrals ===");
+
+        // Append information
+        result.append("\n"+gammalib::parformat("Relative precision"));
+        result.append(gammalib::str(eps()));
+        if (m_has_abserr) {
+            result.append("\n"+gammalib::parformat("Maximum absolute error"));
+            result.append(gammalib::str(m_abserr));
+        }
+        if (m_has_relerr) {
+            result.append("\n"+gammalib::parformat("Maximum relative error"));
+            result.append(gammalib::str(m_relerr));
+        }
+        result.append("\n"+gammalib::parformat("Function calls"));
+        result.append(gammalib::str(calls()));
+        result.append("\n"+gammalib::parformat("Iterations"));
+        result.append(gammalib::str(iter()));
+        if (m_fix_iter > 0) {
+            result.append(" (fixed: ");
+            result.append(gammalib::str(fixed_iter()));
+            result.append(")");
+        }
+        else {
+            result.append(" (maximum: ");
+            result.append(gammalib::str(max_iter()));
+            result.append(")");
+        }
+
+        // Append status information
+        result.append("\n"+gammalib::parformat("Status"));
+        if (is_valid()) {
+            result.append("Result accurate.");
+        }
+        else {
+            result.append(message());
+        }
+        if (silent()) {
+            result.append("\n"+gammalib::parformat("Warnings")+"suppressed");
+        }
+        else {
+            result.append("\n"+gammalib::parformat("Warnings"));
+            result.append("in standard output");
+        }
+
+    } // endif: chatter was not silent
+
+    // Return result
+    return result;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                            Protected methods                            =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GIntegrals::init_members(void)
+{
+    // Initialise members
+    m_kernels = NULL;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] integrals Integrals.
+ ***************************************************************************/
+void GIntegrals::copy_members(const GIntegrals& integrals)
+{
+    // Copy attributes
+    m_kernels = integrals.m_kernels;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GIntegrals::free_members(void)
+{
+    // Return
+    return;
+}
@@ -131,6 +131,48 @@ GEventCube& GEventCube::operator=(const GEventCube& cube)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Allocate event bin view
+ *
+ * @return Pointer to event bin view (NULL if no view is needed).
+ *
+ * Allocates an event bin view that can be passed to the bin() method. The
+ * caller is responsible for deleting the view. The default implementation
+ * returns a NULL pointer, which is appropriate for event cubes that
+ * physically store all their bins so that the bin access operator is safe
+ * for concurrent use.
+ ***************************************************************************/
+GEventBin* GEventCube::bin_view(void) const
+{
+    // Return
+    return NULL;
+}
+
+
+/***********************************************************************//**
+ * @brief Return event bin for concurrent access
+ *
+ * @param[in] index Event bin index [0,...,size()-1].
+ * @param[in] view Event bin view allocated by bin_view().
+ * @return Pointer to event bin.
+ *
+ * Returns a pointer to the event bin with the specified @p index without
+ * modifying the event cube, so that several threads may access bins
+ * concurrently provided that each thread uses its own @p view. The
+ * returned pointer is valid until the next call with the same @p view.
+ *
+ * The default implementation returns the result of the bin access operator
+ * and ignores the @p view. Derived classes with a bin access operator that
+ * is not safe for concurrent use should overload this method together with
+ * bin_view().
+ ***************************************************************************/
+const GEventBin* GEventCube::bin(const int& index, GEventBin* view) const
+{
+    // Return
+    return ((*this)[index]);
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
@@ -131,6 +131,48 @@ GEventList& GEventList::operator=(const GEventList& list)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Allocate event atom view
+ *
+ * @return Pointer to event atom view (NULL if no view is needed).
+ *
+ * Allocates an event atom view that can be passed to the atom() method. The
+ * caller is responsible for deleting the view. The default implementation
+ * returns a NULL pointer, which is appropriate for event lists that
+ * physically store all their atoms so that the atom access operator is safe
+ * for concurrent use.
+ ***************************************************************************/
+GEventAtom* GEventList::atom_view(void) const
+{
+    // Return
+    return NULL;
+}
+
+
+/***********************************************************************//**
+ * @brief Return event atom for concurrent access
+ *
+ * @param[in] index Event index [0,...,size()-1].
+ * @param[in] view Event atom view allocated by atom_view().
+ * @return Pointer to event atom.
+ *
+ * Returns a pointer to the event atom with the specified @p index without
+ * modifying the event list, so that several threads may access atoms
+ * concurrently provided that each thread uses its own @p view. The
+ * returned pointer is valid until the next call with the same @p view.
+ *
+ * The default implementation returns the result of the atom access
+ * operator and ignores the @p view. Derived classes with an atom access
+ * operator that is not safe for concurrent use need to overload this
+ * method together with atom_view().
+ ***************************************************************************/
+const GEventAtom* GEventList::atom(const int& index, GEventAtom* view) const
+{
+    // Return
+    return ((*this)[index]);
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                             Private methods                             =
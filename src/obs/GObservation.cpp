@@ -28,20 +28,29 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <vector>
 #include "GException.hpp"
 #include "GObservation.hpp"
 #include "GModelSky.hpp"
+#include "GModelSpectralConst.hpp"
+#include "GModelTemporalConst.hpp"
 #include "GModelData.hpp"
 #include "GIntegral.hpp"
+#include "GIntegrals.hpp"
 #include "GDerivative.hpp"
 #include "GTools.hpp"
 #include "GEventCube.hpp"
 #include "GEventList.hpp"
 #include "GEventBin.hpp"
 
+/* __ OpenMP section _____________________________________________________ */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* __ Method name definitions ____________________________________________ */
 #define G_LIKELIHOOD           "GObservation::likelihood(GModels&, GVector*,"\
-                                                  " GMatrixSparse*, double*)"
+                                               " GMatrixSymmetric*, double*)"
 #define G_MODEL                   "GObservation::model(GModels&, GPointing&,"\
                                     " GInstDir&, GEnergy&, GTime&, GVector*)"
 #define G_EVENTS                                     "GObservation::events()"
@@ -51,6 +60,7 @@
 /* __ Constants __________________________________________________________ */
 const double minmod = 1.0e-100;                      //!< Minimum model value
 const double minerr = 1.0e-100;                //!< Minimum statistical error
+const int    min_events_per_thread = 50;     //!< Minimum events per thread
 
 /* __ Macros _____________________________________________________________ */
 
@@ -166,11 +176,20 @@ GObservation& GObservation::operator=(const GObservation& obs)
  * Computes the likelihood for a specified set of models. The method also
  * returns the gradients, the curvature matrix, and the number of events
  * that are predicted by all models.
+ *
+ * Before the events are evaluated, the energy dispersion kernels of the
+ * observation are precomputed (see GResponse::edisp_kernels()). The kernels
+ * are stored in the response of the observation, hence the method modifies
+ * the response although it is const. This is safe since the kernels are
+ * computed before the events are distributed over threads, and since
+ * GObservations::likelihood::eval() evaluates every observation in a
+ * single thread. The method must not be called concurrently for the same
+ * observation, or for observations that share a response.
  ***************************************************************************/
-double GObservation::likelihood(const GModels& models,
-                                GVector*       gradient,
-                                GMatrixSparse* curvature,
-                                double*        npred) const
+double GObservation::likelihood(const GModels&    models,
+                                GVector*          gradient,
+                                GMatrixSymmetric* curvature,
+                                double*           npred) const
 {
     // Initialise likelihood value
     double value = 0.0;
@@ -178,6 +197,11 @@ double GObservation::likelihood(const GModels& models,
     // Extract statistics for this observation
     std::string statistics = gammalib::toupper(this->statistics());
 
+    // Precompute the energy dispersion kernels of the observation, so that
+    // they are not recomputed for every event. This modifies the response,
+    // and is done before the events are distributed over threads.
+    response()->edisp_kernels(*this);
+
     // Unbinned analysis
     if (dynamic_cast<const GEventList*>(events()) != NULL) {
 
@@ -280,15 +304,32 @@ double GObservation::model(const GModels& models,
             // observation identifier
             if (mptr->is_valid(instrument(), id())) {
 
-                // Compute value and add to model. If energy dispersion
-                // is used, don't compute model gradients as we cannot
-                // use them. This is somehow a kluge, but makes the
-                // code faster
-                if (response()->use_edisp()) {
-                    model += mptr->eval(event, *this);
+                // Make sure that we have slots for the gradients
+                #if defined(G_RANGE_CHECK)
+                if (gradient != NULL && igrad+mptr->size() > grad_size) {
+                    std::string msg = "Vector has not enough elements "
+                                      "to store the model parameter "
+                                      "gradients. "+
+                                      gammalib::str(models.npars())+
+                                      " elements requested while vector "
+                                      "only contains "+
+                                      gammalib::str(gradient->size())+
+                                      " elements.";
+                    throw GException::invalid_value(G_MODEL, msg);
+                }
+                #endif
+
+                // Compute value and add to model. If gradients are
+                // requested, the model stores its gradients directly in the
+                // gradient vector. If energy dispersion is used, don't
+                // compute model gradients as we cannot use them. This is
+                // somehow a kluge, but makes the code faster
+                if (gradient != NULL && !response()->use_edisp()) {
+                    model += mptr->eval_gradients(event, *this, *gradient,
+                                                  igrad);
                 }
                 else {
-                    model += mptr->eval_gradients(event, *this);
+                    model += mptr->eval(event, *this);
                 }
 
                 // Optionally determine model gradients. If the model has a
@@ -303,26 +344,9 @@ double GObservation::model(const GModels& models,
                         // Get reference to model parameter
                         const GModelPar& par = (*mptr)[ipar];
 
-                        // Make sure that we have a slot for the gradient
-                        #if defined(G_RANGE_CHECK)
-                        if (igrad >= grad_size) {
-                            std::string msg = "Vector has not enough elements "
-                                              "to store the model parameter "
-                                              "gradients. "+
-                                              gammalib::str(models.npars())+
-                                              " elements requested while vector "
-                                              "only contains "+
-                                              gammalib::str(gradient->size())+
-                                              " elements.";
-                            throw GException::invalid_value(G_MODEL, msg);
-                        }
-                        #endif
-
+                        // Set gradient
                         if (par.is_free()) {
-                            if (par.has_grad() && !response()->use_edisp()) {
-                                (*gradient)[igrad+ipar] = par.factor_gradient();
-                            }
-                            else {
+                            if (!par.has_grad() || response()->use_edisp()) {
                                 (*gradient)[igrad+ipar] = model_grad(*mptr, par, event);
                             }
                         }
@@ -397,15 +421,15 @@ double GObservation::npred(const GModels& models, GVector* gradient) const
             // observation identifier
             if (mptr->is_valid(instrument(), id())) {
 
-                // Determine Npred for model
-                npred += this->npred(*mptr);
-
-                // Optionally determine Npred gradients
+                // If gradients are requested then determine Npred and
+                // gradients in a single pass ...
                 if (gradient != NULL) {
-                    for (int k = 0; k < mptr->size(); ++k) {
-                        const GModelPar& par = (*mptr)[k];
-                        (*gradient)[igrad+k] = npred_grad(*mptr, par);
-                    }
+                    npred += npred_gradients(*mptr, gradient, igrad);
+                }
+
+                // ... otherwise determine Npred only
+                else {
+                    npred += this->npred(*mptr);
                 }
 
             } // endif: model component was valid for instrument
@@ -539,6 +563,11 @@ double GObservation::npred(const GModel& model) const
  * The reasoning behind this value is that parameters that use numerical
  * gradients are typically angles, such as for example the position, and
  * we want to achieve arcsec precision with this method.
+ *
+ * The parameter is varied on a local copy of the @p model, hence the method
+ * does not modify the @p model and may be called concurrently for the same
+ * model from several threads. A parameter @p par that does not belong to
+ * the @p model has a zero gradient.
  ***************************************************************************/
 double GObservation::model_grad(const GModel&    model,
                                 const GModelPar& par,
@@ -547,14 +576,15 @@ double GObservation::model_grad(const GModel&    model,
     // Initialise gradient
     double grad = 0.0;
 
-    // Compute gradient only if parameter is free
-    if (par.is_free()) {
+    // Determine index of parameter in model
+    int ipar = par_index(model, par);
 
-        // Get non-const model pointer
-        GModelPar* ptr = const_cast<GModelPar*>(&par);
+    // Compute gradient only if parameter is free and belongs to model
+    if (par.is_free() && ipar >= 0) {
 
-        // Save current model parameter
-        GModelPar current = par;
+        // Allocate model copy and get pointer to the copy of the parameter
+        GModel*    cpy = model.clone();
+        GModelPar* ptr = &((*cpy)[ipar]);
 
         // Get actual parameter value
         double x = par.factor_value();
@@ -580,7 +610,7 @@ double GObservation::model_grad(const GModel&    model,
             //ptr->remove_range(); // Not needed in principle
 
             // Setup derivative function
-            GObservation::model_func function(this, model, ptr, event);
+            GObservation::model_func function(this, *cpy, ptr, event);
             GDerivative              derivative(&function);
 
             // If we are too close to the minimum boundary use a right sided
@@ -602,8 +632,8 @@ double GObservation::model_grad(const GModel&    model,
 
         } // endif: step size was positive
 
-        // Restore current model parameter
-        *ptr = current;
+        // Free model copy
+        delete cpy;
 
     } // endif: model parameter was free
 
@@ -661,20 +691,24 @@ double GObservation::model_grad(const GModel&    model,
  * The reasoning behind this value is that parameters that use numerical
  * gradients are typically angles, such as for example the position, and
  * we want to achieve arcsec precision with this method.
+ *
+ * As for model_grad(), the parameter is varied on a local copy of the
+ * @p model, hence the method does not modify the @p model.
  ***************************************************************************/
 double GObservation::npred_grad(const GModel& model, const GModelPar& par) const
 {
     // Initialise result
     double grad = 0.0;
 
-    // Compute gradient only if parameter is free
-    if (par.is_free()) {
+    // Determine index of parameter in model
+    int ipar = par_index(model, par);
 
-        // Get non-const model pointer
-        GModelPar* ptr = const_cast<GModelPar*>(&par);
+    // Compute gradient only if parameter is free and belongs to model
+    if (par.is_free() && ipar >= 0) {
 
-        // Save current model parameter
-        GModelPar current = par;
+        // Allocate model copy and get pointer to the copy of the parameter
+        GModel*    cpy = model.clone();
+        GModelPar* ptr = &((*cpy)[ipar]);
 
         // Get actual parameter value
         double x = par.factor_value();
@@ -700,7 +734,7 @@ double GObservation::npred_grad(const GModel& model, const GModelPar& par) const
             //ptr->remove_range(); // Not needed in principle
 
             // Setup derivative function
-            GObservation::npred_func function(this, model, ptr);
+            GObservation::npred_func function(this, *cpy, ptr);
             GDerivative              derivative(&function);
 
             // If we are too close to the minimum boundary use a right sided
@@ -722,8 +756,8 @@ double GObservation::npred_grad(const GModel& model, const GModelPar& par) const
 
         } // endif: step size was positive
 
-        // Restore current model parameter
-        *ptr = current;
+        // Free model copy
+        delete cpy;
 
     } // endif: model parameter was free
 
@@ -732,6 +766,43 @@ double GObservation::npred_grad(const GModel& model, const GModelPar& par) const
 }
 
 
+/***********************************************************************//**
+ * @brief Signals if events may be evaluated concurrently
+ *
+ * @return True if events may be evaluated by several threads.
+ *
+ * Signals whether the likelihood methods may distribute the events of the
+ * observation over several OpenMP threads. This requires that the event
+ * container and the instrument response are safe for concurrent access.
+ * As this is not guaranteed for an arbitrary instrument, the method returns
+ * false. Derived classes that fulfil the requirement should overload the
+ * method.
+ ***************************************************************************/
+bool GObservation::is_threadsafe(void) const
+{
+    // Return
+    return false;
+}
+
+
+/***********************************************************************//**
+ * @brief Prefetch data for evaluation
+ *
+ * Loads data that are needed for evaluating the observation. The method
+ * is called by one thread of the event loop of the previous observation
+ * while the other threads evaluate the events, hence it may be called
+ * concurrently with the evaluation of another observation and it must not
+ * throw an exception. As an observation holds all its data in memory by
+ * default, the method does nothing. Derived classes that load data on
+ * demand should overload the method.
+ ***************************************************************************/
+void GObservation::prefetch(void) const
+{
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set event container
  *
@@ -789,6 +860,7 @@ void GObservation::init_members(void)
     m_id.clear();
     m_statistics = "Poisson";
     m_events     = NULL;
+    m_prefetch   = NULL;
 
     // Return
     return;
@@ -864,11 +936,24 @@ void GObservation::free_members(void)
  * \f$\delta L/dp\f$
  * and the curvature matrix
  * \f$\delta^2 L/dp_1 dp_2\f$.
+ *
+ * If the observation is thread safe (see is_threadsafe()) and if the method
+ * is not called from within an OpenMP parallel region, the event loop is
+ * split into contiguous event ranges that are evaluated by several threads.
+ * Each thread works on its own copy of the models and accumulates the
+ * likelihood value, the gradient and the curvature matrix in its own
+ * working variables. The working variables are summed in the order of the
+ * event ranges once all threads have finished, hence the result does not
+ * depend on the thread scheduling.
+ *
+ * If an observation was set for prefetching by GObservations, the last
+ * thread calls the prefetch() method of that observation while the other
+ * threads evaluate the events.
  ***************************************************************************/
-double GObservation::likelihood_poisson_unbinned(const GModels& models,
-                                                 GVector*       gradient,
-                                                 GMatrixSparse* curvature,
-                                                 double*        npred) const
+double GObservation::likelihood_poisson_unbinned(const GModels&    models,
+                                                 GVector*          gradient,
+                                                 GMatrixSymmetric* curvature,
+                                                 double*           npred) const
 {
     // Initialise likelihood value
     double value = 0.0;
@@ -876,9 +961,7 @@ double GObservation::likelihood_poisson_unbinned(const GModels& models,
     // Get number of parameters
     int npars = gradient->size();
 
-    // Allocate some working arrays
-    int*    inx    = new int[npars];
-    double* values = new double[npars];
+    // Allocate working array
     GVector wrk_grad(npars);
 
     // Determine Npred value and gradient for this observation
@@ -889,70 +972,84 @@ double GObservation::likelihood_poisson_unbinned(const GModels& models,
     *npred    += npred_value;
     *gradient += wrk_grad;
 
-    // Iterate over all events
-    for (int i = 0; i < events()->size(); ++i) {
-
-        // Get event pointer
-        const GEvent* event = (*events())[i];
-
-        // Get model and derivative
-        double model = this->model(models, *event, &wrk_grad);
-
-        // Skip bin if model is too small (avoids -Inf or NaN gradients)
-        if (model <= minmod) {
-            continue;
-        }
-
-        // Create index array of non-zero derivatives and initialise working
-        // array
-        int ndev = 0;
-        for (int i = 0; i < npars; ++i) {
-            values[i] = 0.0;
-            if (wrk_grad[i] != 0.0 && !gammalib::is_infinite(wrk_grad[i])) {
-                inx[ndev] = i;
-                ndev++;
+    // Get number of events and determine number of threads for the
+    // event loop
+    int nevents  = events()->size();
+    int nthreads = event_threads(nevents);
+
+    // If more than one thread should be used then distribute the event
+    // loop over the threads
+    if (nthreads > 1) {
+
+        // Compile option: OpenMP
+        #ifdef _OPENMP
+
+        // Allocate working variables for each thread
+        std::vector<double>            thread_value(nthreads, 0.0);
+        std::vector<GVector>           thread_grad(nthreads, GVector(npars));
+        std::vector<GMatrixSymmetric*> thread_curvature(nthreads, NULL);
+
+        // Get observation to prefetch
+        const GObservation* prefetch = m_prefetch;
+
+        // Evaluate event ranges in parallel
+        #pragma omp parallel num_threads(nthreads)
+        {
+            // Determine number of threads that evaluate events. If an
+            // observation should be prefetched, the last thread prefetches
+            // it.
+            int ithread  = omp_get_thread_num();
+            int nteam    = omp_get_num_threads();
+            int nworkers = (prefetch != NULL && nteam > 1) ? nteam-1 : nteam;
+
+            // Prefetch observation
+            if (ithread >= nworkers) {
+                prefetch->prefetch();
             }
-        }
 
-        // Update Poissonian statistics (excluding factorial term for faster
-        // computation)
-        value -= log(model);
+            // ... otherwise evaluate events
+            else {
 
-        // Skip bin now if there are no non-zero derivatives
-        if (ndev < 1) {
-            continue;
-        }
+                // Determine event range for this thread
+                int first = (int)(((long)nevents * ithread)     / nworkers);
+                int last  = (int)(((long)nevents * (ithread+1)) / nworkers);
 
-        // Update gradient vector and curvature matrix.
-        double fb = 1.0 / model;
-        double fa = fb / model;
-        for (int jdev = 0; jdev < ndev; ++jdev) {
+                // Allocate thread copies of models and curvature matrix
+                GModels           cpy_models(models);
+                GMatrixSymmetric* cpy_curvature = new GMatrixSymmetric(npars,npars);
 
-            // Initialise computation
-            register int jpar    = inx[jdev];
-            double       g       = wrk_grad[jpar];
-            double       fa_i    = fa * g;
+                // Evaluate event range
+                thread_value[ithread] =
+                    likelihood_poisson_unbinned_range(cpy_models, first, last,
+                                                      &(thread_grad[ithread]),
+                                                      cpy_curvature);
 
-            // Update gradient.
-            (*gradient)[jpar] -= fb * g;
+                // Store curvature matrix
+                thread_curvature[ithread] = cpy_curvature;
 
-            // Loop over rows
-            register int* ipar = inx;
+            } // endelse: evaluated events
 
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                values[idev] = fa_i * wrk_grad[*ipar];
-            }
+        } // end pragma omp parallel
 
-            // Add column to matrix
-            curvature->add_to_column(jpar, values, inx, ndev);
+        // Sum up the working variables in the order of the event ranges
+        for (int i = 0; i < nthreads; ++i) {
+            if (thread_curvature[i] != NULL) {
+                value      += thread_value[i];
+                *gradient  += thread_grad[i];
+                *curvature += *(thread_curvature[i]);
+                delete thread_curvature[i];
+            }
+        }
 
-        } // endfor: looped over columns
+        #endif
 
-    } // endfor: iterated over all events
+    } // endif: more than one thread
 
-    // Free temporary memory
-    if (values != NULL) delete [] values;
-    if (inx    != NULL) delete [] inx;
+    // ... otherwise evaluate all events in the calling thread
+    else {
+        value += likelihood_poisson_unbinned_range(models, 0, nevents,
+                                                   gradient, curvature);
+    }
 
     // Return
     return value;
@@ -984,184 +1081,104 @@ double GObservation::likelihood_poisson_unbinned(const GModels& models,
  * and the curvature matrix
  * \f$\delta^2 L/dp_1 dp_2\f$
  * and also updates the total number of predicted events m_npred.
+ *
+ * The bin loop is distributed over several threads following the same
+ * rules as for likelihood_poisson_unbinned(), including the prefetching of
+ * the next observation. Each thread accesses the bins
+ * through its own event bin view (see GEventCube::bin()), so that the
+ * threads do not modify the shared event cube.
  ***************************************************************************/
-double GObservation::likelihood_poisson_binned(const GModels& models,
-                                               GVector*       gradient,
-                                               GMatrixSparse* curvature,
-                                               double*        npred) const
+double GObservation::likelihood_poisson_binned(const GModels&    models,
+                                               GVector*          gradient,
+                                               GMatrixSymmetric* curvature,
+                                               double*           npred) const
 {
     // Initialise likelihood value
     double value = 0.0;
 
-    // Initialise statistics
-    #if defined(G_OPT_DEBUG)
-    int    n_bins         = 0;
-    int    n_used         = 0;
-    int    n_small_model  = 0;
-    int    n_zero_data    = 0;
-    int    n_exclude_data = 0;
-    double sum_data       = 0.0;
-    double sum_model      = 0.0;
-    double init_value     = value;
-    #endif
-
     // Get number of parameters
     int npars = gradient->size();
 
-    // Allocate some working arrays
-    int*    inx    = new int[npars];
-    double* values = new double[npars];
-    GVector wrk_grad(npars);
-
-    // Iterate over all bins
-    for (int i = 0; i < events()->size(); ++i) {
-
-        // Update number of bins
-        #if defined(G_OPT_DEBUG)
-        n_bins++;
-        #endif
-
-        // Get event pointer
-        const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(events()))))[i];
-
-        // Get number of counts in bin
-        double data = bin->counts();
-
-        // Skip bin if data is negative (filtering flag)
-        if (data < 0) {
-            #if defined(G_OPT_DEBUG)
-            n_exclude_data++;
-            #endif
-            continue;
-        }
-
-        // Get model and derivative
-        double model = this->model(models, *bin, &wrk_grad);
-
-        // Multiply model by bin size
-        model *= bin->size();
-
-        // Skip bin if model is too small (avoids -Inf or NaN gradients)
-        if (model <= minmod) {
-            #if defined(G_OPT_DEBUG)
-            n_small_model++;
-            #endif
-            continue;
-        }
-
-        // Update statistics
-        #if defined(G_OPT_DEBUG)
-        n_used++;
-        sum_data  += data;
-        sum_model += model;
-        #endif
-
-        // Update Npred
-        *npred += model;
-
-        // Multiply gradient by bin size
-        wrk_grad *= bin->size();
-
-        // Create index array of non-zero derivatives and initialise working
-        // array
-        int ndev = 0;
-        for (int i = 0; i < npars; ++i) {
-            values[i] = 0.0;
-            if (wrk_grad[i] != 0.0 && !gammalib::is_infinite(wrk_grad[i])) {
-                inx[ndev] = i;
-                ndev++;
-            }
-        }
-
-        // Update gradient vector and curvature matrix. To avoid
-        // unneccessary computations we distinguish the case where
-        // data>0 and data=0. The second case requires much less
-        // computation since it does not contribute to the curvature
-        // matrix ...
-        if (data > 0.0) {
-
-            // Update Poissonian statistics (excluding factorial term for
-            // faster computation)
-            value -= data * log(model) - model;
-
-            // Skip bin now if there are no non-zero derivatives
-            if (ndev < 1) {
-                continue;
+    // Get number of bins and determine number of threads for the bin loop
+    int nbins    = events()->size();
+    int nthreads = event_threads(nbins);
+
+    // If more than one thread should be used then distribute the bin loop
+    // over the threads
+    if (nthreads > 1) {
+
+        // Compile option: OpenMP
+        #ifdef _OPENMP
+
+        // Allocate working variables for each thread
+        std::vector<double>            thread_value(nthreads, 0.0);
+        std::vector<double>            thread_npred(nthreads, 0.0);
+        std::vector<GVector>           thread_grad(nthreads, GVector(npars));
+        std::vector<GMatrixSymmetric*> thread_curvature(nthreads, NULL);
+
+        // Get observation to prefetch
+        const GObservation* prefetch = m_prefetch;
+
+        // Evaluate bin ranges in parallel
+        #pragma omp parallel num_threads(nthreads)
+        {
+            // Determine number of threads that evaluate bins. If an
+            // observation should be prefetched, the last thread prefetches
+            // it.
+            int ithread  = omp_get_thread_num();
+            int nteam    = omp_get_num_threads();
+            int nworkers = (prefetch != NULL && nteam > 1) ? nteam-1 : nteam;
+
+            // Prefetch observation
+            if (ithread >= nworkers) {
+                prefetch->prefetch();
             }
 
-            // Pre computation
-            double fb = data / model;
-            double fc = (1.0 - fb);
-            double fa = fb / model;
-
-            // Loop over columns
-            for (int jdev = 0; jdev < ndev; ++jdev) {
-
-                // Initialise computation
-                register int jpar    = inx[jdev];
-                double       g       = wrk_grad[jpar];
-                double       fa_i    = fa * g;
-
-                // Update gradient
-                (*gradient)[jpar] += fc * g;
-
-                // Loop over rows
-                register int* ipar = inx;
-                for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                    values[idev] = fa_i * wrk_grad[*ipar];
-                }
-
-                // Add column to matrix
-                curvature->add_to_column(jpar, values, inx, ndev);
+            // ... otherwise evaluate bins
+            else {
 
-            } // endfor: looped over columns
+                // Determine bin range for this thread
+                int first = (int)(((long)nbins * ithread)     / nworkers);
+                int last  = (int)(((long)nbins * (ithread+1)) / nworkers);
 
-        } // endif: data was > 0
+                // Allocate thread copies of models and curvature matrix
+                GModels           cpy_models(models);
+                GMatrixSymmetric* cpy_curvature = new GMatrixSymmetric(npars,npars);
 
-        // ... handle now data=0
-        else {
+                // Evaluate bin range
+                thread_value[ithread] =
+                    likelihood_poisson_binned_range(cpy_models, first, last,
+                                                    &(thread_grad[ithread]),
+                                                    cpy_curvature,
+                                                    &(thread_npred[ithread]));
 
-            // Update statistics
-            #if defined(G_OPT_DEBUG)
-            n_zero_data++;
-            #endif
+                // Store curvature matrix
+                thread_curvature[ithread] = cpy_curvature;
 
-            // Update Poissonian statistics (excluding factorial term for
-            // faster computation)
-            value += model;
+            } // endelse: evaluated bins
 
-            // Skip bin now if there are no non-zero derivatives
-            if (ndev < 1) {
-                continue;
-            }
+        } // end pragma omp parallel
 
-            // Update gradient
-            register int* ipar = inx;
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                (*gradient)[*ipar] += wrk_grad[*ipar];
+        // Sum up the working variables in the order of the bin ranges
+        for (int i = 0; i < nthreads; ++i) {
+            if (thread_curvature[i] != NULL) {
+                value      += thread_value[i];
+                *npred     += thread_npred[i];
+                *gradient  += thread_grad[i];
+                *curvature += *(thread_curvature[i]);
+                delete thread_curvature[i];
             }
+        }
 
-        } // endif: data was 0
-
-    } // endfor: iterated over all events
+        #endif
 
-    // Free temporary memory
-    if (values != NULL) delete [] values;
-    if (inx    != NULL) delete [] inx;
+    } // endif: more than one thread
 
-    // Dump statistics
-    #if defined(G_OPT_DEBUG)
-    std::cout << "Number of bins: " << n_bins << std::endl;
-    std::cout << "Number of bins used for computation: " << n_used << std::endl;
-    std::cout << "Number of bins excluded from data: " << n_exclude_data << std::endl;
-    std::cout << "Number of bins excluded due to small model: " << n_small_model << std::endl;
-    std::cout << "Number of bins with zero data: " << n_zero_data << std::endl;
-    std::cout << "Sum of data: " << sum_data << std::endl;
-    std::cout << "Sum of model: " << sum_model << std::endl;
-    std::cout << "Initial statistics: " << init_value << std::endl;
-    std::cout << "Statistics: " << m_value-init_value << std::endl;
-    #endif
+    // ... otherwise evaluate all bins in the calling thread
+    else {
+        value = likelihood_poisson_binned_range(models, 0, nbins,
+                                                gradient, curvature, npred);
+    }
 
     // Return
     return value;
@@ -1195,10 +1212,10 @@ double GObservation::likelihood_poisson_binned(const GModels& models,
  * \f$\delta^2 L/dp_1 dp_2\f$
  * and also updates the total number of predicted events m_npred.
  ***************************************************************************/
-double GObservation::likelihood_gaussian_binned(const GModels& models,
-                                                GVector*       gradient,
-                                                GMatrixSparse* curvature,
-                                                double*        npred) const
+double GObservation::likelihood_gaussian_binned(const GModels&    models,
+                                                GVector*          gradient,
+                                                GMatrixSymmetric* curvature,
+                                                double*           npred) const
 {
     // Initialise likelihood value
     double value = 0.0;
@@ -1211,12 +1228,15 @@ double GObservation::likelihood_gaussian_binned(const GModels& models,
     double* values = new double[npars];
     GVector wrk_grad(npars);
 
+    // Get event cube and allocate event bin view
+    const GEventCube* cube = static_cast<const GEventCube*>(events());
+    GEventBin*        view = cube->bin_view();
+
     // Iterate over all bins
-    for (int i = 0; i < events()->size(); ++i) {
+    for (int i = 0; i < cube->size(); ++i) {
 
-        // Get event pointer
-        const GEventBin* bin =
-            (*(static_cast<GEventCube*>(const_cast<GEvents*>(events()))))[i];
+        // Get event bin
+        const GEventBin* bin = cube->bin(i, view);
 
         // Get number of counts in bin
         double data = bin->counts();
@@ -1274,55 +1294,412 @@ double GObservation::likelihood_gaussian_binned(const GModels& models,
             continue;
         }
 
-        // Loop over columns
-        for (int jdev = 0; jdev < ndev; ++jdev) {
-
-            // Initialise computation
-            register int jpar = inx[jdev];
-            double       fa_i = wrk_grad[jpar] * weight;
-
-            // Update gradient
-            (*gradient)[jpar] -= fa * fa_i;
-
-            // Loop over rows
-            register int* ipar = inx;
-            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
-                values[idev] = fa_i * wrk_grad[*ipar];
-            }
-
-            // Add column to matrix
-            curvature->add_to_column(jpar, values, inx, ndev);
+        // Update gradient vector
+        for (int idev = 0; idev < ndev; ++idev) {
+            values[idev]            = wrk_grad[inx[idev]];
+            (*gradient)[inx[idev]] -= fa * weight * values[idev];
+        }
 
-        } // endfor: looped over columns
+        // Update curvature matrix
+        curvature->add_outer_product(values, inx, ndev, weight);
 
     } // endfor: iterated over all events
 
     // Free temporary memory
     if (values != NULL) delete [] values;
     if (inx    != NULL) delete [] inx;
+    if (view   != NULL) delete view;
 
     // Return
     return value;
 }
 
 
-/*==========================================================================
- =                                                                         =
- =                         Model gradient methods                          =
- =                                                                         =
- ==========================================================================*/
-
 /***********************************************************************//**
- * @brief Model function evaluation for gradient computation
+ * @brief Evaluate log-likelihood function for Poisson statistics and
+ *        unbinned analysis for a range of events
  *
- * @param[in] x Function value.
+ * @param[in] models Models.
+ * @param[in] first Index of first event.
+ * @param[in] last Index after last event.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] curvature Curvature matrix.
+ * @return Likelihood value.
+ *
+ * Evaluates the event term
+ *
+ * \f[
+ *    L = - \sum_i \log e_i
+ * \f]
+ *
+ * of the -(log-likelihood) function for the events [@p first, @p last[,
+ * and updates the parameter gradients and the curvature matrix. The
+ * method does not compute the \f$N_{\rm pred}\f$ term.
  ***************************************************************************/
-double GObservation::model_func::eval(const double& x)
+double GObservation::likelihood_poisson_unbinned_range(const GModels&    models,
+                                                       const int&        first,
+                                                       const int&        last,
+                                                       GVector*          gradient,
+                                                       GMatrixSymmetric* curvature) const
 {
-    // Set value
-    m_par->factor_value(x);
+    // Initialise likelihood value
+    double value = 0.0;
 
-    // Compute model value
+    // Get number of parameters
+    int npars = gradient->size();
+
+    // Allocate some working arrays
+    int*    inx    = new int[npars];
+    double* values = new double[npars];
+    GVector wrk_grad(npars);
+
+    // Get event list and allocate event atom view
+    const GEventList* list = static_cast<const GEventList*>(events());
+    GEventAtom*       view = list->atom_view();
+
+    // Iterate over all events in range
+    for (int i = first; i < last; ++i) {
+
+        // Get event pointer
+        const GEvent* event = list->atom(i, view);
+
+        // Get model and derivative
+        double model = this->model(models, *event, &wrk_grad);
+
+        // Skip bin if model is too small (avoids -Inf or NaN gradients)
+        if (model <= minmod) {
+            continue;
+        }
+
+        // Create index array of non-zero derivatives and initialise working
+        // array
+        int ndev = 0;
+        for (int i = 0; i < npars; ++i) {
+            values[i] = 0.0;
+            if (wrk_grad[i] != 0.0 && !gammalib::is_infinite(wrk_grad[i])) {
+                inx[ndev] = i;
+                ndev++;
+            }
+        }
+
+        // Update Poissonian statistics (excluding factorial term for faster
+        // computation)
+        value -= log(model);
+
+        // Skip bin now if there are no non-zero derivatives
+        if (ndev < 1) {
+            continue;
+        }
+
+        // Update gradient vector
+        double fb = 1.0 / model;
+        double fa = fb / model;
+        for (int idev = 0; idev < ndev; ++idev) {
+            values[idev]            = wrk_grad[inx[idev]];
+            (*gradient)[inx[idev]] -= fb * values[idev];
+        }
+
+        // Update curvature matrix
+        curvature->add_outer_product(values, inx, ndev, fa);
+
+    } // endfor: iterated over all events
+
+    // Free temporary memory
+    if (values != NULL) delete [] values;
+    if (inx    != NULL) delete [] inx;
+    if (view   != NULL) delete view;
+
+    // Return
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Evaluate log-likelihood function for Poisson statistics and
+ *        binned analysis for a range of bins
+ *
+ * @param[in] models Models.
+ * @param[in] first Index of first bin.
+ * @param[in] last Index after last bin.
+ * @param[in,out] gradient Gradient.
+ * @param[in,out] curvature Curvature matrix.
+ * @param[in,out] npred Number of predicted events.
+ * @return Likelihood value.
+ *
+ * Evaluates the -(log-likelihood) function
+ *
+ * \f[
+ *    L=-\sum_i n_i \log e_i - e_i
+ * \f]
+ *
+ * for the bins [@p first, @p last[, and updates the parameter gradients,
+ * the curvature matrix and the number of predicted events.
+ ***************************************************************************/
+double GObservation::likelihood_poisson_binned_range(const GModels&    models,
+                                                     const int&        first,
+                                                     const int&        last,
+                                                     GVector*          gradient,
+                                                     GMatrixSymmetric* curvature,
+                                                     double*           npred) const
+{
+    // Initialise likelihood value
+    double value = 0.0;
+
+    // Initialise statistics
+    #if defined(G_OPT_DEBUG)
+    int    n_bins         = 0;
+    int    n_used         = 0;
+    int    n_small_model  = 0;
+    int    n_zero_data    = 0;
+    int    n_exclude_data = 0;
+    double sum_data       = 0.0;
+    double sum_model      = 0.0;
+    double init_value     = value;
+    #endif
+
+    // Get number of parameters
+    int npars = gradient->size();
+
+    // Allocate some working arrays
+    int*    inx    = new int[npars];
+    double* values = new double[npars];
+    GVector wrk_grad(npars);
+
+    // Get event cube and allocate an event bin view for this method call.
+    // The bins are accessed through the view so that the event cube is not
+    // modified, which allows calling the method for several bin ranges
+    // concurrently.
+    const GEventCube* cube = static_cast<const GEventCube*>(events());
+    GEventBin*        view = cube->bin_view();
+
+    // Iterate over all bins in range
+    for (int i = first; i < last; ++i) {
+
+        // Update number of bins
+        #if defined(G_OPT_DEBUG)
+        n_bins++;
+        #endif
+
+        // Get event bin
+        const GEventBin* bin = cube->bin(i, view);
+
+        // Get number of counts in bin
+        double data = bin->counts();
+
+        // Skip bin if data is negative (filtering flag)
+        if (data < 0) {
+            #if defined(G_OPT_DEBUG)
+            n_exclude_data++;
+            #endif
+            continue;
+        }
+
+        // Get model and derivative
+        double model = this->model(models, *bin, &wrk_grad);
+
+        // Multiply model by bin size
+        model *= bin->size();
+
+        // Skip bin if model is too small (avoids -Inf or NaN gradients)
+        if (model <= minmod) {
+            #if defined(G_OPT_DEBUG)
+            n_small_model++;
+            #endif
+            continue;
+        }
+
+        // Update statistics
+        #if defined(G_OPT_DEBUG)
+        n_used++;
+        sum_data  += data;
+        sum_model += model;
+        #endif
+
+        // Update Npred
+        *npred += model;
+
+        // Multiply gradient by bin size
+        wrk_grad *= bin->size();
+
+        // Create index array of non-zero derivatives and initialise working
+        // array
+        int ndev = 0;
+        for (int i = 0; i < npars; ++i) {
+            values[i] = 0.0;
+            if (wrk_grad[i] != 0.0 && !gammalib::is_infinite(wrk_grad[i])) {
+                inx[ndev] = i;
+                ndev++;
+            }
+        }
+
+        // Update gradient vector and curvature matrix. To avoid
+        // unneccessary computations we distinguish the case where
+        // data>0 and data=0. The second case requires much less
+        // computation since it does not contribute to the curvature
+        // matrix ...
+        if (data > 0.0) {
+
+            // Update Poissonian statistics (excluding factorial term for
+            // faster computation)
+            value -= data * log(model) - model;
+
+            // Skip bin now if there are no non-zero derivatives
+            if (ndev < 1) {
+                continue;
+            }
+
+            // Pre computation
+            double fb = data / model;
+            double fc = (1.0 - fb);
+            double fa = fb / model;
+
+            // Update gradient vector
+            for (int idev = 0; idev < ndev; ++idev) {
+                values[idev]            = wrk_grad[inx[idev]];
+                (*gradient)[inx[idev]] += fc * values[idev];
+            }
+
+            // Update curvature matrix
+            curvature->add_outer_product(values, inx, ndev, fa);
+
+        } // endif: data was > 0
+
+        // ... handle now data=0
+        else {
+
+            // Update statistics
+            #if defined(G_OPT_DEBUG)
+            n_zero_data++;
+            #endif
+
+            // Update Poissonian statistics (excluding factorial term for
+            // faster computation)
+            value += model;
+
+            // Skip bin now if there are no non-zero derivatives
+            if (ndev < 1) {
+                continue;
+            }
+
+            // Update gradient
+            register int* ipar = inx;
+            for (register int idev = 0; idev < ndev; ++idev, ++ipar) {
+                (*gradient)[*ipar] += wrk_grad[*ipar];
+            }
+
+        } // endif: data was 0
+
+    } // endfor: iterated over all events
+
+    // Free temporary memory
+    if (values != NULL) delete [] values;
+    if (inx    != NULL) delete [] inx;
+    if (view   != NULL) delete view;
+
+    // Dump statistics
+    #if defined(G_OPT_DEBUG)
+    std::cout << "Number of bins: " << n_bins << std::endl;
+    std::cout << "Number of bins used for computation: " << n_used << std::endl;
+    std::cout << "Number of bins excluded from data: " << n_exclude_data << std::endl;
+    std::cout << "Number of bins excluded due to small model: " << n_small_model << std::endl;
+    std::cout << "Number of bins with zero data: " << n_zero_data << std::endl;
+    std::cout << "Sum of data: " << sum_data << std::endl;
+    std::cout << "Sum of model: " << sum_model << std::endl;
+    std::cout << "Initial statistics: " << init_value << std::endl;
+    std::cout << "Statistics: " << value-init_value << std::endl;
+    #endif
+
+    // Return
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Determine number of threads for event loop
+ *
+ * @param[in] nevents Number of events (or bins).
+ * @return Number of threads.
+ *
+ * Returns the number of OpenMP threads that should be used for evaluating
+ * the events (or bins) of the observation. A single thread is used if
+ * OpenMP is not available, if the observation is not thread safe, or if
+ * the method is called from within an active parallel region (for example
+ * the observation loop of GObservations::likelihood::eval()), so that
+ * nested parallelism never oversubscribes the available cores. The number
+ * of threads is furthermore limited so that each thread evaluates at least
+ * a minimum number of events.
+ ***************************************************************************/
+int GObservation::event_threads(const int& nevents) const
+{
+    // Initialise number of threads
+    int nthreads = 1;
+
+    // Determine number of threads
+    #ifdef _OPENMP
+    if (!omp_in_parallel() && is_threadsafe()) {
+        nthreads       = omp_get_max_threads();
+        int max_thread = nevents / min_events_per_thread;
+        if (nthreads > max_thread) {
+            nthreads = max_thread;
+        }
+        if (nthreads < 1) {
+            nthreads = 1;
+        }
+    }
+    #endif
+
+    // Return number of threads
+    return nthreads;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of model parameter
+ *
+ * @param[in] model Model.
+ * @param[in] par Model parameter.
+ * @return Index of @p par in @p model (-1 if @p par is not a parameter of
+ *         @p model).
+ *
+ * Determines the index of the parameter @p par in the @p model by
+ * comparing the parameter addresses. The index is used to locate the
+ * parameter in a copy of the model.
+ ***************************************************************************/
+int GObservation::par_index(const GModel& model, const GModelPar& par) const
+{
+    // Initialise index
+    int index = -1;
+
+    // Search parameter
+    for (int i = 0; i < model.size(); ++i) {
+        if (&(model[i]) == &par) {
+            index = i;
+            break;
+        }
+    }
+
+    // Return index
+    return index;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                         Model gradient methods                          =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Model function evaluation for gradient computation
+ *
+ * @param[in] x Function value.
+ ***************************************************************************/
+double GObservation::model_func::eval(const double& x)
+{
+    // Set value
+    m_par->factor_value(x);
+
+    // Compute model value
     double value = m_model.eval(m_event, *m_parent);
 
     // Return value
@@ -1512,3 +1889,271 @@ double GObservation::npred_spec_kern::eval(const double& x)
     // Return value
     return value;
 }
+
+
+/***********************************************************************//**
+ * @brief Return Npred and Npred gradients for one model
+ *
+ * @param[in] model Gamma-ray source model.
+ * @param[in,out] gradient Model parameter gradients.
+ * @param[in] offset Index of first model parameter in gradient vector.
+ * @return Number of predicted counts.
+ *
+ * Computes the number of predicted counts of a model together with the
+ * gradients with respect to all model parameters. The gradients are
+ * stored in the elements [@p offset, @p offset + model.size()[ of the
+ * @p gradient vector.
+ *
+ * For a constant sky model without energy or time dispersion the Npred
+ * integrand factorises into a spatial part, the spectral model and the
+ * temporal model. The gradients with respect to the free spectral and
+ * temporal parameters then follow from the analytic parameter gradients
+ * of the spectral and temporal components, and are integrated in the same
+ * pass as Npred itself using npred_spec_gradients(). Only the remaining
+ * (spatial) parameters are computed numerically using npred_grad().
+ *
+ * For all other models, Npred is computed using npred() and all gradients
+ * are computed using npred_grad().
+ ***************************************************************************/
+double GObservation::npred_gradients(const GModel& model,
+                                     GVector*      gradient,
+                                     const int&    offset) const
+{
+    // Initialise result
+    double npred = 0.0;
+    bool   done  = false;
+
+    // Get sky model pointer
+    const GModelSky* sky = dynamic_cast<const GModelSky*>(&model);
+
+    // Use analytic spectral and temporal gradients if the model is a
+    // constant sky model and if no energy or time dispersion is used
+    if ((sky != NULL) && (sky->spatial() != NULL) &&
+        (sky->spectral() != NULL) && (sky->temporal() != NULL) &&
+        sky->is_constant() &&
+        (response() != NULL) && !response()->use_edisp() &&
+        !response()->use_tdisp()) {
+
+        // Get ontime
+        double ontime = events()->gti().ontime();
+
+        // Continue only if ontime is positive
+        if (ontime > 0.0) {
+
+            // Collect indices of free spectral and temporal parameters
+            // that have analytic gradients
+            int              nspatial = sky->spatial()->size();
+            std::vector<int> pars;
+            for (int k = nspatial; k < model.size(); ++k) {
+                if (model[k].is_free() && model[k].has_grad()) {
+                    pars.push_back(k);
+                }
+            }
+
+            // Integrate Npred and gradients spectrally
+            GVector values = npred_spec_gradients(*sky,
+                                                  events()->gti().tstart(),
+                                                  pars);
+
+            // Store Npred and analytic gradients
+            npred = values[0] * ontime;
+            for (int i = 0; i < pars.size(); ++i) {
+                (*gradient)[offset+pars[i]] = values[i+1] * ontime;
+            }
+
+            // Compute all other gradients numerically
+            int next = 0;
+            for (int k = 0; k < model.size(); ++k) {
+                if (next < pars.size() && pars[next] == k) {
+                    next++;
+                    continue;
+                }
+                (*gradient)[offset+k] = npred_grad(model, model[k]);
+            }
+
+            // Signal that computation is done
+            done = true;
+
+        } // endif: ontime was positive
+
+        // ... otherwise Npred and all gradients are zero
+        else {
+            for (int k = 0; k < model.size(); ++k) {
+                (*gradient)[offset+k] = 0.0;
+            }
+            done = true;
+        }
+
+    } // endif: analytic gradients were applicable
+
+    // If analytic gradients were not applicable then compute Npred and
+    // determine all gradients numerically
+    if (!done) {
+        npred = this->npred(model);
+        for (int k = 0; k < model.size(); ++k) {
+            (*gradient)[offset+k] = npred_grad(model, model[k]);
+        }
+    }
+
+    // Return Npred
+    return npred;
+}
+
+
+/***********************************************************************//**
+ * @brief Integrates Npred and spectral and temporal gradients spectrally
+ *
+ * @param[in] model Sky model.
+ * @param[in] obsTime Measured photon arrival time.
+ * @param[in] pars Indices of spectral and temporal model parameters.
+ * @return Vector of Npred followed by the gradients of the parameters.
+ *
+ * Performs the same energy integration as npred_spec() but integrates in
+ * addition the gradients of Npred with respect to the spectral and temporal
+ * model parameters with indices @p pars. All integrands are evaluated in a
+ * single pass, so that the spatially integrated response is computed only
+ * once per energy node.
+ *
+ * The spatially integrated response is computed for a copy of the spatial
+ * model with a constant unit spectrum and a constant unit temporal model,
+ * so that the gradient kernels are the products of the spatially
+ * integrated response with the analytic spectral and temporal gradients.
+ * The gradients are hence also valid where the spectral or temporal model
+ * vanishes.
+ ***************************************************************************/
+GVector GObservation::npred_spec_gradients(const GModelSky&        model,
+                                           const GTime&            obsTime,
+                                           const std::vector<int>& pars) const
+{
+    // Set number of iterations for Romberg integration.
+    static const int iter = 8;
+
+    // Initialise result
+    GVector result((int)pars.size()+1);
+
+    // Setup model with unit spectrum and unit temporal model. The model
+    // keeps the name of the original model, so that cached spatial
+    // response integrals are shared with the original model.
+    GModelSky unit(*model.spatial(), GModelSpectralConst(1.0),
+                   GModelTemporalConst(1.0));
+    unit.name(model.name());
+
+    // Get energy boundaries
+    GEbounds ebounds = events()->ebounds();
+
+    // Loop over energy boundaries
+    for (int i = 0; i < ebounds.size(); ++i) {
+
+        // Get boundaries in MeV
+        double emin = ebounds.emin(i).MeV();
+        double emax = ebounds.emax(i).MeV();
+
+        // Continue only if valid
+        if (emax > emin) {
+
+            // Setup integration functions
+            GObservation::npred_spec_kerns integrands(this, &model, &unit,
+                                                      &obsTime, &pars);
+            GIntegrals                     integral(&integrands);
+
+            // Set number of iterations
+            integral.fixed_iter(iter);
+
+            // Do Romberg integration
+            #if defined(G_LN_ENERGY_INT)
+            emin = std::log(emin);
+            emax = std::log(emax);
+            #endif
+            result += integral.romberg(emin, emax);
+
+        } // endif: energy interval was valid
+
+    } // endfor: looped over energy boundaries
+
+    // Return result
+    return result;
+}
+
+
+/***********************************************************************//**
+ * @brief Integration kernels for npred_spec_gradients() method
+ *
+ * @param[in] x Function value.
+ * @return Vector of Npred kernel followed by gradient kernels.
+ *
+ * Evaluates the spatially integrated response once and multiplies it with
+ * the spectral and temporal model values and their analytic parameter
+ * gradients to obtain the Npred kernel and the gradient kernels. If
+ * G_LN_ENERGY_INT is defined the energy integration is done
+ * logarithmically, i.e. @p x is given in ln(energy) instead of energy.
+ ***************************************************************************/
+GVector GObservation::npred_spec_kerns::eval(const double& x)
+{
+    // Initialise result
+    GVector values(size());
+
+    // Set energy
+    GEnergy eng;
+    #if defined(G_LN_ENERGY_INT)
+    double expx = std::exp(x);
+    eng.MeV(expx);
+    #else
+    eng.MeV(x);
+    #endif
+
+    // Get spatially integrated response
+    double spatial = m_unit->npred(eng, *m_time, *m_parent);
+
+    // Apply instrument specific model scaling
+    if (m_model->has_scales()) {
+        spatial *= m_model->scale(m_parent->instrument()).value();
+    }
+
+    // Correct for variable substitution
+    #if defined(G_LN_ENERGY_INT)
+    spatial *= expx;
+    #endif
+
+    // Continue only if spatially integrated response is non-zero
+    if (spatial != 0.0) {
+
+        // Allocate gradient vector on first use
+        if (m_gradients.size() != m_model->size()) {
+            m_gradients = GVector(m_model->size());
+        }
+
+        // Get number of spatial and spectral parameters
+        int nspatial  = (m_model->spatial() != NULL)
+                        ? m_model->spatial()->size() : 0;
+        int nspectral = m_model->spectral()->size();
+
+        // Evaluate spectral and temporal components and their parameter
+        // gradients
+        double spec = m_model->spectral()->eval_gradients(eng, *m_time,
+                                                          m_gradients,
+                                                          nspatial);
+        double temp = m_model->temporal()->eval_gradients(*m_time,
+                                                          m_gradients,
+                                                          nspatial+nspectral);
+
+        // Store function value
+        values[0] = spatial * spec * temp;
+
+        // Set gradient kernels
+        double spatial_spec = spatial * temp;
+        double spatial_temp = spatial * spec;
+        for (int i = 0; i < m_pars->size(); ++i) {
+            int k = (*m_pars)[i];
+            if (k < nspatial+nspectral) {
+                values[i+1] = m_gradients[k] * spatial_spec;
+            }
+            else {
+                values[i+1] = m_gradients[k] * spatial_temp;
+            }
+        }
+
+    } // endif: spatially integrated response was non-zero
+
+    // Return values
+    return values;
+}
@@ -183,6 +183,16 @@ GObservations::likelihood& GObservations::likelihood::operator=(const likelihood
  * Poisson and Gaussian statistics. 
  * Note that different statistics and different analysis methods
  * (binned/unbinned) may be combined.
+ *
+ * The observations are distributed over the available OpenMP threads. If
+ * there are fewer observations than threads, the observations are instead
+ * evaluated sequentially, and each observation that supports it distributes
+ * its events over all threads (see GObservation::is_threadsafe()).
+ * In that case, one of the threads prefetches the next observation while
+ * the other threads evaluate the events (see GObservation::prefetch()).
+ * If the observations are distributed over the threads, loading the data
+ * of an observation overlaps with the evaluation of the observations of
+ * the other threads.
  ***************************************************************************/
 void GObservations::likelihood::eval(const GOptimizerPars& pars) 
 {
@@ -210,22 +220,39 @@ void GObservations::likelihood::eval(const GOptimizerPars& pars)
         if (m_gradient  != NULL) delete m_gradient;
         if (m_curvature != NULL) delete m_curvature;
 
-        // Initialise value, gradient vector and curvature matrix
-        m_value     = 0.0;
-        m_npred     = 0.0;
-        m_gradient  = new GVector(npars);
-        m_curvature = new GMatrixSparse(npars,npars);
-
-        // Set stack size and number of entries
-        int stack_size  = (2*npars > 100000) ? 2*npars : 100000;
-        int max_entries =  2*npars;
-        m_curvature->stack_init(stack_size, max_entries);
+        // Initialise value, gradient vector and curvature matrix. The
+        // curvature matrix is accumulated in a dense symmetric matrix,
+        // which is converted into a sparse matrix once all observations
+        // have been evaluated
+        m_value    = 0.0;
+        m_npred    = 0.0;
+        m_gradient = new GVector(npars);
+        GMatrixSymmetric curvature(npars,npars);
 
         // Allocate vectors to save working variables of each thread
-        std::vector<GVector*>       vect_cpy_grad;
-        std::vector<GMatrixSparse*> vect_cpy_curvature;
-        std::vector<double*>        vect_cpy_value;
-        std::vector<double*>        vect_cpy_npred;
+        std::vector<GVector*>          vect_cpy_grad;
+        std::vector<GMatrixSymmetric*> vect_cpy_curvature;
+        std::vector<double*>           vect_cpy_value;
+        std::vector<double*>           vect_cpy_npred;
+
+        // Determine whether the observation loop should be parallelised.
+        // If there are fewer observations than threads and if at least one
+        // of the observations is thread safe, the observations are
+        // evaluated one after the other, and each thread safe observation
+        // distributes its events over all threads. Otherwise the
+        // observations are distributed over the threads, and the event
+        // loops are executed by a single thread.
+        bool parallel_obs = true;
+        #ifdef _OPENMP
+        if (m_this->size() < omp_get_max_threads()) {
+            for (int i = 0; i < m_this->size(); ++i) {
+                if (m_this->m_obs[i]->is_threadsafe()) {
+                    parallel_obs = false;
+                    break;
+                }
+            }
+        }
+        #endif
 
         // Here OpenMP will paralellize the execution. The following code will
         // be executed by the differents threads. In order to avoid protecting
@@ -234,17 +261,19 @@ void GObservations::likelihood::eval(const GOptimizerPars& pars)
         // we add working variables in a vector (vect_cpy_*). When computation
         // is finished we just add all elements contain in the vector to the
         // attributes value.
-        #pragma omp parallel
+        #pragma omp parallel if(parallel_obs)
         {
-            // Allocate and initialize variable copies for multi-threading
-            GModels        cpy_model(m_this->models());
-            GVector*       cpy_gradient  = new GVector(npars);
-            GMatrixSparse* cpy_curvature = new GMatrixSparse(npars,npars);
-            double*        cpy_npred     = new double(0.0);
-            double*        cpy_value     = new double(0.0);
-
-            // Set stack size and number of entries
-            cpy_curvature->stack_init(stack_size, max_entries);
+            // Allocate and initialize variable copies for multi-threading.
+            // Node array interpolation no longer modifies the models, but
+            // spectral and spatial models still keep mutable evaluation
+            // caches (e.g. GModelSpectralPlaw::m_last_energy), hence each
+            // thread still needs its own model copy. The copy can be dropped
+            // once these caches have been made reentrant.
+            GModels           cpy_model(m_this->models());
+            GVector*          cpy_gradient  = new GVector(npars);
+            GMatrixSymmetric* cpy_curvature = new GMatrixSymmetric(npars,npars);
+            double*           cpy_npred     = new double(0.0);
+            double*           cpy_value     = new double(0.0);
 
             // Push variable copies into vector. This is a critical zone to
             // avoid multiple thread pushing simultaneously.
@@ -257,20 +286,30 @@ void GObservations::likelihood::eval(const GOptimizerPars& pars)
             }
 
             // Loop over all observations. The omp for directive will deal
-            // with the iterations on the differents threads.
-            #pragma omp for
+            // with the iterations on the differents threads. Observations
+            // are assigned dynamically, so that threads continue with the
+            // next observation while other threads load their events.
+            #pragma omp for schedule(dynamic)
             for (int i = 0; i < m_this->size(); ++i) {
 
+                // If the observations are evaluated one after the other
+                // then prefetch the next observation while the events of
+                // this observation are evaluated
+                const GObservation* obs = m_this->m_obs[i];
+                if (!parallel_obs && i+1 < m_this->size()) {
+                    obs->m_prefetch = m_this->m_obs[i+1];
+                }
+
                 // Compute likelihood
-                *cpy_value += m_this->m_obs[i]->likelihood(cpy_model,
-                                                           cpy_gradient,
-                                                           cpy_curvature,
-                                                           cpy_npred);
+                *cpy_value += obs->likelihood(cpy_model,
+                                              cpy_gradient,
+                                              cpy_curvature,
+                                              cpy_npred);
 
-            } // endfor: looped over observations
+                // Reset prefetching
+                obs->m_prefetch = NULL;
 
-            // Release stack
-            cpy_curvature->stack_destroy();
+            } // endfor: looped over observations
 
         } // end pragma omp parallel
 
@@ -281,7 +320,7 @@ void GObservations::likelihood::eval(const GOptimizerPars& pars)
             #pragma omp section
             {
                 for (int i = 0; i < vect_cpy_curvature.size() ; ++i) {
-                    *m_curvature += *(vect_cpy_curvature.at(i));
+                    curvature += *(vect_cpy_curvature.at(i));
                     delete vect_cpy_curvature.at(i);
                 }
             }
@@ -311,8 +350,8 @@ void GObservations::likelihood::eval(const GOptimizerPars& pars)
             }
         } // end of pragma omp sections
 
-        // Release stack
-        m_curvature->stack_destroy();
+        // Convert curvature matrix into sparse matrix
+        m_curvature = new GMatrixSparse(curvature);
 
     } while(0); // endwhile: main loop
 
@@ -29,11 +29,13 @@
 #include <config.h>
 #endif
 #include <string>
+#include <algorithm>          // std::sort, std::unique, std::lower_bound
 #include <unistd.h>           // access() function
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GException.hpp"
 #include "GIntegral.hpp"
+#include "GDerivative.hpp"
 #include "GResponse.hpp"
 #include "GEvent.hpp"
 #include "GPhoton.hpp"
@@ -42,10 +44,15 @@
 #include "GSource.hpp"        // will become obsolete
 #include "GEbounds.hpp"       // will become obsolete
 #include "GObservation.hpp"
+#include "GEventCube.hpp"
 #include "GModelSky.hpp"
+#include "GModelPar.hpp"
+#include "GVector.hpp"
+#include "GModelSpatial.hpp"
 #include "GModelSpatialPointSource.hpp"
 
 /* __ Method name definitions ____________________________________________ */
+#define G_EDISP_NODES                       "GResponse::edisp_nodes(int&)"
 #define G_IRF_RADIAL               "GResponse::irf_radial(GEvent&, GSource&,"\
                                                             " GObservation&)"
 #define G_IRF_ELLIPTICAL       "GResponse::irf_elliptical(GEvent&, GSource&,"\
@@ -149,6 +156,140 @@ GResponse& GResponse::operator=(const GResponse& rsp)
  =                                                                         =
  ==========================================================================*/
 
+/***********************************************************************//**
+ * @brief Return instrument response and spatial parameter gradients
+ *
+ * @param[in] event Event.
+ * @param[in] source Source.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first spatial parameter gradient (default: 0).
+ * @return Instrument response.
+ *
+ * Returns the instrument response for a given event, source and observation
+ * and stores the gradients of the instrument response with respect to all
+ * free parameters of the spatial model component that signal gradient
+ * support through GModelPar::has_grad() in the @p gradients vector. The
+ * gradient of the i-th spatial model parameter is stored at index
+ * @p offset + i. The gradients of all other spatial model parameters are
+ * set to zero.
+ *
+ * This method computes the gradients numerically using a simple difference
+ * of the instrument response, applying the same step size of 0.0002 that is
+ * used by GObservation::model_grad(). Compared to a numerical derivative of
+ * the full model this avoids the repeated evaluation of the spectral and
+ * temporal model components. Instrument responses that are able to compute
+ * the gradients analytically should overload this method.
+ *
+ * Like GObservation::model_grad(), the method varies the parameters on a
+ * local copy of the spatial model of the @p source, hence the spatial model
+ * is not modified and may be shared by several threads. The copy is only
+ * allocated if at least one parameter needs a gradient.
+ ***************************************************************************/
+double GResponse::irf_gradients(const GEvent&       event,
+                                const GSource&      source,
+                                const GObservation& obs,
+                                GVector&            gradients,
+                                const int&          offset) const
+{
+    // Compute instrument response
+    double irf = this->irf(event, source, obs);
+
+    // Get pointer to spatial model
+    const GModelSpatial* model = source.model();
+
+    // Initialise spatial model copy and source that uses the copy
+    GModelSpatial* cpy = NULL;
+    GSource        cpy_source;
+
+    // Loop over spatial model parameters
+    for (int i = 0; i < model->size(); ++i) {
+
+        // Initialise gradient
+        double grad = 0.0;
+
+        // Get reference to model parameter
+        const GModelPar& par = (*model)[i];
+
+        // Compute gradient only if parameter is free and has a gradient
+        if (par.is_free() && par.has_grad()) {
+
+            // Allocate spatial model copy on first use
+            if (cpy == NULL) {
+                cpy        = model->clone();
+                cpy_source = GSource(source.name(), cpy, source.energy(),
+                                     source.time());
+            }
+
+            // Get pointer to parameter of spatial model copy
+            GModelPar* ptr = &((*cpy)[i]);
+
+            // Save current model parameter
+            GModelPar current = par;
+
+            // Get actual parameter value
+            double x = par.factor_value();
+
+            // Set fixed step size for computation of derivative
+            const double step_size = 0.0002; // ~1 arcsec
+            double       h         = step_size;
+
+            // Re-adjust the step-size h in case that the initial step size
+            // is larger than the allowed parameter range 
+            if (par.has_min() && par.has_max()) {
+                double par_h = par.factor_max() - par.factor_min();
+                if (par_h < h) {
+                    h = par_h;
+                }
+            }
+
+            // Continue only if step size is positive
+            if (h > 0.0) {
+
+                // Setup derivative function
+                GResponse::irf_func function(this, event, cpy_source, obs, ptr);
+                GDerivative         derivative(&function);
+
+                // If we are too close to the minimum boundary use a right
+                // sided difference ...
+                if (par.has_min() && ((x-par.factor_min()) < h)) {
+                    grad = derivative.right_difference(x, h);
+                }
+
+                // ... otherwise if we are too close to the maximum boundary
+                // use a left sided difference ...
+                else if (par.has_max() && ((par.factor_max()-x) < h)) {
+                    grad = derivative.left_difference(x, h);
+                }
+
+                // ... otherwise use a symmetric difference
+                else {
+                    grad = derivative.difference(x, h);
+                }
+
+            } // endif: step size was positive
+
+            // Restore current model parameter, so that the remaining
+            // parameters are varied around the nominal model
+            *ptr = current;
+
+        } // endif: parameter was free and had a gradient
+
+        // Set gradient
+        gradients[offset+i] = grad;
+
+    } // endfor: looped over spatial model parameters
+
+    // Free spatial model copy
+    if (cpy != NULL) {
+        delete cpy;
+    }
+
+    // Return instrument response
+    return irf;
+}
+
+
 /***********************************************************************//**
  * @brief Convolve sky model with the instrument response
  *
@@ -168,11 +309,278 @@ GResponse& GResponse::operator=(const GResponse& rsp)
  * without taking into account any time dispersion. Energy dispersion is
  * correctly handled by this method. If time dispersion is indeed needed,
  * an instrument specific method needs to be provided.
+ *
+ * If @p grad is true, the parameter gradients of the sky model are set
+ * through GModelPar::factor_gradient(). This method is kept for
+ * compatibility, use the method that takes a gradient vector to evaluate
+ * the gradients without modifying the model.
  ***************************************************************************/
 double GResponse::convolve(const GModelSky&    model,
                            const GEvent&       event,
                            const GObservation& obs,
                            const bool&         grad) const
+{
+    // Initialise result
+    double prob = 0.0;
+
+    // Case A: compute gradients and set them as model parameter gradients
+    if (grad) {
+
+        // Evaluate probability and gradients
+        GVector gradients(model.size());
+        prob = convolve(model, event, obs, gradients);
+
+        // Set gradients (circumvent const correctness)
+        GModelSky& sky = const_cast<GModelSky&>(model);
+        for (int i = 0; i < sky.size(); ++i) {
+            sky[i].factor_gradient(gradients[i]);
+        }
+
+    }
+
+    // Case B: compute no gradients
+    else {
+        prob = eval_convolve(model, event, obs, NULL, 0);
+    }
+
+    // Return probability
+    return prob;
+}
+
+
+/***********************************************************************//**
+ * @brief Convolve sky model with the instrument response and return
+ *        parameter gradients
+ *
+ * @param[in] model Sky model.
+ * @param[in] event Event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Parameter gradients.
+ * @param[in] offset Index of first model parameter gradient (default: 0).
+ * @return Event probability.
+ *
+ * Computes the event probability (see convolve()) and stores the gradients
+ * of the event probability with respect to the sky model parameters in the
+ * @p gradients vector. The gradient of the i-th parameter of the sky model
+ * is stored at index @p offset + i, hence the vector needs to provide
+ * slots for all model parameters from @p offset on. The model parameters
+ * are not modified by this method.
+ *
+ * No gradients are computed if energy dispersion is used. In that case all
+ * gradients are set to zero.
+ ***************************************************************************/
+double GResponse::convolve(const GModelSky&    model,
+                           const GEvent&       event,
+                           const GObservation& obs,
+                           GVector&            gradients,
+                           const int&          offset) const
+{
+    // Initialise gradients
+    for (int i = 0; i < model.size(); ++i) {
+        gradients[offset+i] = 0.0;
+    }
+
+    // Evaluate probability and gradients
+    double prob = eval_convolve(model, event, obs, &gradients, offset);
+
+    // Return probability
+    return prob;
+}
+
+
+/***********************************************************************//**
+ * @brief Set number of true energy nodes per decade for energy dispersion
+ *
+ * @param[in] nodes Number of true energy nodes per decade (0: Romberg
+ *                  integration).
+ *
+ * @exception GException::invalid_argument
+ *            Negative number of nodes specified.
+ *
+ * Sets the number of nodes per decade of the logarithmic true energy grid
+ * that is used for the convolution of the energy dispersion. If @p nodes
+ * is zero, the energy dispersion is convolved by Romberg integration.
+ *
+ * The energy dispersion kernels are typically sampled sufficiently by
+ * 20 - 50 nodes per decade, while the Romberg integration evaluates the
+ * instrument response at 65 true energies per event.
+ ***************************************************************************/
+void GResponse::edisp_nodes(const int& nodes)
+{
+    // Throw an exception if the number of nodes is negative
+    if (nodes < 0) {
+        std::string msg = "Number of true energy nodes per decade "+
+                          gammalib::str(nodes)+" is negative. Please "
+                          "specify a non-negative number of nodes.";
+        throw GException::invalid_argument(G_EDISP_NODES, msg);
+    }
+
+    // Set number of nodes
+    m_edisp_nodes = nodes;
+
+    // Clear precomputed kernels as their nodes depend on the number of
+    // nodes per decade
+    m_edisp_eobs.clear();
+    m_edisp_start.clear();
+    m_edisp_energies.clear();
+    m_edisp_weights.clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Precompute energy dispersion kernels for an observation
+ *
+ * @param[in] obs Observation.
+ *
+ * Precomputes the true energies and weights of the energy dispersion
+ * kernels (see edisp_kernel()) for all measured energies of the event bins
+ * of a binned observation. The kernels form a sparse redistribution matrix
+ * from the true energy grid to the measured energies, which is used by
+ * eval_edisp() for all events of that energy, so that the kernels are not
+ * recomputed for every event bin.
+ *
+ * Kernels are only precomputed if energy dispersion is used and a number
+ * of true energy nodes per decade was set using edisp_nodes(). Otherwise,
+ * and for unbinned observations, the kernels of a previous observation are
+ * cleared and eval_edisp() computes the kernels for each event.
+ *
+ * The method should be called once before the events of the observation
+ * are evaluated, and must not be called while other threads evaluate the
+ * events of the observation.
+ ***************************************************************************/
+void GResponse::edisp_kernels(const GObservation& obs) const
+{
+    // Clear kernels
+    m_edisp_eobs.clear();
+    m_edisp_start.clear();
+    m_edisp_energies.clear();
+    m_edisp_weights.clear();
+
+    // Continue only if energy dispersion is summed over true energy nodes
+    if (use_edisp() && m_edisp_nodes > 0) {
+
+        // Continue only if the observation has an event cube
+        const GEventCube* cube = dynamic_cast<const GEventCube*>(obs.events());
+        if (cube != NULL) {
+
+            // Collect distinct measured energies of the event bins
+            std::vector<double> eobs;
+            eobs.reserve(cube->size());
+            for (int i = 0; i < cube->size(); ++i) {
+                eobs.push_back((*cube)[i]->energy().MeV());
+            }
+            std::sort(eobs.begin(), eobs.end());
+            eobs.erase(std::unique(eobs.begin(), eobs.end()), eobs.end());
+
+            // Compute kernel for each measured energy
+            for (int i = 0; i < eobs.size(); ++i) {
+                GEnergy obsEng;
+                obsEng.MeV(eobs[i]);
+                m_edisp_eobs.push_back(eobs[i]);
+                m_edisp_start.push_back(m_edisp_energies.size());
+                edisp_kernel(obsEng, &m_edisp_energies, &m_edisp_weights);
+            }
+            m_edisp_start.push_back(m_edisp_energies.size());
+
+        } // endif: observation had an event cube
+
+    } // endif: energy dispersion was summed over true energy nodes
+
+    // Return
+    return;
+}
+
+
+/*==========================================================================
+ =                                                                         =
+ =                            Protected methods                            =
+ =                                                                         =
+ ==========================================================================*/
+
+/***********************************************************************//**
+ * @brief Initialise class members
+ ***************************************************************************/
+void GResponse::init_members(void)
+{
+    // Initialise members
+    m_edisp_nodes = 0;
+    m_edisp_eobs.clear();
+    m_edisp_start.clear();
+    m_edisp_energies.clear();
+    m_edisp_weights.clear();
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Copy class members
+ *
+ * @param[in] rsp Response.
+ ***************************************************************************/
+void GResponse::copy_members(const GResponse& rsp)
+{
+    // Copy members
+    m_edisp_nodes    = rsp.m_edisp_nodes;
+    m_edisp_eobs     = rsp.m_edisp_eobs;
+    m_edisp_start    = rsp.m_edisp_start;
+    m_edisp_energies = rsp.m_edisp_energies;
+    m_edisp_weights  = rsp.m_edisp_weights;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Delete class members
+ ***************************************************************************/
+void GResponse::free_members(void)
+{
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Convolve sky model with the instrument response
+ *
+ * @param[in] model Sky model.
+ * @param[in] event Event.
+ * @param[in] obs Observation.
+ * @param[in,out] gradients Pointer to parameter gradients (NULL if no
+ *                          gradients should be computed).
+ * @param[in] offset Index of first model parameter gradient.
+ * @return Event probability.
+ *
+ * Computes the event probability
+ *
+ * \f[
+ *    P(p',E',t') = \int \int \int
+ *                  S(p,E,t) \times R(p',E',t'|p,E,t) \, dp \, dE \, dt
+ * \f]
+ *
+ * without taking into account any time dispersion. Energy dispersion is
+ * correctly handled by this method, yet no gradients are computed in that
+ * case and the @p gradients vector is left untouched. The integration over
+ * true energy is done by Romberg integration, unless a number of true
+ * energy nodes per decade was set using edisp_nodes(), in which case the
+ * integral is computed by eval_edisp().
+ *
+ * If @p gradients is not NULL and no energy dispersion is used, the
+ * gradients of the event probability with respect to the sky model
+ * parameters are stored in the @p gradients vector, starting from index
+ * @p offset.
+ ***************************************************************************/
+double GResponse::eval_convolve(const GModelSky&    model,
+                                const GEvent&       event,
+                                const GObservation& obs,
+                                GVector*            gradients,
+                                const int&          offset) const
 {
     // Set number of iterations for Romberg integration.
     static const int iter = 6;
@@ -186,8 +594,13 @@ double GResponse::convolve(const GModelSky&    model,
         // Get source time (no dispersion)
         GTime srcTime = event.time();
 
-        // Case A: Integration
-        if (use_edisp()) {
+        // Case A: Summation over true energy nodes
+        if (use_edisp() && m_edisp_nodes > 0) {
+            prob = eval_edisp(model, event, srcTime, obs);
+        }
+
+        // Case B: Integration
+        else if (use_edisp()) {
     
             // Retrieve true energy boundaries
             GEbounds ebounds = this->ebounds(event.energy());
@@ -203,7 +616,7 @@ double GResponse::convolve(const GModelSky&    model,
                 if (emax > emin) {
 
                     // Setup integration function
-                    edisp_kern integrand(this, model, event, srcTime, obs, grad);
+                    edisp_kern integrand(this, model, event, srcTime, obs);
                     GIntegral  integral(&integrand);
 
                     // Set number of iterations
@@ -220,21 +633,22 @@ double GResponse::convolve(const GModelSky&    model,
 
         }
 
-        // Case B: No integration (assume no energy dispersion)
+        // Case C: No integration (assume no energy dispersion)
         else {
     
             // Get source energy (no dispersion)
             GEnergy srcEng  = event.energy();
 
             // Evaluate probability
-            prob = eval_prob(model, event, srcEng, srcTime, obs, grad);
+            prob = eval_prob(model, event, srcEng, srcTime, obs, gradients,
+                             offset);
 
         }
 
         // Compile option: Check for NaN/Inf
         #if defined(G_NAN_CHECK)
         if (gammalib::is_notanumber(prob) || gammalib::is_infinite(prob)) {
-            std::cout << "*** ERROR: GResponse::convolve:";
+            std::cout << "*** ERROR: GResponse::eval_convolve:";
             std::cout << " NaN/Inf encountered";
             std::cout << " (prob=" << prob;
             std::cout << ", event=" << event;
@@ -250,44 +664,6 @@ double GResponse::convolve(const GModelSky&    model,
 }
 
 
-/*==========================================================================
- =                                                                         =
- =                            Protected methods                            =
- =                                                                         =
- ==========================================================================*/
-
-/***********************************************************************//**
- * @brief Initialise class members
- ***************************************************************************/
-void GResponse::init_members(void)
-{
-    // Return
-    return;
-}
-
-
-/***********************************************************************//**
- * @brief Copy class members
- *
- * @param[in] rsp Response.
- ***************************************************************************/
-void GResponse::copy_members(const GResponse& rsp)
-{
-    // Return
-    return;
-}
-
-
-/***********************************************************************//**
- * @brief Delete class members
- ***************************************************************************/
-void GResponse::free_members(void)
-{
-    // Return
-    return;
-}
-
-
 /***********************************************************************//**
  * @brief Convolve sky model with the instrument response
  *
@@ -296,7 +672,9 @@ void GResponse::free_members(void)
  * @param[in] srcEng Source energy.
  * @param[in] srcTime Source time.
  * @param[in] obs Observation.
- * @param[in] grad Should model gradients be computed? (default: true)
+ * @param[in,out] gradients Pointer to parameter gradients (NULL if no
+ *                          gradients should be computed).
+ * @param[in] offset Index of first model parameter gradient.
  * @return Event probability.
  *
  * Computes the event probability
@@ -306,13 +684,22 @@ void GResponse::free_members(void)
  * \f]
  *
  * for a given true energy \f$E\f$ and time \f$t\f$.
+ *
+ * If @p gradients is not NULL, the gradients with respect to the sky model
+ * parameters are stored in the @p gradients vector, following the parameter
+ * order of the sky model (spatial, spectral and temporal parameters). The
+ * gradient of the i-th sky model parameter is stored at index
+ * @p offset + i. Spatial parameter gradients are not computed for diffuse
+ * models and in case of energy dispersion, and the corresponding vector
+ * elements are then left untouched.
  ***************************************************************************/
 double GResponse::eval_prob(const GModelSky&    model,
                             const GEvent&       event,
                             const GEnergy&      srcEng,
                             const GTime&        srcTime,
                             const GObservation& obs,
-                            const bool&         grad) const
+                            GVector*            gradients,
+                            const int&          offset) const
 {
     // Initialise result
     double prob = 0.0;
@@ -323,21 +710,52 @@ double GResponse::eval_prob(const GModelSky&    model,
         // Set source
         GSource source(model.name(), model.spatial(), srcEng, srcTime);
         
+        // Determine whether gradients should be computed
+        bool grad = (gradients != NULL);
+
+        // Determine whether spatial gradients should be computed. Spatial
+        // gradients are not used in case of energy dispersion, and they are
+        // not computed for diffuse models since instrument responses may
+        // cache the IRF values of diffuse models.
+        bool spatial_grad = (grad && !use_edisp() &&
+                             model.spatial()->code() != GMODEL_SPATIAL_DIFFUSE);
+
+        // Determine the indices of the first spectral and temporal
+        // parameter gradients
+        int n_spatial  = model.spatial()->size();
+        int n_spectral = (model.spectral() != NULL) ? model.spectral()->size() : 0;
+        int n_temporal = (model.temporal() != NULL) ? model.temporal()->size() : 0;
+        int i_spectral = offset + n_spatial;
+        int i_temporal = i_spectral + n_spectral;
+
         // Get IRF value. This method returns the spatial component of the
-        // source model.
-        double irf = this->irf(event, source, obs);
+        // source model. If spatial gradients are requested, the IRF also
+        // stores the gradients of the spatial model parameters.
+        double irf = (spatial_grad)
+                     ? this->irf_gradients(event, source, obs, *gradients, offset)
+                     : this->irf(event, source, obs);
 
         // If required, apply instrument specific model scaling
+        double scale = 1.0;
         if (model.has_scales()) {
-            irf *= model.scale(obs.instrument()).value();
+            scale = model.scale(obs.instrument()).value();
+            irf  *= scale;
         }
 
         // Case A: evaluate gradients
         if (grad) {
 
             // Evaluate source model
-            double spec = (model.spectral() != NULL) ? model.spectral()->eval_gradients(srcEng, srcTime) : 1.0;
-            double temp = (model.temporal() != NULL) ? model.temporal()->eval_gradients(srcTime) : 1.0;
+            double spec = (model.spectral() != NULL)
+                          ? model.spectral()->eval_gradients(srcEng, srcTime,
+                                                             *gradients,
+                                                             i_spectral)
+                          : 1.0;
+            double temp = (model.temporal() != NULL)
+                          ? model.temporal()->eval_gradients(srcTime,
+                                                             *gradients,
+                                                             i_temporal)
+                          : 1.0;
 
             // Set probability
             prob = spec * temp * irf;
@@ -356,22 +774,26 @@ double GResponse::eval_prob(const GModelSky&    model,
             #endif
 
             // Multiply factors to spectral gradients
-            if (model.spectral() != NULL) {
-                double fact = temp * irf;
-                if (fact != 1.0) {
-                    for (int i = 0; i < model.spectral()->size(); ++i) {
-                        (*model.spectral())[i].factor_gradient((*model.spectral())[i].factor_gradient() * fact);
-                    }
+            double fact = temp * irf;
+            if (fact != 1.0) {
+                for (int i = 0; i < n_spectral; ++i) {
+                    (*gradients)[i_spectral+i] *= fact;
                 }
             }
 
             // Multiply factors to temporal gradients
-            if (model.temporal() != NULL) {
-                double fact = spec * irf;
-                if (fact != 1.0) {
-                    for (int i = 0; i < model.temporal()->size(); ++i) {
-                        (*model.temporal())[i].factor_gradient((*model.temporal())[i].factor_gradient() * fact);
-                    }
+            fact = spec * irf;
+            if (fact != 1.0) {
+                for (int i = 0; i < n_temporal; ++i) {
+                    (*gradients)[i_temporal+i] *= fact;
+                }
+            }
+
+            // Multiply factors to spatial gradients
+            fact = spec * temp * scale;
+            if (spatial_grad && fact != 1.0) {
+                for (int i = 0; i < n_spatial; ++i) {
+                    (*gradients)[offset+i] *= fact;
                 }
             }
 
@@ -409,6 +831,268 @@ double GResponse::eval_prob(const GModelSky&    model,
 }
 
 
+/***********************************************************************//**
+ * @brief Convolve sky model with energy dispersion on a true energy grid
+ *
+ * @param[in] model Sky model.
+ * @param[in] event Event.
+ * @param[in] srcTime Source time.
+ * @param[in] obs Observation.
+ * @return Event probability.
+ *
+ * Computes the event probability
+ *
+ * \f[
+ *    P(p',E',t') = \int P(p',E',t'|E,t) \, dE
+ *                \approx \sum_k w_k \, P(p',E',t'|E_k,t)
+ * \f]
+ *
+ * as a sum over the true energies \f$E_k\f$ and weights \f$w_k\f$ of the
+ * energy dispersion kernel for the measured event energy (see
+ * edisp_kernel()). The event probability \f$P(p',E',t'|E,t)\f$ for a given
+ * true energy is computed by eval_prob().
+ *
+ * If the kernel of the measured event energy was precomputed by
+ * edisp_kernels(), the precomputed true energies and weights are used.
+ * Otherwise the true energies and weights are computed node by node while
+ * summing up the event probability, hence the method does not allocate
+ * any memory for the kernel.
+ ***************************************************************************/
+double GResponse::eval_edisp(const GModelSky&    model,
+                             const GEvent&       event,
+                             const GTime&        srcTime,
+                             const GObservation& obs) const
+{
+    // Initialise result
+    double prob = 0.0;
+
+    // Get index of precomputed kernel for measured energy
+    int ikernel = edisp_kernel_index(event.energy());
+
+    // If the kernel was precomputed then sum event probability over the
+    // true energies of the kernel
+    if (ikernel != -1) {
+        for (int i = m_edisp_start[ikernel]; i < m_edisp_start[ikernel+1]; ++i) {
+            prob += m_edisp_weights[i] *
+                    eval_prob(model, event, m_edisp_energies[i], srcTime,
+                              obs, NULL, 0);
+        }
+    }
+
+    // ... otherwise compute kernel while summing the event probability
+    else {
+
+        // Retrieve true energy boundaries
+        GEbounds ebounds = this->ebounds(event.energy());
+
+        // Loop over all boundaries
+        for (int k = 0; k < ebounds.size(); ++k) {
+
+            // Get boundaries in MeV
+            double emin = ebounds.emin(k).MeV();
+            double emax = ebounds.emax(k).MeV();
+
+            // Continue only if valid
+            if (emin > 0.0 && emax > emin) {
+
+                // Determine grid nodes of interval
+                double xmin = std::log(emin);
+                double xmax = std::log(emax);
+                int    kmin = 0;
+                int    num  = 0;
+                edisp_grid(xmin, xmax, &kmin, &num);
+
+                // Sum event probability over nodes using the trapezoidal
+                // rule in ln E
+                double x_left = xmin;
+                double x      = xmin;
+                for (int i = 0; i < num; ++i) {
+                    double x_right = (i < num-1)
+                                     ? edisp_node(xmin, xmax, kmin, num, i+1)
+                                     : x;
+                    double expx    = std::exp(x);
+                    GEnergy srcEng;
+                    srcEng.MeV(expx);
+                    prob    += 0.5 * (x_right - x_left) * expx *
+                               eval_prob(model, event, srcEng, srcTime, obs,
+                                         NULL, 0);
+                    x_left   = x;
+                    x        = x_right;
+                }
+
+            } // endif: interval was valid
+
+        } // endfor: looped over intervals
+
+    } // endelse: computed kernel
+
+    // Return probability
+    return prob;
+}
+
+
+/***********************************************************************//**
+ * @brief Append energy dispersion kernel for a measured energy
+ *
+ * @param[in] obsEng Measured energy.
+ * @param[in,out] energies True energies.
+ * @param[in,out] weights Integration weights (MeV).
+ *
+ * Appends the true energies and weights for the integration of the event
+ * probability over the true energy intervals returned by ebounds() to the
+ * @p energies and @p weights vectors. The true energies are the nodes of a
+ * logarithmic grid with edisp_nodes() nodes per decade that fall within an
+ * interval, complemented by the interval boundaries (see edisp_grid()).
+ * The weights are those of the trapezoidal rule in \f$\ln E\f$, multiplied
+ * by the true energy to account for the variable substitution.
+ *
+ * As the grid nodes are shared by all measured energies, the true energies
+ * at which the instrument response is evaluated repeat from one event to
+ * the next, which allows instrument responses to cache their values for
+ * each true energy node.
+ ***************************************************************************/
+void GResponse::edisp_kernel(const GEnergy&        obsEng,
+                             std::vector<GEnergy>* energies,
+                             std::vector<double>*  weights) const
+{
+    // Retrieve true energy boundaries
+    GEbounds ebounds = this->ebounds(obsEng);
+
+    // Loop over all boundaries
+    for (int k = 0; k < ebounds.size(); ++k) {
+
+        // Get boundaries in MeV
+        double emin = ebounds.emin(k).MeV();
+        double emax = ebounds.emax(k).MeV();
+
+        // Continue only if valid
+        if (emin > 0.0 && emax > emin) {
+
+            // Determine grid nodes of interval
+            double xmin = std::log(emin);
+            double xmax = std::log(emax);
+            int    kmin = 0;
+            int    num  = 0;
+            edisp_grid(xmin, xmax, &kmin, &num);
+
+            // Append true energies and trapezoidal weights
+            for (int i = 0; i < num; ++i) {
+                double x     = edisp_node(xmin, xmax, kmin, num, i);
+                double left  = (i > 0)
+                               ? x - edisp_node(xmin, xmax, kmin, num, i-1)
+                               : 0.0;
+                double right = (i < num-1)
+                               ? edisp_node(xmin, xmax, kmin, num, i+1) - x
+                               : 0.0;
+                double expx  = std::exp(x);
+                GEnergy energy;
+                energy.MeV(expx);
+                energies->push_back(energy);
+                weights->push_back(0.5 * (left + right) * expx);
+            }
+
+        } // endif: interval was valid
+
+    } // endfor: looped over intervals
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return index of precomputed energy dispersion kernel
+ *
+ * @param[in] obsEng Measured energy.
+ * @return Kernel index (-1 if no kernel was precomputed for @p obsEng).
+ *
+ * Searches the kernels that were precomputed by edisp_kernels() for the
+ * kernel of the measured energy @p obsEng. The method does not modify the
+ * kernels and may be called concurrently from several threads.
+ ***************************************************************************/
+int GResponse::edisp_kernel_index(const GEnergy& obsEng) const
+{
+    // Initialise kernel index
+    int index = -1;
+
+    // Search kernel with bisection
+    if (!m_edisp_eobs.empty()) {
+        double                              eobs = obsEng.MeV();
+        std::vector<double>::const_iterator it   =
+            std::lower_bound(m_edisp_eobs.begin(), m_edisp_eobs.end(), eobs);
+        if (it != m_edisp_eobs.end() && *it == eobs) {
+            index = it - m_edisp_eobs.begin();
+        }
+    }
+
+    // Return kernel index
+    return index;
+}
+
+
+/***********************************************************************//**
+ * @brief Determine true energy grid nodes of an interval
+ *
+ * @param[in] xmin Logarithm of lower interval boundary (ln MeV).
+ * @param[in] xmax Logarithm of upper interval boundary (ln MeV).
+ * @param[out] kmin Index of first grid node strictly inside the interval.
+ * @param[out] num Number of nodes of the interval.
+ *
+ * Determines the nodes for the integration over the true energy interval
+ * [@p xmin, @p xmax]. The nodes are the lower boundary, all nodes
+ * \f$k \Delta\f$ of the logarithmic grid with
+ * \f$\Delta = \ln 10 / n\f$, where \f$n\f$ is the number of nodes per
+ * decade, that are strictly inside the interval, and the upper boundary.
+ ***************************************************************************/
+void GResponse::edisp_grid(const double& xmin, const double& xmax,
+                           int* kmin, int* num) const
+{
+    // Set logarithmic step size of true energy grid
+    const double step = gammalib::ln10 / double(m_edisp_nodes);
+
+    // Determine first and last grid node strictly inside the interval
+    int first = int(std::floor(xmin/step)) + 1;
+    int last  = int(std::ceil(xmax/step))  - 1;
+    if (first * step <= xmin) {
+        first++;
+    }
+    if (last * step >= xmax) {
+        last--;
+    }
+
+    // Set index of first grid node and number of nodes
+    *kmin = first;
+    *num  = (last >= first) ? last - first + 3 : 2;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Return true energy node of an interval
+ *
+ * @param[in] xmin Logarithm of lower interval boundary (ln MeV).
+ * @param[in] xmax Logarithm of upper interval boundary (ln MeV).
+ * @param[in] kmin Index of first grid node strictly inside the interval.
+ * @param[in] num Number of nodes of the interval.
+ * @param[in] i Node index [0,...,num-1].
+ * @return Logarithm of true energy of node (ln MeV).
+ *
+ * Returns the logarithm of the true energy of node @p i of an interval as
+ * determined by edisp_grid().
+ ***************************************************************************/
+double GResponse::edisp_node(const double& xmin, const double& xmax,
+                             const int& kmin, const int& num,
+                             const int& i) const
+{
+    // Return node
+    return ((i == 0)     ? xmin :
+            (i == num-1) ? xmax :
+            double(kmin+i-1) * (gammalib::ln10 / double(m_edisp_nodes)));
+}
+
+
 /***********************************************************************//**
  * @brief Integration kernel for edisp_kern() method
  *
@@ -425,7 +1109,8 @@ double GResponse::edisp_kern::eval(const double& x)
     eng.MeV(expx);
 
     // Get function value
-    double value = m_parent->eval_prob(m_model, m_event, eng, m_srcTime, m_obs, m_grad);
+    double value = m_parent->eval_prob(m_model, m_event, eng, m_srcTime, m_obs,
+                                       NULL, 0);
 
     // Save value if needed
     #if defined(G_NAN_CHECK)
@@ -450,3 +1135,21 @@ double GResponse::edisp_kern::eval(const double& x)
     // Return value
     return value;
 }
+
+
+/***********************************************************************//**
+ * @brief Instrument response function evaluation for gradient computation
+ *
+ * @param[in] x Function value.
+ ***************************************************************************/
+double GResponse::irf_func::eval(const double& x)
+{
+    // Set value
+    m_par->factor_value(x);
+
+    // Compute instrument response
+    double value = m_parent->irf(m_event, m_source, m_obs);
+
+    // Return value
+    return value;
+}
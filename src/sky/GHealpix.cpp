@@ -40,6 +40,7 @@
 #define G_READ                                    "GHealpix::read(GFitsHDU&)"
 #define G_XY2DIR                               "GHealpix::xy2dir(GSkyPixel&)"
 #define G_DIR2XY2                                "GHealpix::dir2xy(GSkyDir&)"
+#define G_PIX2DIR_VECTOR         "GHealpix::pix2dir(std::vector<GSkyPixel>&)"
 #define G_NEST2RING                               "GHealpix::nest2ring(int&)"
 #define G_RING2NEST                               "GHealpix::ring2nest(int&)"
 #define G_PIX2ANG_RING        "GHealpix::pix2ang_ring(int, double*, double*)"
@@ -464,6 +465,143 @@ GSkyPixel GHealpix::dir2pix(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of pixels
+ *
+ * @param[in] pixels Sky map pixels.
+ * @return Sky directions.
+ *
+ * @exception GException::invalid_argument
+ *            Sky map pixel is not 1-dimensional.
+ *
+ * Returns the sky directions of a vector of sky map @p pixels. The pixel
+ * ordering and coordinate system are resolved once for all pixels, and
+ * the transformations are done in loops over the pixels using the ring
+ * or nested scheme.
+ ***************************************************************************/
+std::vector<GSkyDir> GHealpix::pix2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Get number of pixels
+    int num = pixels.size();
+
+    // Throw an exception if one of the sky map pixels is not 1D
+    for (int i = 0; i < num; ++i) {
+        if (!pixels[i].is_1D()) {
+            std::string msg = "Sky map pixel "+pixels[i].print()+" is not"
+                              " 1-dimensional.\n"
+                              "Only 1-dimensional pixels are supported by the"
+                              " Healpix projection.";
+            throw GException::invalid_argument(G_PIX2DIR_VECTOR, msg);
+        }
+    }
+
+    // Allocate memory for transformation
+    std::vector<double> theta(num, 0.0);
+    std::vector<double> phi(num, 0.0);
+
+    // Perform ordering dependent conversion
+    switch (m_ordering) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            pix2ang_ring(int(pixels[i]), &theta[i], &phi[i]);
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            pix2ang_nest(int(pixels[i]), &theta[i], &phi[i]);
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Store coordinate system-dependent results
+    std::vector<GSkyDir> dirs(num);
+    switch (m_coordsys) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            dirs[i].radec(phi[i], gammalib::pihalf - theta[i]);
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            dirs[i].lb(phi[i], gammalib::pihalf - theta[i]);
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky map pixels.
+ *
+ * Returns the sky map pixels of a vector of sky directions @p dirs. The
+ * coordinate system and pixel ordering are resolved once for all sky
+ * directions, and the transformations are done in loops over the sky
+ * directions using the ring or nested scheme.
+ ***************************************************************************/
+std::vector<GSkyPixel> GHealpix::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Get number of sky directions
+    int num = dirs.size();
+
+    // Compute coordinate system dependent (z,phi)
+    std::vector<double> z(num, 0.0);
+    std::vector<double> phi(num, 0.0);
+    switch (m_coordsys) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            z[i]   = cos(gammalib::pihalf - dirs[i].dec());
+            phi[i] = dirs[i].ra();
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            z[i]   = cos(gammalib::pihalf - dirs[i].b());
+            phi[i] = dirs[i].l();
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Perform ordering dependent conversion
+    std::vector<int> index(num, 0);
+    switch (m_ordering) {
+    case 0:
+        for (int i = 0; i < num; ++i) {
+            index[i] = ang2pix_z_phi_ring(z[i], phi[i]);
+        }
+        break;
+    case 1:
+        for (int i = 0; i < num; ++i) {
+            index[i] = ang2pix_z_phi_nest(z[i], phi[i]);
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Set sky map pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(num);
+    for (int i = 0; i < num; ++i) {
+        pixels.push_back(GSkyPixel(index[i]));
+    }
+
+    // Return sky map pixels
+    return pixels;
+}
+
+
 /***********************************************************************//**
  * @brief Return interpolator for given sky direction
  *
@@ -33,7 +33,7 @@
 #include "GTools.hpp"
 #include "GMath.hpp"
 #include "GSkyDir.hpp"
-#include "GMatrix.hpp"
+#include "GMatrix3.hpp"
 #include "GVector.hpp"
 
 /* __ Method name definitions ____________________________________________ */
@@ -176,15 +176,17 @@ void GSkyDir::radec(const double& ra, const double& dec)
     // Set attributes
     m_has_lb    = false;
     m_has_radec = true;
-    #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    #endif
 
     // Set direction
     m_ra  = ra;
     m_dec = dec;
 
+    // Set sincos cache
+    #if defined(G_SINCOS_CACHE)
+    m_sin_dec = std::sin(m_dec);
+    m_cos_dec = std::cos(m_dec);
+    #endif
+
     // Return
     return;
 }
@@ -203,15 +205,17 @@ void GSkyDir::radec_deg(const double& ra, const double& dec)
     // Set attributes
     m_has_lb    = false;
     m_has_radec = true;
-    #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    #endif
 
     // Set direction
     m_ra  = ra  * gammalib::deg2rad;
     m_dec = dec * gammalib::deg2rad;
 
+    // Set sincos cache
+    #if defined(G_SINCOS_CACHE)
+    m_sin_dec = std::sin(m_dec);
+    m_cos_dec = std::cos(m_dec);
+    #endif
+
     // Return
     return;
 }
@@ -230,15 +234,17 @@ void GSkyDir::lb(const double& l, const double& b)
     // Set attributes
     m_has_lb    = true;
     m_has_radec = false;
-    #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    #endif
 
     // Set direction
     m_l = l;
     m_b = b;
 
+    // Set sincos cache
+    #if defined(G_SINCOS_CACHE)
+    m_sin_b = std::sin(m_b);
+    m_cos_b = std::cos(m_b);
+    #endif
+
     // Return
     return;
 }
@@ -257,15 +263,17 @@ void GSkyDir::lb_deg(const double& l, const double& b)
     // Set attributes
     m_has_lb    = true;
     m_has_radec = false;
-    #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    #endif
 
     // Set direction
     m_l = l * gammalib::deg2rad;
     m_b = b * gammalib::deg2rad;
 
+    // Set sincos cache
+    #if defined(G_SINCOS_CACHE)
+    m_sin_b = std::sin(m_b);
+    m_cos_b = std::cos(m_b);
+    #endif
+
     // Return
     return;
 }
@@ -288,19 +296,39 @@ void GSkyDir::lb_deg(const double& l, const double& b)
  * \f]
  ***************************************************************************/
 void GSkyDir::celvector(const GVector& vector)
+{
+    // Set sky direction from three-dimensional vector
+    celvector(GVector3(vector[0], vector[1], vector[2]));
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set sky direction from 3D vector in celestial coordinates
+ *
+ * @param[in] vector 3D vector.
+ *
+ * Variant of celvector(const GVector&) that takes a stack allocated
+ * vector, and that is used in the inner loops of numerical integrations.
+ ***************************************************************************/
+void GSkyDir::celvector(const GVector3& vector)
 {
     // Set attributes
     m_has_lb    = false;
     m_has_radec = true;
-    #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    #endif
 
     // Convert vector into sky position
     m_dec = std::asin(vector[2]);
     m_ra  = std::atan2(vector[1], vector[0]);
 
+    // Set sincos cache
+    #if defined(G_SINCOS_CACHE)
+    m_sin_dec = std::sin(m_dec);
+    m_cos_dec = std::cos(m_dec);
+    #endif
+
     // Return
     return;
 }
@@ -325,14 +353,14 @@ void GSkyDir::rotate_deg(const double& phi, const double& theta)
     }
 
     // Allocate Euler and rotation matrices
-    GMatrix ry;
-    GMatrix rz;
+    GMatrix3 ry;
+    GMatrix3 rz;
 
     // Set up rotation matrix to rotate from native coordinates to
     // celestial coordinates
     ry.eulery(m_dec * gammalib::rad2deg - 90.0);
     rz.eulerz(-m_ra * gammalib::rad2deg);
-    GMatrix rot = (ry * rz).transpose();
+    GMatrix3 rot = (ry * rz).transpose();
 
     // Set up native coordinate vector
     double phi_rad   = phi   * gammalib::deg2rad;
@@ -341,10 +369,10 @@ void GSkyDir::rotate_deg(const double& phi, const double& theta)
     double sin_phi   = std::sin(phi_rad);
     double cos_theta = std::cos(theta_rad);
     double sin_theta = std::sin(theta_rad);
-    GVector native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
+    GVector3 native(-cos_phi*sin_theta, sin_phi*sin_theta, cos_theta);
 
     // Rotate vector into celestial coordinates
-    GVector dir = rot * native;
+    GVector3 dir = rot * native;
 
     // Convert vector into sky position
     celvector(dir);
@@ -430,27 +458,40 @@ double GSkyDir::dec_deg(void) const
  * @return Sky direction as 3D vector in celestial coordinates.
  ***************************************************************************/
 GVector GSkyDir::celvector(void) const
+{
+    // Get 3D vector
+    GVector3 cel = celvector3();
+
+    // Return vector
+    return (GVector(cel[0], cel[1], cel[2]));
+}
+
+
+/***********************************************************************//**
+ * @brief Return sky direction as stack allocated 3D vector in celestial
+ *        coordinates
+ *
+ * @return Sky direction as 3D vector in celestial coordinates.
+ ***************************************************************************/
+GVector3 GSkyDir::celvector3(void) const
 {
     // If we have no equatorial coordinates then get them now
     if (!m_has_radec && m_has_lb) {
         gal2equ();
     }
 
-    // Compute 3D vector
-    double  cosra  = std::cos(m_ra);
-    double  sinra  = std::sin(m_ra);
+    // Compute 3D vector. The sincos cache is only valid if the sky
+    // direction was set in equatorial coordinates.
+    double   cosra  = std::cos(m_ra);
+    double   sinra  = std::sin(m_ra);
     #if defined(G_SINCOS_CACHE)
-    if (!m_has_radec_cache) {
-        m_has_radec_cache = true;
-        m_sin_dec         = std::sin(m_dec);
-        m_cos_dec         = std::cos(m_dec);
-    }
-    GVector vector(m_cos_dec*cosra, m_cos_dec*sinra, m_sin_dec);
+    double   cosdec = (m_has_radec) ? m_cos_dec : std::cos(m_dec);
+    double   sindec = (m_has_radec) ? m_sin_dec : std::sin(m_dec);
     #else
-    double  cosdec = std::cos(m_dec);
-    double  sindec = std::sin(m_dec);
-    GVector vector(cosdec*cosra, cosdec*sinra, sindec);
+    double   cosdec = std::cos(m_dec);
+    double   sindec = std::sin(m_dec);
     #endif
+    GVector3 vector(cosdec*cosra, cosdec*sinra, sindec);
 
     // Return vector
     return vector;
@@ -473,20 +514,8 @@ double GSkyDir::dist(const GSkyDir& dir) const
     // Compute dependent on coordinate system availability. This speeds
     // up things by avoiding unnecessary coordinate transformations.
     if (m_has_lb) {
-        #if defined(G_SINCOS_CACHE)
-        if (!m_has_lb_cache) {
-            m_has_lb_cache = true;
-            m_sin_b        = std::sin(m_b);
-            m_cos_b        = std::cos(m_b);
-        }
-        #endif
         if (dir.m_has_lb) {
             #if defined(G_SINCOS_CACHE)
-            if (!dir.m_has_lb_cache) {
-                dir.m_has_lb_cache = true;
-                dir.m_sin_b        = std::sin(dir.m_b);
-                dir.m_cos_b        = std::cos(dir.m_b);
-            }
             cosdis = m_sin_b * dir.m_sin_b +
                      m_cos_b * dir.m_cos_b *
                      std::cos(dir.m_l - m_l);
@@ -509,20 +538,8 @@ double GSkyDir::dist(const GSkyDir& dir) const
         }
     }
     else if (m_has_radec) {
-        #if defined(G_SINCOS_CACHE)
-        if (!m_has_radec_cache) {
-            m_has_radec_cache = true;
-            m_sin_dec         = std::sin(m_dec);
-            m_cos_dec         = std::cos(m_dec);
-        }
-        #endif
         if (dir.m_has_radec) {
             #if defined(G_SINCOS_CACHE)
-            if (!dir.m_has_radec_cache) {
-                dir.m_has_radec_cache = true;
-                dir.m_sin_dec         = std::sin(dir.m_dec);
-                dir.m_cos_dec         = std::cos(dir.m_dec);
-            }
             cosdis = m_sin_dec * dir.m_sin_dec +
                      m_cos_dec * dir.m_cos_dec *
                      std::cos(dir.m_ra - m_ra);
@@ -600,13 +617,6 @@ double GSkyDir::posang(const GSkyDir& dir) const
     // Compute dependent on coordinate system availability. This speeds
     // up things by avoiding unnecessary coordinate transformations.
     if (m_has_lb) {
-        #if defined(G_SINCOS_CACHE)
-        if (!m_has_lb_cache) {
-            m_has_lb_cache = true;
-            m_sin_b        = std::sin(m_b);
-            m_cos_b        = std::cos(m_b);
-        }
-        #endif
         if (dir.m_has_lb) {
             arg_1 = std::sin(dir.m_l - m_l);
             #if defined(G_SINCOS_CACHE)
@@ -629,13 +639,6 @@ double GSkyDir::posang(const GSkyDir& dir) const
         }
     }
     else if (m_has_radec) {
-        #if defined(G_SINCOS_CACHE)
-        if (!m_has_radec_cache) {
-            m_has_radec_cache = true;
-            m_sin_dec         = std::sin(m_dec);
-            m_cos_dec         = std::cos(m_dec);
-        }
-        #endif
         if (dir.m_has_radec) {
             arg_1 = std::sin(dir.m_ra - m_ra);
             #if defined(G_SINCOS_CACHE)
@@ -744,12 +747,10 @@ void GSkyDir::init_members(void)
 
     // Initialise sincos cache
     #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = false;
-    m_has_radec_cache = false;
-    m_sin_b           = 0.0;
-    m_cos_b           = 0.0;
-    m_sin_dec         = 0.0;
-    m_cos_dec         = 0.0;
+    m_sin_b   = 0.0;
+    m_cos_b   = 1.0;
+    m_sin_dec = 0.0;
+    m_cos_dec = 1.0;
     #endif
 
     // Return
@@ -774,12 +775,10 @@ void GSkyDir::copy_members(const GSkyDir& dir)
 
     // Copy sincos cache
     #if defined(G_SINCOS_CACHE)
-    m_has_lb_cache    = dir.m_has_lb_cache;
-    m_has_radec_cache = dir.m_has_radec_cache;
-    m_sin_b           = dir.m_sin_b;
-    m_cos_b           = dir.m_cos_b;
-    m_sin_dec         = dir.m_sin_dec;
-    m_cos_dec         = dir.m_cos_dec;
+    m_sin_b   = dir.m_sin_b;
+    m_cos_b   = dir.m_cos_b;
+    m_sin_dec = dir.m_sin_dec;
+    m_cos_dec = dir.m_cos_dec;
     #endif
 
     // Return
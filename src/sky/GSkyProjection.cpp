@@ -199,6 +199,56 @@ void GSkyProjection::coordsys(const std::string& coordsys)
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of sky map pixels
+ *
+ * @param[in] pixels Sky map pixels.
+ * @return Sky directions.
+ *
+ * Returns the sky directions of a vector of sky map @p pixels. The base
+ * class implementation calls pix2dir() for each pixel.
+ ***************************************************************************/
+std::vector<GSkyDir> GSkyProjection::pix2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Allocate sky directions
+    std::vector<GSkyDir> dirs;
+    dirs.reserve(pixels.size());
+
+    // Transform pixels
+    for (int i = 0; i < pixels.size(); ++i) {
+        dirs.push_back(pix2dir(pixels[i]));
+    }
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky map pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky map pixels.
+ *
+ * Returns the sky map pixels of a vector of sky directions @p dirs. The
+ * base class implementation calls dir2pix() for each sky direction.
+ ***************************************************************************/
+std::vector<GSkyPixel> GSkyProjection::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Allocate sky map pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(dirs.size());
+
+    // Transform sky directions
+    for (int i = 0; i < dirs.size(); ++i) {
+        pixels.push_back(dir2pix(dirs[i]));
+    }
+
+    // Return sky map pixels
+    return pixels;
+}
+
+
 /*==========================================================================
  =                                                                         =
  =                            Protected methods                            =
@@ -52,8 +52,10 @@
 #define G_OP_UNARY_DIV2                        "GSkymap::operator/=(double&)"
 #define G_OP_ACCESS_1D                        "GSkymap::operator(int&, int&)"
 #define G_OP_ACCESS_2D                  "GSkymap::operator(GSkyPixel&, int&)"
-#define G_OP_VALUE                        "GSkymap::operator(GSkyDir&, int&)"
+#define G_OP_INTERPOLATOR               "GSkymap::operator(GBilinear&, int&)"
 #define G_INX2DIR                                    "GSkymap::inx2dir(int&)"
+#define G_INTERPOLATOR                      "GSkymap::interpolator(GSkyDir&)"
+#define G_DIRS                                          "GSkymap::dirs(void)"
 #define G_PIX2DIR                              "GSkymap::pix2dir(GSkyPixel&)"
 #define G_DIR2INX                                "GSkymap::dir2inx(GSkyDir&)"
 #define G_DIR2PIX                                "GSkymap::dir2pix(GSkyDir&)"
@@ -306,6 +308,9 @@ GSkymap& GSkymap::operator=(const GSkymap& map)
  ***************************************************************************/
 GSkymap& GSkymap::operator=(const double& value)
 {
+    // Make sure that pixels are not shared
+    unshare();
+
     // Get number of pixels
     int num = m_num_pixels * m_num_maps;
 
@@ -349,11 +354,14 @@ GSkymap& GSkymap::operator+=(const GSkymap& map)
         throw GException::invalid_value(G_OP_UNARY_ADD, msg);
     }
 
+    // Get sky directions of all pixels
+    const std::vector<GSkyDir>& pixdirs = dirs();
+
     // Loop over all pixels of sky map
     for (int index = 0; index < npix(); ++index) {
 
         // Get sky direction of actual pixel
-        GSkyDir dir = inx2dir(index);
+        const GSkyDir& dir = pixdirs[index];
 
         // Loop over all layers
         for (int layer = 0; layer < nmaps(); ++layer) {
@@ -380,6 +388,9 @@ GSkymap& GSkymap::operator+=(const GSkymap& map)
  ***************************************************************************/
 GSkymap& GSkymap::operator+=(const double& value)
 {
+    // Make sure that pixels are not shared
+    unshare();
+
     // Set total number of sky map pixels
     int num = m_num_pixels * m_num_maps;
 
@@ -423,11 +434,14 @@ GSkymap& GSkymap::operator-=(const GSkymap& map)
         throw GException::invalid_value(G_OP_UNARY_SUB, msg);
     }
 
+    // Get sky directions of all pixels
+    const std::vector<GSkyDir>& pixdirs = dirs();
+
     // Loop over all pixels of sky map
     for (int index = 0; index < npix(); ++index) {
 
         // Get sky direction of actual pixel
-        GSkyDir dir = inx2dir(index);
+        const GSkyDir& dir = pixdirs[index];
 
         // Loop over all layers
         for (int layer = 0; layer < nmaps(); ++layer) {
@@ -454,6 +468,9 @@ GSkymap& GSkymap::operator-=(const GSkymap& map)
  ***************************************************************************/
 GSkymap& GSkymap::operator-=(const double& value)
 {
+    // Make sure that pixels are not shared
+    unshare();
+
     // Set total number of sky map pixels
     int num = m_num_pixels * m_num_maps;
 
@@ -497,11 +514,14 @@ GSkymap& GSkymap::operator*=(const GSkymap& map)
         throw GException::invalid_value(G_OP_UNARY_MUL, msg);
     }
 
+    // Get sky directions of all pixels
+    const std::vector<GSkyDir>& pixdirs = dirs();
+
     // Loop over all pixels of sky map
     for (int index = 0; index < npix(); ++index) {
 
         // Get sky direction of actual pixel
-        GSkyDir dir = inx2dir(index);
+        const GSkyDir& dir = pixdirs[index];
 
         // Loop over all layers
         for (int layer = 0; layer < nmaps(); ++layer) {
@@ -528,6 +548,9 @@ GSkymap& GSkymap::operator*=(const GSkymap& map)
  ***************************************************************************/
 GSkymap& GSkymap::operator*=(const double& factor)
 {
+    // Make sure that pixels are not shared
+    unshare();
+
     // Compute total number of pixels
     int n = npix() * nmaps();
 
@@ -572,11 +595,14 @@ GSkymap& GSkymap::operator/=(const GSkymap& map)
         throw GException::invalid_value(G_OP_UNARY_DIV, msg);
     }
 
+    // Get sky directions of all pixels
+    const std::vector<GSkyDir>& pixdirs = dirs();
+
     // Loop over all pixels of sky map
     for (int index = 0; index < npix(); ++index) {
 
         // Get sky direction of actual pixel
-        GSkyDir dir = inx2dir(index);
+        const GSkyDir& dir = pixdirs[index];
 
         // Loop over all layers
         for (int layer = 0; layer < nmaps(); ++layer) {
@@ -620,6 +646,9 @@ GSkymap& GSkymap::operator/=(const double& factor)
         throw GException::invalid_argument(G_OP_UNARY_DIV2, msg);
     }
 
+    // Make sure that pixels are not shared
+    unshare();
+
     // Compute total number of pixels
     int n = npix() * nmaps();
 
@@ -663,8 +692,16 @@ double& GSkymap::operator()(const int& index, const int& map)
     }
     #endif
 
+    // Make sure that pixels are not shared and are stored in double
+    // precision before returning a reference that allows modification of
+    // the pixel value
+    if (m_refs != NULL || m_fpixels != NULL) {
+        unshare();
+    }
+
     // Return reference to pixel value
-    return m_pixels[index+m_num_pixels*map];
+    return (m_pixel_major) ? m_pixels[index*m_num_maps+map]
+                           : m_pixels[index+m_num_pixels*map];
 }
 
 
@@ -680,7 +717,7 @@ double& GSkymap::operator()(const int& index, const int& map)
  * Access sky map pixel by its index, where the most quickly varying axis is
  * the x axis of the map.
  ***************************************************************************/
-const double& GSkymap::operator()(const int& index, const int& map) const
+double GSkymap::operator()(const int& index, const int& map) const
 {
     // Throw an error if pixel index or map index is not in valid range
     #if defined(G_RANGE_CHECK)
@@ -696,8 +733,12 @@ const double& GSkymap::operator()(const int& index, const int& map) const
     }
     #endif
 
-    // Return reference to pixel value
-    return m_pixels[index+m_num_pixels*map];
+    // Compute pixel offset
+    int offset = (m_pixel_major) ? index*m_num_maps+map
+                                 : index+m_num_pixels*map;
+
+    // Return pixel value
+    return ((m_fpixels != NULL) ? double(m_fpixels[offset]) : m_pixels[offset]);
 }
 
 
@@ -731,11 +772,19 @@ double& GSkymap::operator()(const GSkyPixel& pixel, const int& map)
     }
     #endif
 
+    // Make sure that pixels are not shared and are stored in double
+    // precision before returning a reference that allows modification of
+    // the pixel value
+    if (m_refs != NULL || m_fpixels != NULL) {
+        unshare();
+    }
+
     // Get pixel index
     int index = pix2inx(pixel);
 
     // Return reference to pixel value
-    return m_pixels[index+m_num_pixels*map];
+    return (m_pixel_major) ? m_pixels[index*m_num_maps+map]
+                           : m_pixels[index+m_num_pixels*map];
 }
 
 
@@ -753,7 +802,7 @@ double& GSkymap::operator()(const GSkyPixel& pixel, const int& map)
  *
  * @todo Implement proper skymap exception (actual is for matrix elements)
  ***************************************************************************/
-const double& GSkymap::operator()(const GSkyPixel& pixel, const int& map) const
+double GSkymap::operator()(const GSkyPixel& pixel, const int& map) const
 {
     // Throw an error if pixel index or map index is not in valid range
     #if defined(G_RANGE_CHECK)
@@ -772,8 +821,12 @@ const double& GSkymap::operator()(const GSkyPixel& pixel, const int& map) const
     // Get pixel index
     int index = pix2inx(pixel);
 
-    // Return reference to pixel value
-    return m_pixels[index+m_num_pixels*map];
+    // Compute pixel offset
+    int offset = (m_pixel_major) ? index*m_num_maps+map
+                                 : index+m_num_pixels*map;
+
+    // Return pixel value
+    return ((m_fpixels != NULL) ? double(m_fpixels[offset]) : m_pixels[offset]);
 }
 
 
@@ -791,17 +844,40 @@ const double& GSkymap::operator()(const GSkyPixel& pixel, const int& map) const
  * interpolation of the neighbouring pixels. If the sky direction falls
  * outside the area covered by the skymap, a value of 0 is returned.
  *
- * The method implements a computation cache that avoids recomputation of
- * interpolation indices and weights in case that the same sky direction
- * is requested several times. This speeds up use cases where skymap values
- * for various map indices have to be returned for the same sky direction.
+ * The method does not modify the sky map and may hence be called from
+ * several threads at the same time. If skymap values for several map
+ * indices are needed for the same sky direction, the bi-linear interpolator
+ * should be computed once using the interpolator() method and then be
+ * passed to operator()(const GBilinear&, const int&).
  ***************************************************************************/
 double GSkymap::operator()(const GSkyDir& dir, const int& map) const
+{
+    // Return interpolated skymap value
+    return ((*this)(interpolator(dir), map));
+}
+
+
+/***********************************************************************//**
+ * @brief Return interpolated skymap value for bi-linear interpolator
+ *
+ * @param[in] interpolator Bi-linear interpolator.
+ * @param[in] map Map index [0,...,nmaps()-1].
+ * @return Sky intensity.
+ *
+ * @exception GException::out_of_range
+ *            Map index lies outside valid range.
+ *
+ * Returns the skymap value for a bi-linear @p interpolator that has been
+ * computed using the interpolator() method. If the sky direction for which
+ * the interpolator was computed falls outside the area covered by the
+ * skymap, a value of 0 is returned.
+ ***************************************************************************/
+double GSkymap::operator()(const GBilinear& interpolator, const int& map) const
 {
     // Throw an error if the map index is not in valid range
     #if defined(G_RANGE_CHECK)
     if (map < 0 || map >= m_num_maps) {
-        throw GException::out_of_range(G_OP_VALUE,
+        throw GException::out_of_range(G_OP_INTERPOLATOR,
                                        "Sky map map index",
                                        map, m_num_maps);
     }
@@ -810,131 +886,23 @@ double GSkymap::operator()(const GSkyDir& dir, const int& map) const
     // Initialise intensity
     double intensity = 0.0;
 
-    // If the pre-computation cache has not been set or if the sky direction
-    // has changed then compute the bilinear interpolator
-    if (!m_hascache || (dir != m_last_dir)) {
-
-        // Perform computation for HealPix map
-        if (m_proj->size() == 1)  {
-
-            // Get Healpix interpolator
-            m_interpol = static_cast<GHealpix*>(m_proj)->interpolator(dir);
-
-            // Set containment flag and store actual sky direction as last
-            // direction
-            m_hascache  = true;
-            m_contained = true;
-            m_last_dir  = dir;
-
-        } // endif: we had a Healpix projection
-
-        // ... otherwise perform computation for WCS map
+    // Compute the interpolated intensity if the interpolator has non-zero
+    // weights (otherwise the sky direction was not contained in the map)
+    if (interpolator.weight1() != 0.0 || interpolator.weight2() != 0.0 ||
+        interpolator.weight3() != 0.0 || interpolator.weight4() != 0.0) {
+
+        // Compute interpolated skymap value. In pixel-major layout the
+        // values of a map are separated by the number of maps.
+        if (m_pixel_major) {
+            intensity = (m_fpixels != NULL)
+                        ? interpolator(m_fpixels+map, m_num_maps)
+                        : interpolator(m_pixels+map, m_num_maps);
+        }
         else {
-
-            // Determine sky pixel. At this point an exception may occur
-            // in case that the pixel cannot be represented by the
-            // relevant projection. We catch this exception here
-            try {
-
-                // Determine sky pixel
-                GSkyPixel pixel = dir2pix(dir);
-
-                // Set containment flag and store actual sky direction
-                // as last direction
-                m_hascache  = true;
-                m_contained = contains(pixel);
-                m_last_dir  = dir;
-
-                // Continue only if pixel is within the map
-                if (m_contained) {
-
-                    // Signal that we have a wrap around in the x axis
-                    double x_size = std::abs(m_num_x * static_cast<GWcs*>(m_proj)->cdelt(0));
-                    bool   x_wrap = (x_size > 359.99);
-
-                    // Get pixel index that is to the left-top of the actual
-                    // pixel. We take care of the special case of negative pixel
-                    // indices which arise if we are in the first column or
-                    // first row of the map.
-                    int inx_x = int(pixel.x());
-                    int inx_y = int(pixel.y());
-                    if (pixel.x() < 0.0) {
-                        inx_x--;
-                    }
-                    if (pixel.y() < 0.0) {
-                        inx_y--;
-                    }
-
-                    // Set left and right indices for interpolation. The left
-                    // index needs to be non-negative and the right index needs
-                    // to be not larger that the number of pixels. We treat
-                    // here also the special case of wrap around in the x
-                    // axis that may occur if we have an allsky map.
-                    int inx_x_left  = inx_x;
-                    int inx_y_left  = inx_y;
-                    int inx_x_right = inx_x_left + 1;
-                    int inx_y_right = inx_y_left + 1;
-                    if (inx_x_left < 0) {
-                        if (x_wrap) {
-                            inx_x_left += m_num_x;
-                        }
-                        else {
-                            inx_x_left  = 0;
-                        }
-                    }
-                    if (inx_x_right >= m_num_x) {
-                        if (x_wrap) {
-                            inx_x_right -= m_num_x;
-                        }
-                        else {
-                            inx_x_right = m_num_x - 1;
-                        }
-                    }
-                    if (inx_y_left < 0) {
-                        inx_y_left  = 0;
-                    }
-                    if (inx_y_right >= m_num_y) {
-                        inx_y_right = m_num_y - 1;
-                    }
-
-                    // Set weighting factors for interpolation
-                    double wgt_x_right = (pixel.x() - inx_x);
-                    double wgt_x_left  = 1.0 - wgt_x_right;
-                    double wgt_y_right = (pixel.y() - inx_y);
-                    double wgt_y_left  = 1.0 - wgt_y_right;
-
-                    // Compute skymap pixel indices for bi-linear interpolation
-                    m_interpol.index1() = inx_x_left  + inx_y_left  * m_num_x;
-                    m_interpol.index2() = inx_x_left  + inx_y_right * m_num_x;
-                    m_interpol.index3() = inx_x_right + inx_y_left  * m_num_x;
-                    m_interpol.index4() = inx_x_right + inx_y_right * m_num_x;
-
-                    // Compute weighting factors for bi-linear interpolation
-                    m_interpol.weight1() = wgt_x_left  * wgt_y_left;
-                    m_interpol.weight2() = wgt_x_left  * wgt_y_right;
-                    m_interpol.weight3() = wgt_x_right * wgt_y_left;
-                    m_interpol.weight4() = wgt_x_right * wgt_y_right;
-
-                } // endif: pixel was contained in map
-
-            } // endtry: pixel computation was successful
-            catch (GException::wcs_invalid_phi_theta) {
-                m_contained = false;
-            }
-
-        } // endelse: we had a WCS map
-
-    } // endif: computation of the bi-linear interpolater was required
-
-    // Compute the interpolated intensity if the pixel is contained in
-    // the map
-    if (m_contained) {
-
-        // Compute map offset
-        int offset = m_num_pixels * map;
-
-        // Compute interpolated skymap value
-        intensity = m_interpol(m_pixels+offset);
+            int offset = m_num_pixels * map;
+            intensity  = (m_fpixels != NULL) ? interpolator(m_fpixels+offset)
+                                             : interpolator(m_pixels+offset);
+        }
 
     } // endif: direction was contained in map
 
@@ -1006,6 +974,16 @@ void GSkymap::nmaps(const int& nmaps)
     // number of maps. Copy over any existing information.
     if (m_num_pixels > 0 && nmaps != m_num_maps) {
 
+        // Make sure that pixels are stored in double precision and in
+        // map-major layout
+        bool restore = m_pixel_major;
+        if (m_fpixels != NULL) {
+            unshare();
+        }
+        if (restore) {
+            pixel_major(false);
+        }
+
         // Compute new skymap size
         int new_size = m_num_pixels * nmaps;
 
@@ -1027,7 +1005,7 @@ void GSkymap::nmaps(const int& nmaps)
         }
 
         // Free existing pixels
-        if (m_pixels != NULL) delete [] m_pixels;
+        free_pixels();
 
         // Set pointer to stacked pixels
         m_pixels = pixels;
@@ -1035,6 +1013,11 @@ void GSkymap::nmaps(const int& nmaps)
         // Set number of maps
         m_num_maps = nmaps;
 
+        // Restore pixel-major layout
+        if (restore) {
+            pixel_major(true);
+        }
+
     } // endif: map had pixels
 
     // Return
@@ -1099,6 +1082,177 @@ GSkyDir GSkymap::inx2dir(const int& index) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of all pixels
+ *
+ * @return Sky directions of all pixels.
+ *
+ * @exception GException::invalid_value
+ *            No valid sky projection found.
+ *
+ * Returns the sky directions of all sky map pixels, ordered by pixel
+ * index. The sky directions are computed on the first call of the method
+ * and are then cached, hence the method should be preferred over
+ * inx2dir() when looping over all pixels of a sky map. The method may be
+ * called from several threads at the same time. Copies of a sky map do not
+ * copy the cache but compute the sky directions again on request.
+ ***************************************************************************/
+const std::vector<GSkyDir>& GSkymap::dirs(void) const
+{
+    // Throw error if sky projection is not valid
+    if (m_proj == NULL) {
+        std::string msg = "Sky projection has not been defined.";
+        throw GException::invalid_value(G_DIRS, msg);
+    }
+
+    // Get flag that signals that the sky directions are available. If the
+    // sky directions are available then make sure that they are read after
+    // the flag, otherwise compute them now.
+    int hasdirs = 0;
+    #pragma omp atomic read
+    hasdirs = m_hasdirs;
+    if (hasdirs != 0) {
+        #pragma omp flush
+    }
+    else {
+        set_dirs();
+    }
+
+    // Return sky directions
+    return m_dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns bi-linear interpolator for sky direction
+ *
+ * @param[in] dir Sky direction.
+ * @return Bi-linear interpolator.
+ *
+ * @exception GException::invalid_value
+ *            No valid sky projection found.
+ *
+ * Returns the bi-linear interpolator for a given sky direction. The
+ * interpolator holds the indices and weights of the four pixels that
+ * surround the sky direction and can be used to interpolate all maps of
+ * the sky map using operator()(const GBilinear&, const int&). If the sky
+ * direction falls outside the area covered by the skymap, all weights of
+ * the interpolator are zero.
+ *
+ * The method does not modify the sky map and may hence be called from
+ * several threads at the same time.
+ ***************************************************************************/
+GBilinear GSkymap::interpolator(const GSkyDir& dir) const
+{
+    // Throw error if sky projection is not valid
+    if (m_proj == NULL) {
+        std::string msg = "Sky projection has not been defined.";
+        throw GException::invalid_value(G_INTERPOLATOR, msg);
+    }
+
+    // Initialise interpolator
+    GBilinear interpolator;
+
+    // Perform computation for HealPix map
+    if (m_proj->size() == 1)  {
+        interpolator = static_cast<GHealpix*>(m_proj)->interpolator(dir);
+    }
+
+    // ... otherwise perform computation for WCS map
+    else {
+
+        // Determine sky pixel. At this point an exception may occur
+        // in case that the pixel cannot be represented by the
+        // relevant projection. We catch this exception here
+        try {
+
+            // Determine sky pixel
+            GSkyPixel pixel = dir2pix(dir);
+
+            // Continue only if pixel is within the map
+            if (contains(pixel)) {
+
+                // Signal that we have a wrap around in the x axis
+                double x_size = std::abs(m_num_x * static_cast<GWcs*>(m_proj)->cdelt(0));
+                bool   x_wrap = (x_size > 359.99);
+
+                // Get pixel index that is to the left-top of the actual
+                // pixel. We take care of the special case of negative pixel
+                // indices which arise if we are in the first column or
+                // first row of the map.
+                int inx_x = int(pixel.x());
+                int inx_y = int(pixel.y());
+                if (pixel.x() < 0.0) {
+                    inx_x--;
+                }
+                if (pixel.y() < 0.0) {
+                    inx_y--;
+                }
+
+                // Set left and right indices for interpolation. The left
+                // index needs to be non-negative and the right index needs
+                // to be not larger that the number of pixels. We treat
+                // here also the special case of wrap around in the x
+                // axis that may occur if we have an allsky map.
+                int inx_x_left  = inx_x;
+                int inx_y_left  = inx_y;
+                int inx_x_right = inx_x_left + 1;
+                int inx_y_right = inx_y_left + 1;
+                if (inx_x_left < 0) {
+                    if (x_wrap) {
+                        inx_x_left += m_num_x;
+                    }
+                    else {
+                        inx_x_left  = 0;
+                    }
+                }
+                if (inx_x_right >= m_num_x) {
+                    if (x_wrap) {
+                        inx_x_right -= m_num_x;
+                    }
+                    else {
+                        inx_x_right = m_num_x - 1;
+                    }
+                }
+                if (inx_y_left < 0) {
+                    inx_y_left  = 0;
+                }
+                if (inx_y_right >= m_num_y) {
+                    inx_y_right = m_num_y - 1;
+                }
+
+                // Set weighting factors for interpolation
+                double wgt_x_right = (pixel.x() - inx_x);
+                double wgt_x_left  = 1.0 - wgt_x_right;
+                double wgt_y_right = (pixel.y() - inx_y);
+                double wgt_y_left  = 1.0 - wgt_y_right;
+
+                // Compute skymap pixel indices for bi-linear interpolation
+                interpolator.index1() = inx_x_left  + inx_y_left  * m_num_x;
+                interpolator.index2() = inx_x_left  + inx_y_right * m_num_x;
+                interpolator.index3() = inx_x_right + inx_y_left  * m_num_x;
+                interpolator.index4() = inx_x_right + inx_y_right * m_num_x;
+
+                // Compute weighting factors for bi-linear interpolation
+                interpolator.weight1() = wgt_x_left  * wgt_y_left;
+                interpolator.weight2() = wgt_x_left  * wgt_y_right;
+                interpolator.weight3() = wgt_x_right * wgt_y_left;
+                interpolator.weight4() = wgt_x_right * wgt_y_right;
+
+            } // endif: pixel was contained in map
+
+        } // endtry: pixel computation was successful
+        catch (GException::wcs_invalid_phi_theta) {
+            ;
+        }
+
+    } // endelse: we had a WCS map
+
+    // Return interpolator
+    return interpolator;
+}
+
+
 /***********************************************************************//**
  * @brief Returns sky direction of pixel
  *
@@ -1432,8 +1586,16 @@ double GSkymap::flux(const GSkyPixel& pixel, const int& map) const
  *
  * @exception GException::invalid_value
  *            No valid sky projection found.
+ * @exception GException::out_of_range
+ *            Pixel index lies outside valid range.
  *
  * Returns the solid angle of the pixel with the specified @p index.
+ *
+ * The solid angles of all pixels are computed on the first call of the
+ * method and are then cached. Pixels that cannot be represented by the
+ * sky projection have a solid angle of zero. The method may be called from
+ * several threads at the same time. Copies of a sky map do not copy the
+ * cache but compute the solid angles again on request.
  ***************************************************************************/
 double GSkymap::solidangle(const int& index) const
 {
@@ -1443,11 +1605,30 @@ double GSkymap::solidangle(const int& index) const
         throw GException::invalid_value(G_SOLIDANGLE1, msg);
     }
 
-    // Determine solid angle from pixel index.
-    double solidangle = this->solidangle(inx2pix(index));
+    // Throw an error if pixel index is not in valid range
+    #if defined(G_RANGE_CHECK)
+    if (index < 0 || index >= m_num_pixels) {
+        throw GException::out_of_range(G_SOLIDANGLE1,
+                                       "Sky map pixel index",
+                                       index, m_num_pixels);
+    }
+    #endif
+
+    // Get flag that signals that the solid angles are available. If the
+    // solid angles are available then make sure that they are read after
+    // the flag, otherwise compute them now.
+    int hassolidangles = 0;
+    #pragma omp atomic read
+    hassolidangles = m_hassolidangles;
+    if (hassolidangles != 0) {
+        #pragma omp flush
+    }
+    else {
+        set_solidangles();
+    }
 
     // Return solid angle
-    return solidangle;
+    return (m_solidangles[index]);
 }
 
 
@@ -1525,6 +1706,12 @@ void GSkymap::projection(const GSkyProjection& proj)
     // Clone input WCS
     m_proj = proj.clone();
 
+    // Invalidate pixel cache
+    m_hasdirs        = 0;
+    m_hassolidangles = 0;
+    m_dirs.clear();
+    m_solidangles.clear();
+
     // Return
     return;
 }
@@ -1588,6 +1775,186 @@ bool GSkymap::contains(const GSkyPixel& pixel) const
 }
 
 
+/***********************************************************************//**
+ * @brief Declare sky map pixels as shared storage
+ *
+ * Declares the sky map pixels as shared storage. Any copy of the sky map
+ * will reference the same pixels instead of copying them. The pixels are
+ * only copied if they are modified by one of the sky maps (copy on write).
+ * The modified sky map then no longer shares its pixels.
+ *
+ * Note that pointers to the pixels that were obtained through the pixels()
+ * method may not be used to modify shared pixels.
+ *
+ * If the pixels are stored in single precision, the single precision
+ * pixels are shared.
+ ***************************************************************************/
+void GSkymap::share(void)
+{
+    // Allocate reference counter if pixels exist and are not yet shared
+    if ((m_pixels != NULL || m_fpixels != NULL) && m_refs == NULL) {
+        m_refs = new int(1);
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns pointer to pixel data
+ *
+ * @return Pointer to pixel data.
+ *
+ * Returns a pointer to the double precision pixel data. If the pixels are
+ * stored in single precision, a double precision copy of the pixels is
+ * created on first call and kept with the sky map, which doubles the
+ * memory that is needed for the pixels. This copy is released once the
+ * sky map is modified, and it may not be used to modify the sky map
+ * pixels. Use the const access operators or fpixels() to read single
+ * precision pixels without creating the copy.
+ ***************************************************************************/
+const double* GSkymap::pixels(void) const
+{
+    // If pixels are stored in single precision then get flag that signals
+    // that the double precision copy is available. If the copy is
+    // available then make sure that it is read after the flag, otherwise
+    // create it now.
+    if (m_fpixels != NULL) {
+        int hasdcopy = 0;
+        #pragma omp atomic read
+        hasdcopy = m_hasdcopy;
+        if (hasdcopy != 0) {
+            #pragma omp flush
+        }
+        else {
+            set_pixels();
+        }
+    }
+
+    // Return pointer to pixels
+    return m_pixels;
+}
+
+
+/***********************************************************************//**
+ * @brief Store sky map pixels in single precision
+ *
+ * Converts the sky map pixels into single precision storage, which halves
+ * the memory needed for the pixels. This is useful for large sky maps,
+ * such as map cubes, that are only read after they have been loaded and
+ * for which the single precision of the FITS file is sufficient.
+ *
+ * Single precision pixels are returned in double precision by the const
+ * access operators. Any non-const access to the pixels converts the pixels
+ * back into double precision storage.
+ *
+ * If the pixels were shared, the single precision pixels are again
+ * declared as shared storage.
+ ***************************************************************************/
+void GSkymap::single_precision(void)
+{
+    // Continue only if there are double precision pixels
+    if (m_fpixels == NULL && m_pixels != NULL) {
+
+        // Convert pixels into single precision
+        int    size    = m_num_pixels * m_num_maps;
+        float* fpixels = new float[size];
+        for (int i = 0; i < size; ++i) {
+            fpixels[i] = float(m_pixels[i]);
+        }
+
+        // Release double precision pixels and attach single precision
+        // pixels
+        bool shared = (m_refs != NULL);
+        free_pixels();
+        m_fpixels = fpixels;
+        if (shared) {
+            m_refs = new int(1);
+        }
+
+    } // endif: there were double precision pixels
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Set pixel layout
+ *
+ * @param[in] pixel_major Store pixels in pixel-major layout (default: true).
+ *
+ * Rearranges the sky map pixels so that the values of all maps of a given
+ * pixel are contiguous in memory (pixel-major layout) or so that the pixels
+ * of each map are contiguous in memory (map-major layout, the default).
+ *
+ * The pixel-major layout reduces the memory access strides for map cubes
+ * from which the values of several maps are looked up for the same sky
+ * direction, such as the spectra of a map cube. The layout has no impact
+ * on the values returned by the access methods and on the layout of the
+ * FITS file that is written.
+ *
+ * If the pixels were shared, the rearranged pixels are again declared as
+ * shared storage.
+ ***************************************************************************/
+void GSkymap::pixel_major(const bool& pixel_major)
+{
+    // Continue only if the layout changes
+    if (pixel_major != m_pixel_major) {
+
+        // Compute data size
+        int size = m_num_pixels * m_num_maps;
+
+        // Rearrange pixels if there are several maps
+        if (size > 0 && m_num_maps > 1) {
+
+            // Determine the strides of the actual and new layout
+            int pix_stride = (pixel_major) ? 1 : m_num_maps;
+            int map_stride = (pixel_major) ? m_num_pixels : 1;
+
+            // Rearrange pixels
+            bool shared = (m_refs != NULL);
+            if (m_fpixels != NULL) {
+                float* fpixels = new float[size];
+                for (int i = 0; i < m_num_pixels; ++i) {
+                    for (int k = 0; k < m_num_maps; ++k) {
+                        int dst = (pixel_major) ? i*m_num_maps+k
+                                                : i+m_num_pixels*k;
+                        fpixels[dst] = m_fpixels[i*pix_stride+k*map_stride];
+                    }
+                }
+                free_pixels();
+                m_fpixels = fpixels;
+            }
+            else if (m_pixels != NULL) {
+                double* pixels = new double[size];
+                for (int i = 0; i < m_num_pixels; ++i) {
+                    for (int k = 0; k < m_num_maps; ++k) {
+                        int dst = (pixel_major) ? i*m_num_maps+k
+                                                : i+m_num_pixels*k;
+                        pixels[dst] = m_pixels[i*pix_stride+k*map_stride];
+                    }
+                }
+                free_pixels();
+                m_pixels = pixels;
+            }
+            if (shared) {
+                m_refs = new int(1);
+            }
+
+        } // endif: there were several maps
+
+        // Set layout
+        m_pixel_major = pixel_major;
+
+    } // endif: layout changed
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Extract maps into a new sky map object
  *
@@ -1634,21 +2001,25 @@ GSkymap GSkymap::extract(const int& map, const int& nmaps) const
         pixels = new double[n_size];
     }
 
-    // Extract pixels
-    double *src = m_pixels + map*m_num_pixels;
+    // Extract pixels into map-major layout
     double *dst = pixels;
-    for (int i = 0; i < n_size; ++i) {
-        *dst++ = *src++;
+    for (int k = map; k < map+nmaps; ++k) {
+        for (int i = 0; i < m_num_pixels; ++i) {
+            int offset = (m_pixel_major) ? i*m_num_maps+k : i+m_num_pixels*k;
+            *dst++     = (m_fpixels != NULL) ? double(m_fpixels[offset])
+                                             : m_pixels[offset];
+        }
     }
 
     // Create a copy of the map
     GSkymap result = *this;
 
     // Delete pixels from that map
-    if (result.m_pixels != NULL) delete [] result.m_pixels;
+    result.free_pixels();
 
     // Attach copied pixels to the map
-    result.m_pixels = pixels;
+    result.m_pixels      = pixels;
+    result.m_pixel_major = false;
 
     // Set number of maps
     result.m_num_maps = nmaps;
@@ -1686,7 +2057,7 @@ void GSkymap::stack_maps(void)
         }
 
         // Free existing pixels
-        if (m_pixels != NULL) delete [] m_pixels;
+        free_pixels();
 
         // Set pointer to stacked pixels
         m_pixels = pixels;
@@ -1708,7 +2079,9 @@ void GSkymap::stack_maps(void)
  *
  * Loads HEALPix and non HEALPix skymaps. First searches for HEALPix map in
  * FITS file by scanning all HDUs for PIXTYPE=HEALPIX. If no HEALPix map has
- * been found then search load first non-empty image.
+ * been found then search load first non-empty image. The image pixels are
+ * loaded by memory mapping the FITS file if possible (see
+ * GFitsImage::use_mmap()).
  *
  * @todo Do we have to restrict a HEALPix map to a BinTable and a WCS map
  * to a Double precision image???
@@ -1759,8 +2132,11 @@ void GSkymap::load(const std::string& filename)
                     continue;
             }
 
-            // Load WCS map
-            read_wcs(static_cast<const GFitsImage&>(hdu));
+            // Load WCS map. As all image pixels are read at once, the
+            // pixels are loaded by memory mapping the FITS file.
+            GFitsImage* image = fits.image(extno);
+            image->use_mmap(true);
+            read_wcs(*image);
             break;
 
         } // endfor: looped over HDUs
@@ -1949,18 +2325,22 @@ std::string GSkymap::print(const GChatter& chatter) const
 void GSkymap::init_members(void)
 {
     // Initialise members
-    m_num_pixels = 0;
-    m_num_maps   = 0;
-    m_num_x      = 0;
-    m_num_y      = 0;
-    m_proj       = NULL;
-    m_pixels     = NULL;
-
-    // Initialise computation cache
-    m_hascache  = false;
-    m_contained = false;
-    m_last_dir.clear();
-    m_interpol.clear();
+    m_num_pixels  = 0;
+    m_num_maps    = 0;
+    m_num_x       = 0;
+    m_num_y       = 0;
+    m_proj        = NULL;
+    m_pixels      = NULL;
+    m_fpixels     = NULL;
+    m_hasdcopy    = 0;
+    m_refs        = NULL;
+    m_pixel_major = false;
+
+    // Initialise pixel cache
+    m_hasdirs        = 0;
+    m_hassolidangles = 0;
+    m_dirs.clear();
+    m_solidangles.clear();
 
     // Return
     return;
@@ -1999,16 +2379,18 @@ void GSkymap::alloc_pixels(void)
 void GSkymap::copy_members(const GSkymap& map)
 {
     // Copy attributes
-    m_num_pixels = map.m_num_pixels;
-    m_num_maps   = map.m_num_maps;
-    m_num_x      = map.m_num_x;
-    m_num_y      = map.m_num_y;
-
-    // Copy computation cache
-    m_hascache  = map.m_hascache;
-    m_contained = map.m_contained;
-    m_last_dir  = map.m_last_dir;
-    m_interpol  = map.m_interpol;
+    m_num_pixels  = map.m_num_pixels;
+    m_num_maps    = map.m_num_maps;
+    m_num_x       = map.m_num_x;
+    m_num_y       = map.m_num_y;
+    m_pixel_major = map.m_pixel_major;
+
+    // Reset pixel cache. The sky directions and solid angles are not
+    // copied but are recomputed on request.
+    m_hasdirs        = 0;
+    m_hassolidangles = 0;
+    m_dirs.clear();
+    m_solidangles.clear();
 
     // Clone sky projection if it is valid
     if (map.m_proj != NULL) m_proj = map.m_proj->clone();
@@ -2016,8 +2398,34 @@ void GSkymap::copy_members(const GSkymap& map)
     // Compute data size
     int size = m_num_pixels * m_num_maps;
 
-    // Copy pixels
-    if (size > 0 && map.m_pixels != NULL) {
+    // If pixels are shared then attach the pixels and increment the
+    // reference counter. For single precision pixels, only the single
+    // precision pixels are shared, as a double precision copy that may
+    // have been created by the pixels() method is private to each sky map.
+    if (map.m_refs != NULL) {
+        #pragma omp critical(GSkymap_refs)
+        {
+            (*map.m_refs)++;
+        }
+        if (map.m_fpixels != NULL) {
+            m_fpixels = map.m_fpixels;
+        }
+        else {
+            m_pixels = map.m_pixels;
+        }
+        m_refs = map.m_refs;
+    }
+
+    // ... otherwise copy single precision pixels
+    else if (size > 0 && map.m_fpixels != NULL) {
+        m_fpixels = new float[size];
+        for (int i = 0; i < size; ++i) {
+            m_fpixels[i] = map.m_fpixels[i];
+        }
+    }
+
+    // ... otherwise copy pixels
+    else if (size > 0 && map.m_pixels != NULL) {
         alloc_pixels();
         for (int i = 0; i < size; ++i) {
             m_pixels[i] = map.m_pixels[i];
@@ -2036,11 +2444,16 @@ void GSkymap::free_members(void)
 {
     // Free memory
     if (m_proj   != NULL) delete m_proj;
-    if (m_pixels != NULL) delete [] m_pixels;
+    free_pixels();
 
     // Signal free pointers
     m_proj       = NULL;
-    m_pixels     = NULL;
+
+    // Clear pixel cache
+    m_hasdirs        = 0;
+    m_hassolidangles = 0;
+    m_dirs.clear();
+    m_solidangles.clear();
 
     // Reset number of pixels
     m_num_pixels = 0;
@@ -2053,6 +2466,248 @@ void GSkymap::free_members(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Free skymap pixels
+ *
+ * Frees the skymap pixels. If the pixels are shared, the reference counter
+ * is decremented and the pixels are only deleted if no other sky map uses
+ * them anymore. For single precision pixels, the reference counter applies
+ * to the single precision pixels, while a double precision copy of the
+ * pixels is always deleted.
+ ***************************************************************************/
+void GSkymap::free_pixels(void)
+{
+    // If pixels are shared then decrement reference counter and delete
+    // pixels only if this was the last reference
+    if (m_refs != NULL) {
+        bool last = false;
+        #pragma omp critical(GSkymap_refs)
+        {
+            (*m_refs)--;
+            last = (*m_refs == 0);
+        }
+        if (last) {
+            if (m_fpixels != NULL) {
+                delete [] m_fpixels;
+            }
+            else if (m_pixels != NULL) {
+                delete [] m_pixels;
+            }
+            delete m_refs;
+        }
+        if (m_fpixels != NULL && m_pixels != NULL) {
+            delete [] m_pixels;
+        }
+    }
+
+    // ... otherwise delete pixels
+    else {
+        if (m_pixels  != NULL) delete [] m_pixels;
+        if (m_fpixels != NULL) delete [] m_fpixels;
+    }
+
+    // Signal free pointers
+    m_pixels   = NULL;
+    m_fpixels  = NULL;
+    m_refs     = NULL;
+    m_hasdcopy = 0;
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Make sure that skymap pixels are not shared
+ *
+ * If the pixels are shared with other sky maps, a private copy of the
+ * pixels is allocated. The private copy is not declared as shared, so that
+ * subsequent pixel modifications do not need to check the reference
+ * counter. If this sky map is the only user of shared pixels, the pixels
+ * are kept and the reference counter is released. Use share() to share
+ * the modified pixels again.
+ * If the pixels are stored in single precision, they are converted into
+ * double precision pixels, reusing a double precision copy that may have
+ * been created by the pixels() method.
+ * This method needs to be called before modifying any pixel.
+ ***************************************************************************/
+void GSkymap::unshare(void)
+{
+    // If pixels are stored in single precision then convert them into
+    // double precision pixels and release the single precision pixels
+    if (m_fpixels != NULL) {
+        double* pixels = m_pixels;
+        if (pixels == NULL) {
+            int size = m_num_pixels * m_num_maps;
+            pixels   = new double[size];
+            for (int i = 0; i < size; ++i) {
+                pixels[i] = double(m_fpixels[i]);
+            }
+        }
+        m_pixels = NULL;
+        free_pixels();
+        m_pixels = pixels;
+    }
+
+    // ... otherwise continue only if pixels are shared
+    else if (m_refs != NULL) {
+
+        // Determine whether this sky map is the only user of the pixels
+        bool unique = false;
+        #pragma omp critical(GSkymap_refs)
+        {
+            unique = (*m_refs == 1);
+        }
+
+        // If other sky maps use the pixels then create a private copy of
+        // the pixels and release the shared pixels ...
+        if (!unique) {
+            int     size   = m_num_pixels * m_num_maps;
+            double* pixels = new double[size];
+            for (int i = 0; i < size; ++i) {
+                pixels[i] = m_pixels[i];
+            }
+            free_pixels();
+            m_pixels = pixels;
+        }
+
+        // ... otherwise modify the pixels in place and release the
+        // reference counter
+        else {
+            delete m_refs;
+            m_refs = NULL;
+        }
+
+    } // endif: pixels were shared
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute sky directions of all pixels
+ *
+ * Computes the sky directions of all sky map pixels using a single call of
+ * the vector transformation GSkyProjection::pix2dir(). The sky directions
+ * are computed outside a critical region and are then stored in the cache
+ * within a critical region, hence the method may be called from several
+ * threads at the same time. The cache flag is only set once the sky
+ * directions have been stored, and is read atomically by dirs().
+ ***************************************************************************/
+void GSkymap::set_dirs(void) const
+{
+    // Set all sky map pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(m_num_pixels);
+    for (int index = 0; index < m_num_pixels; ++index) {
+        pixels.push_back(inx2pix(index));
+    }
+
+    // Compute sky directions of all pixels
+    std::vector<GSkyDir> dirs = m_proj->pix2dir(pixels);
+
+    // Store sky directions in cache. The flag is set after the sky
+    // directions have been stored and have been made visible to all
+    // threads.
+    #pragma omp critical(GSkymap_set_dirs)
+    {
+        if (m_hasdirs == 0) {
+            m_dirs.swap(dirs);
+            #pragma omp flush
+            #pragma omp atomic write
+            m_hasdirs = 1;
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Compute solid angles of all pixels
+ *
+ * Computes the solid angles of all sky map pixels. Pixels that cannot be
+ * represented by the sky projection, which may occur for example for the
+ * Hammer-Aitoff projection, are assigned a solid angle of zero. The solid
+ * angles are computed outside a critical region and are then stored in the
+ * cache within a critical region, hence the method may be called from
+ * several threads at the same time. The cache flag is only set once the
+ * solid angles have been stored, and is read atomically by solidangle().
+ ***************************************************************************/
+void GSkymap::set_solidangles(void) const
+{
+    // Compute solid angles of all pixels
+    std::vector<double> solidangles(m_num_pixels, 0.0);
+    for (int index = 0; index < m_num_pixels; ++index) {
+        try {
+            solidangles[index] = m_proj->solidangle(inx2pix(index));
+        }
+        catch (GException::wcs_invalid_x_y& e) {
+            solidangles[index] = 0.0;
+        }
+    }
+
+    // Store solid angles in cache. The flag is set after the solid angles
+    // have been stored and have been made visible to all threads.
+    #pragma omp critical(GSkymap_set_solidangles)
+    {
+        if (m_hassolidangles == 0) {
+            m_solidangles.swap(solidangles);
+            #pragma omp flush
+            #pragma omp atomic write
+            m_hassolidangles = 1;
+        }
+    }
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Create double precision copy of single precision pixels
+ *
+ * Creates a double precision copy of the single precision pixels. The copy
+ * is computed outside a critical region and is then attached to the sky
+ * map within a critical region, hence the method may be called from
+ * several threads at the same time. The copy flag is only set once the
+ * copy has been attached, and is read atomically by pixels().
+ ***************************************************************************/
+void GSkymap::set_pixels(void) const
+{
+    // Compute double precision copy
+    int     size   = m_num_pixels * m_num_maps;
+    double* pixels = new double[size];
+    for (int i = 0; i < size; ++i) {
+        pixels[i] = double(m_fpixels[i]);
+    }
+
+    // Attach the copy if no other thread has done it in the meantime. The
+    // flag is set after the copy has been attached and has been made
+    // visible to all threads.
+    #pragma omp critical(GSkymap_set_pixels)
+    {
+        if (m_hasdcopy == 0) {
+            const_cast<GSkymap*>(this)->m_pixels = pixels;
+            pixels = NULL;
+            #pragma omp flush
+            #pragma omp atomic write
+            m_hasdcopy = 1;
+        }
+    }
+
+    // Delete the copy if it was not attached
+    if (pixels != NULL) {
+        delete [] pixels;
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Set World Coordinate System
  *
@@ -2403,10 +3058,9 @@ GFitsBinTable* GSkymap::create_healpix_hdu(void) const
         GFitsTableDoubleCol column = GFitsTableDoubleCol("DATA", rows, number);
 
         // Fill data into column
-        double* ptr = m_pixels;
         for (int inx = 0; inx < number; ++inx) {
             for (int row = 0; row < rows; ++row) {
-                column(row,inx) = *ptr++;
+                column(row,inx) = (*this)(row,inx);
             }
         }
 
@@ -2463,19 +3117,19 @@ GFitsImageDouble* GSkymap::create_wcs_hdu(void) const
 
         // Store data in image
         if (naxis == 2) {
-            double* ptr = m_pixels;
+            int index = 0;
             for (int iy = 0; iy < m_num_y; ++iy) {
                 for (int ix = 0; ix < m_num_x; ++ix) {
-                    (*hdu)(ix,iy) = *ptr++;
+                    (*hdu)(ix,iy) = (*this)(index++);
                 }
             }
         }
         else {
-            double* ptr = m_pixels;
             for (int imap = 0; imap < m_num_maps; ++imap) {
+                int index = 0;
                 for (int iy = 0; iy < m_num_y; ++iy) {
                     for (int ix = 0; ix < m_num_x; ++ix) {
-                        (*hdu)(ix,iy,imap) = *ptr++;
+                        (*hdu)(ix,iy,imap) = (*this)(index++,imap);
                     }
                 }
             }
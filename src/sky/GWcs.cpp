@@ -739,6 +739,127 @@ GSkyPixel GWcs::dir2pix(const GSkyDir& dir) const
 }
 
 
+/***********************************************************************//**
+ * @brief Returns sky directions of sky map pixels
+ *
+ * @param[in] pixels Sky map pixels.
+ * @return Sky directions.
+ *
+ * Returns the sky directions of a vector of sky map @p pixels. All pixels
+ * are transformed by a single call to wcs_p2s(), which avoids the setup
+ * cost of the transformation for each individual pixel.
+ ***************************************************************************/
+std::vector<GSkyDir> GWcs::pix2dir(const std::vector<GSkyPixel>& pixels) const
+{
+    // Get number of pixels
+    int num = pixels.size();
+
+    // Allocate sky directions
+    std::vector<GSkyDir> dirs(num);
+
+    // Continue only if there are pixels
+    if (num > 0) {
+
+        // Allocate memory for transformation
+        std::vector<double> pixcrd(2*num);
+        std::vector<double> imgcrd(2*num);
+        std::vector<double> phi(num);
+        std::vector<double> theta(num);
+        std::vector<double> world(2*num);
+        std::vector<int>    stat(num);
+
+        // Set sky pixels. We have to add 1.0 here as the WCS pixel reference
+        // (CRPIX) starts from one while GSkyPixel starts from 0.
+        for (int i = 0, k = 0; i < num; ++i, k += 2) {
+            pixcrd[k]   = pixels[i].x() + 1.0;
+            pixcrd[k+1] = pixels[i].y() + 1.0;
+        }
+
+        // Transform pixel-to-world coordinates
+        wcs_p2s(num, 2, &pixcrd[0], &imgcrd[0], &phi[0], &theta[0],
+                &world[0], &stat[0]);
+
+        // Set sky directions
+        if (m_coordsys == 0) {
+            for (int i = 0, k = 0; i < num; ++i, k += 2) {
+                dirs[i].radec_deg(world[k], world[k+1]);
+            }
+        }
+        else {
+            for (int i = 0, k = 0; i < num; ++i, k += 2) {
+                dirs[i].lb_deg(world[k], world[k+1]);
+            }
+        }
+
+    } // endif: there were pixels
+
+    // Return sky directions
+    return dirs;
+}
+
+
+/***********************************************************************//**
+ * @brief Returns sky map pixels of sky directions
+ *
+ * @param[in] dirs Sky directions.
+ * @return Sky map pixels.
+ *
+ * Returns the sky map pixels of a vector of sky directions @p dirs. All
+ * sky directions are transformed by a single call to wcs_s2p(), which
+ * avoids the setup cost of the transformation for each individual sky
+ * direction.
+ ***************************************************************************/
+std::vector<GSkyPixel> GWcs::dir2pix(const std::vector<GSkyDir>& dirs) const
+{
+    // Get number of sky directions
+    int num = dirs.size();
+
+    // Allocate sky map pixels
+    std::vector<GSkyPixel> pixels;
+    pixels.reserve(num);
+
+    // Continue only if there are sky directions
+    if (num > 0) {
+
+        // Allocate memory for transformation
+        std::vector<double> pixcrd(2*num);
+        std::vector<double> imgcrd(2*num);
+        std::vector<double> phi(num);
+        std::vector<double> theta(num);
+        std::vector<double> world(2*num);
+        std::vector<int>    stat(num);
+
+        // Set world coordinates
+        if (m_coordsys == 0) {
+            for (int i = 0, k = 0; i < num; ++i, k += 2) {
+                world[k]   = dirs[i].ra_deg();
+                world[k+1] = dirs[i].dec_deg();
+            }
+        }
+        else {
+            for (int i = 0, k = 0; i < num; ++i, k += 2) {
+                world[k]   = dirs[i].l_deg();
+                world[k+1] = dirs[i].b_deg();
+            }
+        }
+
+        // Transform world-to-pixel coordinates
+        wcs_s2p(num, 2, &world[0], &phi[0], &theta[0], &imgcrd[0],
+                &pixcrd[0], &stat[0]);
+
+        // Set sky pixels. We have to subtract 1 here as GSkyPixel starts
+        // from zero while the WCS reference (CRPIX) starts from one.
+        for (int i = 0, k = 0; i < num; ++i, k += 2) {
+            pixels.push_back(GSkyPixel(pixcrd[k]-1.0, pixcrd[k+1]-1.0));
+        }
+
+    } // endif: there were sky directions
+
+    // Return sky map pixels
+    return pixels;
+}
+
+
 /***********************************************************************//**
  * @brief Set World Coordinate System parameters
  *
@@ -1039,7 +1160,7 @@ void GWcs::wcs_ini(int naxis)
 {
     // Signal that WCS information has not been set so far. This will be done
     // in wcs_set() upon request
-    m_wcsset = false;
+    m_wcsset = 0;
     
     // Clear vectors
     m_crpix.clear();
@@ -1168,8 +1289,11 @@ void GWcs::wcs_set(void) const
     // Initialize the linear transformation
     lin_set();
     
-    // Signal that WCS is set
-    m_wcsset = true;
+    // Signal that WCS is set. The flag is set after all derived parameters
+    // have been made visible to all threads
+    #pragma omp flush
+    #pragma omp atomic write
+    m_wcsset = 1;
     
     // Return
     return;
@@ -1302,9 +1426,23 @@ void GWcs::wcs_set_ctype(void) const
 void GWcs::wcs_p2s(int ncoord, int nelem, const double* pixcrd, double* imgcrd,
                       double* phi, double* theta, double* world, int* stat) const
 {
-    // Initialize if required
-    if (!m_wcsset)
-        wcs_set();
+    // Initialize if required. The flag that signals that the WCS is set is
+    // read atomically, and the WCS is set up in a critical region to avoid
+    // that several threads set up the WCS at the same time
+    int wcsset = 0;
+    #pragma omp atomic read
+    wcsset = m_wcsset;
+    if (wcsset != 0) {
+        #pragma omp flush
+    }
+    else {
+        #pragma omp critical(GWcs_wcs_set)
+        {
+            if (m_wcsset == 0) {
+                wcs_set();
+            }
+        }
+    }
     
     // Sanity check
     if (ncoord < 1 || (ncoord > 1 && nelem < m_naxis)) {
@@ -1368,9 +1506,23 @@ void GWcs::wcs_s2p(int ncoord, int nelem, const double* world,
                       double* phi, double* theta,  double* imgcrd,
                       double* pixcrd, int* stat) const
 {
-    // Initialize if required
-    if (!m_wcsset)
-        wcs_set();
+    // Initialize if required. The flag that signals that the WCS is set is
+    // read atomically, and the WCS is set up in a critical region to avoid
+    // that several threads set up the WCS at the same time
+    int wcsset = 0;
+    #pragma omp atomic read
+    wcsset = m_wcsset;
+    if (wcsset != 0) {
+        #pragma omp flush
+    }
+    else {
+        #pragma omp critical(GWcs_wcs_set)
+        {
+            if (m_wcsset == 0) {
+                wcs_set();
+            }
+        }
+    }
     
     // Sanity check
     if (ncoord < 1 || (ncoord > 1 && nelem < m_naxis)) {
@@ -128,16 +128,41 @@ GBilinear& GBilinear::operator=(const GBilinear& interpolator)
 /***********************************************************************//**
  * @brief Interpolator
  *
- * @param[in] array Bilinear interpolator.
+ * @param[in] array Array to interpolate.
+ * @param[in] stride Distance between consecutive array elements (default: 1).
  * @return Interpolated value.
+ *
+ * Interpolates the values array[index*stride] of the @p array.
+ ***************************************************************************/
+double GBilinear::operator()(const double* array, const int& stride) const
+{
+    // Perform interpolation
+    double value = m_wgt1 * array[m_inx1*stride] +
+                   m_wgt2 * array[m_inx2*stride] +
+                   m_wgt3 * array[m_inx3*stride] +
+                   m_wgt4 * array[m_inx4*stride];
+
+    // Return interpolated value
+    return value;
+}
+
+
+/***********************************************************************//**
+ * @brief Interpolator for single precision array
+ *
+ * @param[in] array Single precision array to interpolate.
+ * @param[in] stride Distance between consecutive array elements (default: 1).
+ * @return Interpolated value.
+ *
+ * Interpolates the values array[index*stride] of the @p array.
  ***************************************************************************/
-double GBilinear::operator()(const double* array)
+double GBilinear::operator()(const float* array, const int& stride) const
 {
     // Perform interpolation
-    double value = m_wgt1 * array[m_inx1] +
-                   m_wgt2 * array[m_inx2] +
-                   m_wgt3 * array[m_inx3] +
-                   m_wgt4 * array[m_inx4];
+    double value = m_wgt1 * double(array[m_inx1*stride]) +
+                   m_wgt2 * double(array[m_inx2*stride]) +
+                   m_wgt3 * double(array[m_inx3*stride]) +
+                   m_wgt4 * double(array[m_inx4*stride]);
 
     // Return interpolated value
     return value;
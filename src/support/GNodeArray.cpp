@@ -44,7 +44,7 @@
 #define G_REMOVE                                   "GNodeArray::remove(int&)"
 #define G_INTERPOLATE                      "GNodeArray::interpolate(double&,"\
                                                      " std::vector<double>&)"
-#define G_SET_VALUE                          "GNodeArray::set_value(double&)"
+#define G_LOCATE                         "GNodeArray::locate(double&, int*)"
 
 /* __ Macros _____________________________________________________________ */
 
@@ -256,7 +256,7 @@ double& GNodeArray::at(const int& index)
     #endif
 
     // Signal that setup needs to be called
-    m_need_setup = false;
+    m_need_setup = true;
 
     // Return node
     return m_node[index];
@@ -284,9 +284,6 @@ const double& GNodeArray::at(const int& index) const
     }
     #endif
 
-    // Signal that setup needs to be called
-    m_need_setup = false;
-
     // Return node
     return m_node[index];
 }
@@ -510,6 +507,9 @@ void GNodeArray::nodes(const std::vector<double>& vector)
  *
  * This method performs a linear interpolation of values \f$y_i\f$. The
  * corresponding values \f$x_i\f$ are stored in the node array.
+ *
+ * The method does not modify the node array and may be called concurrently
+ * from several threads.
  ***************************************************************************/
 double GNodeArray::interpolate(const double& value,
                                const std::vector<double>& vector) const
@@ -525,12 +525,12 @@ double GNodeArray::interpolate(const double& value,
                                           vector.size());
     }
     
-    // Set interpolation value (circumvent const correctness)
-    set_value(value);
+    // Get indices and weighting factors for interpolation
+    GNodeArray::weights w = locate(value);
 
     // Interpolate
-    double y = vector[inx_left()]  * wgt_left() +
-               vector[inx_right()] * wgt_right();
+    double y = vector[w.inx_left]  * w.wgt_left +
+               vector[w.inx_right] * w.wgt_right;
 
     // Return
     return y;
@@ -538,131 +538,185 @@ double GNodeArray::interpolate(const double& value,
 
 
 /***********************************************************************//**
- * @brief Set indices and weighting factors for interpolation
+ * @brief Return indices and weighting factors for interpolation
  *
  * @param[in] value Value for which the interpolation should be done.
+ * @param[in,out] hint Index of left node of a previous call (optional).
+ * @return Indices and weighting factors for interpolation.
  *
  * @exception GException::invalid_value
  *            No nodes are available for interpolation.
  *
- * Set the indices that bound the specified value and the corresponding
+ * Returns the indices that bound the specified value and the corresponding
  * weighting factors for linear interpolation. If the array has a linear
  * form (i.e. the nodes are equidistant), an analytic formula is used to
  * determine the boundary indices. If the nodes are not equidistant the
  * boundary indices are searched by bisection. If there is only a single
  * node, no interpolation is done and the index of this node is returned.
+ * Values outside the node range are extrapolated using the first (or last)
+ * two nodes.
+ *
+ * If a @p hint is given, the nodes adjacent to the left node of the hint are
+ * checked first before a bisection is done, and the hint is updated to the
+ * left node found. This speeds up the search for monotonic sequences of
+ * values. The hint is owned by the caller, and a value of -1 may be used
+ * if no previous left node is known.
  *
- * Note that this method needs to be called after changing the node array
- * to setup the corrected interpolation indices and weights.
+ * The method does not modify the node array and may be called concurrently
+ * from several threads. If nodes were modified through the non-const
+ * access operators since the last modification by any other non-const
+ * method, the precomputed node distances are outdated and the method
+ * falls back to a bisection on the node values.
  ***************************************************************************/
-void GNodeArray::set_value(const double& value) const
+GNodeArray::weights GNodeArray::locate(const double& value, int* hint) const
 {
     // Get number of nodes
     int nodes = m_node.size();
 
-    /*
-    // Throw an exception if less than 2 nodes are available
-    if (nodes < 2) {
-        throw GException::not_enough_nodes(G_SET_VALUE, nodes);
-    }
-    */
     // Throw an exception if there are no nodes
     if (nodes < 1) {
         std::string msg = "Attempting to set interpolating value without "
                           "having any nodes. Interpolation can only be "
                           "done if nodes are available.";
-        throw GException::invalid_value(G_SET_VALUE, msg);
+        throw GException::invalid_value(G_LOCATE, msg);
     }
 
-    // Initialize computation flag
-    bool compute = true;
-
-    // Update cache if required. If cache was updated, computation is
-    // enforced. Otherwise we check if the value has changed. The value
-    // check is only done when a last value has been recorded.
-    if (m_need_setup) {
-        setup();
+    // Signal whether the precomputed node distances and linear array
+    // parameters are up to date. They are only outdated if nodes were
+    // modified through the non-const access operators, in which case the
+    // node values are used directly. The flag is only modified by
+    // non-const methods, hence it is read without any lock.
+    bool use_setup = !m_need_setup;
+
+    // Initialise result
+    GNodeArray::weights result;
+
+    // Handle special case of a single node
+    if (nodes == 1) {
+        result.inx_left  = 0;
+        result.inx_right = 0;
+        result.wgt_left  = 1.0;
+        result.wgt_right = 0.0;
     }
+
+    // Handle all other cases
     else {
-        if (m_has_last_value && value == m_last_value) {
-            compute = false;
-        }
-    }
 
-    // Continue only if computation is required
-    if (compute) {
+        // Initialise left index
+        int inx = -1;
 
-        // Handle special case of a single node
-        if (nodes == 1) {
-            m_inx_left  = 0;
-            m_inx_right = 0;
-            m_wgt_left  = 1.0;
-            m_wgt_right = 0.0;
+        // If a hint is given then check whether the value is bracketed by
+        // the nodes of the hint or by the next nodes
+        if (hint != NULL && *hint >= 0 && *hint < nodes-1) {
+            int h = *hint;
+            if (value >= m_node[h] && value <= m_node[h+1]) {
+                inx = h;
+            }
+            else if (h < nodes-2 && value > m_node[h+1] &&
+                     value <= m_node[h+2]) {
+                inx = h + 1;
+            }
+            else if (h > 0 && value < m_node[h] && value >= m_node[h-1]) {
+                inx = h - 1;
+            }
         }
 
-        // Handle all other cases
-        else {
+        // If no index was found so far and if array is linear then get left
+        // index from analytic formula
+        if (inx < 0 && use_setup && m_is_linear) {
 
-            // If array is linear then get left index from analytic formula
-            if (m_is_linear) {
+            // Set left index
+            inx = int(m_linear_slope * value + m_linear_offset);
 
-                // Set left index
-                m_inx_left = int(m_linear_slope * value + m_linear_offset);
-        
-                // Keep index in valid range
-                if (m_inx_left < 0) {
-                    m_inx_left = 0;
-                }
-                else if (m_inx_left >= nodes-1) {
-                    m_inx_left = nodes - 2;
-                }
+            // Keep index in valid range
+            if (inx < 0) {
+                inx = 0;
+            }
+            else if (inx >= nodes-1) {
+                inx = nodes - 2;
+            }
+
+        } // endif: array is linear
+
+        // ... otherwise if no index was found so far then search the
+        // relevant indices by bisection
+        else if (inx < 0) {
 
-            } // endif: array is linear
+            // Set left index if value is before first node
+            if (value < m_node[0]) {
+                inx = 0;
+            }
+
+            // Set left index if value is after last node
+            else if (value >  m_node[nodes-1]) {
+                inx = nodes - 2;
+            }
 
-            // ... otherwise search the relevant indices by bisection
+            // Set left index by bisection
             else {
-    
-                // Set left index if value is before first node
-                if (value < m_node[0]) {
-                    m_inx_left = 0;
+                int low  = 0;
+                int high = nodes - 1;
+                while ((high - low) > 1) {
+                    int mid = (low+high) / 2;
+                    if (m_node[mid] > value) {
+                        high = mid;
+                    }
+                    else {
+                        low = mid;
+                    }
                 }
+                inx = low;
+            } // endelse: did bisection
+        }
 
-                // Set left index if value is after last node
-                else if (value >  m_node[nodes-1]) {
-                    m_inx_left = nodes - 2;
-                }
+        // Set indices
+        result.inx_left  = inx;
+        result.inx_right = inx + 1;
 
-                // Set left index by bisection
-                else {
-                    int low  = 0;
-                    int high = nodes - 1;
-                    while ((high - low) > 1) {
-                        int mid = (low+high) / 2;
-                        if (m_node[mid] > value) {
-                            high = mid;
-                        }
-                        else {
-                            low = mid;
-                        }
-                    }
-                    m_inx_left = low;
-                } // endelse: did bisection
-            }
+        // Set weighting factors
+        double step      = (use_setup) ? m_step[inx] : m_node[inx+1] - m_node[inx];
+        result.wgt_right = (value - m_node[inx]) / step;
+        result.wgt_left  = 1.0 - result.wgt_right;
 
-            // Set right index
-            m_inx_right = m_inx_left + 1;
+        // Update hint
+        if (hint != NULL) {
+            *hint = inx;
+        }
 
-            // Set weighting factors
-            m_wgt_right = (value - m_node[m_inx_left]) / m_step[m_inx_left];
-            m_wgt_left  = 1.0 - m_wgt_right;
+    } // endelse: more than one node was present
 
-        } // endelse: more than one node was present
+    // Return result
+    return result;
+}
 
-    } // endif: computation was required
 
-    // Store last value and signal availability
-    m_last_value     = value;
-    m_has_last_value = true;
+/***********************************************************************//**
+ * @brief Set indices and weighting factors for interpolation
+ *
+ * @param[in] value Value for which the interpolation should be done.
+ *
+ * @exception GException::invalid_value
+ *            No nodes are available for interpolation.
+ *
+ * Set the indices that bound the specified value and the corresponding
+ * weighting factors for linear interpolation (see locate()). The indices
+ * and weighting factors can be recovered using inx_left(), inx_right(),
+ * wgt_left() and wgt_right().
+ *
+ * Note that this method stores the indices and weighting factors in the
+ * node array, hence it is not safe to call the method concurrently from
+ * several threads. Use locate() for concurrent interpolation.
+ ***************************************************************************/
+void GNodeArray::set_value(const double& value) const
+{
+    // Get indices and weighting factors
+    GNodeArray::weights w = locate(value);
+
+    // Store indices and weighting factors
+    m_inx_left  = w.inx_left;
+    m_inx_right = w.inx_right;
+    m_wgt_left  = w.wgt_left;
+    m_wgt_right = w.wgt_right;
 
     // Return
     return;
@@ -874,8 +928,6 @@ void GNodeArray::init_members(void)
     m_node.clear();
     m_step.clear();
     m_is_linear      = false;
-    m_has_last_value = false;
-    m_last_value     = 0.0;
     m_linear_slope   = 0.0;
     m_linear_offset  = 0.0;
     m_inx_left       = 0;
@@ -900,8 +952,6 @@ void GNodeArray::copy_members(const GNodeArray& array)
     m_node           = array.m_node;
     m_step           = array.m_step;
     m_is_linear      = array.m_is_linear;
-    m_has_last_value = array.m_has_last_value;
-    m_last_value     = array.m_last_value;
     m_linear_slope   = array.m_linear_slope;
     m_linear_offset  = array.m_linear_offset;
     m_inx_left       = array.m_inx_left;
@@ -910,6 +960,11 @@ void GNodeArray::copy_members(const GNodeArray& array)
     m_wgt_right      = array.m_wgt_right;
     m_need_setup     = array.m_need_setup;
 
+    // Setup node distances and linear array handling if they are outdated
+    if (m_need_setup) {
+        setup();
+    }
+
     // Return
     return;
 }
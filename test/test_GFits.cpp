@@ -391,6 +391,7 @@ void TestGFits::set(void)
     append(static_cast<pfunction>(&TestGFits::test_bintable_ulong), "Test bintable ulong");
     append(static_cast<pfunction>(&TestGFits::test_bintable_long), "Test bintable long");
     append(static_cast<pfunction>(&TestGFits::test_bintable_longlong), "Test bintable longlong");
+    append(static_cast<pfunction>(&TestGFits::test_bintable_mmap), "Test bintable memory mapping");
 
     // Return
     return;
@@ -745,6 +746,17 @@ void TestGFits::test_image_byte(void)
     // Test 4D pixel access
     TEST_4D_ACCESS_IO(2,2,2,2)
 
+    // Open FITS image with memory mapping
+    GFits infile_mmap(filename);
+    ptr = infile_mmap.image(0);
+    test_assert(!ptr->use_mmap(), "Check that memory mapping is disabled "
+                "by default");
+    ptr->use_mmap(true);
+    test_assert(ptr->use_mmap(), "Check that memory mapping is enabled");
+
+    // Test 4D pixel access with memory mapping
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
     // Free pixels
     delete [] pixels;
 
@@ -856,6 +868,17 @@ void TestGFits::test_image_short(void)
     // Test 4D pixel access
     TEST_4D_ACCESS_IO(2,2,2,2)
 
+    // Open FITS image with memory mapping
+    GFits infile_mmap(filename);
+    ptr = infile_mmap.image(0);
+    test_assert(!ptr->use_mmap(), "Check that memory mapping is disabled "
+                "by default");
+    ptr->use_mmap(true);
+    test_assert(ptr->use_mmap(), "Check that memory mapping is enabled");
+
+    // Test 4D pixel access with memory mapping
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
     // Free pixels
     delete [] pixels;
 
@@ -1075,6 +1098,17 @@ void TestGFits::test_image_float(void)
     // Test 4D pixel access
     TEST_4D_ACCESS_IO(2,2,2,2)
 
+    // Open FITS image with memory mapping
+    GFits infile_mmap(filename);
+    ptr = infile_mmap.image(0);
+    test_assert(!ptr->use_mmap(), "Check that memory mapping is disabled "
+                "by default");
+    ptr->use_mmap(true);
+    test_assert(ptr->use_mmap(), "Check that memory mapping is enabled");
+
+    // Test 4D pixel access with memory mapping
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
     // Free pixels
     delete [] pixels;
 
@@ -1130,6 +1164,17 @@ void TestGFits::test_image_double(void)
     // Test 4D pixel access
     TEST_4D_ACCESS_IO(2,2,2,2)
 
+    // Open FITS image with memory mapping
+    GFits infile_mmap(filename);
+    ptr = infile_mmap.image(0);
+    test_assert(!ptr->use_mmap(), "Check that memory mapping is disabled "
+                "by default");
+    ptr->use_mmap(true);
+    test_assert(ptr->use_mmap(), "Check that memory mapping is enabled");
+
+    // Test 4D pixel access with memory mapping
+    TEST_4D_ACCESS_IO(2,2,2,2)
+
     // Free pixels
     delete [] pixels;
 
@@ -1189,6 +1234,16 @@ void TestGFits::test_bintable_double(void)
     // Test multiple column table
     TEST_TABLE2;
 
+    // Test typed access to column data
+    const GFitsTableDoubleCol& ccol2 = col2;
+    const double*              data  = ccol2.data();
+    for (int row = 0; row < nrows; ++row) {
+        for (int inx = 0; inx < nvec; ++inx) {
+            test_value(data[row*nvec+inx], ccol2(row, inx), 1.0e-10,
+                       "Check typed column data access");
+        }
+    }
+
     // Return
     return;
 }
@@ -1467,6 +1522,115 @@ void TestGFits::test_bintable_longlong(void)
     return;
 }
 
+/***************************************************************************
+ * @brief Test memory mapped loading of FITS binary table columns
+ *
+ * Writes a table with columns of different types and reads the columns
+ * back with memory mapping enabled. The string column precedes the numeric
+ * columns so that the column offsets within a row are exercised, and the
+ * unsigned short column is stored with TZERO so that it has to fall back
+ * to the cfitsio read.
+ ***************************************************************************/
+void TestGFits::test_bintable_mmap(void)
+{
+    // Set filename
+    std::string filename = "test_bintable_mmap.fits";
+
+    // Remove FITS file
+    std::string cmd = "rm -rf "+ filename;
+    system(cmd.c_str());
+
+    // Set number of rows and vector columns
+    int nrows = 5;
+    int nvec  = 3;
+
+    // Setup columns
+    GFitsTableStringCol col1("STRING", nrows, 7);
+    GFitsTableDoubleCol col2("DOUBLE", nrows, nvec);
+    GFitsTableFloatCol  col3("FLOAT", nrows);
+    GFitsTableShortCol  col4("SHORT", nrows);
+    GFitsTableLongCol   col5("LONG", nrows);
+    GFitsTableUShortCol col6("USHORT", nrows);
+    for (int row = 0; row < nrows; ++row) {
+        col1(row) = "row"+gammalib::str(row);
+        for (int inx = 0; inx < nvec; ++inx) {
+            col2(row, inx) = 1.5 * row - 0.25 * inx;
+        }
+        col3(row) = 0.5 * row + 0.125;
+        col4(row) = -3 * row;
+        col5(row) = 100000 * row + 7;
+        col6(row) = 60000 - row;
+    }
+
+    // Write table
+    test_try("Write Table");
+    try {
+        GFits fits;
+        fits.open(filename, true);
+        GFitsBinTable table(nrows);
+        table.append(col1);
+        table.append(col2);
+        table.append(col3);
+        table.append(col4);
+        table.append(col5);
+        table.append(col6);
+        fits.append(table);
+        fits.save();
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Read table back with memory mapping enabled
+    test_try("Read Table with memory mapping");
+    try {
+        GFits          fits(filename);
+        GFitsTable*    table = fits.table(1);
+        GFitsTableCol* cols[6];
+        cols[0] = (*table)["STRING"];
+        cols[1] = (*table)["DOUBLE"];
+        cols[2] = (*table)["FLOAT"];
+        cols[3] = (*table)["SHORT"];
+        cols[4] = (*table)["LONG"];
+        cols[5] = (*table)["USHORT"];
+        for (int i = 0; i < 6; ++i) {
+            test_assert(!cols[i]->use_mmap(), "Check that memory mapping is "
+                        "disabled by default");
+            cols[i]->use_mmap(true);
+            test_assert(cols[i]->use_mmap(), "Check that memory mapping is "
+                        "enabled");
+        }
+        for (int row = 0; row < nrows; ++row) {
+            test_assert(cols[0]->string(row) == col1(row),
+                        "Check string column",
+                        "Expected \""+col1(row)+"\", found \""+
+                        cols[0]->string(row)+"\"");
+            for (int inx = 0; inx < nvec; ++inx) {
+                test_value(cols[1]->real(row, inx), col2(row, inx), 1.0e-10,
+                           "Check double vector column");
+            }
+            test_value(cols[2]->real(row), col3(row), 1.0e-6,
+                       "Check float column");
+            test_value(cols[3]->integer(row), col4(row),
+                       "Check short column");
+            test_value(cols[4]->integer(row), col5(row),
+                       "Check long column");
+            test_value(cols[5]->integer(row), col6(row),
+                       "Check ushort column");
+        }
+        fits.close();
+        test_try_success();
+    }
+    catch(std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
 
 /***************************************************************************
  * @brief Test unsigned long FITS binary table
@@ -247,6 +247,7 @@ void TestGMatrixSymmetric::set(void)
     append(static_cast<pfunction>(&TestGMatrixSymmetric::matrix_functions), "Test matrix functions");
     append(static_cast<pfunction>(&TestGMatrixSymmetric::matrix_compare), "Test matrix comparisons");
     append(static_cast<pfunction>(&TestGMatrixSymmetric::matrix_cholesky), "Test matrix Cholesky decomposition");
+    append(static_cast<pfunction>(&TestGMatrixSymmetric::matrix_outer_product), "Test matrix outer product update");
     append(static_cast<pfunction>(&TestGMatrixSymmetric::matrix_print), "Test matrix printing");
 
     // Set members
@@ -788,6 +789,71 @@ void TestGMatrixSymmetric::matrix_cholesky(void)
 }
 
 
+/***********************************************************************//**
+ * @brief Test matrix outer product update
+ *
+ * Tests the add_outer_product() methods by comparing the result to an
+ * explicit computation of the outer product for a full vector and for
+ * a compressed vector.
+ ***************************************************************************/
+void TestGMatrixSymmetric::matrix_outer_product(void)
+{
+    // Set vector
+    GVector v(4);
+    v[0] = 1.0;
+    v[1] = 0.0;
+    v[2] = -2.0;
+    v[3] = 3.0;
+
+    // Add outer product of full vector
+    GMatrixSymmetric full(4,4);
+    full.add_outer_product(v, 0.5);
+    full.add_outer_product(v, 0.5);
+
+    // Add outer product of compressed vector
+    GMatrixSymmetric compressed(4,4);
+    double values[] = {1.0, -2.0, 3.0};
+    int    inx[]    = {0, 2, 3};
+    compressed.add_outer_product(values, inx, 3, 2.0);
+
+    // Add outer product of compressed vector that covers all elements
+    GMatrixSymmetric dense(4,4);
+    double dense_values[] = {1.0, 0.0, -2.0, 3.0};
+    int    dense_inx[]    = {0, 1, 2, 3};
+    dense.add_outer_product(dense_values, dense_inx, 4);
+
+    // Check results
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            test_value(full(row,col), v[row]*v[col], 1.0e-15,
+                       "Test add_outer_product(GVector&, double&) method");
+            test_value(compressed(row,col), 2.0*v[row]*v[col], 1.0e-15,
+                       "Test add_outer_product(double*, int*, int&, double&)"
+                       " method");
+            test_value(dense(row,col), v[row]*v[col], 1.0e-15,
+                       "Test add_outer_product(double*, int*, int&, double&)"
+                       " method for full vector");
+        }
+    }
+
+    // Test vector size mismatch
+    test_try("Test add_outer_product() with incompatible vector");
+    try {
+        full.add_outer_product(GVector(3));
+        test_try_failure();
+    }
+    catch (GException::matrix_vector_mismatch &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***************************************************************************
  * @brief Test matrix printing
  ***************************************************************************/
@@ -387,6 +387,7 @@ void TestGModel::test_sky_model(void)
         test_value(sky.value(GPhoton(dir, energy, time)), 1.73e-07);
 
         // Test gradient
+        sky[2].factor_gradient(0.0);
         GVector vector = sky.gradients(GPhoton(dir, energy, time));
         test_value(vector[0], 0.0);
         test_value(vector[1], 0.0);
@@ -394,6 +395,19 @@ void TestGModel::test_sky_model(void)
         test_value(vector[3], 0.0);
         test_value(vector[4], 0.0);
         test_value(vector[5], 0.0);
+        test_value(sky[2].factor_gradient(), 0.0);
+
+        // Test gradient vector with offset versus parameter gradients
+        GVector gradients(sky.spectral()->size()+2);
+        double  value = sky.spectral()->eval_gradients(energy, time,
+                                                       gradients, 2);
+        test_value(gradients[0], 0.0);
+        test_value(gradients[1], 0.0);
+        test_value(gradients[2], 1e-07);
+        test_value(sky.spectral()->eval_gradients(energy, time), value);
+        for (int i = 0; i < sky.spectral()->size(); ++i) {
+            test_value((*sky.spectral())[i].factor_gradient(), gradients[2+i]);
+        }
 
         // Success if we reached this point
         test_try_success();
@@ -54,6 +54,8 @@ void TestGNumerics::set(void)
     append(static_cast<pfunction>(&TestGNumerics::test_romberg_integration),"Test Romberg integration");
     append(static_cast<pfunction>(&TestGNumerics::test_adaptive_simpson_integration),"Test adaptive Simpson integration");
     append(static_cast<pfunction>(&TestGNumerics::test_gauss_kronrod_integration),"Test Gauss-Kronrod integration");
+    append(static_cast<pfunction>(&TestGNumerics::test_gauss_legendre_integration),"Test Gauss-Legendre integration");
+    append(static_cast<pfunction>(&TestGNumerics::test_romberg_integrals),"Test Romberg integration of set of functions");
 
     // Return
     return;
@@ -193,6 +195,68 @@ std::cout << integral << std::endl;
 }
 
 
+/***********************************************************************//**
+ * @brief Test Gauss-Legendre integration
+ ***************************************************************************/
+void TestGNumerics::test_gauss_legendre_integration(void)
+{
+    // Set-up integral
+    Gauss     integrand(m_sigma);
+    GIntegral integral(&integrand);
+
+    // Integrate over the entire Gaussian
+    double result = integral.gauss_legendre(-10.0*m_sigma, 10.0*m_sigma, 64);
+    test_value(result,1.0,1.0e-6,"","Gaussian integral is not 1.0 (integral="+gammalib::str(result)+")");
+    test_value(integral.calls(), 64, "Expected 64 function calls, found "+
+               gammalib::str(integral.calls()));
+
+    // Test [-1sigma, 1sigma]
+    result = integral.gauss_legendre(-m_sigma, m_sigma, 8);
+    test_value(result,0.68268948130801355,1.0e-6,"","Gaussian integral is not 0.682689 (difference="+gammalib::str((result-0.68268948130801355))+")");
+
+    // Test [0.0, 1sigma]
+    result = integral.gauss_legendre(0.0, m_sigma, 8);
+    test_value(result,0.3413447460687748,1.0e-6,"","Gaussian integral is not 0.341345 (difference="+gammalib::str((result-0.3413447460687748))+")");
+
+    // Test that all rules integrate an almost constant function exactly
+    Gauss     constant(1.0e10);
+    GIntegral integral_constant(&constant);
+    for (int order = 1; order <= 64; ++order) {
+        result = integral_constant.gauss_legendre(-1.0, 1.0, order) /
+                 (2.0 * constant.eval(0.0));
+        test_value(result, 1.0, 1.0e-12,
+                   "Gauss-Legendre rule of order "+gammalib::str(order));
+    }
+
+    // Test invalid orders
+    test_try("Test Gauss-Legendre order 0");
+    try {
+        integral.gauss_legendre(0.0, 1.0, 0);
+        test_try_failure();
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+    test_try("Test Gauss-Legendre order 65");
+    try {
+        integral.gauss_legendre(0.0, 1.0, 65);
+        test_try_failure();
+    }
+    catch (GException::invalid_argument &e) {
+        test_try_success();
+    }
+    catch (std::exception &e) {
+        test_try_failure(e);
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Main test function
  ***************************************************************************/
@@ -217,3 +281,49 @@ int main(void)
     // Return
     return was_successful ? 0:1;
 }
+
+
+/***********************************************************************//**
+ * @brief Test Romberg integration of set of functions
+ *
+ * Checks that GIntegrals returns for each function the same result as
+ * GIntegral, both for a converging and for a fixed number of iterations.
+ ***************************************************************************/
+void TestGNumerics::test_romberg_integrals(void)
+{
+    // Set-up integrals
+    Gausses    integrands(m_sigma);
+    GIntegrals integrals(&integrands);
+    Gauss      integrand(m_sigma);
+    GIntegral  integral(&integrand);
+
+    // Integrate over the entire Gaussian
+    GVector result = integrals.romberg(-10.0*m_sigma, 10.0*m_sigma);
+    test_assert(result.size() == 3, "Expected 3 integrals, found "+
+                gammalib::str(result.size()));
+    test_value(result[0], 1.0, 1.0e-6);
+    test_value(result[1], 0.0, 1.0e-6);
+    test_value(result[2], m_sigma*m_sigma, 1.0e-5);
+    test_assert(integrals.is_valid(), "Integration is not valid");
+
+    // Test [0.0, 1sigma] and compare to GIntegral
+    result = integrals.romberg(0.0, m_sigma);
+    test_value(result[0], integral.romberg(0.0, m_sigma), 1.0e-6);
+    test_value(result[0], 0.3413447460687748, 1.0e-6);
+
+    // Test fixed number of iterations with several boundaries and compare
+    // to GIntegral
+    std::vector<double> bounds;
+    bounds.push_back(m_sigma);
+    bounds.push_back(-m_sigma);
+    bounds.push_back(0.2*m_sigma);
+    integrals.fixed_iter(5);
+    integral.fixed_iter(5);
+    result = integrals.romberg(bounds, 5);
+    test_value(result[0], integral.romberg(bounds, 5), 1.0e-12);
+    test_value(result[0], 0.68268948130801355, 1.0e-4);
+    test_value(result[1], 0.0, 1.0e-4);
+
+    // Return
+    return;
+}
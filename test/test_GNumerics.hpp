@@ -52,6 +52,29 @@ protected:
 };
 
 
+/***********************************************************************//**
+ * @class Gausses
+ *
+ * @brief Set of Gaussian functions
+ *
+ * Returns a Gaussian, the Gaussian multiplied by x and the Gaussian
+ * multiplied by x*x.
+ ***************************************************************************/
+class Gausses : public GFunctions {
+public:
+    Gausses(const double& sigma) : m_sigma(sigma) { return; }
+    virtual ~Gausses(void) { return; }
+    int size(void) const { return 3; }
+    GVector eval(const double& x) {
+        double arg = -0.5*x*x/m_sigma/m_sigma;
+        double val = 1.0/std::sqrt(gammalib::twopi)/m_sigma * std::exp(arg);
+        return GVector(val, x*val, x*x*val);
+    }
+protected:
+    double m_sigma;
+};
+
+
 /***********************************************************************//**
  * @class TestGNumerics
  *
@@ -72,6 +95,8 @@ public:
     void                   test_romberg_integration(void);
     void                   test_adaptive_simpson_integration(void);
     void                   test_gauss_kronrod_integration(void);
+    void                   test_gauss_legendre_integration(void);
+    void                   test_romberg_integrals(void);
 
 private:
     // Private members
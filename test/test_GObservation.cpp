@@ -28,6 +28,7 @@
 #ifdef HAVE_CONFIG_H
 #include <config.h>
 #endif
+#include <cmath>
 #include "testinst/GTestLib.hpp"
 #include "test_GObservation.hpp"
 
@@ -964,6 +965,107 @@ void TestGObservation::test_photons(void)
 
 
 #ifdef _OPENMP
+/* __ Prefetch test counters _____________________________________________ */
+static int g_prefetch_wait     = 0;   //!< Model evaluation waits for prefetch
+static int g_prefetch_started  = 0;   //!< Prefetch has started
+static int g_prefetch_calls    = 0;   //!< Number of prefetch calls
+static int g_prefetch_overlaps = 0;   //!< Prefetches overlapping evaluation
+static int g_model_evals       = 0;   //!< Number of model evaluations
+
+
+/***********************************************************************//**
+ * @brief Wait until a condition becomes true
+ *
+ * @param[in] flag Flag that is polled.
+ * @param[in] start Value that the flag has to exceed.
+ * @return True if the flag exceeds the value within 5 seconds.
+ ***************************************************************************/
+static bool wait_for_counter(const int* flag, const int& start)
+{
+    // Poll flag until it exceeds the start value or until the timeout
+    double tstop = omp_get_wtime() + 5.0;
+    while (omp_get_wtime() < tstop) {
+        int value;
+        #pragma omp atomic read
+        value = *flag;
+        if (value > start) {
+            return true;
+        }
+    }
+
+    // Return
+    return false;
+}
+
+
+/***********************************************************************//**
+ * @class GTestPrefetchModel
+ *
+ * @brief Test data model that counts its evaluations
+ *
+ * If g_prefetch_wait is set, the first evaluation waits until a prefetch
+ * has started, so that the prefetch is guaranteed to overlap with the
+ * evaluation of the remaining events.
+ ***************************************************************************/
+class GTestPrefetchModel : public GTestModelData {
+public:
+    GTestPrefetchModel(void) : GTestModelData() {}
+    virtual GTestPrefetchModel* clone(void) const {
+        return new GTestPrefetchModel(*this);
+    }
+    virtual double eval(const GEvent& event, const GObservation& obs) const {
+        count();
+        return GTestModelData::eval(event, obs);
+    }
+    virtual double eval_gradients(const GEvent& event,
+                                  const GObservation& obs) const {
+        count();
+        return GTestModelData::eval_gradients(event, obs);
+    }
+protected:
+    void count(void) const {
+        int wait;
+        #pragma omp atomic read
+        wait = g_prefetch_wait;
+        if (wait) {
+            wait_for_counter(&g_prefetch_started, 0);
+            #pragma omp atomic write
+            g_prefetch_wait = 0;
+        }
+        #pragma omp atomic
+        g_model_evals++;
+    }
+};
+
+
+/***********************************************************************//**
+ * @class GTestPrefetchObservation
+ *
+ * @brief Test observation that checks whether its prefetch overlaps with
+ *        model evaluations
+ ***************************************************************************/
+class GTestPrefetchObservation : public GTestObservation {
+public:
+    GTestPrefetchObservation(void) : GTestObservation() {}
+    virtual GTestPrefetchObservation* clone(void) const {
+        return new GTestPrefetchObservation(*this);
+    }
+    virtual void prefetch(void) const {
+        int start;
+        #pragma omp atomic read
+        start = g_model_evals;
+        #pragma omp atomic
+        g_prefetch_calls++;
+        #pragma omp atomic write
+        g_prefetch_started = 1;
+        if (wait_for_counter(&g_model_evals, start)) {
+            #pragma omp atomic
+            g_prefetch_overlaps++;
+        }
+    }
+};
+
+
 /***********************************************************************//**
 * @brief Set tests
 ***************************************************************************/
@@ -980,6 +1082,12 @@ void TestOpenMP::set(void)
     append(static_cast<pfunction>(&TestOpenMP::test_observations_optimizer_binned_1), "Test binned optimization (1 thread)");
     append(static_cast<pfunction>(&TestOpenMP::test_observations_optimizer_binned_10), "Test binned optimisation (10 threads)");
 
+    // Append event-level parallelism tests
+    append(static_cast<pfunction>(&TestOpenMP::test_observations_optimizer_unbinned_events), "Test unbinned optimization (1 observation, 10 threads)");
+    append(static_cast<pfunction>(&TestOpenMP::test_observations_optimizer_binned_events), "Test binned optimization (1 observation, 10 threads)");
+    append(static_cast<pfunction>(&TestOpenMP::test_likelihood_event_threads), "Test event-level likelihood parallelism");
+    append(static_cast<pfunction>(&TestOpenMP::test_likelihood_prefetch), "Test observation prefetching");
+
     // Return
     return;
 }
@@ -1001,10 +1109,11 @@ TestOpenMP* TestOpenMP::clone(void) const
  * @brief Test observations optimizer.
  *
  * @param[in] mode Testing mode.
+ * @param[in] nobs Number of observations.
  * 
  * This method supports two testing modes: 0 = unbinned and 1 = binned.
  ***************************************************************************/
-void TestOpenMP::test_observations_optimizer(const int& mode)
+void TestOpenMP::test_observations_optimizer(const int& mode, const int& nobs)
 {
     // Create Test Model
     GTestModelData model;
@@ -1024,7 +1133,7 @@ void TestOpenMP::test_observations_optimizer(const int& mode)
     GObservations obs;
 
     // Add some observation
-    for (int i = 0; i < 6; ++i) {
+    for (int i = 0; i < nobs; ++i) {
 
         // Random Generator
         GRan ran;
@@ -1140,6 +1249,159 @@ void TestOpenMP::test_observations_optimizer_binned_10(void)
     // Return
     return;
 }
+
+
+/***********************************************************************//**
+ * @brief Test optimizer with unbinned events of a single observation and
+ *        10 threads
+ *
+ * As there are fewer observations than threads, the events of the
+ * observation are distributed over the threads.
+ ***************************************************************************/
+void TestOpenMP::test_observations_optimizer_unbinned_events(void)
+{
+    // Test with 10 threads
+    omp_set_num_threads(10);
+    test_observations_optimizer(UN_BINNED, 1);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test optimizer with binned events of a single observation and
+ *        10 threads
+ *
+ * As there are fewer observations than threads, the bins of the
+ * observation are distributed over the threads.
+ ***************************************************************************/
+void TestOpenMP::test_observations_optimizer_binned_events(void)
+{
+    // Test with 10 threads
+    omp_set_num_threads(10);
+    test_observations_optimizer(BINNED, 1);
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test that event-level parallelism does not change the likelihood
+ *
+ * Evaluates the likelihood of a single unbinned and a single binned
+ * observation using 1 and 4 threads and checks that the log-likelihood
+ * values and the number of predicted events agree.
+ ***************************************************************************/
+void TestOpenMP::test_likelihood_event_threads(void)
+{
+    // Set time interval
+    GTime tmin(0.0);
+    GTime tmax(1800.0);
+
+    // Loop over unbinned and binned mode
+    for (int mode = UN_BINNED; mode <= BINNED; ++mode) {
+
+        // Create model
+        GTestModelData model;
+        GModels        models;
+        models.append(model);
+
+        // Generate events
+        GRan     ran;
+        GEvents* events = (mode == UN_BINNED)
+                          ? static_cast<GEvents*>(model.generateList(RATE,tmin,tmax,ran))
+                          : static_cast<GEvents*>(model.generateCube(RATE,tmin,tmax,ran));
+
+        // Create observation container with a single observation
+        GTestObservation ob;
+        ob.events(*events);
+        ob.ontime(tmax.secs()-tmin.secs());
+        GObservations obs;
+        obs.append(ob);
+        obs.models(models);
+        delete events;
+
+        // Evaluate likelihood with 1 thread
+        omp_set_num_threads(1);
+        obs.eval();
+        double logL_1  = obs.logL();
+        double npred_1 = obs.npred();
+
+        // Evaluate likelihood with 4 threads
+        omp_set_num_threads(4);
+        obs.eval();
+        double logL_4  = obs.logL();
+        double npred_4 = obs.npred();
+
+        // Check results
+        test_value(logL_4,  logL_1,  1.0e-6 * std::abs(logL_1));
+        test_value(npred_4, npred_1, 1.0e-6 * std::abs(npred_1));
+
+    } // endfor: looped over modes
+
+    // Return
+    return;
+}
+
+
+/***********************************************************************//**
+ * @brief Test that the next observation is prefetched during evaluation
+ *
+ * Evaluates the likelihood of two unbinned observations using 4 threads.
+ * As there are fewer observations than threads, the events of each
+ * observation are distributed over the threads, and one thread prefetches
+ * the second observation while the first one is evaluated. The test checks
+ * that the prefetch was done once and that model evaluations happened
+ * while the prefetch was running.
+ ***************************************************************************/
+void TestOpenMP::test_likelihood_prefetch(void)
+{
+    // Set time interval
+    GTime tmin(0.0);
+    GTime tmax(1800.0);
+
+    // Create model
+    GTestPrefetchModel model;
+    GModels            models;
+    models.append(model);
+
+    // Create observation container with two observations
+    GObservations obs;
+    for (int i = 0; i < 2; ++i) {
+        GRan ran;
+        ran.seed(i);
+        GTestEventList*          events = model.generateList(RATE,tmin,tmax,ran);
+        GTestPrefetchObservation ob;
+        ob.id(gammalib::str(i));
+        ob.events(*events);
+        ob.ontime(tmax.secs()-tmin.secs());
+        obs.append(ob);
+        delete events;
+    }
+    obs.models(models);
+
+    // Reset counters
+    g_prefetch_wait     = 1;
+    g_prefetch_started  = 0;
+    g_prefetch_calls    = 0;
+    g_prefetch_overlaps = 0;
+    g_model_evals       = 0;
+
+    // Evaluate likelihood with 4 threads
+    omp_set_num_threads(4);
+    obs.eval();
+
+    // Check that the second observation was prefetched once and that the
+    // prefetch overlapped with model evaluations
+    test_value(g_prefetch_calls, 1, "Check number of prefetches");
+    test_value(g_prefetch_overlaps, 1, "Check that prefetch overlapped with evaluation");
+    test_assert(g_model_evals > 0, "Check that models were evaluated");
+
+    // Return
+    return;
+}
 #endif
 
 
@@ -79,7 +79,12 @@ public:
     void                test_observations_optimizer_unbinned_10();
     void                test_observations_optimizer_binned_1();
     void                test_observations_optimizer_binned_10();
-    void                test_observations_optimizer(const int& mode=0);
+    void                test_observations_optimizer_unbinned_events();
+    void                test_observations_optimizer_binned_events();
+    void                test_likelihood_event_threads();
+    void                test_likelihood_prefetch();
+    void                test_observations_optimizer(const int& mode=0,
+                                                    const int& nobs=6);
 };
 #endif
 
@@ -262,6 +262,59 @@ double TestGSky::wcs_copy(GWcs* wcs, int nx, int ny, double& crpix1, double& crp
 }
 
 
+/***********************************************************************//**
+ * @brief Test consistency of vector transformations
+ *
+ * @param[in] wcs WCS object
+ * @param[in] nx Number of points in X
+ * @param[in] ny Number of points in Y
+ *
+ * Returns the maximum difference between the vector transformations and
+ * the single point transformations.
+ ***************************************************************************/
+double TestGSky::wcs_vector(GWcs* wcs, int nx, int ny)
+{
+    // Set sky pixels
+    std::vector<GSkyPixel> pixels;
+    for (int iy = 0; iy < ny; ++iy) {
+        for (int ix = 0; ix < nx; ++ix) {
+            pixels.push_back(GSkyPixel(double(ix), double(iy)));
+        }
+    }
+
+    // Perform vector transformations
+    std::vector<GSkyDir>   dirs    = wcs->pix2dir(pixels);
+    std::vector<GSkyPixel> pix_out = wcs->dir2pix(dirs);
+
+    // Initialise maximal angle and distance
+    double angle_max = 0.0;
+    double dist_max  = 0.0;
+
+    // Compare to single point transformations
+    for (int i = 0; i < pixels.size(); ++i) {
+
+        // Compare sky directions
+        double angle = dirs[i].dist_deg(wcs->pix2dir(pixels[i]));
+        if (angle > angle_max) {
+            angle_max = angle;
+        }
+
+        // Compare sky pixels
+        GSkyPixel pixel = wcs->dir2pix(dirs[i]);
+        double    dx    = pix_out[i].x()-pixel.x();
+        double    dy    = pix_out[i].y()-pixel.y();
+        double    dist  = std::sqrt(dx*dx+dy*dy);
+        if (dist > dist_max) {
+            dist_max = dist;
+        }
+
+    } // endfor: looped over pixels
+
+    // Return
+    return ((dist_max > angle_max) ? dist_max : angle_max);
+}
+
+
 /***********************************************************************//**
  * @brief Test GSkyPixel class
  *
@@ -466,6 +519,32 @@ void TestGSky::test_GWcs(void)
                 test_try_failure(e);
             }
 
+            // Test CEL vector transformations
+            test_try("Test CEL vector transformations");
+            try {
+                double tol = 0.0;
+                if ((tol = wcs_vector(cel, nx, ny)) > 1.0e-10) {
+                    throw exception_failure("CEL vector transformation tolerance 1.0e-10 exceeded: "+gammalib::str(tol));
+                }
+                test_try_success();
+            }
+            catch (std::exception &e) {
+                test_try_failure(e);
+            }
+
+            // Test GAL vector transformations
+            test_try("Test GAL vector transformations");
+            try {
+                double tol = 0.0;
+                if ((tol = wcs_vector(gal, nx, ny)) > 1.0e-10) {
+                    throw exception_failure("GAL vector transformation tolerance 1.0e-10 exceeded: "+gammalib::str(tol));
+                }
+                test_try_success();
+            }
+            catch (std::exception &e) {
+                test_try_failure(e);
+            }
+
             // Test CEL copy
             test_try("Test CEL copy");
             try {
@@ -1006,6 +1085,228 @@ void TestGSky::test_GSkymap(void)
 	test_value(total_extract, total_src, 1.0e-3, "Test extract() method with 2 maps");
 	test_value(map_extract.nmaps(), 2, "Test extract() method with 2 maps");    
 
+    // Test sky directions of all pixels for WCS and HealPix maps
+    GSkymap map_ring("GAL", 4, "RING");
+    GSkymap map_nest("GAL", 4, "NESTED");
+    const std::vector<GSkyDir>& dirs_dst  = map_dst.dirs();
+    const std::vector<GSkyDir>& dirs_ring = map_ring.dirs();
+    const std::vector<GSkyDir>& dirs_nest = map_nest.dirs();
+    test_value((int)dirs_dst.size(), map_dst.npix(),
+               "Test number of sky directions of WCS map");
+    test_value((int)dirs_ring.size(), map_ring.npix(),
+               "Test number of sky directions of HealPix RING map");
+    test_value((int)dirs_nest.size(), map_nest.npix(),
+               "Test number of sky directions of HealPix NESTED map");
+    double dist_max = 0.0;
+    for (int pix = 0; pix < map_dst.npix(); ++pix) {
+        double dist = dirs_dst[pix].dist_deg(map_dst.inx2dir(pix));
+        if (dist > dist_max) {
+            dist_max = dist;
+        }
+    }
+    test_value(dist_max, 0.0, 1.0e-10, "Test sky directions of WCS map");
+    dist_max = 0.0;
+    for (int pix = 0; pix < map_ring.npix(); ++pix) {
+        double dist = dirs_ring[pix].dist_deg(map_ring.inx2dir(pix));
+        if (dist > dist_max) {
+            dist_max = dist;
+        }
+    }
+    test_value(dist_max, 0.0, 1.0e-10, "Test sky directions of HealPix RING map");
+    dist_max = 0.0;
+    for (int pix = 0; pix < map_nest.npix(); ++pix) {
+        double dist = dirs_nest[pix].dist_deg(map_nest.inx2dir(pix));
+        if (dist > dist_max) {
+            dist_max = dist;
+        }
+    }
+    test_value(dist_max, 0.0, 1.0e-10, "Test sky directions of HealPix NESTED map");
+
+    // Test sky directions of a copied map that are computed concurrently
+    GSkymap map_copy_dirs = map_dst;
+    int     nbad_dirs     = 0;
+    #pragma omp parallel for reduction(+:nbad_dirs)
+    for (int pix = 0; pix < map_copy_dirs.npix(); ++pix) {
+        if (map_copy_dirs.dirs()[pix].dist_deg(dirs_dst[pix]) > 1.0e-10) {
+            nbad_dirs++;
+        }
+    }
+    test_value(nbad_dirs, 0, "Test sky directions of copied WCS map");
+
+    // Test HealPix vector transformations back to pixels
+    std::vector<GSkyPixel> pixels_ring = map_ring.projection()->dir2pix(dirs_ring);
+    std::vector<GSkyPixel> pixels_nest = map_nest.projection()->dir2pix(dirs_nest);
+    int nbad = 0;
+    for (int pix = 0; pix < map_ring.npix(); ++pix) {
+        if (int(pixels_ring[pix]) != pix || int(pixels_nest[pix]) != pix) {
+            nbad++;
+        }
+    }
+    test_value(nbad, 0, "Test HealPix vector transformations");
+
+    // Test interpolator for sky directions within and outside the map
+    GSkyDir dir_inside;
+    GSkyDir dir_outside;
+    dir_inside.lb_deg(1.23, -2.34);
+    dir_outside.lb_deg(45.0, 45.0);
+    GBilinear interpolator = map_src.interpolator(dir_inside);
+    test_value(map_src(interpolator, 0), map_src(dir_inside, 0), 1.0e-10,
+               "Test interpolator for first map");
+    test_value(map_src(interpolator, 1), map_src(dir_inside, 1), 1.0e-10,
+               "Test interpolator for second map");
+    test_assert(map_src(interpolator, 0) > 0.0,
+                "Test that interpolated value inside map is positive");
+    interpolator = map_src.interpolator(dir_outside);
+    test_value(map_src(interpolator, 0), 0.0, 1.0e-10,
+               "Test interpolator for sky direction outside map");
+    test_value(map_src(dir_outside, 0), 0.0, 1.0e-10,
+               "Test sky direction outside map");
+
+    // Test cached solid angles
+    double diff_max = 0.0;
+    for (int pix = 0; pix < map_dst.npix(); ++pix) {
+        double diff = std::abs(map_dst.solidangle(pix) -
+                               map_dst.projection()->solidangle(map_dst.inx2pix(pix)));
+        if (diff > diff_max) {
+            diff_max = diff;
+        }
+    }
+    test_value(diff_max, 0.0, 1.0e-15, "Test cached solid angles of WCS map");
+    GSkymap map_copy_sa = map_dst;
+    int     nbad_sa     = 0;
+    #pragma omp parallel for reduction(+:nbad_sa)
+    for (int pix = 0; pix < map_copy_sa.npix(); ++pix) {
+        if (std::abs(map_copy_sa.solidangle(pix) -
+                     map_dst.solidangle(pix)) > 1.0e-15) {
+            nbad_sa++;
+        }
+    }
+    test_value(nbad_sa, 0, "Test cached solid angles of copied WCS map");
+    diff_max = 0.0;
+    for (int pix = 0; pix < map_ring.npix(); ++pix) {
+        double diff = std::abs(map_ring.solidangle(pix) -
+                               map_ring.projection()->solidangle(map_ring.inx2pix(pix)));
+        if (diff > diff_max) {
+            diff_max = diff;
+        }
+    }
+    test_value(diff_max, 0.0, 1.0e-15, "Test cached solid angles of HealPix map");
+
+    // Test shared pixels
+    GSkymap map_shared = map_src;
+    map_shared.share();
+    GSkymap map_copy = map_shared;
+    test_assert(map_copy.is_shared(), "Test that copy of shared map is shared");
+    test_assert(map_copy.pixels() == map_shared.pixels(),
+                "Test that copy of shared map references same pixels");
+    map_copy(0,0) = -1.0;
+    test_assert(map_copy.pixels() != map_shared.pixels(),
+                "Test that modified copy of shared map has private pixels");
+    test_assert(!map_copy.is_shared(),
+                "Test that modified copy of shared map is no longer shared");
+    test_value(map_copy(0,0), -1.0, 1.0e-10,
+               "Test pixel value of modified copy of shared map");
+    test_value(map_shared(0,0), map_src(0,0), 1.0e-10,
+               "Test pixel value of shared map after modification of copy");
+    map_copy = map_shared;
+    map_shared.clear();
+    test_value(map_copy(0,0), map_src(0,0), 1.0e-10,
+               "Test pixel value of copy after clearing shared map");
+
+    // Test single precision pixels
+    GSkymap map_float = map_src;
+    map_float.single_precision();
+    const GSkymap& map_float_ref = map_float;
+    test_assert(map_float.is_single_precision(),
+                "Test that map is stored in single precision");
+    test_value(map_float_ref(0,1), map_src(0,1), 1.0e-6,
+               "Test pixel value of single precision map");
+    test_value(map_float_ref(dir_inside,1), map_src(dir_inside,1), 1.0e-6,
+               "Test interpolated value of single precision map");
+    test_assert(map_float_ref.fpixels() != NULL,
+                "Test that single precision pixels are available");
+    test_assert(map_src.fpixels() == NULL,
+                "Test that double precision map has no single precision "
+                "pixels");
+    test_value(map_float_ref.fpixels()[1], map_src(1,0), 1.0e-6,
+               "Test single precision pixels of single precision map");
+    test_value(map_float_ref.pixels()[1], map_src(1,0), 1.0e-6,
+               "Test double precision copy of single precision map");
+    GSkymap map_float_dcopy = map_float;
+    int     nbad_dcopy      = 0;
+    #pragma omp parallel for reduction(+:nbad_dcopy)
+    for (int i = 0; i < map_float_dcopy.npix(); ++i) {
+        const GSkymap& ref = map_float_dcopy;
+        if (std::abs(ref.pixels()[i] - double(ref.fpixels()[i])) > 0.0) {
+            nbad_dcopy++;
+        }
+    }
+    test_value(nbad_dcopy, 0,
+               "Test double precision copy of single precision map that is "
+               "created concurrently");
+    test_assert(map_float.is_single_precision(),
+                "Test that map is still stored in single precision");
+    map_float.share();
+    GSkymap map_float_copy = map_float;
+    test_assert(map_float_copy.is_single_precision(),
+                "Test that copy of single precision map is single precision");
+    test_assert(map_float_copy.is_shared(),
+                "Test that copy of shared single precision map is shared");
+    map_float_copy(0,0) = -1.0;
+    test_assert(!map_float_copy.is_single_precision(),
+                "Test that modified single precision map is double precision");
+    test_value(map_float_copy(0,0), -1.0, 1.0e-10,
+               "Test pixel value of modified single precision map");
+    test_value(map_float_ref(0,0), map_src(0,0), 1.0e-6,
+               "Test pixel value of single precision map after modification "
+               "of copy");
+    GSkymap map_float_extract = map_float.extract(1);
+    test_value(map_float_extract(0,0), map_src(0,1), 1.0e-6,
+               "Test extraction from single precision map");
+
+    // Test pixel-major layout
+    GSkymap map_pm = map_src;
+    map_pm.pixel_major();
+    const GSkymap& map_pm_ref = map_pm;
+    test_assert(map_pm.is_pixel_major(), "Test that map is pixel-major");
+    test_value(map_pm.pixels()[1], map_src(0,1), 1.0e-10,
+               "Test that maps of a pixel are contiguous");
+    test_value(map_pm_ref(5,1), map_src(5,1), 1.0e-10,
+               "Test pixel value of pixel-major map");
+    test_value(map_pm_ref(dir_inside,1), map_src(dir_inside,1), 1.0e-10,
+               "Test interpolated value of pixel-major map");
+    map_pm(5,1) = -1.0;
+    test_value(map_pm_ref(5,1), -1.0, 1.0e-10,
+               "Test modified pixel value of pixel-major map");
+    map_pm(5,1) = map_src(5,1);
+    GSkymap map_pm_extract = map_pm.extract(1);
+    test_assert(!map_pm_extract.is_pixel_major(),
+                "Test that extracted map is map-major");
+    test_value(map_pm_extract(5,0), map_src(5,1), 1.0e-10,
+               "Test extraction from pixel-major map");
+    GSkymap map_pm_nmaps = map_pm;
+    map_pm_nmaps.nmaps(3);
+    test_assert(map_pm_nmaps.is_pixel_major(),
+                "Test that map is still pixel-major after adding maps");
+    test_value(map_pm_nmaps(5,1), map_src(5,1), 1.0e-10,
+               "Test pixel value after adding maps to pixel-major map");
+    test_value(map_pm_nmaps(5,2), 0.0, 1.0e-10,
+               "Test pixel value of map added to pixel-major map");
+    GSkymap map_pm_float = map_pm;
+    map_pm_float.single_precision();
+    const GSkymap& map_pm_float_ref = map_pm_float;
+    test_value(map_pm_float_ref(dir_inside,1), map_src(dir_inside,1), 1.0e-6,
+               "Test interpolated value of single precision pixel-major map");
+    map_pm.save("test_skymap_pixel_major.fits", true);
+    GSkymap map_pm_load("test_skymap_pixel_major.fits");
+    test_assert(!map_pm_load.is_pixel_major(), "Test that loaded map is map-major");
+    test_value(map_pm_load(5,1), map_src(5,1), 1.0e-10,
+               "Test pixel value of saved pixel-major map");
+    map_pm.pixel_major(false);
+    test_assert(!map_pm.is_pixel_major(), "Test that map is map-major");
+    test_value(map_pm.pixels()[1], map_src(1,0), 1.0e-10,
+               "Test that pixels of a map are contiguous");
+
     // Exit test
     return;
 }
@@ -57,6 +57,7 @@ public:
 private:
     double wcs_forth_back_pixel(GWcs* wcs, int nx, int ny, double& crpix1, double& crpix2);
     double wcs_copy(GWcs* wcs, int nx, int ny, double& crpix1, double& crpix2);
+    double wcs_vector(GWcs* wcs, int nx, int ny);
 };
 
 #endif /* TEST_GSKY_HPP */
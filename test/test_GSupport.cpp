@@ -385,6 +385,9 @@ void TestGSupport::test_node_array(void)
  *
  * Test the GNodeArray class interpolation method by comparing the
  * interpolation results for a linear function to the expected result.
+ * Also checks that the indices and weights returned by the locate() method,
+ * with and without a search hint, are identical to those that are set by
+ * the set_value() method.
  ***************************************************************************/
 void TestGSupport::test_node_array_interpolation(const int&    num,
                                                  const double* nodes)
@@ -409,6 +412,42 @@ void TestGSupport::test_node_array_interpolation(const int&    num,
         test_value(result, expected);
     }
 
+    // Test locate method with and without hint
+    int hint = -1;
+    for (double value = -2.0; value <= +2.0; value += 0.2) {
+        array.set_value(value);
+        GNodeArray::weights w1 = array.locate(value);
+        GNodeArray::weights w2 = array.locate(value, &hint);
+        test_value(w1.inx_left,  array.inx_left());
+        test_value(w1.inx_right, array.inx_right());
+        test_value(w1.wgt_left,  array.wgt_left());
+        test_value(w1.wgt_right, array.wgt_right());
+        test_value(w2.inx_left,  array.inx_left());
+        test_value(w2.inx_right, array.inx_right());
+        test_value(w2.wgt_left,  array.wgt_left());
+        test_value(w2.wgt_right, array.wgt_right());
+        test_value(hint, array.inx_left());
+    }
+
+    // Test interpolation after modification of the nodes through the
+    // access operator, which uses the node values directly
+    GNodeArray shifted(array);
+    for (int i = 0; i < num; ++i) {
+        shifted[i] = nodes[i] + 1.0;
+    }
+    for (double value = -2.0; value <= +2.0; value += 0.2) {
+        double expected = value * slope + offset;
+        double result   = shifted.interpolate(value + 1.0, values);
+        test_value(result, expected);
+    }
+
+    // Test that a copy of the modified node array interpolates identically
+    GNodeArray copy(shifted);
+    for (double value = -2.0; value <= +2.0; value += 0.2) {
+        test_value(copy.interpolate(value, values),
+                   shifted.interpolate(value, values));
+    }
+
     // Return
     return;
 }
@@ -54,6 +54,7 @@ void TestGVector::set(void){
     append(static_cast<pfunction>(&TestGVector::assign), "Assign values");
     append(static_cast<pfunction>(&TestGVector::arithmetics), "Assignment and arithmetics");
     append(static_cast<pfunction>(&TestGVector::comparison), "Comparison");
+    append(static_cast<pfunction>(&TestGVector::vector3), "Three-dimensional vector and matrix");
 
     return;
 }
@@ -528,6 +529,65 @@ void TestGVector::comparison(void){
 }
 
 
+/***********************************************************************//**
+ * @brief Three-dimensional vector and matrix
+ *
+ * Checks that GVector3 and GMatrix3 give the same results as GVector and
+ * GMatrix.
+ ***************************************************************************/
+void TestGVector::vector3(void)
+{
+    // Set vectors
+    GVector  a(0.3, -1.2, 2.5);
+    GVector  b(-0.7, 0.4, 1.1);
+    GVector3 a3(0.3, -1.2, 2.5);
+    GVector3 b3(-0.7, 0.4, 1.1);
+
+    // Test vector operations
+    GVector  sum   = a + b;
+    GVector  diff  = a - b;
+    GVector  prod  = cross(a, b);
+    GVector3 sum3  = a3 + b3;
+    GVector3 diff3 = a3 - b3;
+    GVector3 prod3 = cross(a3, b3);
+    for (int i = 0; i < 3; ++i) {
+        test_value(sum3[i], sum[i], 1.0e-15, "Test sum of vectors");
+        test_value(diff3[i], diff[i], 1.0e-15, "Test difference of vectors");
+        test_value(prod3[i], prod[i], 1.0e-15, "Test cross product");
+    }
+    test_value(a3 * b3, a * b, 1.0e-15, "Test scalar product");
+    test_value(norm(a3), norm(a), 1.0e-15, "Test norm");
+
+    // Set rotation matrices
+    GMatrix  ry;
+    GMatrix  rz;
+    GMatrix3 ry3;
+    GMatrix3 rz3;
+    ry.eulery(-67.3);
+    rz.eulerz(-83.6);
+    ry3.eulery(-67.3);
+    rz3.eulerz(-83.6);
+    GMatrix  rot  = (ry * rz).transpose();
+    GMatrix3 rot3 = (ry3 * rz3).transpose();
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            test_value(rot3(row,col), rot(row,col), 1.0e-15,
+                       "Test rotation matrix");
+        }
+    }
+
+    // Test rotation of vector
+    GVector  rotated  = rot * a;
+    GVector3 rotated3 = rot3 * a3;
+    for (int i = 0; i < 3; ++i) {
+        test_value(rotated3[i], rotated[i], 1.0e-15, "Test vector rotation");
+    }
+
+    // Return
+    return;
+}
+
+
 /***********************************************************************//**
  * @brief Main test entry point
  ***************************************************************************/
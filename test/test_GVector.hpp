@@ -52,6 +52,7 @@ public:
     void                 assign(void);
     void                 arithmetics(void);
     void                 comparison(void);
+    void                 vector3(void);
 
 // Private members
 private:
@@ -87,6 +87,7 @@ public:
     virtual void                 read(const GXmlElement& xml) { return; }
     virtual void                 write(GXmlElement& xml) const { return; }
     virtual void                 ontime(const double& ontime) { m_ontime=ontime; }
+    virtual bool                 is_threadsafe(void) const { return true; }
     virtual std::string          print(const GChatter& chatter = NORMAL) const {
         std::string result;
         result.append("=== GTestObservation ===");